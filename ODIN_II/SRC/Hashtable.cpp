@@ -23,45 +23,108 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <functional>
 
 #include "Hashtable.hpp"
 #include "odin_types.h"
 #include "vtr_memory.h"
 
+Hashtable::Hashtable()
+{
+	slots.resize(64);
+}
+
+size_t Hashtable::hash_key(const std::string& key)
+{
+	size_t hash = std::hash<std::string>()(key);
+	// 0 is reserved as the empty-slot marker
+	return hash ? hash : 1;
+}
+
+size_t Hashtable::probe(size_t hash, const std::string& key) const
+{
+	size_t mask = slots.size() - 1;
+	size_t slot = hash & mask;
+	while(slots[slot].hash != 0
+	      && (slots[slot].hash != hash || slots[slot].key != key))
+		slot = (slot + 1) & mask;
+	return slot;
+}
+
+void Hashtable::grow()
+{
+	std::vector<slot_t> old_slots(slots.size() * 2);
+	old_slots.swap(slots);
+	for(slot_t& old: old_slots)
+	{
+		if(old.hash == 0)
+			continue;
+		size_t slot = probe(old.hash, old.key);
+		slots[slot] = std::move(old);
+	}
+}
+
 void Hashtable::destroy_free_items()
 {
-	for(auto kv: my_map)
-		vtr::free(kv.second);
+	for(slot_t& slot: slots)
+		if(slot.hash != 0)
+			vtr::free(slot.item);
 }
 
 void Hashtable::add(std::string key, void *item)
 {
-	this->my_map.insert({key,item});
+	// keep the table at most half full so probe sequences stay short
+	if((count + 1) * 2 > slots.size())
+		grow();
+
+	size_t hash = hash_key(key);
+	size_t slot = probe(hash, key);
+	if(slots[slot].hash != 0)
+		return; // match std::unordered_map::insert: keep the existing item
+
+	slots[slot].hash = hash;
+	slots[slot].key = std::move(key);
+	slots[slot].item = item;
+	count++;
 }
 
 void* Hashtable::remove(std::string key)
 {
-	void *value = NULL;
-	auto v = this->my_map.find(key);
-	if(v != this->my_map.end())
+	size_t hash = hash_key(key);
+	size_t slot = probe(hash, key);
+	if(slots[slot].hash == 0)
+		return NULL;
+
+	void *value = slots[slot].item;
+	slots[slot] = slot_t();
+	count--;
+
+	// Backward-shift any displaced entries so later probes still find them
+	size_t mask = slots.size() - 1;
+	size_t hole = slot;
+	size_t next = (hole + 1) & mask;
+	while(slots[next].hash != 0)
 	{
-		value = this->my_map[key];
-		this->my_map.erase(key);
+		size_t home = slots[next].hash & mask;
+		if(((next - home) & mask) >= ((next - hole) & mask))
+		{
+			slots[hole] = std::move(slots[next]);
+			slots[next] = slot_t();
+			hole = next;
+		}
+		next = (next + 1) & mask;
 	}
+
 	return value;
 }
 
 void* Hashtable::get(std::string key)
 {
-	void *value = NULL;
-	auto v = this->my_map.find(key);
-	if(v != this->my_map.end())
-		value = this->my_map[key];
-	
-	return value;
+	size_t slot = probe(hash_key(key), key);
+	return (slots[slot].hash != 0)? slots[slot].item : NULL;
 }
 
 bool Hashtable::is_empty ()
 {
-	return (my_map.size() == 0);
+	return (count == 0);
 }
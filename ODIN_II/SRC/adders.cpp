@@ -26,6 +26,9 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 #include "odin_types.h"
 #include "odin_util.h"
@@ -915,7 +918,7 @@ void split_adder(nnode_t *nodeo, int a, int b, int sizea, int sizeb, int cin, in
 	/* Free arrays NOT the pins since relocated! */
 	vtr::free(nodeo->input_pins);
 	vtr::free(nodeo->output_pins);
-	vtr::free(nodeo);
+	recycle_nnode(nodeo);
 	vtr::free(node);
 	return;
 }
@@ -1046,57 +1049,107 @@ void reduce_operations(netlist_t * /*netlist*/, operation_list op)
  *-----------------------------------------------------------------------*/
 void traverse_list(operation_list oper, t_linked_vptr *place)
 {
-		while (place != NULL && place->next != NULL)
-		{
-			match_node(place, oper);
-			place = place->next;
-		}
-}
+	if (place == NULL || place->next == NULL)
+		return;
 
-/*---------------------------------------------------------------------------
- * (function: match_node)
- *-------------------------------------------------------------------------*/
-void match_node(t_linked_vptr *place, operation_list oper)
-{
-	int flag = 0;
-    int mark = 0;
-	nnode_t *node = NULL;
-	nnode_t *next_node = NULL;
-	node = (nnode_t*)place->data_vptr;
-	t_linked_vptr *pre = place;
-	t_linked_vptr *next = NULL;
-	if (place->next != NULL)
-		next = place->next;
-	while (next != NULL)
+	/* Snapshot the list cells so the candidates can be indexed; cells are
+	 * only ever removed behind the head, so the caller's head pointer
+	 * stays valid. */
+	std::vector<t_linked_vptr*> cells;
+	t_linked_vptr *cell;
+	for (cell = place; cell != NULL; cell = cell->next)
+		cells.push_back(cell);
+
+	size_t num_nodes = cells.size();
+
+	/* Bucket the candidates by a merge signature: node type, input pin
+	 * count and the set of drivers feeding the inputs. With equal pin
+	 * counts match_pins() can only succeed between nodes with identical
+	 * driver sets, so instead of comparing every candidate against every
+	 * later one (quadratic in the number of adders/multipliers), each node
+	 * is only compared within its bucket, where the full
+	 * match_ports()/match_pins() check is still applied before merging.
+	 *
+	 * The one exception is a node fed more than once by the same driver
+	 * (e.g. a*a): its driver set is smaller than its pin count and may be
+	 * a strict subset of another node's. Such nodes are rare and fall back
+	 * to scanning their whole same-type/same-size group. */
+	std::vector<uint64_t> signatures(num_nodes);
+	std::vector<uint64_t> type_size_keys(num_nodes);
+	std::vector<char> has_duplicate_drivers(num_nodes, 0);
+	std::unordered_map<uint64_t, std::vector<size_t>> buckets;
+	std::unordered_map<uint64_t, std::vector<size_t>> type_size_groups;
+	std::vector<long> driver_ids;
+
+	size_t i;
+	for (i = 0; i < num_nodes; i++)
 	{
-		flag = 0;
-		mark = 0;
-		next_node = (nnode_t*)next->data_vptr;
-		if (node->type == next_node->type)
+		nnode_t *node = (nnode_t*)cells[i]->data_vptr;
+
+		driver_ids.clear();
+		int j;
+		for (j = 0; j < node->num_input_pins; j++)
+			driver_ids.push_back(node->input_pins[j]->net->driver_pin->unique_id);
+		std::sort(driver_ids.begin(), driver_ids.end());
+		driver_ids.erase(std::unique(driver_ids.begin(), driver_ids.end()), driver_ids.end());
+
+		has_duplicate_drivers[i] = ((long)driver_ids.size() < node->num_input_pins);
+
+		uint64_t type_size_key = ((uint64_t)node->type << 32) ^ (uint64_t)node->num_input_pins;
+		uint64_t signature = type_size_key;
+		for (size_t k = 0; k < driver_ids.size(); k++)
+			signature = signature * 1000003u ^ (uint64_t)driver_ids[k];
+
+		signatures[i] = signature;
+		type_size_keys[i] = type_size_key;
+		buckets[signature].push_back(i);
+		type_size_groups[type_size_key].push_back(i);
+	}
+
+	/* Merge within buckets, preserving the original list-order semantics:
+	 * earlier nodes absorb later ones, and absorbed nodes take no further
+	 * part in matching */
+	std::vector<char> removed(num_nodes, 0);
+	for (i = 0; i < num_nodes; i++)
+	{
+		if (removed[i])
+			continue;
+
+		nnode_t *node = (nnode_t*)cells[i]->data_vptr;
+		const std::vector<size_t> &candidates = has_duplicate_drivers[i]
+													? type_size_groups[type_size_keys[i]]
+													: buckets[signatures[i]];
+
+		for (size_t c = 0; c < candidates.size(); c++)
 		{
-			if (node->num_input_pins == next_node->num_input_pins)
+			size_t inext = candidates[c];
+			if (inext <= i || removed[inext])
+				continue;
+
+			nnode_t *next_node = (nnode_t*)cells[inext]->data_vptr;
+
+			/* Re-check the cheap filters in case of signature collisions */
+			if (node->type != next_node->type || node->num_input_pins != next_node->num_input_pins)
+				continue;
+
+			if (match_ports(node, next_node, oper) == 1 && match_pins(node, next_node) == 1)
 			{
-				flag = match_ports(node, next_node, oper);
-				if (flag == 1)
-				{
-					mark = match_pins(node, next_node);
-					if (mark == 1)
-					{
-						merge_nodes(node, next_node);
-						remove_list_node(pre, next);	
-					}
-				}
+				merge_nodes(node, next_node);
+				removed[inext] = 1;
 			}
 		}
-		if (mark == 1)
-			next = pre->next;
-		else
-		{
-			pre = next;
-			next= next->next;
-		}
 	}
 
+	/* Unlink the merged-away cells (the head is never removed, since
+	 * absorbed nodes are always later in the list than their absorber) */
+	t_linked_vptr *pre = cells[0];
+	for (i = 1; i < num_nodes; i++)
+	{
+		if (removed[i])
+			remove_list_node(pre, cells[i]);
+		else
+			pre = cells[i];
+	}
 }
 
 /*---------------------------------------------------------------------------
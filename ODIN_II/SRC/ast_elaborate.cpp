@@ -45,6 +45,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "vtr_memory.h"
 #include <string>
 #include <iostream>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <stack>
 
@@ -1176,12 +1178,114 @@ ast_node_t *build_hierarchy(ast_node_t *node, ast_node_t * parent, int index, sc
 	return node;
 }
 
+/* ---------------------------------------------------------------------------------------------------
+ * Elaboration memoization for repeated module instances.
+ *
+ * A design instantiating one module N times with the same parameter binding elaborates N
+ * identical copies; finalize_ast and reduce_expressions re-derive the same result for each.
+ * Instead, the first instance of each (module, parameter binding) is elaborated normally and
+ * remembered, and every later identical instance is stamped from it: the elaborated AST and
+ * string cache hierarchy are deep copied and re-registered under the new instance's name,
+ * replacing its unelaborated copy.
+ *
+ * Only self-contained instances participate: all parameter values must have resolved to
+ * constants (otherwise the binding can't be keyed), and the module must contain no module/
+ * function/task instantiations or child scopes (those register per-instance entries in
+ * module_names_to_idx and sc_hierarchy trees which a stamped copy would not replicate).
+ * --------------------------------------------------------------------------------------------------- */
+struct elaborated_instance_t
+{
+	ast_node_t *instance;
+	sc_hierarchy *hierarchy;
+};
+
+static std::unordered_map<std::string, elaborated_instance_t> finalized_instance_cache;
+static std::unordered_map<std::string, elaborated_instance_t> reduced_instance_cache;
+/* instances referenced by a cache entry; these must never be stamped over (and freed) */
+static std::unordered_set<ast_node_t *> memoized_instances;
+
+/* builds a cache key from the module name and the instance's resolved parameter values;
+ * returns false (no memoization) if any parameter has not resolved to a constant */
+static bool get_elaboration_signature(ast_node_t *temp_instance, STRING_CACHE *instance_param_table_sc, std::string &signature)
+{
+	signature = temp_instance->children[0]->types.identifier;
+
+	if (instance_param_table_sc)
+	{
+		for (long i = 0; i < instance_param_table_sc->free; i++)
+		{
+			ast_node_t *value = (ast_node_t *)instance_param_table_sc->data[i];
+			if (!value || !node_is_constant(value) || !value->types.vnumber)
+			{
+				return false;
+			}
+
+			signature += std::string("|") + instance_param_table_sc->string[i]
+						+ "=" + value->types.vnumber->to_full_string();
+		}
+	}
+
+	return true;
+}
+
+static bool instance_is_self_contained(ast_node_t *instance)
+{
+	sc_hierarchy *hierarchy = instance->types.hierarchy;
+
+	return hierarchy
+		&& instance->types.module.size_module_instantiations == 0
+		&& instance->types.function.size_function_instantiations == 0
+		&& instance->types.task.size_task_instantiations == 0
+		&& hierarchy->num_module_children == 0
+		&& hierarchy->num_function_children == 0
+		&& hierarchy->num_task_children == 0
+		&& hierarchy->num_block_children == 0;
+}
+
+/* replaces old_instance (registered at sc_spot) with a copy of the memoized instance,
+ * keeping the old instance's name/scope, and frees the superseded copy */
+static ast_node_t *stamp_memoized_instance(const elaborated_instance_t &memo, ast_node_t *old_instance, long sc_spot, sc_hierarchy *local_ref)
+{
+	sc_hierarchy *old_hierarchy = old_instance->types.hierarchy;
+
+	ast_node_t *instance = ast_node_deep_copy(memo.instance);
+	sc_hierarchy *module_sc_hierarchy = copy_sc_hierarchy(memo.hierarchy);
+
+	module_sc_hierarchy->parent = old_hierarchy->parent;
+	module_sc_hierarchy->instance_name_prefix = vtr::strdup(old_hierarchy->instance_name_prefix);
+	module_sc_hierarchy->scope_id = vtr::strdup(old_hierarchy->scope_id);
+	module_sc_hierarchy->top_node = instance;
+	instance->types.hierarchy = module_sc_hierarchy;
+
+	module_names_to_idx->data[sc_spot] = (void *)instance;
+	ast_modules[sc_spot] = instance;
+
+	/* relink the parent scope's child reference before freeing the old hierarchy */
+	bool relinked = false;
+	for (int i = 0; i < local_ref->num_module_children; i++)
+	{
+		if (local_ref->module_children[i] == old_hierarchy)
+		{
+			local_ref->module_children[i] = module_sc_hierarchy;
+			relinked = true;
+		}
+	}
+
+	free_whole_tree(old_instance);
+	if (relinked)
+	{
+		free_sc_hierarchy(old_hierarchy);
+	}
+
+	return instance;
+}
+
 /* ---------------------------------------------------------------------------------------------------
  * (function: finalize_ast)
- * 
+ *
  * This function resolves all parameters, folds constant expressions that can be self-determined
  * (e.g. array/range refs, generate constructs), resolves module instances into module copies and hard
- * blocks (while updating their parameter tables with defparams), and adds symbols that it finds to 
+ * blocks (while updating their parameter tables with defparams), and adds symbols that it finds to
  * the symbol table.
  * Basic sanity checks also happen here that weren't caught during parsing, e.g. checking port
  * lists.
@@ -1596,15 +1700,34 @@ ast_node_t *finalize_ast(ast_node_t *node, ast_node_t *parent, sc_hierarchy *loc
 						instance = (ast_node_t *)module_names_to_idx->data[sc_spot];
 					}
 
-					sc_hierarchy *module_sc_hierarchy = instance->types.hierarchy;				
+					sc_hierarchy *module_sc_hierarchy = instance->types.hierarchy;
 
 					/* update the parameter table for the instantiated module */
 					STRING_CACHE *instance_param_table_sc = module_sc_hierarchy->local_param_table_sc;
 					update_instance_parameter_table(temp_instance, instance_param_table_sc);
 
-					/* elaboration */
+					/* elaboration; repeated (module, parameter binding) instances are
+						stamped from the first one's memoized result instead of re-elaborated */
 					update_string_caches(module_sc_hierarchy);
-					instance = finalize_ast(instance, NULL, module_sc_hierarchy, true, true);
+
+					std::string signature;
+					bool can_memoize = get_elaboration_signature(temp_instance, instance_param_table_sc, signature)
+						&& memoized_instances.find(instance) == memoized_instances.end();
+
+					auto memo = can_memoize ? finalized_instance_cache.find(signature) : finalized_instance_cache.end();
+					if (memo != finalized_instance_cache.end() && memo->second.instance != instance)
+					{
+						instance = stamp_memoized_instance(memo->second, instance, sc_spot, local_ref);
+					}
+					else
+					{
+						instance = finalize_ast(instance, NULL, module_sc_hierarchy, true, true);
+						if (can_memoize && instance_is_self_contained(instance))
+						{
+							finalized_instance_cache[signature] = {instance, instance->types.hierarchy};
+							memoized_instances.insert(instance);
+						}
+					}
 
 					/* clean up */
 					vtr::free(temp_instance_name);
@@ -2161,9 +2284,28 @@ ast_node_t *reduce_expressions(ast_node_t *node, sc_hierarchy *local_ref, long *
 					oassert(sc_spot != -1);
 					ast_node_t *instance = (ast_node_t *)module_names_to_idx->data[sc_spot];
 
-					/* elaboration */
+					/* elaboration; repeated (module, parameter binding) instances are
+						stamped from the first one's memoized result instead of re-reduced */
 					sc_hierarchy *module_sc_hierarchy = instance->types.hierarchy;
-					instance = reduce_expressions(instance, module_sc_hierarchy, NULL, 0);
+
+					std::string signature;
+					bool can_memoize = get_elaboration_signature(temp_instance, module_sc_hierarchy->local_param_table_sc, signature)
+						&& memoized_instances.find(instance) == memoized_instances.end();
+
+					auto memo = can_memoize ? reduced_instance_cache.find(signature) : reduced_instance_cache.end();
+					if (memo != reduced_instance_cache.end() && memo->second.instance != instance)
+					{
+						instance = stamp_memoized_instance(memo->second, instance, sc_spot, local_ref);
+					}
+					else
+					{
+						instance = reduce_expressions(instance, module_sc_hierarchy, NULL, 0);
+						if (can_memoize && instance_is_self_contained(instance))
+						{
+							reduced_instance_cache[signature] = {instance, instance->types.hierarchy};
+							memoized_instances.insert(instance);
+						}
+					}
 
 					/* clean up */
 					vtr::free(temp_instance_name);
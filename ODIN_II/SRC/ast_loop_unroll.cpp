@@ -429,48 +429,37 @@ post_condition_function resolve_post_condition(ast_node_t* assignment, ast_node_
 	return resolve_binary_operation(node);
 }
 
+/* Copy the loop body for one iteration in a single pass, substituting the
+ * current value of the loop variable as we go. Copying and substituting
+ * together avoids the deep-copy-then-recopy of the previous implementation,
+ * which re-cloned every subtree once per level of nesting. */
 ast_node_t* dup_and_fill_body(ast_node_t* body, ast_node_t* pre, ast_node_t** value, int* error_code)
 {
-	ast_node_t* copy = ast_node_deep_copy(body);
-	for(long i = 0; i<copy->num_children; i++)
+	if(body == NULL)
+		return NULL;
+
+	/* replace references to the iteration symbol with its current value */
+	if(body->type == IDENTIFIERS && !strcmp(body->types.identifier, pre->children[0]->types.identifier))
 	{
-		ast_node_t* child = copy->children[i];
-		if (child) 
-		{
-			bool is_unrolled = false;
+		return ast_node_copy(*value);
+	}
 
-			if(child->type == IDENTIFIERS)
-			{
-				if(!strcmp(child->types.identifier, pre->children[0]->types.identifier))
-				{
-					ast_node_t* new_num = ast_node_copy(*value);
-					child = free_whole_tree(child);
-					copy->children[i] = new_num;
-				}
-			} 
-			else if(child->type == MODULE_INSTANCE && child->children[0]->type != MODULE_INSTANCE)
-			{
-				/* find and replace iteration symbol for port connections and parameters */
-				ast_node_t *named_instance = child->children[1];
-				copy->children[i]->children[1] = dup_and_fill_body(named_instance, pre, value, error_code);
-				free_whole_tree(named_instance);
+	ast_node_t* copy = ast_node_copy(body);
+	copy->children = (ast_node_t**)vtr::calloc(body->num_children, sizeof(ast_node_t*));
 
-				is_unrolled = true;
-			} 
+	/* for module instances only the port connections and parameters (children[1])
+	 * carry iteration symbols; the module reference name must not be substituted */
+	bool is_instance = (body->type == MODULE_INSTANCE && body->children[0]->type != MODULE_INSTANCE);
 
-			if(child && child->num_children > 0)
-			{
-				if (!is_unrolled)
-				{
-					for (int j = 0; j < copy->children[i]->num_children; j++)
-					{
-						if (copy->children[i]->children[j] != child->children[j]) free_whole_tree(copy->children[i]->children[j]);
-					}
-					
-					copy->children[i] = dup_and_fill_body(child, pre, value, error_code);
-					free_whole_tree(child);
-				}
-			}
+	for(long i = 0; i < body->num_children; i++)
+	{
+		if (is_instance && i == 0)
+		{
+			copy->children[i] = ast_node_deep_copy(body->children[i]);
+		}
+		else
+		{
+			copy->children[i] = dup_and_fill_body(body->children[i], pre, value, error_code);
 		}
 	}
 	return copy;
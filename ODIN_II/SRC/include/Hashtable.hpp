@@ -25,15 +25,34 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include <stdlib.h>
 #include <stdint.h>
-#include <unordered_map>
+#include <string>
+#include <vector>
 
+// Open-addressing hash table with linear probing. Slots are stored flat in
+// one vector so probing walks contiguous memory rather than chasing the
+// per-node allocations of std::unordered_map.
 class Hashtable
 {
 private:
-	std::unordered_map<std::string,void*> my_map;
-	
+	struct slot_t
+	{
+		size_t hash = 0;  // 0 marks an empty slot; stored hashes are forced non-zero
+		std::string key;
+		void *item = NULL;
+	};
+
+	std::vector<slot_t> slots;
+	size_t count = 0;
+
+	static size_t hash_key   (const std::string& key);
+	// Returns the slot holding key, or the empty slot where it would go.
+	size_t        probe      (size_t hash, const std::string& key) const;
+	void          grow       ();
+
 public:
 
+	Hashtable();
+
 	// Adds an item to the hashtable.
 	void   add                (std::string key, void *item);
 	// Removes an item from the hashtable. If the item is not present, a null pointer is returned.
@@ -66,7 +66,6 @@ void iterate_adders(netlist_t *netlist);
 void clean_adders();
 void reduce_operations(netlist_t *netlist, operation_list op);
 void traverse_list(operation_list oper, vtr::t_linked_vptr *place);
-void match_node(vtr::t_linked_vptr *place, operation_list oper);
 int match_ports(nnode_t *node, nnode_t *next_node, operation_list oper);
 void traverse_operation_node(ast_node_t *node, char *component[], operation_list op, int *mark);
 void merge_nodes(nnode_t *node, nnode_t *next_node);
@@ -17,6 +17,7 @@ npin_t* copy_input_npin(npin_t* copy_pin);
 npin_t* copy_output_npin(npin_t* copy_pin);
 nnet_t* allocate_nnet();
 nnode_t* free_nnode(nnode_t *to_free);
+nnode_t* recycle_nnode(nnode_t *to_free);
 npin_t* free_npin(npin_t *to_free);
 nnet_t* free_nnet(nnet_t* to_free);
 
@@ -22,15 +22,13 @@
 
 
 struct STRING_CACHE{
-	long size;
-	long string_hash_size;
-	long free;
-	long mod;
-	long mul;
+	long size;           /* allocated length of string/data/string_hash */
+	long index_size;     /* capacity of the open-addressing index (power of two) */
+	long free;           /* number of strings interned so far */
 	char **string;
 	void **data;
-	long *string_hash;
-	long *next_string;
+	long *index;         /* open-addressing slots holding string ids, -1 when empty */
+	long *string_hash;   /* cached hash of each interned string */
 };
 
 /* creates the hash where it is indexed by a string and the void ** holds the data */
@@ -23,6 +23,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include <string.h>
 #include <math.h>
+#include <algorithm>
 #include "odin_globals.h"
 #include "odin_types.h"
 #include "odin_util.h"
@@ -722,11 +723,24 @@ void split_sp_memory_width(nnode_t *node, int target_size)
 			new_node->traverse_visited = node->traverse_visited;
 			new_node->node_data = NULL;
 
+			// This memory's share of the data port is known up front, so the
+			// final port sizes and pin counts can be computed and the pin
+			// arrays allocated in one batch, instead of being grown (and
+			// reallocated) one pin at a time while wiring.
+			int this_data_size = std::min(target_size, data_port_size - i * target_size);
+
 			int j;
+			int total_input_pins = 0;
 			for (j = 0; j < node->num_input_port_sizes; j++)
-				add_input_port_information(new_node, 0);
+			{
+				int port_size = (j == data_port_number) ? this_data_size : node->input_port_sizes[j];
+				add_input_port_information(new_node, port_size);
+				total_input_pins += port_size;
+			}
+			allocate_more_input_pins(new_node, total_input_pins);
 
-			add_output_port_information(new_node, 0);
+			add_output_port_information(new_node, this_data_size);
+			allocate_more_output_pins(new_node, this_data_size);
 
 			int index = 0;
 			int old_index = 0;
@@ -738,10 +752,8 @@ void split_sp_memory_width(nnode_t *node, int target_size)
 					// Skip over data pins we've already moved.
 					old_index += data_pins_moved;
 					int k;
-					for (k = 0; k < target_size && data_pins_moved < data_port_size; k++)
+					for (k = 0; k < this_data_size; k++)
 					{
-						allocate_more_input_pins(new_node, 1);
-						new_node->input_port_sizes[j]++;
 						remap_pin_to_new_node(node->input_pins[old_index], new_node, index);
 						index++;
 						old_index++;
@@ -756,8 +768,6 @@ void split_sp_memory_width(nnode_t *node, int target_size)
 					int k;
 					for (k = 0; k < node->input_port_sizes[j]; k++)
 					{
-						allocate_more_input_pins(new_node, 1);
-						new_node->input_port_sizes[j]++;
 						// Copy pins for all but the last memory. the last one get the original pins moved to it.
 						if (i < num_memories - 1)
 							add_input_pin_to_node(new_node, copy_input_npin(node->input_pins[old_index]), index);
@@ -774,10 +784,8 @@ void split_sp_memory_width(nnode_t *node, int target_size)
 			old_index += output_pins_moved;
 
 			int k;
-			for (k = 0; k < target_size && output_pins_moved < data_port_size; k++)
+			for (k = 0; k < this_data_size; k++)
 			{
-				allocate_more_output_pins(new_node, 1);
-				new_node->output_port_sizes[0]++;
 				remap_pin_to_new_node(node->output_pins[old_index], new_node, index);
 				index++;
 				old_index++;
@@ -847,9 +855,30 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 			new_node->traverse_visited = node->traverse_visited;
 			new_node->node_data = NULL;
 
+			// Both data ports (and both output ports) take the same share of
+			// pins, so the final port sizes and pin counts are known up
+			// front: allocate the pin arrays in one batch instead of growing
+			// (and reallocating) them one pin at a time while wiring.
+			int this_data_size = std::min(target_size, data1_port_size - i * target_size);
+
 			int j;
+			int total_input_pins = 0;
 			for (j = 0; j < node->num_input_port_sizes; j++)
-				add_input_port_information(new_node, 0);
+			{
+				int port_size = (j == data1_port_number || j == data2_port_number)
+									? this_data_size
+									: node->input_port_sizes[j];
+				add_input_port_information(new_node, port_size);
+				total_input_pins += port_size;
+			}
+			allocate_more_input_pins(new_node, total_input_pins);
+
+			for (j = 0; j < node->num_output_port_sizes; j++)
+			{
+				oassert(j == out1_port_number || j == out2_port_number);
+				add_output_port_information(new_node, this_data_size);
+			}
+			allocate_more_output_pins(new_node, this_data_size * node->num_output_port_sizes);
 
 			int index = 0;
 			int old_index = 0;
@@ -861,10 +890,8 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 					// Skip over data pins we've already moved.
 					old_index += data1_pins_moved;
 					int k;
-					for (k = 0; k < target_size && data1_pins_moved < data1_port_size; k++)
+					for (k = 0; k < this_data_size; k++)
 					{
-						allocate_more_input_pins(new_node, 1);
-						new_node->input_port_sizes[j]++;
 						remap_pin_to_new_node(node->input_pins[old_index], new_node, index);
 						index++;
 						old_index++;
@@ -879,10 +906,8 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 					// Skip over data pins we've already moved.
 					old_index += data2_pins_moved;
 					int k;
-					for (k = 0; k < target_size && data2_pins_moved < data2_port_size; k++)
+					for (k = 0; k < this_data_size; k++)
 					{
-						allocate_more_input_pins(new_node, 1);
-						new_node->input_port_sizes[j]++;
 						remap_pin_to_new_node(node->input_pins[old_index], new_node, index);
 						index++;
 						old_index++;
@@ -897,8 +922,6 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 					int k;
 					for (k = 0; k < node->input_port_sizes[j]; k++)
 					{
-						allocate_more_input_pins(new_node, 1);
-						new_node->input_port_sizes[j]++;
 						// Copy pins for all but the last memory. the last one get the original pins moved to it.
 						if (i < num_memories - 1)
 							add_input_pin_to_node(new_node, copy_input_npin(node->input_pins[old_index]), index);
@@ -910,9 +933,6 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 				}
 			}
 
-			for (j = 0; j < node->num_output_port_sizes; j++)
-				add_output_port_information(new_node, 0);
-
 			index = 0;
 			old_index = 0;
 			for (j = 0; j < node->num_output_port_sizes; j++)
@@ -923,10 +943,8 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 					// Skip over data pins we've already moved.
 					old_index += out1_pins_moved;
 					int k;
-					for (k = 0; k < target_size && out1_pins_moved < out1_port_size; k++)
+					for (k = 0; k < this_data_size; k++)
 					{
-						allocate_more_output_pins(new_node, 1);
-						new_node->output_port_sizes[j]++;
 						remap_pin_to_new_node(node->output_pins[old_index], new_node, index);
 						index++;
 						old_index++;
@@ -941,10 +959,8 @@ void split_dp_memory_width(nnode_t *node, int target_size)
 					// Skip over data pins we've already moved.
 					old_index += out2_pins_moved;
 					int k;
-					for (k = 0; k < target_size && out2_pins_moved < out2_port_size; k++)
+					for (k = 0; k < this_data_size; k++)
 					{
-						allocate_more_output_pins(new_node, 1);
-						new_node->output_port_sizes[j]++;
 						remap_pin_to_new_node(node->output_pins[old_index], new_node, index);
 						index++;
 						old_index++;
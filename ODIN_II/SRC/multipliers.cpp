@@ -840,7 +840,7 @@ void split_multiplier(nnode_t *node, int a0, int b0, int a1, int b1, netlist_t *
 	/* Free arrays NOT the pins since relocated! */
 	vtr::free(node->input_pins);
 	vtr::free(node->output_pins);
-	vtr::free(node);
+	recycle_nnode(node);
 
 	return;
 }
@@ -915,7 +915,7 @@ void split_multiplier_a(nnode_t *node, int a0, int a1, int b)
 	/* Free arrays NOT the pins since relocated! */
 	vtr::free(node->input_pins);
 	vtr::free(node->output_pins);
-	vtr::free(node);
+	recycle_nnode(node);
 	return;
 }
 
@@ -991,7 +991,7 @@ void split_multiplier_b(nnode_t *node, int a, int b1, int b0)
 	/* Free arrays NOT the pins since relocated! */
 	vtr::free(node->input_pins);
 	vtr::free(node->output_pins);
-	vtr::free(node);
+	recycle_nnode(node);
 	return;
 }
 
@@ -1416,7 +1416,7 @@ void split_soft_multiplier(nnode_t *node, netlist_t *netlist) {
 	// Free arrays NOT the pins since relocated!
 	vtr::free(node->input_pins);
 	vtr::free(node->output_pins);
-	vtr::free(node);
+	recycle_nnode(node);
 }
 
 bool is_ast_multiplier(ast_node_t *node)
@@ -23,6 +23,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <vector>
 #include "odin_types.h"
 #include "odin_globals.h"
 
@@ -39,102 +40,108 @@ int _visited_forward, _visited_backward, _visited_removal;
 #define VISITED_REMOVAL ((void*)&_visited_removal)
 
 
-/* Simple linked list of nodes structure */
-struct node_list_t{
-	nnode_t *node;
-	struct node_list_t *next;
-};
-
-node_list_t useless_nodes; // List of the nodes to be removed
-node_list_t *removal_list_next = &useless_nodes; // Tail of the nodes to be removed
-
-node_list_t addsub_nodes; // List of the adder/subtractor nodes
-node_list_t *addsub_list_next = &addsub_nodes; // Tail of the adder/subtractor node list
+std::vector<nnode_t *> useless_nodes; // Nodes to be removed
+std::vector<nnode_t *> addsub_nodes; // Heads of adder/subtractor chains
 
 
 /* Function declarations */
-node_list_t* insert_node_list(node_list_t* node_list, nnode_t *node);
 void traverse_backward(nnode_t *node);
-void traverse_forward(nnode_t *node, int toplevel, int remove_me);
+void traverse_forward(nnode_t *node, int toplevel);
 void mark_output_dependencies(netlist_t *netlist);
 void identify_unused_nodes(netlist_t *netlist);
-void remove_unused_nodes(node_list_t *remove);
-void calculate_addsub_statistics(node_list_t *addsub);
+void remove_unused_nodes(std::vector<nnode_t *>& remove);
+void calculate_addsub_statistics(std::vector<nnode_t *>& addsub);
 void remove_unused_logic(netlist_t *netlist);
 
 
 
 
-node_list_t* insert_node_list(node_list_t* node_list, nnode_t *node){
-	node_list->node = node;
-	node_list->next = (node_list_t*)vtr::calloc(1, sizeof(node_list_t));
-	return node_list->next;
-}
-
-/* Traverse the netlist backwards, moving from outputs to inputs */
+/* Traverse the netlist backwards from an output, marking every node that can
+ * reach it. A worklist is used rather than recursion so deep combinational
+ * chains cannot overflow the stack. */
 void traverse_backward(nnode_t *node){
 	if(node->node_data == VISITED_BACKWARD) return; // Already visited
+	std::vector<nnode_t *> worklist;
 	node->node_data = VISITED_BACKWARD; // Mark as visited
-	int i;
-	for(i = 0; i < node->num_input_pins; i++){
-		if(node->input_pins[i]->net->driver_pin){ // ensure this net has a driver (i.e. skip undriven outputs)
-			traverse_backward(node->input_pins[i]->net->driver_pin->node); // Visit the drivers of this node
+	worklist.push_back(node);
+	while(!worklist.empty()){
+		nnode_t *current = worklist.back();
+		worklist.pop_back();
+		int i;
+		for(i = 0; i < current->num_input_pins; i++){
+			if(current->input_pins[i]->net->driver_pin){ // ensure this net has a driver (i.e. skip undriven outputs)
+				nnode_t *driver = current->input_pins[i]->net->driver_pin->node;
+				if(driver->node_data != VISITED_BACKWARD){
+					driver->node_data = VISITED_BACKWARD;
+					worklist.push_back(driver);
+				}
+			}
 		}
 	}
 }
 
-/* Traverse the netlist forward, moving from inputs to outputs.
- * Adds nodes that do not affect any outputs to the useless_nodes list
- * Arguments:
- * 	node: the current node in the netlist
- * 	toplevel: are we at one of the top-level nodes? (GND, VCC, PAD or INPUT)
- * 	remove_me: should the current node be removed?
- * */
-void traverse_forward(nnode_t *node, int toplevel, int remove_me){
+/* Traverse the netlist forward from a top-level node (GND, VCC, PAD or INPUT),
+ * moving from inputs to outputs via a worklist. Any node reached that was not
+ * marked on the backwards sweep cannot affect an output and is added to the
+ * useless_nodes list; once a node is condemned everything downstream of it is
+ * condemned too (its fanout is only driven through removed logic). */
+void traverse_forward(nnode_t *node, int toplevel){
 	if(node == NULL) return; // Shouldn't happen, but check just in case
-	if(node->node_data == VISITED_FORWARD) return; // Already visited, shouldn't happen anyway
+	if(node->node_data == VISITED_FORWARD) return; // Already visited
 
-	/* We want to remove this node if either its parent was removed,
-	 * or if it was not visited on the backwards sweep */
-	remove_me = remove_me || ((node->node_data != VISITED_BACKWARD) && (toplevel == false));
+	// Worklist entries pair each node with whether its driver was removed
+	std::vector<std::pair<nnode_t *, int>> worklist;
+	worklist.emplace_back(node, false);
 
-	/* Mark this node as visited */
-	node->node_data = VISITED_FORWARD;
+	while(!worklist.empty()){
+		nnode_t *current = worklist.back().first;
+		int remove_me = worklist.back().second;
+		worklist.pop_back();
 
-	if(remove_me) {
-		/* Add this node to the list of nodes to remove */
-		removal_list_next = insert_node_list(removal_list_next, node);
-	}
+		if(current->node_data == VISITED_FORWARD) continue; // Reached through another parent first
 
-	if(node->type == ADD || node->type == MINUS){
-        // check if adders/subtractors are starting using a global gnd/vcc node or a pad node
-        auto ADDER_START_NODE = PAD_NODE;
-        if (configuration.adder_cin_global) {
-            if (node->type == ADD) ADDER_START_NODE = GND_NODE;
-            else ADDER_START_NODE = VCC_NODE;
-        }
-		/* Check if we've found the head of an adder or subtractor chain */
-		if(node->input_pins[node->num_input_pins-1]->net->driver_pin->node->type == ADDER_START_NODE) {
-			addsub_list_next = insert_node_list(addsub_list_next, node);
+		/* We want to remove this node if either its parent was removed,
+		 * or if it was not visited on the backwards sweep */
+		remove_me = remove_me || ((current->node_data != VISITED_BACKWARD) && (toplevel == false));
+
+		/* Mark this node as visited */
+		current->node_data = VISITED_FORWARD;
+
+		if(remove_me) {
+			/* Add this node to the list of nodes to remove */
+			useless_nodes.push_back(current);
 		}
-	}
 
-	/* Iterate through every fanout node */
-	int i, j;
-	for(i = 0; i < node->num_output_pins; i++){
-		if(node->output_pins[i] && node->output_pins[i]->net){
-			for(j = 0; j < node->output_pins[i]->net->num_fanout_pins; j++){
-				if(node->output_pins[i]->net->fanout_pins[j]){
-					nnode_t *child = node->output_pins[i]->net->fanout_pins[j]->node;
-					if(child){
-						/* If this child hasn't already been visited, visit it now */
-						if(child->node_data != VISITED_FORWARD){
-							traverse_forward(child, false, remove_me);
+		if(current->type == ADD || current->type == MINUS){
+	        // check if adders/subtractors are starting using a global gnd/vcc node or a pad node
+	        auto ADDER_START_NODE = PAD_NODE;
+	        if (configuration.adder_cin_global) {
+	            if (current->type == ADD) ADDER_START_NODE = GND_NODE;
+	            else ADDER_START_NODE = VCC_NODE;
+	        }
+			/* Check if we've found the head of an adder or subtractor chain */
+			if(current->input_pins[current->num_input_pins-1]->net->driver_pin->node->type == ADDER_START_NODE) {
+				addsub_nodes.push_back(current);
+			}
+		}
+
+		/* Iterate through every fanout node */
+		int i, j;
+		for(i = 0; i < current->num_output_pins; i++){
+			if(current->output_pins[i] && current->output_pins[i]->net){
+				for(j = 0; j < current->output_pins[i]->net->num_fanout_pins; j++){
+					if(current->output_pins[i]->net->fanout_pins[j]){
+						nnode_t *child = current->output_pins[i]->net->fanout_pins[j]->node;
+						if(child && child->node_data != VISITED_FORWARD){
+							worklist.emplace_back(child, remove_me);
 						}
 					}
 				}
 			}
 		}
+
+		/* Only the seed node is top level */
+		toplevel = false;
 	}
 }
 
@@ -152,32 +159,28 @@ void mark_output_dependencies(netlist_t *netlist){
 (VCC, GND, PAD) */
 void identify_unused_nodes(netlist_t *netlist){
 
-	useless_nodes.node = NULL;
-	useless_nodes.next = NULL;
+	useless_nodes.clear();
+	addsub_nodes.clear();
 
-	addsub_nodes.node = NULL;
-	addsub_nodes.next = NULL;
-
-	traverse_forward(netlist->gnd_node, true, false);
-	traverse_forward(netlist->vcc_node, true, false);
-	traverse_forward(netlist->pad_node, true, false);
+	traverse_forward(netlist->gnd_node, true);
+	traverse_forward(netlist->vcc_node, true);
+	traverse_forward(netlist->pad_node, true);
 	int i;
 	for(i = 0; i < netlist->num_top_input_nodes; i++){
-		traverse_forward(netlist->top_input_nodes[i], true, false);
+		traverse_forward(netlist->top_input_nodes[i], true);
 	}
 }
 
 /* Note: This does not actually free the unused logic, but simply detaches
 it from the rest of the circuit */
-void remove_unused_nodes(node_list_t *remove){
-	while(remove != NULL && remove->node != NULL){
+void remove_unused_nodes(std::vector<nnode_t *>& remove){
+	for(nnode_t *node: remove){
 		int i;
-		for(i = 0; i < remove->node->num_input_pins; i++){
-			npin_t *input_pin = remove->node->input_pins[i];
+		for(i = 0; i < node->num_input_pins; i++){
+			npin_t *input_pin = node->input_pins[i];
 			input_pin->net->fanout_pins[input_pin->pin_net_idx] = NULL; // Remove the fanout pin from the net
 		}
-		remove->node->node_data = VISITED_REMOVAL;
-		remove = remove->next;
+		node->node_data = VISITED_REMOVAL;
 	}
 }
 
@@ -196,10 +199,10 @@ double geomean_addsub_length = 0.0; // Geometric mean of add/sub chain length
 double sum_of_addsub_logs = 0.0; // Sum of the logarithms of the add/sub chain lengths; used for geomean
 double total_addsub_chain_count = 0.0;
 
-void calculate_addsub_statistics(node_list_t *addsub){
-	while(addsub != NULL && addsub->node != NULL){
+void calculate_addsub_statistics(std::vector<nnode_t *>& addsub){
+	for(nnode_t *head: addsub){
 		int found_tail = false;
-		nnode_t *node = addsub->node;
+		nnode_t *node = head;
 		int chain_depth = 0;
 		while(!found_tail){
 			if(node->node_data == VISITED_REMOVAL){
@@ -228,8 +231,6 @@ void calculate_addsub_statistics(node_list_t *addsub){
 			sum_of_addsub_logs += log(chain_depth);
 			total_addsub_chain_count += 1.0;
 		}
-
-		addsub = addsub->next;
 	}
 	/* Calculate the geometric mean carry chain length */
 	geomean_addsub_length = exp(sum_of_addsub_logs / total_addsub_chain_count);
@@ -239,6 +240,6 @@ void calculate_addsub_statistics(node_list_t *addsub){
 void remove_unused_logic(netlist_t *netlist){
 	mark_output_dependencies(netlist);
 	identify_unused_nodes(netlist);
-	remove_unused_nodes(&useless_nodes);
-	calculate_addsub_statistics(&addsub_nodes);
+	remove_unused_nodes(useless_nodes);
+	calculate_addsub_statistics(addsub_nodes);
 }
@@ -36,11 +36,85 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 extern global_args_t global_args;
 
+/*---------------------------------------------------------------------------------------------
+ * Type-segregated arenas for the core netlist structures (nnode_t/npin_t/nnet_t).
+ *
+ * Big designs allocate and free these by the million during elaboration and netlist cleanup;
+ * individual mallocs dominated allocator time and scattered the structures across the heap.
+ * Each type gets its own arena of fixed-size blocks: allocation pops a free list (threaded
+ * through the unique_id word of freed objects) or bumps into the newest block, freeing pushes
+ * back onto the free list, and the blocks themselves are released wholesale when the netlist
+ * is torn down. Same-type objects allocated together also land adjacent in memory, which the
+ * traversal passes (e.g. partial mapping) benefit from.
+ *-------------------------------------------------------------------------------------------*/
+#define ARENA_BLOCK_OBJECTS 4096
+
+struct netlist_arena_t
+{
+	std::vector<void *> blocks;
+	void *free_list;      // threaded through the first word (unique_id) of freed objects
+	size_t next_in_block; // objects used in the newest block
+};
+
+static netlist_arena_t nnode_arena = {{}, NULL, ARENA_BLOCK_OBJECTS};
+static netlist_arena_t npin_arena = {{}, NULL, ARENA_BLOCK_OBJECTS};
+static netlist_arena_t nnet_arena = {{}, NULL, ARENA_BLOCK_OBJECTS};
+
+static void *arena_allocate(netlist_arena_t *arena, size_t object_size)
+{
+	static long unique_id = 0;
+
+	void *object;
+	if (arena->free_list)
+	{
+		object = arena->free_list;
+		arena->free_list = *((void **)object);
+	}
+	else
+	{
+		if (arena->next_in_block == ARENA_BLOCK_OBJECTS)
+		{
+			arena->blocks.push_back(vtr::malloc(object_size * ARENA_BLOCK_OBJECTS));
+			arena->next_in_block = 0;
+		}
+		object = (char *)arena->blocks.back() + arena->next_in_block * object_size;
+		arena->next_in_block++;
+	}
+
+	memset(object, 0, object_size);
+	/* mark the unique_id (first member of all arena-allocated structures) */
+	*((long *)object) = unique_id++;
+
+	return object;
+}
+
+static void arena_free(netlist_arena_t *arena, void *object)
+{
+	*((void **)object) = arena->free_list;
+	arena->free_list = object;
+}
+
+/* releases all arena blocks at once; only valid once the netlist is no longer in use */
+static void free_netlist_arenas()
+{
+	netlist_arena_t *arenas[] = {&nnode_arena, &npin_arena, &nnet_arena};
+	for (netlist_arena_t *arena : arenas)
+	{
+		for (void *block : arena->blocks)
+		{
+			vtr::free(block);
+		}
+		arena->blocks.clear();
+		arena->free_list = NULL;
+		arena->next_in_block = ARENA_BLOCK_OBJECTS;
+	}
+}
+
 /*---------------------------------------------------------------------------------------------
  * (function: allocate_nnode)
  *-------------------------------------------------------------------------------------------*/
 nnode_t* allocate_nnode() {
-	nnode_t *new_node = (nnode_t *)my_malloc_struct(sizeof(nnode_t));
+	nnode_t *new_node = (nnode_t *)arena_allocate(&nnode_arena, sizeof(nnode_t));
 
 	new_node->name = NULL;
 	new_node->type = NO_OP;
@@ -101,21 +175,13 @@ nnode_t *free_nnode(nnode_t *to_free)
 		/* need to free node_data */
 
 		for (int i = 0; i < to_free->num_input_pins; i++) {
-			if (to_free->input_pins[i] && to_free->input_pins[i]->name) {
-				vtr::free(to_free->input_pins[i]->name);
-				to_free->input_pins[i]->name = NULL;
-			}
-			to_free->input_pins[i] = (npin_t*)vtr::free(to_free->input_pins[i]);
+			to_free->input_pins[i] = free_npin(to_free->input_pins[i]);
 		}
 
 		to_free->input_pins = (npin_t**)vtr::free(to_free->input_pins);
 
 		for (int i = 0; i < to_free->num_output_pins; i++) {
-			if (to_free->output_pins[i] && to_free->output_pins[i]->name) {
-				vtr::free(to_free->output_pins[i]->name);
-				to_free->output_pins[i]->name = NULL;
-			}
-			to_free->output_pins[i] = (npin_t*)vtr::free(to_free->output_pins[i]);
+			to_free->output_pins[i] = free_npin(to_free->output_pins[i]);
 		}
 
 		to_free->output_pins = (npin_t**)vtr::free(to_free->output_pins);
@@ -129,9 +195,24 @@ nnode_t *free_nnode(nnode_t *to_free)
 			to_free->name = NULL;
 		}
 
-		/* now free the node */
+		/* now recycle the node */
+		arena_free(&nnode_arena, to_free);
 	}
-	return (nnode_t*)vtr::free(to_free);
+	return NULL;
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: recycle_nnode)
+ * 	Returns just the node structure to its arena, for callers that have relocated the
+ * 	node's pins elsewhere and freed its member arrays themselves; use free_nnode otherwise.
+ *-------------------------------------------------------------------------------------------*/
+nnode_t *recycle_nnode(nnode_t *to_free)
+{
+	if (to_free)
+	{
+		arena_free(&nnode_arena, to_free);
+	}
+	return NULL;
 }
 
 /*-------------------------------------------------------------------------
@@ -204,7 +285,7 @@ void add_input_port_information(nnode_t *node, int port_width)
 npin_t* allocate_npin() {
 	npin_t *new_pin;
 
-	new_pin = (npin_t *)my_malloc_struct(sizeof(npin_t));
+	new_pin = (npin_t *)arena_allocate(&npin_arena, sizeof(npin_t));
 
 	new_pin->name = NULL;
 	new_pin->type = NO_ID;
@@ -234,9 +315,13 @@ npin_t* free_npin(npin_t* to_free) {
 
 		to_free->name = NULL;
 
-		/* now free the pin */
+		/* release the simulation buffer before the pin's memory is recycled */
+		to_free->values = nullptr;
+
+		/* now recycle the pin */
+		arena_free(&npin_arena, to_free);
 	}
-	return (npin_t*)vtr::free(to_free);
+	return NULL;
 }
 
 /*-------------------------------------------------------------------------
@@ -290,7 +375,7 @@ npin_t* copy_input_npin(npin_t* copy_pin)
  *-------------------------------------------------------------------------------------------*/
 nnet_t* allocate_nnet()
 {
-	nnet_t *new_net = (nnet_t*)my_malloc_struct(sizeof(nnet_t));
+	nnet_t *new_net = (nnet_t*)arena_allocate(&nnet_arena, sizeof(nnet_t));
 
 	new_net->name = NULL;
 	new_net->driver_pin = NULL;
@@ -318,9 +403,13 @@ nnet_t* free_nnet(nnet_t* to_free) {
 		if (to_free->name)
 			vtr::free(to_free->name);
 
-		/* now free the net */
+		/* release the simulation buffer before the net's memory is recycled */
+		to_free->values = nullptr;
+
+		/* now recycle the net */
+		arena_free(&nnet_arena, to_free);
 	}
-	return (nnet_t*)vtr::free(to_free);
+	return NULL;
 }
 
 /*---------------------------------------------------------------------------
@@ -947,6 +1036,9 @@ void free_netlist(netlist_t *to_free)
 	sc_free_string_cache(to_free->nets_sc);
 	sc_free_string_cache(to_free->out_pins_sc);
 	sc_free_string_cache(to_free->nodes_sc);
+
+	/* all nodes/pins/nets live in the arenas; drop their blocks wholesale */
+	free_netlist_arenas();
 }
 
 /*---------------------------------------------------------------------------------------------
@@ -25,6 +25,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string>
+#include <vector>
 #include "odin_types.h"
 #include "odin_globals.h"
 
@@ -65,7 +67,7 @@ static void print_input_pin(FILE *out, nnode_t *node, long pin_idx)
 			"Net %s driving node %s is itself undriven.", 
 			net->name, node->name);
 
-		fprintf(out, " %s", "unconn");
+		fputs(" unconn", out);
 	}
 	else if (global_args.high_level_block.provenance() == argparse::Provenance::SPECIFIED
 	&& net->driver_pin->node->related_ast_node != NULL)
@@ -84,11 +86,13 @@ static void print_input_pin(FILE *out, nnode_t *node, long pin_idx)
 				(net->driver_pin->node->type == ADD) ||
 				(net->driver_pin->node->type == MINUS)))
 		{
-			fprintf(out, " %s", net->driver_pin->name);
+			fputc(' ', out);
+			fputs(net->driver_pin->name, out);
 		}
 		else
 		{
-			fprintf(out, " %s", net->driver_pin->node->name);
+			fputc(' ', out);
+			fputs(net->driver_pin->node->name, out);
 		}
 	}
 	
@@ -104,7 +108,10 @@ static void print_output_pin(FILE *out, nnode_t *node)
 			node->related_ast_node->far_tag, 
 			node->related_ast_node->high_number);
 	else
-		fprintf(out, " %s", node->name);
+	{
+		fputc(' ', out);
+		fputs(node->name, out);
+	}
 }
 
 static void print_input_pin_list(FILE *out, nnode_t *node)
@@ -117,12 +124,12 @@ static void print_input_pin_list(FILE *out, nnode_t *node)
 
 static void print_dot_names_header(FILE *out, nnode_t *node)
 {
-	fprintf(out, ".names");
+	fputs(".names", out);
 	print_input_pin_list(out, node);	
 	
 	oassert(node->num_output_pins == 1);
 	print_output_pin(out, node);
-	fprintf(out, "\n");
+	fputc('\n', out);
 
 }
 
@@ -152,6 +159,11 @@ void output_blif(const char *file_name, netlist_t *netlist)
 		error_message(NETLIST_ERROR, -1, -1, "Could not open output file %s\n", file_name);
 	}
 
+	/* stream through a large stdio buffer; the per-pin writes below would
+	 * otherwise flush the default-sized buffer constantly on big netlists */
+	std::vector<char> write_buffer(8 * 1024 * 1024);
+	setvbuf(out, write_buffer.data(), _IOFBF, write_buffer.size());
+
 	fprintf(out, ".model %s\n", top_module->children[0]->types.identifier);
 
 
@@ -412,42 +424,34 @@ void define_logical_function(nnode_t *node, FILE *out)
 		case LOGICAL_AND:
 		{
 			/* generates: 111111 1 */
-			for (i = 0; i < node->num_input_pins; i++)
-			{
-				fprintf(out, "1");
-			}
-			fprintf(out, " 1\n");
+			std::string row(node->num_input_pins, '1');
+			row += " 1\n";
+			fputs(row.c_str(), out);
 			break;
 		}
 		case LOGICAL_OR:
 		{
 			/* generates: 1----- 1\n-1----- 1\n ... */
+			std::string row(node->num_input_pins, '-');
+			row += " 1\n";
 			for (i = 0; i < node->num_input_pins; i++)
 			{
-				for (j = 0; j < node->num_input_pins; j++)
-				{
-					if (i == j)
-						fprintf(out, "1");
-					else
-						fprintf(out, "-");
-				}
-				fprintf(out, " 1\n");
+				row[i] = '1';
+				fputs(row.c_str(), out);
+				row[i] = '-';
 			}
 			break;
 		}
 		case LOGICAL_NAND:
 		{
 			/* generates: 0----- 1\n-0----- 1\n ... */
+			std::string row(node->num_input_pins, '-');
+			row += " 1\n";
 			for (i = 0; i < node->num_input_pins; i++)
 			{
-				for (j = 0; j < node->num_input_pins; j++)
-				{
-					if (i == j)
-						fprintf(out, "0");
-					else
-						fprintf(out, "-");
-				}
-				fprintf(out, " 1\n");
+				row[i] = '0';
+				fputs(row.c_str(), out);
+				row[i] = '-';
 			}
 			break;
 		}
@@ -455,11 +459,9 @@ void define_logical_function(nnode_t *node, FILE *out)
 		case LOGICAL_NOR:
 		{
 			/* generates: 0000000 1 */
-			for (i = 0; i < node->num_input_pins; i++)
-			{
-				fprintf(out, "0");
-			}
-			fprintf(out, " 1\n");
+			std::string row(node->num_input_pins, '0');
+			row += " 1\n";
+			fputs(row.c_str(), out);
 			break;
 		}
 		case LOGICAL_EQUAL:
@@ -472,9 +474,9 @@ void define_logical_function(nnode_t *node, FILE *out)
 				if ((i % 8 == 1) || (i % 8 == 2) || (i % 8 == 4) || (i % 8 == 7))
 				{
 					temp_string = convert_long_to_bit_string(i, node->num_input_pins);
-					fprintf(out, "%s", temp_string);
+					fputs(temp_string, out);
 					vtr::free(temp_string);
-					fprintf(out, " 1\n");
+					fputs(" 1\n", out);
 				}
 			}
 			break;
@@ -488,9 +490,9 @@ void define_logical_function(nnode_t *node, FILE *out)
 				if ((i % 8 == 0) || (i % 8 == 3) || (i % 8 == 5) || (i % 8 == 6))
 				{
 					temp_string = convert_long_to_bit_string(i, node->num_input_pins);
-					fprintf(out, "%s", temp_string);
+					fputs(temp_string, out);
 					vtr::free(temp_string);
-					fprintf(out, " 1\n");
+					fputs(" 1\n", out);
 				}
 			}
 			break;
@@ -516,9 +518,9 @@ void define_set_input_logical_function(nnode_t *node, const char *bit_output, FI
 	/* print out the blif definition of this gate */
 	if (bit_output != NULL)
 	{
-		fprintf(out, "%s", bit_output);
+		fputs(bit_output, out);
 	}
-	fprintf(out, "\n");
+	fputc('\n', out);
 }
 
 
@@ -576,20 +578,22 @@ void define_decoded_mux(nnode_t *node, FILE *out)
 
 
 	/* generates: 1----- 1\n-1----- 1\n ... */
+	std::string row(node->num_input_pins, '-');
+	row += " 1\n";
 	for (long i = 0; i < node->input_port_sizes[0]; i++)
 	{
 		for (long j = 0; j < node->num_input_pins; j++)
 		{
 			if (i == j)
-				fprintf(out, "1");
+				row[j] = '1';
 			else if (i+node->input_port_sizes[0] == j)
-				fprintf(out, "1");
+				row[j] = '1';
 			else if (i > node->input_port_sizes[0])
-				fprintf(out, "0");
+				row[j] = '0';
 			else
-				fprintf(out, "-");
+				row[j] = '-';
 		}
-		fprintf(out, " 1\n");
+		fputs(row.c_str(), out);
 	}
 
 	fprintf(out, "\n");
@@ -25,6 +25,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <stdlib.h>
 #include <stdarg.h>
 #include <algorithm>
+#include <vector>
 #include "odin_types.h"
 #include "odin_globals.h"
 
@@ -101,39 +102,64 @@ void depth_first_traversal_to_partial_map(short marker_value, netlist_t *netlist
  *-------------------------------------------------------------------------------------------*/
 void depth_first_traverse_partial_map(nnode_t *node, int traverse_mark_number, netlist_t *netlist)
 {
-	int i, j;
-
-	if (node->traverse_visited != traverse_mark_number)
+	/* Per-node traversal state so the post-order walk can run off an
+	 * explicit stack; deep arithmetic chains overflowed the call stack
+	 * when this was recursive. (i,j) index the output pin and fanout pin
+	 * to resume from, re-read live since mapping may rewrite fanout. */
+	struct frame_t
 	{
-		/*this is a new node so depth visit it */
+		nnode_t *node;
+		int i;
+		int j;
+	};
+
+	if (node->traverse_visited == traverse_mark_number)
+		return;
 
-		/* mark that we have visitied this node now */
-		node->traverse_visited = traverse_mark_number;
+	/* mark that we have visitied this node now */
+	node->traverse_visited = traverse_mark_number;
 
-		for (i = 0; i < node->num_output_pins; i++)
+	std::vector<frame_t> stack;
+	stack.push_back({node, 0, 0});
+
+	while (!stack.empty())
+	{
+		frame_t frame = stack.back();
+		nnode_t *current = frame.node;
+		nnode_t *descend = NULL;
+
+		/* find the next unvisited fanout node, if any */
+		while (frame.i < current->num_output_pins && !descend)
 		{
-			if (node->output_pins[i]->net)
+			nnet_t *next_net = current->output_pins[frame.i]->net;
+			if (!next_net || !next_net->fanout_pins || frame.j >= next_net->num_fanout_pins)
 			{
-				nnet_t *next_net = node->output_pins[i]->net;
-				if(next_net->fanout_pins)
-				{
-					for (j = 0; j < next_net->num_fanout_pins; j++)
-					{
-						if (next_net->fanout_pins[j])
-						{
-							if (next_net->fanout_pins[j]->node)
-							{
-							/* recursive call point */
-								depth_first_traverse_partial_map(next_net->fanout_pins[j]->node, traverse_mark_number, netlist);
-							}
-						}
-					}
-				}
+				frame.i++;
+				frame.j = 0;
+				continue;
 			}
+
+			npin_t *fanout_pin = next_net->fanout_pins[frame.j];
+			frame.j++;
+			if (fanout_pin && fanout_pin->node && fanout_pin->node->traverse_visited != traverse_mark_number)
+			{
+				fanout_pin->node->traverse_visited = traverse_mark_number;
+				descend = fanout_pin->node;
+			}
+		}
+
+		stack.back() = frame;
+		if (descend)
+		{
+			stack.push_back({descend, 0, 0});
 		}
+		else
+		{
+			stack.pop_back();
 
-		/* POST traverse  map the node since you might delete */
-		partial_map_node(node, traverse_mark_number, netlist);
+			/* POST traverse  map the node since you might delete */
+			partial_map_node(current, traverse_mark_number, netlist);
+		}
 	}
 }
 
@@ -33,9 +33,11 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include <sstream>
 #include <chrono>
 #include <dlfcn.h>
+#include <condition_variable>
 #include <mutex>
 #include <unistd.h>
 #include <thread>
+#include <vector>
 
 #define CLOCK_INITIAL_VALUE 1
 #define MAX_REPEAT_SIM 128
@@ -125,6 +127,8 @@ static inline bool is_clock_node(nnode_t *node)
 }
 
 static void simulate_cycle(int cycle, stages_t *s);
+static void start_worker_pool();
+static void stop_worker_pool();
 static stages_t *simulate_first_cycle(netlist_t *netlist, int cycle, lines_t *output_lines);
 
 static stages_t *stage_ordered_nodes(nnode_t **ordered_nodes, int num_ordered_nodes);
@@ -275,7 +279,9 @@ sim_data_t *init_simulation(netlist_t *netlist)
 	number_of_workers = global_args.parralelized_simulation.value();
 	if(number_of_workers >1 )
 		warning_message(SIMULATION_ERROR,-1,-1,"Executing simulation with maximum of %d threads", number_of_workers);
-	
+
+	start_worker_pool();
+
 	num_of_clock = 0;
 
 	sim_data_t *sim_data = (sim_data_t *)vtr::malloc(sizeof(sim_data_t));
@@ -379,6 +385,8 @@ sim_data_t *init_simulation(netlist_t *netlist)
 
 sim_data_t *terminate_simulation(sim_data_t *sim_data)
 {
+	stop_worker_pool();
+
 	free_stages(sim_data->stages);
 
 	fclose(sim_data->act_out);
@@ -551,41 +559,116 @@ static void compute_and_store_part(int start, int end, int current_stage, stages
 
 }
 
-static void simulate_cycle(int cycle, stages_t *s)
+/*
+ * Computes worker 'id's even share of the current stage's nodes.
+ */
+static void compute_and_store_thread_part(int id, int current_stage, stages_t *s, int cycle)
 {
-	double total_run_time = 0;
-	for(int i = 0; i < s->count; i++)
+	int nodes_per_thread = s->counts[current_stage]/number_of_workers;
+	int remainder = s->counts[current_stage]%number_of_workers;
+
+	int start = id*nodes_per_thread + std::min(id, remainder);
+	int end = start + nodes_per_thread + ((id < remainder)? 1: 0) - 1;
+
+	if (end >= start)
+		compute_and_store_part(start, end, current_stage, s, cycle);
+}
+
+/*
+ * Persistent pool of worker threads for parallel stage computation.
+ *
+ * Spawning threads per stage per cycle (the previous scheme) costs more
+ * than most stages take to compute; the pool is started once per
+ * simulation and handed one stage at a time, with the main thread
+ * computing its own share alongside the workers.
+ */
+static struct
+{
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable start_cv;
+	std::condition_variable done_cv;
+
+	// The stage being computed; generation increments to publish new work
+	stages_t *stages = NULL;
+	int stage = -1;
+	int cycle = -1;
+	long generation = 0;
+	int num_done = 0;
+	bool exiting = false;
+} worker_pool;
+
+static void worker_pool_main(int id)
+{
+	long last_generation = 0;
+	while (true)
 	{
-		double time = wall_time();
+		std::unique_lock<std::mutex> lock(worker_pool.mutex);
+		worker_pool.start_cv.wait(lock, [&] { return worker_pool.exiting || worker_pool.generation != last_generation; });
+		if (worker_pool.exiting)
+			return;
 
-		std::vector<std::thread> workers;
-		int previous_end = 0;
+		last_generation = worker_pool.generation;
+		stages_t *s = worker_pool.stages;
+		int stage = worker_pool.stage;
+		int cycle = worker_pool.cycle;
+		lock.unlock();
 
-		int nodes_per_thread = s->counts[i]/number_of_workers;
-		int remainder_nodes_per_thread = s->counts[i]%number_of_workers;
+		compute_and_store_thread_part(id, stage, s, cycle);
 
-		for (int id =0; id < number_of_workers; id++)
-		{
-			int start = previous_end;
-			int end = start + nodes_per_thread + ((remainder_nodes_per_thread > 0)? 1: 0);
+		lock.lock();
+		if (++worker_pool.num_done == (int)worker_pool.threads.size())
+			worker_pool.done_cv.notify_one();
+	}
+}
+
+static void start_worker_pool()
+{
+	// Worker 0 is the main thread
+	for (int id = 1; id < number_of_workers; id++)
+		worker_pool.threads.push_back(std::thread(worker_pool_main, id));
+}
 
-			remainder_nodes_per_thread -= 1;
-			previous_end = end + 1;
+static void stop_worker_pool()
+{
+	{
+		std::unique_lock<std::mutex> lock(worker_pool.mutex);
+		worker_pool.exiting = true;
+	}
+	worker_pool.start_cv.notify_all();
+	for (auto &worker: worker_pool.threads)
+		worker.join();
+	worker_pool.threads.clear();
+	worker_pool.exiting = false;
+}
 
-			if( (end-start) > 0 )
+static void simulate_cycle(int cycle, stages_t *s)
+{
+	for(int i = 0; i < s->count; i++)
+	{
+		if (!worker_pool.threads.empty())
+		{
+			// Publish the stage to the pool
 			{
-				if(id < number_of_workers-1) // if child threads
-					workers.push_back(std::thread(compute_and_store_part,start,end,i,s,cycle));
-				else
-					compute_and_store_part(start,end,i,s,cycle);
+				std::unique_lock<std::mutex> lock(worker_pool.mutex);
+				worker_pool.stages = s;
+				worker_pool.stage = i;
+				worker_pool.cycle = cycle;
+				worker_pool.num_done = 0;
+				worker_pool.generation++;
 			}
+			worker_pool.start_cv.notify_all();
 
-		}	
+			// Compute the main thread's share alongside the workers
+			compute_and_store_thread_part(0, i, s, cycle);
 
-		for (auto &worker: workers)	
-			worker.join();
-
-		total_run_time += wall_time()-time;
+			std::unique_lock<std::mutex> lock(worker_pool.mutex);
+			worker_pool.done_cv.wait(lock, [&] { return worker_pool.num_done == (int)worker_pool.threads.size(); });
+		}
+		else
+		{
+			compute_and_store_part(0, s->counts[i]-1, i, s, cycle);
+		}
 	}
 }
 
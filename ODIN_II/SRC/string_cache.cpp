@@ -7,46 +7,56 @@
 #include "string_cache.h"
 
 unsigned long
-string_hash(STRING_CACHE * sc,
-	    const char *string);
+string_hash(const char *string);
+void
+sc_index_insert(STRING_CACHE * sc,
+	    long id);
 void
 generate_sc_hash(STRING_CACHE * sc);
 
+/* FNV-1a; one multiply per character instead of the old per-character modulo */
 unsigned long
-string_hash(STRING_CACHE * sc,
-	    const char *string)
+string_hash(const char *string)
 {
-    long a, i, mod, mul;
+    unsigned long a = 14695981039346656037UL;
+    long i;
 
-    a = 0;
-    mod = sc->mod;
-    mul = sc->mul;
     for(i = 0; string[i]; i++)
-	a = (a * mul + (unsigned char)string[i]) % mod;
+	{
+	    a ^= (unsigned char)string[i];
+	    a *= 1099511628211UL;
+	}
     return a;
 }
 
+/* linear probe the open-addressing index for a free slot and store id there */
+void
+sc_index_insert(STRING_CACHE * sc,
+	    long id)
+{
+    long slot;
+
+    slot = (long)(sc->string_hash[id] & (unsigned long)(sc->index_size - 1));
+    while(sc->index[slot] >= 0)
+	slot = (slot + 1) & (sc->index_size - 1);
+    sc->index[slot] = id;
+}
+
 void
 generate_sc_hash(STRING_CACHE * sc)
 {
     long i;
-    long hash;
-
-    if(sc->string_hash != NULL)
-		vtr::free(sc->string_hash);
-    if(sc->next_string != NULL)
-		vtr::free(sc->next_string);
-    sc->string_hash_size = sc->size * 2 + 11;
-    sc->string_hash = (long *)sc_do_alloc(sc->string_hash_size, sizeof(long));
-    sc->next_string = (long *)sc_do_alloc(sc->size, sizeof(long));
-    memset(sc->string_hash, 0xff, sc->string_hash_size * sizeof(long));
-    memset(sc->next_string, 0xff, sc->size * sizeof(long));
+
+    if(sc->index != NULL)
+		vtr::free(sc->index);
+    /* keep the index at most half full so probe sequences stay short */
+    sc->index_size = 64;
+    while(sc->index_size < sc->size * 2)
+	sc->index_size *= 2;
+    sc->index = (long *)sc_do_alloc(sc->index_size, sizeof(long));
+    memset(sc->index, 0xff, sc->index_size * sizeof(long));
     for(i = 0; i < sc->free; i++)
-	{
-	    hash = string_hash(sc, sc->string[i]) % sc->string_hash_size;
-	    sc->next_string[i] = sc->string_hash[hash];
-	    sc->string_hash[hash] = i;
-	}
+	sc_index_insert(sc, i);
 }
 
 
@@ -57,14 +67,12 @@ sc_new_string_cache(void)
 
     sc = (STRING_CACHE *)sc_do_alloc(1, sizeof(STRING_CACHE));
     sc->size = 100;
-    sc->string_hash_size = 0;
-    sc->string_hash = NULL;
-    sc->next_string = NULL;
+    sc->index_size = 0;
+    sc->index = NULL;
     sc->free = 0;
     sc->string = (char **)sc_do_alloc(sc->size, sizeof(char *));
     sc->data = (void **)sc_do_alloc(sc->size, sizeof(void *));
-    sc->mod = 834535547;
-    sc->mul = 247999;
+    sc->string_hash = (long *)sc_do_alloc(sc->size, sizeof(long));
     generate_sc_hash(sc);
     return sc;
 }
@@ -73,19 +81,21 @@ long
 sc_lookup_string(STRING_CACHE * sc,
 	      const char *string)
 {
-    long i, hash;
+    long i, slot;
+    unsigned long hash;
 
     if(sc == NULL) {
         return -1;
     }
     else {
-    hash = string_hash(sc, string) % sc->string_hash_size;
-    i = sc->string_hash[hash];
-    while(i >= 0)
+    hash = string_hash(string);
+    slot = (long)(hash & (unsigned long)(sc->index_size - 1));
+    while((i = sc->index[slot]) >= 0)
 	{
-	    if(!strcmp(sc->string[i], string))
+	    if((unsigned long)sc->string_hash[i] == hash
+	       && !strcmp(sc->string[i], string))
 		return i;
-	    i = sc->next_string[i];
+	    slot = (slot + 1) & (sc->index_size - 1);
 	}
     return -1;
     }
@@ -95,28 +105,24 @@ bool
 sc_remove_string(STRING_CACHE * sc,
 	      const char *string)
 {
-    long i, hash;
+    long i;
 
     if(sc != NULL) {
-        hash = string_hash(sc, string) % sc->string_hash_size;
-        i = sc->string_hash[hash];
-        while(i >= 0)
+        i = sc_lookup_string(sc, string);
+        if(i >= 0)
         {
-            if(!strcmp(sc->string[i], string))
+            vtr::free(sc->string[i]);
+            if(sc->data[i] != NULL)
             {
-                vtr::free(sc->string[i]);
-                if(sc->data[i] != NULL)
-                {
-            	    vtr::free(sc->data[i]);
-                    sc->data = NULL;
-                }
-                sc->string[i] = vtr::strdup("REMOVED_NAME_FROM_SC_CACHE");
-                return true;
+        	    vtr::free(sc->data[i]);
+                sc->data = NULL;
             }
-            i = sc->next_string[i];
+            sc->string[i] = vtr::strdup("REMOVED_NAME_FROM_SC_CACHE");
+            sc->string_hash[i] = (long)string_hash(sc->string[i]);
+            return true;
         }
     }
-    
+
     return false;
 
 }
@@ -126,7 +132,6 @@ sc_add_string(STRING_CACHE * sc,
 	   const char *string)
 {
     long i;
-    long hash;
     void *a;
 
     i = sc_lookup_string(sc, string);
@@ -148,15 +153,21 @@ sc_add_string(STRING_CACHE * sc,
 	    vtr::free(sc->data);
 	    sc->data = (void **)a;
 
-	    generate_sc_hash(sc);
+	    a = sc_do_alloc(sc->size, sizeof(long));
+	    if(sc->free > 0)
+		memcpy(a, sc->string_hash, sc->free * sizeof(long));
+	    vtr::free(sc->string_hash);
+	    sc->string_hash = (long *)a;
 	}
     i = sc->free;
     sc->free++;
     sc->string[i] = vtr::strdup(string);
     sc->data[i] = NULL;
-    hash = string_hash(sc, string) % sc->string_hash_size;
-    sc->next_string[i] = sc->string_hash[hash];
-    sc->string_hash[hash] = i;
+    sc->string_hash[i] = (long)string_hash(string);
+    if(sc->free * 2 >= sc->index_size)
+	generate_sc_hash(sc);
+    else
+	sc_index_insert(sc, i);
     return i;
 }
 
@@ -216,17 +227,17 @@ STRING_CACHE * sc_free_string_cache(STRING_CACHE * sc)
         }
         sc->data = NULL;
 
-        if(sc->string_hash != NULL)
+        if(sc->index != NULL)
         {
-            vtr::free(sc->string_hash);
+            vtr::free(sc->index);
         }
-        sc->string_hash = NULL;
+        sc->index = NULL;
 
-        if(sc->next_string != NULL)
+        if(sc->string_hash != NULL)
         {
-            vtr::free(sc->next_string);
+            vtr::free(sc->string_hash);
         }
-        sc->next_string = NULL;
+        sc->string_hash = NULL;
 
         vtr::free(sc);
     }
@@ -661,7 +661,7 @@ void split_adder_for_sub(nnode_t *nodeo, int a, int b, int sizea, int sizeb, int
 	/* Free arrays NOT the pins since relocated! */
 	vtr::free(nodeo->input_pins);
 	vtr::free(nodeo->output_pins);
-	vtr::free(nodeo);
+	recycle_nnode(nodeo);
 	vtr::free(node);
 	vtr::free(not_node);
 	return;
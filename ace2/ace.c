@@ -27,7 +27,10 @@ void print_node_bdd(Abc_Ntk_t * ntk);
 void print_nodes(Vec_Ptr_t * nodes);
 int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name);
 
-st__table * ace_info_hash_table;
+/* Activity info for every network object, indexed by Abc_ObjId so the
+ * simulation inner loops stream through one contiguous array instead of
+ * doing a hash lookup per access */
+Ace_Obj_Info_t * ace_info_array;
 
 void print_status(Abc_Ntk_t * ntk) {
 	int i;
@@ -305,13 +308,7 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 }
 
 Ace_Obj_Info_t * Ace_ObjInfo(Abc_Obj_t * obj) {
-	Ace_Obj_Info_t * info;
-
-	if (st__lookup(ace_info_hash_table, (char *) obj, (char **) &info)) {
-		return info;
-	}
-	VTR_ASSERT(0);
-    return NULL;
+	return &ace_info_array[Abc_ObjId(obj)];
 }
 
 void prob_epsilon_fix(double * d) {
@@ -372,16 +369,8 @@ int main(int argc, char * argv[]) {
 
 	// Alloc Aux Info Array
 
-	// Full Allocation
-	Ace_Obj_Info_t * info = (Ace_Obj_Info_t*) calloc(Abc_NtkObjNum(ntk), sizeof(Ace_Obj_Info_t));
-	ace_info_hash_table = st__init_table(st__ptrcmp, st__ptrhash);
-
-	int objNum = 0;
-	Abc_NtkForEachObj(ntk, obj, i)
-	{
-		st__insert(ace_info_hash_table, (char *) obj, (char *) &info[objNum]);
-		objNum++;
-	}
+	// Full Allocation (object ids may have gaps, so size by the max id)
+	ace_info_array = (Ace_Obj_Info_t*) calloc(Abc_NtkObjNumMax(ntk), sizeof(Ace_Obj_Info_t));
 
 	// Check Depth
 	depth = ace_calc_network_depth(ntk);
@@ -125,7 +125,11 @@ int * getFaninValues(Abc_Obj_t * obj_ptr) {
 	Abc_Obj_t * fanin;
 	int i;
 	Ace_Obj_Info_t * info;
-	int * faninValues;
+	/* Reused across calls; evaluate_circuit consumes the values before the
+	 * next call, so one growable scratch buffer avoids a malloc/free per
+	 * evaluated node per cycle */
+	static int * faninValues = NULL;
+	static int faninValuesCap = 0;
 
 	Abc_ObjForEachFanin(obj_ptr, fanin, i)
 	{
@@ -143,7 +147,10 @@ int * getFaninValues(Abc_Obj_t * obj_ptr) {
 		return NULL;
 	}
 
-	faninValues = (int*) malloc(Abc_ObjFaninNum(obj_ptr) * sizeof(int));
+	if (Abc_ObjFaninNum(obj_ptr) > faninValuesCap) {
+		faninValuesCap = 2 * Abc_ObjFaninNum(obj_ptr);
+		faninValues = (int*) realloc(faninValues, faninValuesCap * sizeof(int));
+	}
 	Abc_ObjForEachFanin(obj_ptr, fanin, i)
 	{
 		info = Ace_ObjInfo(fanin);
@@ -221,7 +228,6 @@ void evaluate_circuit(Abc_Ntk_t * ntk, Vec_Ptr_t * node_vec, int /*cycle*/) {
 					} else {
 						VTR_ASSERT(0);
 					}
-					free(faninValues);
 				} else {
 					Ace_Obj_Info_t * fanin_info = Ace_ObjInfo(
 							Abc_ObjFanin0(obj));
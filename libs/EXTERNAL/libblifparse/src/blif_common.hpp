@@ -10,36 +10,36 @@ namespace blifparse {
  */
 
 struct Names {
-    std::vector<std::string> nets;
+    std::vector<str_span> nets;
     std::vector<std::vector<LogicValue>> so_cover;
 };
 
 struct SubCkt {
-    std::string model;
-    std::vector<std::string> ports;
-    std::vector<std::string> nets;
+    str_span model;
+    std::vector<str_span> ports;
+    std::vector<str_span> nets;
 };
 
 /*
  * BLIF Extensions
  */
 struct Conn {
-    std::string src;
-    std::string dst;
+    str_span src;
+    str_span dst;
 };
 
 struct Cname {
-    std::string name;
+    str_span name;
 };
 
 struct Attr {
-    std::string name;
-    std::string value;
+    str_span name;
+    str_span value;
 };
 
 struct Param {
-    std::string name;
-    std::string value;
+    str_span name;
+    str_span value;
 };
 
 } //namespace
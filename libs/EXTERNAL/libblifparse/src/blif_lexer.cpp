@@ -1,7 +1,10 @@
+#include <algorithm>
+#include <cstring>
+
 #include "blif_lexer.hpp"
 
-//Windows doesn't have unistd.h, so we set '%option nounistd' 
-//in blif_lexer.l, but flex still includes it in the generated 
+//Windows doesn't have unistd.h, so we set '%option nounistd'
+//in blif_lexer.l, but flex still includes it in the generated
 //header unless YY_NO_UNISTD_H is defined to 1
 #define YY_NO_UNISTD_H 1
 #include "blif_lexer.gen.hpp" //For blifparse_lex_*()
@@ -10,6 +13,23 @@ extern YY_DECL; //For blifparse_lex()
 
 namespace blifparse {
 
+//Size of each string table arena chunk.
+//Strings longer than this get their own dedicated chunk.
+constexpr std::size_t INTERN_ARENA_CHUNK_SIZE = 1 << 16;
+
+//Initial (power-of-two) hash table size
+constexpr std::size_t INTERN_TABLE_INIT_SIZE = 1 << 10;
+
+//FNV-1a hash (32-bit constants, which are valid for any size_t width)
+static std::size_t hash_string(const char* str, std::size_t len) {
+    std::size_t hash = 2166136261u;
+    for(std::size_t i = 0; i < len; ++i) {
+        hash ^= static_cast<unsigned char>(str[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
 Lexer::Lexer(FILE* file, Callback& callback)
     : callback_(callback) {
     blifparse_lex_init(&state_);
@@ -21,7 +41,7 @@ Lexer::~Lexer() {
 }
 
 Parser::symbol_type Lexer::next_token() {
-    return blifparse_lex(state_, callback_);
+    return blifparse_lex(state_, *this, callback_);
 }
 
 const char* Lexer::text() const {
@@ -32,4 +52,68 @@ int Lexer::lineno() const {
     return blifparse_get_lineno(state_);
 }
 
+str_span Lexer::intern(const char* str, std::size_t len) {
+    if(table_.empty()) {
+        table_.resize(INTERN_TABLE_INIT_SIZE);
+    }
+
+    std::size_t hash = hash_string(str, len);
+    std::size_t mask = table_.size() - 1;
+    std::size_t i = hash & mask;
+    while(table_[i].str != nullptr) {
+        if(table_[i].hash == hash && table_[i].len == len
+           && std::memcmp(table_[i].str, str, len) == 0) {
+            //Already interned
+            return str_span(table_[i].str, table_[i].len);
+        }
+        i = (i + 1) & mask;
+    }
+
+    //Not seen before: copy into the arena and record it
+    const char* stored = arena_alloc(str, len);
+    table_[i].str = stored;
+    table_[i].len = len;
+    table_[i].hash = hash;
+    ++num_interned_;
+
+    //Keep the table at most half full so probe sequences stay short
+    if(2 * num_interned_ > table_.size()) {
+        table_grow();
+    }
+
+    return str_span(stored, len);
+}
+
+const char* Lexer::arena_alloc(const char* str, std::size_t len) {
+    if(len + 1 > arena_room_) {
+        std::size_t chunk_size = std::max(len + 1, INTERN_ARENA_CHUNK_SIZE);
+        arena_.emplace_back(new char[chunk_size]);
+        arena_next_ = arena_.back().get();
+        arena_room_ = chunk_size;
+    }
+
+    char* stored = arena_next_;
+    std::memcpy(stored, str, len);
+    stored[len] = '\0'; //NUL-terminate so spans can be used as C-style strings
+    arena_next_ += len + 1;
+    arena_room_ -= len + 1;
+    return stored;
+}
+
+void Lexer::table_grow() {
+    std::vector<InternEntry> old_entries = std::move(table_);
+    table_.assign(2 * old_entries.size(), InternEntry());
+
+    std::size_t mask = table_.size() - 1;
+    for(const InternEntry& entry : old_entries) {
+        if(entry.str == nullptr) continue;
+
+        std::size_t i = entry.hash & mask;
+        while(table_[i].str != nullptr) {
+            i = (i + 1) & mask;
+        }
+        table_[i] = entry;
+    }
+}
+
 }
@@ -1,6 +1,9 @@
 #ifndef BLIF_LEXER_HPP
 #define BLIF_LEXER_HPP
 
+#include <memory>
+#include <vector>
+
 #include "blifparse.hpp" //For blifparse::Callback
 #include "blif_parser.hpp" //For Parser::symbol_type
 
@@ -15,19 +18,46 @@ class Lexer {
         Parser::symbol_type next_token();
         const char* text() const;
         int lineno() const;
+
+        //Interns the string [str, str + len) in the lexer's string table,
+        //returning a span which remains valid until the Lexer is destroyed.
+        //All occurences of the same string share a single interned copy,
+        //so interning a previously seen string performs no allocation.
+        str_span intern(const char* str, std::size_t len);
     private:
+        const char* arena_alloc(const char* str, std::size_t len);
+        void table_grow();
+
         yyscan_t state_;
         Callback& callback_;
+
+        //Interned string storage.
+        //
+        //Strings are stored NUL-terminated and bump-allocated in the chunks
+        //of arena_, and de-duplicated via table_: an open-addressed (linear
+        //probing) power-of-two sized hash table. Arena storage is never
+        //moved, so spans stay valid across table growth.
+        struct InternEntry {
+            const char* str = nullptr; //nullptr indicates an empty slot
+            std::size_t len = 0;
+            std::size_t hash = 0;
+        };
+        std::vector<std::unique_ptr<char[]>> arena_;
+        char* arena_next_ = nullptr;
+        std::size_t arena_room_ = 0;
+        std::vector<InternEntry> table_;
+        std::size_t num_interned_ = 0;
 };
 
 /*
  * The YY_DECL is used by flex to specify the signature of the main
  * lexer function.
  *
- * We re-define it to something reasonable
+ * We re-define it to something reasonable, and pass in the Lexer
+ * wrapper object so tokens can be interned in its string table
  */
 #undef YY_DECL
-#define YY_DECL blifparse::Parser::symbol_type blifparse_lex(yyscan_t yyscanner, blifparse::Callback& callback)
+#define YY_DECL blifparse::Parser::symbol_type blifparse_lex(yyscan_t yyscanner, blifparse::Lexer& lexer, blifparse::Callback& callback)
 
 } //namespace
 #endif
@@ -126,16 +126,16 @@ using namespace blifparse;
 %token DOT_CNAME ".cname"
 
 /* declare variable tokens */
-%token <std::string> STRING
+%token <str_span> STRING
 
 /* declare types */
 %type <SubCkt> subckt
 %type <Names> names
-%type <std::vector<std::string>> string_list
+%type <std::vector<str_span>> string_list
 %type <std::vector<LogicValue>> so_cover_row
 %type <LogicValue> logic_value
 %type <LogicValue> latch_init
-%type <std::string> latch_control
+%type <str_span> latch_control
 %type <LatchType> latch_type
 
 /* BLIF Extensions */
@@ -193,7 +193,7 @@ subckt: DOT_SUBCKT STRING       { $$ = SubCkt(); $$.model = $2; }
 latch: DOT_LATCH STRING STRING {
                                     //Input and output only
                                     callback.lineno(lexer.lineno()); 
-                                    callback.latch($2, $3, LatchType::UNSPECIFIED, "", LogicValue::UNKOWN);
+                                    callback.latch($2, $3, LatchType::UNSPECIFIED, str_span(), LogicValue::UNKOWN);
                                }
     | DOT_LATCH STRING STRING latch_type latch_control {
                                     //Input, output, type and control
@@ -208,7 +208,7 @@ latch: DOT_LATCH STRING STRING {
     | DOT_LATCH STRING STRING latch_init {
                                     //Input, output, and init-value
                                     callback.lineno(lexer.lineno());
-                                    callback.latch($2, $3, LatchType::UNSPECIFIED, "", $4);
+                                    callback.latch($2, $3, LatchType::UNSPECIFIED, str_span(), $4);
                                }
     ;
 
@@ -219,7 +219,7 @@ latch_init: LOGIC_TRUE { $$ = LogicValue::TRUE; }
     ;
 
 latch_control: STRING { $$ = $1;}
-    | NIL { $$ = ""; }
+    | NIL { $$ = str_span(); }
     ;
 
 latch_type: LATCH_FE { $$ = LatchType::FALLING_EDGE; }
@@ -238,7 +238,7 @@ logic_value: LOGIC_TRUE { $$ = LogicValue::TRUE; }
     | LOGIC_DONT_CARE { $$ = LogicValue::DONT_CARE; }
     ;
 
-string_list: /*empty*/ { $$ = std::vector<std::string>(); }
+string_list: /*empty*/ { $$ = std::vector<str_span>(); }
     | string_list STRING { $$ = std::move($1); $$.push_back($2); }
     ;
 
@@ -248,9 +248,9 @@ string_list: /*empty*/ { $$ = std::vector<std::string>(); }
 conn: DOT_CONN STRING STRING { $$ = Conn(); $$.src = $2; $$.dst = $3; }
 cname: DOT_CNAME STRING { $$ = Cname(); $$.name = $2; }
 attr: DOT_ATTR STRING STRING { $$ = Attr(); $$.name = $2; $$.value = $3; }
-    | DOT_ATTR STRING { $$ = Attr(); $$.name = $2; $$.value = ""; }
+    | DOT_ATTR STRING { $$ = Attr(); $$.name = $2; $$.value = str_span(); }
 param: DOT_PARAM STRING STRING { $$ = Param(); $$.name = $2; $$.value = $3; }
-    | DOT_PARAM STRING { $$ = Param(); $$.name = $2; $$.value = ""; }
+    | DOT_PARAM STRING { $$ = Param(); $$.name = $2; $$.value = str_span(); }
 
 %%
 
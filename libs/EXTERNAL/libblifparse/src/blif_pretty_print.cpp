@@ -13,21 +13,21 @@ void BlifPrettyPrinter::finish_parse() {
     //Pass
 }
 
-void BlifPrettyPrinter::begin_model(std::string model_name) {
+void BlifPrettyPrinter::begin_model(str_span model_name) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
-    printf(".model %s\n", model_name.c_str());
+    printf(".model %s\n", model_name.data());
 }
 
-void BlifPrettyPrinter::inputs(std::vector<std::string> input_conns) {
+void BlifPrettyPrinter::inputs(const std::vector<str_span>& input_conns) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
     printf(".inputs \\\n");
     ++indent_level_;
     for(size_t i = 0; i < input_conns.size(); ++i) {
-        printf("%s%s", indent().c_str(), input_conns[i].c_str());
+        printf("%s%s", indent().c_str(), input_conns[i].data());
         if(i != input_conns.size() - 1) {
             printf(" \\");
         }
@@ -36,7 +36,7 @@ void BlifPrettyPrinter::inputs(std::vector<std::string> input_conns) {
     --indent_level_;
 }
 
-void BlifPrettyPrinter::outputs(std::vector<std::string> output_conns) {
+void BlifPrettyPrinter::outputs(const std::vector<str_span>& output_conns) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
@@ -44,7 +44,7 @@ void BlifPrettyPrinter::outputs(std::vector<std::string> output_conns) {
 
     ++indent_level_;
     for(size_t i = 0; i < output_conns.size(); ++i) {
-        printf("%s%s", indent().c_str(), output_conns[i].c_str());
+        printf("%s%s", indent().c_str(), output_conns[i].data());
         if(i != output_conns.size() - 1) {
             printf(" \\");
         }
@@ -53,14 +53,14 @@ void BlifPrettyPrinter::outputs(std::vector<std::string> output_conns) {
     --indent_level_;
 }
 
-void BlifPrettyPrinter::names(std::vector<std::string> nets, std::vector<std::vector<LogicValue>> so_cover) {
+void BlifPrettyPrinter::names(const std::vector<str_span>& nets, const std::vector<std::vector<LogicValue>>& so_cover) {
     printf("\n");
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
     printf(".names ");
     for(size_t i = 0; i < nets.size(); ++i) {
-        printf("%s", nets[i].c_str());
+        printf("%s", nets[i].data());
         if(i != nets.size() - 1) {
             printf(" ");
         }
@@ -83,7 +83,7 @@ void BlifPrettyPrinter::names(std::vector<std::string> nets, std::vector<std::ve
     }
 }
 
-void BlifPrettyPrinter::latch(std::string input, std::string output, LatchType type, std::string control, LogicValue init) {
+void BlifPrettyPrinter::latch(str_span input, str_span output, LatchType type, str_span control, LogicValue init) {
     printf("\n");
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
@@ -91,8 +91,8 @@ void BlifPrettyPrinter::latch(std::string input, std::string output, LatchType t
     printf(".latch \\\n");
 
     ++indent_level_;
-    printf("%s%s \\\n", indent().c_str(), input.c_str());
-    printf("%s%s \\\n", indent().c_str(), output.c_str());
+    printf("%s%s \\\n", indent().c_str(), input.data());
+    printf("%s%s \\\n", indent().c_str(), output.data());
     switch(type) {
         case LatchType::RISING_EDGE:    printf("%sre \\\n", indent().c_str()); break;
         case LatchType::FALLING_EDGE:   printf("%sfe \\\n", indent().c_str()); break;
@@ -106,7 +106,7 @@ void BlifPrettyPrinter::latch(std::string input, std::string output, LatchType t
     if(control.empty()) {
         printf("%sNIL \\\n", indent().c_str());
     } else {
-        printf("%s%s \\\n", indent().c_str(), control.c_str());
+        printf("%s%s \\\n", indent().c_str(), control.data());
     }
     switch(init) {
         case LogicValue::FALSE:     printf("%s0", indent().c_str()); break;
@@ -118,17 +118,17 @@ void BlifPrettyPrinter::latch(std::string input, std::string output, LatchType t
     --indent_level_;
 }
 
-void BlifPrettyPrinter::subckt(std::string model, std::vector<std::string> ports, std::vector<std::string> nets) {
+void BlifPrettyPrinter::subckt(str_span model, const std::vector<str_span>& ports, const std::vector<str_span>& nets) {
     printf("\n");
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
-    printf(".subckt %s \\\n", model.c_str());
+    printf(".subckt %s \\\n", model.data());
 
     ++indent_level_;
     assert(ports.size() == nets.size());
     for(size_t i = 0; i < ports.size(); i++) {
-        printf("%s%s=%s", indent().c_str(), ports[i].c_str(), nets[i].c_str());
+        printf("%s%s=%s", indent().c_str(), ports[i].data(), nets[i].data());
 
         if(i != ports.size() - 1) {
             printf(" \\");
@@ -153,33 +153,33 @@ void BlifPrettyPrinter::end_model() {
     printf(".end\n");
 }
 
-void BlifPrettyPrinter::conn(std::string src, std::string dst) {
+void BlifPrettyPrinter::conn(str_span src, str_span dst) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
-    printf(".conn %s %s\n", src.c_str(), dst.c_str());
+    printf(".conn %s %s\n", src.data(), dst.data());
 
 }
 
-void BlifPrettyPrinter::cname(std::string cell_name) {
+void BlifPrettyPrinter::cname(str_span cell_name) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
-    printf(".cname %s\n", cell_name.c_str());
+    printf(".cname %s\n", cell_name.data());
 }
 
-void BlifPrettyPrinter::attr(std::string name, std::string value) {
+void BlifPrettyPrinter::attr(str_span name, str_span value) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
-    printf(".attr %s %s\n", name.c_str(), value.c_str());
+    printf(".attr %s %s\n", name.data(), value.data());
 }
 
-void BlifPrettyPrinter::param(std::string name, std::string value) {
+void BlifPrettyPrinter::param(str_span name, str_span value) {
     if(print_file_line_) {
         printf("#%s:%d\n", filename_.c_str(), lineno_);
     }
-    printf(".param %s %s\n", name.c_str(), value.c_str());
+    printf(".param %s %s\n", name.data(), value.data());
 }
 
 void BlifPrettyPrinter::filename(std::string fname) {
@@ -15,25 +15,25 @@ class BlifPrettyPrinter : public Callback {
         void start_parse() override;
         void filename(std::string fname) override;
         void lineno(int line_num) override;
-        void begin_model(std::string model_name) override;
-        void inputs(std::vector<std::string> inputs) override;
-        void outputs(std::vector<std::string> outputs) override;
+        void begin_model(str_span model_name) override;
+        void inputs(const std::vector<str_span>& inputs) override;
+        void outputs(const std::vector<str_span>& outputs) override;
 
-        void names(std::vector<std::string> nets, std::vector<std::vector<LogicValue>> so_cover) override;
+        void names(const std::vector<str_span>& nets, const std::vector<std::vector<LogicValue>>& so_cover) override;
 
-        void latch(std::string input, std::string output, LatchType type, std::string control, LogicValue init) override;
+        void latch(str_span input, str_span output, LatchType type, str_span control, LogicValue init) override;
 
-        void subckt(std::string model, std::vector<std::string> ports, std::vector<std::string> nets) override;
+        void subckt(str_span model, const std::vector<str_span>& ports, const std::vector<str_span>& nets) override;
 
         void blackbox() override;
 
         void end_model() override;
 
         //BLIF Extensions
-        void conn(std::string src, std::string dst) override;
-        void cname(std::string cell_name) override;
-        void attr(std::string name, std::string value) override;
-        void param(std::string name, std::string value) override;
+        void conn(str_span src, str_span dst) override;
+        void cname(str_span cell_name) override;
+        void attr(str_span name, str_span value) override;
+        void param(str_span name, str_span value) override;
 
         void finish_parse() override;
 
@@ -10,22 +10,22 @@
 namespace blifparse {
 
 //.conn [Extended BLIF]
-void Callback::conn(std::string /*src*/, std::string /*dst*/) {
+void Callback::conn(str_span /*src*/, str_span /*dst*/) {
     parse_error(-1, ".conn", "Unsupported BLIF extension");
 }
 
 //.cname [Extended BLIF]
-void Callback::cname(std::string /*cell_name*/) {
+void Callback::cname(str_span /*cell_name*/) {
     parse_error(-1, ".cname", "Unsupported BLIF extension");
 }
 
 //.attr [Extended BLIF]
-void Callback::attr(std::string /*name*/, std::string /*value*/) {
+void Callback::attr(str_span /*name*/, str_span /*value*/) {
     parse_error(-1, ".attr", "Unsupported BLIF extension");
 }
 
 //.param [Extended BLIF]
-void Callback::param(std::string /*name*/, std::string /*value*/) {
+void Callback::param(str_span /*name*/, str_span /*value*/) {
     parse_error(-1, ".param", "Unsupported BLIF extension");
 }
 
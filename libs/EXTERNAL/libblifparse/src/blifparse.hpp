@@ -16,12 +16,19 @@
  * Define a callback derived from the blifparse::Callback interface, and pass it
  * to one of the blifparse::blif_parse_*() functions.
  *
- * The parser will then call the various callback methods as it encouters the 
+ * The parser will then call the various callback methods as it encouters the
  * appropriate parts of the netlist.
  *
+ * Names (e.g. nets, models, ports) are passed to the callbacks as str_span's:
+ * light-weight non-owning views into the parser's internal string table. This
+ * avoids allocating a std::string per name occurence (of which there can be
+ * an enormous number on large netlists). See str_span below for the lifetime
+ * guarantees.
+ *
  * See main.cpp and blif_pretty_print.hpp for example usage.
  *
  */
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <memory>
@@ -35,6 +42,30 @@ namespace blifparse {
 enum class LogicValue;
 enum class LatchType;
 
+//A non-owning view of a string interned in the parser's internal string table.
+//
+//Spans produced by the parser remain valid until the enclosing blif_parse_*()
+//call returns, so callbacks may safely hold on to them for the duration of the
+//parse. All occurences of the same string are interned to a single copy, so
+//spans of equal strings share the same data() pointer. The interned storage is
+//NUL-terminated, so data() may also be used as a C-style string.
+class str_span {
+    public:
+        str_span(): data_(""), len_(0) {}
+        str_span(const char* data, std::size_t len): data_(data), len_(len) {}
+
+        const char* data() const { return data_; }
+        std::size_t size() const { return len_; }
+        bool empty() const { return len_ == 0; }
+
+        //Materializes a std::string copy of the viewed string
+        std::string str() const { return std::string(data_, len_); }
+
+    private:
+        const char* data_;
+        std::size_t len_;
+};
+
 class Callback {
     public:
         virtual ~Callback() {}
@@ -49,22 +80,22 @@ class Callback {
         virtual void lineno(int line_num) = 0;
 
         //Start of a .model
-        virtual void begin_model(std::string model_name) = 0;
+        virtual void begin_model(str_span model_name) = 0;
 
         //.inputs
-        virtual void inputs(std::vector<std::string> inputs) = 0;
+        virtual void inputs(const std::vector<str_span>& inputs) = 0;
 
         //.outputs
-        virtual void outputs(std::vector<std::string> outputs) = 0;
+        virtual void outputs(const std::vector<str_span>& outputs) = 0;
 
         //.names
-        virtual void names(std::vector<std::string> nets, std::vector<std::vector<LogicValue>> so_cover) = 0;
+        virtual void names(const std::vector<str_span>& nets, const std::vector<std::vector<LogicValue>>& so_cover) = 0;
 
         //.latch
-        virtual void latch(std::string input, std::string output, LatchType type, std::string control, LogicValue init) = 0;
+        virtual void latch(str_span input, str_span output, LatchType type, str_span control, LogicValue init) = 0;
 
         //.subckt
-        virtual void subckt(std::string model, std::vector<std::string> ports, std::vector<std::string> nets) = 0;
+        virtual void subckt(str_span model, const std::vector<str_span>& ports, const std::vector<str_span>& nets) = 0;
 
         //.blackbox
         virtual void blackbox() = 0;
@@ -73,16 +104,16 @@ class Callback {
         virtual void end_model() = 0;
 
         //.conn [Extended BLIF, produces an error if not overriden]
-        virtual void conn(std::string src, std::string dst);
+        virtual void conn(str_span src, str_span dst);
 
         //.cname [Extended BLIF, produces an error if not overriden]
-        virtual void cname(std::string cell_name);
+        virtual void cname(str_span cell_name);
 
         //.attr [Extended BLIF, produces an error if not overriden]
-        virtual void attr(std::string name, std::string value);
+        virtual void attr(str_span name, str_span value);
 
         //.param [Extended BLIF, produces an error if not overriden]
-        virtual void param(std::string name, std::string value);
+        virtual void param(str_span name, str_span value);
 
         //End of parsing
         virtual void finish_parse() = 0;
@@ -16,13 +16,13 @@ class NoOpCallback : public Callback {
         void filename(std::string /*fname*/) override {}
         void lineno(int /*line_num*/) override {}
 
-        void begin_model(std::string /*model_name*/) override {}
-        void inputs(std::vector<std::string> /*inputs*/) override {}
-        void outputs(std::vector<std::string> /*outputs*/) override {}
+        void begin_model(str_span /*model_name*/) override {}
+        void inputs(const std::vector<str_span>& /*inputs*/) override {}
+        void outputs(const std::vector<str_span>& /*outputs*/) override {}
 
-        void names(std::vector<std::string> /*nets*/, std::vector<std::vector<LogicValue>> /*so_cover*/) override {}
-        void latch(std::string /*input*/, std::string /*output*/, LatchType /*type*/, std::string /*control*/, LogicValue /*init*/) override {}
-        void subckt(std::string /*model*/, std::vector<std::string> /*ports*/, std::vector<std::string> /*nets*/) override {}
+        void names(const std::vector<str_span>& /*nets*/, const std::vector<std::vector<LogicValue>>& /*so_cover*/) override {}
+        void latch(str_span /*input*/, str_span /*output*/, LatchType /*type*/, str_span /*control*/, LogicValue /*init*/) override {}
+        void subckt(str_span /*model*/, const std::vector<str_span>& /*ports*/, const std::vector<str_span>& /*nets*/) override {}
         void blackbox() override {}
 
         void end_model() override {}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -100,120 +101,108 @@ DomainId TimingConstraints::find_clock_domain(const std::string& name) const {
 bool TimingConstraints::should_analyze(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
     TATUM_ASSERT(src_domain);
     TATUM_ASSERT(sink_domain);
+    update_lookups();
 
     //If there is a domain pair + capture node or domain pair constraint then it should be analyzed
-    return setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node)) 
-           || setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID())) 
-           || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node))
-           || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID()));
+    size_t ipair = flat_domain_pair_index(src_domain, sink_domain);
+    if(flat_setup_constraints_[ipair].valid() || flat_hold_constraints_[ipair].valid()) {
+        return true;
+    }
+
+    //Fallback to the (rare) capture node-specific constraints
+    return flat_node_specific_clock_constraints_
+           && (setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node))
+               || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node)));
 }
 
 Time TimingConstraints::hold_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
-    //Try to find the capture node-specific constraint
-    auto iter = hold_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
-    if(iter != hold_constraints_.end()) {
-        return iter->second;
+    if(!src_domain || !sink_domain) {
+        return std::numeric_limits<Time>::quiet_NaN();
     }
+    update_lookups();
 
-    //If no capture node specific constraint was found, fallback to the domain pair constriant
-    iter = hold_constraints_.find(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID()));
-    if(iter != hold_constraints_.end()) {
-        return iter->second;
+    //Try to find the (rare) capture node-specific constraint
+    if(flat_node_specific_clock_constraints_ && capture_node) {
+        auto iter = hold_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
+        if(iter != hold_constraints_.end()) {
+            return iter->second;
+        }
     }
 
-    //No constraint found
-    return std::numeric_limits<Time>::quiet_NaN();
+    //Otherwise the domain pair constraint, NaN if unconstrained
+    return flat_hold_constraints_[flat_domain_pair_index(src_domain, sink_domain)];
 }
 
 Time TimingConstraints::setup_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
-    //Try to find the capture node-specific constraint
-    auto iter = setup_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
-    if(iter != setup_constraints_.end()) {
-        return iter->second;
+    if(!src_domain || !sink_domain) {
+        return std::numeric_limits<Time>::quiet_NaN();
     }
+    update_lookups();
 
-    //If no capture node specific constraint was found, fallback to the domain pair constriant
-    iter = setup_constraints_.find(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID()));
-    if(iter != setup_constraints_.end()) {
-        return iter->second;
+    //Try to find the (rare) capture node-specific constraint
+    if(flat_node_specific_clock_constraints_ && capture_node) {
+        auto iter = setup_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
+        if(iter != setup_constraints_.end()) {
+            return iter->second;
+        }
     }
 
-    //No constraint found
-    return std::numeric_limits<Time>::quiet_NaN();
+    //Otherwise the domain pair constraint, NaN if unconstrained
+    return flat_setup_constraints_[flat_domain_pair_index(src_domain, sink_domain)];
 }
 
 Time TimingConstraints::setup_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain) const {
-
-    auto iter = setup_clock_uncertainties_.find(DomainPair(src_domain, sink_domain));
-    if(iter == setup_clock_uncertainties_.end()) {
+    if(!src_domain || !sink_domain) {
         return Time(0.); //Defaults to zero if unspecified
     }
+    update_lookups();
 
-    return iter->second;
+    return flat_setup_clock_uncertainties_[flat_domain_pair_index(src_domain, sink_domain)];
 }
 
 Time TimingConstraints::hold_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain) const {
-
-    auto iter = hold_clock_uncertainties_.find(DomainPair(src_domain, sink_domain));
-    if(iter == hold_clock_uncertainties_.end()) {
+    if(!src_domain || !sink_domain) {
         return Time(0.); //Defaults to zero if unspecified
     }
+    update_lookups();
 
-    return iter->second;
+    return flat_hold_clock_uncertainties_[flat_domain_pair_index(src_domain, sink_domain)];
 }
 
 Time TimingConstraints::input_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type) const {
+    update_lookups();
 
     if (delay_type == DelayType::MAX) {
-        auto iter = find_io_constraint(node_id, domain_id, max_input_constraints_);
-        if(iter != max_input_constraints_.end()) {
-            return iter->second.constraint;
-        }
+        return find_flat_io_constraint(node_id, domain_id, flat_max_input_constraints_);
     } else {
         TATUM_ASSERT(delay_type == DelayType::MIN);
-        auto iter = find_io_constraint(node_id, domain_id, min_input_constraints_);
-        if(iter != min_input_constraints_.end()) {
-            return iter->second.constraint;
-        }
+        return find_flat_io_constraint(node_id, domain_id, flat_min_input_constraints_);
     }
-
-    return std::numeric_limits<Time>::quiet_NaN();
 }
 
 Time TimingConstraints::output_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type) const {
+    update_lookups();
 
     if (delay_type == DelayType::MAX) {
-        auto iter = find_io_constraint(node_id, domain_id, max_output_constraints_);
-        if(iter != max_output_constraints_.end()) {
-            return iter->second.constraint;
-        }
+        return find_flat_io_constraint(node_id, domain_id, flat_max_output_constraints_);
     } else {
         TATUM_ASSERT(delay_type == DelayType::MIN);
-        auto iter = find_io_constraint(node_id, domain_id, min_output_constraints_);
-        if(iter != min_output_constraints_.end()) {
-            return iter->second.constraint;
-        }
+        return find_flat_io_constraint(node_id, domain_id, flat_min_output_constraints_);
     }
-
-    return std::numeric_limits<Time>::quiet_NaN();
 }
 
 Time TimingConstraints::source_latency(const DomainId domain, const ArrivalType arrival_type) const {
+    if(!domain) {
+        return Time(0.); //Defaults to zero if unspecified
+    }
+    update_lookups();
 
     if (arrival_type == ArrivalType::EARLY) {
-        auto iter = source_latencies_early_.find(domain);
-        if(iter == source_latencies_early_.end()) {
-            return Time(0.); //Defaults to zero if unspecified
-        }
-        return iter->second;
+        return flat_source_latencies_early_[size_t(domain)];
     } else {
         TATUM_ASSERT(arrival_type == ArrivalType::LATE);
 
-        auto iter = source_latencies_late_.find(domain);
-        if(iter == source_latencies_late_.end()) {
-            return Time(0.); //Defaults to zero if unspecified
-        }
-        return iter->second;
+        return flat_source_latencies_late_[size_t(domain)];
     }
 }
 
@@ -286,21 +275,103 @@ TimingConstraints::source_latency_range TimingConstraints::source_latencies(Arri
     }
 }
 
-DomainId TimingConstraints::create_clock_domain(const std::string name) { 
+void TimingConstraints::update_lookups() const {
+    if(flat_lookups_valid_) return;
+
+    size_t num_domains = domain_ids_.size();
+    Time unconstrained = std::numeric_limits<Time>::quiet_NaN();
+
+    //Clock constraints and uncertainties become dense domain-pair tables
+    flat_setup_constraints_.assign(num_domains * num_domains, unconstrained);
+    flat_hold_constraints_.assign(num_domains * num_domains, unconstrained);
+    flat_setup_clock_uncertainties_.assign(num_domains * num_domains, Time(0.));
+    flat_hold_clock_uncertainties_.assign(num_domains * num_domains, Time(0.));
+
+    flat_node_specific_clock_constraints_ = false;
+    for(const auto& kv : setup_constraints_) {
+        if(kv.first.capture_node) {
+            //Only the wildcard (domain pair) constraints are flattened
+            flat_node_specific_clock_constraints_ = true;
+            continue;
+        }
+        const DomainPair& domains = kv.first.domain_pair;
+        flat_setup_constraints_[flat_domain_pair_index(domains.src_domain_id, domains.sink_domain_id)] = kv.second;
+    }
+    for(const auto& kv : hold_constraints_) {
+        if(kv.first.capture_node) {
+            flat_node_specific_clock_constraints_ = true;
+            continue;
+        }
+        const DomainPair& domains = kv.first.domain_pair;
+        flat_hold_constraints_[flat_domain_pair_index(domains.src_domain_id, domains.sink_domain_id)] = kv.second;
+    }
+    for(const auto& kv : setup_clock_uncertainties_) {
+        flat_setup_clock_uncertainties_[flat_domain_pair_index(kv.first.src_domain_id, kv.first.sink_domain_id)] = kv.second;
+    }
+    for(const auto& kv : hold_clock_uncertainties_) {
+        flat_hold_clock_uncertainties_[flat_domain_pair_index(kv.first.src_domain_id, kv.first.sink_domain_id)] = kv.second;
+    }
+
+    //The io constraint multimaps already iterate in node id order, so the
+    //flattened copies are sorted and ready for binary search
+    flat_max_input_constraints_.assign(max_input_constraints_.begin(), max_input_constraints_.end());
+    flat_min_input_constraints_.assign(min_input_constraints_.begin(), min_input_constraints_.end());
+    flat_max_output_constraints_.assign(max_output_constraints_.begin(), max_output_constraints_.end());
+    flat_min_output_constraints_.assign(min_output_constraints_.begin(), min_output_constraints_.end());
+
+    //Source latencies become per-domain tables
+    flat_source_latencies_early_.assign(num_domains, Time(0.));
+    flat_source_latencies_late_.assign(num_domains, Time(0.));
+    for(const auto& kv : source_latencies_early_) {
+        flat_source_latencies_early_[size_t(kv.first)] = kv.second;
+    }
+    for(const auto& kv : source_latencies_late_) {
+        flat_source_latencies_late_[size_t(kv.first)] = kv.second;
+    }
+
+    flat_lookups_valid_ = true;
+}
+
+void TimingConstraints::invalidate_lookups() {
+    flat_lookups_valid_ = false;
+}
+
+size_t TimingConstraints::flat_domain_pair_index(const DomainId src_domain, const DomainId sink_domain) const {
+    TATUM_ASSERT_SAFE(src_domain && sink_domain);
+    return size_t(src_domain) * domain_ids_.size() + size_t(sink_domain);
+}
+
+Time TimingConstraints::find_flat_io_constraint(const NodeId node_id, const DomainId domain_id, const std::vector<std::pair<NodeId,IoConstraint>>& flat_io_constraints) const {
+    auto by_node = [](const std::pair<NodeId,IoConstraint>& elem, const NodeId node) {
+        return elem.first < node;
+    };
+
+    auto iter = std::lower_bound(flat_io_constraints.begin(), flat_io_constraints.end(), node_id, by_node);
+    for(; iter != flat_io_constraints.end() && iter->first == node_id; ++iter) {
+        if(iter->second.domain == domain_id) return iter->second.constraint;
+    }
+
+    //Not found
+    return std::numeric_limits<Time>::quiet_NaN();
+}
+
+DomainId TimingConstraints::create_clock_domain(const std::string name) {
     DomainId id = find_clock_domain(name);
     if(!id) {
         //Create it
-        id = DomainId(domain_ids_.size()); 
-        domain_ids_.push_back(id); 
-        
+        id = DomainId(domain_ids_.size());
+        domain_ids_.push_back(id);
+
         domain_names_.push_back(name);
         domain_sources_.emplace_back(NodeId::INVALID());
 
         TATUM_ASSERT(clock_domain_name(id) == name);
         TATUM_ASSERT(find_clock_domain(name) == id);
+
+        invalidate_lookups(); //Domain-pair table dimensions changed
     }
 
-    return id; 
+    return id;
 }
 
 void TimingConstraints::set_setup_constraint(const DomainId src_domain, const DomainId sink_domain, const Time constraint) {
@@ -309,6 +380,7 @@ void TimingConstraints::set_setup_constraint(const DomainId src_domain, const Do
 void TimingConstraints::set_setup_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node, const Time constraint) {
     auto key = NodeDomainPair(src_domain, sink_domain, capture_node);
     setup_constraints_[key] = constraint;
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_hold_constraint(const DomainId src_domain, const DomainId sink_domain, const Time constraint) {
@@ -318,16 +390,19 @@ void TimingConstraints::set_hold_constraint(const DomainId src_domain, const Dom
 void TimingConstraints::set_hold_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node, const Time constraint) {
     auto key = NodeDomainPair(src_domain, sink_domain, capture_node);
     hold_constraints_[key] = constraint;
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_setup_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain, const Time uncertainty) {
     auto key = DomainPair(src_domain, sink_domain);
     setup_clock_uncertainties_[key] = uncertainty;
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_hold_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain, const Time uncertainty) {
     auto key = DomainPair(src_domain, sink_domain);
     hold_clock_uncertainties_[key] = uncertainty;
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_input_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type, const Time constraint) {
@@ -351,6 +426,7 @@ void TimingConstraints::set_input_constraint(const NodeId node_id, const DomainI
             min_input_constraints_.insert(std::make_pair(node_id, IoConstraint(domain_id, constraint)));
         }
     }
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_output_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type, const Time constraint) {
@@ -374,6 +450,7 @@ void TimingConstraints::set_output_constraint(const NodeId node_id, const Domain
             min_output_constraints_.insert(std::make_pair(node_id, IoConstraint(domain_id, constraint)));
         }
     }
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_source_latency(const DomainId domain, const ArrivalType arrival_type, const Time latency) {
@@ -383,6 +460,7 @@ void TimingConstraints::set_source_latency(const DomainId domain, const ArrivalT
         TATUM_ASSERT(arrival_type == ArrivalType::LATE);
         source_latencies_late_[domain] = latency;
     }
+    invalidate_lookups();
 }
 
 void TimingConstraints::set_clock_domain_source(const NodeId node_id, const DomainId domain_id) {
@@ -453,6 +531,8 @@ void TimingConstraints::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>
         remapped_min_output_constraints.insert(std::make_pair(new_node_id, kv.second));
     }
     min_output_constraints_ = std::move(remapped_min_output_constraints);
+
+    invalidate_lookups();
 }
 
 void TimingConstraints::print_constraints() const {
@@ -1,5 +1,6 @@
 #pragma once
 #include <map>
+#include <utility>
 #include <vector>
 #include <unordered_set>
 
@@ -120,6 +121,15 @@ class TimingConstraints {
 
         ///Prints out the timing constraints for debug purposes
         void print_constraints() const;
+
+        ///Ensures the flattened constraint look-up tables are up to date
+        //
+        //The hot queries (should_analyze(), setup/hold_constraint(), clock
+        //uncertainties, io constraints and source latencies) call this lazily,
+        //but the re-build itself is not thread-safe; the graph walkers also
+        //call it before launching traversals so a (potentially parallel)
+        //traversal never triggers the re-build concurrently.
+        void update_lookups() const;
     public: //Mutators
         ///\returns The DomainId of the clock with the specified name (will be created if it doesn not exist)
         DomainId create_clock_domain(const std::string name);
@@ -166,6 +176,14 @@ class TimingConstraints {
         io_constraint_iterator find_io_constraint(const NodeId node_id, const DomainId domain_id, const std::multimap<NodeId,IoConstraint>& io_constraints) const;
         mutable_io_constraint_iterator find_io_constraint(const NodeId node_id, const DomainId domain_id, std::multimap<NodeId,IoConstraint>& io_constraints);
 
+        ///Marks the flattened look-up tables out of date (called on any constraint modification)
+        void invalidate_lookups();
+
+        ///\returns The index of the (src, sink) domain pair in the dense domain-pair tables
+        size_t flat_domain_pair_index(const DomainId src_domain, const DomainId sink_domain) const;
+
+        ///\returns The constraint on (node_id, domain_id) in a flattened io constraint table, NaN if unconstrained
+        Time find_flat_io_constraint(const NodeId node_id, const DomainId domain_id, const std::vector<std::pair<NodeId,IoConstraint>>& flat_io_constraints) const;
 
     private: //Data
         tatum::util::linear_map<DomainId,DomainId> domain_ids_;
@@ -191,6 +209,32 @@ class TimingConstraints {
 
         std::map<DomainId,Time> source_latencies_early_;
         std::map<DomainId,Time> source_latencies_late_;
+
+        //Flattened constraint look-up tables (see update_lookups())
+        //
+        //The maps above remain the authoritative storage (used for iteration,
+        //modification and serialization); these tables are compiled from them
+        //to give O(1) indexed access on the hot query paths, and are lazily
+        //re-built after any modification.
+        //
+        //The dense domain-pair tables are indexed by flat_domain_pair_index()
+        //and hold NaN (constraints) or zero (uncertainties) where unspecified.
+        //The io constraint tables are sorted by node id for binary search,
+        //avoiding O(num graph nodes) storage. Capture-node specific setup/hold
+        //constraints are rare, so they stay in the maps and the queries fall
+        //back to them only when flat_node_specific_clock_constraints_ is set.
+        mutable bool flat_lookups_valid_ = false;
+        mutable bool flat_node_specific_clock_constraints_ = false;
+        mutable std::vector<Time> flat_setup_constraints_;
+        mutable std::vector<Time> flat_hold_constraints_;
+        mutable std::vector<Time> flat_setup_clock_uncertainties_;
+        mutable std::vector<Time> flat_hold_clock_uncertainties_;
+        mutable std::vector<std::pair<NodeId,IoConstraint>> flat_max_input_constraints_;
+        mutable std::vector<std::pair<NodeId,IoConstraint>> flat_min_input_constraints_;
+        mutable std::vector<std::pair<NodeId,IoConstraint>> flat_max_output_constraints_;
+        mutable std::vector<std::pair<NodeId,IoConstraint>> flat_min_output_constraints_;
+        mutable std::vector<Time> flat_source_latencies_early_;
+        mutable std::vector<Time> flat_source_latencies_late_;
 };
 
 /*
@@ -168,6 +168,21 @@ EdgeId TimingGraph::node_clock_launch_edge(const NodeId node) const {
 }
 
 
+void TimingGraph::reserve_nodes(size_t num_nodes) {
+    node_ids_.reserve(num_nodes);
+    node_types_.reserve(num_nodes);
+    node_in_edges_.reserve(num_nodes);
+    node_out_edges_.reserve(num_nodes);
+}
+
+void TimingGraph::reserve_edges(size_t num_edges) {
+    edge_ids_.reserve(num_edges);
+    edge_types_.reserve(num_edges);
+    edge_src_nodes_.reserve(num_edges);
+    edge_sink_nodes_.reserve(num_edges);
+    edges_disabled_.reserve(num_edges);
+}
+
 NodeId TimingGraph::add_node(const NodeType type) {
     //Invalidate the levelization
     is_levelized_ = false;
@@ -514,8 +529,39 @@ tatum::util::linear_map<NodeId,NodeId> TimingGraph::optimize_node_layout() const
     return orig_to_new_node_id;
 }
 
+bool TimingGraph::remap_levelization(const tatum::util::linear_map<NodeId,NodeId>& node_id_map) {
+    auto remap_node_list = [&](std::vector<NodeId>& node_list) {
+        for(NodeId& node : node_list) {
+            NodeId new_id = node_id_map[node];
+            if(!new_id) {
+                return false; //Node removed, levelization must be recomputed
+            }
+            node = new_id;
+        }
+        return true;
+    };
+
+    //On failure the partially remapped lists are left as-is; the caller marks
+    //the levelization invalid and force_levelize() discards them
+    for(std::vector<NodeId>& level : level_nodes_) {
+        if(!remap_node_list(level)) return false;
+    }
+    if(!remap_node_list(primary_inputs_)) return false;
+    if(!remap_node_list(logical_outputs_)) return false;
+
+    return true;
+}
+
 void TimingGraph::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node_id_map) {
-    is_levelized_ = false;
+    //A pure node re-numbering preserves the graph's topology, so an existing
+    //levelization stays structurally valid and can be remapped in place in
+    //O(V) instead of being discarded and recomputed from scratch in O(V + E).
+    //
+    //If the remap removes nodes (e.g. compress() after node removals) we
+    //conservatively fall back to re-levelizing on demand.
+    if(is_levelized_) {
+        is_levelized_ = remap_levelization(node_id_map);
+    }
 
     //Update values
     node_ids_ = clean_and_reorder_ids(node_id_map);
@@ -529,7 +575,9 @@ void TimingGraph::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node
 }
 
 void TimingGraph::remap_edges(const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map) {
-    is_levelized_ = false;
+    //Note that the levelization (if any) remains valid: it records only node
+    //ids and which levels they fall in, neither of which is affected by
+    //re-numbering the edges
 
     //Update values
     edge_ids_ = clean_and_reorder_ids(edge_id_map);
@@ -190,6 +190,14 @@ class TimingGraph {
         /*
          * Graph modifiers
          */
+        ///Reserves space for the specified number of nodes, avoiding
+        ///re-allocation as nodes are added with add_node()
+        void reserve_nodes(size_t num_nodes);
+
+        ///Reserves space for the specified number of edges, avoiding
+        ///re-allocation as edges are added with add_edge()
+        void reserve_edges(size_t num_edges);
+
         ///Adds a node to the timing graph
         ///\param type The type of the node to be added
         ///\warning Graph will likely need to be re-levelized after modification
@@ -258,6 +266,11 @@ class TimingGraph {
         void remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node_id_map);
         void remap_edges(const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map);
 
+        ///Applies a node re-numbering to the existing levelization
+        ///\returns true if the levelization was successfully remapped,
+        //          false if it must be recomputed (e.g. a levelized node was removed)
+        bool remap_levelization(const tatum::util::linear_map<NodeId,NodeId>& node_id_map);
+
         void force_levelize();
 
         bool valid_node_id(const NodeId node_id) const;
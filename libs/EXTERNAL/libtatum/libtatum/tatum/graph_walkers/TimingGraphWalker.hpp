@@ -1,6 +1,6 @@
 #pragma once
 #include "tatum/TimingGraphFwd.hpp"
-#include "tatum/TimingConstraintsFwd.hpp"
+#include "tatum/TimingConstraints.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
 #include <chrono>
@@ -31,6 +31,10 @@ class TimingGraphWalker {
         void do_arrival_pre_traversal(const TimingGraph& tg, const TimingConstraints& tc, GraphVisitor& visitor) {
             auto start_time = Clock::now();
 
+            //Prime the constraint look-up tables from serial code, so a
+            //parallel traversal never triggers their (lazy) re-build
+            tc.update_lookups();
+
             do_arrival_pre_traversal_impl(tg, tc, visitor);
 
             profiling_data_["arrival_pre_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -43,6 +47,8 @@ class TimingGraphWalker {
         void do_required_pre_traversal(const TimingGraph& tg, const TimingConstraints& tc, GraphVisitor& visitor) {
             auto start_time = Clock::now();
 
+            tc.update_lookups();
+
             do_required_pre_traversal_impl(tg, tc, visitor);
 
             profiling_data_["required_pre_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -55,6 +61,8 @@ class TimingGraphWalker {
         void do_arrival_traversal(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) {
             auto start_time = Clock::now();
 
+            tc.update_lookups();
+
             do_arrival_traversal_impl(tg, tc, dc, visitor);
 
             profiling_data_["arrival_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -67,6 +75,8 @@ class TimingGraphWalker {
         void do_required_traversal(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) {
             auto start_time = Clock::now();
 
+            tc.update_lookups();
+
             do_required_traversal_impl(tg, tc, dc, visitor);
 
             profiling_data_["required_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -3,8 +3,13 @@
 #include "tatum/report/TimingPathCollector.hpp"
 #include "tatum/report/TimingReportTagRetriever.hpp"
 #include "tatum/report/timing_path_tracing.hpp"
+#include <algorithm>
 #include <map>
 
+#ifdef TATUM_USE_TBB
+# include <tbb/parallel_for.h>
+#endif
+
 namespace tatum {
 
 namespace detail {
@@ -33,26 +38,34 @@ std::vector<TimingPath> collect_worst_timing_paths(const TimingGraph& timing_gra
         }
     }
 
-    //Sort in ascending slack order so most negative slacks are first
+    //Only the npaths worst end-points are traced, so find them with a
+    //partial sort (ascending slack order, most negative slacks first)
+    //rather than fully ordering every end-point tag
+    size_t ntrace = std::min(npaths, tags_and_sinks.size());
     auto ascending_slack_order = [](const TagNode& lhs, const TagNode& rhs) {
         return lhs.tag.time() < rhs.tag.time();
     };
-    std::sort(tags_and_sinks.begin(), tags_and_sinks.end(), ascending_slack_order);
-
-
-    //Trace the paths for each tag/node pair
-    // The the map will sort the nodes and tags from worst to best slack (i.e. ascending slack order),
-    // so the first pair is the most critical end-point
-    for(const auto& tag_node : tags_and_sinks) {
-        NodeId sink_node = tag_node.node;
-        TimingTag sink_tag = tag_node.tag;
-
-        TimingPath path = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node); 
-
-        paths.push_back(path);
-
-        if(paths.size() >= npaths) break;
+    std::partial_sort(tags_and_sinks.begin(), tags_and_sinks.begin() + ntrace, tags_and_sinks.end(), ascending_slack_order);
+
+    //Trace the paths for each tag/node pair, worst slack first.
+    //Each trace walks an independent fan-in cone of read-only data, so
+    //the traces can proceed in parallel when TBB is available.
+    paths.resize(ntrace);
+#ifdef TATUM_USE_TBB
+    tbb::parallel_for(size_t(0), ntrace, [&](size_t ipath) {
+        NodeId sink_node = tags_and_sinks[ipath].node;
+        TimingTag sink_tag = tags_and_sinks[ipath].tag;
+
+        paths[ipath] = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node);
+    });
+#else
+    for(size_t ipath = 0; ipath < ntrace; ++ipath) {
+        NodeId sink_node = tags_and_sinks[ipath].node;
+        TimingTag sink_tag = tags_and_sinks[ipath].tag;
+
+        paths[ipath] = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node);
     }
+#endif
 
     return paths;
 }
@@ -156,10 +169,11 @@ std::vector<SkewPath> collect_worst_skew_paths(const TimingGraph& timing_graph,
             return lhs.clock_skew > rhs.clock_skew;
         }
     };
-    std::sort(paths.begin(), paths.end(), skew_order);
-
+    //Only the npaths worst skews are reported, so a partial sort suffices
     //TODO: not very efficient, since we generate all paths first and then trim to npaths...
-    paths.resize(std::min(paths.size(), npaths));
+    size_t nkeep = std::min(paths.size(), npaths);
+    std::partial_sort(paths.begin(), paths.begin() + nkeep, paths.end(), skew_order);
+    paths.resize(nkeep);
 
     return paths;
 }
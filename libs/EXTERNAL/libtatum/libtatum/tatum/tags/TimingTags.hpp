@@ -30,7 +30,8 @@ class TimingTags {
         class Iterator;
     private:
         //In practice the vast majority of nodes have only a handful of tags,
-        //so we reserve space for some to avoid costly memory allocations
+        //so the first allocation reserves space for several to avoid
+        //repeated re-allocation as the initial tags are added
         constexpr static size_t DEFAULT_TAGS_TO_RESERVE = 3;
         constexpr static size_t GROWTH_FACTOR = 2;
 
@@ -44,7 +45,11 @@ class TimingTags {
     public:
 
         //Constructors
-        TimingTags(size_t num_reserve=DEFAULT_TAGS_TO_RESERVE);
+        //
+        //By default no storage is allocated until the first tag is added;
+        //this avoids a heap allocation per graph node when the analyzer's
+        //per-node tag sets are first constructed
+        TimingTags(size_t num_reserve=0);
         TimingTags(const TimingTags&);
         TimingTags(TimingTags&&);
         TimingTags& operator=(TimingTags);
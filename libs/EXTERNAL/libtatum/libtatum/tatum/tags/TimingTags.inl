@@ -159,9 +159,11 @@ inline void TimingTags::max(const Time& new_time, const NodeId origin, const Tim
         if(iter == end(base_tag.type())) {
             //An exact match was not found
 
-            //First time we've seen this domain
+            //First time we've seen this domain.
+            //Insert directly at the miss position (the end of this tag
+            //type's range), which is where add_tag() would place it
             TimingTag tag = TimingTag(new_time, origin, base_tag);
-            add_tag(tag);
+            insert(iter, tag);
         } else {
             iter->max(new_time, origin, base_tag);
         }
@@ -177,9 +179,11 @@ inline void TimingTags::min(const Time& new_time, const NodeId origin, const Tim
         if(iter == end(base_tag.type())) {
             //An exact match was not found
 
-            //First time we've seen this domain
+            //First time we've seen this domain.
+            //Insert directly at the miss position (the end of this tag
+            //type's range), which is where add_tag() would place it
             TimingTag tag = TimingTag(new_time, origin, base_tag);
-            add_tag(tag);
+            insert(iter, tag);
         } else {
             iter->min(new_time, origin, base_tag);
         }
@@ -251,10 +255,7 @@ inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& t
         TATUM_ASSERT(size() + 1 <= capacity());
 
         //Shift everything one position right from end to index
-        //TODO: use std::copy_backward?
-        for(size_t i = size(); i != index; --i) {
-            tags_[i] = tags_[i - 1];
-        }
+        std::copy_backward(tags_.get() + index, tags_.get() + size(), tags_.get() + size() + 1);
 
         //Insert the new value in the hole at index created by shifting
         tags_[index] = tag;
@@ -267,7 +268,7 @@ inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& t
 }
 
 inline void TimingTags::grow_insert(size_t index, const TimingTag& tag) {
-    size_t new_capacity = (capacity() == 0) ? 1 : GROWTH_FACTOR * capacity();
+    size_t new_capacity = (capacity() == 0) ? DEFAULT_TAGS_TO_RESERVE : GROWTH_FACTOR * capacity();
 
     //We construct a new copy of ourselves at the new capacity and with the new
     //tag inserted
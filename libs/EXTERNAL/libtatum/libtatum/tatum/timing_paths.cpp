@@ -6,6 +6,11 @@
 #include "tatum/report/timing_path_tracing.hpp"
 #include "tatum/error.hpp"
 
+#ifdef TATUM_USE_TBB
+#    include <tbb/parallel_reduce.h>
+#    include <tbb/blocked_range.h>
+#endif
+
 namespace tatum {
 
 //Generic path tracer for setup or hold
@@ -38,8 +43,27 @@ std::vector<TimingPathInfo> find_critical_paths(const TimingGraph& timing_graph,
 
     //To ensure we find the critical path delay, we look at all timing endpoints (i.e. logical_outputs()) and keep
     //the largest for each domain pair
-    for(NodeId node : timing_graph.logical_outputs()) {
 
+    //Merges a candidate path into the per-domain-pair maxima
+    auto merge_path = [](std::vector<TimingPathInfo>& path_infos, const TimingPathInfo& path) {
+        //Find any existing path for this domain pair
+        auto cmp = [&path](const TimingPathInfo& elem) {
+            return    elem.launch_domain() == path.launch_domain()
+                   && elem.capture_domain() == path.capture_domain();
+        };
+        auto iter = std::find_if(path_infos.begin(), path_infos.end(), cmp);
+
+        if(iter == path_infos.end()) {
+            //New domain pair
+            path_infos.push_back(path);
+        } else if(iter->delay() < path.delay()) {
+            //New max CPD
+            *iter = path;
+        }
+    };
+
+    //Reduces one endpoint's slack tags into the per-domain-pair maxima
+    auto reduce_endpoint = [&](std::vector<TimingPathInfo>& path_infos, NodeId node) {
         //Look at each data arrival
         for(TimingTag slack_tag : setup_analyzer.setup_slacks(node)) {
             Time slack = slack_tag.time();
@@ -61,25 +85,38 @@ std::vector<TimingPathInfo> find_critical_paths(const TimingGraph& timing_graph,
             TimingPathInfo path(TimingType::SETUP,
                                 cpd, slack,
                                 NodeId::INVALID(), //We currently don't trace the path back to the start point, so just mark as invalid
-                                node, 
+                                node,
                                 slack_tag.launch_clock_domain(), slack_tag.capture_clock_domain());
 
-            //Find any existing path for this domain pair
-            auto cmp = [&path](const TimingPathInfo& elem) {
-                return    elem.launch_domain() == path.launch_domain()
-                       && elem.capture_domain() == path.capture_domain();
-            };
-            auto iter = std::find_if(cpds.begin(), cpds.end(), cmp);
-
-            if(iter == cpds.end()) {
-                //New domain pair
-                cpds.push_back(path);
-            } else if(iter->delay() < path.delay()) {
-                //New max CPD
-                *iter = path;
-            }
+            merge_path(path_infos, path);
         }
+    };
+
+#ifdef TATUM_USE_TBB
+    //The per-endpoint reductions are independent and the number of domain
+    //pairs is small, so fold the endpoints in parallel and merge the
+    //per-domain-pair maxima at the joins
+    auto endpoints = timing_graph.logical_outputs();
+    cpds = tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, endpoints.size()),
+        std::vector<TimingPathInfo>(),
+        [&](const tbb::blocked_range<size_t>& range, std::vector<TimingPathInfo> local_cpds) {
+            for(size_t i = range.begin(); i != range.end(); ++i) {
+                reduce_endpoint(local_cpds, *(endpoints.begin() + i));
+            }
+            return local_cpds;
+        },
+        [&](std::vector<TimingPathInfo> lhs, const std::vector<TimingPathInfo>& rhs) {
+            for(const TimingPathInfo& path : rhs) {
+                merge_path(lhs, path);
+            }
+            return lhs;
+        });
+#else
+    for(NodeId node : timing_graph.logical_outputs()) {
+        reduce_endpoint(cpds, node);
     }
+#endif
 
     return cpds;
 }
@@ -95,6 +95,8 @@ class linear_map {
         template<typename... Args>
         void resize(Args&&... args) { vec_.resize(std::forward<Args>(args)...); }
 
+        void reserve(size_t n) { vec_.reserve(n); }
+
         void clear() { vec_.clear(); }
 
         size_t capacity() const { return vec_.capacity(); }
@@ -1,5 +1,7 @@
 #include <cstring>
+#include <new>
 #include <sstream>
+#include <type_traits>
 
 #include "vtr_assert.h"
 #include "vtr_memory.h"
@@ -133,6 +135,8 @@ void free_arch(t_arch* arch) {
         return;
     }
 
+    invalidate_cached_arch(arch);
+
     for (int i = 0; i < arch->num_switches; ++i) {
         if (arch->Switches->name != nullptr) {
             vtr::free(arch->Switches[i].name);
@@ -278,6 +282,26 @@ void free_type_descriptors(std::vector<t_logical_block_type>& type_descriptors)
     type_descriptors.clear();
 }
 
+/* Arena storage backing all pb_graph pin arrays (see alloc_pb_graph_pin_array()) */
+static vtr::t_chunk pb_graph_pin_storage;
+
+/* Allocates a default-constructed array of pb_graph pins from the shared pin
+ * arena. The pins end up densely packed in construction order, so the hot
+ * pin-to-pin walks (e.g. intra-cluster routing) stream through memory instead
+ * of chasing individually allocated port arrays. The whole arena is released
+ * at once when the pb graphs are freed (see free_all_pb_graph_nodes()). */
+t_pb_graph_pin* alloc_pb_graph_pin_array(int num_pins) {
+    //The arena is bulk-freed without running destructors
+    static_assert(std::is_trivially_destructible<t_pb_graph_pin>::value,
+                  "t_pb_graph_pin must be trivially destructible to live in the pin arena");
+
+    t_pb_graph_pin* pins = (t_pb_graph_pin*)vtr::chunk_malloc(num_pins * sizeof(t_pb_graph_pin), &pb_graph_pin_storage);
+    for (int ipin = 0; ipin < num_pins; ++ipin) {
+        new (&pins[ipin]) t_pb_graph_pin();
+    }
+    return pins;
+}
+
 static void free_all_pb_graph_nodes(std::vector<t_logical_block_type>& type_descriptors) {
     for (auto& type : type_descriptors) {
         if (type.pb_type) {
@@ -287,6 +311,9 @@ static void free_all_pb_graph_nodes(std::vector<t_logical_block_type>& type_desc
             }
         }
     }
+
+    /* All pin arrays are freed at once with their arena */
+    vtr::free_chunk_memory(&pb_graph_pin_storage);
 }
 
 static void free_pb_graph(t_pb_graph_node* pb_graph_node) {
@@ -314,7 +341,7 @@ static void free_pb_graph(t_pb_graph_node* pb_graph_node) {
             if (pb_graph_node->input_pins[i][j].parent_pin_class)
                 vtr::free(pb_graph_node->input_pins[i][j].parent_pin_class);
         }
-        delete[] pb_graph_node->input_pins[i];
+        /* The pin array itself lives in the pin arena (see alloc_pb_graph_pin_array()) */
     }
     for (i = 0; i < pb_graph_node->num_output_ports; i++) {
         for (j = 0; j < pb_graph_node->num_output_pins[i]; j++) {
@@ -343,7 +370,6 @@ static void free_pb_graph(t_pb_graph_node* pb_graph_node) {
             if (pb_graph_node->output_pins[i][j].num_connectable_primitive_input_pins)
                 vtr::free(pb_graph_node->output_pins[i][j].num_connectable_primitive_input_pins);
         }
-        delete[] pb_graph_node->output_pins[i];
     }
     for (i = 0; i < pb_graph_node->num_clock_ports; i++) {
         for (j = 0; j < pb_graph_node->num_clock_pins[i]; j++) {
@@ -360,7 +386,6 @@ static void free_pb_graph(t_pb_graph_node* pb_graph_node) {
             if (pb_graph_node->clock_pins[i][j].parent_pin_class)
                 vtr::free(pb_graph_node->clock_pins[i][j].parent_pin_class);
         }
-        delete[] pb_graph_node->clock_pins[i];
     }
 
     vtr::free(pb_graph_node->input_pins);
@@ -44,6 +44,10 @@ void free_type_descriptors(std::vector<t_physical_tile_type>& type_descriptors);
 
 t_port* findPortByName(const char* name, t_pb_type* pb_type, int* high_index, int* low_index);
 
+/* Allocates an array of num_pins default-constructed pb_graph pins from the
+ * shared pin arena (bulk-freed when the pb graphs are freed) */
+t_pb_graph_pin* alloc_pb_graph_pin_array(int num_pins);
+
 t_physical_tile_type SetupEmptyPhysicalType();
 t_logical_block_type SetupEmptyLogicalType();
 
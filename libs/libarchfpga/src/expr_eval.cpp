@@ -6,6 +6,7 @@
 #include <stack>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <cstring> //memset
 
 using std::stack;
@@ -18,6 +19,7 @@ using std::vector;
 typedef enum e_formula_obj {
     E_FML_UNDEFINED = 0,
     E_FML_NUMBER,
+    E_FML_VARIABLE,
     E_FML_BRACKET,
     E_FML_COMMA,
     E_FML_OPERATOR,
@@ -49,6 +51,7 @@ class Formula_Object {
     /* object data, accessed based on what kind of object this is */
     union u_Data {
         int num;           /*for number objects*/
+        int var_idx;       /*for variable objects -- index into the compiled formula's variable name table*/
         t_operator op;     /*for operator objects*/
         bool left_bracket; /*for bracket objects -- specifies if this is a left bracket*/
 
@@ -62,6 +65,8 @@ class Formula_Object {
     std::string to_string() const {
         if (type == E_FML_NUMBER) {
             return std::to_string(data.num);
+        } else if (type == E_FML_VARIABLE) {
+            return "var" + std::to_string(data.var_idx);
         } else if (type == E_FML_BRACKET) {
             if (data.left_bracket) {
                 return "(";
@@ -96,12 +101,25 @@ class Formula_Object {
     }
 };
 
+/* A formula compiled to reverse-polish notation. Variables are left as
+ * symbolic references (indices into var_names) so the compiled form can be
+ * cached and re-evaluated with different variable values. Formulas containing
+ * no variables (the overwhelmingly common case) are folded to a constant at
+ * compile time. */
+struct Compiled_Formula {
+    vector<Formula_Object> rpn;
+    vector<string> var_names;
+    bool is_constant = false;
+    int constant_value = 0;
+};
+
 /*---- Functions for Parsing the Symbolic Formulas ----*/
 
-/* converts specified formula to a vector in reverse-polish notation */
-static void formula_to_rpn(const char* formula, const t_formula_data& mydata, vector<Formula_Object>& rpn_output);
+/* converts specified formula to a vector in reverse-polish notation, recording
+ * any variables encountered in var_names */
+static void formula_to_rpn(const char* formula, vector<string>& var_names, vector<Formula_Object>& rpn_output);
 
-static void get_formula_object(const char* ch, int& ichar, const t_formula_data& mydata, Formula_Object* fobj);
+static void get_formula_object(const char* ch, int& ichar, vector<string>& var_names, Formula_Object* fobj);
 
 /* returns integer specifying precedence of passed-in operator. higher integer
  * means higher precedence */
@@ -143,18 +161,48 @@ static bool goto_next_char(int* str_ind, const string& pw_formula, char ch);
 /**** Function Implementations ****/
 /* returns integer result according to specified non-piece-wise formula and data */
 int parse_formula(std::string formula, const t_formula_data& mydata) {
-    int result = -1;
+    /* Compiled formulas are cached so repeated evaluations of the same
+     * expression (e.g. grid location specs evaluated once per grid cell per
+     * candidate device size) skip the shunting-yard pass. The cache is keyed
+     * on the formula text; formulas come from the architecture file so the
+     * cache stays small. */
+    static std::unordered_map<std::string, Compiled_Formula> compiled_formulas;
+
+    auto iter = compiled_formulas.find(formula);
+    if (iter == compiled_formulas.end()) {
+        Compiled_Formula compiled;
+
+        /* run the shunting-yard algorithm to convert formula to reverse polish notation */
+        formula_to_rpn(formula.c_str(), compiled.var_names, compiled.rpn);
+
+        if (compiled.var_names.empty()) {
+            /* no variables -- fold to a constant now */
+            vector<Formula_Object> rpn_copy = compiled.rpn;
+            compiled.constant_value = parse_rpn_vector(rpn_copy);
+            compiled.is_constant = true;
+        }
 
-    /* output in reverse-polish notation */
-    vector<Formula_Object> rpn_output;
+        iter = compiled_formulas.emplace(std::move(formula), std::move(compiled)).first;
+    }
 
-    /* now we have to run the shunting-yard algorithm to convert formula to reverse polish notation */
-    formula_to_rpn(formula.c_str(), mydata, rpn_output);
+    const Compiled_Formula& compiled = iter->second;
 
-    /* then we run an RPN parser to get the final result */
-    result = parse_rpn_vector(rpn_output);
+    if (compiled.is_constant) {
+        return compiled.constant_value;
+    }
 
-    return result;
+    /* substitute the current variable values into a copy of the compiled RPN
+     * (the RPN parser consumes its input), then evaluate it */
+    vector<Formula_Object> rpn_vec = compiled.rpn;
+    for (Formula_Object& fobj : rpn_vec) {
+        if (E_FML_VARIABLE == fobj.type) {
+            int value = mydata.get_var_value(compiled.var_names[fobj.data.var_idx]);
+            fobj.type = E_FML_NUMBER;
+            fobj.data.num = value;
+        }
+    }
+
+    return parse_rpn_vector(rpn_vec);
 }
 
 /* EXPERIMENTAL:
@@ -283,7 +331,7 @@ static bool goto_next_char(int* str_ind, const string& pw_formula, char ch) {
 
 /* Parses the specified formula using a shunting yard algorithm (see wikipedia). The function's result
  * is stored in the rpn_output vector in reverse-polish notation */
-static void formula_to_rpn(const char* formula, const t_formula_data& mydata, vector<Formula_Object>& rpn_output) {
+static void formula_to_rpn(const char* formula, vector<string>& var_names, vector<Formula_Object>& rpn_output) {
     stack<Formula_Object> op_stack; /* stack for handling operators and brackets in formula */
     Formula_Object fobj;            /* for parsing formula objects */
 
@@ -300,9 +348,10 @@ static void formula_to_rpn(const char* formula, const t_formula_data& mydata, ve
             /* skip space */
         } else {
             /* parse the character */
-            get_formula_object(ch, ichar, mydata, &fobj);
+            get_formula_object(ch, ichar, var_names, &fobj);
             switch (fobj.type) {
-                case E_FML_NUMBER:
+                case E_FML_NUMBER: //fallthrough
+                case E_FML_VARIABLE:
                     /* add to output vector */
                     rpn_output.push_back(fobj);
                     break;
@@ -341,11 +390,12 @@ static void formula_to_rpn(const char* formula, const t_formula_data& mydata, ve
     return;
 }
 
-/* Fills the formula object fobj according to specified character and mydata,
- * which help determine which numeric value, if any, gets assigned to fobj
+/* Fills the formula object fobj according to the specified character.
+ * Variables are recorded in var_names and referenced by index (their values
+ * are substituted at evaluation time).
  * ichar is incremented by the corresponding count if the need to step through the
  * character array arises */
-static void get_formula_object(const char* ch, int& ichar, const t_formula_data& mydata, Formula_Object* fobj) {
+static void get_formula_object(const char* ch, int& ichar, vector<string>& var_names, Formula_Object* fobj) {
     /* the character can either be part of a number, or it can be an object like W, t, (, +, etc
      * here we have to account for both possibilities */
 
@@ -370,9 +420,21 @@ static void get_formula_object(const char* ch, int& ichar, const t_formula_data&
             }
 
         } else {
-            //A variable
-            fobj->type = E_FML_NUMBER;
-            fobj->data.num = mydata.get_var_value(var_name);
+            //A variable -- record a symbolic reference to be resolved at evaluation time
+            int var_idx = -1;
+            for (size_t ivar = 0; ivar < var_names.size(); ++ivar) {
+                if (var_names[ivar] == var_name) {
+                    var_idx = ivar;
+                    break;
+                }
+            }
+            if (var_idx < 0) {
+                var_idx = var_names.size();
+                var_names.push_back(var_name);
+            }
+
+            fobj->type = E_FML_VARIABLE;
+            fobj->data.var_idx = var_idx;
         }
 
         ichar += (id_len - 1); //-1 since ichar is incremented at end of loop in formula_to_rpn()
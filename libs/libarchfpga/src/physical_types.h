@@ -38,6 +38,8 @@
 
 #include "vtr_ndmatrix.h"
 #include "vtr_hash.h"
+#include "vtr_flat_map.h"
+#include "vtr_string_interning.h"
 
 #include "logic_types.h"
 #include "clock_types.h"
@@ -82,23 +84,41 @@ enum class e_sb_type;
  * string.
  */
 
+// Shared interner for metadata value strings.
+//
+// Metadata values are highly repetitive (e.g. the same FASM annotation
+// attached to many RR nodes), so each distinct string is stored only once
+// and the values reference the shared copy. The process-wide pool is used
+// so metadata shares storage with other interned strings (e.g. netlist
+// names embedded in annotations).
+inline vtr::string_internment& metadata_string_internment() {
+    return vtr::global_string_internment();
+}
+
 // Metadata value storage.
 class t_metadata_value {
   public:
     explicit t_metadata_value(std::string v)
-        : value_(v) {}
+        : value_(metadata_string_internment().intern(std::move(v))) {}
     explicit t_metadata_value(const t_metadata_value& o)
         : value_(o.value_) {}
 
     // Return string value.
-    std::string as_string() const { return value_; }
+    std::string as_string() const { return *value_; }
 
   private:
-    std::string value_;
+    // Interned; shared with all other metadata values holding the same string
+    const std::string* value_;
 };
 
 // Metadata storage dictionary.
-struct t_metadata_dict : std::unordered_map<
+//
+// Stored as a flat map (sorted vector) rather than a hash table: typical
+// dictionaries hold only a handful of keys, so a lookup is a couple of
+// comparisons over a single contiguous allocation, and the per-dictionary
+// footprint is far smaller than an unordered_map's bucket array (which adds
+// up when metadata is attached to millions of nodes/edges).
+struct t_metadata_dict : vtr::flat_map<
                              std::string,
                              std::vector<t_metadata_value>> {
     // Is this key present in the map?
@@ -137,7 +157,7 @@ struct t_metadata_dict : std::unordered_map<
         // Get the iterator to the key, which may already have elements if
         // add was called with this key in the past.
         auto iter_inserted = this->emplace(key, std::vector<t_metadata_value>());
-        iter_inserted.first->second.push_back(t_metadata_value(value));
+        iter_inserted.first->second.push_back(t_metadata_value(std::move(value)));
     }
 };
 
@@ -224,6 +224,24 @@ static const t_physical_tile_port* get_port_by_name(t_physical_tile_type_ptr typ
  *
  */
 
+/* In-process cache of the most recently parsed architecture (see
+ * XmlReadArch()/invalidate_cached_arch()). The key records which output
+ * structures were populated and from what file contents/options. */
+static const t_arch* cached_arch = nullptr;
+static const void* cached_physical_tile_types = nullptr;
+static const void* cached_logical_block_types = nullptr;
+static std::string cached_arch_digest;
+static bool cached_timing_enabled = false;
+
+void invalidate_cached_arch(const t_arch* arch) {
+    if (cached_arch == arch) {
+        cached_arch = nullptr;
+        cached_physical_tile_types = nullptr;
+        cached_logical_block_types = nullptr;
+        cached_arch_digest.clear();
+    }
+}
+
 /* Loads the given architecture file. */
 void XmlReadArch(const char* ArchFile,
                  const bool timing_enabled,
@@ -241,7 +259,22 @@ void XmlReadArch(const char* ArchFile,
     }
 
     //Create a unique identifier for this architecture file based on it's contents
-    arch->architecture_id = vtr::strdup(vtr::secure_digest_file(ArchFile).c_str());
+    std::string arch_digest = vtr::secure_digest_file(ArchFile);
+
+    /* Re-loading an unchanged architecture into the same (still populated)
+     * structures is a no-op: batch flows which process many circuits in one
+     * process pay the multi-second parse/validate cost only once. The digest
+     * check invalidates the cache whenever the file contents change. */
+    if (cached_arch == arch
+        && cached_physical_tile_types == &PhysicalTileTypes
+        && cached_logical_block_types == &LogicalBlockTypes
+        && cached_arch_digest == arch_digest
+        && cached_timing_enabled == timing_enabled) {
+        VTR_LOG("Architecture file '%s' is unchanged, re-using previously parsed architecture\n", ArchFile);
+        return;
+    }
+
+    arch->architecture_id = vtr::strdup(arch_digest.c_str());
 
     /* Parse the file */
     pugi::xml_document doc;
@@ -381,6 +414,13 @@ void XmlReadArch(const char* ArchFile,
         SyncModelsPbTypes(arch, LogicalBlockTypes);
         UpdateAndCheckModels(arch);
 
+        /* Record what was parsed, so an identical re-load can be skipped */
+        cached_arch = arch;
+        cached_physical_tile_types = &PhysicalTileTypes;
+        cached_logical_block_types = &LogicalBlockTypes;
+        cached_arch_digest = arch_digest;
+        cached_timing_enabled = timing_enabled;
+
     } catch (pugiutil::XmlError& e) {
         archfpga_throw(ArchFile, e.line(),
                        "%s", e.what());
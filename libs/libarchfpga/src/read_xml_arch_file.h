@@ -20,6 +20,11 @@ void XmlReadArch(const char* ArchFile,
                  std::vector<t_physical_tile_type>& PhysicalTileTypes,
                  std::vector<t_logical_block_type>& LogicalBlockTypes);
 
+/* Forgets any record that 'arch' holds a previously parsed architecture,
+ * forcing the next XmlReadArch() into it to fully re-parse. Called when the
+ * architecture is freed (see free_arch()). */
+void invalidate_cached_arch(const t_arch* arch);
+
 const char* get_arch_file_name();
 
 #ifdef __cplusplus
@@ -35,6 +35,10 @@ void log_set_output_file(const char* filename) {
     }
 }
 
+FILE* log_get_output_stream() {
+    return log_stream;
+}
+
 void log_print_direct(const char* message, ...) {
     va_list args;
     va_start(args, message);
@@ -10,8 +10,13 @@
 #ifndef LOG_H
 #define LOG_H
 
+#include <stdio.h>
+
 void log_set_output_file(const char* filename);
 
+//Returns the current log file stream (may be null if no log file is set)
+FILE* log_get_output_stream();
+
 void log_print_direct(const char* message, ...);
 void log_print_info(const char* message, ...);
 void log_print_warning(const char* filename, unsigned int line_num, const char* message, ...);
@@ -7,6 +7,8 @@ namespace pugiutil {
 
 //Return the line number from the given offset
 std::size_t loc_data::line(std::ptrdiff_t offset) const {
+    if (!offsets_built_) build_loc_data();
+
     auto it = std::lower_bound(offsets_.begin(), offsets_.end(), offset);
     std::size_t index = it - offsets_.begin();
 
@@ -15,13 +17,17 @@ std::size_t loc_data::line(std::ptrdiff_t offset) const {
 
 //Return the column number from the given offset
 std::size_t loc_data::col(std::ptrdiff_t offset) const {
+    if (!offsets_built_) build_loc_data();
+
     auto it = std::lower_bound(offsets_.begin(), offsets_.end(), offset);
     std::size_t index = it - offsets_.begin();
 
     return index == 0 ? offset + 1 : offset - offsets_[index - 1];
 }
 
-void loc_data::build_loc_data() {
+//Builds the newline offset index in a single buffered pass over the file.
+//Called lazily from the first line()/col() query.
+void loc_data::build_loc_data() const {
     FILE* f = fopen(filename_.c_str(), "rb");
 
     if (f == nullptr) {
@@ -30,10 +36,10 @@ void loc_data::build_loc_data() {
 
     std::ptrdiff_t offset = 0;
 
-    char buffer[1024];
+    std::vector<char> buffer(1 << 20);
     std::size_t size;
 
-    while ((size = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    while ((size = fread(buffer.data(), 1, buffer.size(), f)) > 0) {
         for (std::size_t i = 0; i < size; ++i) {
             if (buffer[i] == '\n') {
                 offsets_.push_back(offset + i);
@@ -44,6 +50,8 @@ void loc_data::build_loc_data() {
     }
 
     fclose(f);
+
+    offsets_built_ = true;
 }
 
 } // namespace pugiutil
@@ -17,7 +17,11 @@ class loc_data {
 
     loc_data(std::string filename_val)
         : filename_(filename_val) {
-        build_loc_data();
+        //Note that the newline offset index is *not* built here: doing so
+        //costs a full scan of the file, which is substantial for large
+        //inputs (e.g. multi-GB routing resource graphs). Instead it is
+        //built lazily on the first line()/col() query, so files which
+        //produce no diagnostics are never re-scanned.
     }
 
     //The filename this location data is for
@@ -41,10 +45,14 @@ class loc_data {
     std::size_t col(std::ptrdiff_t offset) const;
 
   private:
-    void build_loc_data();
+    void build_loc_data() const;
 
     std::string filename_;
-    std::vector<std::ptrdiff_t> offsets_;
+
+    //Lazily built newline offset index (mutable so const queries can
+    //trigger the build)
+    mutable bool offsets_built_ = false;
+    mutable std::vector<std::ptrdiff_t> offsets_;
 };
 } // namespace pugiutil
 
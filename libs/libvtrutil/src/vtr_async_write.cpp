@@ -0,0 +1,115 @@
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "vtr_async_write.h"
+#include "vtr_compressed_io.h"
+#include "vtr_log.h"
+
+namespace vtr {
+
+namespace {
+
+//Background file writer service
+//
+//A single worker thread (created lazily on the first write) drains a queue
+//of (filepath, contents) pairs, performing each write as one large
+//sequential write. The destructor of the singleton drains any remaining
+//writes at program exit.
+class AsyncFileWriter {
+  public:
+    static AsyncFileWriter& instance() {
+        static AsyncFileWriter writer;
+        return writer;
+    }
+
+    void write(const std::string& filepath, std::string&& contents) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!worker_.joinable()) {
+                worker_ = std::thread(&AsyncFileWriter::run, this);
+            }
+            queue_.emplace_back(filepath, std::move(contents));
+        }
+        pending_cv_.notify_one();
+    }
+
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        drained_cv_.wait(lock, [this] { return queue_.empty() && !write_in_progress_; });
+    }
+
+    ~AsyncFileWriter() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            exit_ = true;
+        }
+        pending_cv_.notify_one();
+        if (worker_.joinable()) {
+            worker_.join(); //Drains any remaining writes
+        }
+    }
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  private:
+    AsyncFileWriter() = default;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            pending_cv_.wait(lock, [this] { return !queue_.empty() || exit_; });
+            if (queue_.empty()) break; //Exiting and fully drained
+
+            auto job = std::move(queue_.front());
+            queue_.pop_front();
+            write_in_progress_ = true;
+
+            lock.unlock(); //Perform the write without blocking producers
+            write_file(job.first, job.second);
+            lock.lock();
+
+            write_in_progress_ = false;
+            if (queue_.empty()) {
+                drained_cv_.notify_all();
+            }
+        }
+    }
+
+    static void write_file(const std::string& filepath, const std::string& contents) {
+        //Compresses the output if the file extension requests it (e.g. .gz)
+        CompressedWriter writer(filepath);
+        if (!writer.valid()) {
+            VTR_LOG_WARN("Failed to open '%s' for writing\n", filepath.c_str());
+            return;
+        }
+        if (!contents.empty()
+            && std::fwrite(contents.data(), 1, contents.size(), writer.file()) != contents.size()) {
+            VTR_LOG_WARN("Failed to write '%s'\n", filepath.c_str());
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable pending_cv_; //Signalled when work is queued (or at exit)
+    std::condition_variable drained_cv_; //Signalled when the queue drains
+    std::deque<std::pair<std::string, std::string>> queue_;
+    std::thread worker_;
+    bool write_in_progress_ = false;
+    bool exit_ = false;
+};
+
+} // namespace
+
+void async_write_file(const std::string& filepath, std::string&& contents) {
+    AsyncFileWriter::instance().write(filepath, std::move(contents));
+}
+
+void flush_async_writes() {
+    AsyncFileWriter::instance().flush();
+}
+
+} // namespace vtr
@@ -0,0 +1,22 @@
+#ifndef VTR_ASYNC_WRITE_H
+#define VTR_ASYNC_WRITE_H
+#include <string>
+
+namespace vtr {
+
+//Queues 'contents' for writing to the file at 'filepath' on a background
+//writer thread, overlapping (potentially large) file I/O with further
+//computation on the calling thread.
+//
+//Writes are performed in submission order (so successive writes to the same
+//path behave like successive synchronous writes). Call flush_async_writes()
+//before reading back a queued file or exiting abnormally; any remaining
+//queued writes are flushed automatically at normal program exit.
+void async_write_file(const std::string& filepath, std::string&& contents);
+
+//Blocks until all previously queued asynchronous writes have completed
+void flush_async_writes();
+
+} // namespace vtr
+
+#endif
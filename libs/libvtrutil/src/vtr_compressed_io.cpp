@@ -0,0 +1,164 @@
+#include <cstring>
+
+#include "vtr_compressed_io.h"
+#include "vtr_log.h"
+
+namespace vtr {
+
+//External codec programs used to stream compressed files.
+//
+//Piping through the external tools avoids both a library dependency and
+//staging a decompressed temporary copy on disk.
+static const char* GZIP_PROG = "gzip";
+static const char* ZSTD_PROG = "zstd";
+
+//Quotes 'str' for safe use as a single shell word
+static std::string shell_quote(const std::string& str) {
+    std::string quoted = "'";
+    for (char c : str) {
+        if (c == '\'') {
+            quoted += "'\\''"; //Close quote, escaped quote, re-open quote
+        } else {
+            quoted += c;
+        }
+    }
+    quoted += "'";
+    return quoted;
+}
+
+CompressionFormat detect_compression_format(const std::string& filename) {
+    FILE* f = std::fopen(filename.c_str(), "rb");
+    if (!f) {
+        return CompressionFormat::UNCOMPRESSED;
+    }
+
+    unsigned char magic[4] = {0, 0, 0, 0};
+    size_t nread = std::fread(magic, 1, sizeof(magic), f);
+    std::fclose(f);
+
+    if (nread >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) {
+        return CompressionFormat::GZIP;
+    }
+    if (nread >= 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F && magic[3] == 0xFD) {
+        return CompressionFormat::ZSTD;
+    }
+    return CompressionFormat::UNCOMPRESSED;
+}
+
+CompressionFormat compression_format_from_extension(const std::string& filename) {
+    auto ends_with = [&](const char* ext) {
+        size_t ext_len = std::strlen(ext);
+        return filename.size() >= ext_len
+               && filename.compare(filename.size() - ext_len, ext_len, ext) == 0;
+    };
+
+    if (ends_with(".gz")) return CompressionFormat::GZIP;
+    if (ends_with(".zst")) return CompressionFormat::ZSTD;
+    return CompressionFormat::UNCOMPRESSED;
+}
+
+const char* compression_format_name(CompressionFormat format) {
+    switch (format) {
+        case CompressionFormat::GZIP: return "gzip";
+        case CompressionFormat::ZSTD: return "zstd";
+        default: return "uncompressed";
+    }
+}
+
+CompressedReader::CompressedReader(const std::string& filename) {
+    format_ = detect_compression_format(filename);
+
+    if (format_ == CompressionFormat::UNCOMPRESSED) {
+        file_ = std::fopen(filename.c_str(), "r");
+        return;
+    }
+
+#ifdef _WIN32
+    VTR_LOG_WARN("Cannot read %s compressed file '%s' (compressed I/O unsupported on this platform)\n",
+                 compression_format_name(format_), filename.c_str());
+#else
+    const char* prog = (format_ == CompressionFormat::GZIP) ? GZIP_PROG : ZSTD_PROG;
+    std::string cmd = std::string(prog) + " -dc " + shell_quote(filename);
+    file_ = popen(cmd.c_str(), "r");
+    is_pipe_ = true;
+    if (!file_) {
+        VTR_LOG_WARN("Failed to launch decompressor '%s'\n", cmd.c_str());
+    }
+#endif
+}
+
+CompressedReader::~CompressedReader() {
+    if (!file_) return;
+
+    if (is_pipe_) {
+#ifndef _WIN32
+        if (pclose(file_) != 0) {
+            VTR_LOG_WARN("Decompressor exited with an error\n");
+        }
+#endif
+    } else {
+        std::fclose(file_);
+    }
+}
+
+CompressedWriter::CompressedWriter(const std::string& filename) {
+    format_ = compression_format_from_extension(filename);
+
+    if (format_ == CompressionFormat::UNCOMPRESSED) {
+        file_ = std::fopen(filename.c_str(), "w");
+        return;
+    }
+
+#ifdef _WIN32
+    VTR_LOG_WARN("Cannot write %s compressed file '%s' (compressed I/O unsupported on this platform)\n",
+                 compression_format_name(format_), filename.c_str());
+#else
+    const char* prog = (format_ == CompressionFormat::GZIP) ? GZIP_PROG : ZSTD_PROG;
+    std::string cmd = std::string(prog) + " -qc > " + shell_quote(filename);
+    file_ = popen(cmd.c_str(), "w");
+    is_pipe_ = true;
+    if (!file_) {
+        VTR_LOG_WARN("Failed to launch compressor '%s'\n", cmd.c_str());
+    }
+#endif
+}
+
+CompressedWriter::~CompressedWriter() {
+    if (!file_) return;
+
+    if (is_pipe_) {
+#ifndef _WIN32
+        if (pclose(file_) != 0) {
+            VTR_LOG_WARN("Compressor exited with an error\n");
+        }
+#endif
+    } else {
+        std::fclose(file_);
+    }
+}
+
+CompressedIstream::CompressedIstream(const std::string& filename)
+    : std::istream(nullptr)
+    , reader_(filename)
+    , streambuf_(reader_.file()) {
+    rdbuf(&streambuf_);
+    if (!reader_.valid()) {
+        setstate(std::ios::failbit);
+    }
+}
+
+CompressedIstream::FileStreambuf::int_type CompressedIstream::FileStreambuf::underflow() {
+    if (!file_) {
+        return traits_type::eof();
+    }
+
+    size_t nread = std::fread(buf_, 1, sizeof(buf_), file_);
+    if (nread == 0) {
+        return traits_type::eof();
+    }
+
+    setg(buf_, buf_, buf_ + nread);
+    return traits_type::to_int_type(buf_[0]);
+}
+
+} // namespace vtr
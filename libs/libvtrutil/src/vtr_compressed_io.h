@@ -0,0 +1,114 @@
+#ifndef VTR_COMPRESSED_IO_H
+#define VTR_COMPRESSED_IO_H
+#include <cstdio>
+#include <istream>
+#include <streambuf>
+#include <string>
+
+namespace vtr {
+
+//Compression formats transparently supported for file I/O
+enum class CompressionFormat {
+    UNCOMPRESSED,
+    GZIP,
+    ZSTD
+};
+
+//Returns the compression format of 'filename' based on its leading magic
+//bytes (UNCOMPRESSED if the file is unreadable or the bytes match no
+//known format)
+CompressionFormat detect_compression_format(const std::string& filename);
+
+//Returns the compression format implied by 'filename's extension
+//(.gz -> GZIP, .zst -> ZSTD), used to decide how output files are written
+CompressionFormat compression_format_from_extension(const std::string& filename);
+
+//Returns a human readable name for the given compression format
+const char* compression_format_name(CompressionFormat format);
+
+//RAII handle for reading a possibly-compressed file as a plain FILE* stream.
+//
+//The compression format is detected from the file's magic bytes; compressed
+//files are streamed through an external decompressor process ('gzip -dc' or
+//'zstd -dc'), so no temporary decompressed copy is ever staged on disk.
+class CompressedReader {
+  public:
+    explicit CompressedReader(const std::string& filename);
+    ~CompressedReader();
+
+    CompressedReader(const CompressedReader&) = delete;
+    CompressedReader& operator=(const CompressedReader&) = delete;
+
+    //Returns true if the file (and any decompressor) was opened successfully
+    bool valid() const { return file_ != nullptr; }
+
+    //The stream of (decompressed) file contents
+    FILE* file() { return file_; }
+
+    //The detected compression format
+    CompressionFormat format() const { return format_; }
+
+  private:
+    FILE* file_ = nullptr;
+    bool is_pipe_ = false;
+    CompressionFormat format_ = CompressionFormat::UNCOMPRESSED;
+};
+
+//RAII handle for writing a file as a plain FILE* stream, compressing the
+//output if the filename's extension requests it (see
+//compression_format_from_extension())
+class CompressedWriter {
+  public:
+    explicit CompressedWriter(const std::string& filename);
+    ~CompressedWriter();
+
+    CompressedWriter(const CompressedWriter&) = delete;
+    CompressedWriter& operator=(const CompressedWriter&) = delete;
+
+    //Returns true if the file (and any compressor) was opened successfully
+    bool valid() const { return file_ != nullptr; }
+
+    //The stream to write (uncompressed) file contents to
+    FILE* file() { return file_; }
+
+    //The compression format being written
+    CompressionFormat format() const { return format_; }
+
+  private:
+    FILE* file_ = nullptr;
+    bool is_pipe_ = false;
+    CompressionFormat format_ = CompressionFormat::UNCOMPRESSED;
+};
+
+//A std::istream which transparently decompresses the file it reads (see
+//CompressedReader), for use with line-oriented parsers. Behaves like a
+//std::ifstream: evaluates false if the file could not be opened.
+class CompressedIstream : public std::istream {
+  public:
+    explicit CompressedIstream(const std::string& filename);
+
+    //The detected compression format
+    CompressionFormat format() const { return reader_.format(); }
+
+  private:
+    //streambuf which refills from the reader's FILE* stream
+    class FileStreambuf : public std::streambuf {
+      public:
+        explicit FileStreambuf(FILE* file)
+            : file_(file) {}
+
+      protected:
+        int_type underflow() override;
+
+      private:
+        FILE* file_;
+        char buf_[1 << 16];
+    };
+
+    CompressedReader reader_;
+    FileStreambuf streambuf_;
+};
+
+} // namespace vtr
+
+#endif
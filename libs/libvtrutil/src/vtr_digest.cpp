@@ -1,12 +1,163 @@
 #include "vtr_digest.h"
 #include "vtr_error.h"
+#include "vtr_util.h"
 
 #include <iostream>
 #include <fstream>
 #include <array>
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 #include "picosha2.h"
 
+namespace {
+
+//XXH64 (the 64-bit variant of xxHash), implemented from the published
+//specification. A non-cryptographic hash which processes input at close to
+//memory bandwidth, versus ~100 MB/s for the SHA-256 digest below.
+//
+//Note the specification defines the hash over little-endian input words; the
+//unaligned reads below assume a little-endian host (as does the rest of VTR's
+//binary file handling).
+constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ull;
+constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t xxh_rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t xxh_read_u64(const unsigned char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t xxh_read_u32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = xxh_rotl64(acc, 31);
+    acc *= XXH_PRIME64_1;
+    return acc;
+}
+
+//Streaming XXH64 state, mirroring the process()/finish() shape of
+//picosha2::hash256_one_by_one
+class xxh64_one_by_one {
+  public:
+    explicit xxh64_one_by_one(uint64_t seed = 0)
+        : acc1_(seed + XXH_PRIME64_1 + XXH_PRIME64_2)
+        , acc2_(seed + XXH_PRIME64_2)
+        , acc3_(seed)
+        , acc4_(seed - XXH_PRIME64_1) {}
+
+    void process(const char* data, size_t len) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+        total_len_ += len;
+
+        if (buffered_ + len < STRIPE_SIZE) {
+            //Not enough for a full stripe yet
+            std::memcpy(buffer_ + buffered_, p, len);
+            buffered_ += len;
+            return;
+        }
+
+        if (buffered_ > 0) {
+            //Complete the partially buffered stripe
+            size_t fill = STRIPE_SIZE - buffered_;
+            std::memcpy(buffer_ + buffered_, p, fill);
+            process_stripe(buffer_);
+            p += fill;
+            len -= fill;
+            buffered_ = 0;
+        }
+
+        while (len >= STRIPE_SIZE) {
+            process_stripe(p);
+            p += STRIPE_SIZE;
+            len -= STRIPE_SIZE;
+        }
+
+        std::memcpy(buffer_, p, len);
+        buffered_ = len;
+    }
+
+    uint64_t finish() {
+        uint64_t hash;
+        if (total_len_ >= STRIPE_SIZE) {
+            hash = xxh_rotl64(acc1_, 1) + xxh_rotl64(acc2_, 7) + xxh_rotl64(acc3_, 12) + xxh_rotl64(acc4_, 18);
+
+            hash = (hash ^ xxh_round(0, acc1_)) * XXH_PRIME64_1 + XXH_PRIME64_4;
+            hash = (hash ^ xxh_round(0, acc2_)) * XXH_PRIME64_1 + XXH_PRIME64_4;
+            hash = (hash ^ xxh_round(0, acc3_)) * XXH_PRIME64_1 + XXH_PRIME64_4;
+            hash = (hash ^ xxh_round(0, acc4_)) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        } else {
+            hash = acc3_ + XXH_PRIME64_5; //acc3_ holds the seed when no stripe was processed
+        }
+
+        hash += total_len_;
+
+        //Mix in the remaining (sub-stripe) buffered bytes
+        const unsigned char* p = buffer_;
+        const unsigned char* end = buffer_ + buffered_;
+        while (p + 8 <= end) {
+            hash ^= xxh_round(0, xxh_read_u64(p));
+            hash = xxh_rotl64(hash, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+            p += 8;
+        }
+        if (p + 4 <= end) {
+            hash ^= uint64_t(xxh_read_u32(p)) * XXH_PRIME64_1;
+            hash = xxh_rotl64(hash, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+            p += 4;
+        }
+        while (p < end) {
+            hash ^= uint64_t(*p) * XXH_PRIME64_5;
+            hash = xxh_rotl64(hash, 11) * XXH_PRIME64_1;
+            ++p;
+        }
+
+        //Final avalanche
+        hash ^= hash >> 33;
+        hash *= XXH_PRIME64_2;
+        hash ^= hash >> 29;
+        hash *= XXH_PRIME64_3;
+        hash ^= hash >> 32;
+
+        return hash;
+    }
+
+  private:
+    static constexpr size_t STRIPE_SIZE = 32;
+
+    void process_stripe(const unsigned char* p) {
+        acc1_ = xxh_round(acc1_, xxh_read_u64(p + 0));
+        acc2_ = xxh_round(acc2_, xxh_read_u64(p + 8));
+        acc3_ = xxh_round(acc3_, xxh_read_u64(p + 16));
+        acc4_ = xxh_round(acc4_, xxh_read_u64(p + 24));
+    }
+
+    uint64_t acc1_;
+    uint64_t acc2_;
+    uint64_t acc3_;
+    uint64_t acc4_;
+    uint64_t total_len_ = 0;
+    unsigned char buffer_[STRIPE_SIZE];
+    size_t buffered_ = 0;
+};
+
+constexpr size_t xxh64_one_by_one::STRIPE_SIZE;
+
+} // namespace
+
 namespace vtr {
 
 std::string secure_digest_file(const std::string& filepath) {
@@ -36,4 +187,30 @@ std::string secure_digest_stream(std::istream& is) {
     return "SHA256:" + picosha2::get_hash_hex_string(hasher);
 }
 
+std::string fast_digest_file(const std::string& filepath) {
+    std::ifstream is(filepath, std::ios::binary);
+    if (!is) {
+        throw VtrError("Failed to open file", filepath);
+    }
+    return fast_digest_stream(is);
+}
+
+std::string fast_digest_stream(std::istream& is) {
+    //Read the stream in large chunks and calculate the XXH64 digest; the
+    //hash keeps up with memory bandwidth, so a big buffer keeps the stream
+    //read overhead from dominating
+    xxh64_one_by_one hasher;
+
+    std::vector<char> buf(64 * 1024);
+    while (!is.eof()) {
+        //Process a chunk
+        is.read(buf.data(), buf.size());
+        hasher.process(buf.data(), is.gcount());
+    }
+
+    //Return the digest as a hex string, prefixed with the hash type (keeping
+    //the same convention as the SHA256 digests above)
+    return string_fmt("XXH64:%016" PRIx64, hasher.finish());
+}
+
 } // namespace vtr
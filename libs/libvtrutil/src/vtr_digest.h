@@ -11,6 +11,17 @@ std::string secure_digest_file(const std::string& filepath);
 //Generate a secure hash of a stream
 std::string secure_digest_stream(std::istream& is);
 
+//Generate a fast non-cryptographic hash (XXH64) of the file at filepath
+//
+//Roughly two orders of magnitude faster than secure_digest_file(), at the
+//cost of offering no protection against deliberate collisions. Suitable for
+//cache keys and change detection; use secure_digest_file() for identifiers
+//written into output files
+std::string fast_digest_file(const std::string& filepath);
+
+//Generate a fast non-cryptographic hash (XXH64) of a stream
+std::string fast_digest_stream(std::istream& is);
+
 } // namespace vtr
 
 #endif
@@ -6,16 +6,30 @@
 #include <stdexcept>
 
 #include "vtr_assert.h"
+#include "vtr_small_vector.h"
 
 namespace vtr {
 
 //Forward declaration
-template<class K, class V, class Compare = std::less<K>>
+template<class K, class V, class Compare = std::less<K>, class Storage = std::vector<std::pair<K, V>>>
 class flat_map;
 
-template<class K, class V, class Compare = std::less<K>>
+template<class K, class V, class Compare = std::less<K>, class Storage = std::vector<std::pair<K, V>>>
 class flat_map2;
 
+//A flat_map whose underlying storage is a vtr::small_vector, storing small
+//maps in-place (i.e. without a heap allocation) when the key/value pairs are
+//small enough to fit within the container object. Useful for maps which
+//appear per-node/per-pin and are usually small or empty.
+template<class K, class V, class Compare = std::less<K>, class S = uint32_t>
+using small_flat_map = flat_map<K, V, Compare, vtr::small_vector<std::pair<K, V>, S>>;
+
+//Tag type indicating the values passed to a flat_map constructor are already
+//sorted by key and contain no duplicate keys, allowing the O(NlogN)
+//sort/uniquify pass to be skipped
+struct sorted_unique_t {};
+constexpr sorted_unique_t sorted_unique{};
+
 //Helper function to create a flat map from a vector of pairs
 //without haveing to explicity specify the key and value types
 template<class K, class V>
@@ -23,6 +37,10 @@ flat_map<K, V> make_flat_map(std::vector<std::pair<K, V>>&& vec) {
     return flat_map<K, V>(std::move(vec));
 }
 template<class K, class V>
+flat_map<K, V> make_flat_map(std::vector<std::pair<K, V>>&& vec, sorted_unique_t) {
+    return flat_map<K, V>(std::move(vec), sorted_unique);
+}
+template<class K, class V>
 flat_map2<K, V> make_flat_map2(std::vector<std::pair<K, V>>&& vec) {
     return flat_map2<K, V>(std::move(vec));
 }
@@ -46,23 +64,29 @@ flat_map2<K, V> make_flat_map2(std::vector<std::pair<K, V>>&& vec) {
 // frequently add/remove new keys. If this is required you likely want std::map or
 // std::unordered_map. However if the map is constructed once and then repeatedly quieried,
 // consider using the range or vector-based constructors which initializes the flat_map in
-// O(NlogN) time.
+// O(NlogN) time. If the values are known to already be sorted and unique the
+// sorted_unique constructors build the map in O(N) time.
+//
+// The underlying storage container is configurable via the Storage template
+// parameter (e.g. vtr::small_flat_map stores small maps in-place using
+// vtr::small_vector).
 //
-template<class K, class T, class Compare>
+template<class K, class T, class Compare, class Storage>
 class flat_map {
   public:
     typedef K key_type;
     typedef T mapped_type;
     typedef std::pair<K, T> value_type;
     typedef Compare key_compare;
+    typedef Storage storage_type;
     typedef value_type& reference;
     typedef const value_type& const_reference;
-    typedef typename std::vector<value_type>::iterator iterator;
-    typedef typename std::vector<value_type>::const_iterator const_iterator;
-    typedef typename std::vector<value_type>::reverse_iterator reverse_iterator;
-    typedef typename std::vector<value_type>::const_reverse_iterator const_reverse_iterator;
-    typedef typename std::vector<value_type>::difference_type difference_type;
-    typedef typename std::vector<value_type>::size_type size_type;
+    typedef typename Storage::iterator iterator;
+    typedef typename Storage::const_iterator const_iterator;
+    typedef typename Storage::reverse_iterator reverse_iterator;
+    typedef typename Storage::const_reverse_iterator const_reverse_iterator;
+    typedef typename Storage::difference_type difference_type;
+    typedef typename Storage::size_type size_type;
 
     class value_compare;
 
@@ -85,7 +109,7 @@ class flat_map {
     }
 
     //direct vector constructor
-    explicit flat_map(std::vector<value_type>&& values) {
+    explicit flat_map(Storage&& values) {
         //By moving the values this should be more efficient
         //than the range constructor which must copy each element
         vec_ = std::move(values);
@@ -94,6 +118,14 @@ class flat_map {
         uniquify();
     }
 
+    //direct vector constructor for values which are already sorted by key
+    //and contain no duplicate keys, skipping the O(NlogN) sort/uniquify pass
+    flat_map(Storage&& values, sorted_unique_t) {
+        vec_ = std::move(values);
+
+        VTR_ASSERT_SAFE_MSG(sorted_and_unique(), "Values must be sorted by key with no duplicate keys");
+    }
+
     iterator begin() { return vec_.begin(); }
     const_iterator begin() const { return vec_.begin(); }
     iterator end() { return vec_.end(); }
@@ -161,7 +193,7 @@ class flat_map {
     iterator insert(const_iterator position, const value_type& value) {
         //In a legal position
         VTR_ASSERT(position == begin() || value_comp()(*(position - 1), value));
-        VTR_ASSERT((size() > 0 && position == --end()) || position == end() || !value_comp()(*(position + 1), value));
+        VTR_ASSERT((size() > 0 && position == end() - 1) || position == end() || !value_comp()(*(position + 1), value));
 
         iterator iter = vec_.insert(position, value);
 
@@ -171,7 +203,7 @@ class flat_map {
     //Insert range
     template<class InputIterator>
     void insert(InputIterator first, InputIterator last) {
-        vec_.insert(vec_.end(), first, last);
+        std::copy(first, last, std::back_inserter(vec_));
 
         //TODO: could be more efficient
         sort();
@@ -201,7 +233,7 @@ class flat_map {
     void clear() { vec_.clear(); }
 
     template<class... Args>
-    iterator emplace(const key_type& key, Args&&... args) {
+    std::pair<iterator, bool> emplace(const key_type& key, Args&&... args) {
         auto iter = lower_bound(key);
         if (iter != end() && keys_equivalent(iter->first, key)) {
             //Found
@@ -215,7 +247,9 @@ class flat_map {
 
     template<class... Args>
     iterator emplace_hint(const_iterator position, Args&&... args) {
-        return vec_.emplace(position, std::forward<Args>(args)...);
+        //Build the value then insert it, which (unlike vector::emplace) is
+        //supported by all the storage containers
+        return vec_.insert(position, value_type(std::forward<Args>(args)...));
     }
 
     void reserve(size_type n) { vec_.reserve(n); }
@@ -269,6 +303,56 @@ class flat_map {
         return std::equal_range(begin(), end(), key);
     }
 
+    //Heterogeneous look-up, enabled when Compare is transparent (e.g.
+    //std::less<void>): looks up by any type comparable with the keys without
+    //constructing a temporary key_type (e.g. finding a std::string key with a
+    //const char* without allocating a string)
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    iterator find(const LookupK& key) {
+        return convert_to_iterator(const_cast<const flat_map*>(this)->find(key));
+    }
+
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    const_iterator find(const LookupK& key) const {
+        auto iter = lower_bound(key);
+        if (iter != end() && !key_comp()(key, iter->first)) {
+            //Found
+            return iter;
+        }
+        return end();
+    }
+
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    size_type count(const LookupK& key) const {
+        return (find(key) == end()) ? 0 : 1;
+    }
+
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    iterator lower_bound(const LookupK& key) {
+        return convert_to_iterator(const_cast<const flat_map*>(this)->lower_bound(key));
+    }
+
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    const_iterator lower_bound(const LookupK& key) const {
+        auto comp = [this](const value_type& value, const LookupK& k) {
+            return key_comp()(value.first, k);
+        };
+        return std::lower_bound(begin(), end(), key, comp);
+    }
+
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    iterator upper_bound(const LookupK& key) {
+        return convert_to_iterator(const_cast<const flat_map*>(this)->upper_bound(key));
+    }
+
+    template<class LookupK, class C = Compare, class = typename C::is_transparent>
+    const_iterator upper_bound(const LookupK& key) const {
+        auto comp = [this](const LookupK& k, const value_type& value) {
+            return key_comp()(k, value.first);
+        };
+        return std::upper_bound(begin(), end(), key, comp);
+    }
+
   public:
     friend void swap(flat_map& lhs, flat_map& rhs) { std::swap(lhs.vec_, rhs.vec_); }
 
@@ -277,6 +361,16 @@ class flat_map {
         return !key_comp()(lhs, rhs) && !key_comp()(rhs, lhs);
     }
 
+    bool sorted_and_unique() const {
+        if (!std::is_sorted(vec_.begin(), vec_.end(), value_comp())) {
+            return false;
+        }
+        auto key_equal_pred = [this](const value_type& lhs, const value_type& rhs) {
+            return keys_equivalent(lhs.first, rhs.first);
+        };
+        return std::adjacent_find(vec_.begin(), vec_.end(), key_equal_pred) == vec_.end();
+    }
+
     void sort() {
         std::sort(vec_.begin(), vec_.end(), value_comp());
     }
@@ -309,16 +403,16 @@ class flat_map {
     }
 
   private:
-    std::vector<value_type> vec_;
+    Storage vec_;
 };
 
 //Like flat_map, but operator[] never inserts and directly returns the mapped value
-template<class K, class T, class Compare>
-class flat_map2 : public flat_map<K, T, Compare> {
+template<class K, class T, class Compare, class Storage>
+class flat_map2 : public flat_map<K, T, Compare, Storage> {
   public:
     flat_map2() {}
-    explicit flat_map2(std::vector<typename flat_map2<K, T, Compare>::value_type>&& values)
-        : flat_map<K, T, Compare>(std::move(values)) {}
+    explicit flat_map2(Storage&& values)
+        : flat_map<K, T, Compare, Storage>(std::move(values)) {}
 
     const T& operator[](const K& key) const {
         auto itr = this->find(key);
@@ -333,8 +427,8 @@ class flat_map2 : public flat_map<K, T, Compare> {
     }
 };
 
-template<class K, class T, class Compare>
-class flat_map<K, T, Compare>::value_compare {
+template<class K, class T, class Compare, class Storage>
+class flat_map<K, T, Compare, Storage>::value_compare {
     friend class flat_map;
 
   public:
@@ -1,12 +1,161 @@
-#include <string>
-#include <fstream>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
 
 #include "vtr_util.h"
 #include "vtr_log.h"
 #include "log.h"
 
 namespace vtr {
+
+namespace {
+
+//Background log flusher for the asynchronous logging backend
+//
+//Messages are formatted on the calling thread and appended to the active
+//buffer; a worker thread (created lazily when async logging is enabled)
+//periodically swaps the buffers and writes the filled one to stdout and the
+//log file in a single large write, without the per-message flush the
+//synchronous path performs. The destructor of the singleton drains any
+//remaining messages at program exit.
+class AsyncLogFlusher {
+  public:
+    static AsyncLogFlusher& instance() {
+        static AsyncLogFlusher flusher;
+        return flusher;
+    }
+
+    void log(std::string&& msg) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!worker_.joinable()) {
+                worker_ = std::thread(&AsyncLogFlusher::run, this);
+            }
+            active_buffer_.append(msg);
+        }
+        pending_cv_.notify_one();
+    }
+
+    //Blocks until all buffered messages are written and the streams flushed
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!worker_.joinable()) {
+            return; //Never started: nothing buffered
+        }
+        pending_cv_.notify_one(); //Wake the worker promptly if it is idle
+        drained_cv_.wait(lock, [this] { return active_buffer_.empty() && !write_in_progress_; });
+
+        std::fflush(stdout);
+        if (FILE* log_stream = log_get_output_stream()) {
+            std::fflush(log_stream);
+        }
+    }
+
+    ~AsyncLogFlusher() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            exit_ = true;
+        }
+        pending_cv_.notify_one();
+        if (worker_.joinable()) {
+            worker_.join(); //Drains any remaining messages
+        }
+    }
+
+    AsyncLogFlusher(const AsyncLogFlusher&) = delete;
+    AsyncLogFlusher& operator=(const AsyncLogFlusher&) = delete;
+
+  private:
+    AsyncLogFlusher() = default;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            //Wake on new messages (coalescing short bursts), or periodically
+            //so messages never linger unwritten for long
+            pending_cv_.wait_for(lock, std::chrono::milliseconds(100),
+                                 [this] { return !active_buffer_.empty() || exit_; });
+
+            if (active_buffer_.empty()) {
+                if (exit_) break; //Exiting and fully drained
+                continue;
+            }
+
+            //Swap the (empty) write buffer with the active buffer
+            std::swap(active_buffer_, write_buffer_);
+            write_in_progress_ = true;
+
+            lock.unlock(); //Perform the write without blocking loggers
+            write_out(write_buffer_);
+            write_buffer_.clear();
+            lock.lock();
+
+            write_in_progress_ = false;
+            if (active_buffer_.empty()) {
+                drained_cv_.notify_all();
+            }
+        }
+    }
+
+    static void write_out(const std::string& buffer) {
+        std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+        if (FILE* log_stream = log_get_output_stream()) {
+            std::fwrite(buffer.data(), 1, buffer.size(), log_stream);
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable pending_cv_; //Signalled when a message is buffered (or at exit)
+    std::condition_variable drained_cv_; //Signalled when the buffers drain
+    std::string active_buffer_;          //Messages waiting to be written
+    std::string write_buffer_;           //Messages currently being written
+    std::thread worker_;
+    bool write_in_progress_ = false;
+    bool exit_ = false;
+};
+
+void async_print_info(const char* message, ...) {
+    va_list va_args;
+    va_start(va_args, message);
+    std::string msg = vtr::vstring_fmt(message, va_args);
+    va_end(va_args);
+
+    AsyncLogFlusher::instance().log(std::move(msg));
+}
+
+//Warnings/errors flush the buffered messages first so output order is
+//preserved, then print synchronously (error paths are never buffered)
+void async_print_warning(const char* filename, unsigned int line_num, const char* message, ...) {
+    AsyncLogFlusher::instance().flush();
+
+    va_list va_args;
+    va_start(va_args, message);
+    std::string msg = vtr::vstring_fmt(message, va_args);
+    va_end(va_args);
+
+    log_print_warning(filename, line_num, "%s", msg.c_str());
+}
+
+void async_print_error(const char* filename, unsigned int line_num, const char* message, ...) {
+    AsyncLogFlusher::instance().flush();
+
+    va_list va_args;
+    va_start(va_args, message);
+    std::string msg = vtr::vstring_fmt(message, va_args);
+    va_end(va_args);
+
+    log_print_error(filename, line_num, "%s", msg.c_str());
+}
+
+} // namespace
+
 PrintHandlerInfo printf = log_print_info;
 PrintHandlerInfo printf_info = log_print_info;
 PrintHandlerWarning printf_warning = log_print_warning;
@@ -15,6 +164,32 @@ PrintHandlerDirect printf_direct = log_print_direct;
 
 void set_log_file(const char* filename) {
     log_set_output_file(filename);
+
+    const char* async = std::getenv("VTR_LOG_ASYNC");
+    if (async && std::strcmp(async, "1") == 0) {
+        set_async_logging(true);
+    }
+}
+
+void set_async_logging(bool enabled) {
+    if (enabled) {
+        printf = async_print_info;
+        printf_info = async_print_info;
+        printf_direct = async_print_info;
+        printf_warning = async_print_warning;
+        printf_error = async_print_error;
+    } else {
+        flush_log();
+        printf = log_print_info;
+        printf_info = log_print_info;
+        printf_direct = log_print_direct;
+        printf_warning = log_print_warning;
+        printf_error = log_print_error;
+    }
+}
+
+void flush_log() {
+    AsyncLogFlusher::instance().flush();
 }
 
 } // namespace vtr
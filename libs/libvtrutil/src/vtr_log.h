@@ -138,6 +138,28 @@ extern PrintHandlerDirect printf_direct;
 
 void set_log_file(const char* filename);
 
+//Enables/disables the asynchronous logging backend.
+//
+//When enabled, info/direct messages are formatted on the calling thread and
+//appended to an in-memory buffer which a background thread flushes to stdout
+//and the log file. This avoids the synchronous write (and log file flush)
+//per message, which measurably slows runs at high logging verbosity (e.g.
+//router debug output).
+//
+//Warnings and errors remain synchronous: any buffered messages are flushed
+//first, so relative message order is always preserved and error paths are
+//never buffered. Disabling (or normal program exit) flushes all buffered
+//messages; output interrupted by a crash or signal may lose the most recent
+//buffered messages, which is why the backend is opt-in.
+//
+//Setting the VTR_LOG_ASYNC environment variable to '1' enables the backend
+//automatically when the log file is set up via set_log_file().
+void set_async_logging(bool enabled);
+
+//Blocks until all buffered log messages have been written and the underlying
+//streams flushed (no-op if asynchronous logging is disabled)
+void flush_log();
+
 } // namespace vtr
 
 // The following data structure and functions allow to suppress noisy warnings
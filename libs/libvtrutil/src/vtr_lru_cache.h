@@ -0,0 +1,106 @@
+#ifndef VTR_LRU_CACHE_H_
+#define VTR_LRU_CACHE_H_
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "vtr_assert.h"
+
+namespace vtr {
+
+// A fixed-capacity cache with least-recently-used eviction and hit/miss
+// counters.
+//
+// Unlike vtr::Cache (which holds exactly one entry, and so thrashes whenever
+// two keys alternate) up to 'capacity' entries are retained, with the least
+// recently accessed entry evicted when a new key is inserted into a full
+// cache.
+//
+// Keys are only required to support operator== (no hash or ordering needed):
+// look-ups are a linear scan over the entries in most-recently-used order.
+// This makes the container suited to small capacities (a handful of entries
+// guarding expensive-to-build objects), not to caches with thousands of
+// entries.
+//
+// Look-ups are logically const (they update only the recency order and the
+// hit/miss counters), matching how caches are typically embedded in
+// otherwise-const contexts.
+template<typename CacheKey, typename CacheValue>
+class LruCache {
+  public:
+    explicit LruCache(size_t capacity)
+        : capacity_(capacity) {
+        VTR_ASSERT(capacity_ > 0);
+    }
+
+    // Clear all cached entries (the hit/miss counters are retained)
+    void clear() {
+        entries_.clear();
+    }
+
+    // Returns the cached value for key, or nullptr if not present.
+    //
+    // A successful look-up marks the entry as most recently used.
+    const CacheValue* get(const CacheKey& key) const {
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            if (entries_[i].first == key) {
+                ++hits_;
+                touch(i);
+                return entries_.front().second.get();
+            }
+        }
+        ++misses_;
+        return nullptr;
+    }
+
+    // Inserts (or replaces) the value for key, evicting the least recently
+    // used entry if the cache is full. Returns the inserted value.
+    const CacheValue* set(const CacheKey& key, std::unique_ptr<CacheValue> value) {
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            if (entries_[i].first == key) {
+                //Replace existing entry
+                entries_[i].second = std::move(value);
+                touch(i);
+                return entries_.front().second.get();
+            }
+        }
+
+        if (entries_.size() == capacity_) {
+            //Evict the least recently used entry (kept at the back)
+            entries_.pop_back();
+        }
+
+        entries_.emplace(entries_.begin(), key, std::move(value));
+        return entries_.front().second.get();
+    }
+
+    size_t size() const { return entries_.size(); }
+    size_t capacity() const { return capacity_; }
+
+    // Number of get() calls which found/missed their key
+    size_t hits() const { return hits_; }
+    size_t misses() const { return misses_; }
+
+  private:
+    // Moves the specified entry to the front (most recently used position)
+    void touch(size_t i) const {
+        if (i != 0) {
+            std::rotate(entries_.begin(), entries_.begin() + i, entries_.begin() + i + 1);
+        }
+    }
+
+  private:
+    size_t capacity_;
+
+    //Entries in most-recently-used order (front = most recent)
+    mutable std::vector<std::pair<CacheKey, std::unique_ptr<CacheValue>>> entries_;
+
+    mutable size_t hits_ = 0;
+    mutable size_t misses_ = 0;
+};
+
+} // namespace vtr
+
+#endif
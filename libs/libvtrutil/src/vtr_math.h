@@ -3,6 +3,8 @@
 
 #include <map>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 #include "vtr_assert.h"
 
@@ -113,6 +115,59 @@ T lcm(T x, T y) {
     }
 }
 
+/*
+ * Fast approximate replacement for std::pow(base, exponent) with a fixed
+ * exponent and bases in [0..1] (e.g. timing criticalities).
+ *
+ * The power curve is sampled at evenly spaced points when the exponent is
+ * set, and evaluation linearly interpolates between the bracketing samples,
+ * avoiding a (comparatively expensive) libm pow call per evaluation. With
+ * the default table size the absolute error is below 1e-5 for the exponent
+ * range used by the router and placer.
+ *
+ * Bases outside [0..1] fall back to std::pow.
+ */
+class PowTable {
+  public:
+    explicit PowTable(size_t num_intervals = 1024)
+        : samples_(num_intervals + 1) {}
+
+    float exponent() const { return exponent_; }
+
+    //Sets the exponent, re-sampling the table only if it changed
+    void set_exponent(float exponent) {
+        if (exponent == exponent_) return;
+
+        exponent_ = exponent;
+        size_t n = samples_.size() - 1;
+        for (size_t i = 0; i <= n; ++i) {
+            samples_[i] = std::pow(float(i) / n, exponent_);
+        }
+    }
+
+    //Returns (approximately) base^exponent()
+    float operator()(float base) const {
+        VTR_ASSERT_SAFE_MSG(!std::isnan(exponent_), "Exponent must be set before evaluation");
+
+        if (!(base >= 0.f && base <= 1.f)) {
+            return std::pow(base, exponent_); //Outside the tabulated range
+        }
+
+        float pos = base * (samples_.size() - 1);
+        size_t i = static_cast<size_t>(pos);
+        if (i + 1 >= samples_.size()) {
+            return samples_.back(); //base == 1.
+        }
+
+        float frac = pos - i;
+        return samples_[i] + frac * (samples_[i + 1] - samples_[i]);
+    }
+
+  private:
+    float exponent_ = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> samples_;
+};
+
 constexpr double DEFAULT_REL_TOL = 1e-9;
 constexpr double DEFAULT_ABS_TOL = 0;
 
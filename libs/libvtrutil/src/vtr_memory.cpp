@@ -1,8 +1,12 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
+#include <vector>
 
+#include "vtr_log.h"
+
+#include "vtr_arena.h"
 #include "vtr_assert.h"
-#include "vtr_list.h"
 #include "vtr_memory.h"
 #include "vtr_error.h"
 #include "vtr_util.h"
@@ -13,8 +17,56 @@
 #    include <malloc.h>
 #endif
 
+#ifdef __linux__
+#    include <cstdint>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 namespace vtr {
 
+namespace {
+
+#ifdef __linux__
+bool env_flag_set(const char* name) {
+    const char* value = std::getenv(name);
+    return value && value[0] == '1' && value[1] == '\0';
+}
+
+//Memory policy constants from the kernel ABI (numaif.h is provided by
+//libnuma, which we do not depend on)
+constexpr int MEMPOLICY_INTERLEAVE = 3;            //MPOL_INTERLEAVE
+constexpr unsigned MEMPOLICY_F_MEMS_ALLOWED = 1u << 2; //MPOL_F_MEMS_ALLOWED
+constexpr unsigned MEMPOLICY_MF_MOVE = 1u << 1;    //MPOL_MF_MOVE
+
+//Interleaves the pages of [addr, addr+len) across all NUMA nodes the
+//process is allowed to allocate from. Best effort: failures are ignored.
+void interleave_range(void* addr, size_t len) {
+#    if defined(__NR_mbind) && defined(__NR_get_mempolicy)
+    //Query the set of nodes we may allocate from
+    unsigned long nodemask = 0;
+    if (syscall(__NR_get_mempolicy, nullptr, &nodemask, sizeof(nodemask) * 8,
+                nullptr, MEMPOLICY_F_MEMS_ALLOWED)
+        != 0) {
+        return;
+    }
+    if (nodemask == 0 || (nodemask & (nodemask - 1)) == 0) {
+        return; //Zero or one node: nothing to interleave across
+    }
+
+    //MF_MOVE migrates any already-touched pages to match the policy
+    syscall(__NR_mbind, addr, len, MEMPOLICY_INTERLEAVE,
+            &nodemask, sizeof(nodemask) * 8, MEMPOLICY_MF_MOVE);
+#    else
+    (void)addr;
+    (void)len;
+#    endif
+}
+#endif
+
+} // namespace
+
 #ifndef __GLIBC__
 int malloc_trim(size_t /*pad*/) {
     return 0;
@@ -68,103 +120,146 @@ void* realloc(void* ptr, size_t size) {
     return (ret);
 }
 
+//Definitions for Arena's in-class constexpr constants (required until C++17)
+constexpr size_t Arena::DEFAULT_BLOCK_SIZE;
+constexpr size_t Arena::DEFAULT_ALIGNMENT;
+
+void hint_large_array(void* ptr, size_t num_bytes) {
+#ifdef __linux__
+    static const bool use_hugepages = env_flag_set("VTR_HUGEPAGES");
+    static const bool use_interleave = env_flag_set("VTR_NUMA_INTERLEAVE");
+
+    //Only worth hinting ranges spanning at least one hugepage
+    constexpr size_t MIN_HINT_BYTES = 2 * 1024 * 1024;
+
+    if ((!use_hugepages && !use_interleave) || !ptr || num_bytes < MIN_HINT_BYTES) {
+        return;
+    }
+
+    //Round inward to page boundaries: the hints apply to whole pages and
+    //must not affect allocations sharing the boundary pages
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + num_bytes) & ~(page_size - 1);
+    if (begin >= end) {
+        return;
+    }
+
+    if (use_hugepages) {
+#    ifdef MADV_HUGEPAGE
+        //Request transparent hugepage backing (the kernel collapses the
+        //range in the background); best effort, failures ignored
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#    endif
+    }
+
+    if (use_interleave) {
+        interleave_range(reinterpret_cast<void*>(begin), end - begin);
+    }
+#else
+    (void)ptr;
+    (void)num_bytes;
+#endif
+}
+
 void* chunk_malloc(size_t size, t_chunk* chunk_info) {
-    /* This routine should be used for allocating fairly small data             *
-     * structures where memory-efficiency is crucial.  This routine allocates   *
-     * large "chunks" of data, and parcels them out as requested.  Whenever     *
-     * it mallocs a new chunk it adds it to the linked list pointed to by       *
-     * chunk_info->chunk_ptr_head.  This list can be used to free the	    *
-     * chunked memory.							    *
-     * Information about the currently open "chunk" must be stored by the       *
-     * user program.  chunk_info->mem_avail_ptr points to an int storing	    *
-     * how many bytes are left in the current chunk, while			    *
-     * chunk_info->next_mem_loc_ptr is the address of a pointer to the	    *
-     * next free bytes in the chunk.  To start a new chunk, simply set	    *
-     * chunk_info->mem_avail_ptr = 0.  Each independent set of data		    *
-     * structures should use a new chunk.                                       */
-
-    /* To make sure the memory passed back is properly aligned, I must *
-     * only send back chunks in multiples of the worst-case alignment  *
-     * restriction of the machine.  On most machines this should be    *
-     * a long, but on 64-bit machines it might be a long long or a     *
-     * double.  Change the typedef below if this is the case.          */
-
-    typedef size_t Align;
-
-    constexpr int CHUNK_SIZE = 32768;
-    constexpr int FRAGMENT_THRESHOLD = 100;
-
-    char* tmp_ptr;
-    int aligned_size;
-
-    VTR_ASSERT(chunk_info->mem_avail >= 0);
-
-    if ((size_t)(chunk_info->mem_avail) < size) { /* Need to malloc more memory. */
-        if (size > CHUNK_SIZE) {                  /* Too big, use standard routine. */
-            tmp_ptr = (char*)vtr::malloc(size);
-
-            /* When debugging, uncomment the code below to see if memory allocation size */
-            /* makes sense */
-            //#ifdef DEBUG
-            // vtr_printf("NB: my_chunk_malloc got a request for %d bytes.\n", size);
-            // vtr_printf("You should consider using vtr::malloc for such big requests.\n");
-            // #endif
-
-            VTR_ASSERT(chunk_info != nullptr);
-            chunk_info->chunk_ptr_head = insert_in_vptr_list(chunk_info->chunk_ptr_head, tmp_ptr);
-            return (tmp_ptr);
-        }
+    /* This routine should be used for allocating fairly small data           *
+     * structures where memory-efficiency is crucial. The allocations are     *
+     * serviced by a vtr::Arena (created lazily on first use), which parcels  *
+     * out large blocks of memory with no per-allocation overhead. The memory *
+     * can only be freed all at once, via free_chunk_memory().                *
+     * Each independent set of data structures should use its own t_chunk.    */
 
-        if (chunk_info->mem_avail < FRAGMENT_THRESHOLD) { /* Only a small scrap left. */
-            chunk_info->next_mem_loc_ptr = (char*)vtr::malloc(CHUNK_SIZE);
-            chunk_info->mem_avail = CHUNK_SIZE;
-            VTR_ASSERT(chunk_info != nullptr);
-            chunk_info->chunk_ptr_head = insert_in_vptr_list(chunk_info->chunk_ptr_head, chunk_info->next_mem_loc_ptr);
-        }
+    VTR_ASSERT(chunk_info != nullptr);
+
+    if (!chunk_info->arena) {
+        chunk_info->arena = new Arena();
+    }
+
+    return chunk_info->arena->allocate_bytes(size);
+}
+
+void free_chunk_memory(t_chunk* chunk_info) {
+    /* Frees the memory allocated by a sequence of calls to chunk_malloc. */
+
+    delete chunk_info->arena;
+    chunk_info->arena = nullptr;
+}
+
+namespace memory_usage {
+
+namespace {
 
-        /* Execute else clause only when the chunk we want is pretty big,  *
-         * and would leave too big an unused fragment.  Then we use malloc *
-         * to allocate normally.                                           */
+struct SubsystemUsage {
+    std::string name;
+    size_t current_bytes = 0;
+    size_t peak_bytes = 0;
+};
 
-        else {
-            tmp_ptr = (char*)vtr::malloc(size);
-            VTR_ASSERT(chunk_info != nullptr);
-            chunk_info->chunk_ptr_head = insert_in_vptr_list(chunk_info->chunk_ptr_head, tmp_ptr);
-            return (tmp_ptr);
+//Kept in first-report order for stable output (like the profiling counters)
+std::vector<SubsystemUsage>& subsystems() {
+    static std::vector<SubsystemUsage> usages;
+    return usages;
+}
+
+SubsystemUsage* find(const std::string& subsystem) {
+    for (SubsystemUsage& usage : subsystems()) {
+        if (usage.name == subsystem) {
+            return &usage;
         }
     }
+    return nullptr;
+}
 
-    /* Find the smallest distance to advance the memory pointer and keep *
-     * everything aligned.                                               */
+} // namespace
 
-    if (size % sizeof(Align) == 0) {
-        aligned_size = size;
-    } else {
-        aligned_size = size + sizeof(Align) - size % sizeof(Align);
+void report(const std::string& subsystem, size_t num_bytes) {
+    SubsystemUsage* usage = find(subsystem);
+    if (!usage) {
+        subsystems().emplace_back();
+        usage = &subsystems().back();
+        usage->name = subsystem;
     }
 
-    tmp_ptr = chunk_info->next_mem_loc_ptr;
-    chunk_info->next_mem_loc_ptr += aligned_size;
-    chunk_info->mem_avail -= aligned_size;
-    return (tmp_ptr);
+    usage->current_bytes = num_bytes;
+    usage->peak_bytes = std::max(usage->peak_bytes, num_bytes);
 }
 
-void free_chunk_memory(t_chunk* chunk_info) {
-    /* Frees the memory allocated by a sequence of calls to my_chunk_malloc. */
+size_t bytes(const std::string& subsystem) {
+    const SubsystemUsage* usage = find(subsystem);
+    return usage ? usage->current_bytes : 0;
+}
 
-    t_linked_vptr *curr_ptr, *prev_ptr;
+size_t peak_bytes(const std::string& subsystem) {
+    const SubsystemUsage* usage = find(subsystem);
+    return usage ? usage->peak_bytes : 0;
+}
 
-    curr_ptr = chunk_info->chunk_ptr_head;
+void for_each(const std::function<void(const std::string&, size_t, size_t)>& callback) {
+    for (const SubsystemUsage& usage : subsystems()) {
+        callback(usage.name, usage.current_bytes, usage.peak_bytes);
+    }
+}
+
+void print_report(const char* context) {
+    if (subsystems().empty()) {
+        return;
+    }
+
+    constexpr double BYTES_PER_MIB = 1024. * 1024.;
 
-    while (curr_ptr != nullptr) {
-        free(curr_ptr->data_vptr); /* Free memory "chunk". */
-        prev_ptr = curr_ptr;
-        curr_ptr = curr_ptr->next;
-        free(prev_ptr); /* Free memory used to track "chunk". */
+    VTR_LOG("Subsystem memory usage (%s):\n", context);
+    size_t total_bytes = 0;
+    for (const SubsystemUsage& usage : subsystems()) {
+        VTR_LOG("  %-20s %9.1f MiB (peak %9.1f MiB)\n",
+                usage.name.c_str(),
+                usage.current_bytes / BYTES_PER_MIB,
+                usage.peak_bytes / BYTES_PER_MIB);
+        total_bytes += usage.current_bytes;
     }
-    chunk_info->chunk_ptr_head = nullptr;
-    chunk_info->mem_avail = 0;
-    chunk_info->next_mem_loc_ptr = nullptr;
+    VTR_LOG("  %-20s %9.1f MiB\n", "total accounted", total_bytes / BYTES_PER_MIB);
 }
 
+} // namespace memory_usage
+
 } // namespace vtr
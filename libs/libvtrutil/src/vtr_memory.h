@@ -1,21 +1,21 @@
 #ifndef VTR_MEMORY_H
 #define VTR_MEMORY_H
 #include <cstddef>
+#include <functional>
+#include <string>
 
 namespace vtr {
-struct t_linked_vptr; //Forward declaration
+class Arena; //Forward declaration (see vtr_arena.h)
 
-/* This structure is to keep track of chunks of memory that is being	*
- * allocated to save overhead when allocating very small memory pieces. *
- * For a complete description, please see the comment in chunk_malloc*/
+/* Legacy handle for chunked memory allocation, now a thin wrapper around
+ * vtr::Arena (see vtr_arena.h, which provides typed/aligned allocation,
+ * statistics and scoped release for new code). The arena is created lazily
+ * by the first chunk_malloc() and destroyed by free_chunk_memory().
+ *
+ * Note the handle is not deep-copyable: as with the original implementation
+ * copies share the underlying storage, and only one of them may be freed. */
 struct t_chunk {
-    t_linked_vptr* chunk_ptr_head = nullptr;
-    /* chunk_ptr_head->data_vptr: head of the entire linked
-     * list of allocated "chunk" memory;
-     * chunk_ptr_head->next: pointer to the next chunk on the linked list*/
-    int mem_avail = 0;                /* number of bytes left in the current chunk */
-    char* next_mem_loc_ptr = nullptr; /* pointer to the first available (free) *
-                                       * byte in the current chunk		*/
+    Arena* arena = nullptr;
 };
 
 void* free(void* some);
@@ -43,9 +43,66 @@ void chunk_delete(T* obj, t_chunk* /*chunk_info*/) {
     }
 }
 
+//Applies opt-in memory placement hints to an existing large allocation
+//(e.g. the RR graph node array), selected via environment variables:
+//
+//  * VTR_HUGEPAGES=1       requests transparent hugepage backing for the
+//                          range (madvise MADV_HUGEPAGE), reducing TLB
+//                          pressure for multi-GB arrays
+//  * VTR_NUMA_INTERLEAVE=1 interleaves the range's pages across the NUMA
+//                          nodes the process may allocate from, instead of
+//                          the default first-touch placement which
+//                          concentrates pages on one socket
+//
+//Hints are best effort: they are silently ignored on non-Linux platforms,
+//for small ranges, or if the kernel rejects them. The range is rounded
+//inward to page boundaries so neighbouring allocations are unaffected.
+//Call after the array has reached its final size (resizing replaces the
+//underlying allocation, losing the hint).
+void hint_large_array(void* ptr, size_t num_bytes);
+
 //Cross platform wrapper around GNU's malloc_trim()
 // TODO: This is only used in one place within VPR, consider removing it
 int malloc_trim(size_t pad);
+
+/*
+ * Per-subsystem memory accounting.
+ *
+ * Peak RSS (vtr_rusage) says how much memory the whole process used, but not
+ * who owns it. Major data structure owners (RR graph, netlists, timing graph,
+ * packer) self-report their live footprint here at the points where it
+ * changes, and print_report() gives the per-subsystem breakdown at phase
+ * boundaries. The same figures are exported in the profiling JSON output
+ * (see vtr_profile.h).
+ *
+ * Reported figures are the owners' own capacity-based estimates: they cover
+ * the dominant arrays, not every last allocation, so the sum is a lower
+ * bound on (not an exact partition of) the process footprint.
+ *
+ * Like the profiling registry, the accounting assumes reports are made from
+ * a single thread (they occur at coarse phase boundaries, not per
+ * allocation).
+ */
+namespace memory_usage {
+
+//Sets the live byte count attributed to a subsystem (overwriting any
+//previous report and updating the subsystem's peak)
+void report(const std::string& subsystem, size_t num_bytes);
+
+//Current/peak bytes attributed to a subsystem (zero if never reported)
+size_t bytes(const std::string& subsystem);
+size_t peak_bytes(const std::string& subsystem);
+
+//Invokes callback(subsystem, current_bytes, peak_bytes) for each reported
+//subsystem, in first-report order
+void for_each(const std::function<void(const std::string&, size_t, size_t)>& callback);
+
+//Logs the per-subsystem breakdown (current and peak bytes), e.g. at a
+//phase boundary. 'context' describes the point in the flow being reported.
+void print_report(const char* context);
+
+} // namespace memory_usage
+
 } // namespace vtr
 
 #endif
@@ -66,12 +66,12 @@ class NdMatrixProxy<T, 1> {
         , start_(start) {}
 
     const T& operator[](size_t index) const {
-        VTR_ASSERT_SAFE_MSG(dim_strides_[0] == 1, "Final dimension must have stride 1");
         VTR_ASSERT_SAFE_MSG(index >= 0, "Index out of range (below dimension minimum)");
         VTR_ASSERT_SAFE_MSG(index < dim_sizes_[0], "Index out of range (above dimension maximum)");
 
-        //Base case
-        return start_[index];
+        //Base case. The stride is 1 for the default row-major layout, but may be
+        //larger if the matrix was built with a custom dimension layout order.
+        return start_[dim_strides_[0] * index];
     }
 
     T& operator[](size_t index) {
@@ -85,6 +85,7 @@ class NdMatrixProxy<T, 1> {
     //Note that it is the caller's responsibility to use this correctly; care must be taken
     //not to clobber elements in other dimensions
     const T* data() const {
+        VTR_ASSERT_SAFE_MSG(dim_strides_[0] == 1, "Can only access a raw pointer to a contiguous (stride 1) dimension");
         return start_;
     }
 
@@ -134,6 +135,12 @@ class NdMatrixBase {
         resize(dim_sizes, value);
     }
 
+    //Specified dimension sizes and in-memory layout order (see the
+    //corresponding resize() overload), with optional fill value
+    NdMatrixBase(std::array<size_t, N> dim_sizes, std::array<size_t, N> layout_order, T value = T()) {
+        resize(dim_sizes, layout_order, value);
+    }
+
   public: //Accessors
     //Returns the size of the matrix (number of elements)
     size_t size() const {
@@ -172,6 +179,25 @@ class NdMatrixBase {
         return dim_sizes_[i];
     }
 
+    //Returns the in-memory stride of the ith dimension (i.e. how many elements
+    //in the flat storage between successive indices of that dimension)
+    size_t dim_stride(size_t i) const {
+        VTR_ASSERT_SAFE(i < ndims());
+
+        return dim_strides_[i];
+    }
+
+    //Returns the offset into the flat storage (i.e. data()/get()) of the
+    //specified element under the current layout
+    size_t flat_index(std::array<size_t, N> indices) const {
+        size_t offset = 0;
+        for (size_t idim = 0; idim < N; ++idim) {
+            VTR_ASSERT_SAFE_MSG(indices[idim] < dim_sizes_[idim], "Index out of range");
+            offset += dim_strides_[idim] * indices[idim];
+        }
+        return offset;
+    }
+
     // Flat accessors of NdMatrix
     const T& get(size_t i) const {
         VTR_ASSERT_SAFE(i < size_);
@@ -183,6 +209,20 @@ class NdMatrixBase {
         return data_[i];
     }
 
+    //Raw element storage, in memory-layout order.
+    //
+    //Iterating [begin(), end()) (or equivalently [data(), data() + size()))
+    //visits every element sequentially in memory while bypassing the
+    //per-dimension proxy objects. Note the visit order only corresponds to
+    //ascending index order for the default (row-major) layout.
+    const T* data() const { return data_.get(); }
+    T* data() { return data_.get(); }
+
+    const T* begin() const { return data_.get(); }
+    const T* end() const { return data_.get() + size(); }
+    T* begin() { return data_.get(); }
+    T* end() { return data_.get() + size(); }
+
   public: //Mutators
     //Set all elements to 'value'
     void fill(T value) {
@@ -194,14 +234,33 @@ class NdMatrixBase {
     //If 'value' is specified all elements will be initialized to it,
     //otherwise they will be default constructed.
     void resize(std::array<size_t, N> dim_sizes, T value = T()) {
+        resize(dim_sizes, default_layout_order(), value);
+    }
+
+    //Resize the matrix to the specified dimension ranges, with an explicit
+    //in-memory layout.
+    //
+    //'layout_order' lists the dimensions from outermost (largest stride) to
+    //innermost (stride 1): the default row-major layout is {0, 1, ..., N-1},
+    //while e.g. {1, 0} stores a 2-dimensional matrix column-major. Indexing is
+    //unaffected -- only which dimension is contiguous in memory changes -- so
+    //matrix-heavy kernels can put their fastest-varying dimension innermost
+    //without changing any call sites.
+    //
+    //Note that raw pointers obtained through the proxy data() accessor are
+    //only available for the stride-1 dimension.
+    void resize(std::array<size_t, N> dim_sizes, std::array<size_t, N> layout_order, T value = T()) {
+        VTR_ASSERT_MSG(is_valid_layout_order(layout_order), "Layout order must be a permutation of the dimensions");
+
         dim_sizes_ = dim_sizes;
         size_ = calc_size();
         alloc();
         fill(value);
         if (size_ > 0) {
-            dim_strides_[0] = size_ / dim_sizes_[0];
-            for (size_t dim = 1; dim < N; ++dim) {
-                dim_strides_[dim] = dim_strides_[dim - 1] / dim_sizes_[dim];
+            size_t stride = 1;
+            for (size_t i = N; i-- > 0;) {
+                dim_strides_[layout_order[i]] = stride;
+                stride *= dim_sizes_[layout_order[i]];
             }
         } else {
             dim_strides_.fill(0);
@@ -220,6 +279,7 @@ class NdMatrixBase {
     //Copy constructor
     NdMatrixBase(const NdMatrixBase& other)
         : NdMatrixBase(other.dim_sizes_) {
+        dim_strides_ = other.dim_strides_; //Preserve any custom layout
         std::copy(other.data_.get(), other.data_.get() + other.size(), data_.get());
     }
 
@@ -252,6 +312,28 @@ class NdMatrixBase {
         data_ = std::make_unique<T[]>(size());
     }
 
+    //Returns the canonical (row-major) layout order {0, 1, ..., N-1}
+    static std::array<size_t, N> default_layout_order() {
+        std::array<size_t, N> layout_order;
+        for (size_t i = 0; i < N; ++i) {
+            layout_order[i] = i;
+        }
+        return layout_order;
+    }
+
+    //Returns true if layout_order is a permutation of the dimensions
+    static bool is_valid_layout_order(const std::array<size_t, N>& layout_order) {
+        std::array<bool, N> seen;
+        seen.fill(false);
+        for (size_t dim : layout_order) {
+            if (dim >= N || seen[dim]) {
+                return false;
+            }
+            seen[dim] = true;
+        }
+        return true;
+    }
+
     //Returns the size of the matrix (number of elements) calucated
     //from the current dimensions
     size_t calc_size() const {
@@ -299,6 +381,10 @@ class NdMatrixBase {
 //
 //      //Resizing an existing matrix (all elements set to value 88)
 //      m3.resize({15,55}, 88)
+//
+//      //A 2-dimensional matrix stored column-major (i.e. dimension 0 is
+//      //contiguous in memory), indexed exactly as the matrices above
+//      NdMatrix<int,2> m4({5,10}, {1,0});
 template<typename T, size_t N>
 class NdMatrix : public NdMatrixBase<T, N> {
     //General case
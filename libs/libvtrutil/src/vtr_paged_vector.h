@@ -0,0 +1,241 @@
+#ifndef VTR_PAGED_VECTOR_H
+#define VTR_PAGED_VECTOR_H
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "vtr_assert.h"
+
+namespace vtr {
+
+//A growable vector storing its elements in fixed-size pages.
+//
+//Unlike std::vector, growth never relocates existing elements: a full page
+//simply gets a new page allocated after it. This gives:
+//    * Stable element addresses across push_back/emplace_back
+//    * O(1) amortized growth without copying the existing elements
+//      (std::vector's reallocate-and-copy repeatedly copies the whole
+//      array, and transiently holds both the old and new allocations --
+//      nearly doubling peak memory for multi-GB arrays)
+//
+//The cost is one extra indirection per access, so flat storage remains
+//preferable for hot random-access data. For monotonically built arrays the
+//intended pattern is to accumulate into a paged_vector and, if the result is
+//long-lived and hot, flatten it with compact() once the size is final
+//(which frees each page as it is moved, keeping the transient overhead to a
+//single page rather than the whole array).
+//
+//Iterators are random access (so e.g. std::sort works), but are invalidated
+//by growth (unlike element addresses, an end() iterator moves).
+template<typename V, size_t PAGE_SIZE = 4096>
+class paged_vector {
+    static_assert((PAGE_SIZE & (PAGE_SIZE - 1)) == 0, "Page size must be a power of two");
+
+  public:
+    typedef V value_type;
+    typedef V& reference;
+    typedef const V& const_reference;
+    typedef size_t size_type;
+
+    template<bool IsConst>
+    class paged_iterator {
+      public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef V value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<IsConst, const V*, V*>::type pointer;
+        typedef typename std::conditional<IsConst, const V&, V&>::type reference;
+
+        typedef typename std::conditional<IsConst, const paged_vector, paged_vector>::type container_type;
+
+        paged_iterator() = default;
+        paged_iterator(container_type* vec, size_t idx)
+            : vec_(vec)
+            , idx_(idx) {}
+
+        //Allow iterator -> const_iterator conversion
+        operator paged_iterator<true>() const { return paged_iterator<true>(vec_, idx_); }
+
+        reference operator*() const { return (*vec_)[idx_]; }
+        pointer operator->() const { return &(*vec_)[idx_]; }
+        reference operator[](difference_type n) const { return (*vec_)[idx_ + n]; }
+
+        paged_iterator& operator++() {
+            ++idx_;
+            return *this;
+        }
+        paged_iterator operator++(int) {
+            paged_iterator tmp = *this;
+            ++idx_;
+            return tmp;
+        }
+        paged_iterator& operator--() {
+            --idx_;
+            return *this;
+        }
+        paged_iterator operator--(int) {
+            paged_iterator tmp = *this;
+            --idx_;
+            return tmp;
+        }
+        paged_iterator& operator+=(difference_type n) {
+            idx_ += n;
+            return *this;
+        }
+        paged_iterator& operator-=(difference_type n) {
+            idx_ -= n;
+            return *this;
+        }
+        friend paged_iterator operator+(paged_iterator iter, difference_type n) { return iter += n; }
+        friend paged_iterator operator+(difference_type n, paged_iterator iter) { return iter += n; }
+        friend paged_iterator operator-(paged_iterator iter, difference_type n) { return iter -= n; }
+        friend difference_type operator-(const paged_iterator& lhs, const paged_iterator& rhs) { return difference_type(lhs.idx_) - difference_type(rhs.idx_); }
+
+        friend bool operator==(const paged_iterator& lhs, const paged_iterator& rhs) { return lhs.idx_ == rhs.idx_; }
+        friend bool operator!=(const paged_iterator& lhs, const paged_iterator& rhs) { return lhs.idx_ != rhs.idx_; }
+        friend bool operator<(const paged_iterator& lhs, const paged_iterator& rhs) { return lhs.idx_ < rhs.idx_; }
+        friend bool operator>(const paged_iterator& lhs, const paged_iterator& rhs) { return lhs.idx_ > rhs.idx_; }
+        friend bool operator<=(const paged_iterator& lhs, const paged_iterator& rhs) { return lhs.idx_ <= rhs.idx_; }
+        friend bool operator>=(const paged_iterator& lhs, const paged_iterator& rhs) { return lhs.idx_ >= rhs.idx_; }
+
+      private:
+        friend class paged_vector;
+
+        container_type* vec_ = nullptr;
+        size_t idx_ = 0;
+    };
+
+    typedef paged_iterator<false> iterator;
+    typedef paged_iterator<true> const_iterator;
+
+  public:
+    reference operator[](size_t idx) {
+        VTR_ASSERT_SAFE(idx < size_);
+        return pages_[idx / PAGE_SIZE][idx % PAGE_SIZE];
+    }
+    const_reference operator[](size_t idx) const {
+        VTR_ASSERT_SAFE(idx < size_);
+        return pages_[idx / PAGE_SIZE][idx % PAGE_SIZE];
+    }
+
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+    reference back() { return (*this)[size_ - 1]; }
+    const_reference back() const { return (*this)[size_ - 1]; }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    void push_back(const V& value) { emplace_back(value); }
+    void push_back(V&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args) {
+        size_t ipage = size_ / PAGE_SIZE;
+        if (ipage == pages_.size()) {
+            add_page();
+        }
+        pages_[ipage].emplace_back(std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    void pop_back() {
+        VTR_ASSERT_SAFE(size_ > 0);
+        truncate(size_ - 1);
+    }
+
+    //Pre-allocates pages covering at least num_elems elements
+    void reserve(size_t num_elems) {
+        while (pages_.size() * PAGE_SIZE < num_elems) {
+            add_page();
+        }
+    }
+
+    //Destroys all elements beyond the first new_size (page storage is kept
+    //for re-use; see shrink_to_fit())
+    void truncate(size_t new_size) {
+        VTR_ASSERT(new_size <= size_);
+
+        size_t num_live_pages = (new_size + PAGE_SIZE - 1) / PAGE_SIZE;
+        for (size_t ipage = num_live_pages; ipage < pages_.size(); ++ipage) {
+            pages_[ipage].clear();
+        }
+        if (num_live_pages > 0 && new_size % PAGE_SIZE != 0) {
+            //Shrink via erase() rather than resize(): resize() would require
+            //V to be default constructible even though we only ever shrink
+            std::vector<V>& cut_page = pages_[num_live_pages - 1];
+            cut_page.erase(cut_page.begin() + new_size % PAGE_SIZE, cut_page.end());
+        }
+        size_ = new_size;
+    }
+
+    //Erases [first, last). Only tail erases are supported (last must be
+    //end()), which is all a monotonically built array needs
+    iterator erase(const_iterator first, const_iterator last) {
+        VTR_ASSERT_MSG(last.idx_ == size_, "paged_vector supports tail erases only");
+        truncate(first.idx_);
+        return end();
+    }
+
+    void clear() { truncate(0); }
+
+    //Releases any page storage not holding live elements
+    void shrink_to_fit() {
+        pages_.resize((size_ + PAGE_SIZE - 1) / PAGE_SIZE);
+        pages_.shrink_to_fit();
+    }
+
+    void swap(paged_vector& other) {
+        std::swap(pages_, other.pages_);
+        std::swap(size_, other.size_);
+    }
+
+    //Moves the elements into flat (contiguous) storage, leaving this
+    //container empty.
+    //
+    //Each page is freed as soon as its elements have been moved out, so the
+    //transient memory overhead is a single page rather than a full second
+    //copy of the array.
+    std::vector<V> compact() {
+        std::vector<V> flat;
+        flat.reserve(size_);
+
+        for (std::vector<V>& page : pages_) {
+            for (V& value : page) {
+                flat.push_back(std::move(value));
+            }
+            page = std::vector<V>(); //Free the page eagerly
+        }
+
+        pages_.clear();
+        pages_.shrink_to_fit();
+        size_ = 0;
+
+        return flat;
+    }
+
+  private:
+    void add_page() {
+        pages_.emplace_back();
+        pages_.back().reserve(PAGE_SIZE);
+    }
+
+  private:
+    //Element pages. Each page's storage is reserved once at PAGE_SIZE and
+    //never reallocates, so element addresses are stable; the outer vector
+    //only shuffles the (cheap) page handles when it grows.
+    std::vector<std::vector<V>> pages_;
+    size_t size_ = 0;
+};
+
+} // namespace vtr
+
+#endif
@@ -0,0 +1,188 @@
+#include "vtr_profile.h"
+
+#include "vtr_log.h"
+#include "vtr_memory.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace vtr {
+namespace profile {
+
+namespace {
+
+constexpr double BYTES_PER_MIB = 1024. * 1024.;
+
+struct TimerNode {
+    std::string name;
+    TimerNode* parent = nullptr;
+
+    double inclusive_sec = 0.;
+    double delta_max_rss_bytes = 0.;
+    size_t num_calls = 0;
+
+    std::vector<std::unique_ptr<TimerNode>> children;
+
+    TimerNode* find_or_create_child(const std::string& child_name) {
+        for (std::unique_ptr<TimerNode>& child : children) {
+            if (child->name == child_name) {
+                return child.get();
+            }
+        }
+
+        children.emplace_back(new TimerNode);
+        children.back()->name = child_name;
+        children.back()->parent = this;
+        return children.back().get();
+    }
+};
+
+TimerNode f_profile_root;                    //Root of the scope tree (a synthetic node)
+TimerNode* f_current_scope = &f_profile_root; //Innermost currently-open scope
+bool f_checked_dump_at_exit = false;
+
+//Named free-running counters, kept in insertion order for stable output
+std::vector<std::pair<std::string, size_t>>& counters() {
+    static std::vector<std::pair<std::string, size_t>> values;
+    return values;
+}
+
+std::string& exit_dump_filename() {
+    static std::string filename;
+    return filename;
+}
+
+void write_json_at_exit() {
+    write_json(exit_dump_filename());
+}
+
+std::string escape_json(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+void write_node_json(std::ostream& os, const TimerNode& node, int depth) {
+    std::string pad(4 * depth, ' ');
+
+    double children_sec = 0.;
+    for (const std::unique_ptr<TimerNode>& child : node.children) {
+        children_sec += child->inclusive_sec;
+    }
+
+    //The root is synthetic: it exists only to hold the top-level scopes, so
+    //it reports their sum as its inclusive time
+    double inclusive_sec = (node.parent != nullptr) ? node.inclusive_sec : children_sec;
+
+    os << pad << "{\n";
+    os << pad << "    \"name\": \"" << escape_json(node.name) << "\",\n";
+    os << pad << "    \"inclusive_sec\": " << inclusive_sec << ",\n";
+    os << pad << "    \"exclusive_sec\": " << inclusive_sec - children_sec << ",\n";
+    os << pad << "    \"num_calls\": " << node.num_calls << ",\n";
+    os << pad << "    \"delta_max_rss_mib\": " << node.delta_max_rss_bytes / BYTES_PER_MIB << ",\n";
+    os << pad << "    \"children\": [";
+    for (size_t i = 0; i < node.children.size(); ++i) {
+        if (i != 0) os << ",";
+        os << "\n";
+        write_node_json(os, *node.children[i], depth + 2);
+    }
+    if (!node.children.empty()) {
+        os << "\n" << pad << "    ";
+    }
+    os << "]\n";
+    os << pad << "}";
+}
+
+} // namespace
+
+void enter_scope(const std::string& name) {
+    if (!f_checked_dump_at_exit) {
+        //On the first scope, check whether an at-exit JSON dump was requested
+        f_checked_dump_at_exit = true;
+
+        const char* filename = std::getenv("VTR_PROFILE_JSON");
+        if (filename && filename[0] != '\0') {
+            exit_dump_filename() = filename;
+            std::atexit(write_json_at_exit);
+        }
+    }
+
+    f_current_scope = f_current_scope->find_or_create_child(name);
+}
+
+void exit_scope(double elapsed_sec, double delta_max_rss_bytes) {
+    if (f_current_scope == &f_profile_root) {
+        return; //Unbalanced exit: ignore
+    }
+
+    f_current_scope->inclusive_sec += elapsed_sec;
+    f_current_scope->delta_max_rss_bytes += delta_max_rss_bytes;
+    f_current_scope->num_calls += 1;
+
+    f_current_scope = f_current_scope->parent;
+}
+
+void add_to_counter(const std::string& name, size_t delta) {
+    for (std::pair<std::string, size_t>& counter : counters()) {
+        if (counter.first == name) {
+            counter.second += delta;
+            return;
+        }
+    }
+    counters().emplace_back(name, delta);
+}
+
+void write_json(std::ostream& os) {
+    f_profile_root.name = "total";
+    os << "{\n";
+    os << "    \"counters\": {";
+    for (size_t i = 0; i < counters().size(); ++i) {
+        if (i != 0) os << ",";
+        os << "\n        \"" << escape_json(counters()[i].first) << "\": " << counters()[i].second;
+    }
+    if (!counters().empty()) {
+        os << "\n    ";
+    }
+    os << "},\n";
+    os << "    \"memory_usage\": {";
+    bool first_subsystem = true;
+    memory_usage::for_each([&](const std::string& subsystem, size_t current_bytes, size_t peak_bytes) {
+        if (!first_subsystem) os << ",";
+        first_subsystem = false;
+        os << "\n        \"" << escape_json(subsystem) << "\": {"
+           << " \"current_bytes\": " << current_bytes << ","
+           << " \"peak_bytes\": " << peak_bytes << " }";
+    });
+    if (!first_subsystem) {
+        os << "\n    ";
+    }
+    os << "},\n";
+    os << "    \"scopes\":\n";
+    write_node_json(os, f_profile_root, 1);
+    os << "\n}\n";
+}
+
+void write_json(const std::string& filename) {
+    std::ofstream os(filename);
+    if (!os) {
+        VTR_LOG_WARN("Failed to open profiling output file '%s'\n", filename.c_str());
+        return;
+    }
+    write_json(os);
+}
+
+} // namespace profile
+} // namespace vtr
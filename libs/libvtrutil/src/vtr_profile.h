@@ -0,0 +1,53 @@
+#ifndef VTR_PROFILE_H
+#define VTR_PROFILE_H
+#include <iosfwd>
+#include <string>
+
+namespace vtr {
+namespace profile {
+
+//Hierarchical profiling registry.
+//
+//Nested timer scopes (entered/exited automatically by vtr::ScopedActionTimer
+//and its subclasses, or manually via enter_scope()/exit_scope()) form a tree
+//keyed by scope name within parent. Each node accumulates:
+//  * inclusive time (the scope and everything nested in it)
+//  * exclusive time (inclusive minus the time of nested scopes, computed at
+//    export)
+//  * the change in peak resident set size while the scope was active
+//  * the number of times the scope was entered
+//
+//The registry is cheap enough to stay permanently enabled: entering a scope
+//is a walk over the current node's children (scope trees are shallow and
+//narrow) and exiting is a few additions, paid once per timer scope rather
+//than per operation.
+//
+//The collected tree can be exported as JSON with write_json(). If the
+//VTR_PROFILE_JSON environment variable names a file when the first scope is
+//entered, the tree is automatically written there at normal program exit.
+//
+//Like the timer depth tracking in vtr_time.cpp, the registry assumes scopes
+//are entered and exited on a single thread.
+
+//Enters a profiling scope nested in the current one (creating it on first
+//entry)
+void enter_scope(const std::string& name);
+
+//Exits the current profiling scope, accumulating the specified elapsed time
+//and peak resident set size change
+void exit_scope(double elapsed_sec, double delta_max_rss_bytes);
+
+//Adds to a named free-running counter (e.g. cache hits/misses), which is
+//reported alongside the scope tree in the JSON export
+void add_to_counter(const std::string& name, size_t delta);
+
+//Writes the profiling tree as JSON
+void write_json(std::ostream& os);
+
+//Writes the profiling tree as JSON to the specified file
+void write_json(const std::string& filename);
+
+} // namespace profile
+} // namespace vtr
+
+#endif
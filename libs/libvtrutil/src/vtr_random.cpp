@@ -52,14 +52,14 @@ int irand(int imax) {
     return irand(imax, random_state);
 }
 
-float frand() {
+float frand(RandState& state) {
     /* Creates a random float between 0 and 1.  i.e. [0..1).        */
 
     float fval;
     int ival;
 
-    random_state = random_state * IA + IC; /* Use overflow to wrap */
-    ival = random_state & (IM - 1);        /* Modulus */
+    state = state * IA + IC; /* Use overflow to wrap */
+    ival = state & (IM - 1); /* Modulus */
     fval = (float)ival / (float)IM;
 
 #ifdef CHECK_RAND
@@ -71,4 +71,82 @@ float frand() {
     return (fval);
 }
 
+float frand() {
+    return frand(random_state);
+}
+
+/* Philox 4x32-10 counter-based generator (Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3", SC'11). One round of the bijection: two
+ * 32x32 -> 64 bit multiplies whose halves are mixed with the other counter
+ * words and the round key. */
+static inline void philox_round(uint32_t ctr[4], const uint32_t key[2]) {
+    constexpr uint32_t PHILOX_M0 = 0xD2511F53u;
+    constexpr uint32_t PHILOX_M1 = 0xCD9E8D57u;
+
+    uint64_t product0 = uint64_t(PHILOX_M0) * ctr[0];
+    uint64_t product1 = uint64_t(PHILOX_M1) * ctr[2];
+
+    uint32_t hi0 = uint32_t(product0 >> 32);
+    uint32_t lo0 = uint32_t(product0);
+    uint32_t hi1 = uint32_t(product1 >> 32);
+    uint32_t lo1 = uint32_t(product1);
+
+    ctr[0] = hi1 ^ ctr[1] ^ key[0];
+    ctr[1] = lo1;
+    ctr[2] = hi0 ^ ctr[3] ^ key[1];
+    ctr[3] = lo0;
+}
+
+void RngStream::seed(unsigned seed, unsigned stream_id) {
+    key_[0] = seed;
+    key_[1] = stream_id;
+    counter_ = 0;
+    buffered_ = 0;
+}
+
+void RngStream::refill() {
+    constexpr uint32_t PHILOX_W0 = 0x9E3779B9u; //Round key Weyl increments
+    constexpr uint32_t PHILOX_W1 = 0xBB67AE85u;
+    constexpr int PHILOX_NUM_ROUNDS = 10;
+
+    uint32_t ctr[4] = {uint32_t(counter_), uint32_t(counter_ >> 32), 0u, 0u};
+    uint32_t key[2] = {key_[0], key_[1]};
+
+    for (int iround = 0; iround < PHILOX_NUM_ROUNDS; ++iround) {
+        if (iround > 0) {
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+        philox_round(ctr, key);
+    }
+
+    ++counter_;
+
+    for (int i = 0; i < 4; ++i) {
+        buffer_[i] = ctr[i];
+    }
+    buffered_ = 4;
+}
+
+uint32_t RngStream::rand_u32() {
+    if (buffered_ == 0) {
+        refill();
+    }
+
+    uint32_t value = buffer_[4 - buffered_];
+    --buffered_;
+    return value;
+}
+
+int RngStream::irand(int imax) {
+    /* Creates a random integer between 0 and imax, inclusive.  i.e. [0..imax] */
+    return int(rand_u32() % (uint32_t(imax) + 1));
+}
+
+float RngStream::frand() {
+    /* Creates a random float between 0 and 1.  i.e. [0..1).
+     * Uses the top 24 bits so the value is exactly representable. */
+    return float(rand_u32() >> 8) * (1.0f / 16777216.0f);
+}
+
 } // namespace vtr
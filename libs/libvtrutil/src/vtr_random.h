@@ -1,6 +1,7 @@
 #ifndef VTR_RANDOM_H
 #define VTR_RANDOM_H
 #include <algorithm> //For std::swap
+#include <cstdint>
 
 namespace vtr {
 /*********************** Portable random number generators *******************/
@@ -9,9 +10,16 @@ typedef unsigned RandState;
 void srandom(int seed);
 RandState get_random_state();
 int irand(int imax);
-int irand(int imax, RandState& rand_state);
 float frand();
 
+//Explicit-state overloads.
+//
+//These generate from the caller-owned state rather than the global
+//generator state, allowing independent random streams (e.g. one
+//per thread).
+int irand(int imax, RandState& rand_state);
+float frand(RandState& rand_state);
+
 //Portable/invariant version of std::shuffle
 //
 //Note that std::shuffle relies on std::uniform_int_distribution
@@ -28,5 +36,54 @@ void shuffle(Iter first, Iter last, RandState& rand_state) {
     }
 }
 
+//A counter-based random number stream (Philox 4x32-10).
+//
+//Each (seed, stream id) pair keys an independent, fully reproducible
+//sequence: successive outputs come from encrypting an incrementing counter,
+//so streams share no state and the i'th value of a stream is the same
+//regardless of what other streams produced. This makes RngStream suitable
+//for parallel algorithms which need deterministic results: give each worker
+//its own stream (same seed, distinct stream id) and no synchronization or
+//shared cache line is involved.
+//
+//Unlike the legacy irand()/frand() generator the sequence is also well
+//distributed (Philox passes the standard statistical test batteries).
+class RngStream {
+  public:
+    //Constructs a stream; the sequence is fully determined by (seed, stream_id)
+    explicit RngStream(unsigned seed = 0, unsigned stream_id = 0) {
+        this->seed(seed, stream_id);
+    }
+
+    //Re-seeds the stream, restarting its sequence
+    void seed(unsigned seed, unsigned stream_id = 0);
+
+    //Returns a uniformly distributed 32-bit value
+    uint32_t rand_u32();
+
+    //Returns a random integer between 0 and imax, inclusive, i.e. [0..imax]
+    int irand(int imax);
+
+    //Returns a random float between 0 and 1, i.e. [0..1)
+    float frand();
+
+    //Portable/invariant shuffle from this stream (see vtr::shuffle())
+    template<typename Iter>
+    void shuffle(Iter first, Iter last) {
+        for (auto i = (last - first) - 1; i > 0; --i) {
+            using std::swap;
+            swap(first[i], first[irand(i)]);
+        }
+    }
+
+  private:
+    void refill();
+
+    uint64_t counter_ = 0;  //Next counter block to encrypt
+    uint32_t key_[2];       //Derived from (seed, stream id)
+    uint32_t buffer_[4];    //Outputs of the last encrypted block
+    unsigned buffered_ = 0; //Number of unconsumed values in buffer_
+};
+
 } // namespace vtr
 #endif
@@ -1,8 +1,10 @@
 #ifndef VTR_SMALL_VECTOR
 #define VTR_SMALL_VECTOR
+#include <array>
 #include <memory>
 #include <algorithm>
 #include <limits>
+#include <stdexcept>
 #include <cstdint>
 #include "vtr_assert.h"
 
@@ -86,11 +88,9 @@ class small_vector {
     }
     small_vector(size_type nelem)
         : small_vector() {
-        reserve(nelem);
         for (size_type i = 0; i < nelem; i++) {
             emplace_back();
         }
-        set_size(0);
     }
 
   public: //Accessors
@@ -213,10 +213,13 @@ class small_vector {
     }
 
     void reserve(size_type num_elems) {
-        //Don't change capacity unless requested number of elements is both:
-        //  * More than the short capacity (no need to reserve up to short capacity)
-        //  * Greater than the current size (capacity can never be below size)
-        if (num_elems > SHORT_CAPACITY && num_elems > size()) {
+        //Capacity changes can only be applied in the long (dynamically
+        //allocated) format: while in the short format which storage is active
+        //is determined purely by the current size, so a larger reservation
+        //could not be recorded (let alone used). In that case the reservation
+        //is skipped; the storage grows automatically once the elements no
+        //longer fit in-place.
+        if (!is_short() && num_elems > size()) {
             change_capacity(num_elems);
         }
     }
@@ -286,29 +289,43 @@ class small_vector {
         //unchanged if the underlying storage is reallocated
         size_type i = std::distance(cbegin(), position);
 
+        if (n == 0) {
+            return begin() + i;
+        }
+
         //If needed, grow capacity
         //
         //Note that change_capacity will automatically convert from short to long
         //format if required.
-        size_type new_size = size() + n;
+        size_type old_size = size();
+        size_type new_size = old_size + n;
         if (capacity() < new_size) {
             change_capacity(new_size);
         }
 
+        //The storage format is determined by the current size, so the size
+        //must be updated before computing any iterators (change_capacity may
+        //have moved the elements from in-place to dynamically allocated
+        //storage)
+        set_size(new_size);
+
         iterator first = begin() + i;
         iterator last = first + n;
-        reverse_swap_elements(first, end(), end() + n - 1);
+        iterator old_end = begin() + old_size;
+        if (first != old_end) {
+            //Move the existing elements in [first, old_end) up by n to make room
+            reverse_swap_elements(first, old_end, old_end + n - 1);
+        }
 
-        //Insert new values at end
+        //Insert new values into the vacated locations
         std::uninitialized_fill(first, last, val);
 
-        set_size(new_size);
-
         return first;
     }
 
     iterator insert(const_iterator position, size_type n, value_type&& val) {
-        return insert(position, n, value_type(val)); //TODO: optimize for moved val
+        const value_type copy(std::move(val)); //Bind to the lvalue overload above
+        return insert(position, n, copy);      //TODO: optimize for moved val
     }
 
     //Range insert
@@ -352,8 +369,6 @@ class small_vector {
 
         size_type new_size = size() - n;
 
-        const_iterator position = first;
-
         if (!is_short() && new_size <= SHORT_CAPACITY) {
             //Convert from long format to short/in-place format
 
@@ -386,9 +401,6 @@ class small_vector {
             //Clean-up elements in buffer and free it
             destruct_elements(buff_begin, buff_end);
             dealloc(buff_ptr);
-
-            //New position
-            position = begin() + i_first;
         } else {
             //Remove elements in either long or short formats
 
@@ -404,36 +416,29 @@ class small_vector {
             //Finally destruct the elements in [last, end()); that is the
             //elements which were originally to be erased
             destruct_elements(end() - n, end());
-
-            //Note that capacity is unchanged, so we do not need to change
-            //position in this case
         }
 
         //Shrink size
         set_size(new_size);
 
-        return begin() + std::distance(cbegin(), position);
+        //Recompute from the index, since the elements may have moved (e.g. if
+        //the storage converted from long to short format)
+        return begin() + i_first;
     }
 
     void swap(small_vector<T, S>& other) {
-        swap(*this, other);
-    }
-
-    friend void swap(small_vector<T, S>& lhs, small_vector<T, S>& rhs) {
-        using std::swap;
-
-        if (lhs.is_short() && rhs.is_short()) {
+        if (is_short() && other.is_short()) {
             //Both short
-            std::swap(lhs.short_, rhs.short_);
-        } else if (!lhs.is_short() && !rhs.is_short()) {
+            std::swap(short_, other.short_);
+        } else if (!is_short() && !other.is_short()) {
             //Both long
-            std::swap(lhs.long_, rhs.long_);
+            std::swap(long_, other.long_);
         } else {
             //Mixed long/short
-            VTR_ASSERT_SAFE(lhs.is_short() != rhs.is_short());
+            VTR_ASSERT_SAFE(is_short() != other.is_short());
 
-            auto& long_vec = ((lhs.is_short()) ? rhs : lhs);
-            auto& short_vec = ((lhs.is_short()) ? lhs : rhs);
+            auto& long_vec = ((is_short()) ? other : *this);
+            auto& short_vec = ((is_short()) ? *this : other);
 
             //If the two vectors are in different formats we can't just swap them,
             //since the short format has real values (potentially with destructors),
@@ -445,26 +450,34 @@ class small_vector {
 
             //Save long data
             pointer long_buf = long_vec.long_.data_;
-            size_type long_size = long_vec.long_size_;
+            size_type long_size = long_vec.long_.size_;
             size_type long_capacity = long_vec.long_.capacity_;
 
             //Copy short data into long
             //
-            //Note that the long format contains only basic data types with no destructors to call,
-            //so we can use uninitialzed copy
-            std::uninitialized_copy(short_vec.short_.begin(), short_vec.short_.end(), long_vec.short_.data_);
-            long_vec.short_.size_ = short_vec.size();
+            //Note that only the first size() elements of the in-place array are
+            //live, and that the destination storage is raw memory (the long
+            //format holds only basic data types), so we can use uninitialized copy
+            size_type short_size = short_vec.size();
+            std::uninitialized_copy(short_vec.short_.data_.data(),
+                                    short_vec.short_.data_.data() + short_size,
+                                    long_vec.short_.data_.data());
+            long_vec.short_.size_ = short_size;
 
             //Destroy original elements in short
             short_vec.destruct_elements();
 
             //Copy long data into short
-            short_vec.long_.data = long_buf;
+            short_vec.long_.data_ = long_buf;
             short_vec.long_.capacity_ = long_capacity;
             short_vec.long_.size_ = long_size;
         }
     }
 
+    friend void swap(small_vector<T, S>& lhs, small_vector<T, S>& rhs) {
+        lhs.swap(rhs);
+    }
+
     void clear() {
         //Destruct all elements and clear size, but do not free memory
         destruct_elements();
@@ -521,39 +534,28 @@ class small_vector {
         }
     }
 
-    small_vector(const small_vector& other) {
+    small_vector(const small_vector& other)
+        : small_vector() { //Ensure a valid (empty) state before copying in
         if (other.is_short()) {
-            ~small_vector(); //Clean-up elements
-
-            //Copy in place
-            short_ = other.short_;
+            //Copy construct the elements in-place
+            std::uninitialized_copy(other.begin(), other.end(), short_.data_.data());
         } else {
-            if (!is_short() && capacity() >= other.size()) {
-                //Re-use existing buffer, since it has sufficient capacity
-                destruct_elements();
-
-            } else {
-                ~small_vector(); //Clean-up elements, potentially freeing buffer
-
-                //Create new buffer of exact size
-                long_.data_ = alloc(other.size());
-                long_.capacity_ = other.size();
-            }
-
-            set_size(other.size());
+            //Create new buffer of exact size and copy into it
+            long_.data_ = alloc(other.size());
+            long_.capacity_ = other.size();
 
-            //Copy elements
             std::uninitialized_copy(other.begin(), other.end(), long_.data_);
         }
+        set_size(other.size());
     }
 
     small_vector(small_vector&& other)
         : small_vector() {
-        swap(*this, other); //Copy-swap
+        this->swap(other); //Copy-swap
     }
 
     small_vector& operator=(small_vector other) {
-        swap(*this, other); //Copy-swap
+        this->swap(other); //Copy-swap
         return *this;
     }
 
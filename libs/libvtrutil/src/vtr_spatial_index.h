@@ -0,0 +1,221 @@
+#ifndef VTR_SPATIAL_INDEX_H
+#define VTR_SPATIAL_INDEX_H
+#include "vtr_geometry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace vtr {
+
+//A static spatial index over 2D rectangles, supporting efficient window
+//(rectangle intersection) and point containment queries.
+//
+//The index is a packed R-tree bulk-loaded with the Sort-Tile-Recursive (STR)
+//algorithm: the entries are sorted into spatially coherent tiles and grouped
+//into fixed-fanout nodes, whose bounding boxes are then grouped recursively.
+//Since the tree is fully packed it is compact (no per-node allocations) and
+//queries visit O(log n + k) nodes for k reported entries.
+//
+//The index is static: it is (re-)built in bulk with build() and does not
+//support incremental insertion or removal. This matches the typical usage
+//pattern (e.g. hit-testing a fixed set of placed blocks), where the indexed
+//set changes far less frequently than it is queried.
+//
+//Template parameters:
+//  T: the coordinate type (e.g. int, double), as in vtr::Rect<T>
+//  V: the value associated with each rectangle (e.g. an Id)
+template<class T, class V>
+class SpatialIndex {
+  public: //Types
+    typedef std::pair<Rect<T>, V> entry_type;
+
+  public: //Constructors
+    SpatialIndex() = default;
+
+    //Constructs the index over the specified entries (equivalent to build())
+    explicit SpatialIndex(std::vector<entry_type> entries) {
+        build(std::move(entries));
+    }
+
+  public: //Accessors
+    bool empty() const { return entries_.empty(); }
+    size_t size() const { return entries_.size(); }
+
+    //Calls 'callback(rect, value)' for each entry whose rectangle intersects
+    //the specified region (closed intervals: touching edges intersect)
+    template<class Callback>
+    void for_each_intersecting(const Rect<T>& region, Callback callback) const {
+        if (entries_.empty()) return;
+
+        if (levels_.empty()) {
+            //Small index: no internal nodes, scan the entries directly
+            for (const entry_type& entry : entries_) {
+                if (intersects(entry.first, region)) {
+                    callback(entry.first, entry.second);
+                }
+            }
+            return;
+        }
+
+        query_recurr(levels_.size() - 1, 0, region, callback);
+    }
+
+    //Returns the values of all entries whose rectangle intersects the
+    //specified region
+    std::vector<V> find_intersecting(const Rect<T>& region) const {
+        std::vector<V> values;
+        for_each_intersecting(region, [&](const Rect<T>& /*rect*/, const V& value) {
+            values.push_back(value);
+        });
+        return values;
+    }
+
+    //Returns the values of all entries whose rectangle contains the specified
+    //point (inclusive of all edges, i.e. vtr::Rect::coincident())
+    std::vector<V> find_containing(Point<T> point) const {
+        std::vector<V> values;
+        for_each_intersecting(Rect<T>(point, point), [&](const Rect<T>& rect, const V& value) {
+            if (rect.coincident(point)) {
+                values.push_back(value);
+            }
+        });
+        return values;
+    }
+
+  public: //Mutators
+    //(Re-)builds the index over the specified entries
+    void build(std::vector<entry_type> entries) {
+        entries_ = std::move(entries);
+        levels_.clear();
+
+        if (entries_.size() <= NODE_CAPACITY) {
+            return; //Queries scan the entries directly
+        }
+
+        //Sort-Tile-Recursive: sort by x centre, slice vertically, then sort
+        //each slice by y centre so consecutive entries are spatially coherent
+        std::sort(entries_.begin(), entries_.end(),
+                  [](const entry_type& lhs, const entry_type& rhs) {
+                      return centre_x(lhs.first) < centre_x(rhs.first);
+                  });
+
+        size_t num_leaves = (entries_.size() + NODE_CAPACITY - 1) / NODE_CAPACITY;
+        size_t num_slices = std::ceil(std::sqrt(float(num_leaves)));
+        size_t slice_size = ((num_leaves + num_slices - 1) / num_slices) * NODE_CAPACITY;
+
+        for (size_t begin = 0; begin < entries_.size(); begin += slice_size) {
+            size_t end = begin + slice_size;
+            if (end > entries_.size()) end = entries_.size();
+
+            std::sort(entries_.begin() + begin, entries_.begin() + end,
+                      [](const entry_type& lhs, const entry_type& rhs) {
+                          return centre_y(lhs.first) < centre_y(rhs.first);
+                      });
+        }
+
+        //Leaf level: bounding box of each group of NODE_CAPACITY consecutive entries
+        levels_.emplace_back();
+        std::vector<Rect<T>>& leaves = levels_.back();
+        leaves.reserve(num_leaves);
+        for (size_t begin = 0; begin < entries_.size(); begin += NODE_CAPACITY) {
+            size_t end = begin + NODE_CAPACITY;
+            if (end > entries_.size()) end = entries_.size();
+
+            Rect<T> bbox = entries_[begin].first;
+            for (size_t i = begin + 1; i < end; ++i) {
+                bbox = bounding_union(bbox, entries_[i].first);
+            }
+            leaves.push_back(bbox);
+        }
+
+        //Upper levels: bounding box of each group of NODE_CAPACITY consecutive
+        //nodes from the level below, until a single root remains
+        while (levels_.back().size() > 1) {
+            const std::vector<Rect<T>>& below = levels_.back();
+
+            std::vector<Rect<T>> level;
+            level.reserve((below.size() + NODE_CAPACITY - 1) / NODE_CAPACITY);
+            for (size_t begin = 0; begin < below.size(); begin += NODE_CAPACITY) {
+                size_t end = begin + NODE_CAPACITY;
+                if (end > below.size()) end = below.size();
+
+                Rect<T> bbox = below[begin];
+                for (size_t i = begin + 1; i < end; ++i) {
+                    bbox = bounding_union(bbox, below[i]);
+                }
+                level.push_back(bbox);
+            }
+            levels_.push_back(std::move(level));
+        }
+    }
+
+    void clear() {
+        entries_.clear();
+        levels_.clear();
+    }
+
+  private: //Utilities
+    static bool intersects(const Rect<T>& lhs, const Rect<T>& rhs) {
+        return lhs.xmin() <= rhs.xmax() && rhs.xmin() <= lhs.xmax()
+               && lhs.ymin() <= rhs.ymax() && rhs.ymin() <= lhs.ymax();
+    }
+
+    static Rect<T> bounding_union(const Rect<T>& lhs, const Rect<T>& rhs) {
+        return Rect<T>(std::min(lhs.xmin(), rhs.xmin()),
+                       std::min(lhs.ymin(), rhs.ymin()),
+                       std::max(lhs.xmax(), rhs.xmax()),
+                       std::max(lhs.ymax(), rhs.ymax()));
+    }
+
+    static T centre_x(const Rect<T>& rect) { return rect.xmin() + rect.width() / 2; }
+    static T centre_y(const Rect<T>& rect) { return rect.ymin() + rect.height() / 2; }
+
+    template<class Callback>
+    void query_recurr(size_t level, size_t inode, const Rect<T>& region, Callback& callback) const {
+        //Children of node 'inode' are the NODE_CAPACITY consecutive
+        //nodes/entries starting at inode * NODE_CAPACITY in the level below
+        size_t begin = inode * NODE_CAPACITY;
+        size_t end = begin + NODE_CAPACITY;
+
+        if (level == 0) {
+            //Children are entries
+            if (end > entries_.size()) end = entries_.size();
+            for (size_t i = begin; i < end; ++i) {
+                if (intersects(entries_[i].first, region)) {
+                    callback(entries_[i].first, entries_[i].second);
+                }
+            }
+        } else {
+            //Children are nodes of the level below
+            const std::vector<Rect<T>>& below = levels_[level - 1];
+            if (end > below.size()) end = below.size();
+            for (size_t i = begin; i < end; ++i) {
+                if (intersects(below[i], region)) {
+                    query_recurr(level - 1, i, region, callback);
+                }
+            }
+        }
+    }
+
+  private: //Data
+    static constexpr size_t NODE_CAPACITY = 8; //R-tree node fan-out
+
+    //The indexed entries, re-ordered by build() so each node's children are
+    //contiguous
+    std::vector<entry_type> entries_;
+
+    //Node bounding boxes by tree level (levels_[0] are the leaves, whose
+    //children are entries; levels_.back() is the root). All levels are
+    //implicitly structured: node i's children are the NODE_CAPACITY
+    //consecutive elements starting at i * NODE_CAPACITY in the level below
+    std::vector<std::vector<Rect<T>>> levels_;
+};
+
+template<class T, class V>
+constexpr size_t SpatialIndex<T, V>::NODE_CAPACITY;
+
+} // namespace vtr
+
+#endif
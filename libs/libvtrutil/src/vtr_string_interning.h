@@ -0,0 +1,46 @@
+#ifndef VTR_STRING_INTERNING_H
+#define VTR_STRING_INTERNING_H
+#include <string>
+#include <unordered_set>
+
+namespace vtr {
+
+//Interns strings: each distinct string is stored exactly once, and intern()
+//returns a stable pointer to the shared copy.
+//
+//This is useful for highly repetitive strings (e.g. metadata keys/values
+//attached to millions of RR nodes), where storing a separate std::string
+//copy per use would balloon memory.
+//
+//Pointers returned by intern() remain valid for the lifetime of the
+//string_internment (std::unordered_set elements never move once inserted).
+//
+//Note interning is not thread-safe; callers performing concurrent interning
+//must provide their own synchronization.
+class string_internment {
+  public:
+    //Returns a stable pointer to the shared copy of str, inserting it if it
+    //has not been interned before
+    const std::string* intern(std::string str) {
+        return &*storage_.insert(std::move(str)).first;
+    }
+
+    //Returns the number of distinct strings interned
+    std::size_t size() const { return storage_.size(); }
+
+  private:
+    std::unordered_set<std::string> storage_;
+};
+
+//Process-wide shared internment.
+//
+//Using a single shared pool lets different sub-systems (e.g. netlist names,
+//architecture metadata) which happen to store the same strings share one
+//copy, and makes equality checks between their interned pointers meaningful.
+inline string_internment& global_string_internment() {
+    static string_internment internment;
+    return internment;
+}
+
+} // namespace vtr
+#endif
@@ -1,6 +1,7 @@
 #include "vtr_time.h"
 
 #include "vtr_log.h"
+#include "vtr_profile.h"
 #include "vtr_rusage.h"
 
 namespace vtr {
@@ -27,9 +28,11 @@ float Timer::delta_max_rss_mib() const {
 ScopedActionTimer::ScopedActionTimer(std::string action_str)
     : action_(action_str)
     , depth_(f_timer_depth++) {
+    profile::enter_scope(action_);
 }
 
 ScopedActionTimer::~ScopedActionTimer() {
+    profile::exit_scope(elapsed_sec(), delta_max_rss_mib() * 1024. * 1024.);
     --f_timer_depth;
 }
 
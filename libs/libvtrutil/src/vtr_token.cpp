@@ -4,9 +4,11 @@
  * Tokenizer
  */
 
+#include <cstdlib>
 #include <cstring>
 
 #include "vtr_assert.h"
+#include "vtr_error.h"
 #include "vtr_log.h"
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -30,12 +32,19 @@ bool IsWhitespace(char c) {
     }
 }
 
-/* Returns a token list of the text for a given string. */
+/* Returns a token list of the text for a given string.
+ *
+ * The token array and all the token data strings live in a single
+ * allocation (the data strings are carved out of an arena following the
+ * array), so tokenizing costs one allocation regardless of the number of
+ * tokens. The arch parser and pb graph annotation code tokenize millions
+ * of short annotation strings at startup, where the previous
+ * allocation-per-token scheme showed up as a malloc spike. */
 t_token* GetTokensFromString(const char* inString, int* num_tokens) {
     const char* cur;
     t_token* tokens;
-    int i, in_string_index, prev_in_string_index;
-    bool has_null;
+    char* arena;
+    int i, num_token_chars;
     enum e_token_type cur_token_type, new_token_type;
 
     *num_tokens = i = 0;
@@ -47,7 +56,8 @@ t_token* GetTokensFromString(const char* inString, int* num_tokens) {
 
     cur = inString;
 
-    /* Count number of tokens */
+    /* Count number of tokens and total token characters */
+    num_token_chars = 0;
     while (*cur) {
         new_token_type = GetTokenTypeFromChar(cur_token_type, *cur);
         if (new_token_type != cur_token_type) {
@@ -56,21 +66,25 @@ t_token* GetTokensFromString(const char* inString, int* num_tokens) {
                 i++;
             }
         }
+        if (new_token_type != TOKEN_NULL) {
+            num_token_chars++;
+        }
         ++cur;
     }
     *num_tokens = i;
 
     if (*num_tokens > 0) {
-        tokens = (t_token*)vtr::calloc(*num_tokens + 1, sizeof(t_token));
+        /* Single block: the token array, then an arena holding each token's
+         * nul-terminated data string */
+        tokens = (t_token*)vtr::malloc((*num_tokens + 1) * sizeof(t_token)
+                                       + num_token_chars + *num_tokens);
+        arena = (char*)(tokens + (*num_tokens + 1));
     } else {
         return nullptr;
     }
 
     /* populate tokens */
     i = 0;
-    in_string_index = 0;
-    has_null = true;
-    prev_in_string_index = 0;
     cur_token_type = TOKEN_NULL;
 
     cur = inString;
@@ -78,21 +92,23 @@ t_token* GetTokensFromString(const char* inString, int* num_tokens) {
     while (*cur) {
         new_token_type = GetTokenTypeFromChar(cur_token_type, *cur);
         if (new_token_type != cur_token_type) {
-            if (!has_null) {
-                tokens[i - 1].data[in_string_index - prev_in_string_index] = '\0'; /* NULL the end of the data string */
-                has_null = true;
+            if (cur_token_type != TOKEN_NULL) {
+                *arena++ = '\0'; /* Terminate the previous token's data string */
             }
             if (new_token_type != TOKEN_NULL) {
                 tokens[i].type = new_token_type;
-                tokens[i].data = vtr::strdup(inString + in_string_index);
-                prev_in_string_index = in_string_index;
-                has_null = false;
+                tokens[i].data = arena;
                 i++;
             }
             cur_token_type = new_token_type;
         }
+        if (new_token_type != TOKEN_NULL) {
+            *arena++ = *cur;
+        }
         ++cur;
-        in_string_index++;
+    }
+    if (cur_token_type != TOKEN_NULL) {
+        *arena++ = '\0';
     }
 
     VTR_ASSERT(i == *num_tokens);
@@ -105,10 +121,10 @@ t_token* GetTokensFromString(const char* inString, int* num_tokens) {
 }
 
 void freeTokens(t_token* tokens, const int num_tokens) {
-    int i;
-    for (i = 0; i < num_tokens; i++) {
-        free(tokens[i].data);
-    }
+    /* The token data strings live in the same allocation as the token
+     * array (see GetTokensFromString), so there is nothing per-token to
+     * free */
+    (void)num_tokens;
     free(tokens);
 }
 
@@ -145,43 +161,36 @@ bool checkTokenType(const t_token token, enum e_token_type token_type) {
 }
 
 void my_atof_2D(float** matrix, const int max_i, const int max_j, const char* instring) {
+    /* Parses instring in place (strtof stops at the first non-numeric
+     * character), avoiding the copy of the full matrix string per call */
     int i, j;
-    char *cur, *cur2, *copy, *final;
-
-    copy = vtr::strdup(instring);
-    final = copy;
-    while (*final != '\0') {
-        final++;
-    }
+    const char* cur;
+    char* end;
 
-    cur = copy;
+    cur = instring;
     i = j = 0;
-    while (cur != final) {
-        while (IsWhitespace(*cur) && cur != final) {
-            if (j == max_j) {
-                i++;
-                j = 0;
-            }
+    while (true) {
+        while (IsWhitespace(*cur)) {
             cur++;
         }
-        if (cur == final) {
+        if (*cur == '\0') {
             break;
         }
-        cur2 = cur;
-        while (!IsWhitespace(*cur2) && cur2 != final) {
-            cur2++;
+        if (j == max_j) {
+            i++;
+            j = 0;
+        }
+        float val = std::strtof(cur, &end);
+        if (end == cur || (!IsWhitespace(*end) && *end != '\0')) {
+            throw vtr::VtrError(vtr::string_fmt("Failed to convert string '%s' to float", cur), __FILE__, __LINE__);
         }
-        *cur2 = '\0';
         VTR_ASSERT(i < max_i && j < max_j);
-        matrix[i][j] = vtr::atof(cur);
+        matrix[i][j] = val;
         j++;
-        cur = cur2;
-        *cur = ' ';
+        cur = end;
     }
 
     VTR_ASSERT((i == max_i && j == 0) || (i == max_i - 1 && j == max_j));
-
-    free(copy);
 }
 
 /* Date:July 2nd, 2013													*
@@ -21,7 +21,7 @@ enum e_token_type {
 
 struct t_token {
     enum e_token_type type;
-    char* data;
+    char* data; //Points into storage owned by the token array, freed by freeTokens()
 };
 
 t_token* GetTokensFromString(const char* inString, int* num_tokens);
@@ -74,6 +74,9 @@ class vector_map {
         }
     }
 
+    //Direct access to the underlying contiguous storage
+    const V* data() const { return vec_.data(); }
+
     std::size_t size() const { return vec_.size(); }
 
     bool empty() const { return vec_.empty(); }
@@ -95,6 +98,8 @@ class vector_map {
 
     void clear() { vec_.clear(); }
 
+    void reserve(size_t n) { vec_.reserve(n); }
+
     size_t capacity() const { return vec_.capacity(); }
     void shrink_to_fit() { vec_.shrink_to_fit(); }
 
@@ -102,6 +107,9 @@ class vector_map {
     iterator begin() { return vec_.begin(); }
     iterator end() { return vec_.end(); }
 
+    //Direct access to the underlying contiguous storage
+    V* data() { return vec_.data(); }
+
     //Indexing
     reference operator[](const K n) {
         VTR_ASSERT_SAFE_MSG(size_t(n) < vec_.size(), "Out-of-range index");
@@ -0,0 +1,63 @@
+#include "catch.hpp"
+
+#include "vtr_arena.h"
+
+#include <cstdint>
+
+TEST_CASE("Arena Aligned Allocation", "[vtr_arena]") {
+    vtr::Arena arena(1024);
+
+    for (int i = 0; i < 100; ++i) {
+        void* ptr = arena.allocate_bytes(3, 64);
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % 64 == 0);
+    }
+
+    //Oversized requests get their own block
+    char* big = arena.allocate<char>(100000);
+    big[99999] = 'x';
+
+    REQUIRE(arena.bytes_used() > 0);
+    REQUIRE(arena.bytes_reserved() >= arena.bytes_used());
+}
+
+TEST_CASE("Arena Typed Allocation", "[vtr_arena]") {
+    vtr::Arena arena;
+
+    double* values = arena.allocate<double>(16);
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(values[i] == 0.); //Default constructed
+    }
+
+    struct Point {
+        int x, y;
+    };
+    Point* point = arena.emplace<Point>(Point{3, 4});
+    REQUIRE(point->x == 3);
+    REQUIRE(point->y == 4);
+}
+
+TEST_CASE("Arena Scoped Release", "[vtr_arena]") {
+    vtr::Arena arena;
+
+    arena.allocate<int>(100);
+    size_t used_before = arena.bytes_used();
+
+    {
+        vtr::ArenaScope scope(arena);
+        arena.allocate<int>(1000);
+        REQUIRE(arena.bytes_used() > used_before);
+    }
+
+    REQUIRE(arena.bytes_used() == used_before);
+    REQUIRE(arena.peak_bytes_used() > used_before);
+
+    //Blocks are retained across clear(): re-allocating the same amount should
+    //not reserve additional memory
+    arena.clear();
+    size_t reserved = arena.bytes_reserved();
+    arena.allocate<int>(1000);
+    REQUIRE(arena.bytes_reserved() == reserved);
+
+    arena.release_memory();
+    REQUIRE(arena.bytes_reserved() == 0);
+}
@@ -0,0 +1,46 @@
+#include "catch.hpp"
+
+#include "vtr_async_write.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+std::string read_file(const std::string& filepath) {
+    std::ifstream is(filepath);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+} // namespace
+
+TEST_CASE("Basic Write", "[vtr_async_write]") {
+    std::string filepath = "test_async_write.tmp";
+
+    vtr::async_write_file(filepath, "Hello World\n");
+    vtr::flush_async_writes();
+
+    REQUIRE(read_file(filepath) == "Hello World\n");
+
+    std::remove(filepath.c_str());
+}
+
+TEST_CASE("Writes Ordered", "[vtr_async_write]") {
+    std::string filepath = "test_async_write.tmp";
+
+    //Successive writes to the same path must behave like successive
+    //synchronous writes (the last write wins)
+    for (int i = 0; i < 100; ++i) {
+        std::stringstream ss;
+        ss << "Iteration " << i << "\n";
+        vtr::async_write_file(filepath, ss.str());
+    }
+    vtr::flush_async_writes();
+
+    REQUIRE(read_file(filepath) == "Iteration 99\n");
+
+    std::remove(filepath.c_str());
+}
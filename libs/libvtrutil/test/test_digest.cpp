@@ -0,0 +1,26 @@
+#include "catch.hpp"
+
+#include "vtr_digest.h"
+
+#include <sstream>
+
+TEST_CASE("Fast Digest Known Answers", "[vtr_digest]") {
+    //Reference XXH64 vectors (seed 0)
+    std::stringstream empty("");
+    REQUIRE(vtr::fast_digest_stream(empty) == "XXH64:ef46db3751d8e999");
+
+    std::stringstream spam("Nobody inspects the spammish repetition");
+    REQUIRE(vtr::fast_digest_stream(spam) == "XXH64:fbcea83c8a378bf1");
+}
+
+TEST_CASE("Fast Digest Long Input", "[vtr_digest]") {
+    //An input long enough to exercise the stripe and chunk buffering,
+    //including a sub-stripe tail
+    std::string contents;
+    for (size_t i = 0; i < 100000; ++i) {
+        contents += char('a' + (i % 26));
+    }
+
+    std::stringstream ss(contents);
+    REQUIRE(vtr::fast_digest_stream(ss) == "XXH64:f819e3d75aa433f8");
+}
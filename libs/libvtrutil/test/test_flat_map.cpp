@@ -0,0 +1,53 @@
+#include "catch.hpp"
+
+#include "vtr_flat_map.h"
+
+#include <string>
+
+TEST_CASE("Flat Map Sorted Unique Construction", "[vtr_flat_map]") {
+    std::vector<std::pair<int, char>> values = {{1, 'a'}, {2, 'b'}, {5, 'c'}};
+
+    //Already sorted and unique: construction skips the sort/uniquify pass
+    auto map = vtr::make_flat_map(std::move(values), vtr::sorted_unique);
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at(1) == 'a');
+    REQUIRE(map.at(5) == 'c');
+    REQUIRE(map.count(3) == 0);
+}
+
+TEST_CASE("Flat Map Heterogeneous Lookup", "[vtr_flat_map]") {
+    //A transparent comparator (std::less<void>) enables look-up without
+    //constructing a temporary key
+    vtr::flat_map<std::string, int, std::less<>> map;
+    map.insert(std::make_pair(std::string("alpha"), 1));
+    map.insert(std::make_pair(std::string("beta"), 2));
+
+    const char* beta = "beta";
+    auto iter = map.find(beta);
+    REQUIRE(iter != map.end());
+    REQUIRE(iter->second == 2);
+
+    REQUIRE(map.count("gamma") == 0);
+    REQUIRE(map.lower_bound("b")->first == "beta");
+}
+
+TEST_CASE("Small Flat Map", "[vtr_flat_map]") {
+    vtr::small_flat_map<short, short> map;
+
+    for (short i = 9; i >= 0; --i) {
+        map.emplace(i, short(i * 10));
+    }
+
+    REQUIRE(map.size() == 10);
+    short expected = 0;
+    for (auto& kv : map) {
+        REQUIRE(kv.first == expected); //Iteration in sorted key order
+        REQUIRE(kv.second == expected * 10);
+        ++expected;
+    }
+
+    map.erase(short(3));
+    REQUIRE(map.find(short(3)) == map.end());
+    REQUIRE(map.size() == 9);
+}
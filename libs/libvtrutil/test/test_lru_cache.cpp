@@ -0,0 +1,37 @@
+#include "catch.hpp"
+
+#include "vtr_lru_cache.h"
+
+TEST_CASE("LRU Cache Eviction Order", "[vtr_lru_cache]") {
+    vtr::LruCache<int, int> cache(2);
+
+    cache.set(1, std::unique_ptr<int>(new int(10)));
+    cache.set(2, std::unique_ptr<int>(new int(20)));
+
+    //Touch 1 so 2 becomes least recently used
+    REQUIRE(*cache.get(1) == 10);
+
+    cache.set(3, std::unique_ptr<int>(new int(30))); //Evicts 2
+
+    REQUIRE(cache.get(2) == nullptr);
+    REQUIRE(*cache.get(1) == 10);
+    REQUIRE(*cache.get(3) == 30);
+    REQUIRE(cache.size() == 2);
+}
+
+TEST_CASE("LRU Cache Statistics", "[vtr_lru_cache]") {
+    vtr::LruCache<int, int> cache(4);
+
+    REQUIRE(cache.get(7) == nullptr);
+    cache.set(7, std::unique_ptr<int>(new int(70)));
+    REQUIRE(*cache.get(7) == 70);
+    REQUIRE(*cache.get(7) == 70);
+
+    REQUIRE(cache.hits() == 2);
+    REQUIRE(cache.misses() == 1);
+
+    //Replacing an existing key does not change the entry count
+    cache.set(7, std::unique_ptr<int>(new int(77)));
+    REQUIRE(cache.size() == 1);
+    REQUIRE(*cache.get(7) == 77);
+}
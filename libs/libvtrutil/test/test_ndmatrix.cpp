@@ -0,0 +1,113 @@
+#include "catch.hpp"
+
+#include "vtr_ndmatrix.h"
+
+TEST_CASE("NdMatrix Basic Ops", "[vtr_ndmatrix]") {
+    vtr::NdMatrix<int, 2> mat({3, 4}, 0);
+
+    REQUIRE(mat.size() == 12);
+    REQUIRE(mat.dim_size(0) == 3);
+    REQUIRE(mat.dim_size(1) == 4);
+
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            REQUIRE(mat[x][y] == 0);
+            mat[x][y] = int(x * 10 + y);
+        }
+    }
+
+    REQUIRE(mat[2][3] == 23);
+
+    mat.fill(-1);
+    REQUIRE(mat[2][3] == -1);
+}
+
+TEST_CASE("Raw Data Access", "[vtr_ndmatrix]") {
+    vtr::NdMatrix<int, 2> mat({2, 3}, 0);
+
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            mat[x][y] = int(x * 10 + y);
+        }
+    }
+
+    //Default layout is row-major: last dimension has stride 1
+    REQUIRE(mat.dim_stride(0) == 3);
+    REQUIRE(mat.dim_stride(1) == 1);
+
+    //Flat iteration visits every element
+    int sum = 0;
+    for (int val : mat) {
+        sum += val;
+    }
+    REQUIRE(sum == (0 + 1 + 2) + (10 + 11 + 12));
+
+    //flat_index() matches the proxy-based indexing
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            REQUIRE(mat.data()[mat.flat_index({x, y})] == mat[x][y]);
+        }
+    }
+}
+
+TEST_CASE("Custom Layout Order", "[vtr_ndmatrix]") {
+    //Column-major: dimension 0 is contiguous in memory
+    vtr::NdMatrix<int, 2> mat({3, 4}, {1, 0}, 0);
+
+    REQUIRE(mat.size() == 12);
+    REQUIRE(mat.dim_stride(0) == 1);
+    REQUIRE(mat.dim_stride(1) == 3);
+
+    //Indexing is unaffected by the layout
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            mat[x][y] = int(x * 10 + y);
+        }
+    }
+
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            REQUIRE(mat[x][y] == int(x * 10 + y));
+            REQUIRE(mat.data()[mat.flat_index({x, y})] == mat[x][y]);
+        }
+    }
+
+    //Dimension 0 is laid out contiguously
+    REQUIRE(mat.flat_index({1, 0}) == mat.flat_index({0, 0}) + 1);
+
+    //Copies preserve the layout
+    vtr::NdMatrix<int, 2> copy = mat;
+    REQUIRE(copy.dim_stride(0) == 1);
+    REQUIRE(copy.dim_stride(1) == 3);
+    REQUIRE(copy[2][3] == 23);
+
+    //Resizing without a layout order reverts to row-major
+    mat.resize({3, 4});
+    REQUIRE(mat.dim_stride(0) == 4);
+    REQUIRE(mat.dim_stride(1) == 1);
+}
+
+TEST_CASE("Custom Layout Order 3d", "[vtr_ndmatrix]") {
+    //Make dimension 0 the innermost (stride 1) dimension
+    vtr::NdMatrix<int, 3> mat({2, 3, 4}, {2, 1, 0}, 0);
+
+    REQUIRE(mat.dim_stride(0) == 1);
+    REQUIRE(mat.dim_stride(1) == 2);
+    REQUIRE(mat.dim_stride(2) == 6);
+
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            for (size_t z = 0; z < mat.dim_size(2); ++z) {
+                mat[x][y][z] = int(x * 100 + y * 10 + z);
+            }
+        }
+    }
+
+    for (size_t x = 0; x < mat.dim_size(0); ++x) {
+        for (size_t y = 0; y < mat.dim_size(1); ++y) {
+            for (size_t z = 0; z < mat.dim_size(2); ++z) {
+                REQUIRE(mat[x][y][z] == int(x * 100 + y * 10 + z));
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#include "catch.hpp"
+
+#include "vtr_paged_vector.h"
+
+#include <algorithm>
+
+TEST_CASE("Paged Vector Basic", "[vtr_paged_vector]") {
+    vtr::paged_vector<int, 64> vec;
+
+    REQUIRE(vec.empty());
+
+    for (int i = 0; i < 1000; ++i) {
+        vec.push_back(i);
+    }
+
+    REQUIRE(vec.size() == 1000);
+    REQUIRE(vec.front() == 0);
+    REQUIRE(vec.back() == 999);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(vec[i] == i);
+    }
+}
+
+TEST_CASE("Stable Addresses", "[vtr_paged_vector]") {
+    vtr::paged_vector<int, 64> vec;
+    vec.push_back(42);
+
+    //Unlike std::vector, growth must not relocate existing elements
+    const int* addr = &vec[0];
+    for (int i = 0; i < 1000; ++i) {
+        vec.push_back(i);
+    }
+    REQUIRE(addr == &vec[0]);
+}
+
+TEST_CASE("Iterators", "[vtr_paged_vector]") {
+    vtr::paged_vector<int, 64> vec;
+    for (int i = 1000; i > 0; --i) {
+        vec.push_back(i);
+    }
+
+    //Iterators are random access, so std::sort should work
+    std::sort(vec.begin(), vec.end());
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(vec[i] == i + 1);
+    }
+
+    REQUIRE(vec.end() - vec.begin() == 1000);
+    REQUIRE(*(vec.begin() + 500) == 501);
+}
+
+TEST_CASE("Truncate and Erase", "[vtr_paged_vector]") {
+    vtr::paged_vector<int, 64> vec;
+    for (int i = 0; i < 1000; ++i) {
+        vec.push_back(i);
+    }
+
+    vec.erase(vec.begin() + 600, vec.end()); //Tail erase
+    REQUIRE(vec.size() == 600);
+    REQUIRE(vec.back() == 599);
+
+    vec.truncate(10);
+    REQUIRE(vec.size() == 10);
+
+    vec.push_back(42); //Re-grow after truncation
+    REQUIRE(vec.size() == 11);
+    REQUIRE(vec.back() == 42);
+
+    vec.clear();
+    REQUIRE(vec.empty());
+}
+
+TEST_CASE("Compact", "[vtr_paged_vector]") {
+    vtr::paged_vector<int, 64> vec;
+    for (int i = 0; i < 1000; ++i) {
+        vec.push_back(i);
+    }
+
+    std::vector<int> flat = vec.compact();
+
+    REQUIRE(flat.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(flat[i] == i);
+    }
+    REQUIRE(vec.empty());
+}
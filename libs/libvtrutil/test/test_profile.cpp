@@ -0,0 +1,29 @@
+#include "catch.hpp"
+
+#include "vtr_profile.h"
+#include "vtr_time.h"
+
+#include <sstream>
+
+TEST_CASE("Profile Scope Tree", "[vtr_profile]") {
+    {
+        vtr::ScopedFinishTimer outer("Profile Test Outer");
+        outer.quiet(true);
+        for (int i = 0; i < 3; ++i) {
+            vtr::ScopedFinishTimer inner("Profile Test Inner");
+            inner.quiet(true);
+        }
+    }
+
+    std::ostringstream os;
+    vtr::profile::write_json(os);
+    std::string json = os.str();
+
+    //The scopes appear in the tree with their invocation counts
+    REQUIRE(json.find("\"Profile Test Outer\"") != std::string::npos);
+    REQUIRE(json.find("\"Profile Test Inner\"") != std::string::npos);
+    REQUIRE(json.find("\"num_calls\": 3") != std::string::npos);
+    REQUIRE(json.find("\"inclusive_sec\"") != std::string::npos);
+    REQUIRE(json.find("\"exclusive_sec\"") != std::string::npos);
+    REQUIRE(json.find("\"delta_max_rss_mib\"") != std::string::npos);
+}
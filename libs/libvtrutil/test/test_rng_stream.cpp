@@ -0,0 +1,50 @@
+#include "catch.hpp"
+
+#include "vtr_random.h"
+
+TEST_CASE("RngStream Known Answer", "[vtr_random]") {
+    //Philox 4x32-10 reference vector: counter = 0, key = 0
+    vtr::RngStream stream(0, 0);
+
+    REQUIRE(stream.rand_u32() == 0x6627e8d5u);
+    REQUIRE(stream.rand_u32() == 0xe169c58du);
+    REQUIRE(stream.rand_u32() == 0xbc57ac4cu);
+    REQUIRE(stream.rand_u32() == 0x9b00dbd8u);
+}
+
+TEST_CASE("RngStream Reproducible Independent Streams", "[vtr_random]") {
+    vtr::RngStream stream_a(42, 1);
+    vtr::RngStream stream_b(42, 1); //Same seed + stream id: identical sequence
+    vtr::RngStream stream_c(42, 2); //Different stream id: independent sequence
+
+    bool c_differs = false;
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t value_a = stream_a.rand_u32();
+
+        REQUIRE(value_a == stream_b.rand_u32());
+
+        if (value_a != stream_c.rand_u32()) {
+            c_differs = true;
+        }
+    }
+    REQUIRE(c_differs);
+
+    //Re-seeding restarts the sequence
+    stream_a.seed(42, 1);
+    stream_b.seed(42, 1);
+    REQUIRE(stream_a.rand_u32() == stream_b.rand_u32());
+}
+
+TEST_CASE("RngStream Ranges", "[vtr_random]") {
+    vtr::RngStream stream(7);
+
+    for (int i = 0; i < 10000; ++i) {
+        int ival = stream.irand(10);
+        REQUIRE(ival >= 0);
+        REQUIRE(ival <= 10);
+
+        float fval = stream.frand();
+        REQUIRE(fval >= 0.0f);
+        REQUIRE(fval < 1.0f);
+    }
+}
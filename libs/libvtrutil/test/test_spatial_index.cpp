@@ -0,0 +1,71 @@
+#include "catch.hpp"
+
+#include "vtr_spatial_index.h"
+#include "vtr_random.h"
+
+#include <algorithm>
+
+TEST_CASE("Spatial Index Basic", "[vtr_spatial_index]") {
+    std::vector<std::pair<vtr::Rect<int>, int>> entries;
+    entries.emplace_back(vtr::Rect<int>(0, 0, 2, 2), 0);
+    entries.emplace_back(vtr::Rect<int>(1, 1, 3, 3), 1);
+    entries.emplace_back(vtr::Rect<int>(10, 10, 12, 12), 2);
+
+    vtr::SpatialIndex<int, int> index(entries);
+
+    REQUIRE(index.size() == 3);
+
+    auto hits = index.find_intersecting(vtr::Rect<int>(1, 1, 2, 2));
+    std::sort(hits.begin(), hits.end());
+    REQUIRE(hits == std::vector<int>({0, 1}));
+
+    hits = index.find_intersecting(vtr::Rect<int>(5, 5, 6, 6));
+    REQUIRE(hits.empty());
+
+    hits = index.find_containing(vtr::Point<int>(11, 11));
+    REQUIRE(hits == std::vector<int>({2}));
+
+    index.clear();
+    REQUIRE(index.empty());
+}
+
+TEST_CASE("Spatial Index Matches Linear Scan", "[vtr_spatial_index]") {
+    constexpr size_t NUM_ENTRIES = 1000;
+    constexpr size_t NUM_QUERIES = 50;
+    constexpr int COORD_RANGE = 200;
+    constexpr int MAX_DIM = 20;
+
+    vtr::srandom(42);
+
+    std::vector<std::pair<vtr::Rect<int>, size_t>> entries;
+    for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+        int x = vtr::irand(COORD_RANGE);
+        int y = vtr::irand(COORD_RANGE);
+        entries.emplace_back(vtr::Rect<int>(x, y, x + 1 + vtr::irand(MAX_DIM), y + 1 + vtr::irand(MAX_DIM)), i);
+    }
+
+    vtr::SpatialIndex<int, size_t> index(entries);
+    REQUIRE(index.size() == NUM_ENTRIES);
+
+    for (size_t i = 0; i < NUM_QUERIES; ++i) {
+        int x = vtr::irand(COORD_RANGE);
+        int y = vtr::irand(COORD_RANGE);
+        vtr::Rect<int> query(x, y, x + 1 + vtr::irand(MAX_DIM), y + 1 + vtr::irand(MAX_DIM));
+
+        //Brute-force reference: closed-interval rectangle intersection
+        std::vector<size_t> expected;
+        for (const auto& entry : entries) {
+            const vtr::Rect<int>& rect = entry.first;
+            if (rect.xmin() <= query.xmax() && query.xmin() <= rect.xmax()
+                && rect.ymin() <= query.ymax() && query.ymin() <= rect.ymax()) {
+                expected.push_back(entry.second);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+
+        auto hits = index.find_intersecting(query);
+        std::sort(hits.begin(), hits.end());
+
+        REQUIRE(hits == expected);
+    }
+}
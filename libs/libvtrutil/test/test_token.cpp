@@ -0,0 +1,44 @@
+#include "catch.hpp"
+
+#include "vtr_token.h"
+
+#include <cstring>
+
+TEST_CASE("Tokenize", "[vtr_token]") {
+    int num_tokens = 0;
+    t_token* tokens = GetTokensFromString("foo[3:0].bar", &num_tokens);
+
+    REQUIRE(num_tokens == 8);
+
+    const char* expected_data[] = {"foo", "[", "3", ":", "0", "]", ".", "bar"};
+    e_token_type expected_type[] = {TOKEN_STRING,
+                                    TOKEN_OPEN_SQUARE_BRACKET,
+                                    TOKEN_INT,
+                                    TOKEN_COLON,
+                                    TOKEN_INT,
+                                    TOKEN_CLOSE_SQUARE_BRACKET,
+                                    TOKEN_DOT,
+                                    TOKEN_STRING};
+    for (int i = 0; i < num_tokens; ++i) {
+        REQUIRE(tokens[i].type == expected_type[i]);
+        REQUIRE(strcmp(tokens[i].data, expected_data[i]) == 0);
+    }
+
+    //The list is null-terminated
+    REQUIRE(tokens[num_tokens].type == TOKEN_NULL);
+    REQUIRE(tokens[num_tokens].data == nullptr);
+
+    freeTokens(tokens, num_tokens);
+}
+
+TEST_CASE("Tokenize Empty", "[vtr_token]") {
+    int num_tokens = -1;
+
+    REQUIRE(GetTokensFromString("", &num_tokens) == nullptr);
+    REQUIRE(num_tokens == 0);
+
+    REQUIRE(GetTokensFromString(" \t\n", &num_tokens) == nullptr);
+    REQUIRE(num_tokens == 0);
+
+    REQUIRE(GetTokensFromString(nullptr, &num_tokens) == nullptr);
+}
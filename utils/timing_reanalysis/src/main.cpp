@@ -0,0 +1,126 @@
+// Tool to re-analyze a binary timing snapshot captured from a VPR run.
+//
+// VPR writes snapshots of the timing graph, timing constraints and edge
+// delays when the 'timing_graph.analysis.snapshot.bin' echo file is enabled
+// (see timing_graph.capnp and timing_graph_serdes.h). This tool reloads such
+// a snapshot, re-runs a full setup/hold analysis on it and reports summary
+// statistics, allowing timing questions to be iterated on offline without
+// re-running the full flow.
+//
+// Usage:
+//      timing_reanalysis <snapshot_file> [<echo_file>]
+//
+// If <echo_file> is specified the re-analyzed timing state is also written
+// out in tatum's text echo format for detailed inspection.
+#include <cstdio>
+#include <limits>
+#include <string>
+
+#include "vtr_error.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/analyzer_factory.hpp"
+#include "tatum/echo_writer.hpp"
+#include "tatum/error.hpp"
+
+#include "vpr_error.h"
+
+#include "timing_graph_serdes.h"
+
+/*
+ * Exit codes to signal success/failure to scripts
+ * calling the tool
+ */
+constexpr int SUCCESS_EXIT_CODE = 0; //Everything OK
+constexpr int ERROR_EXIT_CODE = 1;   //Something went wrong internally
+
+//Summarizes the worst and total negative slack over all timing path endpoints
+struct t_slack_stats {
+    float wns = std::numeric_limits<float>::infinity();
+    float tns = 0.;
+    size_t num_failing_endpoints = 0;
+};
+
+template<typename SlackTagRangeFunc>
+static t_slack_stats collect_slack_stats(const tatum::TimingGraph& tg, SlackTagRangeFunc slack_tags) {
+    t_slack_stats stats;
+
+    for (tatum::NodeId node : tg.logical_outputs()) {
+        //The endpoint's worst slack is the minimum over its per-domain-pair slack tags
+        float node_worst_slack = std::numeric_limits<float>::infinity();
+        for (const tatum::TimingTag& tag : slack_tags(node)) {
+            node_worst_slack = std::min(node_worst_slack, tag.time().value());
+        }
+
+        if (node_worst_slack == std::numeric_limits<float>::infinity()) {
+            continue; //Unconstrained endpoint
+        }
+
+        stats.wns = std::min(stats.wns, node_worst_slack);
+        if (node_worst_slack < 0.) {
+            stats.tns += node_worst_slack;
+            ++stats.num_failing_endpoints;
+        }
+    }
+
+    return stats;
+}
+
+int main(int argc, const char** argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s <snapshot_file> [<echo_file>]\n", argv[0]);
+        return ERROR_EXIT_CODE;
+    }
+
+    std::string snapshot_file = argv[1];
+    std::string echo_file = (argc == 3) ? argv[2] : "";
+
+    try {
+        TimingGraphSnapshot snapshot;
+        {
+            vtr::ScopedStartFinishTimer timer("Loading " + snapshot_file);
+            snapshot = read_timing_graph_snapshot(snapshot_file);
+        }
+
+        tatum::TimingGraph& tg = *snapshot.graph;
+        tatum::TimingConstraints& tc = *snapshot.constraints;
+        tatum::FixedDelayCalculator& dc = *snapshot.delay_calculator;
+
+        tg.levelize();
+
+        VTR_LOG("Timing graph: %zu nodes, %zu edges, %zu levels\n",
+                tg.nodes().size(), tg.edges().size(), tg.levels().size());
+        VTR_LOG("Timing constraints: %zu clocks\n", tc.clock_domains().size());
+
+        std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis>::make(tg, tc, dc);
+        {
+            vtr::ScopedStartFinishTimer timer("Performing setup/hold analysis");
+            analyzer->update_timing();
+        }
+
+        t_slack_stats setup_stats = collect_slack_stats(tg, [&](tatum::NodeId node) { return analyzer->setup_slacks(node); });
+        t_slack_stats hold_stats = collect_slack_stats(tg, [&](tatum::NodeId node) { return analyzer->hold_slacks(node); });
+
+        VTR_LOG("\n");
+        VTR_LOG("Setup WNS: %g ns\n", 1e9 * setup_stats.wns);
+        VTR_LOG("Setup TNS: %g ns (%zu failing endpoints)\n", 1e9 * setup_stats.tns, setup_stats.num_failing_endpoints);
+        VTR_LOG("Hold WNS: %g ns\n", 1e9 * hold_stats.wns);
+        VTR_LOG("Hold TNS: %g ns (%zu failing endpoints)\n", 1e9 * hold_stats.tns, hold_stats.num_failing_endpoints);
+
+        if (!echo_file.empty()) {
+            vtr::ScopedStartFinishTimer timer("Writing " + echo_file);
+            tatum::write_echo(echo_file, tg, tc, dc, analyzer);
+        }
+    } catch (const tatum::Error& tatum_error) {
+        VTR_LOG_ERROR("%s\n", tatum_error.what());
+        return ERROR_EXIT_CODE;
+    } catch (const vtr::VtrError& vtr_error) {
+        VTR_LOG_ERROR("%s:%d %s\n", vtr_error.filename_c_str(), vtr_error.line(), vtr_error.what());
+        return ERROR_EXIT_CODE;
+    }
+
+    return SUCCESS_EXIT_CODE;
+}
@@ -97,13 +97,20 @@ int main(int argc, char** argv) {
 		}
 	}
 
+	ios::sync_with_stdio(false);
+
+	// slurp the input in one go; every pass then runs from an in-memory
+	// stream instead of hitting stdio character-by-character
+	stringstream input;
+	input << cin.rdbuf();
+
 	stringstream with_reduced_twodims;
 	{
 		stringstream with_redeclared_modules;
 		{
 			stringstream with_expanded_macros;
 			{
-				macro_expansion_pass(cin, with_expanded_macros, predef_macros);
+				macro_expansion_pass(input, with_expanded_macros, predef_macros);
 			}
 			module_redeclaration_pass(with_expanded_macros, with_redeclared_modules);
 		}
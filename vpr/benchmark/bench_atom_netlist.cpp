@@ -0,0 +1,111 @@
+#include <string>
+
+#include "vtr_memory.h"
+
+#include "atom_netlist.h"
+
+#include "bench_framework.h"
+
+/*
+ * Benchmarks for AtomNetlist construction and traversal (netlist.tpp).
+ *
+ * Builds a synthetic netlist of chained 4-input LUT-like primitives: each
+ * block drives one net and sinks the nets of the four preceding blocks.
+ * Construction stresses the create_*() paths and per-port/net pin storage;
+ * iteration stresses the pin range accessors the packer and timing graph
+ * builder loop over.
+ */
+
+namespace {
+
+constexpr size_t NUM_BLOCKS = 10000;
+constexpr size_t NUM_INPUTS = 4;
+
+//A minimal LUT-like model: one 4-bit input port, one 1-bit output port
+const t_model* lut_model() {
+    static t_model model;
+    static t_model_ports in_port;
+    static t_model_ports out_port;
+    if (model.name == nullptr) {
+        model.name = vtr::strdup("bench_lut");
+
+        in_port.dir = IN_PORT;
+        in_port.name = vtr::strdup("in");
+        in_port.size = NUM_INPUTS;
+        in_port.index = 0;
+
+        out_port.dir = OUT_PORT;
+        out_port.name = vtr::strdup("out");
+        out_port.size = 1;
+        out_port.index = 0;
+
+        model.inputs = &in_port;
+        model.outputs = &out_port;
+    }
+    return &model;
+}
+
+AtomNetlist build_netlist() {
+    const t_model* model = lut_model();
+
+    AtomNetlist netlist("benchmark");
+
+    std::vector<AtomNetId> nets;
+    nets.reserve(NUM_BLOCKS);
+    for (size_t i = 0; i < NUM_BLOCKS; ++i) {
+        nets.push_back(netlist.create_net("n" + std::to_string(i)));
+    }
+
+    for (size_t i = 0; i < NUM_BLOCKS; ++i) {
+        AtomBlockId blk = netlist.create_block("blk" + std::to_string(i), model);
+
+        AtomPortId out_port = netlist.create_port(blk, model->outputs);
+        netlist.create_pin(out_port, 0, nets[i], PinType::DRIVER);
+
+        AtomPortId in_port = netlist.create_port(blk, model->inputs);
+        for (size_t ipin = 0; ipin < NUM_INPUTS; ++ipin) {
+            AtomNetId net = nets[(i + 1 + ipin) % NUM_BLOCKS];
+            netlist.create_pin(in_port, ipin, net, PinType::SINK);
+        }
+    }
+
+    return netlist;
+}
+
+int reg_construct = bench::register_benchmark(
+    "atom_netlist/construct",
+    [] {
+        AtomNetlist netlist = build_netlist();
+        bench::do_not_optimize(netlist.pins().size());
+    });
+
+int reg_iterate = bench::register_benchmark(
+    "atom_netlist/iterate_net_pins",
+    [] {
+        //Built once (untimed); only traversal is measured per repetition
+        static AtomNetlist netlist = build_netlist();
+
+        size_t checksum = 0;
+        for (AtomNetId net : netlist.nets()) {
+            for (AtomPinId pin : netlist.net_pins(net)) {
+                checksum += size_t(netlist.pin_block(pin));
+            }
+        }
+        bench::do_not_optimize(checksum);
+    });
+
+int reg_iterate_blocks = bench::register_benchmark(
+    "atom_netlist/iterate_block_pins",
+    [] {
+        static AtomNetlist netlist = build_netlist();
+
+        size_t checksum = 0;
+        for (AtomBlockId blk : netlist.blocks()) {
+            for (AtomPinId pin : netlist.block_pins(blk)) {
+                checksum += size_t(netlist.pin_net(pin));
+            }
+        }
+        bench::do_not_optimize(checksum);
+    });
+
+} // namespace
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "vtr_log.h"
+
+#include "bench_framework.h"
+
+namespace bench {
+
+struct Benchmark {
+    std::string name;
+    std::function<void()> kernel;
+};
+
+//Meyers singleton so registration from static initializers in other
+//translation units is safe regardless of initialization order
+static std::vector<Benchmark>& registry() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+int register_benchmark(std::string name, std::function<void()> kernel) {
+    registry().push_back({std::move(name), std::move(kernel)});
+    return 0;
+}
+
+Stats measure(const std::function<void()>& kernel, size_t num_runs) {
+    //Warm-up run: excluded from the statistics so one-time costs
+    //(page faults, allocator growth, cold caches) don't skew them
+    kernel();
+
+    std::vector<double> samples_ms;
+    samples_ms.reserve(num_runs);
+    for (size_t i = 0; i < num_runs; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        kernel();
+        auto end = std::chrono::steady_clock::now();
+
+        samples_ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(samples_ms.begin(), samples_ms.end());
+
+    Stats stats;
+    stats.min_ms = samples_ms.front();
+    stats.max_ms = samples_ms.back();
+    stats.median_ms = samples_ms[samples_ms.size() / 2];
+
+    double sum = 0.;
+    for (double sample : samples_ms) {
+        sum += sample;
+    }
+    stats.mean_ms = sum / samples_ms.size();
+
+    double sq_dev_sum = 0.;
+    for (double sample : samples_ms) {
+        sq_dev_sum += (sample - stats.mean_ms) * (sample - stats.mean_ms);
+    }
+    stats.stddev_ms = std::sqrt(sq_dev_sum / samples_ms.size());
+
+    return stats;
+}
+
+int run_benchmarks(const std::string& filter, size_t num_runs) {
+    VTR_LOG("%-50s %10s %10s %10s %10s %10s\n",
+            "Benchmark", "Min(ms)", "Median(ms)", "Mean(ms)", "Stdev(ms)", "Max(ms)");
+
+    int num_run = 0;
+    for (const Benchmark& benchmark : registry()) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        Stats stats = measure(benchmark.kernel, num_runs);
+        VTR_LOG("%-50s %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                benchmark.name.c_str(),
+                stats.min_ms, stats.median_ms, stats.mean_ms, stats.stddev_ms, stats.max_ms);
+        ++num_run;
+    }
+
+    return num_run;
+}
+
+} // namespace bench
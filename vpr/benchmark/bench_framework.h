@@ -0,0 +1,59 @@
+#ifndef BENCH_FRAMEWORK_H
+#define BENCH_FRAMEWORK_H
+#include <functional>
+#include <string>
+
+/*
+ * Minimal micro-benchmark harness for VPR's hot kernels.
+ *
+ * Each benchmark is a void() kernel registered with register_benchmark().
+ * The runner times every kernel over a number of repetitions and reports
+ * summary statistics (min/median/mean/stddev), so a change's effect can be
+ * judged against run-to-run noise rather than a single wall-clock sample.
+ *
+ * Benchmarks measure relative kernel cost on synthetic inputs; they are not
+ * pass/fail tests and are deliberately not registered with CTest. Build the
+ * benchmark_vpr target and run it manually (optionally passing a substring
+ * filter) before/after a performance-sensitive change.
+ */
+
+namespace bench {
+
+//Summary statistics over the timed repetitions of one kernel (milliseconds)
+struct Stats {
+    double min_ms = 0.;
+    double max_ms = 0.;
+    double mean_ms = 0.;
+    double median_ms = 0.;
+    double stddev_ms = 0.;
+};
+
+//Registers a named kernel to be run by run_benchmarks().
+//Returns a dummy value so registration can be done from a static initializer.
+int register_benchmark(std::string name, std::function<void()> kernel);
+
+//Times 'kernel' num_runs times and computes summary statistics
+Stats measure(const std::function<void()>& kernel, size_t num_runs);
+
+//Runs (and reports) all registered benchmarks whose name contains 'filter'
+//(an empty filter matches everything). Returns the number of benchmarks run.
+int run_benchmarks(const std::string& filter, size_t num_runs);
+
+//Forces the compiler to consider 'value' used, preventing it from
+//optimizing away the computation which produced it
+template<class T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 : "r,m"(value)
+                 : "memory");
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,66 @@
+#include "vtr_ndmatrix.h"
+
+#include "bench_framework.h"
+
+/*
+ * Benchmarks for vtr::NdMatrix access patterns (vtr_ndmatrix.h).
+ *
+ * The same logical traversal is timed against matching and mismatching
+ * storage layouts, quantifying the cost of striding against the memory
+ * order (e.g. a y-inner loop over x-major storage) and the benefit of the
+ * layout_order constructor when the dominant traversal order is known.
+ */
+
+namespace {
+
+constexpr size_t DIM = 2000;
+
+vtr::NdMatrix<float, 2> make_matrix(std::array<size_t, 2> layout_order) {
+    vtr::NdMatrix<float, 2> mat({DIM, DIM}, layout_order, 0.f);
+    for (size_t x = 0; x < DIM; ++x) {
+        for (size_t y = 0; y < DIM; ++y) {
+            mat[x][y] = float(x) - float(y);
+        }
+    }
+    return mat;
+}
+
+float traverse_y_inner(const vtr::NdMatrix<float, 2>& mat) {
+    float checksum = 0.f;
+    for (size_t x = 0; x < DIM; ++x) {
+        for (size_t y = 0; y < DIM; ++y) {
+            checksum += mat[x][y];
+        }
+    }
+    return checksum;
+}
+
+int reg_matching = bench::register_benchmark(
+    "ndmatrix/traverse/matching_layout",
+    [] {
+        //Row-major storage, y-inner traversal: unit stride
+        static vtr::NdMatrix<float, 2> mat = make_matrix({0, 1});
+        bench::do_not_optimize(traverse_y_inner(mat));
+    });
+
+int reg_mismatched = bench::register_benchmark(
+    "ndmatrix/traverse/mismatched_layout",
+    [] {
+        //Column-major storage, y-inner traversal: stride DIM
+        static vtr::NdMatrix<float, 2> mat = make_matrix({1, 0});
+        bench::do_not_optimize(traverse_y_inner(mat));
+    });
+
+int reg_flat = bench::register_benchmark(
+    "ndmatrix/traverse/flat",
+    [] {
+        //Layout-independent traversal through the raw storage
+        static vtr::NdMatrix<float, 2> mat = make_matrix({0, 1});
+        float checksum = 0.f;
+        for (float val : mat) {
+            checksum += val;
+        }
+        bench::do_not_optimize(checksum);
+    });
+
+} // namespace
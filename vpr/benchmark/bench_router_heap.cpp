@@ -0,0 +1,72 @@
+#include <vector>
+
+#include "vtr_random.h"
+
+#include "device_grid.h"
+#include "route_common.h"
+#include "vpr_types.h"
+
+#include "bench_framework.h"
+
+/*
+ * Benchmarks for the router's wavefront priority queue (route_common.cpp).
+ *
+ * Pushes a fixed set of pseudo-randomly ordered costs and then drains the
+ * heap, which exercises both sift_up (add_to_heap) and sift_down
+ * (get_heap_head) along with the t_heap free-list allocator. Run once for
+ * each heap arity so binary vs 4-ary changes can be compared directly.
+ */
+
+namespace {
+
+constexpr size_t HEAP_ELEMENTS = 100000;
+
+//Deterministic costs, pre-generated so the timed region measures only heap work
+std::vector<float>& heap_costs() {
+    static std::vector<float> costs;
+    if (costs.empty()) {
+        vtr::srandom(1);
+        costs.reserve(HEAP_ELEMENTS);
+        for (size_t i = 0; i < HEAP_ELEMENTS; ++i) {
+            costs.push_back(vtr::frand());
+        }
+    }
+    return costs;
+}
+
+void push_pop_heap(e_heap_type heap_type) {
+    const std::vector<float>& costs = heap_costs();
+
+    //init_heap() sizes the heap from the device grid; an empty synthetic
+    //grid suffices since the heap grows on demand
+    DeviceGrid grid("benchmark", vtr::Matrix<t_grid_tile>({100, 100}));
+    set_router_heap_type(heap_type);
+    init_heap(grid);
+
+    for (size_t i = 0; i < costs.size(); ++i) {
+        t_heap* hptr = alloc_heap_data();
+        hptr->index = int(i);
+        hptr->cost = costs[i];
+        add_to_heap(hptr);
+    }
+
+    float checksum = 0.;
+    while (!is_empty_heap()) {
+        t_heap* hptr = get_heap_head();
+        checksum += hptr->cost;
+        free_heap_data(hptr);
+    }
+    bench::do_not_optimize(checksum);
+
+    empty_heap();
+}
+
+int reg_binary = bench::register_benchmark(
+    "router_heap/push_pop/binary",
+    [] { push_pop_heap(e_heap_type::BINARY_HEAP); });
+
+int reg_four_ary = bench::register_benchmark(
+    "router_heap/push_pop/four_ary",
+    [] { push_pop_heap(e_heap_type::FOUR_ARY_HEAP); });
+
+} // namespace
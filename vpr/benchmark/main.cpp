@@ -0,0 +1,42 @@
+#include <cstdlib>
+
+#include "vtr_log.h"
+
+#include "bench_framework.h"
+
+/*
+ * Entry point for VPR's micro-benchmarks.
+ *
+ * Usage: benchmark_vpr [name_filter] [num_runs]
+ *
+ * Runs every benchmark whose name contains 'name_filter' (all of them if no
+ * filter is given), timing each one 'num_runs' times (default 10) and
+ * reporting min/median/mean/stddev/max per kernel.
+ *
+ * The individual benchmarks register themselves from static initializers in
+ * the bench_*.cpp files in this directory.
+ */
+
+int main(int argc, char** argv) {
+    std::string filter;
+    size_t num_runs = 10;
+
+    if (argc > 1) {
+        filter = argv[1];
+    }
+    if (argc > 2) {
+        num_runs = std::atoi(argv[2]);
+        if (num_runs == 0) {
+            VTR_LOG_ERROR("Invalid number of runs '%s'\n", argv[2]);
+            return 1;
+        }
+    }
+
+    int num_run = bench::run_benchmarks(filter, num_runs);
+    if (num_run == 0) {
+        VTR_LOG_ERROR("No benchmarks matched filter '%s'\n", filter.c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -150,37 +150,61 @@ static DeviceGrid auto_size_device_grid(const std::vector<t_grid_def>& grid_layo
         //Initial size is 3x3, the smallest possible while avoiding
         //start before end location issues with <perimeter> location
         //specifications
-        size_t width = 3;
-        size_t height = 3;
         std::vector<t_physical_tile_type_ptr> limiting_resources;
-        do {
+
+        //Evaluates whether the device satisfies the block counts at the
+        //specified width (height follows from the aspect ratio)
+        auto satisfies = [&](size_t candidate_width) {
             //Scale opposite dimension to match aspect ratio
-            height = vtr::nint(width / grid_def.aspect_ratio);
+            size_t candidate_height = vtr::nint(candidate_width / grid_def.aspect_ratio);
 
 #ifdef VERBOSE
-            VTR_LOG("Grid size: %zu x %zu (AR: %.2f) \n", width, height, float(width) / height);
+            VTR_LOG("Grid size: %zu x %zu (AR: %.2f) \n", candidate_width, candidate_height, float(candidate_width) / candidate_height);
 #endif
 
             //Build the device
             // Don't warn about out-of-range specifications since these can
             // occur (harmlessly) at small device dimensions
-            grid = build_device_grid(grid_def, width, height, false, limiting_resources);
+            DeviceGrid candidate_grid = build_device_grid(grid_def, candidate_width, candidate_height, false, limiting_resources);
 
             //Check if it satisfies the block counts
-            if (grid_satisfies_instance_counts(grid, minimum_instance_counts, maximum_device_utilization)) {
-                //Re-build the grid at the final size with out-of-range
-                //warnings turned on (so users are aware of out-of-range issues
-                //at the final device sizes)
-                grid = build_device_grid(grid_def, width, height, true, limiting_resources);
-                return grid;
+            if (grid_satisfies_instance_counts(candidate_grid, minimum_instance_counts, maximum_device_utilization)) {
+                return true;
             }
 
-            limiting_resources = grid_overused_resources(grid, minimum_instance_counts);
+            limiting_resources = grid_overused_resources(candidate_grid, minimum_instance_counts);
+            return false;
+        };
+
+        //Building a candidate grid runs the full priority fill, so it is far
+        //too expensive to evaluate at every width. Since growing the device
+        //only adds block instances, feasibility is monotonic in the width:
+        //gallop (doubling the width) to find a satisfying upper bound, then
+        //binary search the smallest satisfying width. This evaluates
+        //O(log(final width)) candidates instead of one per unit of width.
+        size_t lo = 3;
+        size_t hi = lo;
+        while (!satisfies(hi)) {
+            lo = hi + 1;
+            hi = hi * 2;
+        }
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (satisfies(mid)) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
 
-            //Increase the grid size
-            width++;
+        size_t width = lo;
+        size_t height = vtr::nint(width / grid_def.aspect_ratio);
 
-        } while (true);
+        //Re-build the grid at the final size with out-of-range
+        //warnings turned on (so users are aware of out-of-range issues
+        //at the final device sizes)
+        grid = build_device_grid(grid_def, width, height, true, limiting_resources);
+        return grid;
 
     } else {
         VTR_ASSERT(auto_layout_itr == grid_layouts.end());
@@ -321,8 +321,11 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
 
     RouterOpts->verify_binary_search = Options.verify_binary_search;
     RouterOpts->router_algorithm = Options.RouterAlgorithm;
+    RouterOpts->router_heap = Options.RouterHeap;
+    RouterOpts->router_num_workers = Options.RouterNumWorkers;
     RouterOpts->fixed_channel_width = Options.RouteChanWidth;
     RouterOpts->min_channel_width_hint = Options.min_route_chan_width_hint;
+    RouterOpts->speculative_width_probes = Options.route_speculative_width_probes;
 
     //TODO document these?
     RouterOpts->trim_empty_channels = false; /* DEFAULT */
@@ -332,6 +335,7 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->base_cost_type = Options.base_cost_type;
     RouterOpts->first_iter_pres_fac = Options.first_iter_pres_fac;
     RouterOpts->acc_fac = Options.acc_fac;
+    RouterOpts->adaptive_pres_fac = Options.router_adaptive_pres_fac;
     RouterOpts->bend_cost = Options.bend_cost;
     if (Options.do_routing) {
         RouterOpts->doRouting = STAGE_DO;
@@ -339,6 +343,12 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->routing_failure_predictor = Options.routing_failure_predictor;
     RouterOpts->routing_budgets_algorithm = Options.routing_budgets_algorithm;
     RouterOpts->save_routing_per_iteration = Options.save_routing_per_iteration;
+    RouterOpts->route_checkpoint_file = Options.route_checkpoint_file;
+    RouterOpts->route_resume = Options.route_resume;
+    RouterOpts->checkpoint_interval = Options.checkpoint_interval;
+    RouterOpts->router_telemetry_file = Options.router_telemetry_file;
+    RouterOpts->connection_trace_file = Options.route_connection_trace_file;
+    RouterOpts->route_replay_file = Options.route_replay_file;
     RouterOpts->congested_routing_iteration_threshold_frac = Options.congested_routing_iteration_threshold_frac;
     RouterOpts->route_bb_update = Options.route_bb_update;
     RouterOpts->clock_modeling = Options.clock_modeling;
@@ -417,6 +427,7 @@ void SetupPackerOpts(const t_options& Options,
     PackerOpts->high_fanout_threshold = Options.pack_high_fanout_threshold;
     PackerOpts->transitive_fanout_threshold = Options.pack_transitive_fanout_threshold;
     PackerOpts->feasible_block_array_size = Options.pack_feasible_block_array_size;
+    PackerOpts->reuse_prev_packing = Options.pack_reuse_prev_packing;
 
     //TODO: document?
     PackerOpts->inter_cluster_net_delay = 1.0; /* DEFAULT */
@@ -481,6 +492,11 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
 
     PlacerOpts->rlim_escape_fraction = Options.place_rlim_escape_fraction;
     PlacerOpts->move_stats_file = Options.place_move_stats_file;
+    PlacerOpts->temperature_stats_file = Options.place_temperature_stats_file;
+    PlacerOpts->enable_analytic_placer = Options.enable_analytic_placement;
+    PlacerOpts->read_initial_place_file = Options.read_initial_place_file;
+    PlacerOpts->place_checkpoint_file = Options.place_checkpoint_file;
+    PlacerOpts->checkpoint_interval = Options.checkpoint_interval;
 
     PlacerOpts->strict_checks = Options.strict_checks;
 
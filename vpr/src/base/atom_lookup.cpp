@@ -67,12 +67,11 @@ void AtomLookup::set_atom_pin_pb_graph_pin(AtomPinId atom_pin, const t_pb_graph_
  */
 ClusterBlockId AtomLookup::atom_clb(const AtomBlockId blk_id) const {
     VTR_ASSERT(blk_id);
-    auto iter = atom_to_clb_.find(blk_id);
-    if (iter == atom_to_clb_.end()) {
+    if (!atom_to_clb_.contains(blk_id)) {
         return ClusterBlockId::INVALID();
     }
 
-    return *iter;
+    return atom_to_clb_[blk_id];
 }
 
 void AtomLookup::set_atom_clb(const AtomBlockId blk_id, const ClusterBlockId clb) {
@@ -85,21 +84,19 @@ void AtomLookup::set_atom_clb(const AtomBlockId blk_id, const ClusterBlockId clb
  * Nets
  */
 AtomNetId AtomLookup::atom_net(const ClusterNetId clb_net_index) const {
-    auto iter = atom_net_to_clb_net_.find(clb_net_index);
-    if (iter == atom_net_to_clb_net_.inverse_end()) {
+    if (!clb_net_to_atom_net_.contains(clb_net_index)) {
         //Not found
         return AtomNetId::INVALID();
     }
-    return iter->second;
+    return clb_net_to_atom_net_[clb_net_index];
 }
 
 ClusterNetId AtomLookup::clb_net(const AtomNetId net_id) const {
-    auto iter = atom_net_to_clb_net_.find(net_id);
-    if (iter == atom_net_to_clb_net_.end()) {
+    if (!atom_net_to_clb_net_.contains(net_id)) {
         //Not found
         return ClusterNetId::INVALID();
     }
-    return iter->second;
+    return atom_net_to_clb_net_[net_id];
 }
 
 void AtomLookup::set_atom_clb_net(const AtomNetId net_id, const ClusterNetId clb_net_index) {
@@ -107,13 +104,22 @@ void AtomLookup::set_atom_clb_net(const AtomNetId net_id, const ClusterNetId clb
     //If either are invalid remove any mapping
     if (!net_id && clb_net_index != ClusterNetId::INVALID()) {
         //Remove
-        atom_net_to_clb_net_.erase(clb_net_index);
+        AtomNetId old_atom_net = atom_net(clb_net_index);
+        if (old_atom_net) {
+            atom_net_to_clb_net_.update(old_atom_net, ClusterNetId::INVALID());
+        }
+        clb_net_to_atom_net_.update(clb_net_index, AtomNetId::INVALID());
     } else if (net_id && clb_net_index == ClusterNetId::INVALID()) {
         //Remove
-        atom_net_to_clb_net_.erase(net_id);
+        ClusterNetId old_clb_net = clb_net(net_id);
+        if (old_clb_net) {
+            clb_net_to_atom_net_.update(old_clb_net, AtomNetId::INVALID());
+        }
+        atom_net_to_clb_net_.update(net_id, ClusterNetId::INVALID());
     } else if (net_id && clb_net_index != ClusterNetId::INVALID()) {
         //Store
         atom_net_to_clb_net_.update(net_id, clb_net_index);
+        clb_net_to_atom_net_.update(clb_net_index, net_id);
     }
 }
 
@@ -121,16 +127,15 @@ void AtomLookup::set_atom_clb_net(const AtomNetId net_id, const ClusterNetId clb
  * Timing Nodes
  */
 tatum::NodeId AtomLookup::atom_pin_tnode(const AtomPinId pin, BlockTnode block_tnode_type) const {
+    //Any pin with no associated tnode holds the sentinel tatum::NodeId::INVALID()
     if (block_tnode_type == BlockTnode::EXTERNAL) {
-        auto iter = atom_pin_tnode_external_.find(pin);
-        if (iter != atom_pin_tnode_external_.end()) {
-            return iter->second;
+        if (atom_pin_tnode_external_.contains(pin)) {
+            return atom_pin_tnode_external_[pin];
         }
     } else {
         VTR_ASSERT(block_tnode_type == BlockTnode::INTERNAL);
-        auto iter = atom_pin_tnode_internal_.find(pin);
-        if (iter != atom_pin_tnode_internal_.end()) {
-            return iter->second;
+        if (atom_pin_tnode_internal_.contains(pin)) {
+            return atom_pin_tnode_internal_[pin];
         }
     }
 
@@ -138,28 +143,27 @@ tatum::NodeId AtomLookup::atom_pin_tnode(const AtomPinId pin, BlockTnode block_t
 }
 
 AtomPinId AtomLookup::tnode_atom_pin(const tatum::NodeId tnode) const {
-    auto iter = tnode_atom_pin_.find(tnode);
-    if (iter != tnode_atom_pin_.end()) {
-        return iter->second;
+    if (tnode_atom_pin_.contains(tnode)) {
+        return tnode_atom_pin_[tnode];
     }
 
     return AtomPinId::INVALID(); //Not found
 }
 
-AtomLookup::tnode_pin_range AtomLookup::tnode_atom_pins() const {
-    return vtr::make_range(tnode_atom_pin_.begin(), tnode_atom_pin_.end());
+const vtr::vector_map<tatum::NodeId, AtomPinId>& AtomLookup::tnode_atom_pins() const {
+    return tnode_atom_pin_;
 }
 
 void AtomLookup::set_atom_pin_tnode(const AtomPinId pin, const tatum::NodeId node, BlockTnode block_tnode_type) {
     //A pin always expands to an external tnode (i.e. it's external connectivity in the netlist)
     //but some pins may expand to an additional tnode (i.e. to SOURCE/SINK to cover internal sequential paths within a block)
     if (block_tnode_type == BlockTnode::EXTERNAL) {
-        atom_pin_tnode_external_[pin] = node;
+        atom_pin_tnode_external_.update(pin, node);
     } else {
         VTR_ASSERT(block_tnode_type == BlockTnode::INTERNAL);
-        atom_pin_tnode_internal_[pin] = node;
+        atom_pin_tnode_internal_.update(pin, node);
     }
 
     //Each tnode maps to precisely one pin
-    tnode_atom_pin_[node] = pin;
+    tnode_atom_pin_.update(node, pin);
 }
@@ -6,7 +6,6 @@
 
 #include "vtr_bimap.h"
 #include "vtr_vector_map.h"
-#include "vtr_range.h"
 
 #include "atom_netlist_fwd.h"
 #include "clustered_netlist_fwd.h"
@@ -15,13 +14,12 @@
 /*
  * The AtomLookup class describes the mapping between components in the AtomNetlist
  * and other netlists/entities (i.e. atom block <-> t_pb, atom block <-> clb)
+ *
+ * Since the atom/cluster/timing-graph id spaces are all dense, the mappings
+ * consulted in timing inner loops (e.g. atom_pin_tnode()) are stored as flat
+ * vectors indexed by id, giving O(1) forward and reverse lookup.
  */
 class AtomLookup {
-  public:
-    typedef vtr::linear_map<tatum::NodeId, AtomPinId>::const_iterator tnode_pin_iterator;
-
-    typedef vtr::Range<tnode_pin_iterator> tnode_pin_range;
-
   public:
     /*
      * PBs
@@ -83,25 +81,29 @@ class AtomLookup {
     //Returns the atom netlist pin associated with the specified timing graph node
     AtomPinId tnode_atom_pin(const tatum::NodeId tnode) const;
 
-    //Returns a range of all tnode to pin mappings
-    tnode_pin_range tnode_atom_pins() const;
+    //Returns the full tnode to pin mapping, indexed by tnode
+    // Note: tnodes with no associated pin (gaps in the id space) map to AtomPinId::INVALID()
+    const vtr::vector_map<tatum::NodeId, AtomPinId>& tnode_atom_pins() const;
 
     //Sets the bi-directional mapping between an atom netlist pin and timing graph node
     void set_atom_pin_tnode(const AtomPinId pin, const tatum::NodeId node, BlockTnode block_tnode_type = BlockTnode::EXTERNAL);
 
   private: //Types
   private:
+    //t_pb pointers are not a dense id space, so the pb mapping (which is not
+    //consulted in timing inner loops) remains map based
     vtr::bimap<AtomBlockId, const t_pb*, vtr::linear_map, std::unordered_map> atom_to_pb_;
 
     vtr::vector_map<AtomPinId, const t_pb_graph_pin*> atom_pin_to_pb_graph_pin_;
 
     vtr::vector_map<AtomBlockId, ClusterBlockId> atom_to_clb_;
 
-    vtr::bimap<AtomNetId, ClusterNetId, vtr::linear_map, vtr::linear_map> atom_net_to_clb_net_;
+    vtr::vector_map<AtomNetId, ClusterNetId> atom_net_to_clb_net_;
+    vtr::vector_map<ClusterNetId, AtomNetId> clb_net_to_atom_net_;
 
-    vtr::linear_map<AtomPinId, tatum::NodeId> atom_pin_tnode_external_;
-    vtr::linear_map<AtomPinId, tatum::NodeId> atom_pin_tnode_internal_;
-    vtr::linear_map<tatum::NodeId, AtomPinId> tnode_atom_pin_;
+    vtr::vector_map<AtomPinId, tatum::NodeId> atom_pin_tnode_external_;
+    vtr::vector_map<AtomPinId, tatum::NodeId> atom_pin_tnode_internal_;
+    vtr::vector_map<tatum::NodeId, AtomPinId> tnode_atom_pin_;
 };
 
 #endif
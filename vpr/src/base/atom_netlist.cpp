@@ -9,6 +9,9 @@
 #include "vtr_log.h"
 #include "vpr_error.h"
 
+//Explicit instantiation of the base Netlist for the atom ids (see atom_netlist.h)
+template class Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId>;
+
 /*
  *
  *
@@ -255,6 +258,15 @@ void AtomNetlist::shrink_to_fit_impl() {
     port_models_.shrink_to_fit();
 }
 
+void AtomNetlist::reserve_impl(size_t num_blocks, size_t num_ports, size_t /*num_pins*/, size_t /*num_nets*/) {
+    //Block data
+    block_models_.reserve(num_blocks);
+    block_truth_tables_.reserve(num_blocks);
+
+    //Port data
+    port_models_.reserve(num_ports);
+}
+
 /*
  *
  * Sanity Checks
@@ -77,6 +77,12 @@
 #include "netlist.h"
 #include "atom_netlist_fwd.h"
 
+//The base Netlist for the atom ids is explicitly instantiated in
+//atom_netlist.cpp, so other translation units don't each re-instantiate
+//its (header-defined) members. The definitions remain visible here so the
+//hot accessors can still be inlined
+extern template class Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId>;
+
 class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId> {
   public:
     //Constructs a netlist
@@ -190,6 +196,9 @@ class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId
     //Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
+    //Pre-allocates internal data structures (see Netlist::reserve())
+    void reserve_impl(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) override;
+
     /*
      * Sanity checks
      */
@@ -0,0 +1,261 @@
+#include <fstream>
+#include <sstream>
+
+#include "atom_netlist_cache.h"
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_digest.h"
+
+#include "vpr_error.h"
+#include "vpr_utils.h"
+
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "atom_netlist.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif
+
+std::string atom_netlist_cache_key(e_circuit_format circuit_format,
+                                   const char* circuit_file,
+                                   const t_netlist_opts& netlist_opts) {
+    //Note the verbosity is excluded, since it does not affect the
+    //resulting netlist
+    std::stringstream key;
+    key << vtr::fast_digest_file(circuit_file); //Cache key only; no need for a cryptographic hash
+    key << "/format" << int(circuit_format);
+    key << "/const_gen_inference" << int(netlist_opts.const_gen_inference);
+    key << "/absorb_buffer_luts" << netlist_opts.absorb_buffer_luts;
+    key << "/sweep_dangling_primary_ios" << netlist_opts.sweep_dangling_primary_ios;
+    key << "/sweep_dangling_nets" << netlist_opts.sweep_dangling_nets;
+    key << "/sweep_dangling_blocks" << netlist_opts.sweep_dangling_blocks;
+    key << "/sweep_constant_primary_outputs" << netlist_opts.sweep_constant_primary_outputs;
+    return key.str();
+}
+
+#ifdef VTR_ENABLE_CAPNPROTO
+
+bool try_load_atom_netlist_cache(const char* cache_file,
+                                 const std::string& cache_key,
+                                 const t_model* user_models,
+                                 const t_model* library_models,
+                                 AtomNetlist& netlist) {
+    {
+        std::ifstream file_check(cache_file);
+        if (!file_check) {
+            return false; //No cache written yet
+        }
+    }
+
+    try {
+        MmapFile f(cache_file);
+        ::capnp::ReaderOptions opts = ::capnp::ReaderOptions();
+        opts.traversalLimitInWords = kj::maxValue; //Allow arbitrarily large netlists
+        ::capnp::FlatArrayMessageReader reader(f.getData(), opts);
+        auto cached_netlist = reader.getRoot<VprAtomNetlist>();
+
+        if (std::string(cached_netlist.getCacheKey().cStr()) != cache_key) {
+            VTR_LOG("Atom netlist cache '%s' does not match the current circuit/options, re-elaborating\n", cache_file);
+            return false;
+        }
+
+        AtomNetlist loaded_netlist(cached_netlist.getNetlistName().cStr(), cached_netlist.getNetlistId().cStr());
+
+        //Nets (created first so pins can reference them)
+        for (auto net_name : cached_netlist.getNetNames()) {
+            loaded_netlist.create_net(net_name.cStr());
+        }
+
+        //Blocks
+        for (auto cached_block : cached_netlist.getBlocks()) {
+            const char* model_name = cached_block.getModelName().cStr();
+            const t_model* model = find_model(user_models, model_name, false);
+            if (!model) {
+                model = find_model(library_models, model_name, false);
+            }
+            if (!model) {
+                VTR_LOG("Atom netlist cache '%s' references model '%s' missing from the loaded architecture, re-elaborating\n",
+                        cache_file, model_name);
+                return false;
+            }
+
+            AtomNetlist::TruthTable truth_table;
+            auto cached_truth_table = cached_block.getTruthTable();
+            truth_table.reserve(cached_truth_table.size());
+            for (auto cached_row : cached_truth_table) {
+                std::vector<vtr::LogicValue> row;
+                row.reserve(cached_row.getValues().size());
+                for (int8_t value : cached_row.getValues()) {
+                    row.push_back(static_cast<vtr::LogicValue>(value));
+                }
+                truth_table.push_back(std::move(row));
+            }
+
+            AtomBlockId blk_id = loaded_netlist.create_block(cached_block.getName().cStr(), model, truth_table);
+
+            for (auto cached_attr : cached_block.getAttrs()) {
+                loaded_netlist.set_block_attr(blk_id, cached_attr.getName().cStr(), cached_attr.getValue().cStr());
+            }
+            for (auto cached_param : cached_block.getParams()) {
+                loaded_netlist.set_block_param(blk_id, cached_param.getName().cStr(), cached_param.getValue().cStr());
+            }
+        }
+
+        //Ports
+        for (auto cached_port : cached_netlist.getPorts()) {
+            AtomBlockId blk_id(cached_port.getBlockId());
+            const t_model* model = loaded_netlist.block_model(blk_id);
+
+            const char* port_name = cached_port.getModelPortName().cStr();
+            const t_model_ports* model_port = find_model_port(model, port_name, false);
+            if (!model_port) {
+                VTR_LOG("Atom netlist cache '%s' references port '%s' missing from model '%s', re-elaborating\n",
+                        cache_file, port_name, model->name);
+                return false;
+            }
+
+            loaded_netlist.create_port(blk_id, model_port);
+        }
+
+        //Pins
+        //
+        //Pins are stored in id (i.e. creation) order, so re-creating them in
+        //order also reproduces the original net sink ordering
+        for (auto cached_pin : cached_netlist.getPins()) {
+            loaded_netlist.create_pin(AtomPortId(cached_pin.getPortId()),
+                                      cached_pin.getPortBit(),
+                                      AtomNetId(cached_pin.getNetId()),
+                                      cached_pin.getIsDriver() ? PinType::DRIVER : PinType::SINK,
+                                      cached_pin.getIsConst());
+        }
+
+        loaded_netlist.verify();
+
+        netlist = std::move(loaded_netlist);
+        return true;
+    } catch (...) {
+        VTR_LOG_WARN("Failed to load atom netlist cache '%s', re-elaborating\n", cache_file);
+        return false;
+    }
+}
+
+void save_atom_netlist_cache(const char* cache_file,
+                             const std::string& cache_key,
+                             const AtomNetlist& netlist) {
+    //Pins referencing removed nets can not be represented. Since the netlist
+    //was compressed after sweeping this should not occur, but skip caching
+    //rather than write a broken cache if it does
+    for (AtomPinId pin_id : netlist.pins()) {
+        if (!netlist.pin_net(pin_id)) {
+            VTR_LOG_WARN("Not writing atom netlist cache '%s': netlist contains pins with no associated net\n", cache_file);
+            return;
+        }
+    }
+
+    ::capnp::MallocMessageBuilder builder;
+    auto cached_netlist = builder.initRoot<VprAtomNetlist>();
+
+    cached_netlist.setCacheKey(cache_key.c_str());
+    cached_netlist.setNetlistName(netlist.netlist_name().c_str());
+    cached_netlist.setNetlistId(netlist.netlist_id().c_str());
+
+    auto cached_blocks = cached_netlist.initBlocks(netlist.blocks().size());
+    unsigned iblk = 0;
+    for (AtomBlockId blk_id : netlist.blocks()) {
+        VTR_ASSERT(size_t(blk_id) == iblk); //Compressed ids are contiguous
+        auto cached_block = cached_blocks[iblk++];
+
+        cached_block.setName(netlist.block_name(blk_id).c_str());
+        cached_block.setModelName(netlist.block_model(blk_id)->name);
+
+        const AtomNetlist::TruthTable& truth_table = netlist.block_truth_table(blk_id);
+        if (!truth_table.empty()) {
+            auto cached_truth_table = cached_block.initTruthTable(truth_table.size());
+            for (unsigned irow = 0; irow < truth_table.size(); ++irow) {
+                auto cached_values = cached_truth_table[irow].initValues(truth_table[irow].size());
+                for (unsigned ivalue = 0; ivalue < truth_table[irow].size(); ++ivalue) {
+                    cached_values.set(ivalue, static_cast<int8_t>(truth_table[irow][ivalue]));
+                }
+            }
+        }
+
+        auto attrs = netlist.block_attrs(blk_id);
+        size_t num_attrs = std::distance(attrs.begin(), attrs.end());
+        if (num_attrs > 0) {
+            auto cached_attrs = cached_block.initAttrs(num_attrs);
+            unsigned iattr = 0;
+            for (const auto& kv : attrs) {
+                cached_attrs[iattr].setName(kv.first.c_str());
+                cached_attrs[iattr].setValue(kv.second.c_str());
+                ++iattr;
+            }
+        }
+
+        auto params = netlist.block_params(blk_id);
+        size_t num_params = std::distance(params.begin(), params.end());
+        if (num_params > 0) {
+            auto cached_params = cached_block.initParams(num_params);
+            unsigned iparam = 0;
+            for (const auto& kv : params) {
+                cached_params[iparam].setName(kv.first.c_str());
+                cached_params[iparam].setValue(kv.second.c_str());
+                ++iparam;
+            }
+        }
+    }
+
+    auto cached_ports = cached_netlist.initPorts(netlist.ports().size());
+    unsigned iport = 0;
+    for (AtomPortId port_id : netlist.ports()) {
+        VTR_ASSERT(size_t(port_id) == iport);
+        auto cached_port = cached_ports[iport++];
+
+        cached_port.setBlockId((int)size_t(netlist.port_block(port_id)));
+        cached_port.setModelPortName(netlist.port_model(port_id)->name);
+    }
+
+    auto cached_pins = cached_netlist.initPins(netlist.pins().size());
+    unsigned ipin = 0;
+    for (AtomPinId pin_id : netlist.pins()) {
+        VTR_ASSERT(size_t(pin_id) == ipin);
+        auto cached_pin = cached_pins[ipin++];
+
+        cached_pin.setPortId((int)size_t(netlist.pin_port(pin_id)));
+        cached_pin.setPortBit((int)netlist.pin_port_bit(pin_id));
+        cached_pin.setNetId((int)size_t(netlist.pin_net(pin_id)));
+        cached_pin.setIsDriver(netlist.pin_type(pin_id) == PinType::DRIVER);
+        cached_pin.setIsConst(netlist.pin_is_constant(pin_id));
+    }
+
+    auto cached_net_names = cached_netlist.initNetNames(netlist.nets().size());
+    unsigned inet = 0;
+    for (AtomNetId net_id : netlist.nets()) {
+        VTR_ASSERT(size_t(net_id) == inet);
+        cached_net_names.set(inet++, netlist.net_name(net_id).c_str());
+    }
+
+    writeMessageToFile(cache_file, &builder);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+#    define DISABLE_ERROR                              \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+bool try_load_atom_netlist_cache(const char* /*cache_file*/,
+                                 const std::string& /*cache_key*/,
+                                 const t_model* /*user_models*/,
+                                 const t_model* /*library_models*/,
+                                 AtomNetlist& /*netlist*/) {
+    VPR_THROW(VPR_ERROR_ATOM_NETLIST, "Atom netlist cache loading " DISABLE_ERROR);
+}
+
+void save_atom_netlist_cache(const char* /*cache_file*/,
+                             const std::string& /*cache_key*/,
+                             const AtomNetlist& /*netlist*/) {
+    VPR_THROW(VPR_ERROR_ATOM_NETLIST, "Atom netlist cache writing " DISABLE_ERROR);
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
@@ -0,0 +1,45 @@
+#ifndef ATOM_NETLIST_CACHE_H
+#define ATOM_NETLIST_CACHE_H
+#include <string>
+
+#include "logic_types.h"
+#include "atom_netlist.h"
+#include "read_circuit.h"
+#include "vpr_types.h"
+
+/*
+ * Persistent cache of the elaborated atom netlist
+ *
+ * Re-parsing and cleaning the same circuit on every VPR invocation is pure
+ * overhead for parameter sweeps where the circuit is unchanged. The cache
+ * stores the fully elaborated (parsed, swept and compressed) atom netlist
+ * in a binary format (see libs/libvtrcapnproto/atom_netlist.capnp), keyed
+ * by the circuit file digest plus the netlist processing options; it is
+ * only re-used when the key matches exactly.
+ *
+ * Requires building with VTR_ENABLE_CAPNPROTO=ON.
+ */
+
+//Returns the cache key identifying the inputs the elaborated netlist
+//depends on (circuit file contents and netlist processing options)
+std::string atom_netlist_cache_key(e_circuit_format circuit_format,
+                                   const char* circuit_file,
+                                   const t_netlist_opts& netlist_opts);
+
+//Attempts to load a previously cached atom netlist from cache_file.
+//
+//Returns true (filling in netlist) if the cache exists, matches cache_key,
+//and all referenced architecture models resolve; returns false otherwise
+//(in which case the netlist must be re-elaborated and re-cached).
+bool try_load_atom_netlist_cache(const char* cache_file,
+                                 const std::string& cache_key,
+                                 const t_model* user_models,
+                                 const t_model* library_models,
+                                 AtomNetlist& netlist);
+
+//Writes the elaborated netlist to cache_file, tagged with cache_key
+void save_atom_netlist_cache(const char* cache_file,
+                             const std::string& cache_key,
+                             const AtomNetlist& netlist);
+
+#endif
@@ -2,6 +2,7 @@
 #include <map>
 #include <unordered_set>
 #include <set>
+#include <deque>
 #include <algorithm>
 #include <iterator>
 #include <cmath>
@@ -21,6 +22,9 @@ int infer_and_mark_constant_pins(AtomNetlist& netlist, e_const_gen_inference con
 //Marks all primtiive output pins which have no combinationally connected inputs as constant pins
 int mark_undriven_primitive_outputs_as_constant(AtomNetlist& netlist, int verbosity);
 
+//Marks the primtiive output pins of blk which have no combinationally connected inputs as constant pins
+int mark_undriven_block_outputs_as_constant(AtomNetlist& netlist, AtomBlockId blk, int verbosity);
+
 //Marks all primtiive output pins of blk which have only constant inputs as constant pins
 int infer_and_mark_block_pins_constant(AtomNetlist& netlist, AtomBlockId blk, e_const_gen_inference const_gen_inference_method, int verbosity);
 int infer_and_mark_block_combinational_outputs_constant(AtomNetlist& netlist, AtomBlockId blk, e_const_gen_inference const_gen_inference_method, int verbosity);
@@ -434,45 +438,53 @@ int mark_undriven_primitive_outputs_as_constant(AtomNetlist& netlist, int verbos
     for (AtomBlockId blk : netlist.blocks()) {
         if (!blk) continue;
 
-        //Don't mark primary I/Os as constants
-        if (netlist.block_type(blk) != AtomBlockType::BLOCK) continue;
+        num_pins_marked_constant += mark_undriven_block_outputs_as_constant(netlist, blk, verbosity);
+    }
 
-        for (AtomPortId output_port : netlist.block_output_ports(blk)) {
-            const t_model_ports* model_port = netlist.port_model(output_port);
+    return num_pins_marked_constant;
+}
 
-            //Don't mark sequential or clock generator ports as constants
-            if (!model_port->clock.empty() || model_port->is_clock) continue;
+int mark_undriven_block_outputs_as_constant(AtomNetlist& netlist, AtomBlockId blk, int verbosity) {
+    //Don't mark primary I/Os as constants
+    if (netlist.block_type(blk) != AtomBlockType::BLOCK) return 0;
 
-            //Find the upstream combinationally connected ports
-            std::vector<AtomPortId> upstream_ports = find_combinationally_connected_input_ports(netlist, output_port);
+    size_t num_pins_marked_constant = 0;
 
-            //Check if any of the 'upstream' input pins have connected nets
-            //
-            //Note that we only check to see whether they are *connected* not whether they are non-constant.
-            //Inference of pins as constant generators from upstream *constant nets* is handled elsewhere.
-            bool has_connected_inputs = false;
-            for (AtomPortId input_port : upstream_ports) {
-                for (AtomPinId input_pin : netlist.port_pins(input_port)) {
-                    AtomNetId input_net = netlist.pin_net(input_pin);
-
-                    if (input_net) {
-                        has_connected_inputs = true;
-                        break;
-                    }
+    for (AtomPortId output_port : netlist.block_output_ports(blk)) {
+        const t_model_ports* model_port = netlist.port_model(output_port);
+
+        //Don't mark sequential or clock generator ports as constants
+        if (!model_port->clock.empty() || model_port->is_clock) continue;
+
+        //Find the upstream combinationally connected ports
+        std::vector<AtomPortId> upstream_ports = find_combinationally_connected_input_ports(netlist, output_port);
+
+        //Check if any of the 'upstream' input pins have connected nets
+        //
+        //Note that we only check to see whether they are *connected* not whether they are non-constant.
+        //Inference of pins as constant generators from upstream *constant nets* is handled elsewhere.
+        bool has_connected_inputs = false;
+        for (AtomPortId input_port : upstream_ports) {
+            for (AtomPinId input_pin : netlist.port_pins(input_port)) {
+                AtomNetId input_net = netlist.pin_net(input_pin);
+
+                if (input_net) {
+                    has_connected_inputs = true;
+                    break;
                 }
             }
+        }
 
-            if (!has_connected_inputs) {
-                //The current output port has no inputs driving the primitive's internal
-                //timing edges. Therefore we treat all its pins as constant generators.
-                for (AtomPinId output_pin : netlist.port_pins(output_port)) {
-                    if (netlist.pin_is_constant(output_pin)) continue;
+        if (!has_connected_inputs) {
+            //The current output port has no inputs driving the primitive's internal
+            //timing edges. Therefore we treat all its pins as constant generators.
+            for (AtomPinId output_pin : netlist.port_pins(output_port)) {
+                if (netlist.pin_is_constant(output_pin)) continue;
 
-                    VTR_LOGV(verbosity > 1, "Marking pin '%s' as constant since it has no combinationally connected inputs\n",
-                             netlist.pin_name(output_pin).c_str());
-                    netlist.set_pin_is_constant(output_pin, true);
-                    ++num_pins_marked_constant;
-                }
+                VTR_LOGV(verbosity > 1, "Marking pin '%s' as constant since it has no combinationally connected inputs\n",
+                         netlist.pin_name(output_pin).c_str());
+                netlist.set_pin_is_constant(output_pin, true);
+                ++num_pins_marked_constant;
             }
         }
     }
@@ -984,55 +996,165 @@ size_t sweep_iterative(AtomNetlist& netlist,
     size_t constant_outputs_swept = 0;
     size_t constant_generators_marked = 0;
 
-    //We perform multiple passes of sweeping, since sweeping something may
-    //enable more things to be swept afterward.
-    //
-    //We keep sweeping until nothing else is removed
-    size_t pass_dangling_nets_swept;
-    size_t pass_dangling_blocks_swept;
-    size_t pass_dangling_inputs_swept;
-    size_t pass_dangling_outputs_swept;
-    size_t pass_constant_outputs_swept;
-    size_t pass_constant_generators_marked;
-    do {
-        pass_dangling_nets_swept = 0;
-        pass_dangling_blocks_swept = 0;
-        pass_dangling_inputs_swept = 0;
-        pass_dangling_outputs_swept = 0;
-        pass_constant_outputs_swept = 0;
-        pass_constant_generators_marked = 0;
-
-        if (should_sweep_ios) {
-            pass_dangling_inputs_swept += sweep_inputs(netlist, verbosity);
-            pass_dangling_outputs_swept += sweep_outputs(netlist, verbosity);
+    //Sweeping something may enable more things to be swept afterward, but
+    //only in the immediate neighbourhood of the removal. Rather than
+    //re-scanning the whole netlist until a pass removes nothing (which is
+    //quadratic-ish when removals chain), we process a worklist: every
+    //block/net is examined once up-front, and each removal (or newly marked
+    //constant generator) re-queues only the affected neighbours. This bounds
+    //the cleanup work to O(initial netlist + changes).
+    std::deque<AtomBlockId> block_worklist;
+    std::deque<AtomNetId> net_worklist;
+    std::unordered_set<AtomBlockId> queued_blocks;
+    std::unordered_set<AtomNetId> queued_nets;
+
+    auto queue_block = [&](AtomBlockId blk_id) {
+        if (blk_id && queued_blocks.insert(blk_id).second) {
+            block_worklist.push_back(blk_id);
+        }
+    };
+
+    auto queue_net = [&](AtomNetId net_id) {
+        if (net_id && queued_nets.insert(net_id).second) {
+            net_worklist.push_back(net_id);
+        }
+    };
+
+    //Removes blk_id, queueing any nets it was connected to (they may have
+    //become driverless/sinkless)
+    auto remove_block_and_queue_neighbours = [&](AtomBlockId blk_id) {
+        for (AtomPinId pin_id : netlist.block_pins(blk_id)) {
+            if (!pin_id) continue;
+            queue_net(netlist.pin_net(pin_id));
+        }
+        netlist.remove_block(blk_id);
+    };
+
+    auto process_block = [&](AtomBlockId blk_id) {
+        std::string reason;
+
+        if (should_sweep_ios && is_removable_input(netlist, blk_id, &reason)) {
+            VTR_LOGV_WARN(verbosity > 1, "Primary input '%s' will be swept (%s)\n", netlist.block_name(blk_id).c_str(), reason.c_str());
+            remove_block_and_queue_neighbours(blk_id);
+            ++dangling_inputs_swept;
+            return;
+        }
+
+        if (should_sweep_ios && is_removable_output(netlist, blk_id, &reason)) {
+            VTR_LOGV_WARN(verbosity > 1, "Primary output '%s' will be swept (%s)\n", netlist.block_name(blk_id).c_str(), reason.c_str());
+            remove_block_and_queue_neighbours(blk_id);
+            ++dangling_outputs_swept;
+            return;
+        }
+
+        AtomBlockType type = netlist.block_type(blk_id);
+
+        if (should_sweep_blocks
+            && type != AtomBlockType::INPAD
+            && type != AtomBlockType::OUTPAD
+            && is_removable_block(netlist, blk_id, &reason)) {
+            VTR_LOGV_WARN(verbosity > 1, "Block '%s' will be swept (%s)\n", netlist.block_name(blk_id).c_str(), reason.c_str());
+            remove_block_and_queue_neighbours(blk_id);
+            ++dangling_blocks_swept;
+            return;
         }
 
-        if (should_sweep_blocks) {
-            pass_dangling_blocks_swept += sweep_blocks(netlist, verbosity);
+        if (should_sweep_constant_primary_outputs && type == AtomBlockType::OUTPAD) {
+            VTR_ASSERT(netlist.block_output_pins(blk_id).size() == 0);
+            VTR_ASSERT(netlist.block_clock_pins(blk_id).size() == 0);
+
+            bool all_inputs_are_const = true;
+            for (AtomPinId pin_id : netlist.block_input_pins(blk_id)) {
+                AtomNetId net_id = netlist.pin_net(pin_id);
+
+                if (net_id && !netlist.net_is_constant(net_id)) {
+                    all_inputs_are_const = false;
+                    break;
+                }
+            }
+
+            if (all_inputs_are_const) {
+                //All inputs are constant, so we should remove this output
+                VTR_LOGV_WARN(verbosity > 2, "Sweeping constant primary output '%s'\n", netlist.block_name(blk_id).c_str());
+                remove_block_and_queue_neighbours(blk_id);
+                ++constant_outputs_swept;
+                return;
+            }
         }
 
-        if (should_sweep_nets) {
-            pass_dangling_nets_swept += sweep_nets(netlist, verbosity);
+        //Constant generator inference: marking this block's outputs constant
+        //may reveal further constants (or sweepable constant outputs)
+        //downstream, so queue the fanout of any newly marked pins
+        int num_marked = mark_undriven_block_outputs_as_constant(netlist, blk_id, verbosity)
+                         + infer_and_mark_block_pins_constant(netlist, blk_id, const_gen_inference_method, verbosity);
+        if (num_marked > 0) {
+            constant_generators_marked += num_marked;
+
+            for (AtomPinId pin_id : netlist.block_output_pins(blk_id)) {
+                if (!pin_id || !netlist.pin_is_constant(pin_id)) continue;
+
+                AtomNetId net_id = netlist.pin_net(pin_id);
+                if (!net_id) continue;
+
+                for (AtomPinId sink_pin_id : netlist.net_sinks(net_id)) {
+                    queue_block(netlist.pin_block(sink_pin_id));
+                }
+            }
         }
+    };
+
+    auto process_net = [&](AtomNetId net_id) {
+        if (!should_sweep_nets) return;
+
+        bool no_driver = !netlist.net_driver(net_id);
+        bool no_sinks = (netlist.net_sinks(net_id).size() == 0);
+
+        if (no_driver || no_sinks) {
+            VTR_LOGV_WARN(verbosity > 1 && no_driver, "Net '%s' has no driver and will be removed\n", netlist.net_name(net_id).c_str());
+            VTR_LOGV_WARN(verbosity > 1 && no_sinks, "Net '%s' has no sinks and will be removed\n", netlist.net_name(net_id).c_str());
+
+            //The blocks the net was connected to may have lost their last
+            //fanin/fanout, so re-examine them
+            for (AtomPinId pin_id : netlist.net_pins(net_id)) {
+                if (!pin_id) continue;
+                queue_block(netlist.pin_block(pin_id));
+            }
 
-        if (should_sweep_constant_primary_outputs) {
-            pass_constant_outputs_swept += sweep_constant_primary_outputs(netlist, verbosity);
+            netlist.remove_net(net_id);
+            ++dangling_nets_swept;
         }
+    };
 
-        pass_constant_generators_marked += mark_constant_generators(netlist, const_gen_inference_method, verbosity);
-
-        dangling_nets_swept += pass_dangling_nets_swept;
-        dangling_blocks_swept += pass_dangling_blocks_swept;
-        dangling_inputs_swept += pass_dangling_inputs_swept;
-        dangling_outputs_swept += pass_dangling_outputs_swept;
-        constant_outputs_swept += pass_constant_outputs_swept;
-        constant_generators_marked += pass_constant_generators_marked;
-    } while (pass_dangling_nets_swept != 0
-             || pass_dangling_blocks_swept != 0
-             || pass_dangling_inputs_swept != 0
-             || pass_dangling_outputs_swept != 0
-             || pass_constant_outputs_swept != 0
-             || pass_constant_generators_marked != 0);
+    //Seed the worklists with the entire netlist (equivalent to the first
+    //pass of a full scan)
+    for (AtomBlockId blk_id : netlist.blocks()) {
+        queue_block(blk_id);
+    }
+    for (AtomNetId net_id : netlist.nets()) {
+        queue_net(net_id);
+    }
+
+    while (!block_worklist.empty() || !net_worklist.empty()) {
+        //Nets first: removing a dangling net is what typically exposes
+        //removable blocks
+        if (!net_worklist.empty()) {
+            AtomNetId net_id = net_worklist.front();
+            net_worklist.pop_front();
+            queued_nets.erase(net_id);
+
+            if (!netlist.valid_net_id(net_id)) continue; //Already swept
+
+            process_net(net_id);
+        } else {
+            AtomBlockId blk_id = block_worklist.front();
+            block_worklist.pop_front();
+            queued_blocks.erase(blk_id);
+
+            if (!netlist.valid_block_id(blk_id)) continue; //Already swept
+
+            process_block(blk_id);
+        }
+    }
 
     VTR_LOGV(verbosity > 0, "Swept input(s)      : %zu\n", dangling_inputs_swept);
     VTR_LOGV(verbosity > 0, "Swept output(s)     : %zu (%zu dangling, %zu constant)\n",
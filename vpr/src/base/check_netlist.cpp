@@ -1,12 +1,25 @@
 /**
  * Simple checks to make sure netlist data structures are consistent.  These include checking for duplicated names, dangling links, etc.
+ *
+ * The per-net and per-block checks are independent of each other (they only
+ * read the clustered netlist), so they are spread over a pool of workers in
+ * contiguous ranges.  Workers never log directly: each one defers its
+ * diagnostics into local buffers which are replayed in index order after the
+ * join, so the log output stays deterministic regardless of thread
+ * interleaving.
  */
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_util.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -18,30 +31,53 @@
 
 #define ERROR_THRESHOLD 100
 
+//Minimum number of blocks each check worker should be responsible for.
+//Avoids spawning threads whose start-up cost exceeds the checking work.
+constexpr size_t MIN_BLOCKS_PER_CHECK_WORKER = 2048;
+
 /**************** Subroutines local to this module **************************/
 
-static int check_connections_to_global_clb_pins(ClusterNetId net_id, int verbosity);
+//Diagnostics accumulated by a single check worker, replayed after the join
+struct t_check_worker_results {
+    int errors = 0;
+    int global_to_non_global_connection_count = 0;
+    std::vector<std::string> error_msgs;
+    std::vector<std::string> warning_msgs;
+};
+
+static int check_connections_to_global_clb_pins(ClusterNetId net_id, int verbosity, std::vector<std::string>& warning_msgs);
 
 static int check_for_duplicated_names();
 
-static int check_clb_conn(ClusterBlockId iblk, int num_conn);
+static int check_clb_conn(ClusterBlockId iblk, int num_conn, t_check_worker_results& results);
 
-static int check_clb_internal_nets(ClusterBlockId iblk);
+static int check_clb_internal_nets(ClusterBlockId iblk, t_pb_graph_pin** pb_graph_pin_lookup, t_check_worker_results& results);
+
+static t_check_worker_results check_netlist_range(size_t inet_begin, size_t inet_end, size_t iblk_begin, size_t iblk_end, int verbosity);
 
 /*********************** Subroutine definitions *****************************/
 
 void check_netlist(int verbosity) {
     int error = 0;
-    int num_conn;
     t_hash **net_hash_table, *h_net_ptr;
 
     /* This routine checks that the netlist makes sense. */
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
 
+    /* If the netlist was loaded unchanged from an already-validated source
+     * (e.g. when re-entering the flow after a snapshot restore) there is
+     * nothing new to check. */
+    static std::string validated_netlist_id;
+    const std::string netlist_id = cluster_ctx.clb_nlist.netlist_id();
+    if (!netlist_id.empty() && netlist_id == validated_netlist_id) {
+        VTR_LOG("Netlist (id %s) unchanged since its last consistency check -- skipping re-check.\n", netlist_id.c_str());
+        return;
+    }
+
     net_hash_table = alloc_hash_table();
 
-    /* Check that nets fanout and have a driver. */
-    int global_to_non_global_connection_count = 0;
+    /* Check that nets have unique names (the shared hash table forces this
+     * pass to stay sequential). */
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         h_net_ptr = insert_in_hash_table(net_hash_table, cluster_ctx.clb_nlist.net_name(net_id).c_str(), size_t(net_id));
         if (h_net_ptr->count != 1) {
@@ -49,23 +85,76 @@ void check_netlist(int verbosity) {
                           cluster_ctx.clb_nlist.net_name(net_id).c_str());
             error++;
         }
-        global_to_non_global_connection_count += check_connections_to_global_clb_pins(net_id, verbosity);
         if (error >= ERROR_THRESHOLD) {
             VTR_LOG_ERROR("Too many errors in netlist, exiting.\n");
         }
     }
     free_hash_table(net_hash_table);
-    VTR_LOG_WARN("Netlist contains %d global net to non-global architecture pin connections\n", global_to_non_global_connection_count);
 
-    /* Check that each block makes sense. */
-    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-        num_conn = (int)cluster_ctx.clb_nlist.block_pins(blk_id).size();
-        error += check_clb_conn(blk_id, num_conn);
-        error += check_clb_internal_nets(blk_id);
-        if (error >= ERROR_THRESHOLD) {
-            VPR_ERROR(VPR_ERROR_OTHER,
-                      "Too many errors in netlist, exiting.\n");
+    /* Check each net's pin connections and each block's external and internal
+     * connectivity over contiguous net/block ranges in parallel. */
+    size_t num_nets = cluster_ctx.clb_nlist.nets().size();
+    size_t num_blocks = cluster_ctx.clb_nlist.blocks().size();
+
+    size_t num_workers = 1;
+    if (std::thread::hardware_concurrency() > 1) {
+        num_workers = std::min<size_t>(std::thread::hardware_concurrency(), std::max<size_t>(1, num_blocks / MIN_BLOCKS_PER_CHECK_WORKER));
+    }
+
+    std::vector<t_check_worker_results> worker_results(num_workers);
+
+    if (num_workers <= 1) {
+        worker_results[0] = check_netlist_range(0, num_nets, 0, num_blocks, verbosity);
+    } else {
+        size_t nets_per_worker = (num_nets + num_workers - 1) / num_workers;
+        size_t blocks_per_worker = (num_blocks + num_workers - 1) / num_workers;
+
+        std::vector<std::exception_ptr> worker_errors(num_workers);
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_workers);
+        for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+            size_t inet_begin = std::min(num_nets, iworker * nets_per_worker);
+            size_t inet_end = std::min(num_nets, inet_begin + nets_per_worker);
+            size_t iblk_begin = std::min(num_blocks, iworker * blocks_per_worker);
+            size_t iblk_end = std::min(num_blocks, iblk_begin + blocks_per_worker);
+            workers.emplace_back([&, iworker, inet_begin, inet_end, iblk_begin, iblk_end]() {
+                try {
+                    worker_results[iworker] = check_netlist_range(inet_begin, inet_end, iblk_begin, iblk_end, verbosity);
+                } catch (...) {
+                    worker_errors[iworker] = std::current_exception();
+                }
+            });
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        for (auto& worker_error : worker_errors) {
+            if (worker_error) {
+                std::rethrow_exception(worker_error);
+            }
+        }
+    }
+
+    /* Replay the deferred diagnostics in worker (i.e. net/block index) order */
+    int global_to_non_global_connection_count = 0;
+    for (auto& results : worker_results) {
+        for (auto& msg : results.warning_msgs) {
+            VTR_LOG_WARN("%s", msg.c_str());
+        }
+        for (auto& msg : results.error_msgs) {
+            VTR_LOG_ERROR("%s", msg.c_str());
         }
+        error += results.errors;
+        global_to_non_global_connection_count += results.global_to_non_global_connection_count;
+    }
+    VTR_LOG_WARN("Netlist contains %d global net to non-global architecture pin connections\n", global_to_non_global_connection_count);
+
+    if (error >= ERROR_THRESHOLD) {
+        VPR_ERROR(VPR_ERROR_OTHER,
+                  "Too many errors in netlist, exiting.\n");
     }
 
     error += check_for_duplicated_names();
@@ -74,12 +163,55 @@ void check_netlist(int verbosity) {
         VPR_ERROR(VPR_ERROR_OTHER,
                   "Found %d fatal Errors in the input netlist.\n", error);
     }
+
+    validated_netlist_id = netlist_id;
+}
+
+/* Runs the per-net and per-block checks for contiguous index ranges,
+ * deferring all diagnostics into the returned results.  The pb_graph pin
+ * lookup used by the internal connectivity check is cached per logical block
+ * type instead of being rebuilt for every block. */
+static t_check_worker_results check_netlist_range(size_t inet_begin, size_t inet_end, size_t iblk_begin, size_t iblk_end, int verbosity) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    t_check_worker_results results;
+
+    for (size_t inet = inet_begin; inet < inet_end; ++inet) {
+        ClusterNetId net_id(inet);
+        results.global_to_non_global_connection_count += check_connections_to_global_clb_pins(net_id, verbosity, results.warning_msgs);
+    }
+
+    std::map<t_logical_block_type_ptr, t_pb_graph_pin**> pin_lookup_cache;
+
+    for (size_t iblk = iblk_begin; iblk < iblk_end; ++iblk) {
+        ClusterBlockId blk_id(iblk);
+        int num_conn = (int)cluster_ctx.clb_nlist.block_pins(blk_id).size();
+        results.errors += check_clb_conn(blk_id, num_conn, results);
+
+        t_logical_block_type_ptr type = cluster_ctx.clb_nlist.block_type(blk_id);
+        auto itr = pin_lookup_cache.find(type);
+        if (itr == pin_lookup_cache.end()) {
+            itr = pin_lookup_cache.emplace(type, alloc_and_load_pb_graph_pin_lookup_from_index(type)).first;
+        }
+        results.errors += check_clb_internal_nets(blk_id, itr->second, results);
+
+        if (results.errors >= ERROR_THRESHOLD) {
+            /* Enough evidence the netlist is broken; stop collecting */
+            break;
+        }
+    }
+
+    for (auto& cache_entry : pin_lookup_cache) {
+        free_pb_graph_pin_lookup_from_index(cache_entry.second);
+    }
+
+    return results;
 }
 
 /* Checks that a global net (net_id) connects only to global CLB input pins  *
  * and that non-global nets never connects to a global CLB pin.  Either       *
  * global or non-global nets are allowed to connect to pads.                  */
-static int check_connections_to_global_clb_pins(ClusterNetId net_id, int verbosity) {
+static int check_connections_to_global_clb_pins(ClusterNetId net_id, int verbosity, std::vector<std::string>& warning_msgs) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     bool net_is_ignored = cluster_ctx.clb_nlist.net_is_ignored(net_id);
@@ -95,11 +227,13 @@ static int check_connections_to_global_clb_pins(ClusterNetId net_id, int verbosi
 
         if (physical_tile_type(blk_id)->is_ignored_pin[pin_index] != net_is_ignored
             && !is_io_type(physical_tile_type(blk_id))) {
-            VTR_LOGV_WARN(verbosity > 2,
-                          "Global net '%s' connects to non-global architecture pin '%s' (netlist pin '%s')\n",
-                          cluster_ctx.clb_nlist.net_name(net_id).c_str(),
-                          block_type_pin_index_to_name(physical_tile_type(blk_id), pin_index).c_str(),
-                          cluster_ctx.clb_nlist.pin_name(pin_id).c_str());
+            if (verbosity > 2) {
+                warning_msgs.push_back(vtr::string_fmt(
+                    "Global net '%s' connects to non-global architecture pin '%s' (netlist pin '%s')\n",
+                    cluster_ctx.clb_nlist.net_name(net_id).c_str(),
+                    block_type_pin_index_to_name(physical_tile_type(blk_id), pin_index).c_str(),
+                    cluster_ctx.clb_nlist.pin_name(pin_id).c_str()));
+            }
 
             ++global_to_non_global_connection_count;
         }
@@ -109,7 +243,7 @@ static int check_connections_to_global_clb_pins(ClusterNetId net_id, int verbosi
 }
 
 /* Checks that the connections into and out of the clb make sense.  */
-static int check_clb_conn(ClusterBlockId iblk, int num_conn) {
+static int check_clb_conn(ClusterBlockId iblk, int num_conn, t_check_worker_results& results) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& clb_nlist = cluster_ctx.clb_nlist;
 
@@ -122,19 +256,19 @@ static int check_clb_conn(ClusterBlockId iblk, int num_conn) {
 
             if (pin_type == PinType::SINK && !clb_nlist.block_contains_primary_output(iblk)) {
                 //Input only and not a Primary-Output block
-                VTR_LOG_WARN(
-                    "Logic block #%d (%s) has only 1 input pin '%s'"
+                results.warning_msgs.push_back(vtr::string_fmt(
+                    "Logic block #%zu (%s) has only 1 input pin '%s'"
                     " -- the whole block is hanging logic that should be swept.\n",
-                    iblk, clb_nlist.block_name(iblk).c_str(),
-                    clb_nlist.pin_name(pin_id).c_str());
+                    size_t(iblk), clb_nlist.block_name(iblk).c_str(),
+                    clb_nlist.pin_name(pin_id).c_str()));
             }
             if (pin_type == PinType::DRIVER && !clb_nlist.block_contains_primary_input(iblk)) {
                 //Output only and not a Primary-Input block
-                VTR_LOG_WARN(
-                    "Logic block #%d (%s) has only 1 output pin '%s'."
+                results.warning_msgs.push_back(vtr::string_fmt(
+                    "Logic block #%zu (%s) has only 1 output pin '%s'."
                     " It may be a constant generator.\n",
-                    iblk, clb_nlist.block_name(iblk).c_str(),
-                    clb_nlist.pin_name(pin_id).c_str());
+                    size_t(iblk), clb_nlist.block_name(iblk).c_str(),
+                    clb_nlist.pin_name(pin_id).c_str()));
             }
 
             break;
@@ -145,8 +279,8 @@ static int check_clb_conn(ClusterBlockId iblk, int num_conn) {
      * just a redundant double check.                                    */
 
     if (num_conn > physical_tile_type(type)->num_pins) {
-        VTR_LOG_ERROR("logic block #%d with output %s has %d pins.\n",
-                      iblk, cluster_ctx.clb_nlist.block_name(iblk).c_str(), num_conn);
+        results.error_msgs.push_back(vtr::string_fmt("logic block #%zu with output %s has %d pins.\n",
+                                                     size_t(iblk), cluster_ctx.clb_nlist.block_name(iblk).c_str(), num_conn));
         error++;
     }
 
@@ -154,15 +288,13 @@ static int check_clb_conn(ClusterBlockId iblk, int num_conn) {
 }
 
 /* Check that internal-to-logic-block connectivity is continuous and logically consistent */
-static int check_clb_internal_nets(ClusterBlockId iblk) {
+static int check_clb_internal_nets(ClusterBlockId iblk, t_pb_graph_pin** pb_graph_pin_lookup, t_check_worker_results& results) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     int error = 0;
     const auto& pb_route = cluster_ctx.clb_nlist.block_pb(iblk)->pb_route;
     int num_pins_in_block = cluster_ctx.clb_nlist.block_pb(iblk)->pb_graph_node->total_pb_pins;
 
-    t_pb_graph_pin** pb_graph_pin_lookup = alloc_and_load_pb_graph_pin_lookup_from_index(cluster_ctx.clb_nlist.block_type(iblk));
-
     for (int i = 0; i < num_pins_in_block; i++) {
         if (!pb_route.count(i)) continue;
 
@@ -172,26 +304,26 @@ static int check_clb_internal_nets(ClusterBlockId iblk) {
             if ((pb_graph_pin_lookup[i]->port->type == IN_PORT && pb_graph_pin_lookup[i]->is_root_block_pin())
                 || (pb_graph_pin_lookup[i]->port->type == OUT_PORT && pb_graph_pin_lookup[i]->parent_node->is_primitive())) {
                 if (pb_route[i].driver_pb_pin_id != OPEN) {
-                    VTR_LOG_ERROR(
-                        "Internal connectivity error in logic block #%d with output %s."
+                    results.error_msgs.push_back(vtr::string_fmt(
+                        "Internal connectivity error in logic block #%zu with output %s."
                         " Internal node %d driven when it shouldn't be driven \n",
-                        iblk, cluster_ctx.clb_nlist.block_name(iblk).c_str(), i);
+                        size_t(iblk), cluster_ctx.clb_nlist.block_name(iblk).c_str(), i));
                     error++;
                 }
             } else {
                 if (!pb_route[i].atom_net_id || pb_route[i].driver_pb_pin_id == OPEN) {
-                    VTR_LOG_ERROR(
-                        "Internal connectivity error in logic block #%d with output %s."
+                    results.error_msgs.push_back(vtr::string_fmt(
+                        "Internal connectivity error in logic block #%zu with output %s."
                         " Internal node %d dangling\n",
-                        iblk, cluster_ctx.clb_nlist.block_name(iblk).c_str(), i);
+                        size_t(iblk), cluster_ctx.clb_nlist.block_name(iblk).c_str(), i));
                     error++;
                 } else {
                     int prev_pin = pb_route[i].driver_pb_pin_id;
                     if (pb_route[prev_pin].atom_net_id != pb_route[i].atom_net_id) {
-                        VTR_LOG_ERROR(
-                            "Internal connectivity error in logic block #%d with output %s."
+                        results.error_msgs.push_back(vtr::string_fmt(
+                            "Internal connectivity error in logic block #%zu with output %s."
                             " Internal node %d driven by different net than internal node %d\n",
-                            iblk, cluster_ctx.clb_nlist.block_name(iblk).c_str(), i, prev_pin);
+                            size_t(iblk), cluster_ctx.clb_nlist.block_name(iblk).c_str(), i, prev_pin));
                         error++;
                     }
                 }
@@ -199,7 +331,6 @@ static int check_clb_internal_nets(ClusterBlockId iblk) {
         }
     }
 
-    free_pb_graph_pin_lookup_from_index(pb_graph_pin_lookup);
     return error;
 }
 
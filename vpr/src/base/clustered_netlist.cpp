@@ -3,6 +3,9 @@
 #include "vtr_assert.h"
 #include "vpr_error.h"
 
+//Explicit instantiation of the base Netlist for the cluster ids (see clustered_netlist.h)
+template class Netlist<ClusterBlockId, ClusterPortId, ClusterPinId, ClusterNetId>;
+
 /*
  *
  *
@@ -290,6 +293,20 @@ void ClusteredNetlist::shrink_to_fit_impl() {
     net_is_global_.shrink_to_fit();
 }
 
+void ClusteredNetlist::reserve_impl(size_t num_blocks, size_t /*num_ports*/, size_t num_pins, size_t num_nets) {
+    //Block data
+    block_pbs_.reserve(num_blocks);
+    block_types_.reserve(num_blocks);
+    block_logical_pins_.reserve(num_blocks);
+
+    //Pin data
+    pin_physical_index_.reserve(num_pins);
+
+    //Net data
+    net_is_ignored_.reserve(num_nets);
+    net_is_global_.reserve(num_nets);
+}
+
 /*
  *
  * Sanity Checks
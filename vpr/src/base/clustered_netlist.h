@@ -111,6 +111,12 @@
 #include "netlist.h"
 #include "clustered_netlist_fwd.h"
 
+//The base Netlist for the cluster ids is explicitly instantiated in
+//clustered_netlist.cpp, so other translation units don't each re-instantiate
+//its (header-defined) members. The definitions remain visible here so the
+//hot accessors can still be inlined
+extern template class Netlist<ClusterBlockId, ClusterPortId, ClusterPinId, ClusterNetId>;
+
 class ClusteredNetlist : public Netlist<ClusterBlockId, ClusterPortId, ClusterPinId, ClusterNetId> {
   public:
     //Constructs a netlist
@@ -218,6 +224,9 @@ class ClusteredNetlist : public Netlist<ClusterBlockId, ClusterPortId, ClusterPi
     //Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
+    //Pre-allocates internal data structures (see Netlist::reserve())
+    void reserve_impl(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) override;
+
     /*
      * Component removal
      */
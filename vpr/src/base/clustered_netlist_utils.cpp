@@ -1,23 +1,78 @@
+#include <numeric>
+
 #include "clustered_netlist_utils.h"
+#include "globals.h"
 ClusteredPinAtomPinsLookup::ClusteredPinAtomPinsLookup(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup) {
     init_lookup(clustered_netlist, pb_gpin_lookup);
 }
 
+void ClusteredPinAtomPinsLookup::init(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup) {
+    init_lookup(clustered_netlist, pb_gpin_lookup);
+}
+
+void ClusteredPinAtomPinsLookup::ensure_built(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup) {
+    if (built_netlist_id_ == clustered_netlist.netlist_id()
+        && built_num_cluster_pins_ == clustered_netlist.pins().size()) {
+        return; //Already built for this netlist
+    }
+    init_lookup(clustered_netlist, pb_gpin_lookup);
+}
+
 ClusteredPinAtomPinsLookup::atom_pin_range ClusteredPinAtomPinsLookup::connected_atom_pins(ClusterPinId clustered_pin) const {
     VTR_ASSERT(clustered_pin);
-    //return vtr::make_range(clustered_pin_connected_atom_pins_[clustered_pin]);
-    return vtr::make_range(clustered_pin_connected_atom_pins_[clustered_pin].begin(),
-                           clustered_pin_connected_atom_pins_[clustered_pin].end());
-    //return atom_pin_range(clustered_pin_connected_atom_pins_[clustered_pin].begin(), clustered_pin_connected_atom_pins_[clustered_pin].end());
+    return vtr::make_range(clustered_pin_connected_atom_pins_.begin() + clustered_pin_atom_pins_offsets_[size_t(clustered_pin)],
+                           clustered_pin_connected_atom_pins_.begin() + clustered_pin_atom_pins_offsets_[size_t(clustered_pin) + 1]);
+}
+
+ClusteredPinAtomPinsLookup::clustered_pin_range ClusteredPinAtomPinsLookup::connected_clustered_pins(AtomPinId atom_pin) const {
+    VTR_ASSERT(atom_pin);
+    return vtr::make_range(atom_pin_connected_cluster_pins_.begin() + atom_pin_cluster_pins_offsets_[size_t(atom_pin)],
+                           atom_pin_connected_cluster_pins_.begin() + atom_pin_cluster_pins_offsets_[size_t(atom_pin) + 1]);
 }
 
 void ClusteredPinAtomPinsLookup::init_lookup(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup) {
     auto clustered_pins = clustered_netlist.pins();
+    size_t num_clustered_pins = clustered_pins.size();
+
+    //Forward direction: the clustered pin ids are contiguous (the netlist is
+    //compressed), so appending each pin's atom pins in id order builds the
+    //flat array and offsets directly
     clustered_pin_connected_atom_pins_.clear();
-    clustered_pin_connected_atom_pins_.resize(clustered_pins.size());
+    clustered_pin_atom_pins_offsets_.assign(num_clustered_pins + 1, 0);
+
     for (ClusterPinId clustered_pin : clustered_pins) {
         auto clustered_block = clustered_netlist.pin_block(clustered_pin);
         int phys_pin_index = clustered_netlist.pin_physical_index(clustered_pin);
-        clustered_pin_connected_atom_pins_[clustered_pin] = find_clb_pin_connected_atom_pins(clustered_block, phys_pin_index, pb_gpin_lookup);
+
+        std::vector<AtomPinId> atom_pins = find_clb_pin_connected_atom_pins(clustered_block, phys_pin_index, pb_gpin_lookup);
+        clustered_pin_connected_atom_pins_.insert(clustered_pin_connected_atom_pins_.end(),
+                                                  atom_pins.begin(), atom_pins.end());
+        clustered_pin_atom_pins_offsets_[size_t(clustered_pin) + 1] = clustered_pin_connected_atom_pins_.size();
+    }
+
+    //Reverse direction (note an atom pin may connect to multiple clustered
+    //pins, e.g. an atom output driving several cluster outputs), built as a
+    //counting sort over the forward direction
+    auto& atom_ctx = g_vpr_ctx.atom();
+    size_t num_atom_pins = atom_ctx.nlist.pins().size();
+
+    atom_pin_cluster_pins_offsets_.assign(num_atom_pins + 1, 0);
+    for (AtomPinId atom_pin : clustered_pin_connected_atom_pins_) {
+        ++atom_pin_cluster_pins_offsets_[size_t(atom_pin) + 1];
     }
+    std::partial_sum(atom_pin_cluster_pins_offsets_.begin(),
+                     atom_pin_cluster_pins_offsets_.end(),
+                     atom_pin_cluster_pins_offsets_.begin());
+
+    atom_pin_connected_cluster_pins_.assign(clustered_pin_connected_atom_pins_.size(), ClusterPinId::INVALID());
+    std::vector<size_t> next_free = atom_pin_cluster_pins_offsets_; //Next free slot for each atom pin
+    for (ClusterPinId clustered_pin : clustered_pins) {
+        for (size_t i = clustered_pin_atom_pins_offsets_[size_t(clustered_pin)]; i < clustered_pin_atom_pins_offsets_[size_t(clustered_pin) + 1]; ++i) {
+            AtomPinId atom_pin = clustered_pin_connected_atom_pins_[i];
+            atom_pin_connected_cluster_pins_[next_free[size_t(atom_pin)]++] = clustered_pin;
+        }
+    }
+
+    built_netlist_id_ = clustered_netlist.netlist_id();
+    built_num_cluster_pins_ = num_clustered_pins;
 }
@@ -1,6 +1,9 @@
 #ifndef CLUSTERED_NETLIST_UTILS_H
 #define CLUSTERED_NETLIST_UTILS_H
 
+#include <string>
+#include <vector>
+
 #include "vtr_vector.h"
 #include "vtr_range.h"
 
@@ -13,16 +16,41 @@ class ClusteredPinAtomPinsLookup {
     typedef std::vector<AtomPinId>::const_iterator atom_pin_iterator;
     typedef typename vtr::Range<atom_pin_iterator> atom_pin_range;
 
+    typedef std::vector<ClusterPinId>::const_iterator clustered_pin_iterator;
+    typedef typename vtr::Range<clustered_pin_iterator> clustered_pin_range;
+
   public:
+    ClusteredPinAtomPinsLookup() = default;
     ClusteredPinAtomPinsLookup(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup);
 
+    //(Re)builds the lookup for the specified netlist
+    void init(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup);
+
+    //Builds the lookup only if it has not already been built for this
+    //netlist, allowing a single lookup to be re-used across flow points
+    //(e.g. repeated routing attempts during a binary search over channel
+    //width) without paying the rebuild cost each time
+    void ensure_built(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup);
+
     atom_pin_range connected_atom_pins(ClusterPinId clustered_pin) const;
+    clustered_pin_range connected_clustered_pins(AtomPinId atom_pin) const;
 
   private:
     void init_lookup(const ClusteredNetlist& clustered_netlist, const IntraLbPbPinLookup& pb_gpin_lookup);
 
   private:
-    vtr::vector<ClusterPinId, std::vector<AtomPinId>> clustered_pin_connected_atom_pins_;
+    //Both mapping directions are stored flat (CSR-style): the pins connected
+    //to element i are flat[offsets[i]] .. flat[offsets[i+1] - 1]. This keeps
+    //each direction in two allocations, avoiding the per-pin vector
+    //indirection in timing-update inner loops
+    std::vector<AtomPinId> clustered_pin_connected_atom_pins_;
+    std::vector<size_t> clustered_pin_atom_pins_offsets_; //[0..num_cluster_pins]
+    std::vector<ClusterPinId> atom_pin_connected_cluster_pins_;
+    std::vector<size_t> atom_pin_cluster_pins_offsets_; //[0..num_atom_pins]
+
+    //Identify which netlist the lookup was built for (see ensure_built())
+    std::string built_netlist_id_;
+    size_t built_num_cluster_pins_ = 0;
 };
 
 #endif
@@ -80,6 +80,7 @@ void alloc_and_load_echo_file_info() {
     setEchoFileName(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH, "timing_graph.place_final.echo");
     setEchoFileName(E_ECHO_FINAL_ROUTING_TIMING_GRAPH, "timing_graph.route_final.echo");
     setEchoFileName(E_ECHO_ANALYSIS_TIMING_GRAPH, "timing_graph.analysis.echo");
+    setEchoFileName(E_ECHO_ANALYSIS_TIMING_GRAPH_SNAPSHOT, "timing_graph.analysis.snapshot.bin");
 
     setEchoFileName(E_ECHO_PLACE_MACROS, "place_macros.echo");
     setEchoFileName(E_ECHO_INITIAL_CLB_PLACEMENT, "initial_clb_placement.echo");
@@ -99,6 +100,7 @@ void alloc_and_load_echo_file_info() {
     setEchoFileName(E_ECHO_PLACEMENT_LOGIC_SINK_DELAYS, "placement_logic_sink_delays.echo");
     setEchoFileName(E_ECHO_ROUTING_SINK_DELAYS, "routing_sink_delays.echo");
     setEchoFileName(E_ECHO_POST_PACK_NETLIST, "post_pack_netlist.blif");
+    setEchoFileName(E_ECHO_PACKED_NETLIST_BIN, "packed_netlist.bin");
     setEchoFileName(E_ECHO_NET_DELAY, "net_delay.echo");
     setEchoFileName(E_ECHO_CLUSTERING_TIMING_INFO, "clustering_timing_info.echo");
     setEchoFileName(E_ECHO_PRE_PACKING_SLACK, "pre_packing_slack.echo");
@@ -106,6 +108,7 @@ void alloc_and_load_echo_file_info() {
     setEchoFileName(E_ECHO_CLUSTERING_BLOCK_CRITICALITIES, "clustering_block_criticalities.echo");
     setEchoFileName(E_ECHO_PRE_PACKING_MOLECULES_AND_PATTERNS, "pre_packing_molecules_and_patterns.echo");
     setEchoFileName(E_ECHO_MEM, "mem.echo");
+    setEchoFileName(E_ECHO_ROUTING_STATS, "routing_stats.echo");
     setEchoFileName(E_ECHO_TIMING_CONSTRAINTS, "timing_constraints.echo");
     setEchoFileName(E_ECHO_CRITICAL_PATH, "critical_path.echo");
     setEchoFileName(E_ECHO_SLACK, "slack.echo");
@@ -34,10 +34,12 @@ enum e_echo_files {
     E_ECHO_ARCH,
     E_ECHO_ROUTING_SINK_DELAYS,
     E_ECHO_POST_PACK_NETLIST,
+    E_ECHO_PACKED_NETLIST_BIN,
     E_ECHO_NET_DELAY,
     E_ECHO_CLUSTERING_TIMING_INFO,
     E_ECHO_CLUSTERING_BLOCK_CRITICALITIES,
     E_ECHO_MEM,
+    E_ECHO_ROUTING_STATS,
     E_ECHO_TIMING_CONSTRAINTS,
     E_ECHO_CRITICAL_PATH,
     E_ECHO_SLACK,
@@ -53,6 +55,7 @@ enum e_echo_files {
     E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH,
     E_ECHO_FINAL_ROUTING_TIMING_GRAPH,
     E_ECHO_ANALYSIS_TIMING_GRAPH,
+    E_ECHO_ANALYSIS_TIMING_GRAPH_SNAPSHOT,
 
     E_ECHO_END_TOKEN
 };
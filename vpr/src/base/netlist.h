@@ -416,7 +416,9 @@
 #include <unordered_map>
 #include "vtr_range.h"
 #include "vtr_logic.h"
+#include "vtr_small_vector.h"
 #include "vtr_vector_map.h"
+#include "vtr_string_interning.h"
 
 #include "logic_types.h"
 
@@ -448,7 +450,11 @@ class Netlist {
     typedef typename std::unordered_map<std::string, std::string>::const_iterator attr_iterator;
     typedef typename std::unordered_map<std::string, std::string>::const_iterator param_iterator;
     typedef typename vtr::vector_map<NetId, NetId>::const_iterator net_iterator;
-    typedef typename vtr::vector_map<PinId, PinId>::const_iterator pin_iterator;
+    //Pin ranges are returned over several different underlying containers
+    //(e.g. the in-place vtr::small_vector pin lists and the flattened net pin
+    //array), so the iterator is a raw pointer -- the one iterator type all of
+    //the contiguous pin storage formats can produce
+    typedef const PinId* pin_iterator;
     typedef typename vtr::vector_map<PortId, PortId>::const_iterator port_iterator;
 
     typedef typename vtr::Range<block_iterator> block_range;
@@ -481,6 +487,13 @@ class Netlist {
     //Sanity check for internal consistency (throws an exception on failure)
     bool verify() const;
 
+    //Returns a capacity-based estimate (in bytes) of the netlist's heap
+    //storage, covering the id-indexed arrays and per-port/net pin lists.
+    //Interned string characters (shared process-wide) and derived-class
+    //members are excluded. Used for per-subsystem memory accounting
+    //(see vtr::memory_usage).
+    size_t memory_footprint() const;
+
     //Returns true if the netlist has invalid entries due to modifications (e.g. from remove_*() calls)
     bool is_dirty() const;
 
@@ -757,6 +770,17 @@ class Netlist {
     //NOTE: this invalidates all existing IDs!
     IdRemapper compress();
 
+    //Pre-allocates storage for the specified number of netlist elements.
+    //
+    //The counts need not be exact (they are capacity hints, not sizes), but
+    //reserving close to the final element counts avoids repeated re-allocation
+    //of the internal storage while a large netlist is being constructed.
+    //  num_blocks  : The expected number of blocks
+    //  num_ports   : The expected number of ports
+    //  num_pins    : The expected number of pins
+    //  num_nets    : The expected number of nets
+    void reserve(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets);
+
   protected: //Protected Mutators
     //Create or return an existing block in the netlist
     //  name        : The unique name of the block
@@ -867,6 +891,13 @@ class Netlist {
     //Re-builds cross-references held by nets
     void rebuild_net_refs(const vtr::vector_map<PinId, PinId>& pin_id_map);
 
+    //Re-builds the flattened net pin array (see flat_net_pins_)
+    void rebuild_flat_net_pins();
+
+    //Drops the flattened net pin array, reverting net_pins()/net_sinks() to
+    //the per-net pin vectors until the next compress()
+    void invalidate_flat_net_pins();
+
     void shrink_to_fit();
 
     /*
@@ -902,6 +933,8 @@ class Netlist {
     //are called from this class in their respective non-impl() functions.
     virtual void shrink_to_fit_impl() = 0;
 
+    virtual void reserve_impl(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) = 0;
+
     virtual bool validate_block_sizes_impl(size_t num_blocks) const = 0;
     virtual bool validate_port_sizes_impl(size_t num_ports) const = 0;
     virtual bool validate_pin_sizes_impl(size_t num_pins) const = 0;
@@ -931,6 +964,14 @@ class Netlist {
     std::string netlist_id_;   //Unique identifier for the netlist
     bool dirty_ = false;       //Indicates the netlist has invalid entries from remove_*() functions
 
+    //Counts of entries invalidated by remove_*() since the last compress().
+    //Used by compress() to skip the compaction and cross-reference re-build
+    //passes for element types which have had nothing removed.
+    size_t num_removed_blocks_ = 0;
+    size_t num_removed_ports_ = 0;
+    size_t num_removed_pins_ = 0;
+    size_t num_removed_nets_ = 0;
+
     //Block data
     vtr::vector_map<BlockId, BlockId> block_ids_;    //Valid block ids
     vtr::vector_map<BlockId, StringId> block_names_; //Name of each block
@@ -952,7 +993,7 @@ class Netlist {
     vtr::vector_map<PortId, PortId> port_ids_;              //Valid port ids
     vtr::vector_map<PortId, StringId> port_names_;          //Name of each port
     vtr::vector_map<PortId, BlockId> port_blocks_;          //Block associated with each port
-    vtr::vector_map<PortId, std::vector<PinId>> port_pins_; //Pins associated with each port
+    vtr::vector_map<PortId, vtr::small_vector<PinId>> port_pins_; //Pins associated with each port (most ports are narrow, so the pins are stored in-place)
     vtr::vector_map<PortId, BitIndex> port_widths_;         //Width (in bits) of each port
     vtr::vector_map<PortId, PortType> port_types_;          //Type of the port (INPUT, OUTPUT, CLOCK)
 
@@ -967,19 +1008,33 @@ class Netlist {
     //Net data
     vtr::vector_map<NetId, NetId> net_ids_;               //Valid net ids
     vtr::vector_map<NetId, StringId> net_names_;          //Name of each net
-    vtr::vector_map<NetId, std::vector<PinId>> net_pins_; //Pins associated with each net
+    vtr::vector_map<NetId, vtr::small_vector<PinId>> net_pins_; //Pins associated with each net (most nets have few pins, so the pins are stored in-place)
+
+    //Flattened copy of net_pins_ for bulk iteration: all net pins stored in a
+    //single contiguous array, with flat_net_pin_offsets_[size_t(net)] giving the
+    //start of each net's pins (and [size_t(net) + 1] the end). Built by
+    //compress() and dropped (falling back to the per-net vectors) whenever net
+    //membership changes, so the hot net_pins()/net_sinks() accessors iterate
+    //one flat array instead of chasing a heap-allocated vector per net
+    std::vector<PinId> flat_net_pins_;
+    std::vector<size_t> flat_net_pin_offsets_;
 
     //String data
     // We store each unique string once, and reference it by an StringId
     // This avoids duplicating the strings in the fast look-ups (i.e. the look-ups
     // only store the Ids)
-    vtr::vector_map<StringId, StringId> string_ids_; //Valid string ids
-    vtr::vector_map<StringId, std::string> strings_; //Strings
+    //
+    // The string characters themselves live in the process-wide shared
+    // internment (vtr::global_string_internment()), so names repeated across
+    // netlists (e.g. atom and clustered) are stored only once, and two
+    // interned strings are equal iff their pointers are equal
+    vtr::vector_map<StringId, StringId> string_ids_;        //Valid string ids
+    vtr::vector_map<StringId, const std::string*> strings_; //Interned strings
 
   private: //Fast lookups
     vtr::vector_map<StringId, BlockId> block_name_to_block_id_;
     vtr::vector_map<StringId, NetId> net_name_to_net_id_;
-    std::unordered_map<std::string, StringId> string_to_string_id_;
+    std::unordered_map<const std::string*, StringId> string_to_string_id_;
 };
 
 #include "netlist.tpp"
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <climits>
 #include <numeric>
 
 #include "vtr_assert.h"
@@ -85,7 +86,7 @@ void Netlist<BlockId, PortId, PinId, NetId>::print_stats() const {
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 const std::string& Netlist<BlockId, PortId, PinId, NetId>::block_name(const BlockId blk_id) const {
     StringId str_id = block_names_[blk_id];
-    return strings_[str_id];
+    return *strings_[str_id];
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -113,16 +114,16 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    return vtr::make_range(block_pins_[blk_id].begin(), block_pins_[blk_id].end());
+    return vtr::make_range(block_pins_[blk_id].data(), block_pins_[blk_id].data() + block_pins_[blk_id].size());
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_input_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_pins_[blk_id].begin();
+    const PinId* begin = block_pins_[blk_id].data();
 
-    auto end = block_pins_[blk_id].begin() + block_num_input_pins_[blk_id];
+    const PinId* end = begin + block_num_input_pins_[blk_id];
 
     return vtr::make_range(begin, end);
 }
@@ -131,9 +132,9 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_output_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_pins_[blk_id].begin() + block_num_input_pins_[blk_id];
+    const PinId* begin = block_pins_[blk_id].data() + block_num_input_pins_[blk_id];
 
-    auto end = begin + block_num_output_pins_[blk_id];
+    const PinId* end = begin + block_num_output_pins_[blk_id];
 
     return vtr::make_range(begin, end);
 }
@@ -142,13 +143,13 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_clock_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_pins_[blk_id].begin()
-                 + block_num_input_pins_[blk_id]
-                 + block_num_output_pins_[blk_id];
+    const PinId* begin = block_pins_[blk_id].data()
+                         + block_num_input_pins_[blk_id]
+                         + block_num_output_pins_[blk_id];
 
-    auto end = begin + block_num_clock_pins_[blk_id];
+    const PinId* end = begin + block_num_clock_pins_[blk_id];
 
-    VTR_ASSERT_SAFE(end == block_pins_[blk_id].end());
+    VTR_ASSERT_SAFE(end == block_pins_[blk_id].data() + block_pins_[blk_id].size());
 
     return vtr::make_range(begin, end);
 }
@@ -207,7 +208,7 @@ const std::string& Netlist<BlockId, PortId, PinId, NetId>::port_name(const PortI
     VTR_ASSERT_SAFE(valid_port_id(port_id));
 
     StringId str_id = port_names_[port_id];
-    return strings_[str_id];
+    return *strings_[str_id];
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -351,13 +352,20 @@ const std::string& Netlist<BlockId, PortId, PinId, NetId>::net_name(const NetId
     VTR_ASSERT_SAFE(valid_net_id(net_id));
 
     StringId str_id = net_names_[net_id];
-    return strings_[str_id];
+    return *strings_[str_id];
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::net_pins(const NetId net_id) const {
     VTR_ASSERT_SAFE(valid_net_id(net_id));
 
+    if (!flat_net_pin_offsets_.empty()) {
+        //Fast path: iterate the flattened pin array (plain indexed loads from
+        //one contiguous allocation) rather than the per-net heap vector
+        return vtr::make_range(flat_net_pins_.data() + flat_net_pin_offsets_[size_t(net_id)],
+                               flat_net_pins_.data() + flat_net_pin_offsets_[size_t(net_id) + 1]);
+    }
+
     return vtr::make_range(net_pins_[net_id].begin(), net_pins_[net_id].end());
 }
 
@@ -400,7 +408,13 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::net_sinks(const NetId net_id) const {
     VTR_ASSERT_SAFE(valid_net_id(net_id));
 
-    return vtr::make_range(++net_pins_[net_id].begin(), net_pins_[net_id].end());
+    if (!flat_net_pin_offsets_.empty()) {
+        //Fast path: see net_pins()
+        return vtr::make_range(flat_net_pins_.data() + flat_net_pin_offsets_[size_t(net_id)] + 1,
+                               flat_net_pins_.data() + flat_net_pin_offsets_[size_t(net_id) + 1]);
+    }
+
+    return vtr::make_range(net_pins_[net_id].begin() + 1, net_pins_[net_id].end());
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -435,7 +449,7 @@ typename Netlist<BlockId, PortId, PinId, NetId>::port_range Netlist<BlockId, Por
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::pins() const {
-    return vtr::make_range(pin_ids_.begin(), pin_ids_.end());
+    return vtr::make_range(pin_ids_.data(), pin_ids_.data() + pin_ids_.size());
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -530,6 +544,102 @@ bool Netlist<BlockId, PortId, PinId, NetId>::verify() const {
     return valid;
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+size_t Netlist<BlockId, PortId, PinId, NetId>::memory_footprint() const {
+    //Bytes held by a flat container of scalar elements
+    auto flat_bytes = [](const auto& container) -> size_t {
+        return container.capacity() * sizeof(*container.begin());
+    };
+
+    //Bytes held by a container of std::vectors, including the inner heap buffers
+    auto nested_bytes = [&](const auto& outer) -> size_t {
+        size_t num_bytes = flat_bytes(outer);
+        for (const auto& inner : outer) {
+            num_bytes += inner.capacity() * sizeof(*inner.begin());
+        }
+        return num_bytes;
+    };
+
+    //Bytes held by a container of pin lists: small_vectors store short lists
+    //in-place (already counted by the outer container), so only long lists
+    //add a heap buffer
+    auto pin_lists_bytes = [&](const auto& outer) -> size_t {
+        size_t num_bytes = flat_bytes(outer);
+        for (const auto& pin_list : outer) {
+            if (pin_list.capacity() > pin_list.INPLACE_CAPACITY) {
+                num_bytes += pin_list.capacity() * sizeof(PinId);
+            }
+        }
+        return num_bytes;
+    };
+
+    //Bytes held by a container of string->string maps (block params/attrs),
+    //estimating the per-node overhead of the unordered_maps
+    auto string_map_bytes = [&](const auto& outer) -> size_t {
+        size_t num_bytes = flat_bytes(outer);
+        for (const auto& map : outer) {
+            num_bytes += map.bucket_count() * sizeof(void*);
+            for (const auto& kv : map) {
+                num_bytes += sizeof(kv) + 2 * sizeof(void*); //Hash node
+                num_bytes += kv.first.capacity() + kv.second.capacity();
+            }
+        }
+        return num_bytes;
+    };
+
+    size_t total = 0;
+
+    //Block data
+    total += flat_bytes(block_ids_);
+    total += flat_bytes(block_names_);
+    total += nested_bytes(block_ports_);
+    total += flat_bytes(block_num_input_ports_);
+    total += flat_bytes(block_num_output_ports_);
+    total += flat_bytes(block_num_clock_ports_);
+    total += nested_bytes(block_pins_);
+    total += flat_bytes(block_num_input_pins_);
+    total += flat_bytes(block_num_output_pins_);
+    total += flat_bytes(block_num_clock_pins_);
+    total += string_map_bytes(block_params_);
+    total += string_map_bytes(block_attrs_);
+
+    //Port data
+    total += flat_bytes(port_ids_);
+    total += flat_bytes(port_names_);
+    total += flat_bytes(port_blocks_);
+    total += pin_lists_bytes(port_pins_);
+    total += flat_bytes(port_widths_);
+    total += flat_bytes(port_types_);
+
+    //Pin data
+    total += flat_bytes(pin_ids_);
+    total += flat_bytes(pin_ports_);
+    total += flat_bytes(pin_port_bits_);
+    total += flat_bytes(pin_nets_);
+    total += flat_bytes(pin_net_indices_);
+    total += pin_is_constant_.capacity() / CHAR_BIT + 1; //Bit-packed
+
+    //Net data
+    total += flat_bytes(net_ids_);
+    total += flat_bytes(net_names_);
+    total += pin_lists_bytes(net_pins_);
+    total += flat_bytes(flat_net_pins_);
+    total += flat_bytes(flat_net_pin_offsets_);
+
+    //String data (ids and interned pointers only: the characters are shared
+    //process-wide and not attributed here)
+    total += flat_bytes(string_ids_);
+    total += flat_bytes(strings_);
+
+    //Lookups
+    total += flat_bytes(block_name_to_block_id_);
+    total += flat_bytes(net_name_to_net_id_);
+    total += string_to_string_id_.bucket_count() * sizeof(void*);
+    total += string_to_string_id_.size() * (sizeof(std::pair<const std::string*, StringId>) + 2 * sizeof(void*));
+
+    return total;
+}
+
 //Checks that the sizes of internal data structures
 //are consistent. Should take constant time.
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -597,7 +707,7 @@ bool Netlist<BlockId, PortId, PinId, NetId>::verify_lookups() const {
 
     //Strings
     for (auto str_id : string_ids_) {
-        const auto& name = strings_[str_id];
+        const auto& name = *strings_[str_id];
         if (find_string(name) != str_id) {
             VPR_FATAL_ERROR(VPR_ERROR_NETLIST, "String lookup by name mismatch");
         }
@@ -757,6 +867,8 @@ NetId Netlist<BlockId, PortId, PinId, NetId>::create_net(const std::string name)
 
         VTR_ASSERT(net_pins_[net_id].size() == 1);
         VTR_ASSERT(net_pins_[net_id][0] == PinId::INVALID());
+
+        invalidate_flat_net_pins();
     }
 
     //Check post-conditions: values
@@ -778,9 +890,9 @@ NetId Netlist<BlockId, PortId, PinId, NetId>::add_net(const std::string name, Pi
     //Set the driver and sinks of the net
     auto& dest_pins = net_pins_[net_id];
     dest_pins[0] = driver;
-    dest_pins.insert(dest_pins.end(),
-                     std::make_move_iterator(sinks.begin()),
-                     std::make_move_iterator(sinks.end()));
+    for (PinId sink : sinks) {
+        dest_pins.emplace_back(sink);
+    }
 
     //Associate each pin with the net
     int net_index = 0;
@@ -921,6 +1033,7 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_block(const BlockId blk_id)
     remove_block_impl(blk_id);
 
     //Mark netlist dirty
+    ++num_removed_blocks_;
     dirty_ = true;
 }
 
@@ -942,6 +1055,7 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_port(const PortId port_id) {
     remove_port_impl(port_id);
 
     //Mark netlist dirty
+    ++num_removed_ports_;
     dirty_ = true;
 }
 
@@ -962,6 +1076,7 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_pin(const PinId pin_id) {
     remove_pin_impl(pin_id);
 
     //Mark netlist dirty
+    ++num_removed_pins_;
     dirty_ = true;
 }
 
@@ -969,6 +1084,8 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_net(const NetId net_id) {
     VTR_ASSERT(valid_net_id(net_id));
 
+    invalidate_flat_net_pins(); //Net membership is changing
+
     //Disassociate the pins from the net
     for (auto pin_id : net_pins(net_id)) {
         if (pin_id) {
@@ -987,6 +1104,7 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_net(const NetId net_id) {
     remove_net_impl(net_id);
 
     //Mark netlist dirty
+    ++num_removed_nets_;
     dirty_ = true;
 }
 
@@ -997,6 +1115,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_net_pin(const NetId net_id,
     //Note that during sweeping either the net or pin could be invalid (i.e. already swept)
     //so we check before trying to use them
 
+    invalidate_flat_net_pins(); //Net membership is changing
+
     if (valid_net_id(net_id)) {
         //Warning: this is slow!
         auto iter = std::find(net_pins_[net_id].begin(), net_pins_[net_id].end(), pin_id); //Linear search
@@ -1045,10 +1165,29 @@ typename Netlist<BlockId, PortId, PinId, NetId>::IdRemapper Netlist<BlockId, Por
     // e.g. block_id_map[old_id] == new_id
     IdRemapper id_remapper = build_id_maps();
 
-    clean_nets(id_remapper.net_id_map_);
-    clean_pins(id_remapper.pin_id_map_);
-    clean_ports(id_remapper.port_id_map_);
-    clean_blocks(id_remapper.block_id_map_);
+    if (!dirty_) {
+        //Nothing has been removed since the last compress, so the id maps are
+        //identities and there is nothing to compact or re-build
+        if (flat_net_pin_offsets_.empty()) {
+            rebuild_flat_net_pins();
+        }
+        return id_remapper;
+    }
+
+    //Only element types which have had entries removed need to be compacted,
+    //and only the cross-references/look-ups involving a compacted type need to
+    //be re-built (references to untouched types map through the identity).
+    //This keeps sweeping a handful of dangling nets from costing a
+    //full-netlist re-build pass.
+    bool blocks_changed = (num_removed_blocks_ > 0);
+    bool ports_changed = (num_removed_ports_ > 0);
+    bool pins_changed = (num_removed_pins_ > 0);
+    bool nets_changed = (num_removed_nets_ > 0);
+
+    if (nets_changed) clean_nets(id_remapper.net_id_map_);
+    if (pins_changed) clean_pins(id_remapper.pin_id_map_);
+    if (ports_changed) clean_ports(id_remapper.port_id_map_);
+    if (blocks_changed) clean_blocks(id_remapper.block_id_map_);
     //TODO: clean strings
     //TODO: iterative cleaning?
 
@@ -1056,20 +1195,41 @@ typename Netlist<BlockId, PortId, PinId, NetId>::IdRemapper Netlist<BlockId, Por
     // Note: net references must be rebuilt (to remove pins) before
     //       the pin references can be rebuilt (to account for index changes
     //       due to pins being removed from the net)
-    rebuild_block_refs(id_remapper.pin_id_map_, id_remapper.port_id_map_);
-    rebuild_port_refs(id_remapper.block_id_map_, id_remapper.pin_id_map_);
-    rebuild_net_refs(id_remapper.pin_id_map_);
-    rebuild_pin_refs(id_remapper.port_id_map_, id_remapper.net_id_map_);
+    if (pins_changed || ports_changed) rebuild_block_refs(id_remapper.pin_id_map_, id_remapper.port_id_map_);
+    if (blocks_changed || pins_changed) rebuild_port_refs(id_remapper.block_id_map_, id_remapper.pin_id_map_);
+    if (pins_changed) rebuild_net_refs(id_remapper.pin_id_map_);
+
+    //Note: removing a pin from a net shifts the net indices of the remaining
+    //sinks, so the pin net indices must be re-built when pins were removed
+    //even if no nets were
+    if (pins_changed || ports_changed || nets_changed) rebuild_pin_refs(id_remapper.port_id_map_, id_remapper.net_id_map_);
 
     //Re-build the lookups
-    rebuild_lookups();
+    if (blocks_changed || nets_changed) rebuild_lookups();
 
     //Resize containers to exact size
-    shrink_to_fit();
+    //
+    //The clean_*() passes above already re-allocate the compacted types at
+    //their exact sizes, so a full shrink pass (which re-allocates *every*
+    //container, including the untouched types) is only worth paying for when
+    //a significant fraction of the netlist was removed
+    constexpr size_t SHRINK_REMOVED_FRACTION_DENOM = 16; //Shrink if >= 1/16 of elements removed
+    size_t num_removed = num_removed_blocks_ + num_removed_ports_ + num_removed_pins_ + num_removed_nets_;
+    size_t num_elements = block_ids_.size() + port_ids_.size() + pin_ids_.size() + net_ids_.size();
+    if (num_removed * SHRINK_REMOVED_FRACTION_DENOM >= num_elements) {
+        shrink_to_fit();
+    }
 
     //Netlist is now clean
+    num_removed_blocks_ = 0;
+    num_removed_ports_ = 0;
+    num_removed_pins_ = 0;
+    num_removed_nets_ = 0;
     dirty_ = false;
 
+    //Build the flattened net pin array over the compacted ids
+    rebuild_flat_net_pins();
+
     return id_remapper;
 }
 
@@ -1346,6 +1506,33 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_net_refs(const vtr::vector_
     VTR_ASSERT(validate_net_sizes());
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::rebuild_flat_net_pins() {
+    flat_net_pins_.clear();
+    flat_net_pin_offsets_.assign(net_pins_.size() + 1, 0);
+
+    size_t num_net_pins = 0;
+    for (const auto& pin_collection : net_pins_) {
+        num_net_pins += pin_collection.size();
+    }
+    flat_net_pins_.reserve(num_net_pins);
+
+    size_t inet = 0;
+    for (const auto& pin_collection : net_pins_) {
+        flat_net_pin_offsets_[inet++] = flat_net_pins_.size();
+        flat_net_pins_.insert(flat_net_pins_.end(), pin_collection.begin(), pin_collection.end());
+    }
+    flat_net_pin_offsets_[inet] = flat_net_pins_.size();
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::invalidate_flat_net_pins() {
+    flat_net_pins_.clear();
+    flat_net_pins_.shrink_to_fit();
+    flat_net_pin_offsets_.clear();
+    flat_net_pin_offsets_.shrink_to_fit();
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::shrink_to_fit() {
     //Block data
@@ -1401,6 +1588,59 @@ void Netlist<BlockId, PortId, PinId, NetId>::shrink_to_fit() {
     VTR_ASSERT(validate_string_sizes());
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::reserve(size_t num_blocks, size_t num_ports, size_t num_pins, size_t num_nets) {
+    //Block data
+    block_ids_.reserve(num_blocks);
+    block_names_.reserve(num_blocks);
+
+    block_pins_.reserve(num_blocks);
+    block_num_input_pins_.reserve(num_blocks);
+    block_num_output_pins_.reserve(num_blocks);
+    block_num_clock_pins_.reserve(num_blocks);
+
+    block_ports_.reserve(num_blocks);
+    block_num_input_ports_.reserve(num_blocks);
+    block_num_output_ports_.reserve(num_blocks);
+    block_num_clock_ports_.reserve(num_blocks);
+
+    block_params_.reserve(num_blocks);
+    block_attrs_.reserve(num_blocks);
+
+    //Port data
+    port_ids_.reserve(num_ports);
+    port_names_.reserve(num_ports);
+    port_blocks_.reserve(num_ports);
+    port_widths_.reserve(num_ports);
+    port_types_.reserve(num_ports);
+    port_pins_.reserve(num_ports);
+
+    //Pin data
+    pin_ids_.reserve(num_pins);
+    pin_ports_.reserve(num_pins);
+    pin_port_bits_.reserve(num_pins);
+    pin_nets_.reserve(num_pins);
+    pin_net_indices_.reserve(num_pins);
+    pin_is_constant_.reserve(num_pins);
+
+    //Net data
+    net_ids_.reserve(num_nets);
+    net_names_.reserve(num_nets);
+    net_pins_.reserve(num_nets);
+
+    //String data
+    //Most unique strings are block and net names, so their combined count is
+    //a reasonable estimate for the string table
+    size_t num_strings = num_blocks + num_nets;
+    string_ids_.reserve(num_strings);
+    strings_.reserve(num_strings);
+    string_to_string_id_.reserve(num_strings);
+    block_name_to_block_id_.reserve(num_strings);
+    net_name_to_net_id_.reserve(num_strings);
+
+    reserve_impl(num_blocks, num_ports, num_pins, num_nets);
+}
+
 /*
  *
  * Sanity Checks
@@ -1803,12 +2043,17 @@ bool Netlist<BlockId, PortId, PinId, NetId>::verify_block_invariants() const {
  */
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortId, PinId, NetId>::find_string(const std::string& str) const {
-    auto iter = string_to_string_id_.find(str);
+    //Intern the query so the look-up (and any subsequent comparison) is a
+    //pointer compare against the shared copy. Note the internment is shared
+    //process-wide state, not part of this netlist's logical state.
+    const std::string* interned_str = vtr::global_string_internment().intern(str);
+
+    auto iter = string_to_string_id_.find(interned_str);
     if (iter != string_to_string_id_.end()) {
         StringId str_id = iter->second;
 
         VTR_ASSERT_SAFE(str_id);
-        VTR_ASSERT_SAFE(strings_[str_id] == str);
+        VTR_ASSERT_SAFE(strings_[str_id] == interned_str);
 
         return str_id;
     } else {
@@ -1852,7 +2097,9 @@ void Netlist<BlockId, PortId, PinId, NetId>::associate_pin_with_block(const PinI
     }
 
     //Insert the element just before iter
-    auto new_iter = block_pins_[blk_id].insert(iter, pin_id);
+    size_t ipin = iter - block_pins(blk_id).begin();
+    block_pins_[blk_id].insert(block_pins_[blk_id].begin() + ipin, pin_id);
+    pin_iterator new_iter = block_pins(blk_id).begin() + ipin;
 
     //Inserted value should be the last valid range element
     if (type == PortType::INPUT) {
@@ -1870,6 +2117,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::associate_pin_with_block(const PinI
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 int Netlist<BlockId, PortId, PinId, NetId>::associate_pin_with_net(const PinId pin_id, const PinType type, const NetId net_id) {
+    invalidate_flat_net_pins(); //Net membership is changing
+
     //Add the pin to the net
     if (type == PinType::DRIVER) {
         VTR_ASSERT_MSG(net_pins_[net_id].size() > 0, "Must be space for net's pin");
@@ -1942,8 +2191,15 @@ void Netlist<BlockId, PortId, PinId, NetId>::associate_port_with_block(const Por
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortId, PinId, NetId>::create_string(const std::string& str) {
-    StringId str_id = find_string(str);
-    if (!str_id) {
+    //Intern the string in the shared pool (a no-op returning the existing
+    //copy if it has been interned before, by this netlist or anything else)
+    const std::string* interned_str = vtr::global_string_internment().intern(str);
+
+    StringId str_id = StringId::INVALID();
+    auto iter = string_to_string_id_.find(interned_str);
+    if (iter != string_to_string_id_.end()) {
+        str_id = iter->second;
+    } else {
         //Not found, create
 
         //Reserve an id
@@ -1951,11 +2207,10 @@ typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortI
         string_ids_.push_back(str_id);
 
         //Store the reverse look-up
-        auto key = str;
-        string_to_string_id_[key] = str_id;
+        string_to_string_id_[interned_str] = str_id;
 
         //Initialize the data
-        strings_.emplace_back(str);
+        strings_.emplace_back(interned_str);
     }
 
     //Check post-conditions: sizes
@@ -1963,7 +2218,7 @@ typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortI
     VTR_ASSERT(strings_.size() == string_ids_.size());
 
     //Check post-conditions: values
-    VTR_ASSERT(strings_[str_id] == str);
+    VTR_ASSERT(strings_[str_id] == interned_str);
     VTR_ASSERT_SAFE(find_string(str) == str_id);
 
     return str_id;
@@ -1,14 +1,31 @@
+#include <algorithm>
+#include <thread>
+
 #include "netlist_walker.h"
 #include "globals.h"
 #include "atom_netlist.h"
 
+//Minimum number of top-level blocks each parallel walk worker should be
+//responsible for. Avoids spawning threads whose start-up cost exceeds the
+//per-block visiting work.
+constexpr size_t MIN_BLOCKS_PER_WALK_WORKER = 64;
+
 void NetlistWalker::walk() {
     auto& atom_ctx = g_vpr_ctx.atom();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     visitor_.visit_top(atom_ctx.nlist.netlist_name().c_str());
 
-    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+    walk_range(0, cluster_ctx.clb_nlist.blocks().size());
+
+    visitor_.finish();
+}
+
+void NetlistWalker::walk_range(size_t iblk_begin, size_t iblk_end) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    for (size_t iblk = iblk_begin; iblk < iblk_end; ++iblk) {
+        ClusterBlockId blk_id(iblk);
         const auto* pb = cluster_ctx.clb_nlist.block_pb(blk_id);
 
         //Visit the top-level block
@@ -17,8 +34,64 @@ void NetlistWalker::walk() {
         //Visit all the block's primitives
         walk_blocks(pb->pb_route, pb);
     }
+}
 
-    visitor_.finish();
+void walk_netlist_parallel(const std::function<std::unique_ptr<NetlistVisitor>()>& visitor_factory,
+                           const std::function<void(std::vector<std::unique_ptr<NetlistVisitor>>&)>& merge_visitors) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    const std::string& top_level_name = atom_ctx.nlist.netlist_name();
+    size_t num_blocks = cluster_ctx.clb_nlist.blocks().size();
+
+    size_t num_workers = 1;
+    if (std::thread::hardware_concurrency() > 1) {
+        num_workers = std::min<size_t>(std::thread::hardware_concurrency(), std::max<size_t>(1, num_blocks / MIN_BLOCKS_PER_WALK_WORKER));
+    }
+
+    std::vector<std::unique_ptr<NetlistVisitor>> visitors(num_workers);
+
+    if (num_workers <= 1) {
+        visitors[0] = visitor_factory();
+        visitors[0]->visit_top(top_level_name.c_str());
+        NetlistWalker walker(*visitors[0]);
+        walker.walk_range(0, num_blocks);
+        merge_visitors(visitors);
+        return;
+    }
+
+    size_t blocks_per_worker = (num_blocks + num_workers - 1) / num_workers;
+
+    std::vector<std::exception_ptr> worker_errors(num_workers);
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+        size_t iblk_begin = std::min(num_blocks, iworker * blocks_per_worker);
+        size_t iblk_end = std::min(num_blocks, iblk_begin + blocks_per_worker);
+        workers.emplace_back([&, iworker, iblk_begin, iblk_end]() {
+            try {
+                visitors[iworker] = visitor_factory();
+                visitors[iworker]->visit_top(top_level_name.c_str());
+                NetlistWalker walker(*visitors[iworker]);
+                walker.walk_range(iblk_begin, iblk_end);
+            } catch (...) {
+                worker_errors[iworker] = std::current_exception();
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto& worker_error : worker_errors) {
+        if (worker_error) {
+            std::rethrow_exception(worker_error);
+        }
+    }
+
+    merge_visitors(visitors);
 }
 
 void NetlistWalker::walk_blocks(const t_pb_routes& top_pb_route, const t_pb* pb) {
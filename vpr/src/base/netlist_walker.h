@@ -1,5 +1,9 @@
 #ifndef NETLIST_WALKER_H
 #define NETLIST_WALKER_H
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "vpr_types.h"
 
 class NetlistVisitor;
@@ -11,6 +15,12 @@ class NetlistWalker {
 
     void walk();
 
+    //Walks only the top-level blocks with indices in [iblk_begin, iblk_end).
+    //Unlike walk() this calls neither visit_top() nor finish(); it is used
+    //both by walk() and by walk_netlist_parallel() to dispatch contiguous
+    //block ranges to per-worker visitors.
+    void walk_range(size_t iblk_begin, size_t iblk_end);
+
   private:
     void walk_blocks(const t_pb_routes& pb_route, const t_pb* pb);
 
@@ -18,6 +28,22 @@ class NetlistWalker {
     NetlistVisitor& visitor_;
 };
 
+//Walks the netlist with independent top-level blocks dispatched across
+//worker threads.
+//
+//Each worker creates its own visitor via visitor_factory, calls visit_top()
+//on it, and then walks it over a contiguous range of top-level blocks. After
+//all workers have joined, merge_visitors is called with the visitors in
+//block order; it is responsible for combining the per-visitor results and
+//emitting any final output (finish() is NOT called on the visitors). A merge
+//which concatenates the per-visitor results therefore reproduces the output
+//of a serial walk() exactly.
+//
+//visitor_factory may be called concurrently, and visitors must not touch
+//shared mutable state while walking.
+void walk_netlist_parallel(const std::function<std::unique_ptr<NetlistVisitor>()>& visitor_factory,
+                           const std::function<void(std::vector<std::unique_ptr<NetlistVisitor>>&)>& merge_visitors);
+
 class NetlistVisitor {
   public:
     virtual ~NetlistVisitor() = default;
@@ -10,6 +10,7 @@
 #include <memory>
 #include <unordered_set>
 #include <cmath>
+#include <thread>
 
 #include "vtr_assert.h"
 #include "vtr_util.h"
@@ -118,6 +119,53 @@ std::string join_identifier(std::string lhs, std::string rhs);
 //
 //
 
+//Formats num_elements elements into os, parallelizing the formatting across
+//worker threads when there are enough elements to justify it.
+//
+//format_element is called as format_element(os, ielem) for each element index
+//in [0, num_elements). When running in parallel each worker formats a
+//contiguous chunk of elements into its own in-memory stream and the chunks
+//are written to os in order, so the output is identical to a serial loop.
+//format_element must not touch shared mutable state.
+template<typename Func>
+void parallel_format_chunks(std::ostream& os, size_t num_elements, const Func& format_element) {
+    constexpr size_t MIN_ELEMENTS_PER_FORMAT_WORKER = 256;
+
+    size_t num_workers = 1;
+    if (std::thread::hardware_concurrency() > 1) {
+        num_workers = std::min<size_t>(std::thread::hardware_concurrency(),
+                                       std::max<size_t>(1, num_elements / MIN_ELEMENTS_PER_FORMAT_WORKER));
+    }
+
+    if (num_workers <= 1) {
+        for (size_t ielem = 0; ielem < num_elements; ++ielem) {
+            format_element(os, ielem);
+        }
+        return;
+    }
+
+    std::vector<std::ostringstream> chunk_os(num_workers);
+    size_t chunk_size = (num_elements + num_workers - 1) / num_workers;
+
+    std::vector<std::thread> workers;
+    for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+        size_t chunk_begin = iworker * chunk_size;
+        size_t chunk_end = std::min(chunk_begin + chunk_size, num_elements);
+        workers.emplace_back([&, iworker, chunk_begin, chunk_end]() {
+            for (size_t ielem = chunk_begin; ielem < chunk_end; ++ielem) {
+                format_element(chunk_os[iworker], ielem);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (std::ostringstream& chunk : chunk_os) {
+        os << chunk.str();
+    }
+}
+
 //A combinational timing arc
 class Arc {
   public:
@@ -804,6 +852,28 @@ class NetlistWriterVisitor : public NetlistVisitor {
     NetlistWriterVisitor& operator=(NetlistWriterVisitor& rhs) = delete;
     NetlistWriterVisitor& operator=(NetlistWriterVisitor&& rhs) = delete;
 
+    //Appends the netlist elements collected by 'other' (which visited a
+    //later contiguous range of top-level blocks) onto this visitor's
+    //collections, so merging a set of per-worker visitors in block order
+    //matches a single serial walk. Used with walk_netlist_parallel().
+    void merge(NetlistWriterVisitor& other) {
+        VTR_ASSERT(top_module_name_ == other.top_module_name_);
+
+        inputs_.insert(inputs_.end(), other.inputs_.begin(), other.inputs_.end());
+        outputs_.insert(outputs_.end(), other.outputs_.begin(), other.outputs_.end());
+        assignments_.insert(assignments_.end(), other.assignments_.begin(), other.assignments_.end());
+        cell_instances_.insert(cell_instances_.end(), other.cell_instances_.begin(), other.cell_instances_.end());
+
+        for (const auto& kv : other.logical_net_drivers_) {
+            auto ret = logical_net_drivers_.insert(kv);
+            VTR_ASSERT_MSG(ret.second, "Net drivers are unique");
+        }
+        for (const auto& kv : other.logical_net_sinks_) {
+            auto& sinks = logical_net_sinks_[kv.first];
+            sinks.insert(sinks.end(), kv.second.begin(), kv.second.end());
+        }
+    }
+
   private: //Internal types
   private: //NetlistVisitor interface functions
     void visit_top_impl(const char* top_level_name) override {
@@ -908,12 +978,13 @@ class NetlistWriterVisitor : public NetlistVisitor {
             }
         }
 
-        //All the cell instances
+        //All the cell instances (formatted in parallel, the instances are
+        //independent)
         verilog_os_ << "\n";
         verilog_os_ << indent(depth + 1) << "//Cell instances\n";
-        for (auto& inst : cell_instances_) {
-            inst->print_verilog(verilog_os_, depth + 1);
-        }
+        parallel_format_chunks(verilog_os_, cell_instances_.size(), [&](std::ostream& os, size_t iinst) {
+            cell_instances_[iinst]->print_verilog(os, depth + 1);
+        });
 
         verilog_os_ << "\n";
         verilog_os_ << indent(depth) << "endmodule\n";
@@ -985,6 +1056,16 @@ class NetlistWriterVisitor : public NetlistVisitor {
         sdf_os_ << "\n";
 
         //Interconnect
+        //
+        //The delays are extracted up-front, batching the delay calculator
+        //calls (which cache internally and so are not thread-safe), so the
+        //CELL formatting itself can then be parallelized
+        struct t_interconnect_delay {
+            std::string driver_wire;
+            std::string sink_wire;
+            double delay_ps;
+        };
+        std::vector<t_interconnect_delay> interconnect_delays;
         for (const auto& kv : logical_net_sinks_) {
             auto atom_net_id = kv.first;
             auto driver_iter = logical_net_drivers_.find(atom_net_id);
@@ -993,32 +1074,37 @@ class NetlistWriterVisitor : public NetlistVisitor {
             auto driver_tnode = driver_iter->second.second;
 
             for (auto& sink_wire_tnode_pair : kv.second) {
-                auto sink_wire = sink_wire_tnode_pair.first;
-                auto sink_tnode = sink_wire_tnode_pair.second;
+                double delay = get_delay_ps(driver_tnode, sink_wire_tnode_pair.second);
+                interconnect_delays.push_back({driver_wire, sink_wire_tnode_pair.first, delay});
+            }
+        }
 
-                sdf_os_ << indent(depth + 1) << "(CELL\n";
-                sdf_os_ << indent(depth + 2) << "(CELLTYPE \"fpga_interconnect\")\n";
-                sdf_os_ << indent(depth + 2) << "(INSTANCE " << escape_sdf_identifier(interconnect_name(driver_wire, sink_wire)) << ")\n";
-                sdf_os_ << indent(depth + 2) << "(DELAY\n";
-                sdf_os_ << indent(depth + 3) << "(ABSOLUTE\n";
+        parallel_format_chunks(sdf_os_, interconnect_delays.size(), [&](std::ostream& os, size_t iinterconnect) {
+            const t_interconnect_delay& interconnect_delay = interconnect_delays[iinterconnect];
 
-                double delay = get_delay_ps(driver_tnode, sink_tnode);
+            os << indent(depth + 1) << "(CELL\n";
+            os << indent(depth + 2) << "(CELLTYPE \"fpga_interconnect\")\n";
+            os << indent(depth + 2) << "(INSTANCE " << escape_sdf_identifier(interconnect_name(interconnect_delay.driver_wire, interconnect_delay.sink_wire)) << ")\n";
+            os << indent(depth + 2) << "(DELAY\n";
+            os << indent(depth + 3) << "(ABSOLUTE\n";
 
-                std::stringstream delay_triple;
-                delay_triple << "(" << delay << ":" << delay << ":" << delay << ")";
+            double delay = interconnect_delay.delay_ps;
 
-                sdf_os_ << indent(depth + 4) << "(IOPATH datain dataout " << delay_triple.str() << " " << delay_triple.str() << ")\n";
-                sdf_os_ << indent(depth + 3) << ")\n";
-                sdf_os_ << indent(depth + 2) << ")\n";
-                sdf_os_ << indent(depth + 1) << ")\n";
-                sdf_os_ << indent(depth) << "\n";
-            }
-        }
+            std::stringstream delay_triple;
+            delay_triple << "(" << delay << ":" << delay << ":" << delay << ")";
 
-        //Cells
-        for (const auto& inst : cell_instances_) {
-            inst->print_sdf(sdf_os_, depth + 1);
-        }
+            os << indent(depth + 4) << "(IOPATH datain dataout " << delay_triple.str() << " " << delay_triple.str() << ")\n";
+            os << indent(depth + 3) << ")\n";
+            os << indent(depth + 2) << ")\n";
+            os << indent(depth + 1) << ")\n";
+            os << indent(depth) << "\n";
+        });
+
+        //Cells (formatted in parallel, all delays were extracted when the
+        //instances were created)
+        parallel_format_chunks(sdf_os_, cell_instances_.size(), [&](std::ostream& os, size_t iinst) {
+            cell_instances_[iinst]->print_sdf(os, depth + 1);
+        });
 
         sdf_os_ << indent(depth) << ")\n";
     }
@@ -2002,11 +2088,24 @@ void netlist_writer(const std::string basename, std::shared_ptr<const AnalysisDe
     std::ofstream blif_os(blif_filename);
     std::ofstream sdf_os(sdf_filename);
 
-    NetlistWriterVisitor visitor(verilog_os, blif_os, sdf_os, delay_calc);
-
-    NetlistWalker nl_walker(visitor);
-
-    nl_walker.walk();
+    //Walk the netlist with per-worker visitors, each collecting the
+    //primitives of a contiguous block range. The per-worker results are
+    //merged in block order before printing, so the emitted files are
+    //identical to those of a serial walk. Note the visitors only collect
+    //during the walk (all printing happens in finish()), and the delay
+    //calculator supports the same concurrent read-only use the parallel
+    //timing analyzers make of it.
+    walk_netlist_parallel(
+        [&]() -> std::unique_ptr<NetlistVisitor> {
+            return std::unique_ptr<NetlistVisitor>(new NetlistWriterVisitor(verilog_os, blif_os, sdf_os, delay_calc));
+        },
+        [](std::vector<std::unique_ptr<NetlistVisitor>>& visitors) {
+            auto& primary = static_cast<NetlistWriterVisitor&>(*visitors[0]);
+            for (size_t ivisitor = 1; ivisitor < visitors.size(); ++ivisitor) {
+                primary.merge(static_cast<NetlistWriterVisitor&>(*visitors[ivisitor]));
+            }
+            primary.finish();
+        });
 }
 
 //
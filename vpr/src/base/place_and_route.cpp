@@ -1,11 +1,19 @@
 #include <sys/types.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <ctime>
 #include <climits>
 #include <cstdlib>
 #include <cmath>
 
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <csignal>
+#endif
+
 #include "vtr_util.h"
 #include "vtr_memory.h"
 #include "vtr_assert.h"
@@ -41,6 +49,29 @@
 
 static float comp_width(t_chan* chan, float x, float separation);
 
+#ifdef __unix__
+//A single speculative channel-width probe, routed in a forked child process
+struct t_width_probe {
+    int width = 0;
+    pid_t pid = -1;
+    bool done = false;
+    bool success = false;
+    bool cancelled = false; //Probe was made redundant by another result; 'success' is meaningless
+};
+
+static std::vector<int> choose_speculative_widths(int current, int low, int high, int max_probes, int udsd_multiplier);
+
+static void probe_widths_speculatively(std::vector<t_width_probe>& probes,
+                                       const t_router_opts& router_opts,
+                                       const t_analysis_opts& analysis_opts,
+                                       t_det_routing_arch* det_routing_arch,
+                                       std::vector<t_segment_inf>& segment_inf,
+                                       vtr::vector<ClusterNetId, float*>& net_delay,
+                                       std::shared_ptr<SetupHoldTimingInfo> timing_info,
+                                       std::shared_ptr<RoutingDelayCalculator> delay_calc,
+                                       const t_arch* arch);
+#endif
+
 /************************* Subroutine Definitions ****************************/
 
 int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
@@ -60,7 +91,7 @@ int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
      * tracks per channel required to successfully route a circuit, and returns *
      * that minimum width_fac.                                                  */
 
-    vtr::vector<ClusterNetId, t_trace*> best_routing; /* Saves the best routing found so far. */
+    vtr::vector<ClusterNetId, t_traceback> best_routing; /* Saves the best routing found so far. */
     int current, low, high, final;
     bool success, prev_success, prev2_success, Fc_clipped = false;
     bool using_minw_hint = false;
@@ -140,6 +171,21 @@ int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
 
     attempt_count = 0;
 
+    /* Speculative minimum-W search: route several candidate widths in
+     * concurrent child processes (each sharing this process' placement via
+     * copy-on-write and building its own RR graph), tightening the search
+     * bounds as probes complete and cancelling probes made redundant by
+     * earlier results. The winning width is always re-routed in this
+     * process, which both materializes the routing here and -- since the
+     * router is deterministic for a fixed placement and width -- confirms
+     * the speculative result. */
+    bool speculate = false;
+#ifdef __unix__
+    speculate = router_opts.speculative_width_probes > 1
+                && router_opts.fixed_channel_width == NO_FIXED_CHANNEL_WIDTH
+                && placer_opts.place_freq != PLACE_ALWAYS;
+#endif
+
     while (final == -1) {
         VTR_LOG("\n");
         VTR_LOG("Attempting to route at %d channels (binary search bounds: [%d, %d])\n", current, low, high);
@@ -169,6 +215,60 @@ int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
             break;
         }
 
+#ifdef __unix__
+        if (speculate) {
+            std::vector<int> widths = choose_speculative_widths(current, low, high, router_opts.speculative_width_probes, udsd_multiplier);
+            if (widths.size() >= 2) {
+                std::vector<t_width_probe> probes(widths.size());
+                VTR_LOG("Speculatively routing at channel widths:");
+                for (size_t iprobe = 0; iprobe < widths.size(); ++iprobe) {
+                    probes[iprobe].width = widths[iprobe];
+                    VTR_LOG(" %d", widths[iprobe]);
+                }
+                VTR_LOG("\n");
+                fflush(stdout);
+
+                probe_widths_speculatively(probes, router_opts, analysis_opts,
+                                           det_routing_arch, segment_inf, net_delay,
+                                           timing_info, delay_calc, arch);
+
+                for (auto& probe : probes) {
+                    if (probe.cancelled) {
+                        VTR_LOG("Speculative route at %d channels: cancelled\n", probe.width);
+                        continue;
+                    }
+                    VTR_LOG("Speculative route at %d channels: %s\n", probe.width, probe.success ? "success" : "failure");
+                    if (probe.success) {
+                        high = (high == -1) ? probe.width : std::min(high, probe.width);
+                    } else {
+                        low = std::max(low, probe.width);
+                    }
+                    attempt_count++;
+                }
+
+                if (high != -1 && (high - std::max(low, 0)) <= 1 * udsd_multiplier) {
+                    /* Bounds have converged: route the winner in this process
+                     * to confirm it and materialize the routing. */
+                    current = high;
+                    speculate = false;
+                } else {
+                    if (low != -1 && high != -1) {
+                        current = (high + low) / 2;
+                    } else if (high != -1) {
+                        current = high / 2;
+                        if (std::abs(current - high) < udsd_multiplier) {
+                            current = high - udsd_multiplier;
+                        }
+                    } else {
+                        current = low * 2;
+                    }
+                    current = current + current % udsd_multiplier;
+                    continue;
+                }
+            }
+        }
+#endif
+
         if (placer_opts.place_freq == PLACE_ALWAYS) {
             placer_opts.place_chan_width = current;
             try_place(placer_opts, annealing_sched, router_opts, analysis_opts,
@@ -357,6 +457,7 @@ int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
                     router_opts.trim_obs_channels,
                     router_opts.clock_modeling,
                     arch->Directs, arch->num_directs,
+                    router_opts.router_num_workers,
                     &warnings);
 
     init_draw_coords(final);
@@ -375,6 +476,140 @@ int binary_search_place_and_route(const t_placer_opts& placer_opts_ref,
     return (final);
 }
 
+#ifdef __unix__
+
+/* Picks up to max_probes candidate channel widths to probe concurrently,
+ * rounded to the track multiplier and restricted to the open interval
+ * between the current search bounds. The serial search's next guess
+ * ('current') always comes first; the remaining candidates are spread so
+ * that every outcome tightens the bounds: evenly spaced interior widths
+ * once both bounds are known, otherwise a geometric descent/ascent
+ * mirroring the serial search's bound-finding steps. */
+static std::vector<int> choose_speculative_widths(int current, int low, int high, int max_probes, int udsd_multiplier) {
+    std::vector<int> widths;
+
+    auto add_width = [&](int width) {
+        width += width % udsd_multiplier;
+        if (width <= 0 || width > 1000) return;
+        if (low != -1 && width <= low) return;
+        if (high != -1 && width >= high) return;
+        if (std::find(widths.begin(), widths.end(), width) != widths.end()) return;
+        widths.push_back(width);
+    };
+
+    add_width(current);
+
+    if (low != -1 && high != -1) {
+        for (int i = 1; (int)widths.size() < max_probes && i <= max_probes; ++i) {
+            add_width(low + (high - low) * i / (max_probes + 1));
+        }
+    } else if (high != -1) { //Still searching for a lower bound
+        int width = current;
+        while ((int)widths.size() < max_probes && width > udsd_multiplier) {
+            width /= 2;
+            add_width(width);
+        }
+    } else { //Still searching for an upper bound
+        int width = current;
+        while ((int)widths.size() < max_probes && width <= 500) {
+            width *= 2;
+            add_width(width);
+        }
+    }
+
+    return widths;
+}
+
+/* Routes each probe's channel width in a forked child process and collects
+ * the outcomes through the children's exit statuses. As results come in,
+ * still-running probes whose outcome is already implied (wider than a
+ * success, or narrower than a failure) are killed and marked cancelled.
+ * Children inherit the placement by copy-on-write and build their own
+ * per-width RR graphs in parallel; their log output is silenced since the
+ * parent reports each probe's outcome. */
+static void probe_widths_speculatively(std::vector<t_width_probe>& probes,
+                                       const t_router_opts& router_opts,
+                                       const t_analysis_opts& analysis_opts,
+                                       t_det_routing_arch* det_routing_arch,
+                                       std::vector<t_segment_inf>& segment_inf,
+                                       vtr::vector<ClusterNetId, float*>& net_delay,
+                                       std::shared_ptr<SetupHoldTimingInfo> timing_info,
+                                       std::shared_ptr<RoutingDelayCalculator> delay_calc,
+                                       const t_arch* arch) {
+    fflush(stdout);
+    fflush(stderr);
+
+    for (auto& probe : probes) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            /* Child: route at probe.width with output silenced and report the
+             * outcome through the exit status. _exit() avoids running the
+             * parent's atexit handlers on the shared (copy-on-write) state. */
+            int devnull = open("/dev/null", O_WRONLY);
+            if (devnull != -1) {
+                dup2(devnull, STDOUT_FILENO);
+                dup2(devnull, STDERR_FILENO);
+                close(devnull);
+            }
+
+            bool success = false;
+            try {
+                success = try_route(probe.width,
+                                    router_opts,
+                                    analysis_opts,
+                                    det_routing_arch, segment_inf,
+                                    net_delay,
+                                    timing_info,
+                                    delay_calc,
+                                    arch->Chans,
+                                    arch->Directs, arch->num_directs,
+                                    ScreenUpdatePriority::MINOR);
+            } catch (...) {
+                success = false;
+            }
+            _exit(success ? 0 : 1);
+        } else if (pid > 0) {
+            probe.pid = pid;
+        } else {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "Failed to fork speculative routing probe at channel width %d.\n", probe.width);
+        }
+    }
+
+    size_t num_running = probes.size();
+    while (num_running > 0) {
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            break; //No children left to wait for
+        }
+
+        for (auto& probe : probes) {
+            if (probe.pid != pid || probe.done) continue;
+
+            probe.done = true;
+            --num_running;
+
+            if (probe.cancelled) break;
+
+            probe.success = (WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+            /* Kill probes whose outcome this result already implies */
+            for (auto& other : probes) {
+                if (other.done || other.cancelled) continue;
+                if ((probe.success && other.width > probe.width)
+                    || (!probe.success && other.width < probe.width)) {
+                    other.cancelled = true;
+                    kill(other.pid, SIGTERM);
+                }
+            }
+            break;
+        }
+    }
+}
+
+#endif //__unix__
+
 t_chan_width init_chan(int cfactor, t_chan_width_dist chan_width_dist) {
     /* Assigns widths to channels (in tracks).  Minimum one track          *
      * per channel. The channel distributions read from the architecture  *
@@ -1,4 +1,6 @@
 #include <cstring>
+#include <unordered_map>
+#include <vector>
 
 #include "read_activity.h"
 
@@ -9,13 +11,37 @@
 
 #include "atom_netlist.h"
 
-static bool add_activity_to_net(const AtomNetlist& netlist, std::unordered_map<AtomNetId, t_net_power>& atom_net_power, char* net_name, float probability, float density);
+//Hash/compare for c-string keys, allowing the net name lookup below to be
+//queried with tokens pointing directly into the file buffer (no per-line
+//std::string construction)
+struct t_cstr_hash {
+    size_t operator()(const char* str) const {
+        //FNV-1a
+        size_t hash = 14695981039346656037ULL;
+        for (; *str != '\0'; ++str) {
+            hash = (hash ^ (unsigned char)*str) * 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+struct t_cstr_eq {
+    bool operator()(const char* lhs, const char* rhs) const {
+        return strcmp(lhs, rhs) == 0;
+    }
+};
+
+typedef std::unordered_map<const char*, AtomNetId, t_cstr_hash, t_cstr_eq> t_net_name_lookup;
 
-static bool add_activity_to_net(const AtomNetlist& netlist, std::unordered_map<AtomNetId, t_net_power>& atom_net_power, char* net_name, float probability, float density) {
-    AtomNetId net_id = netlist.find_net(net_name);
-    if (net_id) {
-        atom_net_power[net_id].probability = probability;
-        atom_net_power[net_id].density = density;
+static bool add_activity_to_net(const t_net_name_lookup& net_name_lookup,
+                                vtr::vector<AtomNetId, t_net_power>& atom_net_power,
+                                const char* net_name,
+                                float probability,
+                                float density) {
+    auto itr = net_name_lookup.find(net_name);
+    if (itr != net_name_lookup.end()) {
+        t_net_power& net_power = atom_net_power[itr->second];
+        net_power.probability = probability;
+        net_power.density = density;
         return false;
     }
 
@@ -25,39 +51,57 @@ static bool add_activity_to_net(const AtomNetlist& netlist, std::unordered_map<A
     return true;
 }
 
-std::unordered_map<AtomNetId, t_net_power> read_activity(const AtomNetlist& netlist, const char* activity_file) {
-    char buf[vtr::bufsize];
-    char* ptr;
-    char* word1;
-    char* word2;
-    char* word3;
-
-    FILE* act_file_hdl;
-
-    std::unordered_map<AtomNetId, t_net_power> atom_net_power;
+vtr::vector<AtomNetId, t_net_power> read_activity(const AtomNetlist& netlist, const char* activity_file) {
+    vtr::vector<AtomNetId, t_net_power> atom_net_power(netlist.nets().size());
 
     for (auto net_id : netlist.nets()) {
         atom_net_power[net_id].probability = -1.0;
         atom_net_power[net_id].density = -1.0;
     }
 
-    act_file_hdl = vtr::fopen(activity_file, "r");
+    //Build the name to net lookup once, keyed by the netlist's own name
+    //storage (which is stable while the netlist is unmodified)
+    t_net_name_lookup net_name_lookup;
+    net_name_lookup.reserve(netlist.nets().size());
+    for (auto net_id : netlist.nets()) {
+        net_name_lookup.emplace(netlist.net_name(net_id).c_str(), net_id);
+    }
+
+    FILE* act_file_hdl = vtr::fopen(activity_file, "r");
     if (act_file_hdl == nullptr) {
         VPR_FATAL_ERROR(VPR_ERROR_BLIF_F,
                         "Error: could not open activity file: %s\n", activity_file);
     }
 
-    ptr = vtr::fgets(buf, vtr::bufsize, act_file_hdl);
-    while (ptr != nullptr) {
-        word1 = strtok(buf, TOKENS);
-        word2 = strtok(nullptr, TOKENS);
-        word3 = strtok(nullptr, TOKENS);
-        add_activity_to_net(netlist, atom_net_power, word1, vtr::atof(word2), vtr::atof(word3));
+    //Bulk load the file and tokenize it in place: one large sequential read
+    //instead of a buffered fgets() per line
+    fseek(act_file_hdl, 0, SEEK_END);
+    long file_size = ftell(act_file_hdl);
+    rewind(act_file_hdl);
 
-        ptr = vtr::fgets(buf, vtr::bufsize, act_file_hdl);
-    }
+    std::vector<char> contents(file_size + 1);
+    size_t bytes_read = fread(contents.data(), 1, file_size, act_file_hdl);
+    contents[bytes_read] = '\0';
     fclose(act_file_hdl);
 
+    //Stream over the buffer: each line is 'net_name probability density'
+    char* line = contents.data();
+    while (line != nullptr && *line != '\0') {
+        char* next_line = strchr(line, '\n');
+        if (next_line != nullptr) {
+            *next_line++ = '\0';
+        }
+
+        char* word1 = strtok(line, TOKENS);
+        if (word1 != nullptr) { //Skip blank lines
+            char* word2 = strtok(nullptr, TOKENS);
+            char* word3 = strtok(nullptr, TOKENS);
+            add_activity_to_net(net_name_lookup, atom_net_power, word1, vtr::atof(word2), vtr::atof(word3));
+        }
+
+        line = next_line;
+    }
+
     /* Make sure all nets have an activity value */
     for (auto net_id : netlist.nets()) {
         if (atom_net_power[net_id].probability < 0.0
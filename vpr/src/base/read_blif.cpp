@@ -31,6 +31,7 @@
 #include "vtr_logic.h"
 #include "vtr_time.h"
 #include "vtr_digest.h"
+#include "vtr_compressed_io.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -42,14 +43,28 @@
 
 vtr::LogicValue to_vtr_logic_value(blifparse::LogicValue);
 
+//Estimated netlist element counts determined by a quick scan of a BLIF file
+//(see count_blif_elements()), used to pre-size AtomNetlist storage before parsing.
+//
+//These are capacity hints (upper-ish bounds), not exact sizes.
+struct BlifElementCounts {
+    size_t blocks = 0;
+    size_t ports = 0;
+    size_t pins = 0;
+    size_t nets = 0;
+};
+
+static BlifElementCounts count_blif_elements(const char* blif_file);
+
 struct BlifAllocCallback : public blifparse::Callback {
   public:
-    BlifAllocCallback(e_circuit_format blif_format, AtomNetlist& main_netlist, const std::string netlist_id, const t_model* user_models, const t_model* library_models)
+    BlifAllocCallback(e_circuit_format blif_format, AtomNetlist& main_netlist, const std::string netlist_id, const t_model* user_models, const t_model* library_models, const BlifElementCounts& element_counts)
         : main_netlist_(main_netlist)
         , netlist_id_(netlist_id)
         , user_arch_models_(user_models)
         , library_arch_models_(library_models)
-        , blif_format_(blif_format) {
+        , blif_format_(blif_format)
+        , element_counts_(element_counts) {
         VTR_ASSERT(blif_format_ == e_circuit_format::BLIF
                    || blif_format_ == e_circuit_format::EBLIF);
     }
@@ -67,16 +82,27 @@ struct BlifAllocCallback : public blifparse::Callback {
         main_netlist_ = std::move(blif_models_[main_netlist_idx]);
     }
 
-    void begin_model(std::string model_name) override {
+    void begin_model(blifparse::str_span model_name) override {
         //Create a new model, and set it's name
 
-        blif_models_.emplace_back(model_name, netlist_id_);
+        blif_models_.emplace_back(model_name.str(), netlist_id_);
         blif_models_black_box_.emplace_back(false);
+
+        if (blif_models_.size() == 1) {
+            //The first model is (almost always) the main netlist, so pre-allocate
+            //its storage based on the counting pre-scan of the file. This avoids
+            //repeated re-allocation of the netlist's internal arrays while a
+            //large netlist is elaborated element-by-element.
+            curr_model().reserve(element_counts_.blocks,
+                                 element_counts_.ports,
+                                 element_counts_.pins,
+                                 element_counts_.nets);
+        }
         ended_ = false;
         set_curr_block(AtomBlockId::INVALID()); //This statement doesn't define a block, so mark invalid
     }
 
-    void inputs(std::vector<std::string> input_names) override {
+    void inputs(const std::vector<blifparse::str_span>& input_names) override {
         const t_model* blk_model = find_model(MODEL_INPUT);
 
         VTR_ASSERT_MSG(!blk_model->inputs, "Inpad model has an input port");
@@ -86,15 +112,16 @@ struct BlifAllocCallback : public blifparse::Callback {
 
         std::string pin_name = blk_model->outputs->name;
         for (const auto& input : input_names) {
-            AtomBlockId blk_id = curr_model().create_block(input, blk_model);
+            std::string input_name = input.str();
+            AtomBlockId blk_id = curr_model().create_block(input_name, blk_model);
             AtomPortId port_id = curr_model().create_port(blk_id, blk_model->outputs);
-            AtomNetId net_id = curr_model().create_net(input);
+            AtomNetId net_id = curr_model().create_net(input_name);
             curr_model().create_pin(port_id, 0, net_id, PinType::DRIVER);
         }
         set_curr_block(AtomBlockId::INVALID()); //This statement doesn't define a block, so mark invalid
     }
 
-    void outputs(std::vector<std::string> output_names) override {
+    void outputs(const std::vector<blifparse::str_span>& output_names) override {
         const t_model* blk_model = find_model(MODEL_OUTPUT);
 
         VTR_ASSERT_MSG(!blk_model->outputs, "Outpad model has an output port");
@@ -104,17 +131,18 @@ struct BlifAllocCallback : public blifparse::Callback {
 
         std::string pin_name = blk_model->inputs->name;
         for (const auto& output : output_names) {
+            std::string output_name = output.str();
             //Since we name blocks based on their drivers we need to uniquify outpad names,
             //which we do with a prefix
-            AtomBlockId blk_id = curr_model().create_block(OUTPAD_NAME_PREFIX + output, blk_model);
+            AtomBlockId blk_id = curr_model().create_block(OUTPAD_NAME_PREFIX + output_name, blk_model);
             AtomPortId port_id = curr_model().create_port(blk_id, blk_model->inputs);
-            AtomNetId net_id = curr_model().create_net(output);
+            AtomNetId net_id = curr_model().create_net(output_name);
             curr_model().create_pin(port_id, 0, net_id, PinType::SINK);
         }
         set_curr_block(AtomBlockId::INVALID()); //This statement doesn't define a block, so mark invalid
     }
 
-    void names(std::vector<std::string> nets, std::vector<std::vector<blifparse::LogicValue>> so_cover) override {
+    void names(const std::vector<blifparse::str_span>& nets, const std::vector<std::vector<blifparse::LogicValue>>& so_cover) override {
         const t_model* blk_model = find_model(MODEL_NAMES);
 
         VTR_ASSERT_MSG(nets.size() > 0, "BLIF .names has no connections");
@@ -139,13 +167,15 @@ struct BlifAllocCallback : public blifparse::Callback {
             }
         }
 
-        AtomBlockId blk_id = curr_model().create_block(nets[nets.size() - 1], blk_model, truth_table);
+        std::string output_net_name = nets[nets.size() - 1].str();
+
+        AtomBlockId blk_id = curr_model().create_block(output_net_name, blk_model, truth_table);
         set_curr_block(blk_id);
 
         //Create inputs
         AtomPortId input_port_id = curr_model().create_port(blk_id, blk_model->inputs);
         for (size_t i = 0; i < nets.size() - 1; ++i) {
-            AtomNetId net_id = curr_model().create_net(nets[i]);
+            AtomNetId net_id = curr_model().create_net(nets[i].str());
 
             curr_model().create_pin(input_port_id, i, net_id, PinType::SINK);
         }
@@ -168,7 +198,7 @@ struct BlifAllocCallback : public blifparse::Callback {
             //  0
             //
             output_is_const = true;
-            VTR_LOG("Found constant-zero generator '%s'\n", nets[nets.size() - 1].c_str());
+            VTR_LOG("Found constant-zero generator '%s'\n", output_net_name.c_str());
         } else if (truth_table.size() == 1 && truth_table[0].size() == 1 && truth_table[0][0] == vtr::LogicValue::TRUE) {
             //A single-entry truth table with value '1' in BLIF corresponds to a constant-one
             //  e.g.
@@ -178,18 +208,18 @@ struct BlifAllocCallback : public blifparse::Callback {
             //  1
             //
             output_is_const = true;
-            VTR_LOG("Found constant-one generator '%s'\n", nets[nets.size() - 1].c_str());
+            VTR_LOG("Found constant-one generator '%s'\n", output_net_name.c_str());
         }
 
         //Create output
-        AtomNetId net_id = curr_model().create_net(nets[nets.size() - 1]);
+        AtomNetId net_id = curr_model().create_net(output_net_name);
         AtomPortId output_port_id = curr_model().create_port(blk_id, blk_model->outputs);
         curr_model().create_pin(output_port_id, 0, net_id, PinType::DRIVER, output_is_const);
     }
 
-    void latch(std::string input, std::string output, blifparse::LatchType type, std::string control, blifparse::LogicValue init) override {
+    void latch(blifparse::str_span input, blifparse::str_span output, blifparse::LatchType type, blifparse::str_span control, blifparse::LogicValue init) override {
         if (type == blifparse::LatchType::UNSPECIFIED) {
-            VTR_LOGF_WARN(filename_.c_str(), lineno_, "Treating latch '%s' of unspecified type as rising edge triggered\n", output.c_str());
+            VTR_LOGF_WARN(filename_.c_str(), lineno_, "Treating latch '%s' of unspecified type as rising edge triggered\n", output.data());
         } else if (type != blifparse::LatchType::RISING_EDGE) {
             vpr_throw(VPR_ERROR_BLIF_F, filename_.c_str(), lineno_, "Only rising edge latches supported\n");
         }
@@ -222,38 +252,40 @@ struct BlifAllocCallback : public blifparse::Callback {
         AtomNetlist::TruthTable truth_table(1);
         truth_table[0].push_back(to_vtr_logic_value(init));
 
-        AtomBlockId blk_id = curr_model().create_block(output, blk_model, truth_table);
+        std::string output_name = output.str();
+
+        AtomBlockId blk_id = curr_model().create_block(output_name, blk_model, truth_table);
         set_curr_block(blk_id);
 
         //The input
         AtomPortId d_port_id = curr_model().create_port(blk_id, d_model_port);
-        AtomNetId d_net_id = curr_model().create_net(input);
+        AtomNetId d_net_id = curr_model().create_net(input.str());
         curr_model().create_pin(d_port_id, 0, d_net_id, PinType::SINK);
 
         //The output
         AtomPortId q_port_id = curr_model().create_port(blk_id, q_model_port);
-        AtomNetId q_net_id = curr_model().create_net(output);
+        AtomNetId q_net_id = curr_model().create_net(output_name);
         curr_model().create_pin(q_port_id, 0, q_net_id, PinType::DRIVER);
 
         //The clock
         AtomPortId clk_port_id = curr_model().create_port(blk_id, clk_model_port);
-        AtomNetId clk_net_id = curr_model().create_net(control);
+        AtomNetId clk_net_id = curr_model().create_net(control.str());
         curr_model().create_pin(clk_port_id, 0, clk_net_id, PinType::SINK);
     }
 
-    void subckt(std::string subckt_model, std::vector<std::string> ports, std::vector<std::string> nets) override {
+    void subckt(blifparse::str_span subckt_model, const std::vector<blifparse::str_span>& ports, const std::vector<blifparse::str_span>& nets) override {
         VTR_ASSERT(ports.size() == nets.size());
 
-        const t_model* blk_model = find_model(subckt_model);
+        const t_model* blk_model = find_model(subckt_model.str());
 
         //We name the subckt based on the net it's first output pin drives
         std::string subckt_name;
         for (size_t i = 0; i < ports.size(); ++i) {
-            const t_model_ports* model_port = find_model_port(blk_model, ports[i]);
+            const t_model_ports* model_port = find_model_port(blk_model, ports[i].str());
             VTR_ASSERT(model_port);
 
             if (model_port->dir == OUT_PORT) {
-                subckt_name = nets[i];
+                subckt_name = nets[i].str();
                 break;
             }
         }
@@ -275,7 +307,7 @@ struct BlifAllocCallback : public blifparse::Callback {
             vpr_throw(VPR_ERROR_BLIF_F, filename_.c_str(), lineno_,
                       "Duplicate blocks named '%s' found in netlist."
                       " Existing block of type '%s' conflicts with subckt of type '%s'.",
-                      subckt_name.c_str(), conflicting_model->name, subckt_model.c_str());
+                      subckt_name.c_str(), conflicting_model->name, subckt_model.data());
         }
 
         //Create the block
@@ -284,7 +316,7 @@ struct BlifAllocCallback : public blifparse::Callback {
 
         for (size_t i = 0; i < ports.size(); ++i) {
             //Check for consistency between model and ports
-            const t_model_ports* model_port = find_model_port(blk_model, ports[i]);
+            const t_model_ports* model_port = find_model_port(blk_model, ports[i].str());
             VTR_ASSERT(model_port);
 
             //Determine the pin type
@@ -298,12 +330,12 @@ struct BlifAllocCallback : public blifparse::Callback {
             //Make the port
             std::string port_base;
             size_t port_bit;
-            std::tie(port_base, port_bit) = split_index(ports[i]);
+            std::tie(port_base, port_bit) = split_index(ports[i].str());
 
             AtomPortId port_id = curr_model().create_port(blk_id, find_model_port(blk_model, port_base));
 
             //Make the net
-            AtomNetId net_id = curr_model().create_net(nets[i]);
+            AtomNetId net_id = curr_model().create_net(nets[i].str());
 
             //Make the pin
             curr_model().create_pin(port_id, port_bit, net_id, pin_type);
@@ -337,15 +369,15 @@ struct BlifAllocCallback : public blifparse::Callback {
     }
 
     //BLIF Extensions
-    void conn(std::string src, std::string dst) override {
+    void conn(blifparse::str_span src, blifparse::str_span dst) override {
         if (blif_format_ != e_circuit_format::EBLIF) {
             parse_error(lineno_, ".conn", "Supported only in extended BLIF format");
         }
 
         //We allow the .conn to create the nets if they don't exist,
         //however typically they will have already been defined.
-        AtomNetId driver_net = curr_model().create_net(src);
-        AtomNetId sink_net = curr_model().create_net(dst);
+        AtomNetId driver_net = curr_model().create_net(src.str());
+        AtomNetId sink_net = curr_model().create_net(dst.str());
 
         //We eventually need to merge the driver and sink nets,
         //however we must defer that until all the net drivers
@@ -360,29 +392,29 @@ struct BlifAllocCallback : public blifparse::Callback {
         set_curr_block(AtomBlockId::INVALID());
     }
 
-    void cname(std::string cell_name) override {
+    void cname(blifparse::str_span cell_name) override {
         if (blif_format_ != e_circuit_format::EBLIF) {
             parse_error(lineno_, ".cname", "Supported only in extended BLIF format");
         }
 
         //Re-name the block
-        curr_model().set_block_name(curr_block(), cell_name);
+        curr_model().set_block_name(curr_block(), cell_name.str());
     }
 
-    void attr(std::string name, std::string value) override {
+    void attr(blifparse::str_span name, blifparse::str_span value) override {
         if (blif_format_ != e_circuit_format::EBLIF) {
             parse_error(lineno_, ".attr", "Supported only in extended BLIF format");
         }
 
-        curr_model().set_block_attr(curr_block(), name, value);
+        curr_model().set_block_attr(curr_block(), name.str(), value.str());
     }
 
-    void param(std::string name, std::string value) override {
+    void param(blifparse::str_span name, blifparse::str_span value) override {
         if (blif_format_ != e_circuit_format::EBLIF) {
             parse_error(lineno_, ".param", "Supported only in extended BLIF format");
         }
 
-        curr_model().set_block_param(curr_block(), name, value);
+        curr_model().set_block_param(curr_block(), name.str(), value.str());
     }
 
     //Utilities
@@ -632,6 +664,7 @@ struct BlifAllocCallback : public blifparse::Callback {
     std::vector<std::pair<AtomNetId, AtomNetId>> curr_nets_to_merge_;
 
     e_circuit_format blif_format_ = e_circuit_format::BLIF;
+    BlifElementCounts element_counts_; //Estimated element counts used to pre-size the netlist
 };
 
 vtr::LogicValue to_vtr_logic_value(blifparse::LogicValue val) {
@@ -655,6 +688,153 @@ vtr::LogicValue to_vtr_logic_value(blifparse::LogicValue val) {
     return new_val;
 }
 
+//Quickly scans a BLIF file estimating how many blocks/ports/pins/nets it will
+//elaborate into, so the netlist storage can be pre-allocated before parsing.
+//
+//This is a raw buffered character scan (no tokenization into std::strings, and
+//no BLIF semantics beyond recognizing directives), so it runs at close to I/O
+//speed even on very large files. Only tokens on a directive's own (possibly
+//'\'-continued) line are attributed to it; .names cover rows and unknown
+//directives are ignored. The resulting counts are capacity hints and need not
+//be exact.
+static BlifElementCounts count_blif_elements(const char* blif_file) {
+    BlifElementCounts counts;
+
+    //Transparently decompresses the file if it is compressed
+    vtr::CompressedReader reader(blif_file);
+    if (!reader.valid()) {
+        //Leave the counts zero; the parser proper will report the error
+        return counts;
+    }
+    FILE* f = reader.file();
+
+    enum class Directive {
+        NONE,
+        NAMES,
+        LATCH,
+        SUBCKT,
+        INPUTS,
+        OUTPUTS,
+        OTHER
+    };
+
+    Directive directive = Directive::NONE; //Directive the current logical line started with
+    size_t directive_token_idx = 0;        //Number of data tokens seen on the current directive line
+
+    bool in_comment = false;      //Inside a '#' comment (runs to end of line)
+    bool in_token = false;        //Inside a whitespace-delimited token
+    bool token_truncated = false; //Token too long for token_buf (cannot be a directive of interest)
+    char token_buf[16];           //Leading characters of the current token (enough for any directive)
+    size_t token_len = 0;
+    char last_nonspace = '\0'; //Last non-whitespace character seen (detects '\' line continuations)
+
+    auto end_token = [&]() {
+        if (!in_token) return;
+        in_token = false;
+
+        if (!token_truncated && token_len == 1 && token_buf[0] == '\\') {
+            //Line continuation marker, not a token
+            return;
+        }
+
+        if (token_buf[0] == '.') {
+            //A directive starts a new logical line
+            directive_token_idx = 0;
+            if (!token_truncated && token_len == 6 && strncmp(token_buf, ".names", 6) == 0) {
+                directive = Directive::NAMES;
+                counts.blocks += 1; //The .names LUT
+                counts.ports += 2;  //Its input and output ports
+                counts.nets += 1;   //The net driven by its output
+            } else if (!token_truncated && token_len == 6 && strncmp(token_buf, ".latch", 6) == 0) {
+                directive = Directive::LATCH;
+                counts.blocks += 1; //The latch
+                counts.ports += 3;  //Its D, Q and clock ports
+                counts.pins += 3;   //One pin on each
+                counts.nets += 1;   //The net driven by its output
+            } else if (!token_truncated && token_len == 7 && strncmp(token_buf, ".subckt", 7) == 0) {
+                directive = Directive::SUBCKT;
+                counts.blocks += 1; //The subckt instance (ports/pins counted per connection below)
+            } else if (!token_truncated && token_len == 7 && strncmp(token_buf, ".inputs", 7) == 0) {
+                directive = Directive::INPUTS;
+            } else if (!token_truncated && token_len == 8 && strncmp(token_buf, ".outputs", 8) == 0) {
+                directive = Directive::OUTPUTS;
+            } else {
+                directive = Directive::OTHER;
+            }
+        } else if (directive != Directive::NONE) {
+            //A data token on a directive's line
+            switch (directive) {
+                case Directive::NAMES:
+                    counts.pins += 1; //Each connection (inputs and output) is a pin
+                    break;
+                case Directive::SUBCKT:
+                    if (directive_token_idx > 0) { //Skip the model name
+                        counts.ports += 1;         //Upper bound: bits of a multi-bit port share one port
+                        counts.pins += 1;
+                    }
+                    break;
+                case Directive::INPUTS:
+                    counts.blocks += 1; //Each primary input is an input pad block...
+                    counts.ports += 1;  //...with a single output port...
+                    counts.pins += 1;   //...driving...
+                    counts.nets += 1;   //...its own net
+                    break;
+                case Directive::OUTPUTS:
+                    counts.blocks += 1; //Each primary output is an output pad block...
+                    counts.ports += 1;  //...with a single input port...
+                    counts.pins += 1;   //...sinking an existing net
+                    break;
+                default:
+                    break; //Covers rows, .latch params, unknown directives: no storage impact
+            }
+            ++directive_token_idx;
+        }
+
+        token_len = 0;
+        token_truncated = false;
+    };
+
+    std::vector<char> buf(1 << 20);
+    size_t nread;
+    while ((nread = std::fread(buf.data(), 1, buf.size(), f)) > 0) {
+        for (size_t i = 0; i < nread; ++i) {
+            char c = buf[i];
+
+            if (c == '\n') {
+                end_token();
+                in_comment = false;
+                if (last_nonspace != '\\') {
+                    //Logical line ends (not a '\' continuation)
+                    directive = Directive::NONE;
+                }
+                last_nonspace = '\0';
+            } else if (in_comment) {
+                //Skip to end of line
+            } else if (c == '#') {
+                end_token();
+                in_comment = true;
+            } else if (std::isspace(static_cast<unsigned char>(c))) {
+                end_token();
+            } else {
+                if (!in_token) {
+                    in_token = true;
+                    token_len = 0;
+                    token_truncated = false;
+                }
+                if (token_len < sizeof(token_buf)) {
+                    token_buf[token_len++] = c;
+                } else {
+                    token_truncated = true;
+                }
+                last_nonspace = c;
+            }
+        }
+    }
+    end_token();
+
+    return counts;
+}
+
 AtomNetlist read_blif(e_circuit_format circuit_format,
                       const char* blif_file,
                       const t_model* user_models,
@@ -662,8 +842,22 @@ AtomNetlist read_blif(e_circuit_format circuit_format,
     AtomNetlist netlist;
     std::string netlist_id = vtr::secure_digest_file(blif_file);
 
-    BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models);
-    blifparse::blif_parse_filename(blif_file, alloc_callback);
+    //Pre-scan the file so the netlist storage can be sized up-front
+    BlifElementCounts element_counts = count_blif_elements(blif_file);
+
+    BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models, element_counts);
+
+    //Open through a CompressedReader so gzip/zstd compressed netlists
+    //(detected by magic bytes) are transparently decompressed
+    vtr::CompressedReader blif_reader(blif_file);
+    if (!blif_reader.valid()) {
+        VPR_FATAL_ERROR(VPR_ERROR_BLIF_F, "Could not open file '%s'.\n", blif_file);
+    }
+    if (blif_reader.format() != vtr::CompressionFormat::UNCOMPRESSED) {
+        VTR_LOG("Reading %s compressed circuit '%s'\n",
+                vtr::compression_format_name(blif_reader.format()), blif_file);
+    }
+    blifparse::blif_parse_file(blif_reader.file(), alloc_callback, blif_file);
 
     return netlist;
 }
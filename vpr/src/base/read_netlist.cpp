@@ -32,6 +32,13 @@
 #include "read_netlist.h"
 #include "pb_type_graph.h"
 
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "packed_netlist.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif
+
 static const char* netlist_file_name = nullptr;
 
 static int processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route, const pugiutil::loc_data& loc_data);
@@ -61,6 +68,12 @@ static t_pb_routes alloc_pb_route(t_pb_graph_node* pb_graph_node);
 static void load_atom_pin_mapping(const ClusteredNetlist& clb_nlist);
 static void set_atom_pin_mapping(const ClusteredNetlist& clb_nlist, const AtomBlockId atom_blk, const AtomPortId atom_port, const t_pb_graph_pin* gpin);
 
+static bool is_packed_netlist_bin(const char* net_file);
+
+static ClusteredNetlist read_netlist_xml(const char* net_file, const t_arch* arch, bool verify_file_digests, int verbosity);
+
+static ClusteredNetlist read_netlist_bin(const char* net_file, const t_arch* arch, int verbosity);
+
 /**
  * Initializes the clb_nlist with info from a netlist
  * net_file - Name of the netlist file to read
@@ -70,6 +83,69 @@ ClusteredNetlist read_netlist(const char* net_file,
                               bool verify_file_digests,
                               int verbosity) {
     clock_t begin = clock();
+
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+
+    /* Parse the file */
+    VTR_LOG("Begin loading packed FPGA netlist file.\n");
+
+    ClusteredNetlist clb_nlist;
+    if (is_packed_netlist_bin(net_file)) {
+        /* Binary (Cap'n Proto) packed netlist, see write_packed_netlist_bin() */
+        clb_nlist = read_netlist_bin(net_file, arch, verbosity);
+    } else {
+        clb_nlist = read_netlist_xml(net_file, arch, verify_file_digests, verbosity);
+    }
+
+    /* TODO: create this function later
+     * check_top_IO_matches_IO_blocks(circuit_inputs, circuit_outputs, circuit_clocks, blist, bcount); */
+
+    /* load mapping between external nets and all nets */
+    for (auto net_id : atom_ctx.nlist.nets()) {
+        atom_ctx.lookup.set_atom_clb_net(net_id, ClusterNetId::INVALID());
+    }
+
+    //Save the mapping between clb and atom nets
+    for (auto clb_net_id : clb_nlist.nets()) {
+        AtomNetId net_id = atom_ctx.nlist.find_net(clb_nlist.net_name(clb_net_id));
+        VTR_ASSERT(net_id);
+        atom_ctx.lookup.set_atom_clb_net(net_id, clb_net_id);
+    }
+
+    /* load mapping between atom pins and pb_graph_pins */
+    load_atom_pin_mapping(clb_nlist);
+
+    clock_t end = clock();
+
+    VTR_LOG("Finished loading packed FPGA netlist file (took %g seconds).\n", (float)(end - begin) / CLOCKS_PER_SEC);
+
+    size_t num_pb_route_used = 0;
+    size_t num_pb_route_alloc = 0;
+    size_t num_pb_pins = 0;
+    for (auto clb : clb_nlist.blocks()) {
+        t_pb* pb = clb_nlist.block_pb(clb);
+
+        for (int ipin = 0; ipin < pb->pb_graph_node->total_pb_pins; ++ipin) {
+            if (pb->pb_route.count(ipin)) {
+                ++num_pb_route_alloc;
+                if (pb->pb_route[ipin].atom_net_id) {
+                    ++num_pb_route_used;
+                }
+            }
+            ++num_pb_pins;
+        }
+    }
+
+    return clb_nlist;
+}
+
+/**
+ * Reads and processes a packed netlist in the traditional .net XML format
+ */
+static ClusteredNetlist read_netlist_xml(const char* net_file,
+                                         const t_arch* arch,
+                                         bool verify_file_digests,
+                                         int verbosity) {
     size_t bcount = 0;
     std::vector<std::string> circuit_inputs, circuit_outputs, circuit_clocks;
 
@@ -77,9 +153,6 @@ ClusteredNetlist read_netlist(const char* net_file,
 
     int num_primitives = 0;
 
-    /* Parse the file */
-    VTR_LOG("Begin loading packed FPGA netlist file.\n");
-
     //Save an identifier for the netlist based on it's contents
     auto clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_file(net_file));
 
@@ -212,48 +285,426 @@ ClusteredNetlist read_netlist(const char* net_file,
                   "Error loading post-pack netlist (%s)", e.what());
     }
 
-    /* TODO: create this function later
-     * check_top_IO_matches_IO_blocks(circuit_inputs, circuit_outputs, circuit_clocks, blist, bcount); */
+    return clb_nlist;
+}
 
-    /* load mapping between external nets and all nets */
-    for (auto net_id : atom_ctx.nlist.nets()) {
-        atom_ctx.lookup.set_atom_clb_net(net_id, ClusterNetId::INVALID());
+bool net_file_matches_netlist(const char* net_file, const t_arch* arch) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    if (is_packed_netlist_bin(net_file)) {
+#ifdef VTR_ENABLE_CAPNPROTO
+        try {
+            MmapFile f(net_file);
+            ::capnp::ReaderOptions opts = ::capnp::ReaderOptions();
+            opts.traversalLimitInWords = kj::maxValue; //Allow arbitrarily large netlists
+            ::capnp::FlatArrayMessageReader reader(f.getData(), opts);
+            auto packed_netlist = reader.getRoot<VprPackedNetlist>();
+
+            if (std::string(packed_netlist.getArchitectureId().cStr()) != arch->architecture_id) {
+                VTR_LOG("Existing packed netlist file '%s' was generated from a different architecture file.\n", net_file);
+                return false;
+            }
+
+            if (std::string(packed_netlist.getAtomNetlistId().cStr()) != atom_ctx.nlist.netlist_id()) {
+                VTR_LOG("Existing packed netlist file '%s' was generated from a different atom netlist.\n", net_file);
+                return false;
+            }
+
+            return true;
+        } catch (...) {
+            //Missing or malformed file, cannot re-use
+            return false;
+        }
+#else
+        //Cannot read binary packed netlists without Cap'n Proto support
+        return false;
+#endif
     }
 
-    //Save the mapping between clb and atom nets
-    for (auto clb_net_id : clb_nlist.nets()) {
-        AtomNetId net_id = atom_ctx.nlist.find_net(clb_nlist.net_name(clb_net_id));
-        VTR_ASSERT(net_id);
-        atom_ctx.lookup.set_atom_clb_net(net_id, clb_net_id);
+    pugi::xml_document doc;
+    pugiutil::loc_data loc_data;
+    try {
+        loc_data = pugiutil::load_xml(doc, net_file);
+    } catch (pugiutil::XmlError&) {
+        //Missing or malformed file, cannot re-use
+        return false;
     }
 
-    /* load mapping between atom pins and pb_graph_pins */
-    load_atom_pin_mapping(clb_nlist);
+    auto top = doc.child("block");
+    if (!top) {
+        return false;
+    }
 
-    clock_t end = clock();
+    //Require matching ids; old .net files without ids are not considered
+    //re-usable since we cannot prove they match the current netlist
+    auto architecture_id = top.attribute("architecture_id");
+    if (!architecture_id || architecture_id.value() != std::string(arch->architecture_id)) {
+        VTR_LOG("Existing packed netlist file '%s' was generated from a different architecture file.\n", net_file);
+        return false;
+    }
 
-    VTR_LOG("Finished loading packed FPGA netlist file (took %g seconds).\n", (float)(end - begin) / CLOCKS_PER_SEC);
+    auto atom_netlist_id = top.attribute("atom_netlist_id");
+    if (!atom_netlist_id || atom_netlist_id.value() != atom_ctx.nlist.netlist_id()) {
+        VTR_LOG("Existing packed netlist file '%s' was generated from a different atom netlist.\n", net_file);
+        return false;
+    }
 
-    size_t num_pb_route_used = 0;
-    size_t num_pb_route_alloc = 0;
-    size_t num_pb_pins = 0;
-    for (auto clb : clb_nlist.blocks()) {
-        t_pb* pb = clb_nlist.block_pb(clb);
+    return true;
+}
 
-        for (int ipin = 0; ipin < pb->pb_graph_node->total_pb_pins; ++ipin) {
-            if (pb->pb_route.count(ipin)) {
-                ++num_pb_route_alloc;
-                if (pb->pb_route[ipin].atom_net_id) {
-                    ++num_pb_route_used;
-                }
+//Returns true if net_file refers to a binary (Cap'n Proto) packed netlist
+//rather than the traditional .net XML, based on the file extension
+static bool is_packed_netlist_bin(const char* net_file) {
+    const std::string bin_ext = ".bin";
+    std::string filename = net_file;
+    return filename.size() >= bin_ext.size()
+           && filename.compare(filename.size() - bin_ext.size(), bin_ext.size(), bin_ext) == 0;
+}
+
+#ifdef VTR_ENABLE_CAPNPROTO
+
+static void serialize_pb(const t_pb* pb, VprPackedPb::Builder packed_pb);
+static void deserialize_pb(const VprPackedPb::Reader& packed_pb,
+                           const ClusterBlockId index,
+                           t_pb* pb,
+                           const IntraLbPbPinLookup& pb_gpin_lookup,
+                           int itype,
+                           int* num_primitives);
+
+/**
+ * Reads and processes a packed netlist in the binary (Cap'n Proto) format
+ * written by write_packed_netlist_bin().
+ *
+ * The binary format stores pb graph pin ids and raw atom net ids, so
+ * (unlike the .net XML) architecture/atom netlist id mismatches are always
+ * fatal: the stored ids are meaningless against anything but the exact
+ * architecture and atom netlist the file was written from.
+ */
+static ClusteredNetlist read_netlist_bin(const char* net_file, const t_arch* arch, int verbosity) {
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    int num_primitives = 0;
+
+    /* Save netlist file's name in file-scoped variable */
+    netlist_file_name = net_file;
+
+    //Save an identifier for the netlist based on it's contents
+    auto clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_file(net_file));
+
+    MmapFile f(net_file);
+    ::capnp::ReaderOptions opts = ::capnp::ReaderOptions();
+    opts.traversalLimitInWords = kj::maxValue; //Allow arbitrarily large netlists
+    ::capnp::FlatArrayMessageReader reader(f.getData(), opts);
+    auto packed_netlist = reader.getRoot<VprPackedNetlist>();
+
+    VTR_LOG("Netlist generated from file '%s'.\n", packed_netlist.getNetlistName().cStr());
+
+    std::string arch_id = packed_netlist.getArchitectureId().cStr();
+    if (arch_id != arch->architecture_id) {
+        vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                  "Packed netlist was generated from a different architecture file"
+                  " (loaded architecture ID: %s, packed netlist architecture ID: %s)",
+                  arch->architecture_id, arch_id.c_str());
+    }
+
+    std::string atom_nl_id = packed_netlist.getAtomNetlistId().cStr();
+    if (atom_nl_id != atom_ctx.nlist.netlist_id()) {
+        vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                  "Packed netlist was generated from a different atom netlist file"
+                  " (loaded atom netlist ID: %s, packed netlist atom netlist ID: %s)",
+                  atom_ctx.nlist.netlist_id().c_str(), atom_nl_id.c_str());
+    }
+
+    //Reset atom/pb mapping (it is reloaded from the packed netlist file)
+    for (auto blk_id : atom_ctx.nlist.blocks())
+        atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
+
+    IntraLbPbPinLookup pb_gpin_lookup(device_ctx.logical_block_types);
+
+    auto packed_blocks = packed_netlist.getBlocks();
+    if (packed_blocks.size() == 0)
+        VTR_LOG_WARN("Packed netlist contains no clustered blocks\n");
+
+    for (unsigned i = 0; i < packed_blocks.size(); ++i) {
+        auto packed_block = packed_blocks[i];
+        ClusterBlockId index(i);
+
+        int itype = packed_block.getLogicalTypeIndex();
+        if (itype < 0 || itype >= (int)device_ctx.logical_block_types.size()) {
+            vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                      "Unknown logical block type index %d for cb %s #%u.\n",
+                      itype, packed_block.getName().cStr(), i);
+        }
+        const t_logical_block_type* type = &device_ctx.logical_block_types[itype];
+        const t_pb_type* pb_type = type->pb_type;
+
+        t_pb* pb = new t_pb;
+        pb->name = vtr::strdup(packed_block.getName().cStr());
+        clb_nlist.create_block(packed_block.getName().cStr(), pb, type);
+
+        atom_ctx.lookup.set_atom_pb(AtomBlockId::INVALID(), pb);
+
+        pb->pb_graph_node = type->pb_graph_head;
+        pb->pb_route = alloc_pb_route(pb->pb_graph_node);
+
+        auto packed_pb = packed_block.getPb();
+        int mode = packed_pb.getMode();
+        if (mode < 0 || mode >= pb_type->num_modes) {
+            vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                      "Unknown mode %d for cb %s #%u.\n", mode, pb->name, i);
+        }
+        pb->mode = mode;
+
+        //Create the ports in the clb_nlist for the top-level pb (the .net
+        //XML path derives the same arch-order port list from the port tags)
+        for (int j = 0; j < pb_type->num_ports; j++) {
+            const t_port& port = pb_type->ports[j];
+            PortType port_type;
+            if (port.type == OUT_PORT) {
+                port_type = PortType::OUTPUT;
+            } else {
+                VTR_ASSERT(port.type == IN_PORT);
+                port_type = port.is_clock ? PortType::CLOCK : PortType::INPUT;
             }
-            ++num_pb_pins;
+            clb_nlist.create_port(index, port.name, port.num_pins, port_type);
+        }
+        VTR_ASSERT(clb_nlist.block_ports(index).size() == (unsigned)pb_type->num_ports);
+
+        deserialize_pb(packed_pb, index, pb, pb_gpin_lookup, itype, &num_primitives);
+
+        //Install the intra-block routing directly (the .net XML path
+        //re-derives atom nets and sinks from the parsed pin connections)
+        for (auto packed_route : packed_block.getRoutes()) {
+            int pb_pin_id = packed_route.getPbPinId();
+            if (pb_pin_id < 0 || pb_pin_id >= pb->pb_graph_node->total_pb_pins) {
+                vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                          "Invalid pb pin id %d for cb %s #%u.\n", pb_pin_id, pb->name, i);
+            }
+
+            t_pb_route& pb_route = pb->pb_route[pb_pin_id];
+            pb_route.atom_net_id = AtomNetId(packed_route.getAtomNetId());
+            if (pb_route.atom_net_id && !atom_ctx.nlist.valid_net_id(pb_route.atom_net_id)) {
+                vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                          "Invalid atom net id %d for cb %s #%u.\n",
+                          packed_route.getAtomNetId(), pb->name, i);
+            }
+            pb_route.driver_pb_pin_id = packed_route.getDriverPbPinId();
+
+            auto packed_sinks = packed_route.getSinkPbPinIds();
+            pb_route.sink_pb_pin_ids.reserve(packed_sinks.size());
+            for (int sink_pb_pin_id : packed_sinks) {
+                pb_route.sink_pb_pin_ids.push_back(sink_pb_pin_id);
+            }
+
+            int gpin_id = packed_route.getGraphPinId();
+            pb_route.pb_graph_pin = (gpin_id >= 0) ? pb_gpin_lookup.pb_gpin(itype, gpin_id) : nullptr;
+        }
+    }
+
+    VTR_ASSERT(clb_nlist.blocks().size() == packed_blocks.size());
+    VTR_ASSERT(num_primitives >= 0);
+    VTR_ASSERT(static_cast<size_t>(num_primitives) == atom_ctx.nlist.blocks().size());
+
+    /* Error check */
+    for (auto blk_id : atom_ctx.nlist.blocks()) {
+        if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            "Atom netlist and packed netlist file do not match, packed netlist file missing atom %s.\n",
+                            atom_ctx.nlist.block_name(blk_id).c_str());
         }
     }
 
+    mark_constant_generators(clb_nlist, verbosity);
+
+    load_external_nets_and_cb(clb_nlist);
+
     return clb_nlist;
 }
 
+/**
+ * Re-builds a pb (and recursively its children) from its packed form.
+ *
+ * Mirrors processPb(), except that all names/modes/pin ids were resolved
+ * when the packing was originally loaded, so no atom attribute/parameter
+ * re-verification is performed.
+ */
+static void deserialize_pb(const VprPackedPb::Reader& packed_pb,
+                           const ClusterBlockId index,
+                           t_pb* pb,
+                           const IntraLbPbPinLookup& pb_gpin_lookup,
+                           int itype,
+                           int* num_primitives) {
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+
+    const t_pb_type* pb_type = pb->pb_graph_node->pb_type;
+
+    if (pb_type->num_modes == 0) {
+        /* A primitive type */
+        AtomBlockId blk_id = atom_ctx.nlist.find_block(pb->name);
+        if (!blk_id) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            "Atom netlist and packed netlist file do not match, encountered unknown primitive %s in packed netlist file.\n",
+                            pb->name);
+        }
+
+        //Update atom netlist mapping
+        atom_ctx.lookup.set_atom_pb(blk_id, pb);
+        atom_ctx.lookup.set_atom_clb(blk_id, index);
+
+        //Restore any pin rotations applied to logically equivalent pins
+        for (auto packed_rotation : packed_pb.getPinRotations()) {
+            const t_pb_graph_pin* gpin = pb_gpin_lookup.pb_gpin(itype, packed_rotation.getGraphPinId());
+            VTR_ASSERT(gpin != nullptr);
+            pb->set_atom_pin_bit_index(gpin, packed_rotation.getAtomPortBit());
+        }
+
+        (*num_primitives)++;
+    } else {
+        auto packed_children = packed_pb.getChildren();
+        if (packed_children.size() == 0) {
+            /* Open pb whose children were never elaborated */
+            return;
+        }
+
+        pb->child_pbs = new t_pb*[pb_type->modes[pb->mode].num_pb_type_children];
+
+        unsigned ichild = 0;
+        for (int i = 0; i < pb_type->modes[pb->mode].num_pb_type_children; i++) {
+            pb->child_pbs[i] = new t_pb[pb_type->modes[pb->mode].pb_type_children[i].num_pb];
+
+            for (int j = 0; j < pb_type->modes[pb->mode].pb_type_children[i].num_pb; j++) {
+                if (ichild >= packed_children.size()) {
+                    vpr_throw(VPR_ERROR_NET_F, netlist_file_name, 0,
+                              "Packed netlist stores %u children for pb %s, fewer than the architecture requires.\n",
+                              packed_children.size(), pb_type->name);
+                }
+                auto packed_child = packed_children[ichild++];
+                t_pb* child_pb = &pb->child_pbs[i][j];
+
+                if (!packed_child.getActive()) {
+                    /* Child slot was not used by the packing */
+                    continue;
+                }
+
+                child_pb->pb_graph_node = &pb->pb_graph_node->child_pb_graph_nodes[pb->mode][i][j];
+                child_pb->name = packed_child.getHasName() ? vtr::strdup(packed_child.getName().cStr()) : nullptr;
+                atom_ctx.lookup.set_atom_pb(AtomBlockId::INVALID(), child_pb);
+
+                const t_pb_type* child_type = child_pb->pb_graph_node->pb_type;
+                int child_mode = packed_child.getMode();
+                if (child_type->num_modes > 0 && (child_mode < 0 || child_mode >= child_type->num_modes)) {
+                    vpr_throw(VPR_ERROR_NET_F, netlist_file_name, 0,
+                              "Unknown mode %d for pb %s.\n", child_mode, child_type->name);
+                }
+                child_pb->mode = (child_type->num_modes > 0) ? child_mode : 0;
+                child_pb->parent_pb = pb;
+
+                deserialize_pb(packed_child, index, child_pb, pb_gpin_lookup, itype, num_primitives);
+            }
+        }
+        VTR_ASSERT(ichild == packed_children.size());
+    }
+}
+
+/**
+ * Serializes a pb (and recursively its children) into its packed form
+ * (the inverse of deserialize_pb())
+ */
+static void serialize_pb(const t_pb* pb, VprPackedPb::Builder packed_pb) {
+    packed_pb.setHasName(pb->name != nullptr);
+    packed_pb.setName(pb->name != nullptr ? pb->name : "");
+    packed_pb.setMode(pb->mode);
+    packed_pb.setActive(pb->pb_graph_node != nullptr);
+
+    const auto& pin_rotations = pb->pin_rotations();
+    if (!pin_rotations.empty()) {
+        auto packed_rotations = packed_pb.initPinRotations(pin_rotations.size());
+        unsigned irotation = 0;
+        for (const auto& pin_rotation : pin_rotations) {
+            packed_rotations[irotation].setGraphPinId(pin_rotation.first->pin_count_in_cluster);
+            packed_rotations[irotation].setAtomPortBit(pin_rotation.second);
+            ++irotation;
+        }
+    }
+
+    if (pb->pb_graph_node != nullptr && pb->pb_graph_node->pb_type->num_modes > 0 && pb->child_pbs != nullptr) {
+        const t_mode* mode = &pb->pb_graph_node->pb_type->modes[pb->mode];
+
+        //Children cover every child slot of the selected mode in
+        //(child type, instance) order
+        unsigned num_slots = 0;
+        for (int i = 0; i < mode->num_pb_type_children; i++) {
+            num_slots += mode->pb_type_children[i].num_pb;
+        }
+
+        auto packed_children = packed_pb.initChildren(num_slots);
+        unsigned ichild = 0;
+        for (int i = 0; i < mode->num_pb_type_children; i++) {
+            for (int j = 0; j < mode->pb_type_children[i].num_pb; j++) {
+                serialize_pb(&pb->child_pbs[i][j], packed_children[ichild++]);
+            }
+        }
+    }
+}
+
+void write_packed_netlist_bin(const char* net_file, const t_arch* arch, const ClusteredNetlist& clb_nlist) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    ::capnp::MallocMessageBuilder builder;
+    auto packed_netlist = builder.initRoot<VprPackedNetlist>();
+
+    packed_netlist.setArchitectureId(arch->architecture_id);
+    packed_netlist.setAtomNetlistId(atom_ctx.nlist.netlist_id().c_str());
+    packed_netlist.setNetlistName(atom_ctx.nlist.netlist_name().c_str());
+
+    auto packed_blocks = packed_netlist.initBlocks(clb_nlist.blocks().size());
+    unsigned iblk = 0;
+    for (auto blk_id : clb_nlist.blocks()) {
+        auto packed_block = packed_blocks[iblk++];
+
+        packed_block.setName(clb_nlist.block_name(blk_id).c_str());
+        packed_block.setLogicalTypeIndex(clb_nlist.block_type(blk_id)->index);
+
+        const t_pb* pb = clb_nlist.block_pb(blk_id);
+        serialize_pb(pb, packed_block.initPb());
+
+        auto packed_routes = packed_block.initRoutes(pb->pb_route.size());
+        unsigned iroute = 0;
+        for (const auto& route : pb->pb_route) {
+            auto packed_route = packed_routes[iroute++];
+
+            packed_route.setPbPinId(route.first);
+            packed_route.setAtomNetId(route.second.atom_net_id ? (int)size_t(route.second.atom_net_id) : -1);
+            packed_route.setDriverPbPinId(route.second.driver_pb_pin_id);
+            packed_route.setGraphPinId(route.second.pb_graph_pin != nullptr ? route.second.pb_graph_pin->pin_count_in_cluster : -1);
+
+            auto packed_sinks = packed_route.initSinkPbPinIds(route.second.sink_pb_pin_ids.size());
+            for (unsigned isink = 0; isink < route.second.sink_pb_pin_ids.size(); ++isink) {
+                packed_sinks.set(isink, route.second.sink_pb_pin_ids[isink]);
+            }
+        }
+    }
+
+    writeMessageToFile(net_file, &builder);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+#    define DISABLE_ERROR                              \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+static ClusteredNetlist read_netlist_bin(const char* /*net_file*/, const t_arch* /*arch*/, int /*verbosity*/) {
+    VPR_THROW(VPR_ERROR_NET_F, "Binary packed netlist reading " DISABLE_ERROR);
+}
+
+void write_packed_netlist_bin(const char* /*net_file*/, const t_arch* /*arch*/, const ClusteredNetlist& /*clb_nlist*/) {
+    VPR_THROW(VPR_ERROR_NET_F, "Binary packed netlist writing " DISABLE_ERROR);
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
+
 /**
  * XML parser to populate CLB info and to update nets with the nets of this CLB
  * Parent - XML tag for this CLB
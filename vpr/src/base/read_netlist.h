@@ -15,4 +15,15 @@ ClusteredNetlist read_netlist(const char* net_file,
                               bool verify_file_digests,
                               int verbosity);
 
+/* Returns true if net_file exists and was generated from the currently loaded
+ * atom netlist and architecture (based on the ids embedded in the .net file),
+ * meaning the previous packing can be re-used without re-packing */
+bool net_file_matches_netlist(const char* net_file, const t_arch* arch);
+
+/* Writes the loaded packing in the binary (Cap'n Proto) packed netlist format,
+ * which read_netlist() re-loads far faster than the .net XML (binary packed
+ * netlists are recognized by their .bin extension).
+ * Requires building with VTR_ENABLE_CAPNPROTO=ON */
+void write_packed_netlist_bin(const char* net_file, const t_arch* arch, const ClusteredNetlist& clb_nlist);
+
 #endif
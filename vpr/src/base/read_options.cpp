@@ -163,6 +163,37 @@ struct ParseRouterAlgorithm {
     }
 };
 
+struct ParseRouterHeap {
+    ConvertedValue<e_heap_type> from_str(std::string str) {
+        ConvertedValue<e_heap_type> conv_value;
+        if (str == "binary")
+            conv_value.set_value(e_heap_type::BINARY_HEAP);
+        else if (str == "four_ary")
+            conv_value.set_value(e_heap_type::FOUR_ARY_HEAP);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_heap_type (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_heap_type val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == e_heap_type::BINARY_HEAP)
+            conv_value.set_value("binary");
+        else {
+            VTR_ASSERT(val == e_heap_type::FOUR_ARY_HEAP);
+            conv_value.set_value("four_ary");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"binary", "four_ary"};
+    }
+};
+
 struct RouteBudgetsAlgorithm {
     ConvertedValue<e_routing_budgets_algorithm> from_str(std::string str) {
         ConvertedValue<e_routing_budgets_algorithm> conv_value;
@@ -277,6 +308,41 @@ struct ParseBaseCost {
     }
 };
 
+struct ParseAnnealSchedType {
+    ConvertedValue<sched_type> from_str(std::string str) {
+        ConvertedValue<sched_type> conv_value;
+        if (str == "auto")
+            conv_value.set_value(AUTO_SCHED);
+        else if (str == "adaptive")
+            conv_value.set_value(ADAPTIVE_SCHED);
+        else if (str == "user")
+            conv_value.set_value(USER_SCHED);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to sched_type (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(sched_type val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == AUTO_SCHED)
+            conv_value.set_value("auto");
+        else if (val == ADAPTIVE_SCHED)
+            conv_value.set_value("adaptive");
+        else {
+            VTR_ASSERT(val == USER_SCHED);
+            conv_value.set_value("user");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"auto", "adaptive", "user"};
+    }
+};
+
 struct ParsePlaceAlgorithm {
     ConvertedValue<e_place_algorithm> from_str(std::string str) {
         ConvertedValue<e_place_algorithm> conv_value;
@@ -872,6 +938,9 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
             "      specified concurrency, and\n"
             " *  0 implies VPR may execute in parallel with up to the\n"
             "      maximum concurrency supported by the host machine.\n"
+            "Among other things this controls the parallel (levelized) timing\n"
+            "analyzer used for the repeated timing updates during placement and\n"
+            "routing (requires VPR to be compiled with TBB support).\n"
             "If this option is not specified it may be set from the 'VPR_NUM_WORKERS' "
             "environment variable; otherwise the default is used.")
         .default_value("1");
@@ -887,6 +956,14 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    gen_grp.add_argument(args.checkpoint_interval, "--checkpoint_interval")
+        .help(
+            "Minimum number of seconds between in-progress state checkpoint writes"
+            " (see --place_checkpoint_file and --route_checkpoint_file)."
+            " A value <= 0 checkpoints at every opportunity.")
+        .default_value("120")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     gen_grp.add_argument<bool, ParseOnOff>(args.verify_file_digests, "--verify_file_digests")
         .help(
             "Verify that files loaded by VPR (e.g. architecture, netlist,"
@@ -1084,6 +1161,16 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    netlist_grp.add_argument(args.atom_netlist_cache_file, "--atom_netlist_cache")
+        .help(
+            "File in which to cache the elaborated (parsed and cleaned) atom netlist."
+            " If the file exists and matches the current circuit and netlist options"
+            " the netlist is loaded from it directly, skipping parsing and cleaning;"
+            " otherwise it is (re-)written after elaboration."
+            " Requires building with VTR_ENABLE_CAPNPROTO=ON.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& pack_grp = parser.add_argument_group("packing options");
 
     pack_grp.add_argument<bool, ParseOnOff>(args.connection_driven_clustering, "--connection_driven_clustering")
@@ -1232,6 +1319,16 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("2")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    pack_grp.add_argument<bool, ParseOnOff>(args.pack_reuse_prev_packing, "--pack_reuse_prev_packing")
+        .help(
+            "Re-uses an existing packed netlist (.net) file instead of re-packing,\n"
+            "provided it was generated from an identical atom netlist and architecture\n"
+            "(verified via the ids embedded in the .net file). Useful for ECO flows\n"
+            "where the circuit is unchanged between runs; if the ids do not match\n"
+            "the circuit is packed from scratch as usual.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_grp = parser.add_argument_group("placement options");
 
     place_grp.add_argument(args.Seed, "--seed")
@@ -1248,6 +1345,20 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("1.0")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument<sched_type, ParseAnnealSchedType>(args.anneal_sched_type, "--anneal_sched_type")
+        .help(
+            "Which placer annealing schedule to use:\n"
+            " * auto: success-ratio driven temperature decrements\n"
+            " * adaptive: temperature decrements and per-temperature move\n"
+            "       counts driven by measured cost-variance statistics\n"
+            " * user: fixed geometric schedule (set via --init_t,\n"
+            "       --exit_t and --alpha_t)\n"
+            "(Default: 'user' if any of --init_t/--exit_t/--alpha_t are\n"
+            "specified, 'auto' otherwise)")
+        .default_value("auto")
+        .choices({"auto", "adaptive", "user"})
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.PlaceInitT, "--init_t")
         .help("Initial temperature for manual annealing schedule")
         .default_value("100.0")
@@ -1295,12 +1406,48 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("0.0")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument<bool, ParseOnOff>(args.enable_analytic_placement, "--enable_analytic_placement")
+        .help(
+            "Enables the analytic (quadratic) placement engine."
+            " The random initial placement is refined by iterating a wirelength-minimizing"
+            " quadratic solve with legalization, and the annealer is then used only as a"
+            " low-temperature refinement. Scales much better than pure annealing on large netlists.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.read_initial_place_file, "--read_initial_place_file")
+        .help(
+            "Warm starts (ECO) placement from an existing .place file."
+            " Blocks are matched by name; surviving blocks whose saved locations are"
+            " still legal keep them, only new or displaced blocks are placed anew, and"
+            " the hot annealing phases are skipped in favour of the low-temperature"
+            " refinement. Intended for small netlist deltas against a prior run.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_checkpoint_file, "--place_checkpoint_file")
+        .help(
+            "Periodically snapshots the in-progress placement to the specified .place file"
+            " (at temperature boundaries, rate-limited by --checkpoint_interval)."
+            " An interrupted job can be resumed by passing the checkpoint"
+            " to --read_initial_place_file on a subsequent run.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.place_move_stats_file, "--place_move_stats")
         .help(
             "File to write detailed placer move statistics to")
         .default_value("")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument(args.place_temperature_stats_file, "--place_temperature_stats")
+        .help(
+            "File to write per-temperature placer statistics to as JSON lines"
+            " (one object per temperature: acceptance counts, delta cost and"
+            " move distance histograms, cost breakdown and phase wall times)")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_timing_grp = parser.add_argument_group("timing-driven placement options");
 
     place_timing_grp.add_argument(args.PlaceTimingTradeoff, "--timing_tradeoff")
@@ -1427,6 +1574,16 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("1.0")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument<bool, ParseOnOff>(args.router_adaptive_pres_fac, "--router_adaptive_pres_fac")
+        .help(
+            "Adapts the present overuse penalty growth and accumulated overuse factor each"
+            " routing iteration based on how the remaining congestion is distributed:"
+            " pressure grows faster than --pres_fac_mult while congestion is broad and not"
+            " improving, and more gently (with extra weight on historical congestion cost)"
+            " once only a few hotspots remain.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument(args.bb_factor, "--bb_factor")
         .help("Sets the distance (in channels) outside a connection's bounding box which can be explored during routing")
         .default_value("3")
@@ -1481,6 +1638,19 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument(args.route_speculative_width_probes, "--route_speculative_width_probes")
+        .help(
+            "Maximum number of channel widths the minimum channel width search may probe"
+            " concurrently. Values greater than 1 enable speculative probing: candidate"
+            " widths are routed in parallel child processes (sharing the placement), and"
+            " probes made redundant by completed results are cancelled as the search"
+            " bounds tighten. The final width is always confirmed by a route in the main"
+            " process. Only affects minimum channel width searches (i.e. when"
+            " --route_chan_width is unspecified), and is unsupported on non-POSIX"
+            " platforms or with interactive graphics.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument<e_router_algorithm, ParseRouterAlgorithm>(args.RouterAlgorithm, "--router_algorithm")
         .help(
             "Specifies the router algorithm to use.\n"
@@ -1490,9 +1660,31 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .choices({"breadth_first", "timing_driven"})
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument<e_heap_type, ParseRouterHeap>(args.RouterHeap, "--router_heap")
+        .help(
+            "Specifies the priority queue implementation used by the router.\n"
+            " * binary: the classic binary min-heap\n"
+            " * four_ary: a 4-ary min-heap with better cache locality\n")
+        .default_value("binary")
+        .choices({"binary", "four_ary"})
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument(args.RouterNumWorkers, "--router_num_workers")
+        .help(
+            "Number of worker threads the router may use to route nets concurrently.\n"
+            "Nets are spatially partitioned by bounding box into independent regions;\n"
+            "nets crossing region boundaries are routed serially. A value of 1 gives\n"
+            "the classic serial router.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument(args.min_incremental_reroute_fanout, "--min_incremental_reroute_fanout")
-        .help("The net fanout threshold above which nets will be re-routed incrementally.")
-        .default_value("16")
+        .help(
+            "The net fanout threshold above which nets will be re-routed incrementally."
+            " The default re-routes all multi-sink nets incrementally (only congested or"
+            " timing-degraded connections are ripped up and re-routed each iteration);"
+            " raise the threshold to fall back to whole-net rip-up for small nets.")
+        .default_value("2")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     auto& route_timing_grp = parser.add_argument_group("timing-driven routing options");
@@ -1560,6 +1752,46 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument(args.route_checkpoint_file, "--route_checkpoint_file")
+        .help(
+            "Writes a binary checkpoint of the routing state (tracebacks, congestion costs and"
+            " iteration number) to the specified file at routing iteration boundaries"
+            " (rate-limited by --checkpoint_interval)."
+            " Used with --route_resume to continue an interrupted routing job.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.route_resume, "--route_resume")
+        .help(
+            "Resumes routing from the checkpoint specified by --route_checkpoint_file (if it exists)"
+            " instead of starting from scratch.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument(args.route_connection_trace_file, "--route_connection_trace_file")
+        .help(
+            "Records the inputs of every connection search (source/sink RR nodes, bounding box"
+            " and criticality) to the specified trace file (compressed if it ends in .gz)."
+            " The trace can be re-executed with --route_replay_file to benchmark router changes.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument(args.route_replay_file, "--route_replay_file")
+        .help(
+            "Re-executes the connection searches recorded in the specified trace file"
+            " (see --route_connection_trace_file) against the current RR graph and reports"
+            " timing and heap statistics, instead of routing the netlist.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument(args.router_telemetry_file, "--router_telemetry_file")
+        .help(
+            "Writes per-iteration router telemetry (histograms of nodes expanded per connection"
+            " and heap occupancy, rip-up counts, and per-region overuse) to the specified JSON file."
+            " Collection is always on and cheap; this controls only whether the data is exported.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<float>(args.congested_routing_iteration_threshold_frac, "--congested_routing_iteration_threshold")
         .help(
             "Controls when the router enters a high effort mode to resolve lingering routing congestion."
@@ -1793,12 +2025,14 @@ void set_conditional_defaults(t_options& args) {
     }
 
     //Are we using the automatic, or user-specified annealing schedule?
-    if (args.PlaceInitT.provenance() == Provenance::SPECIFIED
-        || args.PlaceExitT.provenance() == Provenance::SPECIFIED
-        || args.PlaceAlphaT.provenance() == Provenance::SPECIFIED) {
-        args.anneal_sched_type.set(USER_SCHED, Provenance::INFERRED);
-    } else {
-        args.anneal_sched_type.set(AUTO_SCHED, Provenance::INFERRED);
+    if (args.anneal_sched_type.provenance() != Provenance::SPECIFIED) {
+        if (args.PlaceInitT.provenance() == Provenance::SPECIFIED
+            || args.PlaceExitT.provenance() == Provenance::SPECIFIED
+            || args.PlaceAlphaT.provenance() == Provenance::SPECIFIED) {
+            args.anneal_sched_type.set(USER_SCHED, Provenance::INFERRED);
+        } else {
+            args.anneal_sched_type.set(AUTO_SCHED, Provenance::INFERRED);
+        }
     }
 
     //Are the pad locations specified?
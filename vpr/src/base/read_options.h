@@ -70,6 +70,7 @@ struct t_options {
     argparse::ArgValue<bool> sweep_dangling_blocks;
     argparse::ArgValue<bool> sweep_constant_primary_outputs;
     argparse::ArgValue<int> netlist_verbosity;
+    argparse::ArgValue<std::string> atom_netlist_cache_file;
 
     /* Clustering options */
     argparse::ArgValue<bool> connection_driven_clustering;
@@ -86,6 +87,7 @@ struct t_options {
     argparse::ArgValue<int> pack_feasible_block_array_size;
     argparse::ArgValue<std::vector<std::string>> pack_high_fanout_threshold;
     argparse::ArgValue<int> pack_verbosity;
+    argparse::ArgValue<bool> pack_reuse_prev_packing;
 
     /* Placement options */
     argparse::ArgValue<int> Seed;
@@ -99,7 +101,11 @@ struct t_options {
     argparse::ArgValue<e_pad_loc_type> pad_loc_type;
     argparse::ArgValue<int> PlaceChanWidth;
     argparse::ArgValue<float> place_rlim_escape_fraction;
+    argparse::ArgValue<bool> enable_analytic_placement;
+    argparse::ArgValue<std::string> read_initial_place_file;
+    argparse::ArgValue<std::string> place_checkpoint_file;
     argparse::ArgValue<std::string> place_move_stats_file;
+    argparse::ArgValue<std::string> place_temperature_stats_file;
 
     /* Timing-driven placement options only */
     argparse::ArgValue<float> PlaceTimingTradeoff;
@@ -123,14 +129,18 @@ struct t_options {
     argparse::ArgValue<float> initial_pres_fac;
     argparse::ArgValue<float> pres_fac_mult;
     argparse::ArgValue<float> acc_fac;
+    argparse::ArgValue<bool> router_adaptive_pres_fac;
     argparse::ArgValue<int> bb_factor;
     argparse::ArgValue<e_base_cost_type> base_cost_type;
     argparse::ArgValue<float> bend_cost;
     argparse::ArgValue<e_route_type> RouteType;
     argparse::ArgValue<int> RouteChanWidth;
     argparse::ArgValue<int> min_route_chan_width_hint; //Hint to binary search router about what the min chan width is
+    argparse::ArgValue<int> route_speculative_width_probes;
     argparse::ArgValue<bool> verify_binary_search;
     argparse::ArgValue<e_router_algorithm> RouterAlgorithm;
+    argparse::ArgValue<e_heap_type> RouterHeap;
+    argparse::ArgValue<int> RouterNumWorkers;
     argparse::ArgValue<int> min_incremental_reroute_fanout;
 
     /* Timing-driven router options only */
@@ -142,6 +152,12 @@ struct t_options {
     argparse::ArgValue<e_routing_failure_predictor> routing_failure_predictor;
     argparse::ArgValue<e_routing_budgets_algorithm> routing_budgets_algorithm;
     argparse::ArgValue<bool> save_routing_per_iteration;
+    argparse::ArgValue<std::string> route_checkpoint_file;
+    argparse::ArgValue<bool> route_resume;
+    argparse::ArgValue<float> checkpoint_interval;
+    argparse::ArgValue<std::string> router_telemetry_file;
+    argparse::ArgValue<std::string> route_connection_trace_file;
+    argparse::ArgValue<std::string> route_replay_file;
     argparse::ArgValue<float> congested_routing_iteration_threshold_frac;
     argparse::ArgValue<e_route_bb_update> route_bb_update;
     argparse::ArgValue<int> router_high_fanout_threshold;
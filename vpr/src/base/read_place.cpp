@@ -1,11 +1,14 @@
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <sstream>
 
 #include "vtr_assert.h"
 #include "vtr_util.h"
 #include "vtr_log.h"
 #include "vtr_digest.h"
+#include "vtr_async_write.h"
+#include "vtr_compressed_io.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -19,7 +22,7 @@ void read_place(const char* net_file,
                 const char* place_file,
                 bool verify_file_digests,
                 const DeviceGrid& grid) {
-    std::ifstream fstream(place_file);
+    vtr::CompressedIstream fstream(place_file); //Transparently decompresses compressed place files
     if (!fstream) {
         VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
                         "'%s' - Cannot open place file.\n",
@@ -139,6 +142,70 @@ void read_place(const char* net_file,
     place_ctx.placement_id = vtr::secure_digest_file(place_file);
 }
 
+std::unordered_map<std::string, t_pl_loc> read_place_locations(const char* place_file, const DeviceGrid& grid) {
+    std::unordered_map<std::string, t_pl_loc> locations;
+
+    vtr::CompressedIstream fstream(place_file); //Transparently decompresses compressed place files
+    if (!fstream) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - Cannot open place file.\n",
+                        place_file);
+    }
+
+    std::string line;
+    int lineno = 0;
+    while (std::getline(fstream, line)) { //Parse line-by-line
+        ++lineno;
+
+        std::vector<std::string> tokens = vtr::split(line);
+
+        if (tokens.empty()) {
+            continue; //Skip blank lines
+
+        } else if (tokens[0][0] == '#') {
+            continue; //Skip commented lines
+
+        } else if (tokens.size() == 4
+                   && tokens[0] == "Netlist_File:"
+                   && tokens[2] == "Netlist_ID:") {
+            //The netlist is expected to have changed since the placement was
+            //generated (that is the point of a warm start), so the ID is not
+            //checked; blocks are matched by name instead.
+            continue;
+
+        } else if (tokens.size() == 7
+                   && tokens[0] == "Array"
+                   && tokens[1] == "size:"
+                   && tokens[3] == "x"
+                   && tokens[5] == "logic"
+                   && tokens[6] == "blocks") {
+            size_t place_file_width = vtr::atou(tokens[2]);
+            size_t place_file_height = vtr::atou(tokens[4]);
+            if (grid.width() != place_file_width || grid.height() != place_file_height) {
+                VTR_LOGF_WARN(place_file, lineno,
+                              "Placement was generated for a %zu x %zu device grid but the current grid is %zu x %zu; its locations cannot be reused\n",
+                              place_file_width, place_file_height, grid.width(), grid.height());
+                locations.clear();
+                return locations;
+            }
+
+        } else if (tokens.size() == 4 || (tokens.size() == 5 && tokens[4][0] == '#')) {
+            //Block location line
+            locations[tokens[0]] = t_pl_loc(vtr::atoi(tokens[1]),
+                                            vtr::atoi(tokens[2]),
+                                            vtr::atoi(tokens[3]));
+
+        } else {
+            //Tolerate (but flag) anything unrecognized
+            VTR_LOGF_WARN(place_file, lineno,
+                          "Ignoring invalid line '%s' in placement file\n",
+                          line.c_str());
+        }
+    }
+
+    return locations;
+}
+
 void read_user_pad_loc(const char* pad_loc_file) {
     /* Reads in the locations of the IO pads from a file. */
 
@@ -171,8 +238,8 @@ void read_user_pad_loc(const char* pad_loc_file) {
             auto type = device_ctx.grid[i][j].type;
             if (is_io_type(type)) {
                 for (int k = 0; k < type->capacity; k++) {
-                    if (place_ctx.grid_blocks[i][j].blocks[k] != INVALID_BLOCK_ID) {
-                        place_ctx.grid_blocks[i][j].blocks[k] = EMPTY_BLOCK_ID; /* Flag for err. check */
+                    if (place_ctx.grid_blocks.block_at_location(i, j, k) != INVALID_BLOCK_ID) {
+                        place_ctx.grid_blocks.set_block_at_location(i, j, k, EMPTY_BLOCK_ID); /* Flag for err. check */
                     }
                 }
             }
@@ -259,8 +326,7 @@ void read_user_pad_loc(const char* pad_loc_file) {
             vpr_throw(VPR_ERROR_PLACE_F, pad_loc_file, vtr::get_file_line_number_of_last_opened_file(),
                       "Block %s subblock number (%d) is out of range.\n", bname, k);
         }
-        place_ctx.grid_blocks[i][j].blocks[k] = bnum;
-        place_ctx.grid_blocks[i][j].usage++;
+        place_ctx.grid_blocks.set_block_at_location(i, j, k, bnum);
 
         ptr = vtr::fgets(buf, vtr::bufsize, fp);
     }
@@ -286,33 +352,37 @@ void read_user_pad_loc(const char* pad_loc_file) {
 void print_place(const char* net_file,
                  const char* net_id,
                  const char* place_file) {
-    FILE* fp;
-
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.mutable_placement();
 
-    fp = fopen(place_file, "w");
+    std::ostringstream fp;
 
-    fprintf(fp, "Netlist_File: %s Netlist_ID: %s\n",
-            net_file,
-            net_id);
-    fprintf(fp, "Array size: %zu x %zu logic blocks\n\n", device_ctx.grid.width(), device_ctx.grid.height());
-    fprintf(fp, "#block name\tx\ty\tsubblk\tblock number\n");
-    fprintf(fp, "#----------\t--\t--\t------\t------------\n");
+    fp << vtr::string_fmt("Netlist_File: %s Netlist_ID: %s\n",
+                          net_file,
+                          net_id);
+    fp << vtr::string_fmt("Array size: %zu x %zu logic blocks\n\n", device_ctx.grid.width(), device_ctx.grid.height());
+    fp << "#block name\tx\ty\tsubblk\tblock number\n";
+    fp << "#----------\t--\t--\t------\t------------\n";
 
     if (!place_ctx.block_locs.empty()) { //Only if placement exists
         for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-            fprintf(fp, "%s\t", cluster_ctx.clb_nlist.block_name(blk_id).c_str());
-            if (strlen(cluster_ctx.clb_nlist.block_name(blk_id).c_str()) < 8)
-                fprintf(fp, "\t");
+            fp << cluster_ctx.clb_nlist.block_name(blk_id) << "\t";
+            if (cluster_ctx.clb_nlist.block_name(blk_id).length() < 8)
+                fp << "\t";
 
-            fprintf(fp, "%d\t%d\t%d", place_ctx.block_locs[blk_id].loc.x, place_ctx.block_locs[blk_id].loc.y, place_ctx.block_locs[blk_id].loc.z);
-            fprintf(fp, "\t#%zu\n", size_t(blk_id));
+            fp << vtr::string_fmt("%d\t%d\t%d", place_ctx.block_locs[blk_id].loc.x, place_ctx.block_locs[blk_id].loc.y, place_ctx.block_locs[blk_id].loc.z);
+            fp << vtr::string_fmt("\t#%zu\n", size_t(blk_id));
         }
     }
-    fclose(fp);
 
-    //Calculate the ID of the placement
-    place_ctx.placement_id = vtr::secure_digest_file(place_file);
+    //Calculate the ID of the placement from the formatted contents (so it
+    //does not depend on the file write having completed)
+    std::string contents = fp.str();
+    std::istringstream contents_stream(contents);
+    place_ctx.placement_id = vtr::secure_digest_stream(contents_stream);
+
+    //Hand the formatted placement off to the background writer, overlapping
+    //the file write with further computation
+    vtr::async_write_file(place_file, std::move(contents));
 }
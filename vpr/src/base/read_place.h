@@ -1,12 +1,25 @@
 #ifndef READ_PLACE_H
 #define READ_PLACE_H
 
+#include <string>
+#include <unordered_map>
+
 void read_place(
     const char* net_file,
     const char* place_file,
     bool verify_file_hashes,
     const DeviceGrid& grid);
 
+//Leniently parses a .place file, returning the block name -> location
+//mapping it records. Unlike read_place() this tolerates a mismatched
+//netlist (warning instead of erroring) and does not touch the placement
+//context, making it suitable for warm starting (ECO) placement from a
+//prior run whose netlist has since changed. Returns an empty map if the
+//file was generated for a different device grid.
+std::unordered_map<std::string, t_pl_loc> read_place_locations(
+    const char* place_file,
+    const DeviceGrid& grid);
+
 void print_place(const char* net_file,
                  const char* net_id,
                  const char* place_file);
@@ -9,12 +9,12 @@
  * formats are incorrect or when the routing file does not match
  * other file's information*/
 
+#include <cctype>
 #include <iostream>
 #include <fstream>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
-#include <sstream>
 #include <string>
 #include <unordered_set>
 
@@ -23,6 +23,7 @@
 #include "rr_graph.h"
 #include "vtr_assert.h"
 #include "vtr_util.h"
+#include "vtr_compressed_io.h"
 #include "tatum/echo_writer.hpp"
 #include "vtr_log.h"
 #include "check_route.h"
@@ -41,13 +42,89 @@
 #include "route_common.h"
 #include "read_route.h"
 
+//Streams lines of the .route file, tokenized into reusable storage.
+//
+//Re-using the same line and token buffers for every line (rather than
+//allocating a fresh vector of strings per line, as vtr::split() does) keeps
+//the parse allocation-free in steady state, and unget() lets the per-net
+//parsers stop at the line starting the next net without seeking the
+//underlying stream.
+class RouteFileReader {
+  public:
+    RouteFileReader(std::istream& fp, const char* filename)
+        : fp_(fp)
+        , filename_(filename) {}
+
+    //Advances to the next line (tokenized), returning false at end of file
+    bool next() {
+        if (ungot_) {
+            ungot_ = false;
+            return true;
+        }
+        if (!std::getline(fp_, line_)) {
+            num_tokens_ = 0;
+            return false;
+        }
+        ++lineno_;
+        tokenize();
+        return true;
+    }
+
+    //Makes the current line be returned again by the next call to next()
+    void unget() { ungot_ = true; }
+
+    const char* filename() const { return filename_; }
+    int lineno() const { return lineno_; }
+
+    size_t num_tokens() const { return num_tokens_; }
+    const std::string& token(size_t itoken) const {
+        VTR_ASSERT_SAFE(itoken < num_tokens_);
+        return tokens_[itoken];
+    }
+
+  private:
+    void tokenize() {
+        num_tokens_ = 0;
+
+        const char* str = line_.c_str();
+        size_t len = line_.size();
+        size_t i = 0;
+        while (i < len) {
+            while (i < len && std::isspace(static_cast<unsigned char>(str[i]))) {
+                ++i;
+            }
+            size_t start = i;
+            while (i < len && !std::isspace(static_cast<unsigned char>(str[i]))) {
+                ++i;
+            }
+            if (i > start) {
+                //Re-use the existing token string's buffer where possible
+                if (num_tokens_ < tokens_.size()) {
+                    tokens_[num_tokens_].assign(str + start, i - start);
+                } else {
+                    tokens_.emplace_back(str + start, i - start);
+                }
+                ++num_tokens_;
+            }
+        }
+    }
+
+    std::istream& fp_;
+    const char* filename_;
+    int lineno_ = 0;
+    bool ungot_ = false;
+    std::string line_;
+    std::vector<std::string> tokens_; //Only the first num_tokens_ entries are valid
+    size_t num_tokens_ = 0;
+};
+
 /*************Functions local to this module*************/
-static void process_route(std::ifstream& fp, const char* filename, int& lineno);
-static void process_nodes(std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno);
-static void process_nets(std::ifstream& fp, ClusterNetId inet, std::string name, std::vector<std::string> input_tokens, const char* filename, int& lineno);
-static void process_global_blocks(std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno);
-static void format_coordinates(int& x, int& y, std::string coord, ClusterNetId net, const char* filename, const int lineno);
-static void format_pin_info(std::string& pb_name, std::string& port_name, int& pb_pin_num, std::string input);
+static void process_route(RouteFileReader& reader);
+static void process_nodes(RouteFileReader& reader, ClusterNetId inet, std::vector<t_trace>& net_nodes);
+static void process_nets(RouteFileReader& reader, ClusterNetId inet, std::string name, std::vector<t_trace>& net_nodes);
+static void process_global_blocks(RouteFileReader& reader, ClusterNetId inet);
+static void format_coordinates(int& x, int& y, const std::string& coord, ClusterNetId net, const char* filename, const int lineno);
+static void format_pin_info(std::string& pb_name, std::string& port_name, int& pb_pin_num, const std::string& input);
 static std::string format_name(std::string name);
 
 /*************Global Functions****************************/
@@ -60,31 +137,26 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
     /* Begin parsing the file */
     VTR_LOG("Begin loading FPGA routing file.\n");
 
-    std::string header_str;
-
-    std::ifstream fp;
-    fp.open(route_file);
-
-    int lineno = 0;
+    //Transparently decompresses compressed route files
+    vtr::CompressedIstream fp(route_file);
 
-    if (!fp.is_open()) {
-        vpr_throw(VPR_ERROR_ROUTE, route_file, lineno,
+    if (!fp) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
                   "Cannot open %s routing file", route_file);
     }
 
-    std::getline(fp, header_str);
-    ++lineno;
+    RouteFileReader reader(fp, route_file);
 
-    std::vector<std::string> header = vtr::split(header_str);
-    if (header[0] == "Placement_File:" && header[2] == "Placement_ID:" && header[3] != place_ctx.placement_id) {
+    reader.next();
+    if (reader.num_tokens() >= 4 && reader.token(0) == "Placement_File:" && reader.token(2) == "Placement_ID:" && reader.token(3) != place_ctx.placement_id) {
         auto msg = vtr::string_fmt(
             "Placement file %s specified in the routing file"
             " does not match the loaded placement (ID %s != %s)",
-            header[1].c_str(), header[3].c_str(), place_ctx.placement_id.c_str());
+            reader.token(1).c_str(), reader.token(3).c_str(), place_ctx.placement_id.c_str());
         if (verify_file_digests) {
-            vpr_throw(VPR_ERROR_ROUTE, route_file, lineno, msg.c_str());
+            vpr_throw(VPR_ERROR_ROUTE, route_file, reader.lineno(), msg.c_str());
         } else {
-            VTR_LOGF_WARN(route_file, lineno, "%s\n", msg.c_str());
+            VTR_LOGF_WARN(route_file, reader.lineno(), "%s\n", msg.c_str());
         }
     }
 
@@ -93,20 +165,15 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
     init_route_structs(router_opts.bb_factor);
 
     /*Check dimensions*/
-    std::getline(fp, header_str);
-    ++lineno;
-    header.clear();
-    header = vtr::split(header_str);
-    if (header[0] == "Array" && header[1] == "size:" && (vtr::atou(header[2].c_str()) != device_ctx.grid.width() || vtr::atou(header[4].c_str()) != device_ctx.grid.height())) {
-        vpr_throw(VPR_ERROR_ROUTE, route_file, lineno,
+    reader.next();
+    if (reader.num_tokens() >= 5 && reader.token(0) == "Array" && reader.token(1) == "size:" && (vtr::atou(reader.token(2).c_str()) != device_ctx.grid.width() || vtr::atou(reader.token(4).c_str()) != device_ctx.grid.height())) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, reader.lineno(),
                   "Device dimensions %sx%s specified in the routing file does not match given %dx%d ",
-                  header[2].c_str(), header[4].c_str(), device_ctx.grid.width(), device_ctx.grid.height());
+                  reader.token(2).c_str(), reader.token(4).c_str(), device_ctx.grid.width(), device_ctx.grid.height());
     }
 
     /* Read in every net */
-    process_route(fp, route_file, lineno);
-
-    fp.close();
+    process_route(reader);
 
     /*Correctly set up the clb opins*/
     recompute_occupancy_from_scratch();
@@ -126,36 +193,30 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
     return is_feasible;
 }
 
-static void process_route(std::ifstream& fp, const char* filename, int& lineno) {
+static void process_route(RouteFileReader& reader) {
     /*Walks through every net and add the routing appropriately*/
-    std::string input;
-    std::vector<std::string> tokens;
-    while (std::getline(fp, input)) {
-        ++lineno;
-        tokens.clear();
-        tokens = vtr::split(input);
-        if (tokens.empty()) {
+    std::vector<t_trace> net_nodes; //Re-used across nets
+    while (reader.next()) {
+        if (reader.num_tokens() == 0) {
             continue; //Skip blank lines
-        } else if (tokens[0][0] == '#') {
+        } else if (reader.token(0)[0] == '#') {
             continue; //Skip commented lines
-        } else if (tokens[0] == "Net") {
-            ClusterNetId inet(atoi(tokens[1].c_str()));
-            process_nets(fp, inet, tokens[2], tokens, filename, lineno);
+        } else if (reader.token(0) == "Net") {
+            ClusterNetId inet(atoi(reader.token(1).c_str()));
+            process_nets(reader, inet, reader.token(2), net_nodes);
         }
     }
-
-    tokens.clear();
 }
 
-static void process_nets(std::ifstream& fp, ClusterNetId inet, std::string name, std::vector<std::string> input_tokens, const char* filename, int& lineno) {
+static void process_nets(RouteFileReader& reader, ClusterNetId inet, std::string name, std::vector<t_trace>& net_nodes) {
     /* Check if the net is global or not, and process appropriately */
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
 
-    if (input_tokens.size() > 3 && input_tokens[3] == "global"
-        && input_tokens[4] == "net" && input_tokens[5] == "connecting:") {
+    if (reader.num_tokens() > 5 && reader.token(3) == "global"
+        && reader.token(4) == "net" && reader.token(5) == "connecting:") {
         /* Global net.  Never routed. */
         if (!cluster_ctx.clb_nlist.net_is_ignored(inet)) {
-            vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                       "Net %lu should be a global net", size_t(inet));
         }
         /*erase an extra colon for global nets*/
@@ -163,12 +224,12 @@ static void process_nets(std::ifstream& fp, ClusterNetId inet, std::string name,
         name = format_name(name);
 
         if (0 != cluster_ctx.clb_nlist.net_name(inet).compare(name)) {
-            vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                       "Net name %s for net number %lu specified in the routing file does not match given %s",
                       name.c_str(), size_t(inet), cluster_ctx.clb_nlist.net_name(inet).c_str());
         }
 
-        process_global_blocks(fp, inet, filename, lineno);
+        process_global_blocks(reader, inet);
     } else {
         /* Not a global net */
         if (cluster_ctx.clb_nlist.net_is_ignored(inet)) {
@@ -178,18 +239,17 @@ static void process_nets(std::ifstream& fp, ClusterNetId inet, std::string name,
         name = format_name(name);
 
         if (0 != cluster_ctx.clb_nlist.net_name(inet).compare(name)) {
-            vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                       "Net name %s for net number %lu specified in the routing file does not match given %s",
                       name.c_str(), size_t(inet), cluster_ctx.clb_nlist.net_name(inet).c_str());
         }
 
-        process_nodes(fp, inet, filename, lineno);
+        process_nodes(reader, inet, net_nodes);
     }
-    input_tokens.clear();
     return;
 }
 
-static void process_nodes(std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno) {
+static void process_nodes(RouteFileReader& reader, ClusterNetId inet, std::vector<t_trace>& net_nodes) {
     /* Not a global net. Goes through every node and add it into trace.head*/
 
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
@@ -197,226 +257,195 @@ static void process_nodes(std::ifstream& fp, ClusterNetId inet, const char* file
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     auto& place_ctx = g_vpr_ctx.placement();
 
-    t_trace* tptr = route_ctx.trace[inet].head;
-
-    /*remember the position of the last line in order to go back*/
-    std::streampos oldpos = fp.tellg();
     int inode, x, y, x2, y2, ptc, switch_id, offset;
     int node_count = 0;
-    std::string input;
-    std::vector<std::string> tokens;
-
-    /*Walk through every line that begins with Node:*/
-    while (std::getline(fp, input)) {
-        ++lineno;
 
-        tokens.clear();
-        tokens = vtr::split(input);
+    /*Collect the net's nodes first so the traceback storage can be allocated
+     * exactly once per net, then walk through every line that begins with Node:*/
+    net_nodes.clear();
 
-        if (tokens.empty()) {
+    while (reader.next()) {
+        if (reader.num_tokens() == 0) {
             continue; /*Skip blank lines*/
-        } else if (tokens[0][0] == '#') {
+        } else if (reader.token(0)[0] == '#') {
             continue; /*Skip commented lines*/
-        } else if (tokens[0] == "Net") {
-            /*End of the nodes list,
-             *  return by moving the position of next char of input stream to be before net*/
-            fp.seekg(oldpos);
-            return;
-        } else if (input == "\n\nUsed in local cluster only, reserved one CLB pin\n\n") {
+        } else if (reader.token(0) == "Net") {
+            /*End of the nodes list, push the line back for the caller to re-read*/
+            reader.unget();
+            break;
+        } else if (reader.token(0) == "Used") {
+            /*"Used in local cluster only, reserved one CLB pin"*/
             if (cluster_ctx.clb_nlist.net_sinks(inet).size() != 0) {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
-                          "Net %d should be used in local cluster only, reserved one CLB pin");
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
+                          "Net %lu should be used in local cluster only, reserved one CLB pin", size_t(inet));
             }
-            return;
-        } else if (tokens[0] == "Node:") {
+            break;
+        } else if (reader.token(0) == "Node:") {
             /*An actual line, go through each node and add it to the route tree*/
-            inode = atoi(tokens[1].c_str());
+            inode = atoi(reader.token(1).c_str());
             auto& node = device_ctx.rr_nodes[inode];
 
             /*First node needs to be source. It is isolated to correctly set heap head.*/
-            if (node_count == 0 && tokens[2] != "SOURCE") {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            if (node_count == 0 && reader.token(2) != "SOURCE") {
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                           "First node in routing has to be a source type");
             }
 
             /*Check node types if match rr graph*/
-            if (tokens[2] != node.type_string()) {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            if (reader.token(2) != node.type_string()) {
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                           "Node %d has a type that does not match the RR graph", inode);
             }
 
-            format_coordinates(x, y, tokens[3], inet, filename, lineno);
+            format_coordinates(x, y, reader.token(3), inet, reader.filename(), reader.lineno());
 
-            if (tokens[4] == "to") {
-                format_coordinates(x2, y2, tokens[5], inet, filename, lineno);
+            if (reader.token(4) == "to") {
+                format_coordinates(x2, y2, reader.token(5), inet, reader.filename(), reader.lineno());
                 if (node.xlow() != x || node.xhigh() != x2 || node.yhigh() != y2 || node.ylow() != y) {
-                    vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+                    vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                               "The coordinates of node %d does not match the rr graph", inode);
                 }
                 offset = 2;
             } else {
                 if (node.xlow() != x || node.xhigh() != x || node.yhigh() != y || node.ylow() != y) {
-                    vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+                    vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                               "The coordinates of node %d does not match the rr graph", inode);
                 }
                 offset = 0;
             }
 
             /* Verify types and ptc*/
-            if (tokens[2] == "SOURCE" || tokens[2] == "SINK" || tokens[2] == "OPIN" || tokens[2] == "IPIN") {
-                if (tokens[4 + offset] == "Pad:" && !is_io_type(device_ctx.grid[x][y].type)) {
-                    vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            if (reader.token(2) == "SOURCE" || reader.token(2) == "SINK" || reader.token(2) == "OPIN" || reader.token(2) == "IPIN") {
+                if (reader.token(4 + offset) == "Pad:" && !is_io_type(device_ctx.grid[x][y].type)) {
+                    vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                               "Node %d is of the wrong type", inode);
                 }
-            } else if (tokens[2] == "CHANX" || tokens[2] == "CHANY") {
-                if (tokens[4 + offset] != "Track:") {
-                    vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
-                              "A %s node have to have track info", tokens[2].c_str());
+            } else if (reader.token(2) == "CHANX" || reader.token(2) == "CHANY") {
+                if (reader.token(4 + offset) != "Track:") {
+                    vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
+                              "A %s node have to have track info", reader.token(2).c_str());
                 }
             }
 
-            ptc = atoi(tokens[5 + offset].c_str());
+            ptc = atoi(reader.token(5 + offset).c_str());
             if (node.ptc_num() != ptc) {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                           "The ptc num of node %d does not match the rr graph", inode);
             }
 
             /*Process switches and pb pin info if it is ipin or opin type*/
-            if (tokens[6 + offset] != "Switch:") {
+            if (reader.token(6 + offset) != "Switch:") {
                 /*This is an opin or ipin, process its pin nums*/
-                if (!is_io_type(device_ctx.grid[x][y].type) && (tokens[2] == "IPIN" || tokens[2] == "OPIN")) {
+                if (!is_io_type(device_ctx.grid[x][y].type) && (reader.token(2) == "IPIN" || reader.token(2) == "OPIN")) {
                     int pin_num = device_ctx.rr_nodes[inode].ptc_num();
                     int height_offset = device_ctx.grid[x][y].height_offset;
-                    ClusterBlockId iblock = place_ctx.grid_blocks[x][y - height_offset].blocks[0];
+                    ClusterBlockId iblock = place_ctx.grid_blocks.block_at_location(x, y - height_offset, 0);
                     t_pb_graph_pin* pb_pin = get_pb_graph_node_pin_from_block_pin(iblock, pin_num);
                     t_pb_type* pb_type = pb_pin->parent_node->pb_type;
 
                     std::string pb_name, port_name;
                     int pb_pin_num;
 
-                    format_pin_info(pb_name, port_name, pb_pin_num, tokens[6 + offset]);
+                    format_pin_info(pb_name, port_name, pb_pin_num, reader.token(6 + offset));
 
                     if (pb_name != pb_type->name || port_name != pb_pin->port->name || pb_pin_num != pb_pin->pin_number) {
-                        vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+                        vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                                   "%d node does not have correct pins", inode);
                     }
                 } else {
-                    vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+                    vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                               "%d node does not have correct pins", inode);
                 }
-                switch_id = atoi(tokens[8 + offset].c_str());
+                switch_id = atoi(reader.token(8 + offset).c_str());
             } else {
-                switch_id = atoi(tokens[7 + offset].c_str());
+                switch_id = atoi(reader.token(7 + offset).c_str());
             }
 
-            /* Allocate and load correct values to trace.head*/
-            if (node_count == 0) {
-                route_ctx.trace[inet].head = alloc_trace_data();
-                route_ctx.trace[inet].head->index = inode;
-                route_ctx.trace[inet].head->iswitch = switch_id;
-                route_ctx.trace[inet].head->next = nullptr;
-                tptr = route_ctx.trace[inet].head;
-                node_count++;
-            } else {
-                tptr->next = alloc_trace_data();
-                tptr = tptr->next;
-                tptr->index = inode;
-                tptr->iswitch = switch_id;
-                tptr->next = nullptr;
-                node_count++;
-            }
+            net_nodes.push_back({nullptr, inode, static_cast<short>(switch_id)});
+            node_count++;
         }
-        /*stores last line so can easily go back to read*/
-        oldpos = fp.tellg();
+    }
+
+    /* Append the collected nodes to the net's traceback in one shot */
+    auto& traceback = route_ctx.trace[inet];
+    traceback.reserve(net_nodes.size());
+    for (const t_trace& net_node : net_nodes) {
+        traceback.append(net_node.index, net_node.iswitch);
     }
 }
 
 /*This function goes through all the blocks in a global net and verify it with the
  * clustered netlist and the placement */
-static void process_global_blocks(std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno) {
+static void process_global_blocks(RouteFileReader& reader, ClusterNetId inet) {
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
     auto& place_ctx = g_vpr_ctx.placement();
 
-    std::string block, bnum_str;
+    std::string bnum_str;
     int x, y;
-    std::vector<std::string> tokens;
     int pin_counter = 0;
 
-    std::streampos oldpos = fp.tellg();
     /*Walk through every block line*/
-    while (std::getline(fp, block)) {
-        ++lineno;
-        tokens.clear();
-        tokens = vtr::split(block);
-
-        if (tokens.empty()) {
+    while (reader.next()) {
+        if (reader.num_tokens() == 0) {
             continue; /*Skip blank lines*/
-        } else if (tokens[0][0] == '#') {
+        } else if (reader.token(0)[0] == '#') {
             continue; /*Skip commented lines*/
-        } else if (tokens[0] != "Block") {
-            /*End of blocks, go back to reading nets*/
-            fp.seekg(oldpos);
+        } else if (reader.token(0) != "Block") {
+            /*End of blocks, push the line back for the caller to re-read*/
+            reader.unget();
             return;
         } else {
-            format_coordinates(x, y, tokens[4], inet, filename, lineno);
+            format_coordinates(x, y, reader.token(4), inet, reader.filename(), reader.lineno());
 
             /*remove ()*/
-            bnum_str = format_name(tokens[2]);
+            bnum_str = format_name(reader.token(2));
             /*remove #*/
             bnum_str.erase(bnum_str.begin());
             ClusterBlockId bnum(atoi(bnum_str.c_str()));
 
             /*Check for name, coordinate, and pins*/
-            if (0 != cluster_ctx.clb_nlist.block_name(bnum).compare(tokens[1])) {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            if (0 != cluster_ctx.clb_nlist.block_name(bnum).compare(reader.token(1))) {
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                           "Block %s for block number %lu specified in the routing file does not match given %s",
-                          tokens[1].c_str(), size_t(bnum), cluster_ctx.clb_nlist.block_name(bnum).c_str());
+                          reader.token(1).c_str(), size_t(bnum), cluster_ctx.clb_nlist.block_name(bnum).c_str());
             }
             if (place_ctx.block_locs[bnum].loc.x != x || place_ctx.block_locs[bnum].loc.y != y) {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                           "The placement coordinates (%d, %d) of %d block does not match given (%d, %d)",
                           x, y, place_ctx.block_locs[bnum].loc.x, place_ctx.block_locs[bnum].loc.y);
             }
 
             int pin_index = cluster_ctx.clb_nlist.net_pin_physical_index(inet, pin_counter);
-            if (physical_tile_type(bnum)->pin_class[pin_index] != atoi(tokens[7].c_str())) {
-                vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
+            if (physical_tile_type(bnum)->pin_class[pin_index] != atoi(reader.token(7).c_str())) {
+                vpr_throw(VPR_ERROR_ROUTE, reader.filename(), reader.lineno(),
                           "The pin class %d of %lu net does not match given ",
-                          atoi(tokens[7].c_str()), size_t(inet), physical_tile_type(bnum)->pin_class[pin_index]);
+                          atoi(reader.token(7).c_str()), size_t(inet), physical_tile_type(bnum)->pin_class[pin_index]);
             }
             pin_counter++;
         }
-        oldpos = fp.tellg();
     }
 }
 
-static void format_coordinates(int& x, int& y, std::string coord, ClusterNetId net, const char* filename, const int lineno) {
+static void format_coordinates(int& x, int& y, const std::string& coord, ClusterNetId net, const char* filename, const int lineno) {
     /*Parse coordinates in the form of (x,y) into correct x and y values*/
-    coord = format_name(coord);
-    std::stringstream coord_stream(coord);
-    if (!(coord_stream >> x)) {
-        vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
-                  "Net %lu has coordinates that is not in the form (x,y)", size_t(net));
-    }
-    coord_stream.ignore(1, ' ');
-    if (!(coord_stream >> y)) {
+    if (sscanf(coord.c_str(), "(%d,%d)", &x, &y) != 2) {
         vpr_throw(VPR_ERROR_ROUTE, filename, lineno,
                   "Net %lu has coordinates that is not in the form (x,y)", size_t(net));
     }
 }
 
-static void format_pin_info(std::string& pb_name, std::string& port_name, int& pb_pin_num, std::string input) {
+static void format_pin_info(std::string& pb_name, std::string& port_name, int& pb_pin_num, const std::string& input) {
     /*Parse the pin info in the form of pb_name.port_name[pb_pin_num]
      *into its appropriate variables*/
-    std::stringstream pb_info(input);
-    std::getline(pb_info, pb_name, '.');
-    std::getline(pb_info, port_name, '[');
-    pb_info >> pb_pin_num;
-    if (!pb_info) {
+    char pb[256];
+    char port[256];
+    if (sscanf(input.c_str(), "%255[^.].%255[^[][%d]", pb, port, &pb_pin_num) != 3) {
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
                         "Format of this pin info %s is incorrect",
                         input.c_str());
     }
+    pb_name = pb;
+    port_name = port;
 }
 
 /*Return actual name by extracting it out of the form of (name)*/
@@ -2,11 +2,14 @@
 #include <cstring>
 #include <cmath>
 #include <set>
+#include <sstream>
+#include <thread>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_math.h"
 #include "vtr_ndmatrix.h"
+#include "vtr_async_write.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -27,13 +30,40 @@
 #include "timing_util.h"
 #include "tatum/TimingReporter.hpp"
 
+/********************** Structures local to this module **********************/
+
+/* Statistics accumulated in a single fused pass over the routed tracebacks
+ * (see collect_routing_traceback_stats()) */
+struct t_routing_traceback_stats {
+    int total_bends = 0;
+    int max_bends = 0;
+    int total_length = 0;
+    int max_length = 0;
+    int total_segments = 0;
+    int max_segments = 0;
+    int num_global_nets = 0;
+    int num_clb_opins_reserved = 0;
+
+    vtr::Matrix<int> chanx_occ; //[1..grid.width()-1][0..grid.height()-2]
+    vtr::Matrix<int> chany_occ; //[0..grid.width()-2][1..grid.height()-1]
+};
+
 /********************** Subroutines local to this module *********************/
 
-static void load_channel_occupancies(vtr::Matrix<int>& chanx_occ, vtr::Matrix<int>& chany_occ);
+/* Minimum number of nets each statistics worker thread should process */
+constexpr size_t MIN_NETS_PER_STATS_WORKER = 4096;
+
+static t_routing_traceback_stats collect_routing_traceback_stats();
+
+static t_routing_traceback_stats collect_routing_traceback_stats_range(size_t inet_begin, size_t inet_end);
+
+static void merge_routing_traceback_stats(t_routing_traceback_stats& into, const t_routing_traceback_stats& from);
 
-static void length_and_bends_stats();
+static void write_routing_stats_summary(const char* filename, const t_routing_traceback_stats& stats, float area, float used_area);
 
-static void get_channel_occupancy_stats();
+static void length_and_bends_stats(const t_routing_traceback_stats& stats);
+
+static void get_channel_occupancy_stats(const t_routing_traceback_stats& stats);
 
 /************************* Subroutine definitions ****************************/
 
@@ -48,9 +78,14 @@ void routing_stats(bool full_stats, enum e_route_type route_type, std::vector<t_
 
     int num_rr_switch = device_ctx.rr_switch_inf.size();
 
-    length_and_bends_stats();
+    /* The wirelength/bend counts and the channel occupancies are all derived
+     * from the routed tracebacks; collect them in one fused pass instead of
+     * re-walking every net's traceback per report */
+    t_routing_traceback_stats traceback_stats = collect_routing_traceback_stats();
+
+    length_and_bends_stats(traceback_stats);
     print_channel_stats();
-    get_channel_occupancy_stats();
+    get_channel_occupancy_stats(traceback_stats);
 
     VTR_LOG("Logic area (in minimum width transistor areas, excludes I/Os and empty grid tiles)...\n");
 
@@ -86,6 +121,10 @@ void routing_stats(bool full_stats, enum e_route_type route_type, std::vector<t_
     }
     VTR_LOG("\tTotal used logic block area: %g\n", used_area);
 
+    if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_ROUTING_STATS)) {
+        write_routing_stats_summary(getEchoFileName(E_ECHO_ROUTING_STATS), traceback_stats, area, used_area);
+    }
+
     if (route_type == DETAILED) {
         count_routing_transistors(directionality, num_rr_switch, wire_to_ipin_switch,
                                   segment_inf, R_minW_nmos, R_minW_pmos);
@@ -96,81 +135,241 @@ void routing_stats(bool full_stats, enum e_route_type route_type, std::vector<t_
         print_wirelen_prob_dist();
 }
 
-/* Figures out maximum, minimum and average number of bends and net length   *
- * in the routing.                                                           */
-void length_and_bends_stats() {
-    int bends, total_bends, max_bends;
-    int length, total_length, max_length;
-    int segments, total_segments, max_segments;
-    float av_bends, av_length, av_segments;
-    int num_global_nets, num_clb_opins_reserved;
+/* Walks every routed net's traceback exactly once, accumulating the bend,
+ * wirelength and segment counts together with the channel occupancies.
+ * Previously each statistics report re-walked all the tracebacks separately;
+ * fusing the walks removes several full-design passes from the post-route
+ * flow. The per-net counting matches get_num_bends_and_length(); the
+ * occupancy counting matches the former load_channel_occupancies(). */
+static t_routing_traceback_stats collect_routing_traceback_stats() {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    size_t num_nets = cluster_ctx.clb_nlist.nets().size();
+
+    /* The traceback walks are independent per net (all routing state is
+     * read-only here), so process contiguous net ranges in parallel and
+     * merge the per-worker accumulations */
+    size_t num_workers = 1;
+    if (std::thread::hardware_concurrency() > 1) {
+        num_workers = std::min<size_t>(std::thread::hardware_concurrency(), std::max<size_t>(1, num_nets / MIN_NETS_PER_STATS_WORKER));
+    }
+
+    if (num_workers <= 1) {
+        return collect_routing_traceback_stats_range(0, num_nets);
+    }
+
+    std::vector<t_routing_traceback_stats> worker_stats(num_workers);
+    std::vector<std::exception_ptr> worker_errors(num_workers);
+
+    size_t nets_per_worker = (num_nets + num_workers - 1) / num_workers;
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+        size_t inet_begin = std::min(num_nets, iworker * nets_per_worker);
+        size_t inet_end = std::min(num_nets, inet_begin + nets_per_worker);
+        workers.emplace_back([&, iworker, inet_begin, inet_end]() {
+            try {
+                worker_stats[iworker] = collect_routing_traceback_stats_range(inet_begin, inet_end);
+            } catch (...) {
+                worker_errors[iworker] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : worker_errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    t_routing_traceback_stats stats = std::move(worker_stats[0]);
+    for (size_t iworker = 1; iworker < num_workers; ++iworker) {
+        merge_routing_traceback_stats(stats, worker_stats[iworker]);
+    }
+    return stats;
+}
 
+static t_routing_traceback_stats collect_routing_traceback_stats_range(size_t inet_begin, size_t inet_end) {
+    auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    t_routing_traceback_stats stats;
+    stats.chanx_occ = vtr::Matrix<int>({{
+                                           device_ctx.grid.width(),     //[0 .. device_ctx.grid.width() - 1] (length of x channel)
+                                           device_ctx.grid.height() - 1 //[0 .. device_ctx.grid.height() - 2] (# x channels)
+                                       }},
+                                       0);
+    stats.chany_occ = vtr::Matrix<int>({{
+                                           device_ctx.grid.width() - 1, //[0 .. device_ctx.grid.width() - 2] (# y channels)
+                                           device_ctx.grid.height()     //[0 .. device_ctx.grid.height() - 1] (length of y channel)
+                                       }},
+                                       0);
+
+    for (size_t inet = inet_begin; inet < inet_end; ++inet) {
+        ClusterNetId net_id(inet); //The clustered netlist is compressed, so net ids are contiguous
+        bool is_ignored = cluster_ctx.clb_nlist.net_is_ignored(net_id);
+        bool has_sinks = cluster_ctx.clb_nlist.net_sinks(net_id).size() != 0;
+
+        if (is_ignored) {
+            stats.num_global_nets++;
+        } else if (!has_sinks) {
+            stats.num_clb_opins_reserved++;
+        }
 
-    max_bends = 0;
-    total_bends = 0;
-    max_length = 0;
-    total_length = 0;
-    max_segments = 0;
-    total_segments = 0;
-    num_global_nets = 0;
-    num_clb_opins_reserved = 0;
+        /* Globals don't count towards the wirelength/bend statistics */
+        bool count_length = !is_ignored && has_sinks;
+        /* Global (but routed) zero-sink nets still occupy channel tracks */
+        bool count_occupancy = !(is_ignored && has_sinks);
 
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id) && cluster_ctx.clb_nlist.net_sinks(net_id).size() != 0) { /* Globals don't count. */
-            get_num_bends_and_length(net_id, &bends, &length, &segments);
+        if (!count_length && !count_occupancy)
+            continue;
+
+        t_trace* tptr = route_ctx.trace[net_id].head; /* Should always be SOURCE. */
+        if (tptr == nullptr) {
+            if (count_length) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                                "in collect_routing_traceback_stats: net #%lu has no traceback.\n", size_t(net_id));
+            }
+            continue;
+        }
 
-            total_bends += bends;
-            max_bends = std::max(bends, max_bends);
+        int bends = 0;
+        int length = 0;
+        int segments = 0;
 
-            total_length += length;
-            max_length = std::max(length, max_length);
+        t_rr_type prev_type = device_ctx.rr_nodes[tptr->index].type();
+        tptr = tptr->next;
+
+        while (tptr != nullptr) {
+            int inode = tptr->index;
+            t_rr_type curr_type = device_ctx.rr_nodes[inode].type();
+
+            if (curr_type == SINK) { /* Starting a new segment */
+                tptr = tptr->next;   /* Link to existing path - don't count it. */
+                if (tptr == nullptr)
+                    break;
+
+                curr_type = device_ctx.rr_nodes[tptr->index].type();
+            } else if (curr_type == CHANX || curr_type == CHANY) {
+                if (count_occupancy) {
+                    if (curr_type == CHANX) {
+                        int j = device_ctx.rr_nodes[inode].ylow();
+                        for (int i = device_ctx.rr_nodes[inode].xlow(); i <= device_ctx.rr_nodes[inode].xhigh(); i++)
+                            stats.chanx_occ[i][j]++;
+                    } else {
+                        int i = device_ctx.rr_nodes[inode].xlow();
+                        for (int j = device_ctx.rr_nodes[inode].ylow(); j <= device_ctx.rr_nodes[inode].yhigh(); j++)
+                            stats.chany_occ[i][j]++;
+                    }
+                }
+
+                segments++;
+                length += 1 + device_ctx.rr_nodes[inode].xhigh() - device_ctx.rr_nodes[inode].xlow()
+                          + device_ctx.rr_nodes[inode].yhigh() - device_ctx.rr_nodes[inode].ylow();
+
+                if (curr_type != prev_type && (prev_type == CHANX || prev_type == CHANY))
+                    bends++;
+            }
 
-            total_segments += segments;
-            max_segments = std::max(segments, max_segments);
-        } else if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
-            num_global_nets++;
-        } else {
-            num_clb_opins_reserved++;
+            prev_type = curr_type;
+            tptr = tptr->next;
+        }
+
+        if (count_length) {
+            stats.total_bends += bends;
+            stats.max_bends = std::max(bends, stats.max_bends);
+
+            stats.total_length += length;
+            stats.max_length = std::max(length, stats.max_length);
+
+            stats.total_segments += segments;
+            stats.max_segments = std::max(segments, stats.max_segments);
         }
     }
 
-    av_bends = (float)total_bends / (float)((int)cluster_ctx.clb_nlist.nets().size() - num_global_nets);
+    return stats;
+}
+
+/* Combines the statistics accumulated over one net range into 'into' */
+static void merge_routing_traceback_stats(t_routing_traceback_stats& into, const t_routing_traceback_stats& from) {
+    into.total_bends += from.total_bends;
+    into.max_bends = std::max(into.max_bends, from.max_bends);
+    into.total_length += from.total_length;
+    into.max_length = std::max(into.max_length, from.max_length);
+    into.total_segments += from.total_segments;
+    into.max_segments = std::max(into.max_segments, from.max_segments);
+    into.num_global_nets += from.num_global_nets;
+    into.num_clb_opins_reserved += from.num_clb_opins_reserved;
+
+    VTR_ASSERT(into.chanx_occ.size() == from.chanx_occ.size());
+    VTR_ASSERT(into.chany_occ.size() == from.chany_occ.size());
+    for (size_t i = 0; i < into.chanx_occ.size(); ++i) {
+        into.chanx_occ.get(i) += from.chanx_occ.get(i);
+    }
+    for (size_t i = 0; i < into.chany_occ.size(); ++i) {
+        into.chany_occ.get(i) += from.chany_occ.get(i);
+    }
+}
+
+/* Writes a machine-readable (one 'key: value' per line) summary of the
+ * post-route statistics, so harnesses can consume them without scraping
+ * the log */
+static void write_routing_stats_summary(const char* filename, const t_routing_traceback_stats& stats, float area, float used_area) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    int num_routed_nets = (int)cluster_ctx.clb_nlist.nets().size() - stats.num_global_nets;
+
+    std::ostringstream os;
+    os << "num_nets: " << cluster_ctx.clb_nlist.nets().size() << "\n";
+    os << "num_global_nets: " << stats.num_global_nets << "\n";
+    os << "num_routed_nets: " << num_routed_nets << "\n";
+    os << "num_clb_opins_reserved: " << stats.num_clb_opins_reserved << "\n";
+    os << "total_wirelength: " << stats.total_length << "\n";
+    os << "max_net_length: " << stats.max_length << "\n";
+    os << "total_bends: " << stats.total_bends << "\n";
+    os << "max_net_bends: " << stats.max_bends << "\n";
+    os << "total_wire_segments: " << stats.total_segments << "\n";
+    os << "max_net_wire_segments: " << stats.max_segments << "\n";
+    os << "logic_block_area: " << area << "\n";
+    os << "used_logic_block_area: " << used_area << "\n";
+
+    vtr::async_write_file(filename, os.str());
+}
+
+/* Prints out maximum, minimum and average number of bends and net length   *
+ * in the routing.                                                          */
+static void length_and_bends_stats(const t_routing_traceback_stats& stats) {
+    float av_bends, av_length, av_segments;
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    av_bends = (float)stats.total_bends / (float)((int)cluster_ctx.clb_nlist.nets().size() - stats.num_global_nets);
     VTR_LOG("\n");
-    VTR_LOG("Average number of bends per net: %#g  Maximum # of bends: %d\n", av_bends, max_bends);
+    VTR_LOG("Average number of bends per net: %#g  Maximum # of bends: %d\n", av_bends, stats.max_bends);
     VTR_LOG("\n");
 
-    av_length = (float)total_length / (float)((int)cluster_ctx.clb_nlist.nets().size() - num_global_nets);
-    VTR_LOG("Number of global nets: %d\n", num_global_nets);
-    VTR_LOG("Number of routed nets (nonglobal): %d\n", (int)cluster_ctx.clb_nlist.nets().size() - num_global_nets);
+    av_length = (float)stats.total_length / (float)((int)cluster_ctx.clb_nlist.nets().size() - stats.num_global_nets);
+    VTR_LOG("Number of global nets: %d\n", stats.num_global_nets);
+    VTR_LOG("Number of routed nets (nonglobal): %d\n", (int)cluster_ctx.clb_nlist.nets().size() - stats.num_global_nets);
     VTR_LOG("Wire length results (in units of 1 clb segments)...\n");
-    VTR_LOG("\tTotal wirelength: %d, average net length: %#g\n", total_length, av_length);
-    VTR_LOG("\tMaximum net length: %d\n", max_length);
+    VTR_LOG("\tTotal wirelength: %d, average net length: %#g\n", stats.total_length, av_length);
+    VTR_LOG("\tMaximum net length: %d\n", stats.max_length);
     VTR_LOG("\n");
 
-    av_segments = (float)total_segments / (float)((int)cluster_ctx.clb_nlist.nets().size() - num_global_nets);
+    av_segments = (float)stats.total_segments / (float)((int)cluster_ctx.clb_nlist.nets().size() - stats.num_global_nets);
     VTR_LOG("Wire length results in terms of physical segments...\n");
-    VTR_LOG("\tTotal wiring segments used: %d, average wire segments per net: %#g\n", total_segments, av_segments);
-    VTR_LOG("\tMaximum segments used by a net: %d\n", max_segments);
-    VTR_LOG("\tTotal local nets with reserved CLB opins: %d\n", num_clb_opins_reserved);
+    VTR_LOG("\tTotal wiring segments used: %d, average wire segments per net: %#g\n", stats.total_segments, av_segments);
+    VTR_LOG("\tMaximum segments used by a net: %d\n", stats.max_segments);
+    VTR_LOG("\tTotal local nets with reserved CLB opins: %d\n", stats.num_clb_opins_reserved);
 }
 
-static void get_channel_occupancy_stats() {
+static void get_channel_occupancy_stats(const t_routing_traceback_stats& stats) {
     /* Determines how many tracks are used in each channel.                    */
     auto& device_ctx = g_vpr_ctx.device();
 
-    auto chanx_occ = vtr::Matrix<int>({{
-                                          device_ctx.grid.width(),     //[0 .. device_ctx.grid.width() - 1] (length of x channel)
-                                          device_ctx.grid.height() - 1 //[0 .. device_ctx.grid.height() - 2] (# x channels)
-                                      }},
-                                      0);
-
-    auto chany_occ = vtr::Matrix<int>({{
-                                          device_ctx.grid.width() - 1, //[0 .. device_ctx.grid.width() - 2] (# y channels)
-                                          device_ctx.grid.height()     //[0 .. device_ctx.grid.height() - 1] (length of y channel)
-                                      }},
-                                      0);
-    load_channel_occupancies(chanx_occ, chany_occ);
+    const vtr::Matrix<int>& chanx_occ = stats.chanx_occ;
+    const vtr::Matrix<int>& chany_occ = stats.chany_occ;
 
     VTR_LOG("\n");
     VTR_LOG("X - Directed channels:   j max occ ave occ capacity\n");
@@ -212,55 +411,6 @@ static void get_channel_occupancy_stats() {
     VTR_LOG("\n");
 }
 
-/* Loads the two arrays passed in with the total occupancy at each of the  *
- * channel segments in the FPGA.                                           */
-static void load_channel_occupancies(vtr::Matrix<int>& chanx_occ, vtr::Matrix<int>& chany_occ) {
-    int i, j, inode;
-    t_trace* tptr;
-    t_rr_type rr_type;
-
-    auto& device_ctx = g_vpr_ctx.device();
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& route_ctx = g_vpr_ctx.routing();
-
-    /* First set the occupancy of everything to zero. */
-    chanx_occ.fill(0);
-    chany_occ.fill(0);
-
-    /* Now go through each net and count the tracks and pins used everywhere */
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        /* Skip global and empty nets. */
-        if (cluster_ctx.clb_nlist.net_is_ignored(net_id) && cluster_ctx.clb_nlist.net_sinks(net_id).size() != 0)
-            continue;
-
-        tptr = route_ctx.trace[net_id].head;
-        while (tptr != nullptr) {
-            inode = tptr->index;
-            rr_type = device_ctx.rr_nodes[inode].type();
-
-            if (rr_type == SINK) {
-                tptr = tptr->next; /* Skip next segment. */
-                if (tptr == nullptr)
-                    break;
-            }
-
-            else if (rr_type == CHANX) {
-                j = device_ctx.rr_nodes[inode].ylow();
-                for (i = device_ctx.rr_nodes[inode].xlow(); i <= device_ctx.rr_nodes[inode].xhigh(); i++)
-                    chanx_occ[i][j]++;
-            }
-
-            else if (rr_type == CHANY) {
-                i = device_ctx.rr_nodes[inode].xlow();
-                for (j = device_ctx.rr_nodes[inode].ylow(); j <= device_ctx.rr_nodes[inode].yhigh(); j++)
-                    chany_occ[i][j]++;
-            }
-
-            tptr = tptr->next;
-        }
-    }
-}
-
 void get_num_bends_and_length(ClusterNetId inet, int* bends_ptr, int* len_ptr, int* segments_ptr) {
     /* Counts and returns the number of bends, wirelength, and number of routing *
      * resource segments in net inet's routing.                                  */
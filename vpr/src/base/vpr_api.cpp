@@ -13,6 +13,7 @@
 #include <chrono>
 #include <cmath>
 #include <sstream>
+#include <thread>
 
 #include "vtr_assert.h"
 #include "vtr_math.h"
@@ -20,6 +21,8 @@
 #include "vtr_version.h"
 #include "vtr_time.h"
 #include "vtr_path.h"
+#include "vtr_async_write.h"
+#include "vtr_memory.h"
 
 #include "vpr_types.h"
 #include "vpr_utils.h"
@@ -55,6 +58,7 @@
 #include "read_activity.h"
 #include "net_delay.h"
 #include "AnalysisDelayCalculator.h"
+#include "timing_graph_serdes.h"
 #include "timing_info.h"
 #include "netlist_writer.h"
 #include "net_delay.h"
@@ -72,6 +76,7 @@
 #include "read_route.h"
 #include "read_blif.h"
 #include "read_place.h"
+#include "atom_netlist_cache.h"
 
 #include "arch_util.h"
 
@@ -202,7 +207,7 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
         num_workers = tbb::task_scheduler_init::default_num_threads();
     }
 
-    VTR_LOG("Using up to %zu parallel worker(s)\n", num_workers);
+    VTR_LOG("Using up to %zu parallel worker(s) (including parallel levelized timing analysis)\n", num_workers);
     tbb_scheduler = std::make_unique<tbb::task_scheduler_init>(num_workers);
 #else
     //No parallel execution support
@@ -291,19 +296,59 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     /* flush any messages to user still in stdout that hasn't gotten displayed */
     fflush(stdout);
 
+    /* Read in the circuit and build per-circuit state */
+    vpr_load_circuit(options, vpr_setup);
+
+    fflush(stdout);
+
+    ShowSetup(*vpr_setup);
+}
+
+/* Reads in the circuit (from cache or by elaboration) and builds the
+ * per-circuit state (power activity, timing graph and constraints).
+ *
+ * Called as part of vpr_init(); in library mode it is called directly to
+ * load each subsequent circuit (see vpr_free_circuit_state()). */
+void vpr_load_circuit(const t_options* options, t_vpr_setup* vpr_setup) {
     /* Read blif file and sweep unused components */
     auto& atom_ctx = g_vpr_ctx.mutable_atom();
-    atom_ctx.nlist = read_and_process_circuit(options->circuit_format,
-                                              vpr_setup->PackerOpts.blif_file_name.c_str(),
-                                              vpr_setup->user_models,
-                                              vpr_setup->library_models,
-                                              vpr_setup->NetlistOpts.const_gen_inference,
-                                              vpr_setup->NetlistOpts.absorb_buffer_luts,
-                                              vpr_setup->NetlistOpts.sweep_dangling_primary_ios,
-                                              vpr_setup->NetlistOpts.sweep_dangling_nets,
-                                              vpr_setup->NetlistOpts.sweep_dangling_blocks,
-                                              vpr_setup->NetlistOpts.sweep_constant_primary_outputs,
-                                              vpr_setup->NetlistOpts.netlist_verbosity);
+
+    std::string atom_netlist_cache_file = options->atom_netlist_cache_file;
+    std::string cache_key;
+    bool loaded_from_cache = false;
+    if (!atom_netlist_cache_file.empty()) {
+        cache_key = atom_netlist_cache_key(options->circuit_format,
+                                           vpr_setup->PackerOpts.blif_file_name.c_str(),
+                                           vpr_setup->NetlistOpts);
+        loaded_from_cache = try_load_atom_netlist_cache(atom_netlist_cache_file.c_str(),
+                                                        cache_key,
+                                                        vpr_setup->user_models,
+                                                        vpr_setup->library_models,
+                                                        atom_ctx.nlist);
+        if (loaded_from_cache) {
+            VTR_LOG("Loaded atom netlist from cache '%s'\n", atom_netlist_cache_file.c_str());
+        }
+    }
+
+    if (!loaded_from_cache) {
+        atom_ctx.nlist = read_and_process_circuit(options->circuit_format,
+                                                  vpr_setup->PackerOpts.blif_file_name.c_str(),
+                                                  vpr_setup->user_models,
+                                                  vpr_setup->library_models,
+                                                  vpr_setup->NetlistOpts.const_gen_inference,
+                                                  vpr_setup->NetlistOpts.absorb_buffer_luts,
+                                                  vpr_setup->NetlistOpts.sweep_dangling_primary_ios,
+                                                  vpr_setup->NetlistOpts.sweep_dangling_nets,
+                                                  vpr_setup->NetlistOpts.sweep_dangling_blocks,
+                                                  vpr_setup->NetlistOpts.sweep_constant_primary_outputs,
+                                                  vpr_setup->NetlistOpts.netlist_verbosity);
+
+        if (!atom_netlist_cache_file.empty()) {
+            save_atom_netlist_cache(atom_netlist_cache_file.c_str(), cache_key, atom_ctx.nlist);
+        }
+    }
+
+    vtr::memory_usage::report("atom_netlist", atom_ctx.nlist.memory_footprint());
 
     if (vpr_setup->PowerOpts.do_power) {
         //Load the net activity file for power estimation
@@ -330,10 +375,6 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
             timing_ctx.constraints = read_sdc(vpr_setup->Timing, atom_ctx.nlist, atom_ctx.lookup, *timing_ctx.graph);
         }
     }
-
-    fflush(stdout);
-
-    ShowSetup(*vpr_setup);
 }
 
 bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
@@ -349,8 +390,10 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
             return false; //Unimplementable
         }
     }
+    vtr::memory_usage::print_report("after packing");
 
     vpr_create_device(vpr_setup, arch);
+    vtr::memory_usage::print_report("after device creation");
 
     vpr_init_graphics(vpr_setup, arch);
     { //Place
@@ -361,15 +404,23 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
             return false; //Unimplementable
         }
     }
+    vtr::memory_usage::print_report("after placement");
+
     RouteStatus route_status;
     { //Route
         route_status = vpr_route_flow(vpr_setup, arch);
     }
+    vtr::memory_usage::print_report("after routing");
+
     { //Analysis
         vpr_analysis_flow(vpr_setup, arch, route_status);
     }
     vpr_close_graphics(vpr_setup);
 
+    //Ensure any output files queued on the background writer are on disk
+    //before reporting the flow complete
+    vtr::flush_async_writes();
+
     return route_status.success();
 }
 
@@ -461,15 +512,24 @@ bool vpr_pack_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
         //pass
     } else {
         if (packer_opts.doPacking == STAGE_DO) {
-            //Do the actual packing
-            status = vpr_pack(vpr_setup, arch);
+            if (packer_opts.reuse_prev_packing
+                && net_file_matches_netlist(vpr_setup.FileNameOpts.NetFile.c_str(), &arch)) {
+                //ECO fast path: the existing .net file was generated from an identical
+                //atom netlist and architecture, so the previous clustering is still valid
+                VTR_LOG("Re-using existing packing '%s' (atom netlist and architecture unchanged).\n",
+                        vpr_setup.FileNameOpts.NetFile.c_str());
+                vpr_load_packing(vpr_setup, arch);
+            } else {
+                //Do the actual packing
+                status = vpr_pack(vpr_setup, arch);
 
-            //TODO: to be consistent with placement/routing vpr_pack should really
-            //      load the netlist data structures itself, instead of re-loading
-            //      the netlist from the .net file
+                //TODO: to be consistent with placement/routing vpr_pack should really
+                //      load the netlist data structures itself, instead of re-loading
+                //      the netlist from the .net file
 
-            //Load the result from the .net file
-            vpr_load_packing(vpr_setup, arch);
+                //Load the result from the .net file
+                vpr_load_packing(vpr_setup, arch);
+            }
         } else {
             VTR_ASSERT(packer_opts.doPacking == STAGE_LOAD);
             //Load a previous packing from the .net file
@@ -555,12 +615,20 @@ void vpr_load_packing(t_vpr_setup& vpr_setup, const t_arch& arch) {
                                          vpr_setup.FileNameOpts.verify_file_digests,
                                          vpr_setup.PackerOpts.pack_verbosity);
 
+    if (isEchoFileEnabled(E_ECHO_PACKED_NETLIST_BIN)) {
+        //Write out a binary copy of the packing, which later runs can load
+        //via --net_file far faster than the .net XML
+        write_packed_netlist_bin(getEchoFileName(E_ECHO_PACKED_NETLIST_BIN), &arch, cluster_ctx.clb_nlist);
+    }
+
     process_constant_nets(cluster_ctx.clb_nlist, vpr_setup.constant_net_method, vpr_setup.PackerOpts.pack_verbosity);
 
     {
         std::ofstream ofs("packing_pin_util.rpt");
         report_packing_pin_usage(ofs, g_vpr_ctx);
     }
+
+    vtr::memory_usage::report("clustered_netlist", cluster_ctx.clb_nlist.memory_footprint());
 }
 
 bool vpr_place_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
@@ -573,15 +641,31 @@ bool vpr_place_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
             //Do the actual placement
             vpr_place(vpr_setup, arch);
 
+            //Write the resulting .place file concurrently with the grid/pin
+            //re-synchronization below: the writer only reads the block
+            //locations and names (and computes the placement digest), while
+            //the sync passes rebuild grid_blocks and the physical pin
+            //mappings, so the two do not touch the same state
+            const auto& filename_opts = vpr_setup.FileNameOpts;
+            const auto& cluster_ctx = g_vpr_ctx.clustering();
+            std::thread place_file_writer(print_place,
+                                          filename_opts.NetFile.c_str(),
+                                          cluster_ctx.clb_nlist.netlist_id().c_str(),
+                                          filename_opts.PlaceFile.c_str());
+
+            sync_grid_to_blocks();
+            post_place_sync();
+
+            place_file_writer.join();
         } else {
             VTR_ASSERT(placer_opts.doPlacement == STAGE_LOAD);
 
             //Load a previous placement
             vpr_load_placement(vpr_setup, arch);
-        }
 
-        sync_grid_to_blocks();
-        post_place_sync();
+            sync_grid_to_blocks();
+            post_place_sync();
+        }
     }
 
     return true;
@@ -600,12 +684,8 @@ void vpr_place(t_vpr_setup& vpr_setup, const t_arch& arch) {
               arch.Directs,
               arch.num_directs);
 
-    auto& filename_opts = vpr_setup.FileNameOpts;
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-
-    print_place(filename_opts.NetFile.c_str(),
-                cluster_ctx.clb_nlist.netlist_id().c_str(),
-                filename_opts.PlaceFile.c_str());
+    //Note: the .place file is written by vpr_place_flow() (overlapped with
+    //the post-placement grid re-synchronization)
 }
 
 void vpr_load_placement(t_vpr_setup& vpr_setup, const t_arch& arch) {
@@ -674,7 +754,7 @@ RouteStatus vpr_route_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
         std::string graphics_msg;
         if (route_status.success()) {
             //Sanity check the routing
-            check_route(router_opts.route_type);
+            check_route(router_opts.route_type, router_opts.router_num_workers);
             get_serial_num();
 
             //Update status
@@ -817,6 +897,19 @@ void vpr_create_rr_graph(t_vpr_setup& vpr_setup, const t_arch& arch, int chan_wi
         graph_type = (det_routing_arch->directionality == BI_DIRECTIONAL ? GRAPH_BIDIR : GRAPH_UNIDIR);
     }
 
+    //Re-use the resident RR graph if it was built for the same device and
+    //channel width (e.g. when processing multiple circuits in library mode);
+    //RR graph construction is a dominant fixed cost on large devices
+    if (!device_ctx.rr_nodes.empty()
+        && device_ctx.rr_graph_chan_width_fac == chan_width_fac
+        && device_ctx.rr_graph_type == int(graph_type)
+        && device_ctx.rr_graph_grid_width == device_ctx.grid.width()
+        && device_ctx.rr_graph_grid_height == device_ctx.grid.height()) {
+        VTR_LOG("Re-using existing RR graph (channel width factor %d)\n", chan_width_fac);
+        init_draw_coords(chan_width_fac);
+        return;
+    }
+
     int warnings = 0;
 
     //Clean-up any previous RR graph
@@ -835,7 +928,15 @@ void vpr_create_rr_graph(t_vpr_setup& vpr_setup, const t_arch& arch, int chan_wi
                     router_opts.trim_obs_channels,
                     router_opts.clock_modeling,
                     arch.Directs, arch.num_directs,
+                    router_opts.router_num_workers,
                     &warnings);
+
+    //Record what the graph was built with, so it can be re-used
+    device_ctx.rr_graph_chan_width_fac = chan_width_fac;
+    device_ctx.rr_graph_type = int(graph_type);
+    device_ctx.rr_graph_grid_width = device_ctx.grid.width();
+    device_ctx.rr_graph_grid_height = device_ctx.grid.height();
+
     //Initialize drawing, now that we have an RR graph
     init_draw_coords(chan_width_fac);
 }
@@ -1007,8 +1108,41 @@ static void free_routing() {
     routing_ctx.route_bb.clear();
 }
 
+/* Frees the per-circuit state (atom netlist, packing, placement, routing,
+ * timing and power activity) while leaving the architecture and device
+ * state (grid, block types, resident RR graph) untouched.
+ *
+ * This enables a 'library mode' where a single process runs several circuits
+ * sequentially against the same device:
+ *
+ *     vpr_init(argc, argv, &options, &vpr_setup, &arch); //First circuit
+ *     vpr_flow(vpr_setup, arch);
+ *
+ *     vpr_free_circuit_state();
+ *     //...update the circuit/output file names in vpr_setup...
+ *     vpr_load_circuit(&options, &vpr_setup); //Subsequent circuits
+ *     vpr_flow(vpr_setup, arch);
+ *
+ * The fixed costs of parsing the architecture and building the RR graph are
+ * then paid once and amortized across the batch (see vpr_create_rr_graph()). */
+void vpr_free_circuit_state() {
+    free_circuit();
+    free_placement();
+    free_routing();
+    free_atoms();
+
+    auto& timing_ctx = g_vpr_ctx.mutable_timing();
+    timing_ctx.graph = nullptr;
+    timing_ctx.constraints = nullptr;
+
+    auto& power_ctx = g_vpr_ctx.mutable_power();
+    power_ctx.atom_net_power.clear();
+}
+
 void vpr_free_vpr_data_structures(t_arch& Arch,
                                   t_vpr_setup& vpr_setup) {
+    vtr::flush_async_writes(); //Complete any outstanding output file writes
+
     free_all_lb_type_rr_graph(vpr_setup.PackerRRGraph);
     free_circuit();
     free_arch(&Arch);
@@ -1017,6 +1151,7 @@ void vpr_free_vpr_data_structures(t_arch& Arch,
     free_placement();
     free_routing();
     free_atoms();
+    free_pb_stats_pool();
 }
 
 void vpr_free_all(t_arch& Arch,
@@ -1166,6 +1301,14 @@ void vpr_analysis(t_vpr_setup& vpr_setup, const t_arch& Arch, const RouteStatus&
                               *timing_ctx.graph, *timing_ctx.constraints, *analysis_delay_calc, timing_info->analyzer());
         }
 
+        if (isEchoFileEnabled(E_ECHO_ANALYSIS_TIMING_GRAPH_SNAPSHOT)) {
+            //Binary snapshot of the timing graph, constraints and delays for
+            //offline re-analysis (see utils/timing_reanalysis)
+            auto& timing_ctx = g_vpr_ctx.timing();
+            write_timing_graph_snapshot(getEchoFileName(E_ECHO_ANALYSIS_TIMING_GRAPH_SNAPSHOT),
+                                        *timing_ctx.graph, *timing_ctx.constraints, *analysis_delay_calc);
+        }
+
         //Timing stats
         VTR_LOG("\n");
         generate_hold_timing_stats(/*prefix=*/"", *timing_info,
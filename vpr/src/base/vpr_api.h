@@ -47,6 +47,13 @@ void vpr_init(const int argc, const char** argv, t_options* options, t_vpr_setup
 void vpr_initialize_logging();
 void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_arch* arch);
 
+//Library mode: after an initial vpr_init()/vpr_flow(), additional circuits can be
+//run against the already-loaded architecture and device by calling
+//vpr_free_circuit_state(), updating the circuit/output file names in vpr_setup,
+//then calling vpr_load_circuit() and vpr_flow() again
+void vpr_load_circuit(const t_options* options, t_vpr_setup* vpr_setup); //Load a circuit and build the per-circuit state
+void vpr_free_circuit_state();                                           //Free per-circuit state, leaving the device resident
+
 bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch); //Run the VPR CAD flow
 
 /*
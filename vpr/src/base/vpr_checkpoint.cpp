@@ -0,0 +1,18 @@
+#include "vpr_checkpoint.h"
+
+CheckpointScheduler::CheckpointScheduler(float interval_sec)
+    : interval_sec_(interval_sec)
+    , last_(clock::now()) {}
+
+bool CheckpointScheduler::due() const {
+    if (interval_sec_ <= 0.) {
+        return true;
+    }
+
+    float elapsed_sec = std::chrono::duration<float>(clock::now() - last_).count();
+    return elapsed_sec >= interval_sec_;
+}
+
+void CheckpointScheduler::mark() {
+    last_ = clock::now();
+}
@@ -0,0 +1,34 @@
+#ifndef VPR_CHECKPOINT_H
+#define VPR_CHECKPOINT_H
+#include <chrono>
+
+/*
+ * Periodic checkpoint scheduling
+ *
+ * The placer and router can checkpoint their in-progress state at safe
+ * iteration boundaries (see --place_checkpoint_file/--route_checkpoint_file),
+ * so a preempted or killed job can be resumed rather than restarted. A
+ * CheckpointScheduler rate-limits those writes to at most one per
+ * --checkpoint_interval seconds, keeping the checkpoint overhead negligible
+ * on large designs whose iterations are short relative to the interval.
+ */
+class CheckpointScheduler {
+  public:
+    //interval_sec <= 0 means a checkpoint is due at every opportunity
+    explicit CheckpointScheduler(float interval_sec);
+
+    //Returns true if at least interval_sec has elapsed since the last mark()
+    //(or since construction, for the first checkpoint)
+    bool due() const;
+
+    //Records that a checkpoint was just written
+    void mark();
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    float interval_sec_;
+    std::chrono::time_point<clock> last_;
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "vpr_types.h"
+#include "vtr_lru_cache.h"
 #include "vtr_ndmatrix.h"
 #include "vtr_vector.h"
 #include "atom_netlist.h"
@@ -199,6 +200,14 @@ struct DeviceContext : public Context {
     // Name of rrgraph file read (if any).
     // Used to determine when reading rrgraph if file is already loaded.
     std::string read_rr_graph_filename;
+
+    // Parameters the resident RR graph was built with (invalid until a graph
+    // has been built). Used to re-use the graph across circuits in library
+    // mode (see vpr_create_rr_graph()).
+    int rr_graph_chan_width_fac = -1;
+    int rr_graph_type = -1;
+    size_t rr_graph_grid_width = 0;
+    size_t rr_graph_grid_height = 0;
 };
 
 //State relating to power analysis
@@ -217,7 +226,7 @@ struct PowerContext : public Context {
     vtr::vector<ClusterNetId, t_net_power> clb_net_power;
 
     /* Atom net power info */
-    std::unordered_map<AtomNetId, t_net_power> atom_net_power;
+    vtr::vector<AtomNetId, t_net_power> atom_net_power;
     t_power_components by_component;
 };
 
@@ -242,7 +251,7 @@ struct PlacementContext : public Context {
     vtr::vector_map<ClusterBlockId, t_block_loc> block_locs;
 
     //Clustered block associated with each grid location (i.e. inverse of block_locs)
-    vtr::Matrix<t_grid_blocks> grid_blocks; //[0..device_ctx.grid.width()-1][0..device_ctx.grid.width()-1]
+    GridBlocks grid_blocks; //Flat (x, y, subtile) occupancy with maintained per-tile usage counters
 
     // The pl_macros array stores all the placement macros (usually carry chains).
     std::vector<t_pl_macro> pl_macros;
@@ -282,12 +291,16 @@ struct RoutingContext : public Context {
     //SHA256 digest of the .route file (used for unique identification and consistency checking)
     std::string routing_id;
 
-    // Cache of router lookahead object.
+    // Cache of router lookahead objects.
     //
     // Cache key: (lookahead type, read lookahead (if any), segment definitions).
-    vtr::Cache<std::tuple<e_router_lookahead, std::string, std::vector<t_segment_inf>>,
-               RouterLookahead>
-        cached_router_lookahead_;
+    //
+    // Multiple entries are retained so alternating requests (e.g. the
+    // placement delay lookahead and the routing lookahead) do not force the
+    // expensive lookahead computation to be redone.
+    vtr::LruCache<std::tuple<e_router_lookahead, std::string, std::vector<t_segment_inf>>,
+                  RouterLookahead>
+        cached_router_lookahead_{4};
 };
 
 //This object encapsulates VPR's state. There is typically a single instance which is
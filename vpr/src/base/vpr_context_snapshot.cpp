@@ -0,0 +1,61 @@
+#include "vpr_context_snapshot.h"
+
+#include "vtr_assert.h"
+
+#include "globals.h"
+
+std::shared_ptr<const t_placement_state> snapshot_placement_state() {
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    auto snapshot = std::make_shared<t_placement_state>();
+    snapshot->block_locs = place_ctx.block_locs;
+    snapshot->grid_blocks = place_ctx.grid_blocks;
+    snapshot->pl_macros = place_ctx.pl_macros;
+    snapshot->compressed_block_grids = place_ctx.compressed_block_grids;
+    snapshot->placement_id = place_ctx.placement_id;
+
+    return snapshot;
+}
+
+void restore_placement_state(const std::shared_ptr<const t_placement_state>& snapshot) {
+    VTR_ASSERT(snapshot);
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    place_ctx.block_locs = snapshot->block_locs;
+    place_ctx.grid_blocks = snapshot->grid_blocks;
+    place_ctx.pl_macros = snapshot->pl_macros;
+    place_ctx.compressed_block_grids = snapshot->compressed_block_grids;
+    place_ctx.placement_id = snapshot->placement_id;
+}
+
+std::shared_ptr<const t_routing_state> snapshot_routing_state() {
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    auto snapshot = std::make_shared<t_routing_state>();
+    snapshot->trace = route_ctx.trace;
+    snapshot->trace_nodes = route_ctx.trace_nodes;
+    snapshot->net_rr_terminals = route_ctx.net_rr_terminals;
+    snapshot->rr_blk_source = route_ctx.rr_blk_source;
+    snapshot->rr_node_route_inf = route_ctx.rr_node_route_inf;
+    snapshot->net_status = route_ctx.net_status;
+    snapshot->route_bb = route_ctx.route_bb;
+    snapshot->clb_opins_used_locally = route_ctx.clb_opins_used_locally;
+    snapshot->routing_id = route_ctx.routing_id;
+
+    return snapshot;
+}
+
+void restore_routing_state(const std::shared_ptr<const t_routing_state>& snapshot) {
+    VTR_ASSERT(snapshot);
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    route_ctx.trace = snapshot->trace;
+    route_ctx.trace_nodes = snapshot->trace_nodes;
+    route_ctx.net_rr_terminals = snapshot->net_rr_terminals;
+    route_ctx.rr_blk_source = snapshot->rr_blk_source;
+    route_ctx.rr_node_route_inf = snapshot->rr_node_route_inf;
+    route_ctx.net_status = snapshot->net_status;
+    route_ctx.route_bb = snapshot->route_bb;
+    route_ctx.clb_opins_used_locally = snapshot->clb_opins_used_locally;
+    route_ctx.routing_id = snapshot->routing_id;
+}
@@ -0,0 +1,68 @@
+#ifndef VPR_CONTEXT_SNAPSHOT_H
+#define VPR_CONTEXT_SNAPSHOT_H
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vpr_context.h"
+
+/*
+ * Snapshot and restore of individual VPR sub-contexts
+ *
+ * The sub-contexts of VprContext are deliberately non-copyable, so flows
+ * which want to re-try a stage with different options (e.g. several routing
+ * experiments forked from one long placement) previously required a full
+ * process restart. These helpers capture the stage-defining state of a
+ * sub-context into an immutable snapshot which can later be written back.
+ *
+ * Snapshot handles are cheap to copy and share their underlying arrays
+ * (the state is copied only when a snapshot is taken and when one is
+ * restored into the live context), so a harness can hold many experiment
+ * snapshots without duplicating the big arrays.
+ *
+ * Typical usage:
+ *
+ *     vpr_place_flow(vpr_setup, arch);
+ *     auto placement = snapshot_placement_state();
+ *     for (...each routing experiment...) {
+ *         restore_placement_state(placement);
+ *         //...adjust vpr_setup.RouterOpts...
+ *         vpr_route_flow(vpr_setup, arch);
+ *     }
+ */
+
+//The placement-defining state of PlacementContext
+struct t_placement_state {
+    vtr::vector_map<ClusterBlockId, t_block_loc> block_locs;
+    GridBlocks grid_blocks;
+    std::vector<t_pl_macro> pl_macros;
+    t_compressed_block_grids compressed_block_grids;
+    std::string placement_id;
+};
+
+//The routing-defining state of RoutingContext
+struct t_routing_state {
+    vtr::vector<ClusterNetId, t_traceback> trace;
+    vtr::vector<ClusterNetId, std::unordered_set<int>> trace_nodes;
+    vtr::vector<ClusterNetId, std::vector<int>> net_rr_terminals;
+    vtr::vector<ClusterBlockId, std::vector<int>> rr_blk_source;
+    std::vector<t_rr_node_route_inf> rr_node_route_inf;
+    vtr::vector<ClusterNetId, t_net_routing_status> net_status;
+    vtr::vector<ClusterNetId, t_bb> route_bb;
+    t_clb_opins_used clb_opins_used_locally;
+    std::string routing_id;
+};
+
+//Captures the current placement state of g_vpr_ctx
+std::shared_ptr<const t_placement_state> snapshot_placement_state();
+
+//Writes a previously captured placement state back into g_vpr_ctx
+void restore_placement_state(const std::shared_ptr<const t_placement_state>& snapshot);
+
+//Captures the current routing state of g_vpr_ctx
+std::shared_ptr<const t_routing_state> snapshot_routing_state();
+
+//Writes a previously captured routing state back into g_vpr_ctx
+void restore_routing_state(const std::shared_ptr<const t_routing_state>& snapshot);
+
+#endif
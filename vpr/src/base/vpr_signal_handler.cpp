@@ -9,6 +9,7 @@
  */
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_async_write.h"
 
 #include "vpr_signal_handler.h"
 #include "vpr_exit_codes.h"
@@ -94,4 +95,8 @@ void checkpoint() {
     std::string router_checkpoint_file = "router_checkpoint.route";
     VTR_LOG("Attempting to checkpoint current routing to file: %s\n", router_checkpoint_file.c_str());
     print_route(nullptr, router_checkpoint_file.c_str());
+
+    //The process may be about to terminate, so ensure the checkpoint files
+    //actually reach disk rather than remaining queued on the background writer
+    vtr::flush_async_writes();
 }
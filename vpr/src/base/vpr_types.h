@@ -78,7 +78,7 @@ enum class ScreenUpdatePriority {
 
 #define FIRST_ITER_WIRELENTH_LIMIT 0.85 /* If used wirelength exceeds this value in first iteration of routing, do not route */
 
-/* Defining macros for the placement_ctx t_grid_blocks. Assumes that ClusterBlockId's won't exceed positive 32-bit integers */
+/* Defining macros for the placement_ctx GridBlocks. Assumes that ClusterBlockId's won't exceed positive 32-bit integers */
 constexpr auto EMPTY_BLOCK_ID = ClusterBlockId(-1);
 constexpr auto INVALID_BLOCK_ID = ClusterBlockId(-2);
 
@@ -284,6 +284,9 @@ class t_pb {
     //logically equivalent pins
     void set_atom_pin_bit_index(const t_pb_graph_pin* gpin, BitIndex atom_pin_bit_idx);
 
+    //Returns the full pin rotation mapping (empty if no pins were rotated)
+    const std::map<const t_pb_graph_pin*, BitIndex>& pin_rotations() const { return pin_rotations_; }
+
   private:
     std::map<const t_pb_graph_pin*, BitIndex> pin_rotations_; //Contains the atom netlist port bit index associated
                                                               //with any primitive pins which have been rotated during clustering
@@ -376,6 +379,9 @@ struct t_cluster_placement_stats {
     bool has_long_chain;                              /* specifies if this cluster has a molecule placed in it that belongs to a long chain (a chain that spans more than one cluster) */
     const t_pack_molecule* curr_molecule;             /* current molecule being considered for packing */
     t_cluster_placement_primitive** valid_primitives; /* [0..num_pb_types-1] ptrs to linked list of valid primitives, for convenience, each linked list head is empty */
+    int* num_avail_primitives;                        /* [0..num_pb_types-1] number of primitives currently queued in valid_primitives[i].
+                                                       * Includes primitives flagged invalid but not yet lazily removed, so this is an
+                                                       * upper bound on true availability; used for fast molecule feasibility prechecks */
     t_cluster_placement_primitive* in_flight;         /* ptrs to primitives currently being considered */
     t_cluster_placement_primitive* tried;             /* ptrs to primitives that are open but current logic block unable to pack to */
     t_cluster_placement_primitive* invalid;           /* ptrs to primitives that are invalid */
@@ -403,6 +409,7 @@ struct t_timing_inf {
 /* Timing data structures end */
 enum sched_type {
     AUTO_SCHED,
+    ADAPTIVE_SCHED,
     USER_SCHED
 };
 /* Annealing schedule */
@@ -634,13 +641,94 @@ struct t_block_loc {
     bool nets_and_pins_synced_to_z_coordinate = false;
 };
 
-/* Stores the clustered blocks placed at a particular grid location */
-struct t_grid_blocks {
-    //How many valid blocks are in use at this location
-    int usage;
+/* Stores the clustered blocks placed at each grid location.
+ *
+ * The occupancy is held in a single flat array indexed by (x, y, subtile)
+ * rather than per-tile heap-allocated vectors, keeping the placer's frequent
+ * occupancy look-ups (e.g. try_swap, initial placement) cache friendly.
+ * Every tile is given subtile_capacity() slots (the device-wide maximum
+ * capacity); slots beyond a tile's real capacity are never written.
+ *
+ * The per-tile usage counters are maintained incrementally by
+ * set_block_at_location(), so they can not drift from the stored blocks. */
+class GridBlocks {
+  public:
+    //(Re-)sizes the grid to width-by-height tiles of subtile_capacity slots
+    //each, marking all slots empty
+    void init_grid(size_t width, size_t height, size_t subtile_capacity) {
+        width_ = width;
+        height_ = height;
+        subtile_capacity_ = subtile_capacity;
+        blocks_.assign(width * height * subtile_capacity, EMPTY_BLOCK_ID);
+        usage_.assign(width * height, 0);
+    }
+
+    //Returns the block occupying subtile z of tile (x, y)
+    ClusterBlockId block_at_location(int x, int y, int z) const {
+        return blocks_[block_index(x, y, z)];
+    }
+
+    ClusterBlockId block_at_location(const t_pl_loc& loc) const {
+        return block_at_location(loc.x, loc.y, loc.z);
+    }
+
+    //Records blk_id as occupying subtile z of tile (x, y), incrementally
+    //updating the tile's usage counter
+    void set_block_at_location(int x, int y, int z, ClusterBlockId blk_id) {
+        ClusterBlockId& slot = blocks_[block_index(x, y, z)];
+        usage_[tile_index(x, y)] += is_occupied(blk_id) - is_occupied(slot);
+        slot = blk_id;
+    }
+
+    void set_block_at_location(const t_pl_loc& loc, ClusterBlockId blk_id) {
+        set_block_at_location(loc.x, loc.y, loc.z, blk_id);
+    }
+
+    //Number of valid blocks at tile (x, y)
+    int usage(int x, int y) const {
+        return usage_[tile_index(x, y)];
+    }
+
+    //Number of subtile slots stored per tile (the device-wide maximum capacity)
+    size_t subtile_capacity() const { return subtile_capacity_; }
+
+    //Marks every existing (i.e. non-INVALID_BLOCK_ID) slot empty
+    void clear_occupancy() {
+        for (ClusterBlockId& slot : blocks_) {
+            if (slot != INVALID_BLOCK_ID) {
+                slot = EMPTY_BLOCK_ID;
+            }
+        }
+        usage_.assign(usage_.size(), 0);
+    }
+
+    //Releases all storage
+    void clear() {
+        blocks_ = std::vector<ClusterBlockId>();
+        usage_ = std::vector<int>();
+        width_ = height_ = subtile_capacity_ = 0;
+    }
+
+  private:
+    static int is_occupied(ClusterBlockId blk_id) {
+        return (blk_id != EMPTY_BLOCK_ID && blk_id != INVALID_BLOCK_ID) ? 1 : 0;
+    }
 
-    //The clustered blocks associated with this grid location
-    std::vector<ClusterBlockId> blocks;
+    size_t tile_index(int x, int y) const {
+        VTR_ASSERT_SAFE(size_t(x) < width_ && size_t(y) < height_);
+        return x * height_ + y;
+    }
+
+    size_t block_index(int x, int y, int z) const {
+        VTR_ASSERT_SAFE(size_t(z) < subtile_capacity_);
+        return tile_index(x, y) * subtile_capacity_ + z;
+    }
+
+    std::vector<ClusterBlockId> blocks_; //[(x * height + y) * subtile_capacity + z]
+    std::vector<int> usage_;             //[x * height + y] Valid blocks at each tile
+    size_t width_ = 0;
+    size_t height_ = 0;
+    size_t subtile_capacity_ = 0;
 };
 
 /* Names of various files */
@@ -708,16 +796,18 @@ struct t_packer_opts {
     std::vector<std::string> high_fanout_threshold;
     int transitive_fanout_threshold;
     int feasible_block_array_size;
+    bool reuse_prev_packing;
     e_stage_action doPacking;
     enum e_packer_algorithm packer_algorithm;
     std::string device_layout;
 };
 
-/* Annealing schedule information for the placer.  The schedule type      *
- * is either USER_SCHED or AUTO_SCHED.  Inner_num is multiplied by        *
- * num_blocks^4/3 to find the number of moves per temperature.  The       *
- * remaining information is used only for USER_SCHED, and have the        *
- * obvious meanings.                                                      */
+/* Annealing schedule information for the placer.  The schedule type is   *
+ * USER_SCHED, AUTO_SCHED or ADAPTIVE_SCHED (temperature decrements and   *
+ * per-temperature move counts driven by measured cost statistics).       *
+ * Inner_num is multiplied by num_blocks^4/3 to find the number of moves  *
+ * per temperature.  The remaining information is used only for           *
+ * USER_SCHED, and have the obvious meanings.                             */
 struct t_annealing_sched {
     enum sched_type type;
     float inner_num;
@@ -792,6 +882,11 @@ struct t_placer_opts {
     e_stage_action doPlacement;
     float rlim_escape_fraction;
     std::string move_stats_file;
+    std::string temperature_stats_file;
+    bool enable_analytic_placer;
+    std::string read_initial_place_file;
+    std::string place_checkpoint_file; //Periodic in-progress placement snapshot ("" disables)
+    float checkpoint_interval;         //Minimum seconds between checkpoint writes (<= 0: every opportunity)
 
     PlaceDelayModelType delay_model_type;
     e_reducer delay_model_reducer;
@@ -831,7 +926,9 @@ struct t_placer_opts {
  *                up.                                                       *
  * min_incremental_reroute_fanout: Minimum fanout a net needs to have 		*
  *				for incremental reroute to be applied to it through route 	*
- *				tree pruning. Larger circuits should get larger thresholds	*
+ *				tree pruning. Defaults to all multi-sink nets, so only the	*
+ *				congested or timing-degraded connections of a net are 		*
+ *				ripped up and re-routed each iteration						*
  * bb_factor:  Linear distance a route can go outside the net bounding      *
  *             box.                                                         *
  * route_type:  GLOBAL or DETAILED.                                         *
@@ -873,6 +970,14 @@ enum e_router_algorithm {
     TIMING_DRIVEN,
 };
 
+/* Which priority queue implementation the router's wavefront expansion uses.
+ * The 4-ary heap touches fewer cache lines per sift than the classic binary
+ * heap, which matters on large RR graphs where heap operations dominate. */
+enum class e_heap_type {
+    BINARY_HEAP,
+    FOUR_ARY_HEAP,
+};
+
 enum e_base_cost_type {
     DELAY_NORMALIZED,
     DELAY_NORMALIZED_LENGTH,
@@ -911,6 +1016,7 @@ struct t_router_opts {
     float initial_pres_fac;
     float pres_fac_mult;
     float acc_fac;
+    bool adaptive_pres_fac; //Shape pres_fac growth and acc_fac from the congestion distribution each iteration
     float bend_cost;
     int max_router_iterations;
     int min_incremental_reroute_fanout;
@@ -918,10 +1024,13 @@ struct t_router_opts {
     int bb_factor;
     enum e_route_type route_type;
     int fixed_channel_width;
-    int min_channel_width_hint; //Hint to binary search of what the minimum channel width is
+    int min_channel_width_hint;   //Hint to binary search of what the minimum channel width is
+    int speculative_width_probes; //Max concurrent probes in the minimum channel width search (1 = serial)
     bool trim_empty_channels;
     bool trim_obs_channels;
     enum e_router_algorithm router_algorithm;
+    e_heap_type router_heap;
+    int router_num_workers;
     enum e_base_cost_type base_cost_type;
     float astar_fac;
     float max_criticality;
@@ -936,6 +1045,12 @@ struct t_router_opts {
     enum e_routing_failure_predictor routing_failure_predictor;
     enum e_routing_budgets_algorithm routing_budgets_algorithm;
     bool save_routing_per_iteration;
+    std::string route_checkpoint_file;  //Binary routing checkpoint written periodically ("" disables)
+    bool route_resume;                  //Restore the routing state from route_checkpoint_file before routing
+    float checkpoint_interval;          //Minimum seconds between checkpoint writes (<= 0: every iteration)
+    std::string router_telemetry_file;  //Per-iteration router telemetry JSON ("" disables)
+    std::string connection_trace_file;  //Records connection-search inputs for later replay ("" disables)
+    std::string route_replay_file;      //Connection trace to re-execute instead of routing ("" disables)
     float congested_routing_iteration_threshold_frac;
     e_route_bb_update route_bb_update;
     enum e_clock_modeling clock_modeling; //How clock pins and nets should be handled
@@ -1131,7 +1246,17 @@ struct t_linked_f_pointer {
     float* fptr;
 };
 
-typedef std::vector<std::vector<std::vector<std::vector<std::vector<int>>>>> t_rr_node_indices; //[0..num_rr_types-1][0..grid_width-1][0..grid_height-1][0..NUM_SIDES-1][0..max_ptc-1]
+//Fast look-up from (rr_type, x, y, side, ptc) to RR node index.
+//
+//The type/x/y/side dimensions are flattened into a dense matrix per RR type
+//(so a look-up is a single computed load, and we avoid the per-vector
+//bookkeeping a fully nested structure would pay at every level); only the
+//ragged ptc dimension remains a vector, since the number of ptcs varies
+//per location (e.g. with tile type and channel width).
+//
+//Note the x/y dimensions of the CHANX matrix are transposed (i.e. indexed
+//[y][x]) to match the channel/segment convention.
+typedef std::vector<vtr::NdMatrix<std::vector<int>, 3>> t_rr_node_indices; //[0..num_rr_types-1][0..grid_width-1][0..grid_height-1][0..NUM_SIDES-1][0..max_ptc-1]
 
 /* Type of a routing resource node.  x-directed channel segment,   *
  * y-directed channel segment, input pin to a clb to pad, output   *
@@ -1182,6 +1307,13 @@ struct t_trace {
  *             is being used.                                               *
  * backward_path_cost:  Total cost of the path up to and including this     *
  *                      node.  Not used by breadth-first router.            *
+ * path_search_epoch:  Epoch (generation) stamp for path_cost and           *
+ *                     backward_path_cost.  Entries whose stamp does not    *
+ *                     match the current path search epoch are treated as   *
+ *                     having infinite path costs, so starting a new        *
+ *                     connection search is O(1) instead of requiring the   *
+ *                     touched entries to be rewritten (see                 *
+ *                     reset_path_costs() in route_common.cpp).             *
  * target_flag:  Is this node a target (sink) for the current routing?      *
  *               Number of times this node must be reached to fully route.  *
  * occ:        The current occupancy of the associated rr node              */
@@ -1193,6 +1325,7 @@ struct t_rr_node_route_inf {
     float acc_cost;
     float path_cost;
     float backward_path_cost;
+    uint32_t path_search_epoch = 0;
 
     short target_flag;
 
@@ -295,11 +295,19 @@ RRGraph::edge_range RRGraph::node_non_configurable_out_edges(const RRNodeId& nod
 
 RRGraph::edge_range RRGraph::node_out_edges(const RRNodeId& node) const {
     VTR_ASSERT_SAFE(valid_node_id(node));
+    if (edges_frozen_) {
+        return vtr::make_range(flat_node_out_edges_.begin() + node_out_edge_offsets_[size_t(node)],
+                               flat_node_out_edges_.begin() + node_out_edge_offsets_[size_t(node) + 1]);
+    }
     return vtr::make_range(node_out_edges_[node].begin(), node_out_edges_[node].end());
 }
 
 RRGraph::edge_range RRGraph::node_in_edges(const RRNodeId& node) const {
     VTR_ASSERT_SAFE(valid_node_id(node));
+    if (edges_frozen_) {
+        return vtr::make_range(flat_node_in_edges_.begin() + node_in_edge_offsets_[size_t(node)],
+                               flat_node_in_edges_.begin() + node_in_edge_offsets_[size_t(node) + 1]);
+    }
     return vtr::make_range(node_in_edges_[node].begin(), node_in_edges_[node].end());
 }
 
@@ -811,6 +819,9 @@ void RRGraph::reserve_segments(const int& num_segments) {
 
 /* Mutators */
 RRNodeId RRGraph::create_node(const t_rr_type& type) {
+    /* The per-node edge lists must be mutable */
+    thaw_edge_lists();
+
     //Allocate an ID
     RRNodeId node_id = RRNodeId(node_ids_.size());
 
@@ -846,6 +857,9 @@ RREdgeId RRGraph::create_edge(const RRNodeId& source, const RRNodeId& sink, cons
     VTR_ASSERT(valid_node_id(sink));
     VTR_ASSERT(valid_switch_id(switch_id));
 
+    /* The per-node edge lists must be mutable */
+    thaw_edge_lists();
+
     //Allocate an ID
     RREdgeId edge_id = RREdgeId(edge_ids_.size());
 
@@ -892,6 +906,9 @@ RRSegmentId RRGraph::create_segment(const t_segment_inf& segment_info) {
  * The compress() function should be called to physically remove the node 
  */
 void RRGraph::remove_node(const RRNodeId& node) {
+    /* The per-node edge lists must be mutable */
+    thaw_edge_lists();
+
     //Invalidate all connected edges
     // TODO: consider removal of self-loop edges?
     for (auto edge : node_in_edges(node)) {
@@ -915,6 +932,9 @@ void RRGraph::remove_node(const RRNodeId& node) {
  * The compress() function should be called to physically remove the edge 
  */
 void RRGraph::remove_edge(const RREdgeId& edge) {
+    /* The per-node edge lists must be mutable */
+    thaw_edge_lists();
+
     RRNodeId src_node = edge_src_node(edge);
     RRNodeId sink_node = edge_sink_node(edge);
 
@@ -1052,16 +1072,29 @@ void RRGraph::set_node_segment(const RRNodeId& node, const RRSegmentId& segment_
  * classify the edges of each node to be configurable (1st part) and non-configurable (2nd part) 
  */
 void RRGraph::partition_node_in_edges(const RRNodeId& node) {
+    /* Partitioning only re-orders the edges of a node, so it can be applied
+     * in-place to either the per-node vectors or the frozen flattened arrays
+     */
+    std::vector<RREdgeId>::iterator edges_begin;
+    std::vector<RREdgeId>::iterator edges_end;
+    if (edges_frozen_) {
+        edges_begin = flat_node_in_edges_.begin() + node_in_edge_offsets_[size_t(node)];
+        edges_end = flat_node_in_edges_.begin() + node_in_edge_offsets_[size_t(node) + 1];
+    } else {
+        edges_begin = node_in_edges_[node].begin();
+        edges_end = node_in_edges_[node].end();
+    }
+
     //Partition the edges so the first set of edges are all configurable, and the later are not
-    auto first_non_config_edge = std::partition(node_in_edges_[node].begin(), node_in_edges_[node].end(),
+    auto first_non_config_edge = std::partition(edges_begin, edges_end,
                                                 [&](const RREdgeId edge) { return edge_is_configurable(edge); }); /* Condition to partition edges */
 
-    size_t num_conf_edges = std::distance(node_in_edges_[node].begin(), first_non_config_edge);
-    size_t num_non_conf_edges = node_in_edges_[node].size() - num_conf_edges; //Note we calculate using the size_t to get full range
+    size_t num_conf_edges = std::distance(edges_begin, first_non_config_edge);
+    size_t num_non_conf_edges = std::distance(edges_begin, edges_end) - num_conf_edges; //Note we calculate using the size_t to get full range
 
     /* Check that within allowable range (no overflow when stored as num_non_configurable_edges_
      */
-    VTR_ASSERT_MSG(num_non_conf_edges <= node_in_edges_[node].size(),
+    VTR_ASSERT_MSG(num_non_conf_edges <= size_t(std::distance(edges_begin, edges_end)),
                    "Exceeded RR node maximum number of non-configurable input edges");
 
     node_num_non_configurable_in_edges_[node] = num_non_conf_edges; //Narrowing
@@ -1071,16 +1104,29 @@ void RRGraph::partition_node_in_edges(const RRNodeId& node) {
  * classify the edges of each node to be configurable (1st part) and non-configurable (2nd part) 
  */
 void RRGraph::partition_node_out_edges(const RRNodeId& node) {
+    /* Partitioning only re-orders the edges of a node, so it can be applied
+     * in-place to either the per-node vectors or the frozen flattened arrays
+     */
+    std::vector<RREdgeId>::iterator edges_begin;
+    std::vector<RREdgeId>::iterator edges_end;
+    if (edges_frozen_) {
+        edges_begin = flat_node_out_edges_.begin() + node_out_edge_offsets_[size_t(node)];
+        edges_end = flat_node_out_edges_.begin() + node_out_edge_offsets_[size_t(node) + 1];
+    } else {
+        edges_begin = node_out_edges_[node].begin();
+        edges_end = node_out_edges_[node].end();
+    }
+
     //Partition the edges so the first set of edges are all configurable, and the later are not
-    auto first_non_config_edge = std::partition(node_out_edges_[node].begin(), node_out_edges_[node].end(),
+    auto first_non_config_edge = std::partition(edges_begin, edges_end,
                                                 [&](const RREdgeId edge) { return edge_is_configurable(edge); }); /* Condition to partition edges */
 
-    size_t num_conf_edges = std::distance(node_out_edges_[node].begin(), first_non_config_edge);
-    size_t num_non_conf_edges = node_out_edges_[node].size() - num_conf_edges; //Note we calculate using the size_t to get full range
+    size_t num_conf_edges = std::distance(edges_begin, first_non_config_edge);
+    size_t num_non_conf_edges = std::distance(edges_begin, edges_end) - num_conf_edges; //Note we calculate using the size_t to get full range
 
     /* Check that within allowable range (no overflow when stored as num_non_configurable_edges_
      */
-    VTR_ASSERT_MSG(num_non_conf_edges <= node_out_edges_[node].size(),
+    VTR_ASSERT_MSG(num_non_conf_edges <= size_t(std::distance(edges_begin, edges_end)),
                    "Exceeded RR node maximum number of non-configurable output edges");
 
     node_num_non_configurable_out_edges_[node] = num_non_conf_edges; //Narrowing
@@ -1217,7 +1263,18 @@ bool RRGraph::validate_node_sizes() const {
            && node_segments_.size() == node_ids_.size()
            && node_num_non_configurable_in_edges_.size() == node_ids_.size()
            && node_num_non_configurable_out_edges_.size() == node_ids_.size()
-           && node_in_edges_.size() == node_ids_.size()
+           && validate_node_edge_list_sizes();
+}
+
+bool RRGraph::validate_node_edge_list_sizes() const {
+    /* The edge lists live in different storage depending on whether the
+     * graph is frozen (see freeze_edge_lists())
+     */
+    if (edges_frozen_) {
+        return node_in_edge_offsets_.size() == node_ids_.size() + 1
+               && node_out_edge_offsets_.size() == node_ids_.size() + 1;
+    }
+    return node_in_edges_.size() == node_ids_.size()
            && node_out_edges_.size() == node_ids_.size();
 }
 
@@ -1236,6 +1293,9 @@ bool RRGraph::validate_segment_sizes() const {
 }
 
 void RRGraph::compress() {
+    /* The clean-up passes below operate on the per-node edge lists */
+    thaw_edge_lists();
+
     vtr::vector<RRNodeId, RRNodeId> node_id_map(node_ids_.size());
     vtr::vector<RREdgeId, RREdgeId> edge_id_map(edge_ids_.size());
 
@@ -1246,11 +1306,77 @@ void RRGraph::compress() {
 
     rebuild_node_refs(edge_id_map);
 
-    invalidate_fast_node_lookup();
+    /* Freeze into the read-optimized form: flatten the edge lists and
+     * build the fast node look-up eagerly, so queries on the compressed
+     * graph never pay a lazy rebuild
+     */
+    freeze_edge_lists();
+    build_fast_node_lookup();
 
     clear_dirty();
 }
 
+/* Flatten the per-node edge lists into two contiguous arrays and release
+ * the per-node vectors. This removes two heap allocations (and the vector
+ * bookkeeping) per node and lets edge iteration walk contiguous memory
+ */
+void RRGraph::freeze_edge_lists() {
+    if (edges_frozen_) {
+        return;
+    }
+
+    node_in_edge_offsets_.assign(node_ids_.size() + 1, 0);
+    node_out_edge_offsets_.assign(node_ids_.size() + 1, 0);
+    for (const auto& node : nodes()) {
+        node_in_edge_offsets_[size_t(node) + 1] = node_in_edge_offsets_[size_t(node)] + node_in_edges_[node].size();
+        node_out_edge_offsets_[size_t(node) + 1] = node_out_edge_offsets_[size_t(node)] + node_out_edges_[node].size();
+    }
+
+    flat_node_in_edges_.clear();
+    flat_node_out_edges_.clear();
+    flat_node_in_edges_.reserve(node_in_edge_offsets_.back());
+    flat_node_out_edges_.reserve(node_out_edge_offsets_.back());
+    for (const auto& node : nodes()) {
+        flat_node_in_edges_.insert(flat_node_in_edges_.end(),
+                                   node_in_edges_[node].begin(), node_in_edges_[node].end());
+        flat_node_out_edges_.insert(flat_node_out_edges_.end(),
+                                    node_out_edges_[node].begin(), node_out_edges_[node].end());
+    }
+
+    /* Release the per-node vectors; thaw_edge_lists() rebuilds them if the
+     * graph is mutated again
+     */
+    node_in_edges_.clear();
+    node_out_edges_.clear();
+
+    edges_frozen_ = true;
+}
+
+/* Rebuild the per-node edge list vectors from the flattened arrays, making
+ * the graph mutable again
+ */
+void RRGraph::thaw_edge_lists() {
+    if (!edges_frozen_) {
+        return;
+    }
+
+    node_in_edges_.resize(node_ids_.size());
+    node_out_edges_.resize(node_ids_.size());
+    for (const auto& node : nodes()) {
+        node_in_edges_[node].assign(flat_node_in_edges_.begin() + node_in_edge_offsets_[size_t(node)],
+                                    flat_node_in_edges_.begin() + node_in_edge_offsets_[size_t(node) + 1]);
+        node_out_edges_[node].assign(flat_node_out_edges_.begin() + node_out_edge_offsets_[size_t(node)],
+                                     flat_node_out_edges_.begin() + node_out_edge_offsets_[size_t(node) + 1]);
+    }
+
+    node_in_edge_offsets_.clear();
+    node_out_edge_offsets_.clear();
+    flat_node_in_edges_.clear();
+    flat_node_out_edges_.clear();
+
+    edges_frozen_ = false;
+}
+
 void RRGraph::build_id_maps(vtr::vector<RRNodeId, RRNodeId>& node_id_map,
                             vtr::vector<RREdgeId, RREdgeId>& edge_id_map) {
     node_id_map = compress_ids(node_ids_);
@@ -1323,6 +1449,13 @@ void RRGraph::clear_nodes() {
     node_in_edges_.clear();
     node_out_edges_.clear();
 
+    /* clean the frozen edge storage */
+    edges_frozen_ = false;
+    node_in_edge_offsets_.clear();
+    node_out_edge_offsets_.clear();
+    flat_node_in_edges_.clear();
+    flat_node_out_edges_.clear();
+
     /* clean node_look_up */
     node_lookup_.clear();
 }
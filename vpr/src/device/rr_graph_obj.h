@@ -701,13 +701,38 @@ class RRGraph {
     void partition_edges();
 
     /* Graph-level Clean-up, remove invalid nodes/edges etc.
-     * This will clear the dirty flag (query by is_dirty()) of RRGraph object, if it was set 
+     * This will clear the dirty flag (query by is_dirty()) of RRGraph object, if it was set
+     *
+     * compress() also freezes the graph into a read-optimized form:
+     * 1. The per-node incoming/outgoing edge lists are flattened into
+     *    contiguous arrays (see freeze_edge_lists()), removing the
+     *    per-node vector overhead (two heap blocks and ~48 bytes of
+     *    bookkeeping per node) and making edge iteration cache friendly
+     * 2. The fast node look-up used by find_node() is (re)built eagerly,
+     *    so queries on the compressed graph never pay a lazy rebuild
+     *
+     * The frozen form is transparent to accessors. Mutators that add or
+     * remove nodes/edges thaw the edge lists back into per-node vectors
+     * on demand, so the builder-style mutation API keeps working; call
+     * compress() again once mutation is finished to re-freeze.
      */
     void compress();
 
     /* top-level function to free, should be called when to delete a RRGraph */
     void clear();
 
+  private: /* Internal Mutators to freeze/thaw the edge lists */
+    /* Flatten the per-node edge lists into the contiguous arrays
+     * flat_node_in_edges_/flat_node_out_edges_ (indexed through the
+     * node_*_edge_offsets_ prefix sums) and release the per-node vectors
+     */
+    void freeze_edge_lists();
+
+    /* Rebuild the per-node edge list vectors from the flattened arrays,
+     * so that node/edge mutators can operate on them again
+     */
+    void thaw_edge_lists();
+
   private: /* Internal Mutators to perform edge partitioning */
     /* classify the input edges of each node to be configurable (1st part) and non-configurable (2nd part) */
     void partition_node_in_edges(const RRNodeId& node);
@@ -747,6 +772,7 @@ class RRGraph {
     /* Graph property Validation */
     bool validate_sizes() const;
     bool validate_node_sizes() const;
+    bool validate_node_edge_list_sizes() const;
     bool validate_edge_sizes() const;
     bool validate_switch_sizes() const;
     bool validate_segment_sizes() const;
@@ -807,6 +833,19 @@ class RRGraph {
     vtr::vector<RRNodeId, std::vector<RREdgeId>> node_in_edges_;
     vtr::vector<RRNodeId, std::vector<RREdgeId>> node_out_edges_;
 
+    /* Frozen (compressed) edge storage, built by compress():
+     * the per-node edge lists above are flattened into two contiguous
+     * arrays, with node i's edges stored in the half-open index range
+     * [node_*_edge_offsets_[i], node_*_edge_offsets_[i + 1])
+     * While frozen, the per-node vectors are released and all edge range
+     * accessors serve from the flattened arrays
+     */
+    bool edges_frozen_ = false;
+    std::vector<size_t> node_in_edge_offsets_;  /* Size: num_nodes + 1 */
+    std::vector<size_t> node_out_edge_offsets_; /* Size: num_nodes + 1 */
+    std::vector<RREdgeId> flat_node_in_edges_;
+    std::vector<RREdgeId> flat_node_out_edges_;
+
     /* Edge related data */
     vtr::vector<RREdgeId, RREdgeId> edge_ids_; /* unique identifiers for edges */
     vtr::vector<RREdgeId, RRNodeId> edge_src_nodes_;
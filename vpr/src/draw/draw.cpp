@@ -19,12 +19,14 @@
 #include <algorithm>
 #include <sstream>
 #include <array>
+#include <chrono>
 
 #include "vtr_assert.h"
 #include "vtr_ndoffsetmatrix.h"
 #include "vtr_memory.h"
 #include "vtr_log.h"
 #include "vtr_color_map.h"
+#include "vtr_spatial_index.h"
 
 #include "vpr_utils.h"
 #include "vpr_error.h"
@@ -38,6 +40,7 @@
 #include "atom_netlist.h"
 #include "tatum/report/TimingPathCollector.hpp"
 #include "hsl.h"
+#include "route_common.h"
 #include "route_export.h"
 #include "search_bar.h"
 #include "save_graphics.h"
@@ -129,7 +132,7 @@ ezgl::color lighten_color(ezgl::color color, float amount);
 
 static void draw_block_pin_util();
 
-static float get_router_rr_cost(const t_rr_node_route_inf node_inf, e_draw_router_rr_cost draw_router_rr_cost);
+static float get_router_rr_cost(int inode, e_draw_router_rr_cost draw_router_rr_cost);
 static void draw_router_rr_costs(ezgl::renderer* g);
 
 static void draw_rr_costs(ezgl::renderer* g, const std::vector<float>& rr_costs, bool lowest_cost_first = true);
@@ -194,6 +197,21 @@ ezgl::point2d point_1(0, 0);
 ezgl::rectangle initial_world;
 std::string rr_highlight_message;
 
+//Spatial index over the bounding boxes of the currently placed cluster
+//blocks, used by highlight_blocks() to resolve mouse clicks without scanning
+//the whole grid. Built lazily on the first click and invalidated by
+//update_screen() (blocks may have moved since the last pause)
+static vtr::SpatialIndex<double, ClusterBlockId> block_pick_index;
+static bool block_pick_index_valid = false;
+
+//Cached congestion overlay data. The congested node set only changes when the
+//algorithms publish new state via update_screen(), so pan/zoom redraws between
+//updates can re-use the collected (and sorted) node list instead of re-scanning
+//every RR node
+static bool congestion_overlay_valid = false;
+static std::vector<int> congestion_overlay_nodes;
+static float congestion_overlay_max_ratio = 1.;
+
 #endif // NO_GRAPHICS
 
 /********************** Subroutine definitions ******************************/
@@ -406,13 +424,23 @@ void update_screen(ScreenUpdatePriority priority, const char* msg, enum pic_type
 
     t_draw_state* draw_state = get_draw_state_vars();
 
+    //Blocks may have moved since the last screen update, so the click
+    //resolution index must be re-built before its next use
+    block_pick_index_valid = false;
+
+    //Similarly, routing occupancies may have changed so the cached congestion
+    //overlay must be re-collected on its next draw
+    congestion_overlay_valid = false;
+
     if (!draw_state->show_graphics)
         ezgl::set_disable_event_loop(true);
     else
         ezgl::set_disable_event_loop(false);
 
+    bool pausing = (int(priority) >= draw_state->gr_automode || draw_state->forced_pause);
+
     //Has the user asked us to pause at the next screen updated?
-    if (int(priority) >= draw_state->gr_automode || draw_state->forced_pause) {
+    if (pausing) {
         if (draw_state->forced_pause) {
             VTR_LOG("Pausing in interactive graphics (user pressed 'Pause')\n");
             draw_state->forced_pause = false; //Reset pause flag
@@ -501,9 +529,20 @@ void update_screen(ScreenUpdatePriority priority, const char* msg, enum pic_type
     }
 
     if (draw_state->show_graphics) {
-        application.update_message(msg);
-        application.refresh_drawing();
-        application.flush_drawing();
+        /* Rate-limit redraws for updates that do not pause: algorithms which
+         * report often (e.g. the placer between temperatures) should not be
+         * slowed by repainting faster than the screen is useful. Pausing
+         * updates always redraw since the user is looking at that state. */
+        constexpr auto MIN_REDRAW_INTERVAL = std::chrono::milliseconds(33);
+        static auto last_redraw = std::chrono::steady_clock::now() - MIN_REDRAW_INTERVAL;
+
+        auto now = std::chrono::steady_clock::now();
+        if (pausing || now - last_redraw >= MIN_REDRAW_INTERVAL) {
+            last_redraw = now;
+            application.update_message(msg);
+            application.refresh_drawing();
+            application.flush_drawing();
+        }
     }
 
 #else
@@ -939,6 +978,10 @@ static void drawplace(ezgl::renderer* g) {
     ClusterBlockId bnum;
     int num_sub_tiles;
 
+    /* Cull tiles outside the current viewport; on large devices zoomed-in
+     * views only touch a small fraction of the grid */
+    ezgl::rectangle visible_world = g->get_visible_world();
+
     g->set_line_width(0);
     for (size_t i = 0; i < device_ctx.grid.width(); i++) {
         for (size_t j = 0; j < device_ctx.grid.height(); j++) {
@@ -954,7 +997,7 @@ static void drawplace(ezgl::renderer* g) {
 
             for (int k = 0; k < num_sub_tiles; ++k) {
                 /* Look at the tile at start of large block */
-                bnum = place_ctx.grid_blocks[i][j].blocks[k];
+                bnum = place_ctx.grid_blocks.block_at_location(i, j, k);
                 /* Fill background for the clb. Do not fill if "show_blk_internal"
                  * is toggled.
                  */
@@ -970,6 +1013,14 @@ static void drawplace(ezgl::renderer* g) {
                 g->set_color(block_color);
                 /* Get coords of current sub_tile */
                 ezgl::rectangle abs_clb_bbox = draw_coords->get_absolute_clb_bbox(i, j, k);
+
+                if (abs_clb_bbox.right() < visible_world.left()
+                    || abs_clb_bbox.left() > visible_world.right()
+                    || abs_clb_bbox.top() < visible_world.bottom()
+                    || abs_clb_bbox.bottom() > visible_world.top()) {
+                    continue; /* Off-screen */
+                }
+
                 ezgl::point2d center = abs_clb_bbox.center();
 
                 g->fill_rectangle(abs_clb_bbox);
@@ -1042,19 +1093,46 @@ static void draw_congestion(ezgl::renderer* g) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.routing();
 
-    //Record min/max congestion
-    float min_congestion_ratio = 1.;
-    float max_congestion_ratio = min_congestion_ratio;
-    std::vector<int> congested_rr_nodes = collect_congested_rr_nodes();
-    for (int inode : congested_rr_nodes) {
-        short occ = route_ctx.rr_node_route_inf[inode].occ();
-        short capacity = device_ctx.rr_nodes[inode].capacity();
+    //Collect (and pre-sort) the congested nodes only when routing state has
+    //changed since the last update_screen(); pure pan/zoom redraws re-use the
+    //cached result
+    if (!congestion_overlay_valid) {
+        congestion_overlay_nodes = collect_congested_rr_nodes();
 
-        float congestion_ratio = float(occ) / capacity;
+        //Record max congestion
+        congestion_overlay_max_ratio = 1.;
+        for (int inode : congestion_overlay_nodes) {
+            short occ = route_ctx.rr_node_route_inf[inode].occ();
+            short capacity = device_ctx.rr_nodes[inode].capacity();
+
+            float congestion_ratio = float(occ) / capacity;
+
+            congestion_overlay_max_ratio = std::max(congestion_overlay_max_ratio, congestion_ratio);
+        }
+
+        //Sort the nodes in ascending order of value for drawing, this ensures high
+        //valued nodes are not overdrawn by lower value ones (e.g-> when zoomed-out far)
+        auto cmp_ascending_acc_cost = [&](int lhs_node, int rhs_node) {
+            short lhs_occ = route_ctx.rr_node_route_inf[lhs_node].occ();
+            short lhs_capacity = device_ctx.rr_nodes[lhs_node].capacity();
+
+            short rhs_occ = route_ctx.rr_node_route_inf[rhs_node].occ();
+            short rhs_capacity = device_ctx.rr_nodes[rhs_node].capacity();
 
-        max_congestion_ratio = std::max(max_congestion_ratio, congestion_ratio);
+            float lhs_cong_ratio = float(lhs_occ) / lhs_capacity;
+            float rhs_cong_ratio = float(rhs_occ) / rhs_capacity;
+
+            return lhs_cong_ratio < rhs_cong_ratio;
+        };
+        std::sort(congestion_overlay_nodes.begin(), congestion_overlay_nodes.end(), cmp_ascending_acc_cost);
+
+        congestion_overlay_valid = true;
     }
 
+    float min_congestion_ratio = 1.;
+    float max_congestion_ratio = congestion_overlay_max_ratio;
+    const std::vector<int>& congested_rr_nodes = congestion_overlay_nodes;
+
     char msg[vtr::bufsize];
     if (draw_state->show_congestion == DRAW_CONGESTED) {
         sprintf(msg, "RR Node Overuse ratio range (%.2f, %.2f]", min_congestion_ratio, max_congestion_ratio);
@@ -1066,22 +1144,6 @@ static void draw_congestion(ezgl::renderer* g) {
 
     std::unique_ptr<vtr::ColorMap> cmap = std::make_unique<vtr::PlasmaColorMap>(min_congestion_ratio, max_congestion_ratio);
 
-    //Sort the nodes in ascending order of value for drawing, this ensures high
-    //valued nodes are not overdrawn by lower value ones (e.g-> when zoomed-out far)
-    auto cmp_ascending_acc_cost = [&](int lhs_node, int rhs_node) {
-        short lhs_occ = route_ctx.rr_node_route_inf[lhs_node].occ();
-        short lhs_capacity = device_ctx.rr_nodes[lhs_node].capacity();
-
-        short rhs_occ = route_ctx.rr_node_route_inf[rhs_node].occ();
-        short rhs_capacity = device_ctx.rr_nodes[rhs_node].capacity();
-
-        float lhs_cong_ratio = float(lhs_occ) / lhs_capacity;
-        float rhs_cong_ratio = float(rhs_occ) / rhs_capacity;
-
-        return lhs_cong_ratio < rhs_cong_ratio;
-    };
-    std::sort(congested_rr_nodes.begin(), congested_rr_nodes.end(), cmp_ascending_acc_cost);
-
     if (draw_state->show_congestion == DRAW_CONGESTED_WITH_NETS) {
         auto rr_node_nets = collect_rr_node_nets();
 
@@ -1288,7 +1350,23 @@ void draw_rr(ezgl::renderer* g) {
 
     g->set_line_dash(ezgl::line_dash::none);
 
+    /* Cull nodes outside the current viewport. The cull box is padded by a
+     * tile so edges drawn from a just-off-screen node to a visible one at a
+     * shared switch point are not dropped. */
+    t_draw_coords* draw_coords = get_draw_coords_vars();
+    ezgl::rectangle visible_world = g->get_visible_world();
+    float cull_margin_x = draw_coords->get_tile_width();
+    float cull_margin_y = draw_coords->get_tile_height();
+
     for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        auto& node = device_ctx.rr_nodes[inode];
+        if (draw_coords->tile_x[node.xhigh()] + cull_margin_x + cull_margin_x < visible_world.left()
+            || draw_coords->tile_x[node.xlow()] - cull_margin_x > visible_world.right()
+            || draw_coords->tile_y[node.yhigh()] + cull_margin_y + cull_margin_y < visible_world.bottom()
+            || draw_coords->tile_y[node.ylow()] - cull_margin_y > visible_world.top()) {
+            continue; /* Off-screen */
+        }
+
         if (!draw_state->draw_rr_node[inode].node_highlighted) {
             /* If not highlighted node, assign color based on type. */
             switch (device_ctx.rr_nodes[inode].type()) {
@@ -2119,8 +2197,15 @@ static void drawroute(enum e_draw_net_type draw_net_type, ezgl::renderer* g) {
     /* Next free track in each channel segment if routing is GLOBAL */
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& route_ctx = g_vpr_ctx.routing();
 
     t_draw_state* draw_state = get_draw_state_vars();
+    t_draw_coords* draw_coords = get_draw_coords_vars();
+
+    /* Cull nets whose routing bounding box is outside the viewport */
+    ezgl::rectangle visible_world = g->get_visible_world();
+    float tile_width = draw_coords->get_tile_width();
+    float tile_height = draw_coords->get_tile_height();
 
     g->set_line_dash(ezgl::line_dash::none);
 
@@ -2130,6 +2215,16 @@ static void drawroute(enum e_draw_net_type draw_net_type, ezgl::renderer* g) {
         if (draw_net_type == HIGHLIGHTED && draw_state->net_color[net_id] == ezgl::BLACK)
             continue;
 
+        if (size_t(net_id) < route_ctx.route_bb.size()) {
+            const t_bb& bb = route_ctx.route_bb[net_id];
+            if (draw_coords->tile_x[bb.xmax] + tile_width < visible_world.left()
+                || draw_coords->tile_x[bb.xmin] > visible_world.right()
+                || draw_coords->tile_y[bb.ymax] + tile_height < visible_world.bottom()
+                || draw_coords->tile_y[bb.ymin] > visible_world.top()) {
+                continue; /* Off-screen */
+            }
+        }
+
         draw_routed_net(net_id, g);
     } /* End for (each net) */
 }
@@ -3472,13 +3567,14 @@ static void draw_routing_util(ezgl::renderer* g) {
     draw_state->color_map = std::move(cmap);
 }
 
-static float get_router_rr_cost(const t_rr_node_route_inf node_inf, e_draw_router_rr_cost draw_router_rr_cost) {
+static float get_router_rr_cost(int inode, e_draw_router_rr_cost draw_router_rr_cost) {
+    //Costs stamped by earlier path searches read as infinity (see get_rr_path_cost())
     if (draw_router_rr_cost == DRAW_ROUTER_RR_COST_TOTAL) {
-        return node_inf.path_cost;
+        return get_rr_path_cost(inode);
     } else if (draw_router_rr_cost == DRAW_ROUTER_RR_COST_KNOWN) {
-        return node_inf.backward_path_cost;
+        return get_rr_backward_path_cost(inode);
     } else if (draw_router_rr_cost == DRAW_ROUTER_RR_COST_EXPECTED) {
-        return node_inf.path_cost - node_inf.backward_path_cost;
+        return get_rr_path_cost(inode) - get_rr_backward_path_cost(inode);
     }
 
     VPR_THROW(VPR_ERROR_DRAW, "Invalid Router RR cost drawing type");
@@ -3491,12 +3587,11 @@ static void draw_router_rr_costs(ezgl::renderer* g) {
     }
 
     auto& device_ctx = g_vpr_ctx.device();
-    auto& routing_ctx = g_vpr_ctx.routing();
 
     std::vector<float> rr_costs(device_ctx.rr_nodes.size());
 
     for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); ++inode) {
-        float cost = get_router_rr_cost(routing_ctx.rr_node_route_inf[inode], draw_state->show_router_rr_cost);
+        float cost = get_router_rr_cost(inode, draw_state->show_router_rr_cost);
         rr_costs[inode] = cost;
     }
 
@@ -3649,42 +3744,29 @@ static void highlight_blocks(double x, double y) {
 
     char msg[vtr::bufsize];
     ClusterBlockId clb_index = EMPTY_BLOCK_ID;
-    auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.placement();
 
     /// determine block ///
     ezgl::rectangle clb_bbox;
 
-    // iterate over grid x
-    for (size_t i = 0; i < device_ctx.grid.width(); ++i) {
-        if (draw_coords->tile_x[i] > x) {
-            break; // we've gone to far in the x direction
+    if (!block_pick_index_valid) {
+        //Re-build the spatial index over the current block positions
+        std::vector<std::pair<vtr::Rect<double>, ClusterBlockId>> entries;
+        entries.reserve(cluster_ctx.clb_nlist.blocks().size());
+        for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+            ezgl::rectangle bbox = draw_coords->get_absolute_clb_bbox(blk_id, cluster_ctx.clb_nlist.block_type(blk_id));
+            entries.emplace_back(vtr::Rect<double>(bbox.left(), bbox.bottom(), bbox.right(), bbox.top()), blk_id);
         }
-        // iterate over grid y
-        for (size_t j = 0; j < device_ctx.grid.height(); ++j) {
-            if (draw_coords->tile_y[j] > y) {
-                break; // we've gone to far in the y direction
-            }
-            // iterate over sub_blocks
-            const t_grid_tile* grid_tile = &device_ctx.grid[i][j];
-            for (int k = 0; k < grid_tile->type->capacity; ++k) {
-                clb_index = place_ctx.grid_blocks[i][j].blocks[k];
-                if (clb_index != EMPTY_BLOCK_ID) {
-                    clb_bbox = draw_coords->get_absolute_clb_bbox(clb_index, cluster_ctx.clb_nlist.block_type(clb_index));
-                    if (clb_bbox.contains({x, y})) {
-                        break;
-                    } else {
-                        clb_index = EMPTY_BLOCK_ID;
-                    }
-                }
-            }
-            if (clb_index != EMPTY_BLOCK_ID) {
-                break; // we've found something
-            }
-        }
-        if (clb_index != EMPTY_BLOCK_ID) {
-            break; // we've found something
+        block_pick_index.build(std::move(entries));
+        block_pick_index_valid = true;
+    }
+
+    for (ClusterBlockId candidate : block_pick_index.find_containing(vtr::Point<double>(x, y))) {
+        clb_bbox = draw_coords->get_absolute_clb_bbox(candidate, cluster_ctx.clb_nlist.block_type(candidate));
+        if (clb_bbox.contains({x, y})) {
+            clb_index = candidate;
+            break;
         }
     }
 
@@ -157,11 +157,11 @@ void draw_internal_draw_subblk(ezgl::renderer* g) {
             int num_sub_tiles = device_ctx.grid[i][j].type->capacity;
             for (int k = 0; k < num_sub_tiles; ++k) {
                 /* Don't draw if block is empty. */
-                if (place_ctx.grid_blocks[i][j].blocks[k] == EMPTY_BLOCK_ID || place_ctx.grid_blocks[i][j].blocks[k] == INVALID_BLOCK_ID)
+                if (place_ctx.grid_blocks.block_at_location(i, j, k) == EMPTY_BLOCK_ID || place_ctx.grid_blocks.block_at_location(i, j, k) == INVALID_BLOCK_ID)
                     continue;
 
                 /* Get block ID */
-                ClusterBlockId bnum = place_ctx.grid_blocks[i][j].blocks[k];
+                ClusterBlockId bnum = place_ctx.grid_blocks.block_at_location(i, j, k);
                 /* Safety check, that physical blocks exists in the CLB */
                 if (cluster_ctx.clb_nlist.block_pb(bnum) == nullptr)
                     continue;
@@ -268,7 +268,7 @@ draw_internal_calc_coords(int type_descrip_index, t_pb_graph_node* pb_graph_node
     double left, bot, right, top;
 
     int capacity = device_ctx.physical_tile_types[type_descrip_index].capacity;
-    if (capacity > 1 && device_ctx.grid.width() > 0 && device_ctx.grid.height() > 0 && place_ctx.grid_blocks[1][0].usage != 0
+    if (capacity > 1 && device_ctx.grid.width() > 0 && device_ctx.grid.height() > 0 && place_ctx.grid_blocks.usage(1, 0) != 0
         && type_descrip_index == device_ctx.grid[1][0].type->index) {
         // that should test for io blocks, and setting capacity_divisor > 1
         // will squish every thing down
@@ -40,6 +40,7 @@
 #include <map>
 #include <algorithm>
 #include <fstream>
+#include <thread>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -73,6 +74,15 @@
 #define AAPACK_MAX_HIGH_FANOUT_EXPLORE 10 /* For high-fanout nets that are ignored, consider a maximum of this many sinks, must be less than packer_opts.feasible_block_array_size */
 #define AAPACK_MAX_TRANSITIVE_EXPLORE 40  /* When investigating transitive fanout connections in packing, consider a maximum of this many molecules, must be less than packer_opts.feasible_block_array_size */
 
+/* Below this many atom blocks the per-atom seed gain scoring is done
+ * serially; the work is too small to repay spawning worker threads. */
+constexpr size_t MIN_ATOMS_PER_SEED_GAIN_WORKER = 65536;
+
+/* Shared atom-to-window index remap backing the flat t_gain_store arrays of
+ * the currently open cluster's pb_stats (see pack_types.h). Re-opened at the
+ * start of each new cluster. */
+static t_pack_window f_pack_window;
+
 //Constant allowing all cluster pins to be used
 const t_ext_pin_util FULL_EXTERNAL_PIN_UTIL(1., 1.);
 
@@ -151,7 +161,7 @@ static void check_for_duplicate_inputs ();
 static bool is_atom_blk_in_pb(const AtomBlockId blk_id, const t_pb* pb);
 
 static void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
-                                                std::map<AtomBlockId, float>& gain,
+                                                t_gain_store& gain,
                                                 t_pb* pb,
                                                 int max_queue_size);
 
@@ -320,9 +330,15 @@ static std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_
                                                       const t_molecule_stats& max_molecule_stats,
                                                       const vtr::vector<AtomBlockId, float>& atom_criticality);
 
-static t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules, const std::vector<AtomBlockId> seed_atoms);
+static float compute_atom_seed_gain(const e_cluster_seed seed_type,
+                                    const AtomBlockId blk,
+                                    const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules,
+                                    const t_molecule_stats& max_molecule_stats,
+                                    const vtr::vector<AtomBlockId, float>& atom_criticality);
+
+static t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules, const std::vector<AtomBlockId>& seed_atoms);
 
-static float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>& blk_gain);
+static float get_molecule_gain(t_pack_molecule* molecule, t_gain_store& blk_gain);
 static int compare_molecule_gain(const void* a, const void* b);
 int net_sinks_reachable_in_cluster(const t_pb_graph_pin* driver_pb_gpin, const int depth, const AtomNetId net_id);
 
@@ -762,6 +778,11 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
         print_le_count(le_count, le_pb_type);
     }
 
+    //Report the packer's transient footprint at its peak: the clustering
+    //netlist and intra-block routing are freed below once the clustering
+    //has been written out
+    vtr::memory_usage::report("packer", cluster_ctx.clb_nlist.memory_footprint());
+
     /****************************************************************
      * Free Data Structures
      *****************************************************************/
@@ -780,6 +801,7 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
         free(hill_climbing_inputs_avail);
 
     free_cluster_placement_stats(cluster_placement_stats);
+    free_pb_stats_pool();
 
     for (auto blk_id : cluster_ctx.clb_nlist.blocks())
         cluster_ctx.clb_nlist.remove_block(blk_id);
@@ -791,6 +813,8 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     free(primitives_list);
 
+    vtr::memory_usage::report("packer", 0); //Transient clustering data freed
+
     return num_used_type_instances;
 }
 
@@ -810,7 +834,7 @@ static bool is_atom_blk_in_pb(const AtomBlockId blk_id, const t_pb* pb) {
 
 /* Add blk to list of feasible blocks sorted according to gain */
 static void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
-                                                std::map<AtomBlockId, float>& gain,
+                                                t_gain_store& gain,
                                                 t_pb* pb,
                                                 int max_queue_size) {
     int i, j;
@@ -821,12 +845,16 @@ static void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
         }
     }
 
+    /* Computed once; get_molecule_gain() walks the molecule's atoms and pins so
+     * re-evaluating it per comparison in the insertion loops below is costly */
+    float molecule_gain = get_molecule_gain(molecule, gain);
+
     if (pb->pb_stats->num_feasible_blocks >= max_queue_size - 1) {
         /* maximum size for array, remove smallest gain element and sort */
-        if (get_molecule_gain(molecule, gain) > get_molecule_gain(pb->pb_stats->feasible_blocks[0], gain)) {
+        if (molecule_gain > get_molecule_gain(pb->pb_stats->feasible_blocks[0], gain)) {
             /* single loop insertion sort */
             for (j = 0; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
-                if (get_molecule_gain(molecule, gain) <= get_molecule_gain(pb->pb_stats->feasible_blocks[j + 1], gain)) {
+                if (molecule_gain <= get_molecule_gain(pb->pb_stats->feasible_blocks[j + 1], gain)) {
                     pb->pb_stats->feasible_blocks[j] = molecule;
                     break;
                 } else {
@@ -840,7 +868,7 @@ static void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
     } else {
         /* Expand array and single loop insertion sort */
         for (j = pb->pb_stats->num_feasible_blocks - 1; j >= 0; j--) {
-            if (get_molecule_gain(pb->pb_stats->feasible_blocks[j], gain) > get_molecule_gain(molecule, gain)) {
+            if (get_molecule_gain(pb->pb_stats->feasible_blocks[j], gain) > molecule_gain) {
                 pb->pb_stats->feasible_blocks[j + 1] = pb->pb_stats->feasible_blocks[j];
             } else {
                 pb->pb_stats->feasible_blocks[j + 1] = molecule;
@@ -1154,7 +1182,15 @@ static void alloc_and_load_pb_stats(t_pb* pb, const int feasible_block_array_siz
     /* Call this routine when starting to fill up a new cluster.  It resets *
      * the gain vector, etc.                                                */
 
-    pb->pb_stats = new t_pb_stats;
+    pb->pb_stats = alloc_pb_stats();
+
+    /* The gain stores index their flat arrays through the open cluster's
+     * shared atom-to-window remap */
+    pb->pb_stats->gain.set_window(&f_pack_window);
+    pb->pb_stats->timinggain.set_window(&f_pack_window);
+    pb->pb_stats->connectiongain.set_window(&f_pack_window);
+    pb->pb_stats->sharinggain.set_window(&f_pack_window);
+    pb->pb_stats->hillgain.set_window(&f_pack_window);
 
     /* If statement below is for speed.  If nets are reasonably low-fanout,  *
      * only a relatively small number of blocks will be marked, and updating *
@@ -1947,6 +1983,9 @@ static void start_new_cluster(t_cluster_placement_stats* cluster_placement_stats
     auto& atom_ctx = g_vpr_ctx.atom();
     auto& device_ctx = g_vpr_ctx.mutable_device();
 
+    /* Start a fresh candidate window for this cluster's gain stores */
+    f_pack_window.open_window(atom_ctx.nlist.blocks().size());
+
     /* Allocate a dummy initial cluster and load a atom block as a seed and check if it is legal */
     AtomBlockId root_atom = molecule->atom_block_ids[molecule->root];
     const std::string& root_atom_name = atom_ctx.nlist.block_name(root_atom);
@@ -2550,146 +2589,191 @@ static std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_
         //By criticality
         atom_gains = atom_criticality;
 
-    } else if (seed_type == e_cluster_seed::MAX_INPUTS) {
-        //By number of used molecule input pins
-        for (auto blk : atom_ctx.nlist.blocks()) {
-            int max_molecule_inputs = 0;
-            auto molecule_rng = atom_molecules.equal_range(blk);
-            for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
-                const t_pack_molecule* blk_mol = kv.second;
-
-                const t_molecule_stats molecule_stats = calc_molecule_stats(blk_mol);
-
-                //Keep the max over all molecules associated with the atom
-                max_molecule_inputs = std::max(max_molecule_inputs, molecule_stats.num_used_ext_inputs);
+    } else {
+        /* The remaining seed types score each atom independently from the
+         * (read-only) molecule statistics, so on large netlists the scoring
+         * is spread over worker threads operating on contiguous block id
+         * ranges; each atom's gain is written only by its owning worker. */
+        size_t num_blocks = atom_ctx.nlist.blocks().size();
+
+        auto score_block_range = [&](size_t start, size_t end) {
+            for (size_t iblk = start; iblk < end; ++iblk) {
+                AtomBlockId blk(iblk);
+                atom_gains[blk] = compute_atom_seed_gain(seed_type, blk, atom_molecules, max_molecule_stats, atom_criticality);
+            }
+        };
+
+        size_t num_workers = std::min<size_t>(std::thread::hardware_concurrency(),
+                                              num_blocks / MIN_ATOMS_PER_SEED_GAIN_WORKER);
+        if (num_workers > 1) {
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> worker_errors(num_workers);
+
+            size_t blocks_per_worker = (num_blocks + num_workers - 1) / num_workers;
+            for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+                size_t start = iworker * blocks_per_worker;
+                size_t end = std::min(start + blocks_per_worker, num_blocks);
+                workers.emplace_back([&score_block_range, &worker_errors, iworker, start, end]() {
+                    try {
+                        score_block_range(start, end);
+                    } catch (...) {
+                        worker_errors[iworker] = std::current_exception();
+                    }
+                });
             }
 
-            atom_gains[blk] = max_molecule_inputs;
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            for (auto& error : worker_errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        } else {
+            score_block_range(0, num_blocks);
         }
+    }
 
-    } else if (seed_type == e_cluster_seed::BLEND) {
-        //By blended gain (criticality and inputs used)
-        for (auto blk : atom_ctx.nlist.blocks()) {
-            /* Score seed gain of each block as a weighted sum of timing criticality,
-             * number of tightly coupled blocks connected to it, and number of external inputs */
-            float seed_blend_fac = 0.5;
-            float max_blend_gain = 0;
+    //Sort seeds in descending order of gain (i.e. highest gain first)
+    //
+    // Note that we use a *stable* sort here. It has been observed that different
+    // standard library implementations (e.g. gcc-4.9 vs gcc-5) use sorting algorithms
+    // which produce different orderings for seeds of equal gain (which is allowed with
+    // std::sort which does not specify how equal values are handled). Using a stable
+    // sort ensures that regardless of the underlying sorting algorithm the same seed
+    // order is produced regardless of compiler.
+    auto by_descending_gain = [&](const AtomBlockId lhs, const AtomBlockId rhs) {
+        return atom_gains[lhs] > atom_gains[rhs];
+    };
+    std::stable_sort(seed_atoms.begin(), seed_atoms.end(), by_descending_gain);
 
-            auto molecule_rng = atom_molecules.equal_range(blk);
-            for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
-                const t_pack_molecule* blk_mol = kv.second;
+    if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_CLUSTERING_BLOCK_CRITICALITIES)) {
+        print_seed_gains(getEchoFileName(E_ECHO_CLUSTERING_BLOCK_CRITICALITIES), seed_atoms, atom_gains, atom_criticality);
+    }
 
-                const t_molecule_stats molecule_stats = calc_molecule_stats(blk_mol);
+    return seed_atoms;
+}
 
-                VTR_ASSERT(max_molecule_stats.num_used_ext_inputs > 0);
+/* Scores the seed gain of a single atom block for the given seed type.
+ * This is a pure function of the (read-only) molecule statistics and
+ * criticalities, so distinct blocks may be scored concurrently. */
+static float compute_atom_seed_gain(const e_cluster_seed seed_type,
+                                    const AtomBlockId blk,
+                                    const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules,
+                                    const t_molecule_stats& max_molecule_stats,
+                                    const vtr::vector<AtomBlockId, float>& atom_criticality) {
+    if (seed_type == e_cluster_seed::MAX_INPUTS) {
+        //By number of used molecule input pins
+        int max_molecule_inputs = 0;
+        auto molecule_rng = atom_molecules.equal_range(blk);
+        for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
+            const t_pack_molecule* blk_mol = kv.second;
 
-                float blend_gain = (seed_blend_fac * atom_criticality[blk]
-                                    + (1 - seed_blend_fac) * (molecule_stats.num_used_ext_inputs / max_molecule_stats.num_used_ext_inputs));
-                blend_gain *= (1 + 0.2 * (molecule_stats.num_blocks - 1));
+            const t_molecule_stats molecule_stats = calc_molecule_stats(blk_mol);
 
-                //Keep the max over all molecules associated with the atom
-                max_blend_gain = std::max(max_blend_gain, blend_gain);
-            }
-            atom_gains[blk] = max_blend_gain;
+            //Keep the max over all molecules associated with the atom
+            max_molecule_inputs = std::max(max_molecule_inputs, molecule_stats.num_used_ext_inputs);
         }
 
-    } else if (seed_type == e_cluster_seed::MAX_PINS || seed_type == e_cluster_seed::MAX_INPUT_PINS) {
-        //By pins per molecule (i.e. available pins on primitives, not pins in use)
+        return max_molecule_inputs;
 
-        for (auto blk : atom_ctx.nlist.blocks()) {
-            int max_molecule_pins = 0;
-            auto molecule_rng = atom_molecules.equal_range(blk);
-            for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
-                const t_pack_molecule* mol = kv.second;
+    } else if (seed_type == e_cluster_seed::BLEND) {
+        /* Score seed gain of each block as a weighted sum of timing criticality,
+         * number of tightly coupled blocks connected to it, and number of external inputs */
+        float seed_blend_fac = 0.5;
+        float max_blend_gain = 0;
 
-                const t_molecule_stats molecule_stats = calc_molecule_stats(mol);
+        auto molecule_rng = atom_molecules.equal_range(blk);
+        for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
+            const t_pack_molecule* blk_mol = kv.second;
 
-                //Keep the max over all molecules associated with the atom
-                int molecule_pins = 0;
-                if (seed_type == e_cluster_seed::MAX_PINS) {
-                    //All pins
-                    molecule_pins = molecule_stats.num_pins;
-                } else {
-                    VTR_ASSERT(seed_type == e_cluster_seed::MAX_INPUT_PINS);
-                    //Input pins only
-                    molecule_pins = molecule_stats.num_input_pins;
-                }
+            const t_molecule_stats molecule_stats = calc_molecule_stats(blk_mol);
 
-                //Keep the max over all molecules associated with the atom
-                max_molecule_pins = std::max(max_molecule_pins, molecule_pins);
+            VTR_ASSERT(max_molecule_stats.num_used_ext_inputs > 0);
+
+            float blend_gain = (seed_blend_fac * atom_criticality[blk]
+                                + (1 - seed_blend_fac) * (molecule_stats.num_used_ext_inputs / max_molecule_stats.num_used_ext_inputs));
+            blend_gain *= (1 + 0.2 * (molecule_stats.num_blocks - 1));
+
+            //Keep the max over all molecules associated with the atom
+            max_blend_gain = std::max(max_blend_gain, blend_gain);
+        }
+        return max_blend_gain;
+
+    } else if (seed_type == e_cluster_seed::MAX_PINS || seed_type == e_cluster_seed::MAX_INPUT_PINS) {
+        //By pins per molecule (i.e. available pins on primitives, not pins in use)
+        int max_molecule_pins = 0;
+        auto molecule_rng = atom_molecules.equal_range(blk);
+        for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
+            const t_pack_molecule* mol = kv.second;
+
+            const t_molecule_stats molecule_stats = calc_molecule_stats(mol);
+
+            //Keep the max over all molecules associated with the atom
+            int molecule_pins = 0;
+            if (seed_type == e_cluster_seed::MAX_PINS) {
+                //All pins
+                molecule_pins = molecule_stats.num_pins;
+            } else {
+                VTR_ASSERT(seed_type == e_cluster_seed::MAX_INPUT_PINS);
+                //Input pins only
+                molecule_pins = molecule_stats.num_input_pins;
             }
-            atom_gains[blk] = max_molecule_pins;
+
+            //Keep the max over all molecules associated with the atom
+            max_molecule_pins = std::max(max_molecule_pins, molecule_pins);
         }
+        return max_molecule_pins;
 
     } else if (seed_type == e_cluster_seed::BLEND2) {
-        for (auto blk : atom_ctx.nlist.blocks()) {
-            float max_gain = 0;
-            auto molecule_rng = atom_molecules.equal_range(blk);
-            for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
-                const t_pack_molecule* mol = kv.second;
+        float max_gain = 0;
+        auto molecule_rng = atom_molecules.equal_range(blk);
+        for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
+            const t_pack_molecule* mol = kv.second;
 
-                const t_molecule_stats molecule_stats = calc_molecule_stats(mol);
+            const t_molecule_stats molecule_stats = calc_molecule_stats(mol);
 
-                float pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_pins, max_molecule_stats.num_pins);
-                float input_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_input_pins, max_molecule_stats.num_input_pins);
-                float output_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_output_pins, max_molecule_stats.num_output_pins);
-                float used_ext_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_used_ext_pins, max_molecule_stats.num_used_ext_pins);
-                float used_ext_input_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_used_ext_inputs, max_molecule_stats.num_used_ext_inputs);
-                float used_ext_output_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_used_ext_outputs, max_molecule_stats.num_used_ext_outputs);
-                float num_blocks_ratio = vtr::safe_ratio<float>(molecule_stats.num_blocks, max_molecule_stats.num_blocks);
-                float criticality = atom_criticality[blk];
+            float pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_pins, max_molecule_stats.num_pins);
+            float input_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_input_pins, max_molecule_stats.num_input_pins);
+            float output_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_output_pins, max_molecule_stats.num_output_pins);
+            float used_ext_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_used_ext_pins, max_molecule_stats.num_used_ext_pins);
+            float used_ext_input_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_used_ext_inputs, max_molecule_stats.num_used_ext_inputs);
+            float used_ext_output_pin_ratio = vtr::safe_ratio<float>(molecule_stats.num_used_ext_outputs, max_molecule_stats.num_used_ext_outputs);
+            float num_blocks_ratio = vtr::safe_ratio<float>(molecule_stats.num_blocks, max_molecule_stats.num_blocks);
+            float criticality = atom_criticality[blk];
 
-                constexpr float PIN_WEIGHT = 0.;
-                constexpr float INPUT_PIN_WEIGHT = 0.5;
-                constexpr float OUTPUT_PIN_WEIGHT = 0.;
-                constexpr float USED_PIN_WEIGHT = 0.;
-                constexpr float USED_INPUT_PIN_WEIGHT = 0.2;
-                constexpr float USED_OUTPUT_PIN_WEIGHT = 0.;
-                constexpr float BLOCKS_WEIGHT = 0.2;
-                constexpr float CRITICALITY_WEIGHT = 0.1;
+            constexpr float PIN_WEIGHT = 0.;
+            constexpr float INPUT_PIN_WEIGHT = 0.5;
+            constexpr float OUTPUT_PIN_WEIGHT = 0.;
+            constexpr float USED_PIN_WEIGHT = 0.;
+            constexpr float USED_INPUT_PIN_WEIGHT = 0.2;
+            constexpr float USED_OUTPUT_PIN_WEIGHT = 0.;
+            constexpr float BLOCKS_WEIGHT = 0.2;
+            constexpr float CRITICALITY_WEIGHT = 0.1;
 
-                float gain = PIN_WEIGHT * pin_ratio
-                             + INPUT_PIN_WEIGHT * input_pin_ratio
-                             + OUTPUT_PIN_WEIGHT * output_pin_ratio
+            float gain = PIN_WEIGHT * pin_ratio
+                         + INPUT_PIN_WEIGHT * input_pin_ratio
+                         + OUTPUT_PIN_WEIGHT * output_pin_ratio
 
-                             + USED_PIN_WEIGHT * used_ext_pin_ratio
-                             + USED_INPUT_PIN_WEIGHT * used_ext_input_pin_ratio
-                             + USED_OUTPUT_PIN_WEIGHT * used_ext_output_pin_ratio
+                         + USED_PIN_WEIGHT * used_ext_pin_ratio
+                         + USED_INPUT_PIN_WEIGHT * used_ext_input_pin_ratio
+                         + USED_OUTPUT_PIN_WEIGHT * used_ext_output_pin_ratio
 
-                             + BLOCKS_WEIGHT * num_blocks_ratio
-                             + CRITICALITY_WEIGHT * criticality;
+                         + BLOCKS_WEIGHT * num_blocks_ratio
+                         + CRITICALITY_WEIGHT * criticality;
 
-                max_gain = std::max(max_gain, gain);
-            }
-
-            atom_gains[blk] = max_gain;
+            max_gain = std::max(max_gain, gain);
         }
 
-    } else {
-        VPR_FATAL_ERROR(VPR_ERROR_PACK, "Unrecognized cluster seed type");
-    }
-
-    //Sort seeds in descending order of gain (i.e. highest gain first)
-    //
-    // Note that we use a *stable* sort here. It has been observed that different
-    // standard library implementations (e.g. gcc-4.9 vs gcc-5) use sorting algorithms
-    // which produce different orderings for seeds of equal gain (which is allowed with
-    // std::sort which does not specify how equal values are handled). Using a stable
-    // sort ensures that regardless of the underlying sorting algorithm the same seed
-    // order is produced regardless of compiler.
-    auto by_descending_gain = [&](const AtomBlockId lhs, const AtomBlockId rhs) {
-        return atom_gains[lhs] > atom_gains[rhs];
-    };
-    std::stable_sort(seed_atoms.begin(), seed_atoms.end(), by_descending_gain);
-
-    if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_CLUSTERING_BLOCK_CRITICALITIES)) {
-        print_seed_gains(getEchoFileName(E_ECHO_CLUSTERING_BLOCK_CRITICALITIES), seed_atoms, atom_gains, atom_criticality);
+        return max_gain;
     }
 
-    return seed_atoms;
+    VPR_FATAL_ERROR(VPR_ERROR_PACK, "Unrecognized cluster seed type");
+    return 0.;
 }
 
-static t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules, const std::vector<AtomBlockId> seed_atoms) {
+static t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules, const std::vector<AtomBlockId>& seed_atoms) {
     auto& atom_ctx = g_vpr_ctx.atom();
 
     while (*seedindex < static_cast<int>(seed_atoms.size())) {
@@ -2722,7 +2806,7 @@ static t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std
  * + molecule_base_gain*some_factor
  * - introduced_input_nets_of_unrelated_blocks_pulled_in_by_molecule*some_other_factor
  */
-static float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>& blk_gain) {
+static float get_molecule_gain(t_pack_molecule* molecule, t_gain_store& blk_gain) {
     float gain;
     int i;
     int num_introduced_inputs_of_indirectly_related_block;
@@ -2870,30 +2954,30 @@ static void compute_and_mark_lookahead_pins_used(const AtomBlockId blk_id) {
 static void compute_and_mark_lookahead_pins_used_for_pin(const t_pb_graph_pin* pb_graph_pin, const t_pb* primitive_pb, const AtomNetId net_id) {
     auto& atom_ctx = g_vpr_ctx.atom();
 
-    // starting from the parent pb of the input primitive go up in the hierarchy till the root block
-    for (auto cur_pb = primitive_pb->parent_pb; cur_pb; cur_pb = cur_pb->parent_pb) {
-        const auto depth = cur_pb->pb_graph_node->pb_type->depth;
-        const auto pin_class = pb_graph_pin->parent_pin_class[depth];
-        VTR_ASSERT(pin_class != OPEN);
-
-        const auto driver_blk_id = atom_ctx.nlist.net_driver_block(net_id);
-
-        // if this primitive pin is an input pin
-        if (pb_graph_pin->port->type == IN_PORT) {
-            /* find location of net driver if exist in clb, NULL otherwise */
-            // find the driver of the input net connected to the pin being studied
-            const auto driver_pin_id = atom_ctx.nlist.net_driver(net_id);
-            // find the id of the atom occupying the input primitive_pb
-            const auto prim_blk_id = atom_ctx.lookup.pb_atom(primitive_pb);
-            // find the pb block occupied by the driving atom
-            const auto driver_pb = atom_ctx.lookup.atom_pb(driver_blk_id);
-            // pb_graph_pin driving net_id in the driver pb block
-            t_pb_graph_pin* output_pb_graph_pin = nullptr;
-            // if the driver block is in the same clb as the input primitive block
-            if (atom_ctx.lookup.atom_clb(driver_blk_id) == atom_ctx.lookup.atom_clb(prim_blk_id)) {
-                // get pb_graph_pin driving the given net
-                output_pb_graph_pin = get_driver_pb_graph_pin(driver_pb, driver_pin_id);
-            }
+    const auto driver_blk_id = atom_ctx.nlist.net_driver_block(net_id);
+
+    // if this primitive pin is an input pin
+    if (pb_graph_pin->port->type == IN_PORT) {
+        /* find location of net driver if exist in clb, NULL otherwise */
+        // find the driver of the input net connected to the pin being studied
+        const auto driver_pin_id = atom_ctx.nlist.net_driver(net_id);
+        // find the id of the atom occupying the input primitive_pb
+        const auto prim_blk_id = atom_ctx.lookup.pb_atom(primitive_pb);
+        // find the pb block occupied by the driving atom
+        const auto driver_pb = atom_ctx.lookup.atom_pb(driver_blk_id);
+        // pb_graph_pin driving net_id in the driver pb block
+        t_pb_graph_pin* output_pb_graph_pin = nullptr;
+        // if the driver block is in the same clb as the input primitive block
+        if (atom_ctx.lookup.atom_clb(driver_blk_id) == atom_ctx.lookup.atom_clb(prim_blk_id)) {
+            // get pb_graph_pin driving the given net
+            output_pb_graph_pin = get_driver_pb_graph_pin(driver_pb, driver_pin_id);
+        }
+
+        // starting from the parent pb of the input primitive go up in the hierarchy till the root block
+        for (auto cur_pb = primitive_pb->parent_pb; cur_pb; cur_pb = cur_pb->parent_pb) {
+            const auto depth = cur_pb->pb_graph_node->pb_type->depth;
+            const auto pin_class = pb_graph_pin->parent_pin_class[depth];
+            VTR_ASSERT(pin_class != OPEN);
 
             bool is_reachable = false;
 
@@ -2924,15 +3008,28 @@ static void compute_and_mark_lookahead_pins_used_for_pin(const t_pb_graph_pin* p
                     cur_pb->pb_stats->lookahead_input_pins_used[pin_class].push_back(net_id);
                 }
             }
-        } else {
-            VTR_ASSERT(pb_graph_pin->port->type == OUT_PORT);
-            /*
-             * Determine if this net (which is driven from within this cluster) leaves this cluster
-             * (and hence uses an output pin).
-             */
+        }
+    } else {
+        VTR_ASSERT(pb_graph_pin->port->type == OUT_PORT);
+        /*
+         * Determine if this net (which is driven from within this cluster) leaves this cluster
+         * (and hence uses an output pin).
+         */
+
+        const int num_net_sinks = static_cast<int>(atom_ctx.nlist.net_sinks(net_id).size());
+
+        /* Whether every sink of the net lives in the driver's cluster does not
+         * depend on the hierarchy depth, so the sink scan is done (lazily) once
+         * and shared by all levels below */
+        bool sink_locations_known = false;
+        bool all_sinks_in_cur_cluster = false;
+
+        for (auto cur_pb = primitive_pb->parent_pb; cur_pb; cur_pb = cur_pb->parent_pb) {
+            const auto depth = cur_pb->pb_graph_node->pb_type->depth;
+            const auto pin_class = pb_graph_pin->parent_pin_class[depth];
+            VTR_ASSERT(pin_class != OPEN);
 
             bool net_exits_cluster = true;
-            int num_net_sinks = static_cast<int>(atom_ctx.nlist.net_sinks(net_id).size());
 
             if (pb_graph_pin->num_connectable_primitive_input_pins[depth] >= num_net_sinks) {
                 //It is possible the net is completely absorbed in the cluster,
@@ -2954,14 +3051,17 @@ static void compute_and_mark_lookahead_pins_used_for_pin(const t_pb_graph_pin* p
                  */
 
                 //Check if all the net sinks are, in fact, inside this cluster
-                bool all_sinks_in_cur_cluster = true;
-                ClusterBlockId driver_clb = atom_ctx.lookup.atom_clb(driver_blk_id);
-                for (auto pin_id : atom_ctx.nlist.net_sinks(net_id)) {
-                    auto sink_blk_id = atom_ctx.nlist.pin_block(pin_id);
-                    if (atom_ctx.lookup.atom_clb(sink_blk_id) != driver_clb) {
-                        all_sinks_in_cur_cluster = false;
-                        break;
+                if (!sink_locations_known) {
+                    all_sinks_in_cur_cluster = true;
+                    ClusterBlockId driver_clb = atom_ctx.lookup.atom_clb(driver_blk_id);
+                    for (auto pin_id : atom_ctx.nlist.net_sinks(net_id)) {
+                        auto sink_blk_id = atom_ctx.nlist.pin_block(pin_id);
+                        if (atom_ctx.lookup.atom_clb(sink_blk_id) != driver_clb) {
+                            all_sinks_in_cur_cluster = false;
+                            break;
+                        }
                     }
+                    sink_locations_known = true;
                 }
 
                 if (all_sinks_in_cur_cluster) {
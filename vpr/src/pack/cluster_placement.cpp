@@ -67,6 +67,9 @@ t_cluster_placement_stats* alloc_and_load_cluster_placement_stats() {
             cluster_placement_stats_list[type.index].valid_primitives = (t_cluster_placement_primitive**)vtr::calloc(
                 get_max_primitives_in_pb_type(type.pb_type) + 1,
                 sizeof(t_cluster_placement_primitive*)); /* too much memory allocated but shouldn't be a problem */
+            cluster_placement_stats_list[type.index].num_avail_primitives = (int*)vtr::calloc(
+                get_max_primitives_in_pb_type(type.pb_type) + 1,
+                sizeof(int));
 
             cluster_placement_stats_list[type.index].curr_molecule = nullptr;
             load_cluster_placement_stats_for_pb_graph_node(&cluster_placement_stats_list[type.index],
@@ -96,15 +99,50 @@ bool get_next_primitive_list(t_cluster_placement_stats* cluster_placement_stats,
                              t_pb_graph_node** primitives_list) {
     t_cluster_placement_primitive *cur, *next, *best, *before_best, *prev;
     int i;
+    int best_index;
     float cost, lowest_cost;
     best = nullptr;
     before_best = nullptr;
+    best_index = OPEN;
 
     if (cluster_placement_stats->curr_molecule != molecule) {
         /* New block, requeue tried primitives and in-flight primitives */
         flush_intermediate_queues(cluster_placement_stats);
 
         cluster_placement_stats->curr_molecule = molecule;
+
+        /* Fast feasibility precheck: with the intermediate queues flushed every primitive
+         * that could host an atom of this molecule sits in a valid_primitives list, so if
+         * any atom block has no compatible type with available primitives the molecule is
+         * guaranteed infeasible and we can reject it before paying for the
+         * try_place_molecule walks below.  num_avail_primitives over-counts primitives
+         * flagged invalid but not yet lazily removed, so this never rejects a feasible
+         * molecule. */
+        for (int iblk = 0; iblk < get_array_size_of_molecule(molecule); iblk++) {
+            AtomBlockId blk_id = molecule->atom_block_ids[iblk];
+            if (!blk_id) {
+                continue;
+            }
+            bool avail = false;
+            for (i = 0; i < cluster_placement_stats->num_pb_types; i++) {
+                if (cluster_placement_stats->num_avail_primitives[i] == 0
+                    || cluster_placement_stats->valid_primitives[i]->next_primitive == nullptr) {
+                    continue;
+                }
+                if (primitive_type_feasible(blk_id,
+                                            cluster_placement_stats->valid_primitives[i]->next_primitive->pb_graph_node->pb_type)) {
+                    avail = true;
+                    break;
+                }
+            }
+            if (!avail) {
+                /* failed to find a placement */
+                for (i = 0; i < molecule->num_blocks; i++) {
+                    primitives_list[i] = nullptr;
+                }
+                return false;
+            }
+        }
     } else {
         /* Hack! Same failed molecule may re-enter if upper stream functions suck,
          * I'm going to make the molecule selector more intelligent.
@@ -145,6 +183,7 @@ bool get_next_primitive_list(t_cluster_placement_stats* cluster_placement_stats,
                     prev->next_primitive = cur->next_primitive;
                     cur->next_primitive = cluster_placement_stats->invalid;
                     cluster_placement_stats->invalid = cur;
+                    cluster_placement_stats->num_avail_primitives[i]--;
                     cur = prev->next_primitive;
                 }
                 if (cur == nullptr) {
@@ -158,6 +197,7 @@ bool get_next_primitive_list(t_cluster_placement_stats* cluster_placement_stats,
                     lowest_cost = cost;
                     best = cur;
                     before_best = prev;
+                    best_index = i;
                 }
                 prev = cur;
                 cur = cur->next_primitive;
@@ -178,6 +218,7 @@ bool get_next_primitive_list(t_cluster_placement_stats* cluster_placement_stats,
         cluster_placement_stats->in_flight = best;
         before_best->next_primitive = best->next_primitive;
         best->next_primitive = nullptr;
+        cluster_placement_stats->num_avail_primitives[best_index]--;
     }
 
     if (best == nullptr) {
@@ -254,6 +295,7 @@ void free_cluster_placement_stats(t_cluster_placement_stats* cluster_placement_s
             free(cluster_placement_stats_list[index].valid_primitives[j]);
         }
         free(cluster_placement_stats_list[index].valid_primitives);
+        free(cluster_placement_stats_list[index].num_avail_primitives);
     }
     free(cluster_placement_stats_list);
 }
@@ -280,12 +322,14 @@ static void requeue_primitive(t_cluster_placement_stats* cluster_placement_stats
             success = true;
             cluster_placement_primitive->next_primitive = cluster_placement_stats->valid_primitives[i]->next_primitive;
             cluster_placement_stats->valid_primitives[i]->next_primitive = cluster_placement_primitive;
+            cluster_placement_stats->num_avail_primitives[i]++;
         }
     }
     if (success == false) {
         VTR_ASSERT(null_index != OPEN);
         cluster_placement_primitive->next_primitive = cluster_placement_stats->valid_primitives[null_index]->next_primitive;
         cluster_placement_stats->valid_primitives[null_index]->next_primitive = cluster_placement_primitive;
+        cluster_placement_stats->num_avail_primitives[null_index]++;
     }
 }
 
@@ -320,6 +364,7 @@ static void load_cluster_placement_stats_for_pb_graph_node(t_cluster_placement_s
                 success = true;
                 placement_primitive->next_primitive = cluster_placement_stats->valid_primitives[i]->next_primitive;
                 cluster_placement_stats->valid_primitives[i]->next_primitive = placement_primitive;
+                cluster_placement_stats->num_avail_primitives[i]++;
             }
             i++;
         }
@@ -697,6 +742,7 @@ bool exists_free_primitive_for_atom_block(t_cluster_placement_stats* cluster_pla
                     prev->next_primitive = cur->next_primitive;
                     cur->next_primitive = cluster_placement_stats->invalid;
                     cluster_placement_stats->invalid = cur;
+                    cluster_placement_stats->num_avail_primitives[i]--;
                     cur = prev->next_primitive;
                 }
                 if (cur == nullptr) {
@@ -20,6 +20,7 @@
 #include <cmath>
 
 #include "vtr_assert.h"
+#include "vtr_hash.h"
 #include "vtr_log.h"
 
 #include "vpr_error.h"
@@ -104,6 +105,7 @@ static void expand_node_all_modes(t_lb_router_data* router_data, t_expansion_nod
 
 static bool add_to_rt(t_lb_trace* rt, int node_index, t_lb_router_data* router_data, int irt_net);
 static bool is_route_success(t_lb_router_data* router_data);
+static size_t compute_intra_lb_route_signature(const t_lb_router_data* router_data, bool expand_all_modes);
 static t_lb_trace* find_node_in_rt(t_lb_trace* rt, int rt_index);
 static void reset_explored_node_tb(t_lb_router_data* router_data);
 static void save_and_reset_lb_route(t_lb_router_data* router_data);
@@ -388,6 +390,23 @@ static bool try_expand_nodes(t_lb_router_data* router_data,
     return is_impossible;
 }
 
+/* Hashes the current intra-LB netlist state (which nets must be routed, and
+ * to which terminals) together with the mode expansion setting. Used to key
+ * the memo of states already proven unroutable. */
+static size_t compute_intra_lb_route_signature(const t_lb_router_data* router_data, bool expand_all_modes) {
+    const std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+
+    size_t hash = expand_all_modes ? 1 : 0;
+    for (const t_intra_lb_net& lb_net : lb_nets) {
+        vtr::hash_combine(hash, size_t(lb_net.atom_net_id));
+        vtr::hash_combine(hash, lb_net.terminals.size());
+        for (int terminal : lb_net.terminals) {
+            vtr::hash_combine(hash, terminal);
+        }
+    }
+    return hash;
+}
+
 /* Attempt to route routing driver/targets on the current architecture
  * Follows pathfinder negotiated congestion algorithm
  */
@@ -402,6 +421,20 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
     mode_status->is_mode_conflict = false;
     mode_status->try_expand_all_modes = false;
 
+    /* Check the memo of previously failed attempts: if this exact intra-LB
+     * netlist state (under the same mode expansion setting) was already
+     * proven unroutable, replay the verdict instead of re-deriving it */
+    size_t route_state_signature = compute_intra_lb_route_signature(router_data, mode_status->expand_all_modes);
+    auto memo_itr = router_data->infeasible_route_memo.find(route_state_signature);
+    if (memo_itr != router_data->infeasible_route_memo.end()) {
+        mode_status->is_mode_conflict = (memo_itr->second & 0x1) != 0;
+        mode_status->try_expand_all_modes = (memo_itr->second & 0x2) != 0;
+        if (mode_status->try_expand_all_modes) {
+            mode_status->expand_all_modes = true;
+        }
+        return false;
+    }
+
     t_expansion_node exp_node;
 
     /* Stores state info during route */
@@ -525,6 +558,14 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
             free_lb_net_rt(lb_nets[inet].rt_tree);
             lb_nets[inet].rt_tree = nullptr;
         }
+
+        /* Remember this state as unroutable, along with the mode status flags
+         * reported, so retrying the same candidate against an unchanged
+         * cluster state short-circuits */
+        unsigned char verdict_flags = 0;
+        if (mode_status->is_mode_conflict) verdict_flags |= 0x1;
+        if (mode_status->try_expand_all_modes) verdict_flags |= 0x2;
+        router_data->infeasible_route_memo.emplace(route_state_signature, verdict_flags);
     }
     return is_routed;
 }
@@ -6,6 +6,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <sstream>
 #include <vector>
 
 #include "vtr_assert.h"
@@ -545,6 +547,12 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
         pb_graph_pin_lookup_from_index_by_type[itype] = alloc_and_load_pb_graph_pin_lookup_from_index(&device_ctx.logical_block_types[itype]);
     }
 
+    /* The netlist is streamed out one cluster block at a time instead of being
+     * materialized as a single XML document: the top-level wrapper and each
+     * cluster subtree are built as separate pugixml trees (so escaping stays
+     * correct) and emitted sequentially through a large buffered stream.  This
+     * keeps peak memory proportional to the largest cluster and issues large
+     * sequential writes. */
     pugi::xml_document out_xml;
 
     pugi::xml_node block_node = out_xml.append_child("block");
@@ -599,14 +607,36 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
         block_node.append_child("clocks").text().set(vtr::join(clocks.begin(), clocks.end(), " ").c_str());
     }
 
+    std::vector<char> stream_buf(1 << 20);
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(stream_buf.data(), stream_buf.size());
+    out.open(out_fname);
+    if (!out) {
+        vpr_throw(VPR_ERROR_PACK, __FILE__, __LINE__,
+                  "Could not open file '%s' to write clustering.\n", out_fname);
+    }
+
+    /* Emit the wrapper document minus its closing tag, so the per-cluster
+     * subtrees printed below nest inside the top-level block element */
+    std::ostringstream header;
+    out_xml.save(header);
+    std::string header_str = header.str();
+    const std::string close_tag = "</block>\n";
+    VTR_ASSERT(header_str.size() > close_tag.size()
+               && header_str.compare(header_str.size() - close_tag.size(), close_tag.size(), close_tag) == 0);
+    out.write(header_str.data(), header_str.size() - close_tag.size());
+
     if (skip_clustering == false) {
         for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
             /* TODO: Must do check that total CLB pins match top-level pb pins, perhaps check this earlier? */
-            clustering_xml_block(block_node, cluster_ctx.clb_nlist.block_type(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id), size_t(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route);
+            pugi::xml_document block_doc;
+            clustering_xml_block(block_doc, cluster_ctx.clb_nlist.block_type(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id), size_t(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route);
+            block_doc.document_element().print(out, "\t", pugi::format_default, pugi::encoding_auto, 1);
         }
     }
 
-    out_xml.save_file(out_fname);
+    out << close_tag;
+    out.close();
 
     print_stats();
 
@@ -28,6 +28,7 @@
 
 static std::unordered_set<AtomNetId> alloc_and_load_is_clock(bool global_clocks);
 static bool try_size_device_grid(const t_arch& arch, const std::map<t_logical_block_type_ptr, size_t>& num_type_instances, float target_device_utilization, std::string device_layout_name);
+static std::map<t_logical_block_type_ptr, size_t> estimate_min_type_instances(const std::unordered_map<AtomBlockId, t_pb_graph_node*>& expected_lowest_cost_pb_gnode);
 
 static t_ext_pin_util_targets parse_target_external_pin_util(std::vector<std::string> specs);
 static std::string target_external_pin_util_to_string(const t_ext_pin_util_targets& ext_pin_utils);
@@ -49,7 +50,7 @@ bool try_pack(t_packer_opts* packer_opts,
     int num_models;
     t_pack_patterns* list_of_packing_patterns;
     int num_packing_patterns;
-    t_pack_molecule *list_of_pack_molecules, *cur_pack_molecule;
+    t_pack_molecule* list_of_pack_molecules;
     VTR_LOG("Begin packing '%s'.\n", packer_opts->blif_file_name.c_str());
 
     /* determine number of models in the architecture */
@@ -118,6 +119,28 @@ bool try_pack(t_packer_opts* packer_opts,
         balance_block_type_util = false;
     }
 
+    /* Pre-pack feasibility estimate: if even an optimistic lower bound on the
+     * cluster instances this netlist needs does not fit the targeted device,
+     * the first packing attempt with the default density settings is
+     * guaranteed to fail.  Enable the AUTO density settings up front instead
+     * of discovering this after a full wasted pass. */
+    if (packer_opts->allow_unrelated_clustering == e_unrelated_clustering::AUTO
+        || packer_opts->balance_block_type_utilization == e_balance_block_type_util::AUTO) {
+        auto min_type_instances = estimate_min_type_instances(expected_lowest_cost_pb_gnode);
+        if (!min_type_instances.empty()
+            && !try_size_device_grid(*arch, min_type_instances, packer_opts->target_device_utilization, packer_opts->device_layout)) {
+            if (packer_opts->allow_unrelated_clustering == e_unrelated_clustering::AUTO) {
+                allow_unrelated_clustering = true;
+            }
+            if (packer_opts->balance_block_type_utilization == e_balance_block_type_util::AUTO) {
+                balance_block_type_util = true;
+            }
+            VTR_LOG("Pre-packing estimate indicates device will not fit with default settings. Packing with: unrelated_logic_clustering=%s balance_block_type_util=%s\n",
+                    (allow_unrelated_clustering ? "true" : "false"),
+                    (balance_block_type_util ? "true" : "false"));
+        }
+    }
+
     int pack_iteration = 1;
 
     while (true) {
@@ -191,12 +214,8 @@ bool try_pack(t_packer_opts* packer_opts,
     /*free list_of_pack_molecules*/
     free_list_of_pack_patterns(list_of_packing_patterns, num_packing_patterns);
 
-    cur_pack_molecule = list_of_pack_molecules;
-    while (cur_pack_molecule != nullptr) {
-        cur_pack_molecule = list_of_pack_molecules->next;
-        delete list_of_pack_molecules;
-        list_of_pack_molecules = cur_pack_molecule;
-    }
+    free_pack_molecules();
+    list_of_pack_molecules = nullptr;
 
     VTR_LOG("\n");
     VTR_LOG("Netlist conversion complete.\n");
@@ -295,6 +314,55 @@ static bool try_size_device_grid(const t_arch& arch, const std::map<t_logical_bl
     return fits_on_device;
 }
 
+/* Optimistically estimates the number of cluster instances of each logical
+ * block type the netlist requires, assuming every atom is implemented by its
+ * expected lowest cost primitive (determined during pre-packing) and that
+ * clusters fill to full primitive capacity.  This is a lower bound on the
+ * clusters any packing can produce, so a device that cannot fit it cannot fit
+ * the real packing either. */
+static std::map<t_logical_block_type_ptr, size_t> estimate_min_type_instances(const std::unordered_map<AtomBlockId, t_pb_graph_node*>& expected_lowest_cost_pb_gnode) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    //Count atoms per primitive pb_type within each logical block type.
+    //The pair holds (num atoms expected on this primitive, primitives of this
+    //type per cluster).
+    std::map<t_logical_block_type_ptr, std::map<const t_pb_type*, std::pair<size_t, int>>> atom_counts;
+    for (const auto& kv : expected_lowest_cost_pb_gnode) {
+        const t_pb_graph_node* gnode = kv.second;
+        if (gnode == nullptr) {
+            continue;
+        }
+
+        const t_pb_graph_node* root = gnode;
+        while (root->parent_pb_graph_node != nullptr) {
+            root = root->parent_pb_graph_node;
+        }
+
+        for (const auto& type : device_ctx.logical_block_types) {
+            if (type.pb_graph_head == root) {
+                auto& count = atom_counts[&type][gnode->pb_type];
+                ++count.first;
+                count.second = gnode->total_primitive_count;
+                break;
+            }
+        }
+    }
+
+    //A type needs at least enough clusters to hold its most demanded primitive
+    std::map<t_logical_block_type_ptr, size_t> min_type_instances;
+    for (const auto& type_entry : atom_counts) {
+        size_t num_instances = 0;
+        for (const auto& prim_entry : type_entry.second) {
+            size_t num_atoms = prim_entry.second.first;
+            size_t prims_per_cluster = std::max(prim_entry.second.second, 1);
+            num_instances = std::max(num_instances, (num_atoms + prims_per_cluster - 1) / prims_per_cluster);
+        }
+        min_type_instances[type_entry.first] = num_instances;
+    }
+
+    return min_type_instances;
+}
+
 static t_ext_pin_util_targets parse_target_external_pin_util(std::vector<std::string> specs) {
     t_ext_pin_util_targets targets(1., 1.);
 
@@ -6,6 +6,8 @@
  *
  * Defines core data structures used in packing
  */
+#include <cstddef>
+#include <limits>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -31,17 +33,109 @@ const std::vector<const char*> lb_rr_type_str{
  * Packing Algorithm Data Structures
  ***************************************************************************/
 
+/* Assigns compact indices to the atom blocks touched while packing the
+ * currently open cluster (the candidate "window"). The remap is backed by a
+ * single atom-indexed array reused across clusters: open_window() bumps an
+ * epoch stamp instead of clearing, so starting a new window is O(1). The
+ * t_gain_store instances below index their flat value arrays with these
+ * window indices, keeping them proportional to the number of touched atoms
+ * rather than the whole netlist. */
+class t_pack_window {
+  public:
+    static constexpr size_t INVALID_INDEX = std::numeric_limits<size_t>::max();
+
+    /* Starts a new (empty) window covering num_atoms atom blocks */
+    void open_window(size_t num_atoms) {
+        if (window_index_.size() != num_atoms) {
+            window_index_.assign(num_atoms, 0);
+            stamps_.assign(num_atoms, 0);
+            epoch_ = 0;
+        }
+        if (++epoch_ == 0) { //Stamp wrap-around: explicitly invalidate stale stamps
+            std::fill(stamps_.begin(), stamps_.end(), 0);
+            epoch_ = 1;
+        }
+        num_entries_ = 0;
+    }
+
+    /* Returns the window index of blk, assigning the next free index on first touch */
+    size_t index_of(AtomBlockId blk) {
+        size_t iatom = size_t(blk);
+        if (stamps_[iatom] != epoch_) {
+            stamps_[iatom] = epoch_;
+            window_index_[iatom] = num_entries_++;
+        }
+        return window_index_[iatom];
+    }
+
+    /* Returns the window index of blk, or INVALID_INDEX if blk is not in the window */
+    size_t lookup(AtomBlockId blk) const {
+        size_t iatom = size_t(blk);
+        if (iatom >= stamps_.size() || stamps_[iatom] != epoch_) {
+            return INVALID_INDEX;
+        }
+        return window_index_[iatom];
+    }
+
+  private:
+    std::vector<size_t> window_index_; /* [0..num_atoms-1] window index of each atom (valid iff stamp matches epoch) */
+    std::vector<unsigned> stamps_;     /* [0..num_atoms-1] epoch the window index was assigned in */
+    unsigned epoch_ = 0;
+    size_t num_entries_ = 0;
+};
+
+/* Flat replacement for the per-PB std::map<AtomBlockId, float> gain maps.
+ * Values live in a dense array indexed by the shared pack window's compact
+ * atom indices, so lookups and updates are array accesses and no per-entry
+ * tree nodes are allocated or rebalanced. The count()/operator[] interface
+ * mirrors the std::map usage it replaces. */
+class t_gain_store {
+  public:
+    void set_window(t_pack_window* window) { window_ = window; }
+
+    /* Returns 1 if blk has an entry, 0 otherwise (std::map::count() compatible) */
+    int count(AtomBlockId blk) const {
+        if (!window_) return 0;
+        size_t idx = window_->lookup(blk);
+        return (idx < valid_.size() && valid_[idx]) ? 1 : 0;
+    }
+
+    /* Returns the entry for blk, zero-initializing it on first access */
+    float& operator[](AtomBlockId blk) {
+        size_t idx = window_->index_of(blk);
+        if (idx >= values_.size()) {
+            values_.resize(idx + 1, 0.);
+            valid_.resize(idx + 1, false);
+        }
+        if (!valid_[idx]) {
+            valid_[idx] = true;
+            values_[idx] = 0.;
+        }
+        return values_[idx];
+    }
+
+    void clear() {
+        values_.clear();
+        valid_.clear();
+    }
+
+  private:
+    t_pack_window* window_ = nullptr;
+    std::vector<float> values_; /* [0..max touched window index] entry values */
+    std::vector<char> valid_;   /* [0..max touched window index] whether this store touched the index */
+};
+
 /* Stores statistical information for a physical cluster_ctx.blocks such as costs and usages */
 struct t_pb_stats {
     /* Packing statistics */
-    std::map<AtomBlockId, float> gain; /* Attraction (inverse of cost) function */
+    t_gain_store gain; /* Attraction (inverse of cost) function */
 
-    std::map<AtomBlockId, float> timinggain;     /* The timing criticality score of this atom cluster_ctx.blocks.
-                                                  * Determined by the most critical atom net
-                                                  * between this atom cluster_ctx.blocks and any atom cluster_ctx.blocks in
-                                                  * the current pb */
-    std::map<AtomBlockId, float> connectiongain; /* Weighted sum of connections to attraction function */
-    std::map<AtomBlockId, float> sharinggain;    /* How many nets on an atom cluster_ctx.blocks are already in the pb under consideration */
+    t_gain_store timinggain;     /* The timing criticality score of this atom cluster_ctx.blocks.
+                                  * Determined by the most critical atom net
+                                  * between this atom cluster_ctx.blocks and any atom cluster_ctx.blocks in
+                                  * the current pb */
+    t_gain_store connectiongain; /* Weighted sum of connections to attraction function */
+    t_gain_store sharinggain;    /* How many nets on an atom cluster_ctx.blocks are already in the pb under consideration */
 
     /* This is the gain used for hill-climbing. It stores*
      * the reduction in the number of pins that adding this atom cluster_ctx.blocks to the the*
@@ -49,7 +143,7 @@ struct t_pb_stats {
      * addition of an atom cluster_ctx.blocks to a pb may reduce the number of inputs     *
      * required if it shares inputs with all other BLEs and it's output is  *
      * used by all other child pbs in this parent pb.                               */
-    std::map<AtomBlockId, float> hillgain;
+    t_gain_store hillgain;
 
     std::vector<AtomNetId> marked_nets;     //List of nets with the num_pins_of_net_in_pb and gain entries altered
     std::vector<AtomBlockId> marked_blocks; //List of blocks with the num_pins_of_net_in_pb and gain entries altered
@@ -249,6 +343,16 @@ struct t_lb_router_data {
     /* current congestion factor */
     float pres_con_fac;
 
+    /* Memoized infeasible-route verdicts. Key: hash of the current intra-LB
+     * netlist state (net terminals plus the mode expansion setting); value:
+     * the mode status flags the failing attempt reported (bit 0:
+     * is_mode_conflict, bit 1: try_expand_all_modes), replayed on a hit so
+     * the caller's mode-conflict retry logic behaves identically. Speculative
+     * packing retries the same candidate molecules against an unchanged
+     * cluster state, so proven-unroutable states recur and can be rejected
+     * without re-running the pathfinder router. */
+    std::unordered_map<std::size_t, unsigned char> infeasible_route_memo;
+
     t_lb_router_data() {
         lb_type_graph = nullptr;
         lb_rr_node_stats = nullptr;
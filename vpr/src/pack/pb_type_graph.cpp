@@ -14,6 +14,8 @@
 #include <cstdio>
 #include <cstring>
 #include <cinttypes>
+#include <mutex>
+#include <thread>
 
 #include "vtr_util.h"
 #include "vtr_assert.h"
@@ -25,6 +27,7 @@
 #include "vpr_types.h"
 
 #include "arch_types.h"
+#include "arch_util.h"
 #include "physical_types.h"
 #include "globals.h"
 #include "vpr_utils.h"
@@ -38,6 +41,10 @@
 static vtr::t_linked_vptr* edges_head;
 static vtr::t_linked_vptr* num_edges_head;
 
+/* Guards the edge memory tracking lists above, which are shared between the
+ * per-type pb graph builds when they run in parallel */
+static std::mutex edges_head_mutex;
+
 /* TODO: Software engineering decision needed: Move this file to libarch?
  *
  */
@@ -123,20 +130,60 @@ void alloc_and_load_all_pb_graphs(bool load_power_structures) {
     num_edges_head = nullptr;
     auto& device_ctx = g_vpr_ctx.mutable_device();
 
+    /* Each logical block type's pb graph is an independent structure referencing
+     * only that type's pb_type tree, so the per-type builds can proceed in
+     * parallel.  The only shared mutable state is the edge memory tracking
+     * lists, which are protected by edges_head_mutex. */
+    std::vector<t_logical_block_type*> types_to_build;
     for (auto& type : device_ctx.logical_block_types) {
         if (type.pb_type) {
-            type.pb_graph_head = (t_pb_graph_node*)vtr::calloc(1, sizeof(t_pb_graph_node));
-            int pin_count_in_cluster = 0;
-            alloc_and_load_pb_graph(type.pb_graph_head, nullptr,
-                                    type.pb_type, 0, load_power_structures, pin_count_in_cluster);
-            type.pb_graph_head->total_pb_pins = pin_count_in_cluster;
-            load_pin_classes_in_pb_graph_head(type.pb_graph_head);
+            types_to_build.push_back(&type);
         } else {
             type.pb_graph_head = nullptr;
             VTR_ASSERT(physical_tile_type(&type) == device_ctx.EMPTY_TYPE);
         }
     }
 
+    auto build_type_range = [&](size_t worker_id, size_t num_workers, std::exception_ptr& error) {
+        try {
+            for (size_t itype = worker_id; itype < types_to_build.size(); itype += num_workers) {
+                t_logical_block_type* type = types_to_build[itype];
+                type->pb_graph_head = (t_pb_graph_node*)vtr::calloc(1, sizeof(t_pb_graph_node));
+                int pin_count_in_cluster = 0;
+                alloc_and_load_pb_graph(type->pb_graph_head, nullptr,
+                                        type->pb_type, 0, load_power_structures, pin_count_in_cluster);
+                type->pb_graph_head->total_pb_pins = pin_count_in_cluster;
+                load_pin_classes_in_pb_graph_head(type->pb_graph_head);
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    };
+
+    size_t num_workers = std::min<size_t>(types_to_build.size(),
+                                          std::max(1u, std::thread::hardware_concurrency()));
+    if (num_workers > 1) {
+        std::vector<std::thread> workers;
+        std::vector<std::exception_ptr> worker_errors(num_workers);
+        for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+            workers.emplace_back(build_type_range, iworker, num_workers, std::ref(worker_errors[iworker]));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (auto& error : worker_errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    } else {
+        std::exception_ptr error;
+        build_type_range(0, 1, error);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
     errors = check_pb_graph();
     if (errors > 0) {
         VTR_LOG_ERROR("in pb graph");
@@ -235,7 +282,7 @@ static void alloc_and_load_pb_graph(t_pb_graph_node* pb_graph_node,
             VTR_ASSERT(pb_type->num_modes != 0 || pb_type->ports[i].is_clock);
         }
         if (pb_type->ports[i].type == IN_PORT && !pb_type->ports[i].is_clock) {
-            pb_graph_node->input_pins[i_input] = new t_pb_graph_pin[pb_type->ports[i].num_pins];
+            pb_graph_node->input_pins[i_input] = alloc_pb_graph_pin_array(pb_type->ports[i].num_pins);
             pb_graph_node->num_input_pins[i_input] = pb_type->ports[i].num_pins;
             for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                 pb_graph_node->input_pins[i_input][j].pin_number = j;
@@ -255,7 +302,7 @@ static void alloc_and_load_pb_graph(t_pb_graph_node* pb_graph_node,
             }
             i_input++;
         } else if (pb_type->ports[i].type == OUT_PORT) {
-            pb_graph_node->output_pins[i_output] = new t_pb_graph_pin[pb_type->ports[i].num_pins];
+            pb_graph_node->output_pins[i_output] = alloc_pb_graph_pin_array(pb_type->ports[i].num_pins);
             pb_graph_node->num_output_pins[i_output] = pb_type->ports[i].num_pins;
             for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                 pb_graph_node->output_pins[i_output][j].pin_number = j;
@@ -276,7 +323,7 @@ static void alloc_and_load_pb_graph(t_pb_graph_node* pb_graph_node,
             i_output++;
         } else {
             VTR_ASSERT(pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT);
-            pb_graph_node->clock_pins[i_clockport] = new t_pb_graph_pin[pb_type->ports[i].num_pins];
+            pb_graph_node->clock_pins[i_clockport] = alloc_pb_graph_pin_array(pb_type->ports[i].num_pins);
             pb_graph_node->num_clock_pins[i_clockport] = pb_type->ports[i].num_pins;
             for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                 pb_graph_node->clock_pins[i_clockport][j].pin_number = j;
@@ -713,14 +760,17 @@ static void alloc_and_load_complete_interc_edges(t_interconnect* interconnect,
     }
 
     edges = (t_pb_graph_edge*)vtr::calloc(in_count * out_count, sizeof(t_pb_graph_edge));
-    cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
-    cur->next = edges_head;
-    edges_head = cur;
-    cur->data_vptr = (void*)edges;
-    cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
-    cur->next = num_edges_head;
-    num_edges_head = cur;
-    cur->data_vptr = (void*)((intptr_t)in_count * out_count);
+    {
+        std::lock_guard<std::mutex> lock(edges_head_mutex);
+        cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
+        cur->next = edges_head;
+        edges_head = cur;
+        cur->data_vptr = (void*)edges;
+        cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
+        cur->next = num_edges_head;
+        num_edges_head = cur;
+        cur->data_vptr = (void*)((intptr_t)in_count * out_count);
+    }
 
     for (i_inset = 0; i_inset < num_input_sets; i_inset++) {
         for (i_inpin = 0; i_inpin < num_input_ptrs[i_inset]; i_inpin++) {
@@ -799,14 +849,17 @@ static void alloc_and_load_direct_interc_edges(t_interconnect* interconnect,
 
     /* Allocate memory for edges */
     t_pb_graph_edge* edges = (t_pb_graph_edge*)vtr::calloc(pins_per_set * num_output_sets, sizeof(t_pb_graph_edge));
-    vtr::t_linked_vptr* cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
-    cur->next = edges_head;
-    edges_head = cur;
-    cur->data_vptr = (void*)edges;
-    cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
-    cur->next = num_edges_head;
-    num_edges_head = cur;
-    cur->data_vptr = (void*)((intptr_t)num_input_ptrs[0]);
+    {
+        std::lock_guard<std::mutex> lock(edges_head_mutex);
+        vtr::t_linked_vptr* cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
+        cur->next = edges_head;
+        edges_head = cur;
+        cur->data_vptr = (void*)edges;
+        cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
+        cur->next = num_edges_head;
+        num_edges_head = cur;
+        cur->data_vptr = (void*)((intptr_t)num_input_ptrs[0]);
+    }
 
     /* Reallocate memory for pins and load connections between pins and record these updates in the edges */
     for (int ipin = 0; ipin < pins_per_set; ++ipin) {
@@ -880,14 +933,17 @@ static void alloc_and_load_mux_interc_edges(t_interconnect* interconnect,
     }
 
     edges = (t_pb_graph_edge*)vtr::calloc(num_input_sets, sizeof(t_pb_graph_edge));
-    cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
-    cur->next = edges_head;
-    edges_head = cur;
-    cur->data_vptr = (void*)edges;
-    cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
-    cur->next = num_edges_head;
-    num_edges_head = cur;
-    cur->data_vptr = (void*)((intptr_t)num_input_sets);
+    {
+        std::lock_guard<std::mutex> lock(edges_head_mutex);
+        cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
+        cur->next = edges_head;
+        edges_head = cur;
+        cur->data_vptr = (void*)edges;
+        cur = (vtr::t_linked_vptr*)vtr::malloc(sizeof(vtr::t_linked_vptr));
+        cur->next = num_edges_head;
+        num_edges_head = cur;
+        cur->data_vptr = (void*)((intptr_t)num_input_sets);
+    }
 
     for (i_inset = 0; i_inset < num_input_sets; i_inset++) {
         for (i_inpin = 0; i_inpin < num_input_ptrs[i_inset]; i_inpin++) {
@@ -12,8 +12,10 @@
 
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <map>
 #include <queue>
+#include <thread>
 #include <utility>
 
 #include "vtr_util.h"
@@ -30,6 +32,18 @@
 #include "vpr_utils.h"
 #include "echo_files.h"
 
+/* Below this many atom blocks the expected lowest cost primitive lookup is
+ * done serially; the work is too small to repay spawning worker threads. */
+constexpr size_t MIN_ATOMS_PER_PREPACK_WORKER = 65536;
+
+/* Arena holding every discovered pack molecule. Molecules are handed out by
+ * pointer (and threaded onto the molecule list / atom_molecules multimap as
+ * before) but live contiguously here instead of as individually new'd nodes,
+ * so discovery does not hammer the allocator and teardown is a single
+ * clear(). A speculatively allocated molecule that fails to expand is always
+ * the most recent entry, so it is returned by popping the back. */
+static std::deque<t_pack_molecule> f_molecule_arena;
+
 /*****************************************/
 /*Local Function Declaration			 */
 /*****************************************/
@@ -841,13 +855,58 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
      * If a block belongs to a molecule, then carrying the single atoms around can make the packing problem
      * more difficult because now it needs to consider splitting molecules.
      */
+    /* The expected lowest cost primitive for an atom is a pure search of the
+     * pb graphs, independent per atom, so on large netlists it is precomputed
+     * in parallel over contiguous block id ranges before the (serial)
+     * single-atom molecule pass below consumes the results. */
+    size_t num_blocks = atom_ctx.nlist.blocks().size();
+    std::vector<t_pb_graph_node*> lowest_cost_pb_gnode(num_blocks, nullptr);
+
+    auto compute_lowest_cost_range = [&](size_t start, size_t end) {
+        for (size_t iblk = start; iblk < end; ++iblk) {
+            lowest_cost_pb_gnode[iblk] = get_expected_lowest_cost_primitive_for_atom_block(AtomBlockId(iblk));
+        }
+    };
+
+    size_t num_workers = std::min<size_t>(std::thread::hardware_concurrency(),
+                                          num_blocks / MIN_ATOMS_PER_PREPACK_WORKER);
+    if (num_workers > 1) {
+        std::vector<std::thread> workers;
+        std::vector<std::exception_ptr> worker_errors(num_workers);
+
+        size_t blocks_per_worker = (num_blocks + num_workers - 1) / num_workers;
+        for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+            size_t start = iworker * blocks_per_worker;
+            size_t end = std::min(start + blocks_per_worker, num_blocks);
+            workers.emplace_back([&compute_lowest_cost_range, &worker_errors, iworker, start, end]() {
+                try {
+                    compute_lowest_cost_range(start, end);
+                } catch (...) {
+                    worker_errors[iworker] = std::current_exception();
+                }
+            });
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (auto& error : worker_errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    } else {
+        compute_lowest_cost_range(0, num_blocks);
+    }
+
     for (auto blk_id : atom_ctx.nlist.blocks()) {
-        expected_lowest_cost_pb_gnode[blk_id] = get_expected_lowest_cost_primitive_for_atom_block(blk_id);
+        expected_lowest_cost_pb_gnode[blk_id] = lowest_cost_pb_gnode[size_t(blk_id)];
 
         auto rng = atom_molecules.equal_range(blk_id);
         bool rng_empty = (rng.first == rng.second);
         if (rng_empty) {
-            cur_molecule = new t_pack_molecule;
+            f_molecule_arena.emplace_back();
+            cur_molecule = &f_molecule_arena.back();
             cur_molecule->valid = true;
             cur_molecule->type = MOLECULE_SINGLE_ATOM;
             cur_molecule->num_blocks = 1;
@@ -873,6 +932,10 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
     return list_of_molecules_head;
 }
 
+void free_pack_molecules() {
+    f_molecule_arena.clear();
+}
+
 static void free_pack_pattern(t_pack_pattern_block* pattern_block, t_pack_pattern_block** pattern_block_list) {
     t_pack_pattern_connections *connection, *next;
     if (pattern_block == nullptr || pattern_block->block_id == OPEN) {
@@ -924,7 +987,8 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
         if (!blk_id) return nullptr;
     }
 
-    molecule = new t_pack_molecule;
+    f_molecule_arena.emplace_back();
+    molecule = &f_molecule_arena.back();
     molecule->valid = true;
     molecule->type = MOLECULE_FORCED_PACK;
     molecule->pack_pattern = pack_pattern;
@@ -951,8 +1015,9 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
             atom_molecules.insert({blk_id2, molecule});
         }
     } else {
-        // Failed to create molecule
-        delete molecule;
+        // Failed to create molecule: it is the most recently allocated arena
+        // entry, so return it to the arena
+        f_molecule_arena.pop_back();
         return nullptr;
     }
 
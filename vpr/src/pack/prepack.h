@@ -19,4 +19,8 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
                                                std::unordered_map<AtomBlockId, t_pb_graph_node*>& expected_lowest_cost_pb_gnode,
                                                const int num_packing_patterns);
 
+/* Releases every molecule created by alloc_and_load_pack_molecules(),
+ * invalidating all outstanding t_pack_molecule pointers */
+void free_pack_molecules();
+
 #endif
@@ -0,0 +1,58 @@
+#include "adaptive_move_generator.h"
+
+#include "vtr_assert.h"
+#include "vtr_random.h"
+
+#include <algorithm>
+
+//Fraction of a child's weight replaced by each new outcome. A small value
+//averages over many moves, so the schedule tracks trends rather than noise.
+static constexpr float MOVE_WEIGHT_GAIN = 0.01f;
+
+//Minimum selection weight for any child, so every generator keeps being
+//sampled and can regain probability mass when it becomes effective again
+static constexpr float MIN_MOVE_WEIGHT = 0.05f;
+
+void AdaptiveMoveGenerator::add_generator(std::unique_ptr<MoveGenerator> generator) {
+    generators_.push_back(std::move(generator));
+    weights_.push_back(1.); //Children start equally likely
+}
+
+e_create_move AdaptiveMoveGenerator::propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim, vtr::RandState& rand_state) {
+    VTR_ASSERT(!generators_.empty());
+
+    //Roulette-wheel selection over the current child weights
+    float total_weight = 0.;
+    for (float weight : weights_) {
+        total_weight += weight;
+    }
+
+    float pick = vtr::frand(rand_state) * total_weight;
+    size_t igen = 0;
+    for (; igen + 1 < generators_.size(); ++igen) {
+        pick -= weights_[igen];
+        if (pick <= 0.) break;
+    }
+
+    last_generator_ = igen;
+
+    return generators_[igen]->propose_move(affected_blocks, rlim, rand_state);
+}
+
+void AdaptiveMoveGenerator::process_outcome(const MoveOutcomeStats& move_outcome) {
+    VTR_ASSERT(last_generator_ != OPEN);
+
+    //A child is rewarded only for accepted moves which reduced cost; accepted
+    //uphill moves and rejections both count against it, since the aim is
+    //fewer wasted evaluations per improvement
+    float reward = 0.;
+    if (move_outcome.outcome == ACCEPTED && move_outcome.delta_cost_norm < 0.) {
+        reward = 1.;
+    }
+
+    float& weight = weights_[last_generator_];
+    weight = (1.f - MOVE_WEIGHT_GAIN) * weight + MOVE_WEIGHT_GAIN * reward;
+    weight = std::max(weight, MIN_MOVE_WEIGHT);
+
+    generators_[last_generator_]->process_outcome(move_outcome);
+}
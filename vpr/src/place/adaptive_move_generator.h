@@ -0,0 +1,33 @@
+#ifndef VPR_ADAPTIVE_MOVE_GEN_H
+#define VPR_ADAPTIVE_MOVE_GEN_H
+#include "move_generator.h"
+
+#include <memory>
+#include <vector>
+
+//Composite move generator which schedules between several child move
+//generators, adaptively shifting probability mass towards whichever
+//generators are currently producing accepted cost-reducing moves.
+//
+//Each child's selection weight tracks (via an exponential moving average)
+//how often its proposals are accepted with a cost reduction; a minimum
+//weight floor keeps every generator sampled so the scheduler can re-adapt
+//as the anneal progresses.
+class AdaptiveMoveGenerator : public MoveGenerator {
+  public:
+    //Adds a child generator to be scheduled
+    void add_generator(std::unique_ptr<MoveGenerator> generator);
+
+    e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim, vtr::RandState& rand_state) override;
+
+    //Credits/penalizes the child which proposed the last move, and forwards
+    //the outcome to it
+    void process_outcome(const MoveOutcomeStats& move_outcome) override;
+
+  private:
+    std::vector<std::unique_ptr<MoveGenerator>> generators_;
+    std::vector<float> weights_;
+    int last_generator_ = OPEN; //Child which proposed the last move
+};
+
+#endif
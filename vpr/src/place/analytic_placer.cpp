@@ -0,0 +1,332 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+#include "vtr_vector.h"
+
+#include "globals.h"
+#include "vpr_utils.h"
+#include "place_macro.h"
+#include "analytic_placer.h"
+
+/* Number of solve + legalize rounds. The first solve spreads the blocks
+ * toward their wirelength-minimizing positions; later rounds re-solve with
+ * anchors at the legalized locations, trading a little wirelength for
+ * less displacement during legalization. */
+constexpr int AP_NUM_SOLVE_LEGALIZE_ITERS = 3;
+
+/* Jacobi sweeps per quadratic solve. The clique-model system is strongly
+ * diagonally dominant (every variable carries an anchor term), so a
+ * modest number of sweeps gets within legalization noise of the exact
+ * solution. */
+constexpr int AP_NUM_JACOBI_SWEEPS = 30;
+
+/* Weight pulling each movable block toward its last legal location,
+ * relative to a unit two-pin connection. Also guarantees the system is
+ * non-singular when a design has no fixed blocks. */
+constexpr double AP_ANCHOR_WEIGHT = 0.1;
+
+/* Nets above this fanout are ignored by the solver: their per-pair clique
+ * weight is negligible and they would dominate the sweep runtime. */
+constexpr size_t AP_MAX_MODELED_FANOUT = 512;
+
+/* Per-type pool of free legal slots, grouped by grid column to allow a
+ * nearest-slot query that only inspects columns near the target */
+typedef std::map<int, std::vector<t_pl_loc>> t_ap_slot_columns; //[x-coord] -> slots (sorted by y)
+
+static void ap_solve_positions(const std::vector<ClusterBlockId>& movable_blocks,
+                               const vtr::vector<ClusterBlockId, int>& block_var,
+                               const std::vector<double>& anchor_x,
+                               const std::vector<double>& anchor_y,
+                               std::vector<double>& var_x,
+                               std::vector<double>& var_y);
+
+static void ap_legalize_positions(const std::vector<ClusterBlockId>& movable_blocks,
+                                  std::vector<double>& var_x,
+                                  std::vector<double>& var_y);
+
+static bool ap_find_nearest_free_slot(t_ap_slot_columns& slot_columns,
+                                      double target_x,
+                                      double target_y,
+                                      t_pl_loc& slot);
+
+void run_analytic_placer() {
+    vtr::ScopedStartFinishTimer timer("Analytic placement");
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    /* Identify the movable blocks. Fixed blocks and macro members stay at
+     * their current (legal) locations and act as anchors: moving macros
+     * analytically would require legalizing whole member chains, which the
+     * greedy legalizer below does not attempt. */
+    vtr::vector<ClusterBlockId, int> block_var(cluster_ctx.clb_nlist.blocks().size(), OPEN);
+    std::vector<ClusterBlockId> movable_blocks;
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        if (place_ctx.block_locs[blk_id].is_fixed) {
+            continue;
+        }
+
+        int imacro = OPEN;
+        get_imacro_from_iblk(&imacro, blk_id, place_ctx.pl_macros);
+        if (imacro != OPEN) {
+            continue;
+        }
+
+        block_var[blk_id] = (int)movable_blocks.size();
+        movable_blocks.push_back(blk_id);
+    }
+
+    if (movable_blocks.empty()) {
+        VTR_LOG("Analytic placement: no movable blocks, nothing to do\n");
+        return;
+    }
+
+    VTR_LOG("Analytic placement: solving for %zu movable blocks (%zu blocks total)\n",
+            movable_blocks.size(), cluster_ctx.clb_nlist.blocks().size());
+
+    /* Continuous positions, initialized from the current placement */
+    std::vector<double> var_x(movable_blocks.size());
+    std::vector<double> var_y(movable_blocks.size());
+    std::vector<double> anchor_x(movable_blocks.size());
+    std::vector<double> anchor_y(movable_blocks.size());
+    for (size_t ivar = 0; ivar < movable_blocks.size(); ++ivar) {
+        const t_pl_loc& loc = place_ctx.block_locs[movable_blocks[ivar]].loc;
+        var_x[ivar] = anchor_x[ivar] = loc.x;
+        var_y[ivar] = anchor_y[ivar] = loc.y;
+    }
+
+    for (int iter = 0; iter < AP_NUM_SOLVE_LEGALIZE_ITERS; ++iter) {
+        ap_solve_positions(movable_blocks, block_var, anchor_x, anchor_y, var_x, var_y);
+
+        ap_legalize_positions(movable_blocks, var_x, var_y);
+
+        /* Anchor the next solve at the legalized locations */
+        for (size_t ivar = 0; ivar < movable_blocks.size(); ++ivar) {
+            const t_pl_loc& loc = place_ctx.block_locs[movable_blocks[ivar]].loc;
+            anchor_x[ivar] = loc.x;
+            anchor_y[ivar] = loc.y;
+        }
+    }
+}
+
+/* Minimizes the clique-model quadratic wirelength over the movable block
+ * positions, with each block also anchored to its last legal location.
+ *
+ * The minimum of the quadratic is where every variable sits at the
+ * weighted mean of its connected pin positions, so Jacobi sweeps (each
+ * variable moved to that mean, using the previous sweep's positions)
+ * converge to the linear-system solution without needing a matrix
+ * package. */
+static void ap_solve_positions(const std::vector<ClusterBlockId>& movable_blocks,
+                               const vtr::vector<ClusterBlockId, int>& block_var,
+                               const std::vector<double>& anchor_x,
+                               const std::vector<double>& anchor_y,
+                               std::vector<double>& var_x,
+                               std::vector<double>& var_y) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    std::vector<double> sum_wx(movable_blocks.size());
+    std::vector<double> sum_wy(movable_blocks.size());
+    std::vector<double> sum_w(movable_blocks.size());
+
+    for (int isweep = 0; isweep < AP_NUM_JACOBI_SWEEPS; ++isweep) {
+        for (size_t ivar = 0; ivar < movable_blocks.size(); ++ivar) {
+            sum_wx[ivar] = AP_ANCHOR_WEIGHT * anchor_x[ivar];
+            sum_wy[ivar] = AP_ANCHOR_WEIGHT * anchor_y[ivar];
+            sum_w[ivar] = AP_ANCHOR_WEIGHT;
+        }
+
+        for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+            if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+                continue;
+            }
+
+            size_t num_pins = cluster_ctx.clb_nlist.net_pins(net_id).size();
+            if (num_pins < 2 || num_pins > AP_MAX_MODELED_FANOUT) {
+                continue;
+            }
+
+            /* Clique model: every pin pair connected with weight 1/(p-1).
+             * A movable pin's optimal contribution reduces to the sum of
+             * the other pins' positions, so only the net totals and the
+             * pin's own position are needed. */
+            double clique_weight = 1.0 / (double)(num_pins - 1);
+
+            double net_sum_x = 0.;
+            double net_sum_y = 0.;
+            for (auto pin_id : cluster_ctx.clb_nlist.net_pins(net_id)) {
+                ClusterBlockId blk_id = cluster_ctx.clb_nlist.pin_block(pin_id);
+                if (block_var[blk_id] != OPEN) {
+                    net_sum_x += var_x[block_var[blk_id]];
+                    net_sum_y += var_y[block_var[blk_id]];
+                } else {
+                    net_sum_x += place_ctx.block_locs[blk_id].loc.x;
+                    net_sum_y += place_ctx.block_locs[blk_id].loc.y;
+                }
+            }
+
+            for (auto pin_id : cluster_ctx.clb_nlist.net_pins(net_id)) {
+                ClusterBlockId blk_id = cluster_ctx.clb_nlist.pin_block(pin_id);
+                int ivar = block_var[blk_id];
+                if (ivar == OPEN) {
+                    continue;
+                }
+
+                sum_wx[ivar] += clique_weight * (net_sum_x - var_x[ivar]);
+                sum_wy[ivar] += clique_weight * (net_sum_y - var_y[ivar]);
+                sum_w[ivar] += clique_weight * (double)(num_pins - 1);
+            }
+        }
+
+        for (size_t ivar = 0; ivar < movable_blocks.size(); ++ivar) {
+            var_x[ivar] = sum_wx[ivar] / sum_w[ivar];
+            var_y[ivar] = sum_wy[ivar] / sum_w[ivar];
+        }
+    }
+}
+
+/* Snaps the movable blocks from their continuous solved positions back to
+ * legal grid slots, updating place_ctx.block_locs and grid_blocks.
+ *
+ * The movable blocks are first lifted out of the grid; the resulting free
+ * compatible slots are pooled per tile type and grouped by column, and
+ * each block (processed left-to-right in solved x) takes the nearest free
+ * slot. Fixed blocks and macros were never lifted, so they are naturally
+ * avoided. */
+static void ap_legalize_positions(const std::vector<ClusterBlockId>& movable_blocks,
+                                  std::vector<double>& var_x,
+                                  std::vector<double>& var_y) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    /* Lift the movable blocks out of the grid */
+    for (auto blk_id : movable_blocks) {
+        const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+        VTR_ASSERT(place_ctx.grid_blocks.block_at_location(loc) == blk_id);
+        place_ctx.grid_blocks.set_block_at_location(loc, EMPTY_BLOCK_ID);
+    }
+
+    /* Pool the free compatible slots for each tile type */
+    std::map<int, t_ap_slot_columns> free_slots; //[type->index] -> slots by column
+    for (size_t x = 0; x < device_ctx.grid.width(); ++x) {
+        for (size_t y = 0; y < device_ctx.grid.height(); ++y) {
+            const auto& grid_tile = device_ctx.grid[x][y];
+            if (grid_tile.type == device_ctx.EMPTY_TYPE
+                || grid_tile.width_offset != 0
+                || grid_tile.height_offset != 0) {
+                continue;
+            }
+
+            for (int z = 0; z < grid_tile.type->capacity; ++z) {
+                if (place_ctx.grid_blocks.block_at_location(x, y, z) == EMPTY_BLOCK_ID) {
+                    free_slots[grid_tile.type->index][x].emplace_back(x, y, z);
+                }
+            }
+        }
+    }
+
+    /* Assign blocks in left-to-right solved order, so blocks competing for
+     * the same region are resolved consistently */
+    std::vector<size_t> assign_order(movable_blocks.size());
+    for (size_t ivar = 0; ivar < assign_order.size(); ++ivar) {
+        assign_order[ivar] = ivar;
+    }
+    std::sort(assign_order.begin(), assign_order.end(),
+              [&](size_t lhs, size_t rhs) {
+                  return std::make_pair(var_x[lhs], var_y[lhs]) < std::make_pair(var_x[rhs], var_y[rhs]);
+              });
+
+    for (size_t ivar : assign_order) {
+        ClusterBlockId blk_id = movable_blocks[ivar];
+        t_physical_tile_type_ptr type = physical_tile_type(blk_id);
+
+        t_pl_loc slot;
+        bool found = ap_find_nearest_free_slot(free_slots[type->index], var_x[ivar], var_y[ivar], slot);
+        VTR_ASSERT_MSG(found, "Analytic placement legalizer must find a free slot (the block was lifted from one)");
+
+        place_ctx.block_locs[blk_id].loc = slot;
+        place_ctx.grid_blocks.set_block_at_location(slot, blk_id);
+    }
+}
+
+/* Finds (and removes) the free slot nearest to (target_x, target_y),
+ * expanding outward column-by-column from the target and stopping once no
+ * unvisited column can beat the best slot found */
+static bool ap_find_nearest_free_slot(t_ap_slot_columns& slot_columns,
+                                      double target_x,
+                                      double target_y,
+                                      t_pl_loc& slot) {
+    if (slot_columns.empty()) {
+        return false;
+    }
+
+    double best_dist = std::numeric_limits<double>::max();
+    t_ap_slot_columns::iterator best_column = slot_columns.end();
+    size_t best_islot = 0;
+
+    /* Walk columns outward from the target in both directions */
+    auto right_itr = slot_columns.lower_bound((int)std::lround(target_x));
+    auto left_itr = right_itr;
+
+    while (left_itr != slot_columns.begin() || right_itr != slot_columns.end()) {
+        t_ap_slot_columns::iterator column;
+        if (right_itr == slot_columns.end()
+            || (left_itr != slot_columns.begin()
+                && target_x - std::prev(left_itr)->first < right_itr->first - target_x)) {
+            --left_itr;
+            column = left_itr;
+        } else {
+            column = right_itr;
+            ++right_itr;
+        }
+
+        double dx = column->first - target_x;
+        if (dx * dx >= best_dist) {
+            if (dx > 0) {
+                right_itr = slot_columns.end(); //No closer column remains on the right
+            } else {
+                left_itr = slot_columns.begin(); //No closer column remains on the left
+            }
+            continue;
+        }
+
+        /* Slots within a column are sorted by y: check the neighbours of
+         * the insertion point for the target y */
+        const std::vector<t_pl_loc>& slots = column->second;
+        auto y_itr = std::lower_bound(slots.begin(), slots.end(), target_y,
+                                      [](const t_pl_loc& lhs, double rhs) {
+                                          return lhs.y < rhs;
+                                      });
+        for (auto candidate_itr : {y_itr, (y_itr == slots.begin()) ? slots.end() : std::prev(y_itr)}) {
+            if (candidate_itr == slots.end()) {
+                continue;
+            }
+            double dy = candidate_itr->y - target_y;
+            double dist = dx * dx + dy * dy;
+            if (dist < best_dist) {
+                best_dist = dist;
+                best_column = column;
+                best_islot = candidate_itr - slots.begin();
+            }
+        }
+    }
+
+    if (best_column == slot_columns.end()) {
+        return false;
+    }
+
+    slot = best_column->second[best_islot];
+    best_column->second.erase(best_column->second.begin() + best_islot);
+    if (best_column->second.empty()) {
+        slot_columns.erase(best_column);
+    }
+
+    return true;
+}
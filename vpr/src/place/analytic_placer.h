@@ -0,0 +1,24 @@
+#ifndef VPR_ANALYTIC_PLACER_H
+#define VPR_ANALYTIC_PLACER_H
+
+/*
+ * Quadratic (analytic) placement engine.
+ *
+ * Starting from a legal placement (e.g. the random initial placement),
+ * run_analytic_placer() alternates a wirelength-minimizing quadratic solve
+ * over the movable blocks with a greedy legalization against the placement
+ * grid (place_ctx.grid_blocks), leaving a legal placement in
+ * place_ctx.block_locs/grid_blocks.
+ *
+ * It is enabled with --enable_analytic_placement; the annealer then acts
+ * only as a low-temperature refinement (the hot annealing phases are
+ * skipped), which scales much better on large netlists than annealing
+ * from a random placement.
+ *
+ * Blocks with fixed locations, and blocks belonging to placement macros
+ * (e.g. carry chains), keep their current locations and act as anchors
+ * for the solve.
+ */
+void run_analytic_placer();
+
+#endif
@@ -88,6 +88,18 @@ t_compressed_block_grid create_compressed_block_grid(const std::vector<vtr::Poin
         VTR_ASSERT_MSG(result.second, "Duplicates should not exist in compressed grid space");
     }
 
+    //Flatten the per-column candidate sites into the CSR-style index used
+    //for windowed sampling (the flat_map keys are already sorted)
+    compressed_grid.column_first_site.reserve(compressed_grid.grid.size() + 1);
+    compressed_grid.site_cy.reserve(locations.size());
+    for (const auto& column : compressed_grid.grid) {
+        compressed_grid.column_first_site.push_back(compressed_grid.site_cy.size());
+        for (const auto& kv : column) {
+            compressed_grid.site_cy.push_back(kv.first);
+        }
+    }
+    compressed_grid.column_first_site.push_back(compressed_grid.site_cy.size());
+
     return compressed_grid;
 }
 
@@ -97,3 +109,21 @@ int grid_to_compressed(const std::vector<int>& coords, int point) {
 
     return std::distance(coords.begin(), itr);
 }
+
+int grid_to_compressed_approx(const std::vector<int>& coords, int point) {
+    VTR_ASSERT(!coords.empty());
+
+    auto itr = std::lower_bound(coords.begin(), coords.end(), point);
+    if (itr == coords.end()) {
+        return coords.size() - 1;
+    }
+    if (itr != coords.begin()) {
+        //Not an exact hit: pick whichever neighbour is closer
+        auto prev = itr - 1;
+        if (point - *prev < *itr - point) {
+            itr = prev;
+        }
+    }
+
+    return std::distance(coords.begin(), itr);
+}
@@ -32,6 +32,14 @@ struct t_compressed_block_grid {
     //stored sparsely, since we may not have full columns of blocks.
     //This makes it easy to check whether there exist
     std::vector<vtr::flat_map2<int, t_type_loc>> grid;
+
+    //Flattened (CSR-style) candidate-site index used for exact windowed
+    //sampling during move generation: site_cy holds the compressed y of
+    //every legal site, grouped by compressed x column (ascending within
+    //each column), and column_first_site[cx] gives the first entry of
+    //column cx (with a final sentinel entry equal to site_cy.size()).
+    std::vector<int> site_cy;
+    std::vector<int> column_first_site;
 };
 
 //Compressed grid space for each block type
@@ -44,4 +52,10 @@ std::vector<t_compressed_block_grid> create_compressed_block_grids();
 t_compressed_block_grid create_compressed_block_grid(const std::vector<vtr::Point<int>>& locations);
 
 int grid_to_compressed(const std::vector<int>& coords, int point);
+
+//Like grid_to_compressed(), but 'point' need not correspond to a location
+//of this block type: returns the index of the closest compressed location.
+//Useful for mapping an arbitrary grid location (e.g. a move target) into
+//a type's compressed grid space.
+int grid_to_compressed_approx(const std::vector<int>& coords, int point);
 #endif
@@ -0,0 +1,66 @@
+#include "median_move_generator.h"
+#include "globals.h"
+
+#include <algorithm>
+
+//Returns the locations of the blocks connected to blk (excluding blk itself)
+//through non-ignored nets
+static void collect_connected_block_locs(ClusterBlockId blk, std::vector<int>& xs, std::vector<int>& ys) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    for (ClusterPinId pin_id : cluster_ctx.clb_nlist.block_pins(blk)) {
+        ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(pin_id);
+        if (!net_id) continue;
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) continue;
+
+        for (ClusterPinId net_pin_id : cluster_ctx.clb_nlist.net_pins(net_id)) {
+            ClusterBlockId conn_blk = cluster_ctx.clb_nlist.pin_block(net_pin_id);
+            if (conn_blk == blk) continue;
+
+            const t_pl_loc& loc = place_ctx.block_locs[conn_blk].loc;
+            xs.push_back(loc.x);
+            ys.push_back(loc.y);
+        }
+    }
+}
+
+e_create_move MedianMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_affected, float rlim, vtr::RandState& rand_state) {
+    /* Pick a random block and propose moving it towards the median location
+     * of the blocks it is connected to. */
+    ClusterBlockId b_from = pick_from_block(rand_state);
+    if (!b_from) {
+        return e_create_move::ABORT; //No movable block found
+    }
+
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    t_pl_loc from = place_ctx.block_locs[b_from].loc;
+    auto cluster_from_type = cluster_ctx.clb_nlist.block_type(b_from);
+    auto grid_from_type = g_vpr_ctx.device().grid[from.x][from.y].type;
+    VTR_ASSERT(physical_tile_type(cluster_from_type) == grid_from_type);
+
+    std::vector<int> xs;
+    std::vector<int> ys;
+    collect_connected_block_locs(b_from, xs, ys);
+
+    if (xs.empty()) {
+        return e_create_move::ABORT; //Unconnected block -- no preferred direction
+    }
+
+    //The median minimizes the total Manhattan distance to the connected blocks
+    std::nth_element(xs.begin(), xs.begin() + xs.size() / 2, xs.end());
+    std::nth_element(ys.begin(), ys.begin() + ys.size() / 2, ys.end());
+
+    t_pl_loc target;
+    target.x = xs[xs.size() / 2];
+    target.y = ys[ys.size() / 2];
+
+    t_pl_loc to;
+    if (!find_to_loc_centroid(physical_tile_type(b_from), rlim, from, target, to, rand_state)) {
+        return e_create_move::ABORT;
+    }
+
+    return ::create_move(blocks_affected, b_from, to);
+}
@@ -0,0 +1,12 @@
+#ifndef VPR_MEDIAN_MOVE_GEN_H
+#define VPR_MEDIAN_MOVE_GEN_H
+#include "move_generator.h"
+
+//Directed move generator which proposes moving a random block towards the
+//median x/y location of the blocks it is connected to (the point minimizing
+//the total half-perimeter wirelength of its connections)
+class MedianMoveGenerator : public MoveGenerator {
+    e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim, vtr::RandState& rand_state) override;
+};
+
+#endif
@@ -22,7 +22,11 @@ class MoveGenerator {
     virtual ~MoveGenerator() {}
 
     //Updates affected_blocks with the proposed move, while respecting the current rlim
-    virtual e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim) = 0;
+    //
+    //Any randomness must be drawn from the passed-in rand_state, so each
+    //move stream is self-contained (a requirement for running multiple
+    //move generators concurrently)
+    virtual e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim, vtr::RandState& rand_state) = 0;
 
     //Recieves feedback about the outcome of the previously proposed move
     virtual void process_outcome(const MoveOutcomeStats& /*move_outcome*/) {}
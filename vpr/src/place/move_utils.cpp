@@ -27,7 +27,7 @@ e_create_move create_move(t_pl_blocks_to_be_moved& blocks_affected, ClusterBlock
         //Try inverting the swap direction
 
         auto& place_ctx = g_vpr_ctx.placement();
-        ClusterBlockId b_to = place_ctx.grid_blocks[to.x][to.y].blocks[to.z];
+        ClusterBlockId b_to = place_ctx.grid_blocks.block_at_location(to);
 
         if (!b_to) {
             log_move_abort("inverted move no to block");
@@ -81,7 +81,7 @@ e_block_move_result find_affected_blocks(t_pl_blocks_to_be_moved& blocks_affecte
         VTR_ASSERT_SAFE(outcome != e_block_move_result::VALID || imember_from == int(pl_macros[imacro_from].members.size()));
 
     } else {
-        ClusterBlockId b_to = place_ctx.grid_blocks[to.x][to.y].blocks[to.z];
+        ClusterBlockId b_to = place_ctx.grid_blocks.block_at_location(to);
         int imacro_to = -1;
         get_imacro_from_iblk(&imacro_to, b_to, pl_macros);
 
@@ -109,9 +109,9 @@ e_block_move_result record_single_block_swap(t_pl_blocks_to_be_moved& blocks_aff
 
     auto& place_ctx = g_vpr_ctx.mutable_placement();
 
-    VTR_ASSERT_SAFE(to.z < int(place_ctx.grid_blocks[to.x][to.y].blocks.size()));
+    VTR_ASSERT_SAFE(to.z < int(place_ctx.grid_blocks.subtile_capacity()));
 
-    ClusterBlockId b_to = place_ctx.grid_blocks[to.x][to.y].blocks[to.z];
+    ClusterBlockId b_to = place_ctx.grid_blocks.block_at_location(to);
 
     e_block_move_result outcome = e_block_move_result::VALID;
 
@@ -165,7 +165,7 @@ e_block_move_result record_macro_swaps(t_pl_blocks_to_be_moved& blocks_affected,
             log_move_abort("macro_from swap to location illegal");
             outcome = e_block_move_result::ABORT;
         } else {
-            ClusterBlockId b_to = place_ctx.grid_blocks[curr_to.x][curr_to.y].blocks[curr_to.z];
+            ClusterBlockId b_to = place_ctx.grid_blocks.block_at_location(curr_to);
             int imacro_to = -1;
             get_imacro_from_iblk(&imacro_to, b_to, pl_macros);
 
@@ -301,7 +301,7 @@ e_block_move_result record_macro_move(t_pl_blocks_to_be_moved& blocks_affected,
             return e_block_move_result::ABORT;
         }
 
-        ClusterBlockId blk_to = place_ctx.grid_blocks[to.x][to.y].blocks[to.z];
+        ClusterBlockId blk_to = place_ctx.grid_blocks.block_at_location(to);
 
         record_block_move(blocks_affected, member.blk_index, to);
 
@@ -332,7 +332,7 @@ e_block_move_result identify_macro_self_swap_affected_macros(std::vector<int>& m
             return e_block_move_result::ABORT;
         }
 
-        ClusterBlockId blk_to = place_ctx.grid_blocks[to.x][to.y].blocks[to.z];
+        ClusterBlockId blk_to = place_ctx.grid_blocks.block_at_location(to);
 
         int imacro_to = -1;
         get_imacro_from_iblk(&imacro_to, blk_to, place_ctx.pl_macros);
@@ -450,7 +450,7 @@ std::set<t_pl_loc> determine_locations_emptied_by_move(t_pl_blocks_to_be_moved&
 
 //Pick a random block to be swapped with another random block.
 //If none is found return ClusterBlockId::INVALID()
-ClusterBlockId pick_from_block() {
+ClusterBlockId pick_from_block(vtr::RandState& rand_state) {
     /* Some blocks may be fixed, and should never be moved from their *
      * initial positions. If we randomly selected such a block try    *
      * another random block.                                          *
@@ -465,7 +465,7 @@ ClusterBlockId pick_from_block() {
     //So long as untried blocks remain
     while (tried_from_blocks.size() < cluster_ctx.clb_nlist.blocks().size()) {
         //Pick a block at random
-        ClusterBlockId b_from = ClusterBlockId(vtr::irand((int)cluster_ctx.clb_nlist.blocks().size() - 1));
+        ClusterBlockId b_from = ClusterBlockId(vtr::irand((int)cluster_ctx.clb_nlist.blocks().size() - 1, rand_state));
 
         //Record it as tried
         tried_from_blocks.insert(b_from);
@@ -482,10 +482,167 @@ ClusterBlockId pick_from_block() {
     return ClusterBlockId::INVALID();
 }
 
+//Uniformly samples a candidate site within the given compressed-grid window,
+//excluding (cx_exclude, cy_exclude). Returns false if the window holds no
+//other candidate site.
+//
+//Built on the compressed grid's flattened candidate-site index, so the
+//sample is exact: unlike random probing it cannot repeatedly land on empty
+//space, which matters for scarce types (e.g. PLL or RAM columns) whose
+//columns are mostly empty in the y dimension.
+static bool sample_compressed_window(const t_compressed_block_grid& compressed_block_grid,
+                                     int min_cx,
+                                     int max_cx,
+                                     int min_cy,
+                                     int max_cy,
+                                     int cx_exclude,
+                                     int cy_exclude,
+                                     vtr::RandState& rand_state,
+                                     int* cx_to,
+                                     int* cy_to) {
+    const std::vector<int>& site_cy = compressed_block_grid.site_cy;
+    const std::vector<int>& first = compressed_block_grid.column_first_site;
+
+    //Returns the range of column cx's candidate sites which fall in [min_cy, max_cy]
+    auto column_window = [&](int cx, const int** lower, const int** upper) {
+        const int* base = site_cy.data();
+        *lower = std::lower_bound(base + first[cx], base + first[cx + 1], min_cy);
+        *upper = std::upper_bound(*lower, base + first[cx + 1], max_cy);
+    };
+
+    //Count the candidates in the window, noting the position of the excluded
+    //site if it falls inside
+    int num_candidates = 0;
+    int exclude_pos = OPEN;
+    for (int cx = min_cx; cx <= max_cx; ++cx) {
+        const int *lower, *upper;
+        column_window(cx, &lower, &upper);
+
+        if (cx == cx_exclude) {
+            const int* excl = std::lower_bound(lower, upper, cy_exclude);
+            if (excl != upper && *excl == cy_exclude) {
+                exclude_pos = num_candidates + (excl - lower);
+            }
+        }
+
+        num_candidates += upper - lower;
+    }
+
+    if (exclude_pos != OPEN) {
+        --num_candidates;
+    }
+    if (num_candidates <= 0) {
+        return false; //No candidates (other than the excluded site)
+    }
+
+    int isample = vtr::irand(num_candidates - 1, rand_state);
+    if (exclude_pos != OPEN && isample >= exclude_pos) {
+        ++isample; //Skip over the excluded site
+    }
+
+    //Map the sample back to its column and site
+    for (int cx = min_cx; cx <= max_cx; ++cx) {
+        const int *lower, *upper;
+        column_window(cx, &lower, &upper);
+
+        int count = upper - lower;
+        if (isample < count) {
+            *cx_to = cx;
+            *cy_to = lower[isample];
+            return true;
+        }
+        isample -= count;
+    }
+
+    VTR_ASSERT_MSG(false, "Windowed sample must land in a column");
+    return false;
+}
+
+//Picks a legal location of the given type within the specified compressed-grid
+//window (excluding the from-location), returning it through 'to'
+static bool find_to_loc_in_window(t_physical_tile_type_ptr type,
+                                  const t_compressed_block_grid& compressed_block_grid,
+                                  int min_cx,
+                                  int max_cx,
+                                  int min_cy,
+                                  int max_cy,
+                                  int cx_from,
+                                  int cy_from,
+                                  t_pl_loc& to,
+                                  vtr::RandState& rand_state) {
+    int cx_to = OPEN;
+    int cy_to = OPEN;
+    bool legal = false;
+
+    //Fast path: probe a single random column. For dense types (e.g. CLBs)
+    //nearly every column holds in-window candidates, so this almost always
+    //succeeds without the cost of exact sampling.
+    {
+        int cx_probe = min_cx + vtr::irand(max_cx - min_cx, rand_state);
+
+        auto y_lower_iter = compressed_block_grid.grid[cx_probe].lower_bound(min_cy);
+        auto y_upper_iter = compressed_block_grid.grid[cx_probe].upper_bound(max_cy);
+
+        int y_range = std::distance(y_lower_iter, y_upper_iter);
+        if (y_range > 0) {
+            int dy = vtr::irand(y_range - 1, rand_state);
+
+            cx_to = cx_probe;
+            cy_to = (y_lower_iter + dy)->first;
+
+            legal = (cx_to != cx_from || cy_to != cy_from);
+        }
+    }
+
+    if (!legal) {
+        //The probe missed (likely a scarce type whose columns are sparse in
+        //the y dimension): sample exactly over the window's candidate index
+        legal = sample_compressed_window(compressed_block_grid,
+                                         min_cx, max_cx, min_cy, max_cy,
+                                         cx_from, cy_from,
+                                         rand_state,
+                                         &cx_to, &cy_to);
+    }
+
+    if (!legal) {
+        //No candidates within rlim_y: fall back to allow the whole y range
+        legal = sample_compressed_window(compressed_block_grid,
+                                         min_cx, max_cx,
+                                         0, compressed_block_grid.compressed_to_grid_y.size() - 1,
+                                         cx_from, cy_from,
+                                         rand_state,
+                                         &cx_to, &cy_to);
+    }
+
+    if (!legal) {
+        //No valid position found
+        return false;
+    }
+
+    VTR_ASSERT(cx_to != OPEN);
+    VTR_ASSERT(cy_to != OPEN);
+
+    //Convert to true (uncompressed) grid locations
+    to.x = compressed_block_grid.compressed_to_grid_x[cx_to];
+    to.y = compressed_block_grid.compressed_to_grid_y[cy_to];
+
+    //Each x/y location contains only a single type, so we can pick a random
+    //z (capcity) location
+    to.z = vtr::irand(type->capacity - 1, rand_state);
+
+    auto& device_ctx = g_vpr_ctx.device();
+    VTR_ASSERT_MSG(device_ctx.grid[to.x][to.y].type == type, "Type must match");
+    VTR_ASSERT_MSG(device_ctx.grid[to.x][to.y].width_offset == 0, "Should be at block base location");
+    VTR_ASSERT_MSG(device_ctx.grid[to.x][to.y].height_offset == 0, "Should be at block base location");
+
+    return true;
+}
+
 bool find_to_loc_uniform(t_physical_tile_type_ptr type,
                          float rlim,
                          const t_pl_loc from,
-                         t_pl_loc& to) {
+                         t_pl_loc& to,
+                         vtr::RandState& rand_state) {
     //Finds a legal swap to location for the given type, starting from 'from.x' and 'from.y'
     //
     //Note that the range limit (rlim) is applied in a logical sense (i.e. 'compressed' grid space consisting
@@ -514,105 +671,57 @@ bool find_to_loc_uniform(t_physical_tile_type_ptr type,
     //Determin the valid compressed grid location ranges
     int min_cx = std::max(0, cx_from - rlim_x);
     int max_cx = std::min<int>(compressed_block_grid.compressed_to_grid_x.size() - 1, cx_from + rlim_x);
-    int delta_cx = max_cx - min_cx;
 
     int min_cy = std::max(0, cy_from - rlim_y);
     int max_cy = std::min<int>(compressed_block_grid.compressed_to_grid_y.size() - 1, cy_from + rlim_y);
 
-    int cx_to = OPEN;
-    int cy_to = OPEN;
-    std::unordered_set<int> tried_cx_to;
-    bool legal = false;
-    while (!legal && (int)tried_cx_to.size() < delta_cx) { //Until legal or all possibilities exhaused
-        //Pick a random x-location within [min_cx, max_cx],
-        //until we find a legal swap, or have exhuasted all possiblites
-        cx_to = min_cx + vtr::irand(delta_cx);
-
-        VTR_ASSERT(cx_to >= min_cx);
-        VTR_ASSERT(cx_to <= max_cx);
-
-        //Record this x location as tried
-        auto res = tried_cx_to.insert(cx_to);
-        if (!res.second) {
-            continue; //Already tried this position
-        }
-
-        //Pick a random y location
-        //
-        //We are careful here to consider that there may be a sparse
-        //set of candidate blocks in the y-axis at this x location.
-        //
-        //The candidates are stored in a flat_map so we can efficiently find the set of valid
-        //candidates with upper/lower bound.
-        auto y_lower_iter = compressed_block_grid.grid[cx_to].lower_bound(min_cy);
-        if (y_lower_iter == compressed_block_grid.grid[cx_to].end()) {
-            continue;
-        }
-
-        auto y_upper_iter = compressed_block_grid.grid[cx_to].upper_bound(max_cy);
-
-        if (y_lower_iter->first > min_cy) {
-            //No valid blocks at this x location which are within rlim_y
-            //
-            //Fall back to allow the whole y range
-            y_lower_iter = compressed_block_grid.grid[cx_to].begin();
-            y_upper_iter = compressed_block_grid.grid[cx_to].end();
-
-            min_cy = y_lower_iter->first;
-            max_cy = (y_upper_iter - 1)->first;
-        }
-
-        int y_range = std::distance(y_lower_iter, y_upper_iter);
-        VTR_ASSERT(y_range >= 0);
-
-        //At this point we know y_lower_iter and y_upper_iter
-        //bound the range of valid blocks at this x-location, which
-        //are within rlim_y
-        std::unordered_set<int> tried_dy;
-        while (!legal && (int)tried_dy.size() < y_range) { //Until legal or all possibilities exhausted
-            //Randomly pick a y location
-            int dy = vtr::irand(y_range - 1);
-
-            //Record this y location as tried
-            auto res2 = tried_dy.insert(dy);
-            if (!res2.second) {
-                continue; //Already tried this position
-            }
+    return find_to_loc_in_window(type, compressed_block_grid,
+                                 min_cx, max_cx, min_cy, max_cy,
+                                 cx_from, cy_from,
+                                 to, rand_state);
+}
 
-            //Key in the y-dimension is the compressed index location
-            cy_to = (y_lower_iter + dy)->first;
+bool find_to_loc_centroid(t_physical_tile_type_ptr type,
+                          float rlim,
+                          const t_pl_loc from,
+                          const t_pl_loc target,
+                          t_pl_loc& to,
+                          vtr::RandState& rand_state) {
+    //Finds a legal swap to location for the given type within rlim of 'target'
+    //(which need not itself be a location of this type, or even in bounds).
+    //
+    //As with find_to_loc_uniform() the range limit is applied in the compressed
+    //grid space, so columns of rare blocks remain logically adjacent.
+    auto& grid = g_vpr_ctx.device().grid;
 
-            VTR_ASSERT(cy_to >= min_cy);
-            VTR_ASSERT(cy_to <= max_cy);
+    auto grid_type = grid[from.x][from.y].type;
+    VTR_ASSERT(type == grid_type);
 
-            if (cx_from == cx_to && cy_from == cy_to) {
-                continue; //Same from/to location -- try again for new y-position
-            } else {
-                legal = true;
-            }
-        }
-    }
+    //Retrieve the compressed block grid for this block type
+    const auto& compressed_block_grid = g_vpr_ctx.placement().compressed_block_grids[type->index];
 
-    if (!legal) {
-        //No valid position found
-        return false;
-    }
+    //Determine the rlim in each dimension
+    int rlim_x = std::min<int>(compressed_block_grid.compressed_to_grid_x.size(), rlim);
+    int rlim_y = std::min<int>(compressed_block_grid.compressed_to_grid_y.size(), rlim); /* for aspect_ratio != 1 case. */
 
-    VTR_ASSERT(cx_to != OPEN);
-    VTR_ASSERT(cy_to != OPEN);
+    //Determine the coordinates in the compressed grid space of the current block
+    int cx_from = grid_to_compressed(compressed_block_grid.compressed_to_grid_x, from.x);
+    int cy_from = grid_to_compressed(compressed_block_grid.compressed_to_grid_y, from.y);
 
-    //Convert to true (uncompressed) grid locations
-    to.x = compressed_block_grid.compressed_to_grid_x[cx_to];
-    to.y = compressed_block_grid.compressed_to_grid_y[cy_to];
+    //The target is an arbitrary grid location (it may not hold this type),
+    //so map it to the closest location in the compressed space
+    int cx_target = grid_to_compressed_approx(compressed_block_grid.compressed_to_grid_x, target.x);
+    int cy_target = grid_to_compressed_approx(compressed_block_grid.compressed_to_grid_y, target.y);
 
-    //Each x/y location contains only a single type, so we can pick a random
-    //z (capcity) location
-    to.z = vtr::irand(type->capacity - 1);
+    //Determine the valid compressed grid location ranges
+    int min_cx = std::max(0, cx_target - rlim_x);
+    int max_cx = std::min<int>(compressed_block_grid.compressed_to_grid_x.size() - 1, cx_target + rlim_x);
 
-    auto& device_ctx = g_vpr_ctx.device();
-    VTR_ASSERT_MSG(device_ctx.grid[to.x][to.y].type == type, "Type must match");
-    VTR_ASSERT_MSG(device_ctx.grid[to.x][to.y].width_offset == 0, "Should be at block base location");
-    VTR_ASSERT_MSG(device_ctx.grid[to.x][to.y].height_offset == 0, "Should be at block base location");
+    int min_cy = std::max(0, cy_target - rlim_y);
+    int max_cy = std::min<int>(compressed_block_grid.compressed_to_grid_y.size() - 1, cy_target + rlim_y);
 
-    return true;
+    return find_to_loc_in_window(type, compressed_block_grid,
+                                 min_cx, max_cx, min_cy, max_cy,
+                                 cx_from, cy_from,
+                                 to, rand_state);
 }
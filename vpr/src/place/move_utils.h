@@ -1,6 +1,7 @@
 #ifndef VPR_MOVE_UTILS_H
 #define VPR_MOVE_UTILS_H
 #include "vpr_types.h"
+#include "vtr_random.h"
 #include "move_transactions.h"
 #include "compressed_grid.h"
 
@@ -44,10 +45,22 @@ bool is_legal_swap_to_location(ClusterBlockId blk, t_pl_loc to);
 
 std::set<t_pl_loc> determine_locations_emptied_by_move(t_pl_blocks_to_be_moved& blocks_affected);
 
-ClusterBlockId pick_from_block();
+ClusterBlockId pick_from_block(vtr::RandState& rand_state);
 
 bool find_to_loc_uniform(t_physical_tile_type_ptr type,
                          float rlim,
                          const t_pl_loc from,
-                         t_pl_loc& to);
+                         t_pl_loc& to,
+                         vtr::RandState& rand_state);
+
+//Like find_to_loc_uniform(), but the rlim-sized search window is centered
+//on 'target' (an arbitrary grid location, e.g. the centroid of a block's
+//connected blocks) instead of on the from-location. The from-location is
+//still excluded as a candidate.
+bool find_to_loc_centroid(t_physical_tile_type_ptr type,
+                          float rlim,
+                          const t_pl_loc from,
+                          const t_pl_loc target,
+                          t_pl_loc& to,
+                          vtr::RandState& rand_state);
 #endif
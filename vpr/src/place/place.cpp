@@ -1,13 +1,16 @@
 #include <cstdio>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <fstream>
+#include <thread>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_util.h"
 #include "vtr_random.h"
 #include "vtr_geometry.h"
+#include "vtr_time.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -27,11 +30,16 @@
 #include "place_macro.h"
 #include "histogram.h"
 #include "place_util.h"
+#include "vpr_checkpoint.h"
 #include "place_delay_model.h"
+#include "analytic_placer.h"
 #include "move_transactions.h"
 #include "move_utils.h"
 
 #include "uniform_move_generator.h"
+#include "median_move_generator.h"
+#include "weighted_centroid_move_generator.h"
+#include "adaptive_move_generator.h"
 
 #include "PlacementDelayCalculator.h"
 #include "VprTimingGraphResolver.h"
@@ -56,14 +64,50 @@ using std::min;
 
 /* This defines the maximum number of swap attempts before invoking the   *
  * once-in-a-while placement legality check as well as floating point     *
- * variables round-offs check.                                            */
-#define MAX_MOVES_BEFORE_RECOMPUTE 500000
+ * variables round-offs check.  Since the incremental cost updates use    *
+ * compensated summation (see add_compensated()) the recompute is a       *
+ * verification event rather than a needed correction, so it can be       *
+ * infrequent even on large designs.                                      */
+#define MAX_MOVES_BEFORE_RECOMPUTE 5000000
 
 /* The maximum number of tries when trying to place a carry chain at a    *
  * random location before trying exhaustive placement - find the fist     *
  * legal position and place it during initial placement.                  */
 #define MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY 4
 
+/* Parameters of the statistics-driven (ADAPTIVE_SCHED) annealing schedule. *
+ * The temperature decrement follows the measured cost distribution:        *
+ * alpha = exp(-lambda * T / sigma), where sigma is the standard deviation  *
+ * of the cost over the completed temperature, clamped so the anneal        *
+ * neither stalls nor collapses when sigma is extreme.                      */
+constexpr float ADAPTIVE_SCHED_LAMBDA = 0.7f;
+constexpr float ADAPTIVE_SCHED_MIN_ALPHA = 0.5f;
+constexpr float ADAPTIVE_SCHED_MAX_ALPHA = 0.98f;
+
+/* Equilibrium detection for ADAPTIVE_SCHED: the inner loop cost is sampled *
+ * at EQUILIBRIUM_NUM_CHECKS evenly spaced checkpoints; after at least      *
+ * EQUILIBRIUM_MIN_CHECKS checkpoints, two consecutive checkpoints whose    *
+ * relative cost change is below EQUILIBRIUM_COST_TOL end the temperature   *
+ * early (the cost has plateaued, so further moves at this temperature are  *
+ * wasted).                                                                 */
+constexpr int EQUILIBRIUM_NUM_CHECKS = 10;
+constexpr int EQUILIBRIUM_MIN_CHECKS = 3;
+constexpr double EQUILIBRIUM_COST_TOL = 0.0005;
+
+/* The final quench (t = 0) accepts only improving moves, so cost is
+ * monotonically non-increasing and additional greedy passes are safe. The
+ * quench repeats until a full pass improves the cost by less than
+ * QUENCH_CONVERGENCE_TOL (relative), refreshing criticalities between
+ * passes, up to MAX_QUENCH_PASSES. */
+constexpr int MAX_QUENCH_PASSES = 10;
+constexpr double QUENCH_CONVERGENCE_TOL = 0.0001;
+
+/* Below these sizes the constructive initial placement and the initial
+ * bounding box cost computation are done serially; the work is too small
+ * to repay spawning worker threads. */
+constexpr size_t MIN_BLOCKS_FOR_PARALLEL_INIT_PLACE = 50000;
+constexpr size_t MIN_NETS_PER_BB_COST_WORKER = 16384;
+
 /* Flags for the states of the bounding box.                              *
  * Stored as char for memory efficiency.                                  */
 #define NOT_UPDATED_YET 'N'
@@ -93,8 +137,27 @@ struct t_placer_costs {
     double cost;
     double bb_cost;
     double timing_cost;
+
+    //Running Kahan compensation terms for the incremental updates of the
+    //corresponding costs above (see add_compensated()). Must be zeroed
+    //whenever the associated cost is assigned from scratch.
+    double cost_comp = 0.;
+    double bb_cost_comp = 0.;
+    double timing_cost_comp = 0.;
 };
 
+/* Adds delta into *sum using Kahan compensated summation, carrying the     *
+ * running round-off in *compensation.  Incremental cost updates use this   *
+ * so that error no longer accumulates over millions of moves, making the   *
+ * periodic from-scratch recompute a rare verification event rather than a  *
+ * correction the result depends on.                                        */
+static inline void add_compensated(double delta, double* sum, double* compensation) {
+    double y = delta - *compensation;
+    double t = *sum + y;
+    *compensation = (t - *sum) - y;
+    *sum = t;
+}
+
 struct t_placer_prev_inverse_costs {
     double bb_cost;
     double timing_cost;
@@ -110,8 +173,8 @@ constexpr double MAX_INV_TIMING_COST = 1.e9;
 
 /********************** Variables local to place.c ***************************/
 
-/* Cost of a net, and a temporary cost of a net used during move assessment. */
-static vtr::vector<ClusterNetId, double> net_cost, temp_net_cost;
+/* Cost of a net. */
+static vtr::vector<ClusterNetId, double> net_cost;
 
 static t_pl_loc** legal_pos = nullptr; /* [0..device_ctx.num_block_types-1][0..type_tsize - 1] */
 static int* num_legal_pos = nullptr;   /* [0..num_legal_pos-1] */
@@ -165,11 +228,29 @@ static vtr::vector<ClusterNetId, t_bb> bb_coords, bb_num_on_edges;
 static float** chanx_place_cost_fac; //[0...device_ctx.grid.width()-2]
 static float** chany_place_cost_fac; //[0...device_ctx.grid.height()-2]
 
-/* The following arrays are used by the try_swap function for speed.   */
-/* [0...cluster_ctx.clb_nlist.nets().size()-1] */
-static vtr::vector<ClusterNetId, t_bb> ts_bb_coord_new, ts_bb_edge_new;
+/* The following arrays are used by the try_swap function for speed.      *
+ * The proposed bounding boxes and costs of the nets affected by the move *
+ * under evaluation are stored densely, indexed by each affected net's    *
+ * slot in the ts_nets_to_update worklist (NOT by net), so evaluating a   *
+ * move touches a few contiguous cache lines regardless of how many nets  *
+ * the design has.                                                        */
+/* [0...num_affected_nets-1] */
+static std::vector<t_bb> ts_bb_coord_new, ts_bb_edge_new;
+static std::vector<double> ts_net_cost_new;
 static std::vector<ClusterNetId> ts_nets_to_update;
 
+/* Each affected net's slot in the scratch arrays above for the move under *
+ * evaluation (OPEN if the net is unaffected); doubles as the 'already     *
+ * recorded' flag.  [0...cluster_ctx.clb_nlist.nets().size()-1]            */
+static vtr::vector<ClusterNetId, int> ts_net_index;
+
+/* Flags the blocks moved by the move under evaluation so the            *
+ * driven-by-moved-block test is O(1) per pin rather than a scan over    *
+ * all moved blocks.  This matters for macro (e.g. carry chain) moves,   *
+ * where every member's sink pins would otherwise re-scan the whole      *
+ * chain.  [0...cluster_ctx.clb_nlist.blocks().size()-1]                 */
+static vtr::vector<ClusterBlockId, char> ts_block_is_moved;
+
 /* These file-scoped variables keep track of the number of swaps       *
  * rejected, accepted or aborted. The total number of swap attempts    *
  * is the sum of the three number.                                     */
@@ -192,6 +273,40 @@ static const float cross_count[50] = {/* [0..49] */ 1.0, 1.0, 1.0, 1.0828, 1.153
 
 std::unique_ptr<FILE, decltype(&vtr::fclose)> f_move_stats_file(nullptr, vtr::fclose);
 
+/* Per-temperature instrumentation (--place_temperature_stats).           *
+ * Accumulated per move in try_swap() and flushed as one JSON line per    *
+ * temperature, giving the acceptance/delta-cost/move-distance profile    *
+ * needed to tune annealing schedules without re-instrumenting the code.  */
+struct t_temperature_telemetry {
+    //Histogram of move delta costs, split by sign: bin i counts moves
+    //whose |delta cost| falls in [10^(i-DELTA_COST_BIN_OFFSET),
+    //10^(i-DELTA_COST_BIN_OFFSET+1)); zero deltas land in bin 0
+    static constexpr int NUM_DELTA_COST_BINS = 24;
+    static constexpr int DELTA_COST_BIN_OFFSET = 12;
+
+    //Moves binned by the manhattan distance moved by the primary block
+    //(bin 0 is distance <= 1, bin i covers distances (2^(i-1), 2^i])
+    static constexpr int NUM_DISTANCE_BINS = 16;
+
+    int accepted = 0;
+    int rejected = 0;
+    int aborted = 0;
+
+    int delta_cost_down[NUM_DELTA_COST_BINS] = {0}; //Improving moves (delta < 0)
+    int delta_cost_up[NUM_DELTA_COST_BINS] = {0};   //Worsening moves (delta >= 0)
+
+    int proposed_by_distance[NUM_DISTANCE_BINS] = {0};
+    int accepted_by_distance[NUM_DISTANCE_BINS] = {0};
+
+    double recompute_criticalities_sec = 0.;
+    double inner_loop_sec = 0.;
+
+    void clear() { *this = t_temperature_telemetry(); }
+};
+
+static std::unique_ptr<FILE, decltype(&vtr::fclose)> f_temperature_stats_file(nullptr, vtr::fclose);
+static t_temperature_telemetry f_temperature_telemetry;
+
 #ifdef VTR_ENABLE_DEBUG_LOGGING
 
 #    define LOG_MOVE_STATS_HEADER()                               \
@@ -213,7 +328,7 @@ std::unique_ptr<FILE, decltype(&vtr::fclose)> f_move_stats_file(nullptr, vtr::fc
                 ClusterBlockId b_from = affected_blocks.moved_blocks[0].block_num;             \
                                                                                                \
                 t_pl_loc to = affected_blocks.moved_blocks[0].new_loc;                         \
-                ClusterBlockId b_to = place_ctx.grid_blocks[to.x][to.y].blocks[to.z];          \
+                ClusterBlockId b_to = place_ctx.grid_blocks.block_at_location(to);             \
                                                                                                \
                 t_logical_block_type_ptr from_type = cluster_ctx.clb_nlist.block_type(b_from); \
                 t_logical_block_type_ptr to_type = nullptr;                                    \
@@ -294,13 +409,16 @@ static int check_macro_can_be_placed(int imacro, int itype, t_pl_loc head_pos);
 
 static int try_place_macro(int itype, int ipos, int imacro);
 
+static void initial_placement_warm_start(const char* place_file, enum e_pad_loc_type pad_loc_type);
+
 static void initial_placement_pl_macros(int macros_max_num_tries, int* free_locations);
 
 static void initial_placement_blocks(int* free_locations, enum e_pad_loc_type pad_loc_type);
-static void initial_placement_location(const int* free_locations, ClusterBlockId blk_id, int& pipos, t_pl_loc& to);
+static void initial_placement_location(const int* free_locations, ClusterBlockId blk_id, int& pipos, t_pl_loc& to, vtr::RandState& rand_state);
 
 static void initial_placement(enum e_pad_loc_type pad_loc_type,
-                              const char* pad_loc_file);
+                              const char* pad_loc_file,
+                              const char* read_initial_place_file);
 
 static double comp_bb_cost(e_cost_methods method);
 
@@ -316,7 +434,8 @@ static e_move_result try_swap(float t,
                               const PlaceDelayModel* delay_model,
                               float rlim_escape_fraction,
                               enum e_place_algorithm place_algorithm,
-                              float timing_tradeoff);
+                              float timing_tradeoff,
+                              vtr::RandState& rand_state);
 
 static void check_place(const t_placer_costs& costs,
                         const PlaceDelayModel* delay_model,
@@ -337,9 +456,10 @@ static float starting_t(t_placer_costs* costs,
                         const PlaceDelayModel* delay_model,
                         MoveGenerator& move_generator,
                         t_pl_blocks_to_be_moved& blocks_affected,
-                        const t_placer_opts& placer_opts);
+                        const t_placer_opts& placer_opts,
+                        vtr::RandState& rand_state);
 
-static void update_t(float* t, float rlim, float success_rat, t_annealing_sched annealing_sched);
+static void update_t(float* t, float rlim, float success_rat, double std_dev, t_annealing_sched annealing_sched);
 
 static void update_rlim(float* rlim, float success_rat, const DeviceGrid& grid);
 
@@ -357,11 +477,15 @@ static void comp_td_point_to_point_delays(const PlaceDelayModel* delay_model);
 
 static void update_td_cost(const t_pl_blocks_to_be_moved& blocks_affected);
 
-static bool driven_by_moved_block(const ClusterNetId net, const t_pl_blocks_to_be_moved& blocks_affected);
+static bool driven_by_moved_block(const ClusterNetId net);
+
+static void set_blocks_moved_flags(const t_pl_blocks_to_be_moved& blocks_affected, bool moved);
 
 static void comp_td_costs(const PlaceDelayModel* delay_model, double* timing_cost);
 
-static e_move_result assess_swap(double delta_c, double t);
+static void update_td_costs(const std::vector<ClusterPinId>& modified_sink_pins, double* timing_cost, double* timing_cost_comp);
+
+static e_move_result assess_swap(double delta_c, double t, vtr::RandState& rand_state);
 
 static void get_non_updateable_bb(ClusterNetId net_id, t_bb* bb_coord_new);
 
@@ -373,17 +497,20 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
                                                double& bb_delta_c,
                                                double& timing_delta_c);
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets);
+static int record_affected_net(const ClusterNetId net, int& num_affected_nets);
 
 static void update_net_bb(const ClusterNetId net,
+                          int inet_affected,
                           const t_pl_blocks_to_be_moved& blocks_affected,
                           int iblk,
                           const ClusterBlockId blk,
                           const ClusterPinId blk_pin);
-static void update_td_delta_costs(const PlaceDelayModel* delay_model, const t_pl_blocks_to_be_moved& blocks_affected, const ClusterNetId net, const ClusterPinId pin, double& delta_timing_cost);
+static void update_td_delta_costs(const PlaceDelayModel* delay_model, const ClusterNetId net, const ClusterPinId pin, double& delta_timing_cost);
 
 static double get_net_cost(ClusterNetId net_id, t_bb* bb_ptr);
 
+static size_t load_net_pin_coords(ClusterNetId net_id);
+
 static void get_bb_from_scratch(ClusterNetId net_id, t_bb* coords, t_bb* num_on_edges);
 
 static double get_net_wirelength_estimate(ClusterNetId net_id, t_bb* bbptr);
@@ -400,21 +527,42 @@ static void outer_loop_recompute_criticalities(const t_placer_opts& placer_opts,
                                                const PlaceDelayModel* delay_model,
                                                SetupTimingInfo& timing_info);
 
-static void placement_inner_loop(float t,
-                                 float rlim,
-                                 const t_placer_opts& placer_opts,
-                                 int move_lim,
-                                 float crit_exponent,
-                                 int inner_recompute_limit,
-                                 t_placer_statistics* stats,
-                                 t_placer_costs* costs,
-                                 t_placer_prev_inverse_costs* prev_inverse_costs,
-                                 int* moves_since_cost_recompute,
-                                 const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
-                                 const PlaceDelayModel* delay_model,
-                                 MoveGenerator& move_generator,
-                                 t_pl_blocks_to_be_moved& blocks_affected,
-                                 SetupTimingInfo& timing_info);
+static int placement_inner_loop(float t,
+                                float rlim,
+                                const t_placer_opts& placer_opts,
+                                const t_annealing_sched& annealing_sched,
+                                int move_lim,
+                                float crit_exponent,
+                                int inner_recompute_limit,
+                                t_placer_statistics* stats,
+                                t_placer_costs* costs,
+                                t_placer_prev_inverse_costs* prev_inverse_costs,
+                                int* moves_since_cost_recompute,
+                                const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                const PlaceDelayModel* delay_model,
+                                MoveGenerator& move_generator,
+                                t_pl_blocks_to_be_moved& blocks_affected,
+                                SetupTimingInfo& timing_info,
+                                vtr::RandState& rand_state);
+
+static int placement_quench(float rlim,
+                            const t_placer_opts& placer_opts,
+                            const t_annealing_sched& annealing_sched,
+                            int move_lim,
+                            float crit_exponent,
+                            int inner_recompute_limit,
+                            int num_connections,
+                            int* outer_crit_iter_count,
+                            t_placer_statistics* stats,
+                            t_placer_costs* costs,
+                            t_placer_prev_inverse_costs* prev_inverse_costs,
+                            int* moves_since_cost_recompute,
+                            const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                            const PlaceDelayModel* delay_model,
+                            MoveGenerator& move_generator,
+                            t_pl_blocks_to_be_moved& blocks_affected,
+                            SetupTimingInfo& timing_info,
+                            vtr::RandState& rand_state);
 
 static void recompute_costs_from_scratch(const t_placer_opts& placer_opts, const PlaceDelayModel* delay_model, t_placer_costs* costs);
 
@@ -438,6 +586,18 @@ static void print_place_status(const float t,
                                const float crit_exponent,
                                size_t tot_moves);
 
+static void record_move_telemetry(const t_pl_blocks_to_be_moved& blocks_affected, e_move_result outcome, double delta_c);
+
+static void print_temperature_stats(int num_temps,
+                                    double temperature,
+                                    float rlim,
+                                    float crit_exponent,
+                                    float success_rat,
+                                    double std_dev,
+                                    const t_placer_costs& costs,
+                                    const t_placer_statistics& stats,
+                                    int move_lim);
+
 /*****************************************************************************/
 void try_place(const t_placer_opts& placer_opts,
                t_annealing_sched annealing_sched,
@@ -499,7 +659,16 @@ void try_place(const t_placer_opts& placer_opts,
         }
     }
 
-    move_generator = std::make_unique<UniformMoveGenerator>();
+    //Schedule adaptively between undirected and directed move generators,
+    //favouring whichever is currently producing accepted cost reductions
+    auto adaptive_move_generator = std::make_unique<AdaptiveMoveGenerator>();
+    adaptive_move_generator->add_generator(std::make_unique<UniformMoveGenerator>());
+    adaptive_move_generator->add_generator(std::make_unique<MedianMoveGenerator>());
+    if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
+        //Criticality-weighted moves need the placement criticalities loaded
+        adaptive_move_generator->add_generator(std::make_unique<WeightedCentroidMoveGenerator>());
+    }
+    move_generator = std::move(adaptive_move_generator);
 
     width_fac = placer_opts.place_chan_width;
 
@@ -508,7 +677,15 @@ void try_place(const t_placer_opts& placer_opts,
     alloc_and_load_placement_structs(placer_opts.place_cost_exp, placer_opts,
                                      directs, num_directs);
 
-    initial_placement(placer_opts.pad_loc_type, placer_opts.pad_loc_file.c_str());
+    initial_placement(placer_opts.pad_loc_type, placer_opts.pad_loc_file.c_str(),
+                      placer_opts.read_initial_place_file.c_str());
+
+    if (placer_opts.enable_analytic_placer) {
+        /* Refine the random initial placement analytically; the annealing
+         * below then acts only as a low-temperature refinement */
+        run_analytic_placer();
+    }
+
     init_draw_coords((float)width_fac);
     //Enables fast look-up of atom pins connect to CLB pins
     ClusteredPinAtomPinsLookup netlist_pin_lookup(cluster_ctx.clb_nlist, pb_gpin_lookup);
@@ -517,6 +694,7 @@ void try_place(const t_placer_opts& placer_opts,
 
     if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE || placer_opts.enable_timing_computations) {
         costs.bb_cost = comp_bb_cost(NORMAL);
+        costs.bb_cost_comp = 0.;
 
         crit_exponent = placer_opts.td_place_exp_first; /*this will be modified when rlim starts to change */
 
@@ -555,6 +733,7 @@ void try_place(const t_placer_opts& placer_opts,
 
         /*now we can properly compute costs  */
         comp_td_costs(place_delay_model.get(), &costs.timing_cost); /*also updates values in point_to_point_delay */
+        costs.timing_cost_comp = 0.;
 
         outer_crit_iter_count = 1;
 
@@ -563,9 +742,11 @@ void try_place(const t_placer_opts& placer_opts,
         costs.cost = 1; /*our new cost function uses normalized values of           */
                         /*bb_cost and timing_cost, the value of cost will be reset  */
                         /*to 1 at each temperature when *_TIMING_DRIVEN_PLACE is true */
+        costs.cost_comp = 0.;
     } else {            /*BOUNDING_BOX_PLACE */
         costs.cost = costs.bb_cost = comp_bb_cost(NORMAL);
         costs.timing_cost = 0;
+        costs.cost_comp = costs.bb_cost_comp = costs.timing_cost_comp = 0.;
         outer_crit_iter_count = 0;
         num_connections = 0;
         crit_exponent = 0;
@@ -628,53 +809,92 @@ void try_place(const t_placer_opts& placer_opts,
     final_rlim = 1;
     inverse_delta_rlim = 1 / (first_rlim - final_rlim);
 
-    t = starting_t(&costs, &prev_inverse_costs,
-                   annealing_sched, move_lim, rlim,
-                   place_delay_model.get(),
-                   *move_generator,
-                   blocks_affected,
-                   placer_opts);
+    /* The annealing move/acceptance stream draws from its own explicit
+     * random state (seeded from the global generator, which was seeded
+     * with placer_opts.seed). Keeping the stream self-contained is a
+     * pre-requisite for region-partitioned parallel annealing, where each
+     * worker must own an independent stream. */
+    vtr::RandState rand_state = vtr::get_random_state();
+
+    /* The hot annealing phases are skipped when the starting placement is
+     * already good: either refined by the analytic placer, or warm started
+     * from a prior run's placement.  In that case only the low-temperature
+     * quench below is run, and no starting temperature is needed -- the
+     * trial moves starting_t() makes to estimate one would scramble the
+     * provided placement. */
+    bool quench_only = placer_opts.enable_analytic_placer
+                       || !placer_opts.read_initial_place_file.empty();
+
+    if (quench_only) {
+        t = 0.;
+    } else {
+        t = starting_t(&costs, &prev_inverse_costs,
+                       annealing_sched, move_lim, rlim,
+                       place_delay_model.get(),
+                       *move_generator,
+                       blocks_affected,
+                       placer_opts,
+                       rand_state);
+    }
 
     if (!placer_opts.move_stats_file.empty()) {
         f_move_stats_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(vtr::fopen(placer_opts.move_stats_file.c_str(), "w"), vtr::fclose);
         LOG_MOVE_STATS_HEADER();
     }
 
+    if (!placer_opts.temperature_stats_file.empty()) {
+        f_temperature_stats_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(vtr::fopen(placer_opts.temperature_stats_file.c_str(), "w"), vtr::fclose);
+    }
+
     tot_iter = 0;
     moves_since_cost_recompute = 0;
     int num_temps = 0;
 
+    CheckpointScheduler checkpoint_sched(placer_opts.checkpoint_interval);
+
     /* Outer loop of the simmulated annealing begins */
-    while (exit_crit(t, costs.cost, annealing_sched) == 0) {
+    while (!quench_only
+           && exit_crit(t, costs.cost, annealing_sched) == 0) {
         if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
             costs.cost = 1;
+            costs.cost_comp = 0.;
         }
 
-        outer_loop_recompute_criticalities(placer_opts, &costs, &prev_inverse_costs,
-                                           num_connections,
-                                           crit_exponent,
-                                           &outer_crit_iter_count,
-                                           netlist_pin_lookup,
-                                           place_delay_model.get(),
-                                           *timing_info);
+        {
+            vtr::Timer recompute_timer;
+            outer_loop_recompute_criticalities(placer_opts, &costs, &prev_inverse_costs,
+                                               num_connections,
+                                               crit_exponent,
+                                               &outer_crit_iter_count,
+                                               netlist_pin_lookup,
+                                               place_delay_model.get(),
+                                               *timing_info);
+            f_temperature_telemetry.recompute_criticalities_sec = recompute_timer.elapsed_sec();
+        }
 
-        placement_inner_loop(t, rlim, placer_opts,
-                             move_lim, crit_exponent, inner_recompute_limit, &stats,
-                             &costs,
-                             &prev_inverse_costs,
-                             &moves_since_cost_recompute,
-                             netlist_pin_lookup,
-                             place_delay_model.get(),
-                             *move_generator,
-                             blocks_affected,
-                             *timing_info);
+        int moves_this_temp;
+        {
+            vtr::Timer inner_loop_timer;
+            moves_this_temp = placement_inner_loop(t, rlim, placer_opts, annealing_sched,
+                                                   move_lim, crit_exponent, inner_recompute_limit, &stats,
+                                                   &costs,
+                                                   &prev_inverse_costs,
+                                                   &moves_since_cost_recompute,
+                                                   netlist_pin_lookup,
+                                                   place_delay_model.get(),
+                                                   *move_generator,
+                                                   blocks_affected,
+                                                   *timing_info,
+                                                   rand_state);
+            f_temperature_telemetry.inner_loop_sec = inner_loop_timer.elapsed_sec();
+        }
 
-        tot_iter += move_lim;
+        tot_iter += moves_this_temp;
 
-        calc_placer_stats(stats, success_rat, std_dev, costs, move_lim);
+        calc_placer_stats(stats, success_rat, std_dev, costs, moves_this_temp);
 
         oldt = t; /* for finding and printing alpha. */
-        update_t(&t, rlim, success_rat, annealing_sched);
+        update_t(&t, rlim, success_rat, std_dev, annealing_sched);
         ++num_temps;
 
         if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
@@ -688,6 +908,9 @@ void try_place(const t_placer_opts& placer_opts,
                            critical_path.delay(), sTNS, sWNS,
                            success_rat, std_dev, rlim, crit_exponent, tot_iter);
 
+        print_temperature_stats(num_temps, oldt, rlim, crit_exponent,
+                                success_rat, std_dev, costs, stats, moves_this_temp);
+
         sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
                 costs.cost, costs.bb_cost, costs.timing_cost, t);
         update_screen(ScreenUpdatePriority::MINOR, msg, PLACEMENT, timing_info);
@@ -699,6 +922,14 @@ void try_place(const t_placer_opts& placer_opts,
                             + placer_opts.td_place_exp_first;
         }
 
+        /* Snapshot the in-progress placement for crash recovery; an
+         * interrupted job can be resumed from the snapshot via
+         * --read_initial_place_file */
+        if (!placer_opts.place_checkpoint_file.empty() && checkpoint_sched.due()) {
+            print_place(nullptr, nullptr, placer_opts.place_checkpoint_file.c_str());
+            checkpoint_sched.mark();
+        }
+
 #ifdef VERBOSE
         if (getEchoEnabled()) {
             print_clb_placement("first_iteration_clb_placement.echo");
@@ -707,34 +938,30 @@ void try_place(const t_placer_opts& placer_opts,
     }
     /* Outer loop of the simmulated annealing ends */
 
-    outer_loop_recompute_criticalities(placer_opts, &costs,
-                                       &prev_inverse_costs,
-                                       num_connections,
-                                       crit_exponent,
-                                       &outer_crit_iter_count,
-                                       netlist_pin_lookup,
-                                       place_delay_model.get(),
-                                       *timing_info);
-
     t = 0; /* freeze out */
 
-    /* Run inner loop again with temperature = 0 so as to accept only swaps
-     * which reduce the cost of the placement */
-    placement_inner_loop(t, rlim, placer_opts,
-                         move_lim, crit_exponent, inner_recompute_limit, &stats,
-                         &costs,
-                         &prev_inverse_costs,
-                         &moves_since_cost_recompute,
-                         netlist_pin_lookup,
-                         place_delay_model.get(),
-                         *move_generator,
-                         blocks_affected,
-                         *timing_info);
-
-    tot_iter += move_lim;
+    /* Run the quench: repeated greedy (temperature = 0) passes which accept
+     * only swaps that reduce the cost of the placement, iterated until the
+     * cost converges */
+    int quench_moves = placement_quench(rlim, placer_opts, annealing_sched,
+                                        move_lim, crit_exponent, inner_recompute_limit,
+                                        num_connections,
+                                        &outer_crit_iter_count,
+                                        &stats,
+                                        &costs,
+                                        &prev_inverse_costs,
+                                        &moves_since_cost_recompute,
+                                        netlist_pin_lookup,
+                                        place_delay_model.get(),
+                                        *move_generator,
+                                        blocks_affected,
+                                        *timing_info,
+                                        rand_state);
+
+    tot_iter += quench_moves;
     ++num_temps;
 
-    calc_placer_stats(stats, success_rat, std_dev, costs, move_lim);
+    calc_placer_stats(stats, success_rat, std_dev, costs, quench_moves);
 
     if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
         critical_path = timing_info->least_slack_critical_path();
@@ -746,6 +973,9 @@ void try_place(const t_placer_opts& placer_opts,
                        critical_path.delay(), sTNS, sWNS,
                        success_rat, std_dev, rlim, crit_exponent, tot_iter);
 
+    print_temperature_stats(num_temps, t, rlim, crit_exponent,
+                            success_rat, std_dev, costs, stats, quench_moves);
+
     // TODO:
     // 1. add some subroutine hierarchy!  Too big!
 
@@ -770,6 +1000,7 @@ void try_place(const t_placer_opts& placer_opts,
                 set_timing_place_crit(net_id, ipin, 0); /*dummy crit values */
         }
         comp_td_costs(place_delay_model.get(), &costs.timing_cost); /*computes point_to_point_delay */
+        costs.timing_cost_comp = 0.;
     }
 
     if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE
@@ -863,10 +1094,16 @@ static void outer_loop_recompute_criticalities(const t_placer_opts& placer_opts,
 
         //Per-temperature timing update
         timing_info.update();
-        load_criticalities(timing_info, crit_exponent, netlist_pin_lookup);
-
-        /*recompute costs from scratch, based on new criticalities */
-        comp_td_costs(delay_model, &costs->timing_cost);
+        std::vector<ClusterPinId> modified_sink_pins;
+        if (update_criticalities(timing_info, crit_exponent, netlist_pin_lookup, modified_sink_pins)) {
+            /*only connections whose criticality changed need their costs refreshed */
+            update_td_costs(modified_sink_pins, &costs->timing_cost, &costs->timing_cost_comp);
+        } else {
+            /*criticalities were fully reloaded (e.g. crit_exponent changed), so
+             *recompute costs from scratch */
+            comp_td_costs(delay_model, &costs->timing_cost);
+            costs->timing_cost_comp = 0.;
+        }
         *outer_crit_iter_count = 0;
     }
     (*outer_crit_iter_count)++;
@@ -879,21 +1116,23 @@ static void outer_loop_recompute_criticalities(const t_placer_opts& placer_opts,
 }
 
 /* Function which contains the inner loop of the simulated annealing */
-static void placement_inner_loop(float t,
-                                 float rlim,
-                                 const t_placer_opts& placer_opts,
-                                 int move_lim,
-                                 float crit_exponent,
-                                 int inner_recompute_limit,
-                                 t_placer_statistics* stats,
-                                 t_placer_costs* costs,
-                                 t_placer_prev_inverse_costs* prev_inverse_costs,
-                                 int* moves_since_cost_recompute,
-                                 const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
-                                 const PlaceDelayModel* delay_model,
-                                 MoveGenerator& move_generator,
-                                 t_pl_blocks_to_be_moved& blocks_affected,
-                                 SetupTimingInfo& timing_info) {
+static int placement_inner_loop(float t,
+                                float rlim,
+                                const t_placer_opts& placer_opts,
+                                const t_annealing_sched& annealing_sched,
+                                int move_lim,
+                                float crit_exponent,
+                                int inner_recompute_limit,
+                                t_placer_statistics* stats,
+                                t_placer_costs* costs,
+                                t_placer_prev_inverse_costs* prev_inverse_costs,
+                                int* moves_since_cost_recompute,
+                                const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                const PlaceDelayModel* delay_model,
+                                MoveGenerator& move_generator,
+                                t_pl_blocks_to_be_moved& blocks_affected,
+                                SetupTimingInfo& timing_info,
+                                vtr::RandState& rand_state) {
     int inner_crit_iter_count, inner_iter;
 
     stats->av_cost = 0.;
@@ -904,6 +1143,12 @@ static void placement_inner_loop(float t,
 
     inner_crit_iter_count = 1;
 
+    /* Equilibrium detection state for the adaptive schedule */
+    int check_interval = std::max(1, move_lim / EQUILIBRIUM_NUM_CHECKS);
+    double last_check_cost = costs->cost;
+    int num_equilibrium_checks = 0;
+    int num_plateau_checks = 0;
+
     /* Inner loop begins */
     for (inner_iter = 0; inner_iter < move_lim; inner_iter++) {
         e_move_result swap_result = try_swap(t, costs, prev_inverse_costs, rlim,
@@ -912,7 +1157,8 @@ static void placement_inner_loop(float t,
                                              delay_model,
                                              placer_opts.rlim_escape_fraction,
                                              placer_opts.place_algorithm,
-                                             placer_opts.timing_tradeoff);
+                                             placer_opts.timing_tradeoff,
+                                             rand_state);
 
         if (swap_result == ACCEPTED) {
             /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
@@ -944,9 +1190,13 @@ static void placement_inner_loop(float t,
                  */
                 //Inner loop timing update
                 timing_info.update();
-                load_criticalities(timing_info, crit_exponent, netlist_pin_lookup);
-
-                comp_td_costs(delay_model, &costs->timing_cost);
+                std::vector<ClusterPinId> modified_sink_pins;
+                if (update_criticalities(timing_info, crit_exponent, netlist_pin_lookup, modified_sink_pins)) {
+                    update_td_costs(modified_sink_pins, &costs->timing_cost, &costs->timing_cost_comp);
+                } else {
+                    comp_td_costs(delay_model, &costs->timing_cost);
+                    costs->timing_cost_comp = 0.;
+                }
             }
             inner_crit_iter_count++;
         }
@@ -968,8 +1218,119 @@ static void placement_inner_loop(float t,
             recompute_costs_from_scratch(placer_opts, delay_model, costs);
             *moves_since_cost_recompute = 0;
         }
+
+        /* For the adaptive schedule: end this temperature early once the
+         * cost has plateaued (two consecutive checkpoints with negligible
+         * relative cost change); the remaining moves would just re-sample
+         * an equilibrium the anneal has already reached.
+         */
+        if (annealing_sched.type == ADAPTIVE_SCHED
+            && (inner_iter + 1) % check_interval == 0
+            && inner_iter != move_lim - 1) {
+            ++num_equilibrium_checks;
+
+            double rel_change = std::fabs(costs->cost - last_check_cost) / std::max(std::fabs(last_check_cost), std::numeric_limits<double>::min());
+            if (rel_change < EQUILIBRIUM_COST_TOL) {
+                ++num_plateau_checks;
+            } else {
+                num_plateau_checks = 0;
+            }
+            last_check_cost = costs->cost;
+
+            if (num_equilibrium_checks >= EQUILIBRIUM_MIN_CHECKS && num_plateau_checks >= 2) {
+                ++inner_iter; //Count this (completed) move
+                break;
+            }
+        }
     }
     /* Inner loop ends */
+
+    return inner_iter; //Number of moves actually attempted this temperature
+}
+
+/* Runs the final quench as a distinct greedy phase. At t = 0 only improving
+ * moves are accepted, so the cost is monotonically non-increasing and the
+ * greedy pass can safely be repeated: each pass refreshes the timing
+ * criticalities (so later passes chase the placement's current critical
+ * path) and then hill-climbs for up to move_lim moves. Passes repeat until
+ * a full pass improves the cost by less than QUENCH_CONVERGENCE_TOL
+ * (relative) or MAX_QUENCH_PASSES is reached. Returns the total number of
+ * moves attempted; *stats is left covering all quench passes combined. */
+static int placement_quench(float rlim,
+                            const t_placer_opts& placer_opts,
+                            const t_annealing_sched& annealing_sched,
+                            int move_lim,
+                            float crit_exponent,
+                            int inner_recompute_limit,
+                            int num_connections,
+                            int* outer_crit_iter_count,
+                            t_placer_statistics* stats,
+                            t_placer_costs* costs,
+                            t_placer_prev_inverse_costs* prev_inverse_costs,
+                            int* moves_since_cost_recompute,
+                            const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                            const PlaceDelayModel* delay_model,
+                            MoveGenerator& move_generator,
+                            t_pl_blocks_to_be_moved& blocks_affected,
+                            SetupTimingInfo& timing_info,
+                            vtr::RandState& rand_state) {
+    int total_moves = 0;
+
+    t_placer_statistics quench_stats;
+    quench_stats.av_cost = 0.;
+    quench_stats.av_bb_cost = 0.;
+    quench_stats.av_timing_cost = 0.;
+    quench_stats.sum_of_squares = 0.;
+    quench_stats.success_sum = 0;
+
+    for (int pass = 0; pass < MAX_QUENCH_PASSES; ++pass) {
+        {
+            vtr::Timer recompute_timer;
+            outer_loop_recompute_criticalities(placer_opts, costs,
+                                               prev_inverse_costs,
+                                               num_connections,
+                                               crit_exponent,
+                                               outer_crit_iter_count,
+                                               netlist_pin_lookup,
+                                               delay_model,
+                                               timing_info);
+            f_temperature_telemetry.recompute_criticalities_sec += recompute_timer.elapsed_sec();
+        }
+
+        double pre_pass_cost = costs->cost;
+
+        {
+            vtr::Timer inner_loop_timer;
+            total_moves += placement_inner_loop(0. /*t*/, rlim, placer_opts, annealing_sched,
+                                                move_lim, crit_exponent, inner_recompute_limit, stats,
+                                                costs,
+                                                prev_inverse_costs,
+                                                moves_since_cost_recompute,
+                                                netlist_pin_lookup,
+                                                delay_model,
+                                                move_generator,
+                                                blocks_affected,
+                                                timing_info,
+                                                rand_state);
+            f_temperature_telemetry.inner_loop_sec += inner_loop_timer.elapsed_sec();
+        }
+
+        /* placement_inner_loop() resets *stats, so fold each pass into the
+         * combined quench statistics */
+        quench_stats.av_cost += stats->av_cost;
+        quench_stats.av_bb_cost += stats->av_bb_cost;
+        quench_stats.av_timing_cost += stats->av_timing_cost;
+        quench_stats.sum_of_squares += stats->sum_of_squares;
+        quench_stats.success_sum += stats->success_sum;
+
+        if (pre_pass_cost - costs->cost < QUENCH_CONVERGENCE_TOL * pre_pass_cost) {
+            break; //Converged: the last full pass no longer pays for itself
+        }
+    }
+
+    *stats = quench_stats;
+
+    return total_moves;
 }
 
 static void recompute_costs_from_scratch(const t_placer_opts& placer_opts, const PlaceDelayModel* delay_model, t_placer_costs* costs) {
@@ -980,6 +1341,7 @@ static void recompute_costs_from_scratch(const t_placer_opts& placer_opts, const
         VPR_ERROR(VPR_ERROR_PLACE, msg.c_str());
     }
     costs->bb_cost = new_bb_cost;
+    costs->bb_cost_comp = 0.;
 
     if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
         double new_timing_cost = 0.;
@@ -990,10 +1352,12 @@ static void recompute_costs_from_scratch(const t_placer_opts& placer_opts, const
             VPR_ERROR(VPR_ERROR_PLACE, msg.c_str());
         }
         costs->timing_cost = new_timing_cost;
+        costs->timing_cost_comp = 0.;
     } else {
         VTR_ASSERT(placer_opts.place_algorithm == BOUNDING_BOX_PLACE);
 
         costs->cost = new_bb_cost;
+        costs->cost_comp = 0.;
     }
 }
 
@@ -1046,11 +1410,22 @@ static void update_rlim(float* rlim, float success_rat, const DeviceGrid& grid)
 }
 
 /* Update the temperature according to the annealing schedule selected. */
-static void update_t(float* t, float rlim, float success_rat, t_annealing_sched annealing_sched) {
+static void update_t(float* t, float rlim, float success_rat, double std_dev, t_annealing_sched annealing_sched) {
     /*  float fac; */
 
     if (annealing_sched.type == USER_SCHED) {
         *t = annealing_sched.alpha_t * (*t);
+    } else if (annealing_sched.type == ADAPTIVE_SCHED) {
+        /* Statistics-driven cooling: take small temperature steps where the
+         * measured cost distribution is wide (sigma large relative to T, so
+         * the anneal is doing useful hill climbing) and large steps where it
+         * is narrow (the cost landscape at this temperature is exhausted). */
+        float alpha = ADAPTIVE_SCHED_MIN_ALPHA;
+        if (std_dev > 0.) {
+            alpha = std::exp(-ADAPTIVE_SCHED_LAMBDA * (*t) / float(std_dev));
+            alpha = std::max(ADAPTIVE_SCHED_MIN_ALPHA, std::min(ADAPTIVE_SCHED_MAX_ALPHA, alpha));
+        }
+        *t = (*t) * alpha;
     } else { /* AUTO_SCHED */
         if (success_rat > 0.96) {
             *t = (*t) * 0.5;
@@ -1098,7 +1473,8 @@ static float starting_t(t_placer_costs* costs,
                         const PlaceDelayModel* delay_model,
                         MoveGenerator& move_generator,
                         t_pl_blocks_to_be_moved& blocks_affected,
-                        const t_placer_opts& placer_opts) {
+                        const t_placer_opts& placer_opts,
+                        vtr::RandState& rand_state) {
     /* Finds the starting temperature (hot condition).              */
 
     int i, num_accepted, move_lim;
@@ -1124,7 +1500,8 @@ static float starting_t(t_placer_costs* costs,
                                              delay_model,
                                              placer_opts.rlim_escape_fraction,
                                              placer_opts.place_algorithm,
-                                             placer_opts.timing_tradeoff);
+                                             placer_opts.timing_tradeoff,
+                                             rand_state);
 
         if (swap_result == ACCEPTED) {
             num_accepted++;
@@ -1164,23 +1541,22 @@ static void update_move_nets(int num_nets_affected) {
     for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
         ClusterNetId net_id = ts_nets_to_update[inet_affected];
 
-        bb_coords[net_id] = ts_bb_coord_new[net_id];
+        bb_coords[net_id] = ts_bb_coord_new[inet_affected];
         if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET)
-            bb_num_on_edges[net_id] = ts_bb_edge_new[net_id];
+            bb_num_on_edges[net_id] = ts_bb_edge_new[inet_affected];
 
-        net_cost[net_id] = temp_net_cost[net_id];
+        net_cost[net_id] = ts_net_cost_new[inet_affected];
 
-        /* negative temp_net_cost value is acting as a flag. */
-        temp_net_cost[net_id] = -1;
+        ts_net_index[net_id] = OPEN;
         bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
 }
 
 static void reset_move_nets(int num_nets_affected) {
-    /* Reset the net cost function flags first. */
+    /* Reset the affected-net flags first. */
     for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
         ClusterNetId net_id = ts_nets_to_update[inet_affected];
-        temp_net_cost[net_id] = -1;
+        ts_net_index[net_id] = OPEN;
         bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
 }
@@ -1194,7 +1570,8 @@ static e_move_result try_swap(float t,
                               const PlaceDelayModel* delay_model,
                               float rlim_escape_fraction,
                               enum e_place_algorithm place_algorithm,
-                              float timing_tradeoff) {
+                              float timing_tradeoff,
+                              vtr::RandState& rand_state) {
     /* Picks some block and moves it to another spot.  If this spot is   *
      * occupied, switch the blocks.  Assess the change in cost function. *
      * rlim is the range limiter.                                        *
@@ -1205,21 +1582,18 @@ static e_move_result try_swap(float t,
 
     MoveOutcomeStats move_outcome_stats;
 
-    /* I'm using negative values of temp_net_cost as a flag, so DO NOT   *
-     * use cost functions that can go negative.                          */
-
     double delta_c = 0; /* Change in cost due to this swap. */
     double bb_delta_c = 0;
     double timing_delta_c = 0;
 
     //Allow some fraction of moves to not be restricted by rlim,
     //in the hopes of better escaping local minima
-    if (rlim_escape_fraction > 0. && vtr::frand() < rlim_escape_fraction) {
+    if (rlim_escape_fraction > 0. && vtr::frand(rand_state) < rlim_escape_fraction) {
         rlim = std::numeric_limits<float>::infinity();
     }
 
     //Generate a new move (perturbation) used to explore the space of possible placements
-    e_create_move create_move_outcome = move_generator.propose_move(blocks_affected, rlim);
+    e_create_move create_move_outcome = move_generator.propose_move(blocks_affected, rlim, rand_state);
 
     LOG_MOVE_STATS_PROPOSED(t, blocks_affected);
 
@@ -1268,16 +1642,16 @@ static e_move_result try_swap(float t,
         }
 
         /* 1 -> move accepted, 0 -> rejected. */
-        move_outcome = assess_swap(delta_c, t);
+        move_outcome = assess_swap(delta_c, t, rand_state);
 
         if (move_outcome == ACCEPTED) {
-            costs->cost += delta_c;
-            costs->bb_cost += bb_delta_c;
+            add_compensated(delta_c, &costs->cost, &costs->cost_comp);
+            add_compensated(bb_delta_c, &costs->bb_cost, &costs->bb_cost_comp);
 
             if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
                 /*update the point_to_point_timing_cost and point_to_point_delay
                  * values from the temporary values */
-                costs->timing_cost += timing_delta_c;
+                add_compensated(timing_delta_c, &costs->timing_cost, &costs->timing_cost_comp);
 
                 update_td_cost(blocks_affected);
             }
@@ -1309,6 +1683,10 @@ static e_move_result try_swap(float t,
 
     move_outcome_stats.outcome = move_outcome;
 
+    if (f_temperature_stats_file) {
+        record_move_telemetry(blocks_affected, move_outcome, delta_c);
+    }
+
     move_generator.process_outcome(move_outcome_stats);
 
     clear_move_blocks(blocks_affected);
@@ -1337,6 +1715,11 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
 
     int num_affected_nets = 0;
 
+    //Flag the moved blocks up-front so each pin's driven-by-moved-block
+    //query below is a constant-time lookup (long macros would otherwise
+    //pay a full scan of the moved-block list per sink pin)
+    set_blocks_moved_flags(blocks_affected, true);
+
     //Go through all the blocks moved
     for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
         ClusterBlockId blk = blocks_affected.moved_blocks[iblk].block_num;
@@ -1350,17 +1733,17 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
                 continue; //TODO: do we require anyting special here for global nets. "Global nets are assumed to span the whole chip, and do not effect costs"
 
             //Record effected nets
-            record_affected_net(net_id, num_affected_nets);
+            int inet_affected = record_affected_net(net_id, num_affected_nets);
 
             //Update the net bounding boxes
             //
             //Do not update the net cost here since it should only be updated
             //once per net, not once per pin.
-            update_net_bb(net_id, blocks_affected, iblk, blk, blk_pin);
+            update_net_bb(net_id, inet_affected, blocks_affected, iblk, blk, blk_pin);
 
             if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
                 //Determine the change in timing costs if required
-                update_td_delta_costs(delay_model, blocks_affected, net_id, blk_pin, timing_delta_c);
+                update_td_delta_costs(delay_model, net_id, blk_pin, timing_delta_c);
             }
         }
     }
@@ -1371,26 +1754,32 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
     for (int inet_affected = 0; inet_affected < num_affected_nets; inet_affected++) {
         ClusterNetId net_id = ts_nets_to_update[inet_affected];
 
-        temp_net_cost[net_id] = get_net_cost(net_id, &ts_bb_coord_new[net_id]);
-        bb_delta_c += temp_net_cost[net_id] - net_cost[net_id];
+        ts_net_cost_new[inet_affected] = get_net_cost(net_id, &ts_bb_coord_new[inet_affected]);
+        bb_delta_c += ts_net_cost_new[inet_affected] - net_cost[net_id];
     }
 
+    set_blocks_moved_flags(blocks_affected, false);
+
     return num_affected_nets;
 }
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets) {
-    //Record effected nets
-    if (temp_net_cost[net] < 0.) {
+//Records the net as affected by the current move (if not already recorded)
+//and returns its slot in the dense per-move scratch arrays
+static int record_affected_net(const ClusterNetId net, int& num_affected_nets) {
+    int inet_affected = ts_net_index[net];
+    if (inet_affected == OPEN) {
         //Net not marked yet.
-        ts_nets_to_update[num_affected_nets] = net;
+        inet_affected = num_affected_nets;
         num_affected_nets++;
 
-        //Flag to say we've marked this net.
-        temp_net_cost[net] = 1.;
+        ts_nets_to_update[inet_affected] = net;
+        ts_net_index[net] = inet_affected;
     }
+    return inet_affected;
 }
 
 static void update_net_bb(const ClusterNetId net,
+                          int inet_affected,
                           const t_pl_blocks_to_be_moved& blocks_affected,
                           int iblk,
                           const ClusterBlockId blk,
@@ -1401,7 +1790,7 @@ static void update_net_bb(const ClusterNetId net,
         //For small nets brute-force bounding box update is faster
 
         if (bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
-            get_non_updateable_bb(net, &ts_bb_coord_new[net]);
+            get_non_updateable_bb(net, &ts_bb_coord_new[inet_affected]);
         }
     } else {
         //For large nets, update bounding box incrementally
@@ -1412,8 +1801,8 @@ static void update_net_bb(const ClusterNetId net,
         int pin_height_offset = blk_type->pin_height_offset[iblk_pin];
 
         //Incremental bounding box update
-        update_bb(net, &ts_bb_coord_new[net],
-                  &ts_bb_edge_new[net],
+        update_bb(net, &ts_bb_coord_new[inet_affected],
+                  &ts_bb_edge_new[inet_affected],
                   blocks_affected.moved_blocks[iblk].old_loc.x + pin_width_offset,
                   blocks_affected.moved_blocks[iblk].old_loc.y + pin_height_offset,
                   blocks_affected.moved_blocks[iblk].new_loc.x + pin_width_offset,
@@ -1421,7 +1810,7 @@ static void update_net_bb(const ClusterNetId net,
     }
 }
 
-static void update_td_delta_costs(const PlaceDelayModel* delay_model, const t_pl_blocks_to_be_moved& blocks_affected, const ClusterNetId net, const ClusterPinId pin, double& delta_timing_cost) {
+static void update_td_delta_costs(const PlaceDelayModel* delay_model, const ClusterNetId net, const ClusterPinId pin, double& delta_timing_cost) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     if (cluster_ctx.clb_nlist.pin_type(pin) == PinType::DRIVER) {
@@ -1444,19 +1833,19 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model, const t_pl
         //
         //Computing it here would double count the change, and mess up the
         //delta_timing_cost value.
-        if (!driven_by_moved_block(net, blocks_affected)) {
+        if (!driven_by_moved_block(net)) {
             int net_pin = cluster_ctx.clb_nlist.pin_net_index(pin);
 
             float temp_delay = comp_td_point_to_point_delay(delay_model, net, net_pin);
             temp_point_to_point_delay[net][net_pin] = temp_delay;
 
-            temp_point_to_point_timing_cost[net][net_pin] = get_timing_place_crit(net, net_pin) * temp_delay;
+            temp_point_to_point_timing_cost[net][net_pin] = get_timing_place_crit(pin) * temp_delay;
             delta_timing_cost += temp_point_to_point_timing_cost[net][net_pin] - point_to_point_timing_cost[net][net_pin];
         }
     }
 }
 
-static e_move_result assess_swap(double delta_c, double t) {
+static e_move_result assess_swap(double delta_c, double t, vtr::RandState& rand_state) {
     /* Returns: 1 -> move accepted, 0 -> rejected. */
     if (delta_c <= 0) {
         return ACCEPTED;
@@ -1466,7 +1855,7 @@ static e_move_result assess_swap(double delta_c, double t) {
         return REJECTED;
     }
 
-    float fnum = vtr::frand();
+    float fnum = vtr::frand(rand_state);
     float prob_fac = std::exp(-delta_c / t);
     if (prob_fac > fnum) {
         return ACCEPTED;
@@ -1481,13 +1870,14 @@ static double recompute_bb_cost() {
      * cost.                                                             */
 
     double cost = 0;
+    double compensation = 0;
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
             /* Bounding boxes don't have to be recomputed; they're correct. */
-            cost += net_cost[net_id];
+            add_compensated(net_cost[net_id], &cost, &compensation);
         }
     }
 
@@ -1562,6 +1952,8 @@ static void comp_td_point_to_point_delays(const PlaceDelayModel* delay_model) {
 static void update_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
+    set_blocks_moved_flags(blocks_affected, true);
+
     /* Go through all the blocks moved. */
     for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
         ClusterBlockId bnum = blocks_affected.moved_blocks[iblk].block_num;
@@ -1585,7 +1977,7 @@ static void update_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
                 VTR_ASSERT_SAFE(cluster_ctx.clb_nlist.pin_type(pin_id) == PinType::SINK);
 
                 /* The following "if" prevents the value from being updated twice. */
-                if (!driven_by_moved_block(net_id, blocks_affected)) {
+                if (!driven_by_moved_block(net_id)) {
                     int net_pin = cluster_ctx.clb_nlist.pin_net_index(pin_id);
 
                     point_to_point_delay[net_id][net_pin] = temp_point_to_point_delay[net_id][net_pin];
@@ -1596,18 +1988,23 @@ static void update_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
             }
         } /* Finished going through all the pins in the moved block */
     }     /* Finished going through all the blocks moved */
+
+    set_blocks_moved_flags(blocks_affected, false);
 }
 
-static bool driven_by_moved_block(const ClusterNetId net, const t_pl_blocks_to_be_moved& blocks_affected) {
+static bool driven_by_moved_block(const ClusterNetId net) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    ClusterBlockId net_driver_block = cluster_ctx.clb_nlist.net_driver_block(net);
+    return ts_block_is_moved[cluster_ctx.clb_nlist.net_driver_block(net)];
+}
+
+//Marks (or un-marks) every block moved by the current move in
+//ts_block_is_moved.  Called once per move so the per-pin
+//driven_by_moved_block() queries are O(1) regardless of macro length.
+static void set_blocks_moved_flags(const t_pl_blocks_to_be_moved& blocks_affected, bool moved) {
     for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
-        if (net_driver_block == blocks_affected.moved_blocks[iblk].block_num) {
-            return true;
-        }
+        ts_block_is_moved[blocks_affected.moved_blocks[iblk].block_num] = moved;
     }
-    return false;
 }
 
 static void comp_td_costs(const PlaceDelayModel* delay_model, double* timing_cost) {
@@ -1618,6 +2015,7 @@ static void comp_td_costs(const PlaceDelayModel* delay_model, double* timing_cos
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     double new_timing_cost = 0.;
+    double compensation = 0.;
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) { /* For each net ... */
 
@@ -1634,7 +2032,7 @@ static void comp_td_costs(const PlaceDelayModel* delay_model, double* timing_cos
 
             point_to_point_timing_cost[net_id][ipin] = conn_timing_cost;
             temp_point_to_point_timing_cost[net_id][ipin] = INVALID_DELAY;
-            new_timing_cost += conn_timing_cost;
+            add_compensated(conn_timing_cost, &new_timing_cost, &compensation);
         }
     }
 
@@ -1642,6 +2040,26 @@ static void comp_td_costs(const PlaceDelayModel* delay_model, double* timing_cos
     *timing_cost = new_timing_cost;
 }
 
+/* Incrementally updates the timing cost for only those connections whose     *
+ * criticality changed during the last timing update (see                     *
+ * update_criticalities()).  The connection delays are not recomputed: the    *
+ * point_to_point_delay values are kept up to date by update_td_cost() as     *
+ * moves are accepted.  The updates are accumulated with compensated          *
+ * summation so they do not drift from the true cost.                         */
+static void update_td_costs(const std::vector<ClusterPinId>& modified_sink_pins, double* timing_cost, double* timing_cost_comp) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    for (ClusterPinId clb_pin : modified_sink_pins) {
+        ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(clb_pin);
+        int ipin = cluster_ctx.clb_nlist.pin_net_index(clb_pin);
+
+        double conn_timing_cost = point_to_point_delay[net_id][ipin] * get_timing_place_crit(clb_pin);
+
+        add_compensated(conn_timing_cost - point_to_point_timing_cost[net_id][ipin], timing_cost, timing_cost_comp);
+        point_to_point_timing_cost[net_id][ipin] = conn_timing_cost;
+    }
+}
+
 /* Finds the cost from scratch.  Done only when the placement   *
  * has been radically changed (i.e. after initial placement).   *
  * Otherwise find the cost change incrementally.  If method     *
@@ -1652,24 +2070,74 @@ static void comp_td_costs(const PlaceDelayModel* delay_model, double* timing_cos
  * other routine.                                               */
 static double comp_bb_cost(e_cost_methods method) {
     double cost = 0;
+    double compensation = 0;
     double expected_wirelength = 0.0;
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
-        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
-            /* Small nets don't use incremental updating on their bounding boxes, *
-             * so they can use a fast bounding box calculator.                    */
-            if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET && method == NORMAL) {
-                get_bb_from_scratch(net_id, &bb_coords[net_id],
-                                    &bb_num_on_edges[net_id]);
-            } else {
-                get_non_updateable_bb(net_id, &bb_coords[net_id]);
+    size_t num_nets = cluster_ctx.clb_nlist.nets().size();
+
+    /* Computes the bounding box and cost of each net in the given range,
+     * returning the range's (compensated) cost sum. Each net's results go
+     * to its own bb_coords/bb_num_on_edges/net_cost entries, so disjoint
+     * ranges can be computed concurrently. */
+    auto comp_bb_cost_range = [&](size_t inet_begin, size_t inet_end) -> double {
+        double range_cost = 0;
+        double range_compensation = 0;
+
+        for (size_t inet = inet_begin; inet < inet_end; ++inet) {
+            ClusterNetId net_id(inet);
+
+            if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
+                /* Small nets don't use incremental updating on their bounding boxes, *
+                 * so they can use a fast bounding box calculator.                    */
+                if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET && method == NORMAL) {
+                    get_bb_from_scratch(net_id, &bb_coords[net_id],
+                                        &bb_num_on_edges[net_id]);
+                } else {
+                    get_non_updateable_bb(net_id, &bb_coords[net_id]);
+                }
+
+                net_cost[net_id] = get_net_cost(net_id, &bb_coords[net_id]);
+                add_compensated(net_cost[net_id], &range_cost, &range_compensation);
+                if (method == CHECK)
+                    expected_wirelength += get_net_wirelength_estimate(net_id, &bb_coords[net_id]);
             }
+        }
+
+        return range_cost;
+    };
 
-            net_cost[net_id] = get_net_cost(net_id, &bb_coords[net_id]);
-            cost += net_cost[net_id];
-            if (method == CHECK)
-                expected_wirelength += get_net_wirelength_estimate(net_id, &bb_coords[net_id]);
+    /* The CHECK path stays serial: it is a verification event, and it
+     * accumulates the expected wirelength above. */
+    size_t num_bb_workers = 1;
+    if (method == NORMAL && std::thread::hardware_concurrency() > 1) {
+        num_bb_workers = std::min<size_t>(std::thread::hardware_concurrency(), std::max<size_t>(1, num_nets / MIN_NETS_PER_BB_COST_WORKER));
+    }
+
+    if (num_bb_workers <= 1) {
+        cost = comp_bb_cost_range(0, num_nets);
+    } else {
+        /* Each worker computes a contiguous net range; the partial sums
+         * are combined (in worker order) after all workers have joined. */
+        std::vector<double> worker_costs(num_bb_workers, 0.);
+
+        size_t nets_per_worker = (num_nets + num_bb_workers - 1) / num_bb_workers;
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_bb_workers);
+        for (size_t iworker = 0; iworker < num_bb_workers; ++iworker) {
+            size_t inet_begin = std::min(num_nets, iworker * nets_per_worker);
+            size_t inet_end = std::min(num_nets, inet_begin + nets_per_worker);
+            workers.emplace_back([&, iworker, inet_begin, inet_end]() {
+                worker_costs[iworker] = comp_bb_cost_range(inet_begin, inet_end);
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        for (double worker_cost : worker_costs) {
+            add_compensated(worker_cost, &cost, &compensation);
         }
     }
 
@@ -1780,13 +2248,9 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
     }
 
     net_cost.resize(num_nets, -1.);
-    temp_net_cost.resize(num_nets, -1.);
     bb_coords.resize(num_nets, t_bb());
     bb_num_on_edges.resize(num_nets, t_bb());
 
-    /* Used to store costs for moves not yet made and to indicate when a net's   *
-     * cost has been recomputed. temp_net_cost[inet] < 0 means net's cost hasn't *
-     * been recomputed.                                                          */
     bb_updated_before.resize(num_nets, NOT_UPDATED_YET);
 
     alloc_and_load_for_fast_cost_update(place_cost_exp);
@@ -1841,84 +2305,102 @@ static void alloc_and_load_try_swap_structs() {
 
     ts_bb_coord_new.resize(num_nets, t_bb());
     ts_bb_edge_new.resize(num_nets, t_bb());
+    ts_net_cost_new.resize(num_nets, -1.);
     ts_nets_to_update.resize(num_nets, ClusterNetId::INVALID());
+    ts_net_index.resize(num_nets, OPEN);
+    ts_block_is_moved.resize(cluster_ctx.clb_nlist.blocks().size(), false);
 
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     place_ctx.compressed_block_grids = create_compressed_block_grids();
 }
 
+/* Scratch pin-coordinate arrays (structure-of-arrays) reused by the      *
+ * bounding box kernels below.  Gathering each net's pin locations into   *
+ * these dense arrays first lets the min/max reductions and edge counts   *
+ * run as tight branchless loops the compiler can vectorize, instead of   *
+ * branchy per-pin updates interleaved with netlist lookups.              *
+ * thread_local since comp_bb_cost() runs the kernels from worker threads. */
+static thread_local std::vector<int> f_bb_pin_x;
+static thread_local std::vector<int> f_bb_pin_y;
+
+/* Gathers the pin locations of net_id (driver first, matching the net    *
+ * pin order) into f_bb_pin_x/f_bb_pin_y, clamped to the                  *
+ * [1..grid.width()-2] x [1..grid.height()-2] channel-carrying region,    *
+ * and returns the number of pins gathered.                               *
+ *                                                                        *
+ * The clamping counts IO blocks as being within the 1..grid.width()-2,   *
+ * 1..grid.height()-2 clb array. This is because channels do not go out   *
+ * of the 0..grid.width()-2, 0..grid.height()-2 range, and I always take  *
+ * all channels impinging on the bounding box to be within that bounding  *
+ * box.  Hence, this "movement" of IO blocks does not affect which        *
+ * channels are included within the bounding box, and it simplifies the   *
+ * code a lot.                                                            */
+static size_t load_net_pin_coords(ClusterNetId net_id) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    int max_x = device_ctx.grid.width() - 2;  //-2 for no perim channels
+    int max_y = device_ctx.grid.height() - 2; //-2 for no perim channels
+
+    auto pins = cluster_ctx.clb_nlist.net_pins(net_id);
+    size_t num_pins = pins.size();
+
+    if (f_bb_pin_x.size() < num_pins) {
+        f_bb_pin_x.resize(num_pins);
+        f_bb_pin_y.resize(num_pins);
+    }
+
+    size_t ipin = 0;
+    for (auto pin_id : pins) {
+        ClusterBlockId bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
+        int pnum = cluster_ctx.clb_nlist.pin_physical_index(pin_id);
+        int x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
+        int y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
+
+        f_bb_pin_x[ipin] = max(min<int>(x, max_x), 1);
+        f_bb_pin_y[ipin] = max(min<int>(y, max_y), 1);
+        ++ipin;
+    }
+
+    return num_pins;
+}
+
 /* This routine finds the bounding box of each net from scratch (i.e.   *
  * from only the block location information).  It updates both the       *
  * coordinate and number of pins on each edge information.  It           *
  * should only be called when the bounding box information is not valid. */
 static void get_bb_from_scratch(ClusterNetId net_id, t_bb* coords, t_bb* num_on_edges) {
-    int pnum, x, y, xmin, xmax, ymin, ymax;
-    int xmin_edge, xmax_edge, ymin_edge, ymax_edge;
+    size_t num_pins = load_net_pin_coords(net_id);
+    VTR_ASSERT(num_pins > 0);
 
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& device_ctx = g_vpr_ctx.device();
-    auto& grid = device_ctx.grid;
-
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    pnum = cluster_ctx.clb_nlist.net_pin_physical_index(net_id, 0);
-    VTR_ASSERT(pnum >= 0);
-    x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-    y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-    x = max(min<int>(x, grid.width() - 2), 1);
-    y = max(min<int>(y, grid.height() - 2), 1);
-
-    xmin = x;
-    ymin = y;
-    xmax = x;
-    ymax = y;
-    xmin_edge = 1;
-    ymin_edge = 1;
-    xmax_edge = 1;
-    ymax_edge = 1;
-
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        pnum = cluster_ctx.clb_nlist.pin_physical_index(pin_id);
-        x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-        y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-        /* Code below counts IO blocks as being within the 1..grid.width()-2, 1..grid.height()-2 clb array. *
-         * This is because channels do not go out of the 0..grid.width()-2, 0..grid.height()-2 range, and   *
-         * I always take all channels impinging on the bounding box to be within   *
-         * that bounding box.  Hence, this "movement" of IO blocks does not affect *
-         * the which channels are included within the bounding box, and it         *
-         * simplifies the code a lot.                                              */
-
-        x = max(min<int>(x, grid.width() - 2), 1);  //-2 for no perim channels
-        y = max(min<int>(y, grid.height() - 2), 1); //-2 for no perim channels
-
-        if (x == xmin) {
-            xmin_edge++;
-        }
-        if (x == xmax) { /* Recall that xmin could equal xmax -- don't use else */
-            xmax_edge++;
-        } else if (x < xmin) {
-            xmin = x;
-            xmin_edge = 1;
-        } else if (x > xmax) {
-            xmax = x;
-            xmax_edge = 1;
-        }
-
-        if (y == ymin) {
-            ymin_edge++;
-        }
-        if (y == ymax) {
-            ymax_edge++;
-        } else if (y < ymin) {
-            ymin = y;
-            ymin_edge = 1;
-        } else if (y > ymax) {
-            ymax = y;
-            ymax_edge = 1;
-        }
+    const int* pin_x = f_bb_pin_x.data();
+    const int* pin_y = f_bb_pin_y.data();
+
+    /* Min/max reductions over the gathered coordinates */
+    int xmin = pin_x[0];
+    int xmax = pin_x[0];
+    int ymin = pin_y[0];
+    int ymax = pin_y[0];
+
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        xmin = min(xmin, pin_x[ipin]);
+        xmax = max(xmax, pin_x[ipin]);
+        ymin = min(ymin, pin_y[ipin]);
+        ymax = max(ymax, pin_y[ipin]);
+    }
+
+    /* Count the pins lying on each bounding box edge in a second pass */
+    int xmin_edge = 0;
+    int xmax_edge = 0;
+    int ymin_edge = 0;
+    int ymax_edge = 0;
+
+    for (size_t ipin = 0; ipin < num_pins; ++ipin) {
+        xmin_edge += (pin_x[ipin] == xmin);
+        xmax_edge += (pin_x[ipin] == xmax);
+        ymin_edge += (pin_y[ipin] == ymin);
+        ymax_edge += (pin_y[ipin] == ymax);
     }
 
     /* Copy the coordinates and number on edges information into the proper   *
@@ -2012,54 +2494,36 @@ static double get_net_cost(ClusterNetId net_id, t_bb* bbptr) {
 static void get_non_updateable_bb(ClusterNetId net_id, t_bb* bb_coord_new) {
     //TODO: account for multiple physical pin instances per logical pin
 
-    int xmax, ymax, xmin, ymin, x, y;
-    int pnum;
-
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& device_ctx = g_vpr_ctx.device();
-
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    pnum = cluster_ctx.clb_nlist.net_pin_physical_index(net_id, 0);
-    x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-    y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-    xmin = x;
-    ymin = y;
-    xmax = x;
-    ymax = y;
-
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        pnum = cluster_ctx.clb_nlist.pin_physical_index(pin_id);
-        x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-        y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-        if (x < xmin) {
-            xmin = x;
-        } else if (x > xmax) {
-            xmax = x;
-        }
-
-        if (y < ymin) {
-            ymin = y;
-        } else if (y > ymax) {
-            ymax = y;
-        }
-    }
-
-    /* Now I've found the coordinates of the bounding box.  There are no *
-     * channels beyond device_ctx.grid.width()-2 and                     *
-     * device_ctx.grid.height() - 2, so I want to clip to that.  As well,*
-     * since I'll always include the channel immediately below and the   *
-     * channel immediately to the left of the bounding box, I want to    *
-     * clip to 1 in both directions as well (since minimum channel index *
-     * is 0).  See route_common.cpp for a channel diagram.               */
-
-    bb_coord_new->xmin = max(min<int>(xmin, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-    bb_coord_new->ymin = max(min<int>(ymin, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
-    bb_coord_new->xmax = max(min<int>(xmax, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-    bb_coord_new->ymax = max(min<int>(ymax, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
+    /* The pin coordinates are gathered pre-clamped to the channel-carrying
+     * region (clamping each pin first yields the same bounding box as
+     * clamping the final extremes, since the clamp is monotonic; there are
+     * no channels beyond device_ctx.grid.width()-2 and
+     * device_ctx.grid.height()-2, and since I'll always include the channel
+     * immediately below and the channel immediately to the left of the
+     * bounding box, the minimum is clipped to 1 in both directions as well.
+     * See route_common.cpp for a channel diagram). */
+    size_t num_pins = load_net_pin_coords(net_id);
+    VTR_ASSERT(num_pins > 0);
+
+    const int* pin_x = f_bb_pin_x.data();
+    const int* pin_y = f_bb_pin_y.data();
+
+    int xmin = pin_x[0];
+    int xmax = pin_x[0];
+    int ymin = pin_y[0];
+    int ymax = pin_y[0];
+
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        xmin = min(xmin, pin_x[ipin]);
+        xmax = max(xmax, pin_x[ipin]);
+        ymin = min(ymin, pin_y[ipin]);
+        ymax = max(ymax, pin_y[ipin]);
+    }
+
+    bb_coord_new->xmin = xmin;
+    bb_coord_new->ymin = ymin;
+    bb_coord_new->xmax = xmax;
+    bb_coord_new->ymax = ymax;
 }
 
 static void update_bb(ClusterNetId net_id, t_bb* bb_coord_new, t_bb* bb_edge_new, int xold, int yold, int xnew, int ynew) {
@@ -2260,14 +2724,12 @@ static void alloc_legal_placements() {
     num_legal_pos = (int*)vtr::calloc(device_ctx.physical_tile_types.size(), sizeof(int));
 
     /* Initialize all occupancy to zero. */
+    place_ctx.grid_blocks.clear_occupancy();
 
     for (size_t i = 0; i < device_ctx.grid.width(); i++) {
         for (size_t j = 0; j < device_ctx.grid.height(); j++) {
-            place_ctx.grid_blocks[i][j].usage = 0;
-
             for (int k = 0; k < device_ctx.grid[i][j].type->capacity; k++) {
-                if (place_ctx.grid_blocks[i][j].blocks[k] != INVALID_BLOCK_ID) {
-                    place_ctx.grid_blocks[i][j].blocks[k] = EMPTY_BLOCK_ID;
+                if (place_ctx.grid_blocks.block_at_location(i, j, k) != INVALID_BLOCK_ID) {
                     if (device_ctx.grid[i][j].width_offset == 0 && device_ctx.grid[i][j].height_offset == 0) {
                         num_legal_pos[device_ctx.grid[i][j].type->index]++;
                     }
@@ -2290,7 +2752,7 @@ static void load_legal_placements() {
     for (size_t i = 0; i < device_ctx.grid.width(); i++) {
         for (size_t j = 0; j < device_ctx.grid.height(); j++) {
             for (int k = 0; k < device_ctx.grid[i][j].type->capacity; k++) {
-                if (place_ctx.grid_blocks[i][j].blocks[k] == INVALID_BLOCK_ID) {
+                if (place_ctx.grid_blocks.block_at_location(i, j, k) == INVALID_BLOCK_ID) {
                     continue;
                 }
                 if (device_ctx.grid[i][j].width_offset == 0 && device_ctx.grid[i][j].height_offset == 0) {
@@ -2335,7 +2797,7 @@ static int check_macro_can_be_placed(int imacro, int itype, t_pl_loc head_pos) {
         // still within the chip's dimemsion and the member_z is allowed at that location on the grid
         if (member_pos.x < int(device_ctx.grid.width()) && member_pos.y < int(device_ctx.grid.height())
             && device_ctx.grid[member_pos.x][member_pos.y].type->index == itype
-            && place_ctx.grid_blocks[member_pos.x][member_pos.y].blocks[member_pos.z] == EMPTY_BLOCK_ID) {
+            && place_ctx.grid_blocks.block_at_location(member_pos) == EMPTY_BLOCK_ID) {
             // Can still accommodate blocks here, check the next position
             continue;
         } else {
@@ -2357,7 +2819,7 @@ static int try_place_macro(int itype, int ipos, int imacro) {
     t_pl_loc head_pos = legal_pos[itype][ipos];
 
     // If that location is occupied, do nothing.
-    if (place_ctx.grid_blocks[head_pos.x][head_pos.y].blocks[head_pos.z] != EMPTY_BLOCK_ID) {
+    if (place_ctx.grid_blocks.block_at_location(head_pos) != EMPTY_BLOCK_ID) {
         return (macro_placed);
     }
 
@@ -2374,8 +2836,7 @@ static int try_place_macro(int itype, int ipos, int imacro) {
             ClusterBlockId iblk = pl_macros[imacro].members[imember].blk_index;
             place_ctx.block_locs[iblk].loc = member_pos;
 
-            place_ctx.grid_blocks[member_pos.x][member_pos.y].blocks[member_pos.z] = pl_macros[imacro].members[imember].blk_index;
-            place_ctx.grid_blocks[member_pos.x][member_pos.y].usage++;
+            place_ctx.grid_blocks.set_block_at_location(member_pos, pl_macros[imacro].members[imember].blk_index);
 
             // Could not ensure that the randomiser would not pick this location again
             // So, would have to do a lazy removal - whenever I come across a block that could not be placed,
@@ -2388,6 +2849,106 @@ static int try_place_macro(int itype, int ipos, int imacro) {
     return (macro_placed);
 }
 
+/* Returns true if blk_id can legally be placed at loc and the slot is free */
+static bool warm_start_loc_is_legal(ClusterBlockId blk_id, const t_pl_loc& loc) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    if (loc.x < 0 || loc.x >= int(device_ctx.grid.width())) return false;
+    if (loc.y < 0 || loc.y >= int(device_ctx.grid.height())) return false;
+
+    auto type = device_ctx.grid[loc.x][loc.y].type;
+    if (type != physical_tile_type(blk_id)) return false;
+    if (device_ctx.grid[loc.x][loc.y].width_offset != 0) return false;
+    if (device_ctx.grid[loc.x][loc.y].height_offset != 0) return false;
+
+    if (loc.z < 0 || loc.z >= type->capacity) return false;
+    if (place_ctx.grid_blocks.block_at_location(loc) != EMPTY_BLOCK_ID) return false;
+
+    return true;
+}
+
+/* Warm starts (ECO) the initial placement from a prior run's .place file.
+ * Surviving blocks are matched by name and restored to their saved locations
+ * where those are still legal; new blocks, and blocks whose saved locations
+ * are no longer valid (out of bounds, wrong type, or claimed by another
+ * block), are left unplaced for the random initial placement to handle.
+ * Macro (e.g. carry chain) members are only restored if the entire macro's
+ * saved locations are mutually consistent. */
+static void initial_placement_warm_start(const char* place_file, enum e_pad_loc_type pad_loc_type) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    VTR_LOG("Warm starting placement from '%s'\n", place_file);
+
+    std::unordered_map<std::string, t_pl_loc> saved_locs = read_place_locations(place_file, device_ctx.grid);
+
+    //Returns true (filling *loc) if blk_id has a saved location
+    auto saved_loc = [&](ClusterBlockId blk_id, t_pl_loc* loc) -> bool {
+        auto itr = saved_locs.find(cluster_ctx.clb_nlist.block_name(blk_id));
+        if (itr == saved_locs.end()) return false;
+        *loc = itr->second;
+        return true;
+    };
+
+    auto place_block = [&](ClusterBlockId blk_id, const t_pl_loc& loc) {
+        place_ctx.grid_blocks.set_block_at_location(loc, blk_id);
+        place_ctx.block_locs[blk_id].loc = loc;
+    };
+
+    size_t num_restored = 0;
+
+    /* Restore macros first: all members must have saved locations consistent
+     * with the macro's offsets, and each must be individually legal */
+    for (const auto& macro : place_ctx.pl_macros) {
+        t_pl_loc head_loc;
+        if (!saved_loc(macro.members[0].blk_index, &head_loc)) continue;
+
+        bool restorable = true;
+        for (const auto& member : macro.members) {
+            t_pl_loc member_loc;
+            t_pl_loc expected_loc = head_loc + member.offset;
+            if (!saved_loc(member.blk_index, &member_loc)
+                || member_loc != expected_loc
+                || !warm_start_loc_is_legal(member.blk_index, expected_loc)) {
+                restorable = false;
+                break;
+            }
+        }
+        if (!restorable) continue;
+
+        for (const auto& member : macro.members) {
+            place_block(member.blk_index, head_loc + member.offset);
+            ++num_restored;
+        }
+    }
+
+    /* Restore the remaining (non-macro) blocks */
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        if (place_ctx.block_locs[blk_id].loc.x != OPEN) continue; //Restored above
+
+        int imacro;
+        get_imacro_from_iblk(&imacro, blk_id, place_ctx.pl_macros);
+        if (imacro != OPEN) continue; //Member of an unrestorable macro
+
+        if (is_io_type(physical_tile_type(blk_id)) && pad_loc_type == USER) {
+            continue; //IO locations come from the user pad location file
+        }
+
+        t_pl_loc loc;
+        if (!saved_loc(blk_id, &loc)) continue; //New block
+
+        if (!warm_start_loc_is_legal(blk_id, loc)) continue; //Displaced block
+
+        place_block(blk_id, loc);
+        ++num_restored;
+    }
+
+    VTR_LOG("Warm start restored %zu of %zu block locations; the remainder will be placed anew\n",
+            num_restored, cluster_ctx.clb_nlist.blocks().size());
+}
+
 static void initial_placement_pl_macros(int macros_max_num_tries, int* free_locations) {
     int macro_placed;
     int itype, itry, ipos;
@@ -2406,6 +2967,12 @@ static void initial_placement_pl_macros(int macros_max_num_tries, int* free_loca
 
         // Assume that all the blocks in the macro are of the same type
         blk_id = pl_macros[imacro].members[0].blk_index;
+
+        if (place_ctx.block_locs[blk_id].loc.x != OPEN) {
+            // Already placed (e.g. restored by a warm start)
+            continue;
+        }
+
         auto type = physical_tile_type(blk_id);
         itype = type->index;
         if (free_locations[itype] < int(pl_macros[imacro].members.size())) {
@@ -2458,13 +3025,22 @@ static void initial_placement_pl_macros(int macros_max_num_tries, int* free_loca
 }
 
 /* Place blocks that are NOT a part of any macro.
- * We'll randomly place each block in the clustered netlist, one by one. */
+ * We'll randomly place each block in the clustered netlist, one by one.
+ *
+ * Blocks of different types draw from disjoint location pools
+ * (legal_pos[itype]) and occupy disjoint grid cells, so each type is an
+ * independent placement task; on large designs the types are placed
+ * concurrently. Each type consumes its own random stream, seeded
+ * serially from the global generator, so the resulting placement is
+ * identical for any number of workers (including the serial path). */
 static void initial_placement_blocks(int* free_locations, enum e_pad_loc_type pad_loc_type) {
-    int itype, ipos;
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     auto& device_ctx = g_vpr_ctx.device();
 
+    //Group the unplaced blocks by type (netlist order within each type)
+    std::vector<std::vector<ClusterBlockId>> blocks_by_type(device_ctx.physical_tile_types.size());
+    size_t num_blocks_to_place = 0;
     for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
         if (place_ctx.block_locs[blk_id].loc.x != -1) { // -1 is a sentinel for an empty block
             // block placed.
@@ -2472,14 +3048,31 @@ static void initial_placement_blocks(int* free_locations, enum e_pad_loc_type pa
         }
 
         /* Don't do IOs if the user specifies IOs; we'll read those locations later. */
-        if (!(is_io_type(physical_tile_type(blk_id)) && pad_loc_type == USER)) {
+        if (is_io_type(physical_tile_type(blk_id)) && pad_loc_type == USER) {
+            continue;
+        }
+
+        blocks_by_type[cluster_ctx.clb_nlist.block_type(blk_id)->index].push_back(blk_id);
+        ++num_blocks_to_place;
+    }
+
+    //Draw each type's random seed serially so the placement does not
+    //depend on how the types are scheduled across workers
+    std::vector<vtr::RandState> type_rand_states(blocks_by_type.size());
+    for (size_t itype = 0; itype < blocks_by_type.size(); ++itype) {
+        type_rand_states[itype] = vtr::irand(std::numeric_limits<int>::max());
+    }
+
+    auto place_blocks_of_type = [&](int itype) {
+        vtr::RandState& rand_state = type_rand_states[itype];
+
+        for (ClusterBlockId blk_id : blocks_by_type[itype]) {
             /* Randomly select a free location of the appropriate type for blk_id.
              * We have a linearized list of all the free locations that can
              * accommodate a block of that type in free_locations[itype].
              * Choose one randomly and put blk_id there. Then we don't want to pick
              * that location again, so remove it from the free_locations array.
              */
-            itype = cluster_ctx.clb_nlist.block_type(blk_id)->index;
             if (free_locations[itype] <= 0) {
                 VPR_FATAL_ERROR(VPR_ERROR_PLACE,
                                 "Initial placement failed.\n"
@@ -2487,14 +3080,14 @@ static void initial_placement_blocks(int* free_locations, enum e_pad_loc_type pa
                                 cluster_ctx.clb_nlist.block_name(blk_id).c_str(), size_t(blk_id), device_ctx.physical_tile_types[itype].name, itype);
             }
 
+            int ipos;
             t_pl_loc to;
-            initial_placement_location(free_locations, blk_id, ipos, to);
+            initial_placement_location(free_locations, blk_id, ipos, to, rand_state);
 
             // Make sure that the position is EMPTY_BLOCK before placing the block down
-            VTR_ASSERT(place_ctx.grid_blocks[to.x][to.y].blocks[to.z] == EMPTY_BLOCK_ID);
+            VTR_ASSERT(place_ctx.grid_blocks.block_at_location(to) == EMPTY_BLOCK_ID);
 
-            place_ctx.grid_blocks[to.x][to.y].blocks[to.z] = blk_id;
-            place_ctx.grid_blocks[to.x][to.y].usage++;
+            place_ctx.grid_blocks.set_block_at_location(to, blk_id);
 
             place_ctx.block_locs[blk_id].loc = to;
 
@@ -2510,20 +3103,64 @@ static void initial_placement_blocks(int* free_locations, enum e_pad_loc_type pa
             legal_pos[itype][ipos] = legal_pos[itype][free_locations[itype] - 1]; /* overwrite used block position */
             free_locations[itype]--;
         }
+    };
+
+    std::vector<int> types_to_place;
+    for (size_t itype = 0; itype < blocks_by_type.size(); ++itype) {
+        if (!blocks_by_type[itype].empty()) {
+            types_to_place.push_back(itype);
+        }
+    }
+
+    size_t num_workers = 1;
+    if (std::thread::hardware_concurrency() > 1 && num_blocks_to_place >= MIN_BLOCKS_FOR_PARALLEL_INIT_PLACE) {
+        num_workers = std::min<size_t>(std::thread::hardware_concurrency(), types_to_place.size());
+    }
+
+    if (num_workers <= 1) {
+        for (int itype : types_to_place) {
+            place_blocks_of_type(itype);
+        }
+    } else {
+        /* One worker per type with blocks to place. The placement failure
+         * errors throw, so workers capture the exception for re-throw on
+         * the calling thread after all workers have joined. */
+        std::vector<std::exception_ptr> worker_errors(types_to_place.size());
+
+        std::vector<std::thread> workers;
+        workers.reserve(types_to_place.size());
+        for (size_t iworker = 0; iworker < types_to_place.size(); ++iworker) {
+            workers.emplace_back([&, iworker]() {
+                try {
+                    place_blocks_of_type(types_to_place[iworker]);
+                } catch (...) {
+                    worker_errors[iworker] = std::current_exception();
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        for (const std::exception_ptr& error : worker_errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
     }
 }
 
-static void initial_placement_location(const int* free_locations, ClusterBlockId blk_id, int& ipos, t_pl_loc& to) {
+static void initial_placement_location(const int* free_locations, ClusterBlockId blk_id, int& ipos, t_pl_loc& to, vtr::RandState& rand_state) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     int itype = cluster_ctx.clb_nlist.block_type(blk_id)->index;
 
-    ipos = vtr::irand(free_locations[itype] - 1);
+    ipos = vtr::irand(free_locations[itype] - 1, rand_state);
     to = legal_pos[itype][ipos];
 }
 
 static void initial_placement(enum e_pad_loc_type pad_loc_type,
-                              const char* pad_loc_file) {
+                              const char* pad_loc_file,
+                              const char* read_initial_place_file) {
     /* Randomly places the blocks to create an initial placement. We rely on
      * the legal_pos array already being loaded.  That legal_pos[itype] is an
      * array that gives every legal value of (x,y,z) that can accommodate a block.
@@ -2548,23 +3185,21 @@ static void initial_placement(enum e_pad_loc_type pad_loc_type,
     /* We'll use the grid to record where everything goes. Initialize to the grid has no
      * blocks placed anywhere.
      */
-    for (size_t i = 0; i < device_ctx.grid.width(); i++) {
-        for (size_t j = 0; j < device_ctx.grid.height(); j++) {
-            place_ctx.grid_blocks[i][j].usage = 0;
-            itype = device_ctx.grid[i][j].type->index;
-            for (int k = 0; k < device_ctx.physical_tile_types[itype].capacity; k++) {
-                if (place_ctx.grid_blocks[i][j].blocks[k] != INVALID_BLOCK_ID) {
-                    place_ctx.grid_blocks[i][j].blocks[k] = EMPTY_BLOCK_ID;
-                }
-            }
-        }
-    }
+    place_ctx.grid_blocks.clear_occupancy();
 
     /* Similarly, mark all blocks as not being placed yet. */
     for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
         place_ctx.block_locs[blk_id].loc = t_pl_loc();
     }
 
+    if (read_initial_place_file && *read_initial_place_file) {
+        /* Warm start (ECO): restore surviving blocks to their prior locations.
+         * Blocks placed here are skipped by the random placement below, and the
+         * legal_pos clean-up pass after macro placement removes their locations
+         * from the free lists. */
+        initial_placement_warm_start(read_initial_place_file, pad_loc_type);
+    }
+
     initial_placement_pl_macros(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, free_locations);
 
     // All the macros are placed, update the legal_pos[][] array
@@ -2575,7 +3210,7 @@ static void initial_placement(enum e_pad_loc_type pad_loc_type,
             t_pl_loc pos = legal_pos[itype][ipos];
 
             // Check if that location is occupied.  If it is, remove from legal_pos
-            if (place_ctx.grid_blocks[pos.x][pos.y].blocks[pos.z] != EMPTY_BLOCK_ID && place_ctx.grid_blocks[pos.x][pos.y].blocks[pos.z] != INVALID_BLOCK_ID) {
+            if (place_ctx.grid_blocks.block_at_location(pos) != EMPTY_BLOCK_ID && place_ctx.grid_blocks.block_at_location(pos) != INVALID_BLOCK_ID) {
                 legal_pos[itype][ipos] = legal_pos[itype][free_locations[itype] - 1];
                 free_locations[itype]--;
 
@@ -2708,8 +3343,32 @@ static void check_place(const t_placer_costs& costs,
 
     int error = 0;
 
-    error += check_placement_consistency();
-    error += check_placement_costs(costs, delay_model, place_algorithm);
+    /* The consistency walk (grid/block lookups) and the cost recomputation
+     * (net bounding boxes and timing) read disjoint placement state, so they
+     * run concurrently when a second hardware thread is available. Error
+     * messages from the two checks may interleave, but the totals are exact. */
+    if (std::thread::hardware_concurrency() > 1) {
+        int consistency_error = 0;
+        std::exception_ptr worker_error;
+        std::thread consistency_checker([&]() {
+            try {
+                consistency_error = check_placement_consistency();
+            } catch (...) {
+                worker_error = std::current_exception();
+            }
+        });
+
+        error += check_placement_costs(costs, delay_model, place_algorithm);
+
+        consistency_checker.join();
+        if (worker_error) {
+            std::rethrow_exception(worker_error);
+        }
+        error += consistency_error;
+    } else {
+        error += check_placement_consistency();
+        error += check_placement_costs(costs, delay_model, place_algorithm);
+    }
 
     if (error == 0) {
         VTR_LOG("\n");
@@ -2765,14 +3424,14 @@ static int check_block_placement_consistency() {
     /* Step through device grid and placement. Check it against blocks */
     for (size_t i = 0; i < device_ctx.grid.width(); i++)
         for (size_t j = 0; j < device_ctx.grid.height(); j++) {
-            if (place_ctx.grid_blocks[i][j].usage > device_ctx.grid[i][j].type->capacity) {
+            if (place_ctx.grid_blocks.usage(i, j) > device_ctx.grid[i][j].type->capacity) {
                 VTR_LOG_ERROR("Block at grid location (%zu,%zu) overused. Usage is %d.\n",
-                              i, j, place_ctx.grid_blocks[i][j].usage);
+                              i, j, place_ctx.grid_blocks.usage(i, j));
                 error++;
             }
             int usage_check = 0;
             for (int k = 0; k < device_ctx.grid[i][j].type->capacity; k++) {
-                auto bnum = place_ctx.grid_blocks[i][j].blocks[k];
+                auto bnum = place_ctx.grid_blocks.block_at_location(i, j, k);
                 if (EMPTY_BLOCK_ID == bnum || INVALID_BLOCK_ID == bnum)
                     continue;
 
@@ -2790,9 +3449,9 @@ static int check_block_placement_consistency() {
                 ++usage_check;
                 bdone[bnum]++;
             }
-            if (usage_check != place_ctx.grid_blocks[i][j].usage) {
+            if (usage_check != place_ctx.grid_blocks.usage(i, j)) {
                 VTR_LOG_ERROR("Location (%zu,%zu) usage is %d, but has actual usage %d.\n",
-                              i, j, place_ctx.grid_blocks[i][j].usage, usage_check);
+                              i, j, place_ctx.grid_blocks.usage(i, j), usage_check);
                 error++;
             }
         }
@@ -2832,7 +3491,7 @@ int check_macro_placement_consistency() {
             }
 
             // Then check the place_ctx.grid data structure
-            if (place_ctx.grid_blocks[member_pos.x][member_pos.y].blocks[member_pos.z] != member_iblk) {
+            if (place_ctx.grid_blocks.block_at_location(member_pos) != member_iblk) {
                 VTR_LOG_ERROR("Block %zu in pl_macro #%zu is not placed in the proper orientation.\n",
                               size_t(member_iblk), imacro);
                 error++;
@@ -2938,3 +3597,92 @@ static void print_place_status(const float t,
     VTR_LOG(" %6.3f\n", t / oldt);
     fflush(stdout);
 }
+
+//Accumulates one move's outcome into the per-temperature telemetry
+static void record_move_telemetry(const t_pl_blocks_to_be_moved& blocks_affected, e_move_result outcome, double delta_c) {
+    t_temperature_telemetry& telemetry = f_temperature_telemetry;
+
+    if (outcome == ABORTED) {
+        telemetry.aborted++;
+        return;
+    }
+
+    //Delta cost histogram (log10 magnitude bins, split by sign)
+    double magnitude = std::fabs(delta_c);
+    int cost_bin = 0;
+    if (magnitude > 0.) {
+        cost_bin = int(std::floor(std::log10(magnitude))) + t_temperature_telemetry::DELTA_COST_BIN_OFFSET;
+        cost_bin = std::max(0, std::min(t_temperature_telemetry::NUM_DELTA_COST_BINS - 1, cost_bin));
+    }
+    if (delta_c < 0.) {
+        telemetry.delta_cost_down[cost_bin]++;
+    } else {
+        telemetry.delta_cost_up[cost_bin]++;
+    }
+
+    //Acceptance by move distance, keyed on the primary (first) moved block
+    VTR_ASSERT_SAFE(blocks_affected.num_moved_blocks > 0);
+    const auto& moved = blocks_affected.moved_blocks[0];
+    int distance = std::abs(moved.new_loc.x - moved.old_loc.x) + std::abs(moved.new_loc.y - moved.old_loc.y);
+    int dist_bin = 0;
+    while ((1 << dist_bin) < distance && dist_bin < t_temperature_telemetry::NUM_DISTANCE_BINS - 1) {
+        ++dist_bin;
+    }
+    telemetry.proposed_by_distance[dist_bin]++;
+
+    if (outcome == ACCEPTED) {
+        telemetry.accepted++;
+        telemetry.accepted_by_distance[dist_bin]++;
+    } else {
+        telemetry.rejected++;
+    }
+}
+
+//Writes the completed temperature's statistics as one JSON line and
+//clears the telemetry accumulators for the next temperature
+static void print_temperature_stats(int num_temps,
+                                    double temperature,
+                                    float rlim,
+                                    float crit_exponent,
+                                    float success_rat,
+                                    double std_dev,
+                                    const t_placer_costs& costs,
+                                    const t_placer_statistics& stats,
+                                    int move_lim) {
+    if (!f_temperature_stats_file) return;
+
+    t_temperature_telemetry& telemetry = f_temperature_telemetry;
+    FILE* fp = f_temperature_stats_file.get();
+
+    auto print_int_array = [&](const char* name, const int* values, int num_values) {
+        fprintf(fp, ", \"%s\": [", name);
+        for (int i = 0; i < num_values; ++i) {
+            fprintf(fp, "%s%d", (i == 0) ? "" : ", ", values[i]);
+        }
+        fprintf(fp, "]");
+    };
+
+    fprintf(fp, "{\"temperature_num\": %d, \"temperature\": %g, \"rlim\": %g, \"crit_exponent\": %g",
+            num_temps, temperature, rlim, crit_exponent);
+    fprintf(fp, ", \"moves\": %d, \"success_rate\": %g, \"std_dev\": %g",
+            move_lim, success_rat, std_dev);
+    fprintf(fp, ", \"cost\": %g, \"bb_cost\": %g, \"timing_cost\": %g",
+            costs.cost, costs.bb_cost, costs.timing_cost);
+    fprintf(fp, ", \"av_cost\": %g, \"av_bb_cost\": %g, \"av_timing_cost\": %g",
+            stats.av_cost, stats.av_bb_cost, stats.av_timing_cost);
+    fprintf(fp, ", \"accepted\": %d, \"rejected\": %d, \"aborted\": %d",
+            telemetry.accepted, telemetry.rejected, telemetry.aborted);
+
+    fprintf(fp, ", \"delta_cost_bin_min_exp\": %d", -t_temperature_telemetry::DELTA_COST_BIN_OFFSET);
+    print_int_array("delta_cost_down", telemetry.delta_cost_down, t_temperature_telemetry::NUM_DELTA_COST_BINS);
+    print_int_array("delta_cost_up", telemetry.delta_cost_up, t_temperature_telemetry::NUM_DELTA_COST_BINS);
+
+    print_int_array("proposed_by_distance", telemetry.proposed_by_distance, t_temperature_telemetry::NUM_DISTANCE_BINS);
+    print_int_array("accepted_by_distance", telemetry.accepted_by_distance, t_temperature_telemetry::NUM_DISTANCE_BINS);
+
+    fprintf(fp, ", \"recompute_criticalities_sec\": %g, \"inner_loop_sec\": %g}\n",
+            telemetry.recompute_criticalities_sec, telemetry.inner_loop_sec);
+    fflush(fp);
+
+    telemetry.clear();
+}
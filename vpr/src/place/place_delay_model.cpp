@@ -8,6 +8,7 @@
 
 #include "vtr_log.h"
 #include "vtr_math.h"
+#include "vtr_hash.h"
 #include "vpr_error.h"
 
 #ifdef VTR_ENABLE_CAPNPROTO
@@ -22,13 +23,32 @@
  * DeltaDelayModel
  */
 
+constexpr size_t DeltaDelayModel::HOT_TILE_DIM;
+
 float DeltaDelayModel::delay(int from_x, int from_y, int /*from_pin*/, int to_x, int to_y, int /*to_pin*/) const {
-    int delta_x = std::abs(from_x - to_x);
-    int delta_y = std::abs(from_y - to_y);
+    size_t delta_x = std::abs(from_x - to_x);
+    size_t delta_y = std::abs(from_y - to_y);
+
+    //Common case: swap-limited moves keep most queries at small deltas,
+    //which are served from the packed L1-resident tile
+    if (delta_x < hot_dim_ && delta_y < hot_dim_) {
+        return hot_tile_[delta_x * hot_dim_ + delta_y];
+    }
 
     return delays_[delta_x][delta_y];
 }
 
+void DeltaDelayModel::pack_hot_tile() {
+    hot_dim_ = std::min(HOT_TILE_DIM, std::min(delays_.dim_size(0), delays_.dim_size(1)));
+
+    hot_tile_.resize(hot_dim_ * hot_dim_);
+    for (size_t dx = 0; dx < hot_dim_; ++dx) {
+        for (size_t dy = 0; dy < hot_dim_; ++dy) {
+            hot_tile_[dx * hot_dim_ + dy] = delays_[dx][dy];
+        }
+    }
+}
+
 void DeltaDelayModel::dump_echo(std::string filepath) const {
     FILE* f = vtr::fopen(filepath.c_str(), "w");
     fprintf(f, "         ");
@@ -55,6 +75,13 @@ float OverrideDelayModel::delay(int from_x, int from_y, int from_pin, int to_x,
     auto& grid = device_ctx.grid;
 
     t_physical_tile_type_ptr from_type_ptr = grid[from_x][from_y].type;
+
+    //Common case: no override exists from this tile type, so the base delay
+    //model answers without even building the override key
+    if (!from_type_has_override(from_type_ptr->index)) {
+        return base_delay_model_->delay(from_x, from_y, from_pin, to_x, to_y, to_pin);
+    }
+
     t_physical_tile_type_ptr to_type_ptr = grid[to_x][to_y].type;
 
     t_override override_key;
@@ -69,11 +96,7 @@ float OverrideDelayModel::delay(int from_x, int from_y, int from_pin, int to_x,
     override_key.delta_y = to_y - from_y;
 
     float delay_val = std::numeric_limits<float>::quiet_NaN();
-    auto override_iter = delay_overrides_.find(override_key);
-    if (override_iter != delay_overrides_.end()) {
-        //Found an override
-        delay_val = override_iter->second;
-    } else {
+    if (!find_delay_override(override_key, &delay_val)) {
         //Fall back to the base delay model if no override was found
         delay_val = base_delay_model_->delay(from_x, from_y, from_pin, to_x, to_y, to_pin);
     }
@@ -81,6 +104,72 @@ float OverrideDelayModel::delay(int from_x, int from_y, int from_pin, int to_x,
     return delay_val;
 }
 
+/* Rebuilds the compiled override lookup (hash table + from-type bitmask)
+ * from the authoritative delay_overrides_ map. The table is kept at most
+ * half full so a query is expected to probe a single slot. */
+void OverrideDelayModel::compile_delay_overrides() {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    override_from_type_mask_.assign((device_ctx.physical_tile_types.size() + 63) / 64, 0);
+    override_table_.clear();
+    override_slot_used_.clear();
+    override_table_mask_ = 0;
+
+    if (delay_overrides_.empty()) {
+        return;
+    }
+
+    size_t table_size = 1;
+    while (table_size < 2 * delay_overrides_.size()) {
+        table_size <<= 1;
+    }
+
+    override_table_.resize(table_size);
+    override_slot_used_.assign(table_size, false);
+    override_table_mask_ = table_size - 1;
+
+    for (const auto& kv : delay_overrides_) {
+        const t_override& key = kv.first;
+
+        override_from_type_mask_[key.from_type / 64] |= uint64_t(1) << (key.from_type % 64);
+
+        size_t islot = hash_override(key) & override_table_mask_;
+        while (override_slot_used_[islot]) { //Linear probing (keys are unique)
+            islot = (islot + 1) & override_table_mask_;
+        }
+        override_table_[islot].key = key;
+        override_table_[islot].delay = kv.second;
+        override_slot_used_[islot] = true;
+    }
+}
+
+bool OverrideDelayModel::find_delay_override(const t_override& key, float* delay_val) const {
+    if (override_table_.empty()) {
+        return false;
+    }
+
+    size_t islot = hash_override(key) & override_table_mask_;
+    while (override_slot_used_[islot]) {
+        if (override_table_[islot].key == key) {
+            *delay_val = override_table_[islot].delay;
+            return true;
+        }
+        islot = (islot + 1) & override_table_mask_;
+    }
+    return false;
+}
+
+size_t OverrideDelayModel::hash_override(const t_override& key) {
+    std::size_t seed = 0;
+    vtr::hash_combine(seed, key.from_type);
+    vtr::hash_combine(seed, key.to_type);
+    vtr::hash_combine(seed, key.from_class);
+    vtr::hash_combine(seed, key.to_class);
+    vtr::hash_combine(seed, key.delta_x);
+    vtr::hash_combine(seed, key.delta_y);
+    return seed;
+}
+
 void OverrideDelayModel::set_delay_override(int from_type, int from_class, int to_type, int to_class, int delta_x, int delta_y, float delay_val) {
     t_override override_key;
     override_key.from_type = from_type;
@@ -94,6 +183,8 @@ void OverrideDelayModel::set_delay_override(int from_type, int from_class, int t
     if (!res.second) {                 //Key already exists
         res.first->second = delay_val; //Overwrite existing delay
     }
+
+    compile_delay_overrides();
 }
 
 void OverrideDelayModel::dump_echo(std::string filepath) const {
@@ -216,6 +307,8 @@ void DeltaDelayModel::read(const std::string& file) {
     // The second argument should be of type Matrix<X>::Reader where X is the
     // capnproto element type.
     ToNdMatrix<2, VprFloatEntry, float>(&delays_, model.getDelays(), ToFloat);
+
+    pack_hot_tile();
 }
 
 void DeltaDelayModel::write(const std::string& file) const {
@@ -264,6 +357,7 @@ void OverrideDelayModel::read(const std::string& file) {
     }
 
     delay_overrides_ = vtr::make_flat_map2(std::move(overrides_arr));
+    compile_delay_overrides();
 }
 
 void OverrideDelayModel::write(const std::string& file) const {
@@ -42,7 +42,9 @@ class DeltaDelayModel : public PlaceDelayModel {
   public:
     DeltaDelayModel() {}
     DeltaDelayModel(vtr::Matrix<float> delta_delays)
-        : delays_(std::move(delta_delays)) {}
+        : delays_(std::move(delta_delays)) {
+        pack_hot_tile();
+    }
 
     void compute(
         const RouterDelayProfiler& router,
@@ -59,7 +61,22 @@ class DeltaDelayModel : public PlaceDelayModel {
     }
 
   private:
+    //Re-packs the small-delta corner of delays_ into hot_tile_.
+    //Must be called whenever delays_ is (re)loaded.
+    void pack_hot_tile();
+
     vtr::Matrix<float> delays_;
+
+    /* Densely packed copy of delays_[0..hot_dim_)[0..hot_dim_), rebuilt by
+     * pack_hot_tile(). Swap-limited placer moves concentrate delay queries at
+     * small (delta_x, delta_y), but in the full matrix consecutive delta_x
+     * rows are a whole device-height apart, so those queries scatter across
+     * many cache lines. The packed tile (at most HOT_TILE_DIM^2 floats, a few
+     * KB) keeps the common lookups resident in L1; larger deltas fall through
+     * to the full matrix. */
+    static constexpr size_t HOT_TILE_DIM = 32;
+    std::vector<float> hot_tile_;
+    size_t hot_dim_ = 0;
 };
 
 class OverrideDelayModel : public PlaceDelayModel {
@@ -99,9 +116,37 @@ class OverrideDelayModel : public PlaceDelayModel {
             return std::tie(lhs.from_type, lhs.to_type, lhs.from_class, lhs.to_class, lhs.delta_x, lhs.delta_y)
                    < std::tie(rhs.from_type, rhs.to_type, rhs.from_class, rhs.to_class, rhs.delta_x, rhs.delta_y);
         }
+
+        friend bool operator==(const t_override& lhs, const t_override& rhs) {
+            return std::tie(lhs.from_type, lhs.to_type, lhs.from_class, lhs.to_class, lhs.delta_x, lhs.delta_y)
+                   == std::tie(rhs.from_type, rhs.to_type, rhs.from_class, rhs.to_class, rhs.delta_x, rhs.delta_y);
+        }
     };
 
     vtr::flat_map2<t_override, float> delay_overrides_;
+
+    /* Compiled form of delay_overrides_ for the hot delay() query (which sits
+     * inside the placer's inner loop): an open-addressed hash table probed at
+     * most a couple of times, guarded by a per-tile-type bitmask so the common
+     * no-override case is rejected without building a key at all. Rebuilt by
+     * compile_delay_overrides() whenever the overrides change. */
+    struct t_compiled_override {
+        t_override key;
+        float delay;
+    };
+    std::vector<uint64_t> override_from_type_mask_; //Bit set iff the tile type is the 'from' end of some override
+    std::vector<t_compiled_override> override_table_;
+    std::vector<char> override_slot_used_;
+    size_t override_table_mask_ = 0;
+
+    void compile_delay_overrides();
+    bool find_delay_override(const t_override& key, float* delay_val) const;
+    static size_t hash_override(const t_override& key);
+
+    bool from_type_has_override(int from_type) const {
+        if (override_from_type_mask_.empty()) return false;
+        return (override_from_type_mask_[from_type / 64] >> (from_type % 64)) & 1;
+    }
 };
 
 #endif
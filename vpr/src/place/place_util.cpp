@@ -1,7 +1,7 @@
 #include "place_util.h"
 #include "globals.h"
 
-static vtr::Matrix<t_grid_blocks> init_grid_blocks();
+static GridBlocks init_grid_blocks();
 
 void init_placement_context() {
     auto& place_ctx = g_vpr_ctx.mutable_placement();
@@ -13,19 +13,20 @@ void init_placement_context() {
     place_ctx.grid_blocks = init_grid_blocks();
 }
 
-static vtr::Matrix<t_grid_blocks> init_grid_blocks() {
+static GridBlocks init_grid_blocks() {
     auto& device_ctx = g_vpr_ctx.device();
 
-    auto grid_blocks = vtr::Matrix<t_grid_blocks>({device_ctx.grid.width(), device_ctx.grid.height()});
-    for (size_t x = 0; x < device_ctx.grid.width(); ++x) {
-        for (size_t y = 0; y < device_ctx.grid.height(); ++y) {
-            auto type = device_ctx.grid[x][y].type;
-
-            int capacity = type->capacity;
-
-            grid_blocks[x][y].blocks.resize(capacity, EMPTY_BLOCK_ID);
+    //Every tile gets the device-wide maximum capacity of slots, so the
+    //occupancy is stored as one flat array
+    size_t max_capacity = 0;
+    for (const auto& type : device_ctx.physical_tile_types) {
+        if (size_t(type.capacity) > max_capacity) {
+            max_capacity = size_t(type.capacity);
         }
     }
 
+    GridBlocks grid_blocks;
+    grid_blocks.init_grid(device_ctx.grid.width(), device_ctx.grid.height(), max_capacity);
+
     return grid_blocks;
 }
@@ -1,9 +1,11 @@
 #include <cstdio>
 #include <cmath>
+#include <algorithm>
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
 #include "vtr_log.h"
+#include "vtr_math.h"
 
 #include "vpr_types.h"
 #include "vpr_utils.h"
@@ -14,34 +16,38 @@
 
 #include "timing_info.h"
 
-vtr::vector<ClusterNetId, float*> f_timing_place_crit; /* [0..cluster_ctx.clb_nlist.nets().size()-1][1..num_pins-1] */
+/* Placement criticalities, one entry per clustered pin (driver entries are
+ * allocated but unused). A single flat array indexed by ClusterPinId lets the
+ * timing pass write entries in place from the pins it already holds, with no
+ * per-update (net, ipin) translation. */
+static vtr::vector<ClusterPinId, float> f_timing_place_crit;
 
-static vtr::t_chunk f_timing_place_crit_ch;
+/* The criticality exponent the current f_timing_place_crit values were
+ * computed with (NAN until the first load_criticalities() call) */
+static float f_loaded_crit_exponent = NAN;
+
+/* Sampled look-up table used to evaluate criticality^crit_exponent, since a
+ * libm pow call per pin per update is comparatively expensive */
+static vtr::PowTable f_crit_pow;
 
 /******** prototypes ******************/
-static void alloc_crit(vtr::t_chunk* chunk_list_ptr);
+static void alloc_crit();
 
-static void free_crit(vtr::t_chunk* chunk_list_ptr);
+static void free_crit();
 
 /**************************************/
 
-/* Allocates space for the f_timing_place_crit data structure *
- * I chunk the data to save space on large problems.           */
-static void alloc_crit(vtr::t_chunk* chunk_list_ptr) {
+/* Allocates space for the f_timing_place_crit data structure */
+static void alloc_crit() {
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    float* tmp_ptr;
-
-    f_timing_place_crit.resize(cluster_ctx.clb_nlist.nets().size());
 
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        tmp_ptr = (float*)vtr::chunk_malloc((cluster_ctx.clb_nlist.net_pins(net_id).size()) * sizeof(float), chunk_list_ptr);
-        f_timing_place_crit[net_id] = tmp_ptr;
-    }
+    f_timing_place_crit.resize(cluster_ctx.clb_nlist.pins().size());
 }
 
 /**************************************/
-static void free_crit(vtr::t_chunk* chunk_list_ptr) {
-    vtr::free_chunk_memory(chunk_list_ptr);
+static void free_crit() {
+    f_timing_place_crit.clear();
+    f_timing_place_crit.shrink_to_fit();
 }
 
 /**************************************/
@@ -51,29 +57,80 @@ void load_criticalities(SetupTimingInfo& timing_info, float crit_exponent, const
      * in that pin), f_timing_place_crit = criticality^(criticality exponent) */
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    f_crit_pow.set_exponent(crit_exponent);
+
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id))
             continue;
 
         for (auto clb_pin : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-            int ipin = cluster_ctx.clb_nlist.pin_net_index(clb_pin);
-
             float clb_pin_crit = calculate_clb_net_pin_criticality(timing_info, pin_lookup, clb_pin);
 
             /* The placer likes a great deal of contrast between criticalities.
              * Since path criticality varies much more than timing, we "sharpen" timing
              * criticality by taking it to some power, crit_exponent (between 1 and 8 by default). */
-            f_timing_place_crit[net_id][ipin] = pow(clb_pin_crit, crit_exponent);
+            f_timing_place_crit[clb_pin] = f_crit_pow(clb_pin_crit);
         }
     }
+
+    f_loaded_crit_exponent = crit_exponent;
+}
+
+/**************************************/
+bool update_criticalities(SetupTimingInfo& timing_info, float crit_exponent, const ClusteredPinAtomPinsLookup& pin_lookup, std::vector<ClusterPinId>& modified_sink_pins) {
+    modified_sink_pins.clear();
+
+    /* Since the loaded values are criticality^crit_exponent, a change to the
+     * exponent invalidates every entry regardless of which slacks changed */
+    if (std::isnan(f_loaded_crit_exponent) || crit_exponent != f_loaded_crit_exponent) {
+        load_criticalities(timing_info, crit_exponent, pin_lookup);
+        return false;
+    }
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    /* Only connections through an atom pin whose criticality changed during
+     * the last timing update can have a stale f_timing_place_crit entry */
+    for (AtomPinId atom_pin : timing_info.pins_with_modified_setup_criticality()) {
+        for (ClusterPinId clb_pin : pin_lookup.connected_clustered_pins(atom_pin)) {
+            if (cluster_ctx.clb_nlist.pin_type(clb_pin) == PinType::DRIVER)
+                continue;
+
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(clb_pin);
+            if (cluster_ctx.clb_nlist.net_is_ignored(net_id))
+                continue;
+
+            float clb_pin_crit = calculate_clb_net_pin_criticality(timing_info, pin_lookup, clb_pin);
+            f_timing_place_crit[clb_pin] = f_crit_pow(clb_pin_crit);
+
+            modified_sink_pins.push_back(clb_pin);
+        }
+    }
+
+    /* Several modified atom pins can feed the same clustered sink pin */
+    std::sort(modified_sink_pins.begin(), modified_sink_pins.end());
+    modified_sink_pins.erase(std::unique(modified_sink_pins.begin(), modified_sink_pins.end()), modified_sink_pins.end());
+
+    return true;
+}
+
+float get_timing_place_crit(ClusterPinId pin_id) {
+    return f_timing_place_crit[pin_id];
 }
 
 float get_timing_place_crit(ClusterNetId net_id, int ipin) {
-    return f_timing_place_crit[net_id][ipin];
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    return f_timing_place_crit[cluster_ctx.clb_nlist.net_pin(net_id, ipin)];
+}
+
+void set_timing_place_crit(ClusterPinId pin_id, float val) {
+    f_timing_place_crit[pin_id] = val;
 }
 
 void set_timing_place_crit(ClusterNetId net_id, int ipin, float val) {
-    f_timing_place_crit[net_id][ipin] = val;
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    f_timing_place_crit[cluster_ctx.clb_nlist.net_pin(net_id, ipin)] = val;
 }
 
 /**************************************/
@@ -84,7 +141,7 @@ std::unique_ptr<PlaceDelayModel> alloc_lookups_and_criticalities(t_chan_width_di
                                                                  std::vector<t_segment_inf>& segment_inf,
                                                                  const t_direct_inf* directs,
                                                                  const int num_directs) {
-    alloc_crit(&f_timing_place_crit_ch);
+    alloc_crit();
 
     return compute_place_delay_model(placer_opts, router_opts, det_routing_arch, segment_inf,
                                      chan_width_dist, directs, num_directs);
@@ -92,8 +149,7 @@ std::unique_ptr<PlaceDelayModel> alloc_lookups_and_criticalities(t_chan_width_di
 
 /**************************************/
 void free_lookups_and_criticalities() {
-    //TODO: May need to free f_timing_place_crit ?
-    free_crit(&f_timing_place_crit_ch);
+    free_crit();
 }
 
 /**************************************/
@@ -17,7 +17,23 @@ void free_lookups_and_criticalities();
 
 void load_criticalities(SetupTimingInfo& timing_info, float crit_exponent, const ClusteredPinAtomPinsLookup& pin_lookup);
 
+/* Incrementally refreshes the placement criticalities for only those sink pins
+ * whose underlying timing criticality changed during the last timing update,
+ * recording the refreshed pins in modified_sink_pins.
+ *
+ * Returns true if the update was applied incrementally; returns false if a
+ * full load_criticalities() reload was required instead (e.g. because
+ * crit_exponent changed, which dirties every connection), in which case
+ * modified_sink_pins is left empty. */
+bool update_criticalities(SetupTimingInfo& timing_info, float crit_exponent, const ClusteredPinAtomPinsLookup& pin_lookup, std::vector<ClusterPinId>& modified_sink_pins);
+
+/* Criticality accessors. The values are stored in a single flat array
+ * indexed by clustered pin id; the (net, ipin) overloads are provided for
+ * callers which only hold net pin indices and translate through
+ * ClusteredNetlist::net_pin(). */
+float get_timing_place_crit(ClusterPinId pin_id);
 float get_timing_place_crit(ClusterNetId net_id, int ipin);
+void set_timing_place_crit(ClusterPinId pin_id, float val);
 void set_timing_place_crit(ClusterNetId net_id, int ipin, float val);
 
 #endif
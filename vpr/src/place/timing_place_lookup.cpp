@@ -1,6 +1,8 @@
 #include <cstdio>
 #include <cstring>
 #include <cmath>
+#include <exception>
+#include <thread>
 #include <time.h>
 #include <limits>
 
@@ -77,6 +79,17 @@ static float route_connection_delay(
     const t_router_opts& router_opts,
     bool measure_directconnect);
 
+static bool search_connection_delay_path(
+    const RouterDelayProfiler& route_profiler,
+    int source_x_loc,
+    int source_y_loc,
+    int sink_x_loc,
+    int sink_y_loc,
+    const t_router_opts& router_opts,
+    bool measure_directconnect,
+    int* source_rr_node,
+    t_heap* sink_path);
+
 static void generic_compute_matrix(
     const RouterDelayProfiler& route_profiler,
     vtr::Matrix<std::vector<float>>& matrix,
@@ -187,6 +200,8 @@ void DeltaDelayModel::compute(
         route_profiler,
         placer_opts, router_opts, /*measure_directconnect=*/true,
         longest_length);
+
+    pack_hot_tile();
 }
 
 void OverrideDelayModel::compute(
@@ -340,6 +355,55 @@ static float route_connection_delay(
     return (net_delay_value);
 }
 
+/* Search-only counterpart of route_connection_delay(), used by the profiling
+ * worker threads: tries the same source/sink rr node candidates but only
+ * records the found path (see RouterDelayProfiler::search_delay_path()),
+ * leaving the walkback to be harvested serially after the workers join. */
+static bool search_connection_delay_path(
+    const RouterDelayProfiler& route_profiler,
+    int source_x,
+    int source_y,
+    int sink_x,
+    int sink_y,
+    const t_router_opts& router_opts,
+    bool measure_directconnect,
+    int* source_rr_node,
+    t_heap* sink_path,
+    uint32_t* search_epoch) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    auto best_driver_ptcs = get_best_classes(DRIVER, device_ctx.grid[source_x][source_y].type);
+    auto best_sink_ptcs = get_best_classes(RECEIVER, device_ctx.grid[sink_x][sink_y].type);
+
+    for (int driver_ptc : best_driver_ptcs) {
+        VTR_ASSERT(driver_ptc != OPEN);
+
+        int src_rr_node = get_rr_node_index(device_ctx.rr_node_indices, source_x, source_y, SOURCE, driver_ptc);
+
+        VTR_ASSERT(src_rr_node != OPEN);
+
+        for (int sink_ptc : best_sink_ptcs) {
+            VTR_ASSERT(sink_ptc != OPEN);
+
+            int sink_rr_node = get_rr_node_index(device_ctx.rr_node_indices, sink_x, sink_y, SINK, sink_ptc);
+
+            VTR_ASSERT(sink_rr_node != OPEN);
+
+            if (!measure_directconnect && directconnect_exists(src_rr_node, sink_rr_node)) {
+                //Skip if we shouldn't measure direct connects and a direct connect exists
+                continue;
+            }
+
+            if (route_profiler.search_delay_path(src_rr_node, sink_rr_node, router_opts, sink_path, search_epoch)) {
+                *source_rr_node = src_rr_node;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 static void generic_compute_matrix(
     const RouterDelayProfiler& route_profiler,
     vtr::Matrix<std::vector<float>>& matrix,
@@ -357,6 +421,113 @@ static void generic_compute_matrix(
 
     auto& device_ctx = g_vpr_ctx.device();
 
+    /* Collect the sink locations which actually require a route query (EMPTY
+     * and disallowed tiles are classified without routing). The queries are
+     * independent, so they are searched by a pool of worker threads; since
+     * each query's walkback must survive until it is harvested, workers take
+     * one query per round (a worker's next search would overwrite its own
+     * previous walkback).                                                    */
+    struct t_profile_query {
+        int sink_x;
+        int sink_y;
+        int source_rr_node = OPEN;
+        t_heap sink_path;
+        uint32_t search_epoch = 0; //Epoch stamping the recorded walkback's hops
+        char found = false;        //Not bool: written concurrently
+    };
+    std::vector<t_profile_query> queries;
+    for (sink_x = start_x; sink_x <= end_x; sink_x++) {
+        for (sink_y = start_y; sink_y <= end_y; sink_y++) {
+            t_physical_tile_type_ptr src_type = device_ctx.grid[source_x][source_y].type;
+            t_physical_tile_type_ptr sink_type = device_ctx.grid[sink_x][sink_y].type;
+
+            bool src_or_target_empty = (src_type == device_ctx.EMPTY_TYPE
+                                        || sink_type == device_ctx.EMPTY_TYPE);
+
+            bool is_allowed_type = allowed_types.empty() || allowed_types.find(src_type->name) != allowed_types.end();
+
+            if (!src_or_target_empty && is_allowed_type) {
+                t_profile_query query;
+                query.sink_x = sink_x;
+                query.sink_y = sink_y;
+                queries.push_back(query);
+            }
+        }
+    }
+
+    std::vector<float> query_delays(queries.size(), IMPOSSIBLE_DELTA);
+
+    size_t num_workers = std::max(router_opts.router_num_workers, 1);
+    if (num_workers <= 1 || queries.size() < 2) {
+        for (size_t iquery = 0; iquery < queries.size(); ++iquery) {
+            query_delays[iquery] = route_connection_delay(route_profiler,
+                                                          source_x, source_y,
+                                                          queries[iquery].sink_x, queries[iquery].sink_y,
+                                                          router_opts, measure_directconnect);
+        }
+    } else {
+        for (size_t round_start = 0; round_start < queries.size(); round_start += num_workers) {
+            size_t round_size = std::min(num_workers, queries.size() - round_start);
+
+            std::vector<std::exception_ptr> worker_errors(round_size);
+
+            auto search_query = [&](size_t iquery) {
+                try {
+                    //Worker's thread local routing structures
+                    alloc_route_tree_timing_structs(/*exists_ok=*/true);
+
+                    t_profile_query& query = queries[round_start + iquery];
+                    query.found = search_connection_delay_path(route_profiler,
+                                                               source_x, source_y,
+                                                               query.sink_x, query.sink_y,
+                                                               router_opts, measure_directconnect,
+                                                               &query.source_rr_node, &query.sink_path,
+                                                               &query.search_epoch);
+
+                    //Release the worker's thread local memory before it exits
+                    free_route_tree_timing_structs();
+                    free_heap_structs();
+                } catch (...) {
+                    worker_errors[iquery] = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(round_size);
+            for (size_t iquery = 0; iquery < round_size; ++iquery) {
+                workers.emplace_back(search_query, iquery);
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            for (const auto& error : worker_errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+
+            //Harvest the found paths serially
+            for (size_t iquery = 0; iquery < round_size; ++iquery) {
+                t_profile_query& query = queries[round_start + iquery];
+
+                float delay;
+                if (query.found && route_profiler.evaluate_delay_path(query.source_rr_node, query.sink_path, query.search_epoch, &delay)) {
+                    query_delays[round_start + iquery] = delay;
+                } else {
+                    //Either the concurrent search failed, or its recorded
+                    //walkback was clobbered by another worker of this round:
+                    //redo the query with the ordinary serial search
+                    query_delays[round_start + iquery] = route_connection_delay(route_profiler,
+                                                                                source_x, source_y,
+                                                                                query.sink_x, query.sink_y,
+                                                                                router_opts, measure_directconnect);
+                }
+            }
+        }
+    }
+
+    size_t iquery = 0;
     for (sink_x = start_x; sink_x <= end_x; sink_x++) {
         for (sink_y = start_y; sink_y <= end_y; sink_y++) {
             delta_x = abs(sink_x - source_x);
@@ -385,7 +556,8 @@ static void generic_compute_matrix(
             } else {
                 //Valid start/end
 
-                float delay = route_connection_delay(route_profiler, source_x, source_y, sink_x, sink_y, router_opts, measure_directconnect);
+                VTR_ASSERT(queries[iquery].sink_x == sink_x && queries[iquery].sink_y == sink_y);
+                float delay = query_delays[iquery++];
 
 #ifdef VERBOSE
                 VTR_LOG("Computed delay: %12g delta: %d,%d (src: %d,%d sink: %d,%d)\n",
@@ -404,6 +576,7 @@ static void generic_compute_matrix(
             }
         }
     }
+    VTR_ASSERT(iquery == queries.size());
 }
 
 static vtr::Matrix<float> compute_delta_delays(
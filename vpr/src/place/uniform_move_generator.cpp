@@ -1,9 +1,9 @@
 #include "uniform_move_generator.h"
 #include "globals.h"
 
-e_create_move UniformMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_affected, float rlim) {
+e_create_move UniformMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_affected, float rlim, vtr::RandState& rand_state) {
     /* Pick a random block to be swapped with another random block.   */
-    ClusterBlockId b_from = pick_from_block();
+    ClusterBlockId b_from = pick_from_block(rand_state);
     if (!b_from) {
         return e_create_move::ABORT; //No movable block found
     }
@@ -17,7 +17,7 @@ e_create_move UniformMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks
     VTR_ASSERT(physical_tile_type(cluster_from_type) == grid_from_type);
 
     t_pl_loc to;
-    if (!find_to_loc_uniform(physical_tile_type(b_from), rlim, from, to)) {
+    if (!find_to_loc_uniform(physical_tile_type(b_from), rlim, from, to, rand_state)) {
         return e_create_move::ABORT;
     }
 
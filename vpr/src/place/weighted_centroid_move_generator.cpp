@@ -0,0 +1,77 @@
+#include "weighted_centroid_move_generator.h"
+#include "timing_place.h"
+#include "globals.h"
+
+#include <cmath>
+
+e_create_move WeightedCentroidMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_affected, float rlim, vtr::RandState& rand_state) {
+    /* Pick a random block and propose moving it towards the
+     * criticality-weighted centroid of the blocks it is connected to. */
+    ClusterBlockId b_from = pick_from_block(rand_state);
+    if (!b_from) {
+        return e_create_move::ABORT; //No movable block found
+    }
+
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    t_pl_loc from = place_ctx.block_locs[b_from].loc;
+    auto cluster_from_type = cluster_ctx.clb_nlist.block_type(b_from);
+    auto grid_from_type = g_vpr_ctx.device().grid[from.x][from.y].type;
+    VTR_ASSERT(physical_tile_type(cluster_from_type) == grid_from_type);
+
+    //Accumulate the criticality-weighted centroid of the connected blocks.
+    //Each connection is weighted by its placement criticality, so critical
+    //connections pull the target harder.
+    double weight_sum = 0.;
+    double weighted_x = 0.;
+    double weighted_y = 0.;
+
+    for (ClusterPinId pin_id : cluster_ctx.clb_nlist.block_pins(b_from)) {
+        ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(pin_id);
+        if (!net_id) continue;
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) continue;
+
+        if (cluster_ctx.clb_nlist.pin_type(pin_id) == PinType::DRIVER) {
+            //b_from drives this net: each sink pulls with its own criticality
+            for (ClusterPinId sink_pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
+                ClusterBlockId sink_blk = cluster_ctx.clb_nlist.pin_block(sink_pin_id);
+                if (sink_blk == b_from) continue;
+
+                float crit = get_timing_place_crit(sink_pin_id);
+
+                const t_pl_loc& loc = place_ctx.block_locs[sink_blk].loc;
+                weight_sum += crit;
+                weighted_x += crit * loc.x;
+                weighted_y += crit * loc.y;
+            }
+        } else {
+            //b_from is a sink: the driver pulls with this connection's criticality
+            VTR_ASSERT_SAFE(cluster_ctx.clb_nlist.pin_type(pin_id) == PinType::SINK);
+            ClusterBlockId driver_blk = cluster_ctx.clb_nlist.net_driver_block(net_id);
+            if (driver_blk == b_from) continue;
+
+            float crit = get_timing_place_crit(pin_id);
+
+            const t_pl_loc& loc = place_ctx.block_locs[driver_blk].loc;
+            weight_sum += crit;
+            weighted_x += crit * loc.x;
+            weighted_y += crit * loc.y;
+        }
+    }
+
+    if (weight_sum == 0.) {
+        return e_create_move::ABORT; //All connections non-critical -- no preferred direction
+    }
+
+    t_pl_loc target;
+    target.x = std::lround(weighted_x / weight_sum);
+    target.y = std::lround(weighted_y / weight_sum);
+
+    t_pl_loc to;
+    if (!find_to_loc_centroid(physical_tile_type(b_from), rlim, from, target, to, rand_state)) {
+        return e_create_move::ABORT;
+    }
+
+    return ::create_move(blocks_affected, b_from, to);
+}
@@ -0,0 +1,15 @@
+#ifndef VPR_WEIGHTED_CENTROID_MOVE_GEN_H
+#define VPR_WEIGHTED_CENTROID_MOVE_GEN_H
+#include "move_generator.h"
+
+//Directed move generator which proposes moving a random block towards the
+//timing-criticality-weighted centroid of the blocks it is connected to, so
+//critical connections are preferentially shortened.
+//
+//Requires the placement criticalities to be loaded (i.e. timing-driven
+//placement); in other modes use MedianMoveGenerator/UniformMoveGenerator.
+class WeightedCentroidMoveGenerator : public MoveGenerator {
+    e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim, vtr::RandState& rand_state) override;
+};
+
+#endif
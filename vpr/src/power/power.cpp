@@ -27,6 +27,8 @@
 #include <ctime>
 #include <cmath>
 #include <ctype.h>
+#include <map>
+#include <vector>
 
 #include "vtr_util.h"
 #include "vtr_path.h"
@@ -551,6 +553,44 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
     power_add_usage(&pb_node->pb_type->pb_type_power->power_usage, power_usage);
 }
 
+/* Collects pointers to every persistent power accumulator in a pb_type tree
+ * (the same set power_reset_pb_type zeroes), so that the accumulated
+ * contribution of a single power_usage_pb call can be captured and replayed */
+static void power_collect_pb_type_accumulators(std::vector<t_power_usage*>& accumulators,
+                                               t_pb_type* pb_type) {
+    accumulators.push_back(&pb_type->pb_type_power->power_usage);
+    accumulators.push_back(&pb_type->pb_type_power->power_usage_bufs_wires);
+
+    for (int mode_idx = 0; mode_idx < pb_type->num_modes; mode_idx++) {
+        accumulators.push_back(&pb_type->modes[mode_idx].mode_power->power_usage);
+
+        for (int child_idx = 0;
+             child_idx < pb_type->modes[mode_idx].num_pb_type_children;
+             child_idx++) {
+            power_collect_pb_type_accumulators(accumulators,
+                                               &pb_type->modes[mode_idx].pb_type_children[child_idx]);
+        }
+        for (int interc_idx = 0;
+             interc_idx < pb_type->modes[mode_idx].num_interconnect;
+             interc_idx++) {
+            accumulators.push_back(&pb_type->modes[mode_idx].interconnect[interc_idx].interconnect_power->power_usage);
+        }
+    }
+}
+
+/* Power of one unoccupied instance of a block type, captured so it can be
+ * replayed for every other empty location of that type. An empty location's
+ * power depends only on the type (default modes, zero pin activity), so the
+ * full pb traversal only needs to run once per type; the entry records the
+ * traversal's contributions to the per-type/mode/interconnect accumulators
+ * and the global component trackers so replays keep the breakdowns exact. */
+struct t_unoccupied_pb_power {
+    t_power_usage total;
+    std::vector<t_power_usage*> accumulators;
+    std::vector<t_power_usage> accumulator_deltas;
+    std::vector<t_power_usage> component_deltas;
+};
+
 /* Resets the power stats for all physical blocks */
 static void power_reset_pb_type(t_pb_type* pb_type) {
     int mode_idx;
@@ -601,6 +641,8 @@ static void power_usage_blocks(t_power_usage* power_usage) {
 
     power_reset_tile_usage();
 
+    std::map<t_logical_block_type_ptr, t_unoccupied_pb_power> unoccupied_pb_power_cache;
+
     /* Loop through all grid locations */
     for (size_t x = 0; x < device_ctx.grid.width(); x++) {
         for (size_t y = 0; y < device_ctx.grid.height(); y++) {
@@ -614,13 +656,65 @@ static void power_usage_blocks(t_power_usage* power_usage) {
                 t_pb* pb = nullptr;
                 t_power_usage pb_power;
 
-                ClusterBlockId iblk = place_ctx.grid_blocks[x][y].blocks[z];
+                ClusterBlockId iblk = place_ctx.grid_blocks.block_at_location(x, y, z);
+                t_logical_block_type_ptr block_type = logical_block_type(device_ctx.grid[x][y].type);
 
-                if (iblk != EMPTY_BLOCK_ID && iblk != INVALID_BLOCK_ID)
+                if (iblk != EMPTY_BLOCK_ID && iblk != INVALID_BLOCK_ID) {
                     pb = cluster_ctx.clb_nlist.block_pb(iblk);
 
-                /* Calculate power of this CLB */
-                power_usage_pb(&pb_power, pb, logical_block_type(device_ctx.grid[x][y].type)->pb_graph_head, iblk);
+                    /* Calculate power of this CLB */
+                    power_usage_pb(&pb_power, pb, block_type->pb_graph_head, iblk);
+                } else if (unoccupied_pb_power_cache.count(block_type)) {
+                    /* Unoccupied instance of a type we have already estimated:
+                     * replay the cached result and its accumulator contributions */
+                    const t_unoccupied_pb_power& cached = unoccupied_pb_power_cache[block_type];
+                    pb_power = cached.total;
+
+                    for (size_t k = 0; k < cached.accumulators.size(); k++) {
+                        power_add_usage(cached.accumulators[k], &cached.accumulator_deltas[k]);
+                    }
+                    for (int comp_idx = 0; comp_idx < POWER_COMPONENT_MAX_NUM; comp_idx++) {
+                        t_power_usage component_delta = cached.component_deltas[comp_idx];
+                        power_component_add_usage(&component_delta,
+                                                  (e_power_component_type)comp_idx);
+                    }
+                } else {
+                    /* First unoccupied instance of this type: estimate it and
+                     * capture what the traversal added to each accumulator */
+                    t_unoccupied_pb_power cached;
+                    power_collect_pb_type_accumulators(cached.accumulators, block_type->pb_type);
+
+                    std::vector<t_power_usage> accumulators_before;
+                    for (t_power_usage* accumulator : cached.accumulators) {
+                        accumulators_before.push_back(*accumulator);
+                    }
+                    std::vector<t_power_usage> components_before(POWER_COMPONENT_MAX_NUM);
+                    for (int comp_idx = 0; comp_idx < POWER_COMPONENT_MAX_NUM; comp_idx++) {
+                        power_component_get_usage(&components_before[comp_idx],
+                                                  (e_power_component_type)comp_idx);
+                    }
+
+                    power_usage_pb(&pb_power, nullptr, block_type->pb_graph_head, iblk);
+
+                    cached.total = pb_power;
+                    for (size_t k = 0; k < cached.accumulators.size(); k++) {
+                        t_power_usage delta;
+                        delta.dynamic = cached.accumulators[k]->dynamic - accumulators_before[k].dynamic;
+                        delta.leakage = cached.accumulators[k]->leakage - accumulators_before[k].leakage;
+                        cached.accumulator_deltas.push_back(delta);
+                    }
+                    for (int comp_idx = 0; comp_idx < POWER_COMPONENT_MAX_NUM; comp_idx++) {
+                        t_power_usage component_now;
+                        power_component_get_usage(&component_now,
+                                                  (e_power_component_type)comp_idx);
+                        t_power_usage delta;
+                        delta.dynamic = component_now.dynamic - components_before[comp_idx].dynamic;
+                        delta.leakage = component_now.leakage - components_before[comp_idx].leakage;
+                        cached.component_deltas.push_back(delta);
+                    }
+                    unoccupied_pb_power_cache[block_type] = cached;
+                }
+
                 power_add_usage(power_usage, &pb_power);
             }
         }
@@ -131,6 +131,7 @@
 #include <iostream>
 
 #include "vtr_assert.h"
+#include "vtr_math.h"
 #include "vtr_memory.h"
 #include "vtr_log.h"
 
@@ -142,10 +143,6 @@
 #include "expr_eval.h"
 
 /************ Defines ************/
-/* if defined, switch block patterns are loaded by first computing a row of switch blocks and then
- * stamping out the row throughout the FPGA */
-//#define FAST_SB_COMPUTATION
-
 /* REF_X/REF_Y set a reference coordinate; some look-up structures in this file are computed relative to
  * this reference */
 #define REF_X 1 //constexpr int REX_X = 1;	<-- basically C++11 defines; more type-safe
@@ -185,30 +182,23 @@ typedef std::map<std::string, Wire_Info> t_wire_type_sizes;
 /* Counts the number of wires in each wire type in the specified channel */
 static void count_wire_type_sizes(const t_chan_seg_details* channel, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes);
 
-#ifdef FAST_SB_COMPUTATION
 /* over all connected wire types (i,j), compute the maximum least common multiple of their wire lengths,
  * ie max(LCM(L_i, L_J)) */
-static int get_max_lcm(vector<t_switchblock_inf>* switchblocks, t_wire_type_sizes* wire_type_sizes);
+static int get_max_lcm(std::vector<t_switchblock_inf>* switchblocks, t_wire_type_sizes* wire_type_sizes);
 
 /* compute all the switchblocks around the perimeter of the FPGA for the given switchblock and wireconn */
-static void compute_perimeter_switchblocks(t_chan_details* chan_details_x, t_chan_details* chan_details_y, vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_conns);
+static void compute_perimeter_switchblocks(const t_chan_details& chan_details_x, const t_chan_details& chan_details_y, std::vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_conns, vtr::RandState& rand_state);
 
-/* computes a horizontal line of switchblocks of size sb_row_size (or of grid.width()-4, whichever is smaller), starting
- * at coordinate (1,1) */
-static void compute_switchblock_row(int sb_row_size, t_chan_details* chan_details_x, t_chan_details* chan_details_y, vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_row);
+/* computes a horizontal line of switchblocks of size sb_row_size, starting at coordinate (1,1) */
+static void compute_switchblock_row(int sb_row_size, const t_chan_details& chan_details_x, const t_chan_details& chan_details_y, std::vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_row, vtr::RandState& rand_state);
 
 /* stamp out a line of horizontal switchblocks starting at coordinates (ref_x, ref_y) and
  * continuing on for sb_row_size */
 static void stampout_switchblocks_from_row(int sb_row_size,
-                                           int nodes_per_chan,
                                            const DeviceGrid& grid,
-                                           t_wire_type_sizes* wire_type_sizes,
-                                           e_directionality directionality,
                                            t_sb_connection_map* sb_row,
                                            t_sb_connection_map* sb_conns);
 
-#endif //FAST_SB_COMPUTATION
-
 /* Compute the wire(s) that the wire at (x, y, from_side, to_side, from_wire) should connect to.
  * sb_conns is updated with the result */
 static void compute_wire_connections(int x_coord, int y_coord, enum e_side from_side, enum e_side to_side, const t_chan_details& chan_details_x, const t_chan_details& chan_details_y, t_switchblock_inf* sb, const DeviceGrid& grid, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_conns, vtr::RandState& rand_state);
@@ -273,55 +263,62 @@ t_sb_connection_map* alloc_and_load_switchblock_permutations(const t_chan_detail
     t_wire_type_sizes wire_type_sizes;
     count_wire_type_sizes(chan_details_x[0][0].data(), channel_width, &wire_type_sizes);
 
-#ifdef FAST_SB_COMPUTATION
-    /******** fast switch block computation method; computes a row of switchblocks then stamps it out everywhere ********/
-    /* figure out max(lcm(L_i, L_j)) for all wire lengths belonging to wire types i & j */
+    /* verify that the switchblock types match the specified directionality -- currently we have to stay consistent */
+    for (int i_sb = 0; i_sb < (int)switchblocks.size(); i_sb++) {
+        if (directionality != switchblocks[i_sb].directionality) {
+            VPR_FATAL_ERROR(VPR_ERROR_ARCH, "alloc_and_load_switchblock_connections: Switchblock %s does not match directionality of architecture\n", switchblocks[i_sb].name.c_str());
+        }
+    }
+
+    /* figure out max(lcm(L_i, L_j)) for all wire lengths belonging to wire types i & j; the core
+     * switchblock pattern repeats with this period, so it bounds the number of distinct patterns */
     int max_lcm = get_max_lcm(&switchblocks, &wire_type_sizes);
-    t_sb_connection_map sb_row;
 
-    /* compute the perimeter switchblocks. unfortunately we can't just compute corners and stamp out the rest because
-     * for a unidirectional architecture corners AND perimeter switchblocks require special treatment */
-    compute_perimeter_switchblocks(chan_details_x, chan_details_y, &switchblocks,
-                                   grid, channel_width, &wire_type_sizes, directionality, sb_conns);
+    if (max_lcm >= 1 && max_lcm <= int(grid.width()) - 4 && int(grid.height()) >= 4) {
+        /******** fast switch block computation method ********/
+        /* Only a handful of distinct patterns exist: the perimeter location classes (edges and
+         * corners, which see clipped wires) and one period of the repeating core pattern. Compute
+         * each distinct pattern once, then fill the rest of the core by copying entries. */
+        t_sb_connection_map sb_row;
 
-    /* compute the switchblock row */
-    compute_switchblock_row(max_lcm, chan_details_x, chan_details_y, &switchblocks,
-                            grid, channel_width, &wire_type_sizes, directionality, &sb_row);
+        /* compute the perimeter switchblocks. unfortunately we can't just compute corners and stamp out the rest because
+         * for a unidirectional architecture corners AND perimeter switchblocks require special treatment */
+        compute_perimeter_switchblocks(chan_details_x, chan_details_y, &switchblocks,
+                                       grid, channel_width, &wire_type_sizes, directionality, sb_conns, rand_state);
 
-    /* stamp-out the switchblock row throughout the rest of the FPGA */
-    stampout_switchblocks_from_row(max_lcm, channel_width,
-                                   grid, &wire_type_sizes, directionality, &sb_row, sb_conns);
+        /* compute one period of the core switchblock pattern */
+        compute_switchblock_row(max_lcm, chan_details_x, chan_details_y, &switchblocks,
+                                grid, channel_width, &wire_type_sizes, directionality, &sb_row, rand_state);
 
-#else
-    /******** slow switch block computation method; computes switchblocks at each coordinate ********/
-    /* iterate over all the switchblocks specified in the architecture */
-    for (int i_sb = 0; i_sb < (int)switchblocks.size(); i_sb++) {
-        t_switchblock_inf sb = switchblocks[i_sb];
-
-        /* verify that switchblock type matches specified directionality -- currently we have to stay consistent */
-        if (directionality != sb.directionality) {
-            VPR_FATAL_ERROR(VPR_ERROR_ARCH, "alloc_and_load_switchblock_connections: Switchblock %s does not match directionality of architecture\n", sb.name.c_str());
-        }
-        /* Iterate over the x,y coordinates spanning the FPGA. */
-        for (size_t x_coord = 0; x_coord < grid.width(); x_coord++) {
-            for (size_t y_coord = 0; y_coord <= grid.height(); y_coord++) {
-                if (sb_not_here(grid, x_coord, y_coord, sb.location)) {
-                    continue;
-                }
-                /* now we iterate over all the potential side1->side2 connections */
-                for (e_side from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-                    for (e_side to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-                        /* Fill appropriate entry of the sb_conns map with vector specifying the wires
-                         * the current wire will connect to */
-                        compute_wire_connections(x_coord, y_coord, from_side, to_side,
-                                                 chan_details_x, chan_details_y, &sb, grid,
-                                                 &wire_type_sizes, directionality, sb_conns, rand_state);
+        /* stamp-out the switchblock row throughout the rest of the FPGA */
+        stampout_switchblocks_from_row(max_lcm, grid, &sb_row, sb_conns);
+    } else {
+        /******** slow switch block computation method; computes switchblocks at each coordinate ********/
+        /* used when the device is too small to hold a full period of the core pattern */
+        /* iterate over all the switchblocks specified in the architecture */
+        for (int i_sb = 0; i_sb < (int)switchblocks.size(); i_sb++) {
+            t_switchblock_inf sb = switchblocks[i_sb];
+
+            /* Iterate over the x,y coordinates spanning the FPGA. */
+            for (size_t x_coord = 0; x_coord < grid.width(); x_coord++) {
+                for (size_t y_coord = 0; y_coord <= grid.height(); y_coord++) {
+                    if (sb_not_here(grid, x_coord, y_coord, sb.location)) {
+                        continue;
+                    }
+                    /* now we iterate over all the potential side1->side2 connections */
+                    for (e_side from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
+                        for (e_side to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
+                            /* Fill appropriate entry of the sb_conns map with vector specifying the wires
+                             * the current wire will connect to */
+                            compute_wire_connections(x_coord, y_coord, from_side, to_side,
+                                                     chan_details_x, chan_details_y, &sb, grid,
+                                                     &wire_type_sizes, directionality, sb_conns, rand_state);
+                        }
                     }
                 }
             }
         }
     }
-#endif
 
     return sb_conns;
 }
@@ -340,10 +337,9 @@ void free_switchblock_permutations(t_sb_connection_map* sb_conns) {
     return;
 }
 
-#ifdef FAST_SB_COMPUTATION
 /* over all connected wire types (i,j), compute the maximum least common multiple of their wire lengths,
  * ie max(LCM(L_i, L_J)) */
-static int get_max_lcm(vector<t_switchblock_inf>* switchblocks, t_wire_type_sizes* wire_type_sizes) {
+static int get_max_lcm(std::vector<t_switchblock_inf>* switchblocks, t_wire_type_sizes* wire_type_sizes) {
     int max_lcm = -1;
     int num_sb = (int)switchblocks->size();
 
@@ -354,16 +350,14 @@ static int get_max_lcm(vector<t_switchblock_inf>* switchblocks, t_wire_type_size
         /* over each wireconn */
         for (int iwc = 0; iwc < num_wireconns; iwc++) {
             t_wireconn_inf* wc = &(sb->wireconns[iwc]);
-            int num_from_types = (int)wc->from_type.size();
-            int num_to_types = (int)wc->to_type.size();
             /* over each from type */
-            for (int ifrom = 0; ifrom < num_from_types; ifrom++) {
+            for (const t_wire_switchpoints& from_wire : wc->from_switchpoint_set) {
                 /* over each to type */
-                for (int ito = 0; ito < num_to_types; ito++) {
-                    if ((*wire_type_sizes).find(wc->from_type[ifrom]) != (*wire_type_sizes).end() && (*wire_type_sizes).find(wc->to_type[ito]) != (*wire_type_sizes).end()) {
+                for (const t_wire_switchpoints& to_wire : wc->to_switchpoint_set) {
+                    if ((*wire_type_sizes).find(from_wire.segment_name) != (*wire_type_sizes).end() && (*wire_type_sizes).find(to_wire.segment_name) != (*wire_type_sizes).end()) {
                         // the condition can fail if freq of a seg is 0 (so it is in wc, but not in wire_type_size)
-                        int length1 = wire_type_sizes->at(wc->from_type[ifrom]).length;
-                        int length2 = wire_type_sizes->at(wc->to_type[ito]).length;
+                        int length1 = wire_type_sizes->at(from_wire.segment_name).length;
+                        int length2 = wire_type_sizes->at(to_wire.segment_name).length;
                         int current_lcm = vtr::lcm(length1, length2);
                         if (current_lcm > max_lcm) {
                             max_lcm = current_lcm;
@@ -379,7 +373,7 @@ static int get_max_lcm(vector<t_switchblock_inf>* switchblocks, t_wire_type_size
 
 /* computes a horizontal row of switchblocks of size sb_row_size (or of grid.width()-4, whichever is smaller), starting
  * at coordinate (1,1) */
-static void compute_switchblock_row(int sb_row_size, t_chan_details* chan_details_x, t_chan_details* chan_details_y, vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_row) {
+static void compute_switchblock_row(int sb_row_size, const t_chan_details& chan_details_x, const t_chan_details& chan_details_y, std::vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_row, vtr::RandState& rand_state) {
     int y = 1;
     for (int isb = 0; isb < (int)switchblocks->size(); isb++) {
         t_switchblock_inf* sb = &(switchblocks->at(isb));
@@ -394,7 +388,7 @@ static void compute_switchblock_row(int sb_row_size, t_chan_details* chan_detail
                      * the current wire will connect to */
                     compute_wire_connections(x, y, from_side, to_side,
                                              chan_details_x, chan_details_y, sb, grid,
-                                             wire_type_sizes, directionality, sb_row);
+                                             wire_type_sizes, directionality, sb_row, rand_state);
                 }
             }
         }
@@ -404,16 +398,13 @@ static void compute_switchblock_row(int sb_row_size, t_chan_details* chan_detail
 /* stamp out a row of horizontal switchblocks throughout the FPGA starting at coordinates (ref_x, ref_y) and
  * continuing on for sb_row_size */
 static void stampout_switchblocks_from_row(int sb_row_size,
-                                           int nodes_per_chan,
                                            const DeviceGrid& grid,
-                                           t_wire_type_sizes* wire_type_sizes,
-                                           e_directionality directionality,
                                            t_sb_connection_map* sb_row,
                                            t_sb_connection_map* sb_conns) {
     /* over all x coordinates that may need stamping out */
-    for (int x = 1; x < grid.width() - 2; x++) { //-2 for no perim channels
+    for (int x = 1; x < int(grid.width()) - 2; x++) { //-2 for no perim channels
         /* over all y coordinates that may need stamping out */
-        for (int y = 1; y < grid.height() - 2; y++) { //-2 for no perim channels
+        for (int y = 1; y < int(grid.height()) - 2; y++) { //-2 for no perim channels
             /* perimeter has been precomputed */
             if (is_perimeter(grid, x, y)) {
                 continue;
@@ -426,27 +417,26 @@ static void stampout_switchblocks_from_row(int sb_row_size,
                     if (from_side == to_side) {
                         continue;
                     }
-                    /* over each source wire */
-                    for (int iwire = 0; iwire < nodes_per_chan; iwire++) {
-                        /* get the total x+y distance of the current switchblock from the reference switchblock */
-                        int distance = (x - REF_X) + (y - REF_Y);
-                        if (distance < 0) {
-                            distance = sb_row_size - ((-1 * distance) % sb_row_size);
-                        }
-                        /* figure out the coordinates of the switchblock we want to copy */
-                        int copy_y = 1;
-                        int copy_x = 1 + (distance % sb_row_size); //TODO: based on what? explain staggering pattern
-
-                        /* create the indices to key into the switchblock permutation map */
-                        Switchblock_Lookup my_key(x, y, from_side, to_side, iwire);
-                        Switchblock_Lookup copy_key(copy_x, copy_y, from_side, to_side, iwire);
+                    /* get the total x+y distance of the current switchblock from the reference switchblock */
+                    int distance = (x - REF_X) + (y - REF_Y);
+                    if (distance < 0) {
+                        distance = sb_row_size - ((-1 * distance) % sb_row_size);
+                    }
+                    /* figure out the coordinates of the switchblock we want to copy; the switchblock
+                     * pattern repeats along a diagonal with period sb_row_size, so every core location
+                     * maps onto one entry of the precomputed row at y=1 */
+                    int copy_y = 1;
+                    int copy_x = 1 + (distance % sb_row_size);
 
-                        if (sb_row->count(copy_key) == 0) {
-                            continue;
-                        }
+                    /* create the indices to key into the switchblock permutation map */
+                    Switchblock_Lookup my_key(x, y, from_side, to_side);
+                    Switchblock_Lookup copy_key(copy_x, copy_y, from_side, to_side);
 
-                        (*sb_conns)[my_key] = sb_row->at(copy_key);
+                    if (sb_row->count(copy_key) == 0) {
+                        continue;
                     }
+
+                    (*sb_conns)[my_key] = sb_row->at(copy_key);
                 }
             }
         }
@@ -454,7 +444,7 @@ static void stampout_switchblocks_from_row(int sb_row_size,
 }
 
 /* compute all the switchblocks around the perimeter of the FPGA for the given switchblock and wireconn */
-static void compute_perimeter_switchblocks(t_chan_details* chan_details_x, t_chan_details* chan_details_y, vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_conns) {
+static void compute_perimeter_switchblocks(const t_chan_details& chan_details_x, const t_chan_details& chan_details_y, std::vector<t_switchblock_inf>* switchblocks, const DeviceGrid& grid, int nodes_per_chan, t_wire_type_sizes* wire_type_sizes, e_directionality directionality, t_sb_connection_map* sb_conns, vtr::RandState& rand_state) {
     int x, y;
 
     for (int isb = 0; isb < (int)switchblocks->size(); isb++) {
@@ -473,7 +463,7 @@ static void compute_perimeter_switchblocks(t_chan_details* chan_details_x, t_cha
                          * the current wire will connect to */
                         compute_wire_connections(x, y, from_side, to_side,
                                                  chan_details_x, chan_details_y, sb, grid,
-                                                 wire_type_sizes, directionality, sb_conns);
+                                                 wire_type_sizes, directionality, sb_conns, rand_state);
                     }
                 }
             }
@@ -497,7 +487,7 @@ static void compute_perimeter_switchblocks(t_chan_details* chan_details_x, t_cha
                          * the current wire will connect to */
                         compute_wire_connections(x, y, from_side, to_side,
                                                  chan_details_x, chan_details_y, sb, grid,
-                                                 wire_type_sizes, directionality, sb_conns);
+                                                 wire_type_sizes, directionality, sb_conns, rand_state);
                     }
                 }
             }
@@ -506,8 +496,6 @@ static void compute_perimeter_switchblocks(t_chan_details* chan_details_x, t_cha
     }
 }
 
-#endif //FAST_SB_COMPUTATION
-
 /* returns true if the coordinates x/y do not correspond to the location specified by 'location' */
 static bool sb_not_here(const DeviceGrid& grid, int x, int y, e_sb_location location) {
     bool sb_not_here = true;
@@ -1,4 +1,7 @@
 #include <cstdio>
+#include <exception>
+#include <thread>
+#include <vector>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -16,7 +19,16 @@
 #include "route_tree_type.h"
 #include "route_tree_timing.h"
 
+/* Nets per worker below which spawning threads costs more than the checks */
+constexpr size_t MIN_NETS_PER_CHECK_WORKER = 64;
+
 /******************** Subroutines local to this module **********************/
+static void check_net_route(ClusterNetId net_id,
+                            enum e_route_type route_type,
+                            int num_switches,
+                            const t_non_configurable_rr_sets& non_configurable_rr_sets,
+                            bool* connected_to_route,
+                            bool* pin_done);
 static void check_node_and_range(int inode, enum e_route_type route_type);
 static void check_source(int inode, ClusterNetId net_id);
 static void check_sink(int inode, ClusterNetId net_id, bool* pin_done);
@@ -32,19 +44,18 @@ static void check_net_for_stubs(ClusterNetId net);
 
 /************************ Subroutine definitions ****************************/
 
-void check_route(enum e_route_type route_type) {
+void check_route(enum e_route_type route_type, int num_workers) {
     /* This routine checks that a routing:  (1) Describes a properly         *
      * connected path for each net, (2) this path connects all the           *
      * pins spanned by that net, and (3) that no routing resources are       *
      * oversubscribed (the occupancy of everything is recomputed from        *
-     * scratch).                                                             */
+     * scratch).                                                             *
+     *                                                                       *
+     * The per-net checks are independent of each other, so with             *
+     * num_workers > 1 they are spread over a pool of worker threads (each   *
+     * with its own scratch arrays).                                         */
 
-    int max_pins, inode, prev_node;
-    unsigned int ipin;
-    bool valid, connects;
-    bool* connected_to_route; /* [0 .. device_ctx.rr_nodes.size()-1] */
-    t_trace* tptr;
-    bool* pin_done;
+    bool valid;
 
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -59,7 +70,7 @@ void check_route(enum e_route_type route_type) {
      * resources.  This was already checked in order to determine that this  *
      * is a successful routing, but I want to double check it here.          */
 
-    recompute_occupancy_from_scratch();
+    recompute_occupancy_from_scratch(num_workers);
     valid = feasible_routing();
     if (valid == false) {
         VPR_ERROR(VPR_ERROR_ROUTE,
@@ -70,104 +81,178 @@ void check_route(enum e_route_type route_type) {
 
     auto non_configurable_rr_sets = identify_non_configurable_rr_sets();
 
-    connected_to_route = (bool*)vtr::calloc(device_ctx.rr_nodes.size(), sizeof(bool));
-
-    max_pins = 0;
+    int max_pins = 0;
     for (auto net_id : cluster_ctx.clb_nlist.nets())
         max_pins = std::max(max_pins, (int)cluster_ctx.clb_nlist.net_pins(net_id).size());
 
-    pin_done = (bool*)vtr::malloc(max_pins * sizeof(bool));
-
-    /* Now check that all nets are indeed connected. */
+    /* Collect the nets to check */
+    std::vector<ClusterNetId> nets_to_check;
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id) || cluster_ctx.clb_nlist.net_sinks(net_id).size() == 0) /* Skip ignored nets. */
             continue;
+        nets_to_check.push_back(net_id);
+    }
 
-        for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++)
-            pin_done[ipin] = false;
+    /* Checks a contiguous range of nets_to_check, using this thread's own
+     * scratch arrays */
+    auto check_net_range = [&](size_t first, size_t last) {
+        bool* connected_to_route = (bool*)vtr::calloc(device_ctx.rr_nodes.size(), sizeof(bool)); /* [0 .. device_ctx.rr_nodes.size()-1] */
+        bool* pin_done = (bool*)vtr::malloc(max_pins * sizeof(bool));
 
-        /* Check the SOURCE of the net. */
-        tptr = route_ctx.trace[net_id].head;
-        if (tptr == nullptr) {
-            VPR_ERROR(VPR_ERROR_ROUTE,
-                      "in check_route: net %d has no routing.\n", size_t(net_id));
+        for (size_t inet = first; inet < last; ++inet) {
+            check_net_route(nets_to_check[inet], route_type, num_switches, non_configurable_rr_sets,
+                            connected_to_route, pin_done);
         }
 
-        inode = tptr->index;
-        check_node_and_range(inode, route_type);
-        check_switch(tptr, num_switches);
-        connected_to_route[inode] = true; /* Mark as in path. */
+        free(pin_done);
+        free(connected_to_route);
+    };
 
-        check_source(inode, net_id);
-        pin_done[0] = true;
+    size_t num_check_workers = 1;
+    if (num_workers > 1) {
+        num_check_workers = std::min<size_t>(num_workers, std::max<size_t>(1, nets_to_check.size() / MIN_NETS_PER_CHECK_WORKER));
+    }
 
-        prev_node = inode;
-        int prev_switch = tptr->iswitch;
-        tptr = tptr->next;
+    if (num_check_workers <= 1) {
+        check_net_range(0, nets_to_check.size());
+    } else {
+        /* Any check failure throws; workers capture the exception so it can
+         * be re-thrown on the calling thread after all workers have joined */
+        std::vector<std::exception_ptr> worker_errors(num_check_workers);
+
+        auto worker_body = [&](size_t iworker) {
+            size_t nets_per_worker = (nets_to_check.size() + num_check_workers - 1) / num_check_workers;
+            size_t first = iworker * nets_per_worker;
+            size_t last = std::min(first + nets_per_worker, nets_to_check.size());
+
+            try {
+                check_net_range(first, last);
+            } catch (...) {
+                worker_errors[iworker] = std::current_exception();
+            }
 
-        /* Check the rest of the net */
-        size_t num_sinks = 0;
-        while (tptr != nullptr) {
-            inode = tptr->index;
-            check_node_and_range(inode, route_type);
-            check_switch(tptr, num_switches);
-
-            if (prev_switch == OPEN) { //Start of a new branch
-                if (connected_to_route[inode] == false) {
-                    VPR_ERROR(VPR_ERROR_ROUTE,
-                              "in check_route: node %d does not link into existing routing for net %d.\n", inode, size_t(net_id));
-                }
-            } else { //Continuing along existing branch
-                connects = check_adjacent(prev_node, inode);
-                if (!connects) {
-                    VPR_ERROR(VPR_ERROR_ROUTE,
-                              "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
-                              "  %s\n"
-                              "  %s\n",
-                              size_t(net_id),
-                              describe_rr_node(prev_node).c_str(),
-                              describe_rr_node(inode).c_str());
-                }
+            /* Release the route trees built (thread locally) while checking
+             * for stubs, before this worker exits */
+            free_route_tree_timing_structs();
+        };
 
-                connected_to_route[inode] = true; /* Mark as in path. */
+        std::vector<std::thread> workers;
+        workers.reserve(num_check_workers);
+        for (size_t iworker = 0; iworker < num_check_workers; ++iworker) {
+            workers.emplace_back(worker_body, iworker);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
 
-                if (device_ctx.rr_nodes[inode].type() == SINK) {
-                    check_sink(inode, net_id, pin_done);
-                    num_sinks += 1;
-                }
+        for (const std::exception_ptr& error : worker_errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
 
-            } /* End of prev_node type != SINK */
-            prev_node = inode;
-            prev_switch = tptr->iswitch;
-            tptr = tptr->next;
-        } /* End while */
+    VTR_LOG("Completed routing consistency check successfully.\n");
+    VTR_LOG("\n");
+}
 
-        if (num_sinks != cluster_ctx.clb_nlist.net_sinks(net_id).size()) {
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                            "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
-                            size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str(),
-                            num_sinks, cluster_ctx.clb_nlist.net_sinks(net_id).size());
-        }
+/* Checks the routing of a single net: that the traceback describes a
+ * connected path, that the path reaches every pin of the net, and that it
+ * respects non-configurable edges. Uses (and resets) the caller's
+ * connected_to_route and pin_done scratch arrays.                          */
+static void check_net_route(ClusterNetId net_id,
+                            enum e_route_type route_type,
+                            int num_switches,
+                            const t_non_configurable_rr_sets& non_configurable_rr_sets,
+                            bool* connected_to_route,
+                            bool* pin_done) {
+    int inode, prev_node;
+    unsigned int ipin;
+    bool connects;
+    t_trace* tptr;
 
-        for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++) {
-            if (pin_done[ipin] == false) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                                "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++)
+        pin_done[ipin] = false;
+
+    /* Check the SOURCE of the net. */
+    tptr = route_ctx.trace[net_id].head;
+    if (tptr == nullptr) {
+        VPR_ERROR(VPR_ERROR_ROUTE,
+                  "in check_route: net %d has no routing.\n", size_t(net_id));
+    }
+
+    inode = tptr->index;
+    check_node_and_range(inode, route_type);
+    check_switch(tptr, num_switches);
+    connected_to_route[inode] = true; /* Mark as in path. */
+
+    check_source(inode, net_id);
+    pin_done[0] = true;
+
+    prev_node = inode;
+    int prev_switch = tptr->iswitch;
+    tptr = tptr->next;
+
+    /* Check the rest of the net */
+    size_t num_sinks = 0;
+    while (tptr != nullptr) {
+        inode = tptr->index;
+        check_node_and_range(inode, route_type);
+        check_switch(tptr, num_switches);
+
+        if (prev_switch == OPEN) { //Start of a new branch
+            if (connected_to_route[inode] == false) {
+                VPR_ERROR(VPR_ERROR_ROUTE,
+                          "in check_route: node %d does not link into existing routing for net %d.\n", inode, size_t(net_id));
+            }
+        } else { //Continuing along existing branch
+            connects = check_adjacent(prev_node, inode);
+            if (!connects) {
+                VPR_ERROR(VPR_ERROR_ROUTE,
+                          "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
+                          "  %s\n"
+                          "  %s\n",
+                          size_t(net_id),
+                          describe_rr_node(prev_node).c_str(),
+                          describe_rr_node(inode).c_str());
             }
-        }
 
-        check_non_configurable_edges(net_id, non_configurable_rr_sets);
+            connected_to_route[inode] = true; /* Mark as in path. */
 
-        check_net_for_stubs(net_id);
+            if (device_ctx.rr_nodes[inode].type() == SINK) {
+                check_sink(inode, net_id, pin_done);
+                num_sinks += 1;
+            }
 
-        reset_flags(net_id, connected_to_route);
+        } /* End of prev_node type != SINK */
+        prev_node = inode;
+        prev_switch = tptr->iswitch;
+        tptr = tptr->next;
+    } /* End while */
 
-    } /* End for each net */
+    if (num_sinks != cluster_ctx.clb_nlist.net_sinks(net_id).size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
+                        size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str(),
+                        num_sinks, cluster_ctx.clb_nlist.net_sinks(net_id).size());
+    }
 
-    free(pin_done);
-    free(connected_to_route);
-    VTR_LOG("Completed routing consistency check successfully.\n");
-    VTR_LOG("\n");
+    for (ipin = 0; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++) {
+        if (pin_done[ipin] == false) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
+        }
+    }
+
+    check_non_configurable_edges(net_id, non_configurable_rr_sets);
+
+    check_net_for_stubs(net_id);
+
+    reset_flags(net_id, connected_to_route);
 }
 
 /* Checks that this SINK node is one of the terminals of inet, and marks   *
@@ -190,7 +275,7 @@ static void check_sink(int inode, ClusterNetId net_id, bool* pin_done) {
     ifound = 0;
 
     for (iblk = 0; iblk < type->capacity; iblk++) {
-        bnum = place_ctx.grid_blocks[i][j].blocks[iblk]; /* Hardcoded to one cluster_ctx block*/
+        bnum = place_ctx.grid_blocks.block_at_location(i, j, iblk); /* Hardcoded to one cluster_ctx block*/
         ipin = 1;
         for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
             if (cluster_ctx.clb_nlist.pin_block(pin_id) == bnum) {
@@ -517,11 +602,15 @@ static int chanx_chany_adjacent(int chanx_node, int chany_node) {
     return (1);
 }
 
-void recompute_occupancy_from_scratch() {
+void recompute_occupancy_from_scratch(int num_workers) {
     /*
      * This routine updates the occ field in the route_ctx.rr_node_route_inf structure
      * according to the resource usage of the current routing.  It does a
      * brute force recompute from scratch that is useful for sanity checking.
+     *
+     * With num_workers > 1 the per-net counting is spread over worker
+     * threads, each accumulating into its own partial occupancy array which
+     * are then summed (also split across the workers, by node range).
      */
 
     int inode, iclass, ipin, num_local_opins;
@@ -531,32 +620,91 @@ void recompute_occupancy_from_scratch() {
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    /* First set the occupancy of everything to zero. */
+    /* Counts the nodes used by a net's traceback into occ */
+    auto count_net_occupancy = [&](ClusterNetId net_id, int* occ) {
+        t_trace* trace = route_ctx.trace[net_id].head;
+        if (trace == nullptr)
+            return;
 
-    for (size_t inode_idx = 0; inode_idx < device_ctx.rr_nodes.size(); inode_idx++)
-        route_ctx.rr_node_route_inf[inode_idx].set_occ(0);
+        for (;;) {
+            occ[trace->index] += 1;
+
+            if (trace->iswitch == OPEN) {
+                trace = trace->next; /* Skip next segment. */
+                if (trace == nullptr)
+                    break;
+            }
+
+            trace = trace->next;
+        }
+    };
 
     /* Now go through each net and count the tracks and pins used everywhere */
 
+    std::vector<ClusterNetId> nets_to_count;
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) /* Skip ignored nets. */
             continue;
+        nets_to_count.push_back(net_id);
+    }
 
-        tptr = route_ctx.trace[net_id].head;
-        if (tptr == nullptr)
-            continue;
+    size_t num_count_workers = 1;
+    if (num_workers > 1) {
+        num_count_workers = std::min<size_t>(num_workers, std::max<size_t>(1, nets_to_count.size() / MIN_NETS_PER_CHECK_WORKER));
+    }
 
-        for (;;) {
-            inode = tptr->index;
-            route_ctx.rr_node_route_inf[inode].set_occ(route_ctx.rr_node_route_inf[inode].occ() + 1);
+    if (num_count_workers <= 1) {
+        std::vector<int> occ(device_ctx.rr_nodes.size(), 0);
+        for (ClusterNetId net_id : nets_to_count) {
+            count_net_occupancy(net_id, occ.data());
+        }
+        for (size_t inode_idx = 0; inode_idx < device_ctx.rr_nodes.size(); inode_idx++)
+            route_ctx.rr_node_route_inf[inode_idx].set_occ(occ[inode_idx]);
+    } else {
+        std::vector<std::vector<int>> partial_occ(num_count_workers);
 
-            if (tptr->iswitch == OPEN) {
-                tptr = tptr->next; /* Skip next segment. */
-                if (tptr == nullptr)
-                    break;
+        auto count_worker = [&](size_t iworker) {
+            size_t nets_per_worker = (nets_to_count.size() + num_count_workers - 1) / num_count_workers;
+            size_t first = iworker * nets_per_worker;
+            size_t last = std::min(first + nets_per_worker, nets_to_count.size());
+
+            partial_occ[iworker].assign(device_ctx.rr_nodes.size(), 0);
+            for (size_t inet = first; inet < last; ++inet) {
+                count_net_occupancy(nets_to_count[inet], partial_occ[iworker].data());
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_count_workers);
+        for (size_t iworker = 0; iworker < num_count_workers; ++iworker) {
+            workers.emplace_back(count_worker, iworker);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        /* Reduce the partial counts, each worker summing a disjoint range of
+         * nodes */
+        auto reduce_worker = [&](size_t iworker) {
+            size_t nodes_per_worker = (device_ctx.rr_nodes.size() + num_count_workers - 1) / num_count_workers;
+            size_t first = iworker * nodes_per_worker;
+            size_t last = std::min(first + nodes_per_worker, device_ctx.rr_nodes.size());
+
+            for (size_t inode_idx = first; inode_idx < last; ++inode_idx) {
+                int occ = 0;
+                for (size_t jworker = 0; jworker < num_count_workers; ++jworker) {
+                    occ += partial_occ[jworker][inode_idx];
+                }
+                route_ctx.rr_node_route_inf[inode_idx].set_occ(occ);
             }
+        };
 
-            tptr = tptr->next;
+        workers.clear();
+        for (size_t iworker = 0; iworker < num_count_workers; ++iworker) {
+            workers.emplace_back(reduce_worker, iworker);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
         }
     }
 
@@ -573,6 +721,10 @@ void recompute_occupancy_from_scratch() {
             }
         }
     }
+
+    /* Occupancies were set outside the pathfinder update routines, so the
+     * congested-node index no longer matches them */
+    rebuild_congested_node_index();
 }
 
 static void check_locally_used_clb_opins(const t_clb_opins_used& clb_opins_used_locally,
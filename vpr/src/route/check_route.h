@@ -3,8 +3,8 @@
 #include "physical_types.h"
 #include "route_common.h"
 
-void check_route(enum e_route_type route_type);
+void check_route(enum e_route_type route_type, int num_workers = 1);
 
-void recompute_occupancy_from_scratch();
+void recompute_occupancy_from_scratch(int num_workers = 1);
 
 #endif
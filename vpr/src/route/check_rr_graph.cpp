@@ -1,3 +1,6 @@
+#include <exception>
+#include <thread>
+
 #include "vtr_log.h"
 #include "vtr_memory.h"
 
@@ -8,6 +11,9 @@
 #include "rr_graph.h"
 #include "check_rr_graph.h"
 
+/* Nodes per worker below which spawning threads costs more than the checks */
+constexpr size_t MIN_NODES_PER_CHECK_WORKER = 65536;
+
 /*********************** Subroutines local to this module *******************/
 
 static bool rr_node_is_global_clb_ipin(int inode);
@@ -22,7 +28,8 @@ static void check_rr_edge(int from_node, int from_edge, int to_node);
 
 void check_rr_graph(const t_graph_type graph_type,
                     const DeviceGrid& grid,
-                    const std::vector<t_physical_tile_type>& types) {
+                    const std::vector<t_physical_tile_type>& types,
+                    int num_workers) {
     e_route_type route_type = DETAILED;
     if (graph_type == GRAPH_GLOBAL) {
         route_type = GLOBAL;
@@ -31,115 +38,165 @@ void check_rr_graph(const t_graph_type graph_type,
     auto& device_ctx = g_vpr_ctx.device();
 
     auto total_edges_to_node = std::vector<int>(device_ctx.rr_nodes.size());
-    auto switch_types_from_current_to_node = std::vector<unsigned char>(device_ctx.rr_nodes.size());
     const int num_rr_switches = device_ctx.rr_switch_inf.size();
 
-    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
-        device_ctx.rr_nodes[inode].validate();
+    /* Checks a contiguous range of nodes, accumulating the fan-in each node's
+     * edges contribute into the supplied (possibly worker local) array */
+    auto check_rr_node_range = [&](size_t node_begin, size_t node_end, std::vector<int>& edges_to_node) {
+        for (size_t inode = node_begin; inode != node_end; inode++) {
+            device_ctx.rr_nodes[inode].validate();
 
-        /* Ignore any uninitialized rr_graph nodes */
-        if ((device_ctx.rr_nodes[inode].type() == SOURCE)
-            && (device_ctx.rr_nodes[inode].xlow() == 0) && (device_ctx.rr_nodes[inode].ylow() == 0)
-            && (device_ctx.rr_nodes[inode].xhigh() == 0) && (device_ctx.rr_nodes[inode].yhigh() == 0)) {
-            continue;
-        }
+            /* Ignore any uninitialized rr_graph nodes */
+            if ((device_ctx.rr_nodes[inode].type() == SOURCE)
+                && (device_ctx.rr_nodes[inode].xlow() == 0) && (device_ctx.rr_nodes[inode].ylow() == 0)
+                && (device_ctx.rr_nodes[inode].xhigh() == 0) && (device_ctx.rr_nodes[inode].yhigh() == 0)) {
+                continue;
+            }
 
-        t_rr_type rr_type = device_ctx.rr_nodes[inode].type();
-        int num_edges = device_ctx.rr_nodes[inode].num_edges();
+            t_rr_type rr_type = device_ctx.rr_nodes[inode].type();
+            int num_edges = device_ctx.rr_nodes[inode].num_edges();
 
-        check_rr_node(inode, route_type, device_ctx);
+            check_rr_node(inode, route_type, device_ctx);
 
-        /* Check all the connectivity (edges, etc.) information.                    */
+            /* Check all the connectivity (edges, etc.) information.                    */
 
-        std::map<int, std::vector<int>> edges_from_current_to_node;
-        for (int iedge = 0; iedge < num_edges; iedge++) {
-            int to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
+            std::map<int, std::vector<int>> edges_from_current_to_node;
+            for (int iedge = 0; iedge < num_edges; iedge++) {
+                int to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
 
-            if (to_node < 0 || to_node >= (int)device_ctx.rr_nodes.size()) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                                "in check_rr_graph: node %d has an edge %d.\n"
-                                "\tEdge is out of range.\n",
-                                inode, to_node);
-            }
+                if (to_node < 0 || to_node >= (int)device_ctx.rr_nodes.size()) {
+                    VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                                    "in check_rr_graph: node %d has an edge %d.\n"
+                                    "\tEdge is out of range.\n",
+                                    inode, to_node);
+                }
 
-            check_rr_edge(inode, iedge, to_node);
+                check_rr_edge(inode, iedge, to_node);
 
-            edges_from_current_to_node[to_node].push_back(iedge);
-            total_edges_to_node[to_node]++;
+                edges_from_current_to_node[to_node].push_back(iedge);
+                edges_to_node[to_node]++;
 
-            auto switch_type = device_ctx.rr_nodes[inode].edge_switch(iedge);
+                auto switch_type = device_ctx.rr_nodes[inode].edge_switch(iedge);
 
-            if (switch_type < 0 || switch_type >= num_rr_switches) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                                "in check_rr_graph: node %d has a switch type %d.\n"
-                                "\tSwitch type is out of range.\n",
-                                inode, switch_type);
-            }
-        } /* End for all edges of node. */
+                if (switch_type < 0 || switch_type >= num_rr_switches) {
+                    VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                                    "in check_rr_graph: node %d has a switch type %d.\n"
+                                    "\tSwitch type is out of range.\n",
+                                    inode, switch_type);
+                }
+            } /* End for all edges of node. */
 
-        //Check that multiple edges between the same from/to nodes make sense
-        for (int iedge = 0; iedge < num_edges; iedge++) {
-            int to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
+            //Check that multiple edges between the same from/to nodes make sense
+            for (int iedge = 0; iedge < num_edges; iedge++) {
+                int to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
 
-            if (edges_from_current_to_node[to_node].size() == 1) continue; //Single edges are always OK
+                if (edges_from_current_to_node[to_node].size() == 1) continue; //Single edges are always OK
 
-            VTR_ASSERT_MSG(edges_from_current_to_node[to_node].size() > 1, "Expect multiple edges");
+                VTR_ASSERT_MSG(edges_from_current_to_node[to_node].size() > 1, "Expect multiple edges");
 
-            t_rr_type to_rr_type = device_ctx.rr_nodes[to_node].type();
+                t_rr_type to_rr_type = device_ctx.rr_nodes[to_node].type();
 
-            //Only expect chan <-> chan connections to have multiple edges
-            if ((to_rr_type != CHANX && to_rr_type != CHANY)
-                || (rr_type != CHANX && rr_type != CHANY)) {
-                VPR_ERROR(VPR_ERROR_ROUTE,
-                          "in check_rr_graph: node %d (%s) connects to node %d (%s) %zu times - multi-connections only expected for CHAN->CHAN.\n",
-                          inode, rr_node_typename[rr_type], to_node, rr_node_typename[to_rr_type], edges_from_current_to_node[to_node].size());
-            }
+                //Only expect chan <-> chan connections to have multiple edges
+                if ((to_rr_type != CHANX && to_rr_type != CHANY)
+                    || (rr_type != CHANX && rr_type != CHANY)) {
+                    VPR_ERROR(VPR_ERROR_ROUTE,
+                              "in check_rr_graph: node %d (%s) connects to node %d (%s) %zu times - multi-connections only expected for CHAN->CHAN.\n",
+                              inode, rr_node_typename[rr_type], to_node, rr_node_typename[to_rr_type], edges_from_current_to_node[to_node].size());
+                }
 
-            //Between two wire segments
-            VTR_ASSERT_MSG(to_rr_type == CHANX || to_rr_type == CHANY, "Expect channel type");
-            VTR_ASSERT_MSG(rr_type == CHANX || rr_type == CHANY, "Expect channel type");
+                //Between two wire segments
+                VTR_ASSERT_MSG(to_rr_type == CHANX || to_rr_type == CHANY, "Expect channel type");
+                VTR_ASSERT_MSG(rr_type == CHANX || rr_type == CHANY, "Expect channel type");
 
-            //While multiple connections between the same wires can be electrically legal,
-            //they are redundant if they are of the same switch type.
-            //
-            //Identify any such edges with identical switches
-            std::map<short, int> switch_counts;
-            for (auto edge : edges_from_current_to_node[to_node]) {
-                auto edge_switch = device_ctx.rr_nodes[inode].edge_switch(edge);
+                //While multiple connections between the same wires can be electrically legal,
+                //they are redundant if they are of the same switch type.
+                //
+                //Identify any such edges with identical switches
+                std::map<short, int> switch_counts;
+                for (auto edge : edges_from_current_to_node[to_node]) {
+                    auto edge_switch = device_ctx.rr_nodes[inode].edge_switch(edge);
 
-                switch_counts[edge_switch]++;
+                    switch_counts[edge_switch]++;
+                }
+
+                //Tell the user about any redundant edges
+                for (auto kv : switch_counts) {
+                    if (kv.second <= 1) continue;
+
+                    auto switch_type = device_ctx.rr_switch_inf[kv.first].type();
+
+                    VPR_ERROR(VPR_ERROR_ROUTE, "in check_rr_graph: node %d has %d redundant connections to node %d of switch type %d (%s)",
+                              inode, kv.second, to_node, kv.first, SWITCH_TYPE_STRINGS[size_t(switch_type)]);
+                }
             }
 
-            //Tell the user about any redundant edges
-            for (auto kv : switch_counts) {
-                if (kv.second <= 1) continue;
+            /* Slow test could leave commented out most of the time. */
+            check_unbuffered_edges(inode);
 
-                auto switch_type = device_ctx.rr_switch_inf[kv.first].type();
+            //Check that all config/non-config edges are appropriately organized
+            for (auto edge : device_ctx.rr_nodes[inode].configurable_edges()) {
+                if (!device_ctx.rr_nodes[inode].edge_is_configurable(edge)) {
+                    VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "in check_rr_graph: node %d edge %d is non-configurable, but in configurable edges",
+                                    inode, edge);
+                }
+            }
 
-                VPR_ERROR(VPR_ERROR_ROUTE, "in check_rr_graph: node %d has %d redundant connections to node %d of switch type %d (%s)",
-                          inode, kv.second, to_node, kv.first, SWITCH_TYPE_STRINGS[size_t(switch_type)]);
+            for (auto edge : device_ctx.rr_nodes[inode].non_configurable_edges()) {
+                if (device_ctx.rr_nodes[inode].edge_is_configurable(edge)) {
+                    VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "in check_rr_graph: node %d edge %d is configurable, but in non-configurable edges",
+                                    inode, edge);
+                }
             }
-        }
 
-        /* Slow test could leave commented out most of the time. */
-        check_unbuffered_edges(inode);
+        } /* End for all rr_nodes in range */
+    };
 
-        //Check that all config/non-config edges are appropriately organized
-        for (auto edge : device_ctx.rr_nodes[inode].configurable_edges()) {
-            if (!device_ctx.rr_nodes[inode].edge_is_configurable(edge)) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "in check_rr_graph: node %d edge %d is non-configurable, but in configurable edges",
-                                inode, edge);
+    size_t num_check_workers = 1;
+    if (num_workers > 1) {
+        num_check_workers = std::min<size_t>(num_workers, std::max<size_t>(1, device_ctx.rr_nodes.size() / MIN_NODES_PER_CHECK_WORKER));
+    }
+
+    if (num_check_workers <= 1) {
+        check_rr_node_range(0, device_ctx.rr_nodes.size(), total_edges_to_node);
+    } else {
+        /* Each worker checks a contiguous node range. All the per-node checks
+         * only read the graph; the fan-in counts (which any node's edges may
+         * contribute to) are accumulated per worker and summed below. Check
+         * failures throw, so workers capture the exception for re-throw on
+         * the calling thread after all workers have joined */
+        std::vector<std::vector<int>> worker_edges_to_node(num_check_workers, std::vector<int>(device_ctx.rr_nodes.size(), 0));
+        std::vector<std::exception_ptr> worker_errors(num_check_workers);
+
+        size_t nodes_per_worker = (device_ctx.rr_nodes.size() + num_check_workers - 1) / num_check_workers;
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_check_workers);
+        for (size_t iworker = 0; iworker < num_check_workers; ++iworker) {
+            size_t node_begin = std::min(device_ctx.rr_nodes.size(), iworker * nodes_per_worker);
+            size_t node_end = std::min(device_ctx.rr_nodes.size(), node_begin + nodes_per_worker);
+            workers.emplace_back([&, iworker, node_begin, node_end]() {
+                try {
+                    check_rr_node_range(node_begin, node_end, worker_edges_to_node[iworker]);
+                } catch (...) {
+                    worker_errors[iworker] = std::current_exception();
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        for (const std::exception_ptr& error : worker_errors) {
+            if (error) {
+                std::rethrow_exception(error);
             }
         }
 
-        for (auto edge : device_ctx.rr_nodes[inode].non_configurable_edges()) {
-            if (device_ctx.rr_nodes[inode].edge_is_configurable(edge)) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "in check_rr_graph: node %d edge %d is configurable, but in non-configurable edges",
-                                inode, edge);
+        for (const auto& edges_to_node : worker_edges_to_node) {
+            for (size_t inode = 0; inode < edges_to_node.size(); ++inode) {
+                total_edges_to_node[inode] += edges_to_node[inode];
             }
         }
-
-    } /* End for all rr_nodes */
+    }
 
     /* I built a list of how many edges went to everything in the code above -- *
      * now I check that everything is reachable.                                */
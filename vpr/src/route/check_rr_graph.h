@@ -4,7 +4,8 @@
 
 void check_rr_graph(const t_graph_type graph_type,
                     const DeviceGrid& grid,
-                    const std::vector<t_physical_tile_type>& types);
+                    const std::vector<t_physical_tile_type>& types,
+                    int num_workers = 1);
 
 void check_rr_node(int inode, enum e_route_type route_type, const DeviceContext& device_ctx);
 
@@ -189,66 +189,88 @@ void ClockRib::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGraphB
     VTR_ASSERT(repeat.y > 0);
     VTR_ASSERT(repeat.x > 0);
 
-    for (unsigned y = x_chan_wire.position; y < grid.height() - 1; y += repeat.y) {
-        for (unsigned x_start = x_chan_wire.start; x_start < grid.width() - 1; x_start += repeat.x) {
-            unsigned drive_x = x_start + drive.offset;
-            unsigned x_end = x_start + x_chan_wire.length;
-
-            // Adjust for boundry conditions
-            int x_offset = 0;
-            if ((x_start == 0) ||              // CHANX wires left boundry
-                (x_start + repeat.x == x_end)) // Avoid overlap
-            {
-                x_offset = 1;
-            }
-            if (x_end > grid.width() - 2) {
-                x_end = grid.width() - 2; // CHANX wires right boundry
-            }
-
-            // Dont create rib if drive point is not reachable
-            if (drive_x > grid.width() - 2 || drive_x >= x_end || drive_x <= (x_start + x_offset)) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "A rib part of clock network '%s' was not"
-                                    " created becuase the drive point is not reachable. "
-                                    "This can lead to an unroutable architecture.\n",
-                                    clock_name_.c_str());
-                continue;
-            }
-
-            // Dont create rib if wire segment is too small
-            if ((x_start + x_offset) >= x_end) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "Rib start '%d' and end '%d' values are "
-                                    "not sucessive for clock network '%s' due to not meeting boundry conditions."
-                                    " This can lead to an unroutable architecture.\n",
-                                    (x_start + x_offset), x_end, clock_name_.c_str());
-                continue;
-            }
+    // The rib network is periodic: the boundary adjustments and validity
+    // checks depend only on x (the pattern just repeats at each y), so work
+    // out the pattern of valid instances along one row once and stamp it at
+    // every row. Warnings about dropped instances are likewise printed once
+    // per repeating position rather than once per row.
+    struct t_rib_instance {
+        unsigned x_start; // After boundary adjustment
+        unsigned drive_x;
+        unsigned x_end;
+    };
+    std::vector<t_rib_instance> row_pattern;
+
+    for (unsigned x_start = x_chan_wire.start; x_start < grid.width() - 1; x_start += repeat.x) {
+        unsigned drive_x = x_start + drive.offset;
+        unsigned x_end = x_start + x_chan_wire.length;
+
+        // Adjust for boundry conditions
+        int x_offset = 0;
+        if ((x_start == 0) ||              // CHANX wires left boundry
+            (x_start + repeat.x == x_end)) // Avoid overlap
+        {
+            x_offset = 1;
+        }
+        if (x_end > grid.width() - 2) {
+            x_end = grid.width() - 2; // CHANX wires right boundry
+        }
 
+        // Dont create rib if drive point is not reachable
+        if (drive_x > grid.width() - 2 || drive_x >= x_end || drive_x <= (x_start + x_offset)) {
+            vtr::printf_warning(__FILE__, __LINE__,
+                                "A rib part of clock network '%s' was not"
+                                " created becuase the drive point is not reachable. "
+                                "This can lead to an unroutable architecture.\n",
+                                clock_name_.c_str());
+            continue;
+        }
+
+        // Dont create rib if wire segment is too small
+        if ((x_start + x_offset) >= x_end) {
+            vtr::printf_warning(__FILE__, __LINE__,
+                                "Rib start '%d' and end '%d' values are "
+                                "not sucessive for clock network '%s' due to not meeting boundry conditions."
+                                " This can lead to an unroutable architecture.\n",
+                                (x_start + x_offset), x_end, clock_name_.c_str());
+            continue;
+        }
+
+        row_pattern.push_back({x_start + x_offset, drive_x, x_end});
+    }
+
+    // Every wire in the network is on the same metal layer
+    short rc_index = find_create_rr_rc_data(x_chan_wire.layer.r_metal, x_chan_wire.layer.c_metal);
+
+    for (unsigned y = x_chan_wire.position; y < grid.height() - 1; y += repeat.y) {
+        for (const t_rib_instance& instance : row_pattern) {
             // create drive point (length zero wire)
-            auto drive_node_idx = create_chanx_wire(drive_x,
-                                                    drive_x,
+            auto drive_node_idx = create_chanx_wire(instance.drive_x,
+                                                    instance.drive_x,
                                                     y,
                                                     ptc_num,
+                                                    rc_index,
                                                     BI_DIRECTION,
                                                     rr_nodes);
-            clock_graph.add_switch_location(get_name(), drive.name, drive_x, y, drive_node_idx);
+            clock_graph.add_switch_location(get_name(), drive.name, instance.drive_x, y, drive_node_idx);
 
             // create rib wire to the right and left of the drive point
-            auto left_node_idx = create_chanx_wire(x_start + x_offset,
-                                                   drive_x - 1,
+            auto left_node_idx = create_chanx_wire(instance.x_start,
+                                                   instance.drive_x - 1,
                                                    y,
                                                    ptc_num,
+                                                   rc_index,
                                                    DEC_DIRECTION,
                                                    rr_nodes);
-            auto right_node_idx = create_chanx_wire(drive_x + 1,
-                                                    x_end,
+            auto right_node_idx = create_chanx_wire(instance.drive_x + 1,
+                                                    instance.x_end,
                                                     y,
                                                     ptc_num,
+                                                    rc_index,
                                                     INC_DIRECTION,
                                                     rr_nodes);
-            record_tap_locations(x_start + x_offset,
-                                 x_end,
+            record_tap_locations(instance.x_start,
+                                 instance.x_end,
                                  y,
                                  left_node_idx,
                                  right_node_idx,
@@ -265,6 +287,7 @@ int ClockRib::create_chanx_wire(int x_start,
                                 int x_end,
                                 int y,
                                 int ptc_num,
+                                short rc_index,
                                 e_direction direction,
                                 std::vector<t_rr_node>& rr_nodes) {
     rr_nodes.emplace_back();
@@ -274,7 +297,6 @@ int ClockRib::create_chanx_wire(int x_start,
     rr_nodes[node_index].set_type(CHANX);
     rr_nodes[node_index].set_capacity(1);
     rr_nodes[node_index].set_track_num(ptc_num);
-    auto rc_index = find_create_rr_rc_data(x_chan_wire.layer.r_metal, x_chan_wire.layer.c_metal);
     rr_nodes[node_index].set_rc_index(rc_index);
     rr_nodes[node_index].set_direction(direction);
 
@@ -431,72 +453,94 @@ void ClockSpine::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGrap
     VTR_ASSERT(repeat.y > 0);
     VTR_ASSERT(repeat.x > 0);
 
-    for (unsigned x = y_chan_wire.position; x < grid.width() - 1; x += repeat.x) {
-        for (unsigned y_start = y_chan_wire.start; y_start < grid.height() - 1; y_start += repeat.y) {
-            unsigned drive_y = y_start + drive.offset;
-            unsigned y_end = y_start + y_chan_wire.length;
-
-            // Adjust for boundry conditions
-            unsigned y_offset = 0;
-            if ((y_start == 0) ||              // CHANY wires bottom boundry, start above the LB
-                (y_start + repeat.y == y_end)) // Avoid overlap
-            {
-                y_offset = 1;
-            }
-            if (y_end > grid.height() - 2) {
-                y_end = grid.height() - 2; // CHANY wires top boundry, dont go above the LB
-            }
-
-            // Dont create spine if drive point is not reachable
-            if (drive_y > grid.width() - 2 || drive_y >= y_end || drive_y <= (y_start + y_offset)) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "A spine part of clock network '%s' was not"
-                                    " created becuase the drive point is not reachable. "
-                                    "This can lead to an unroutable architecture.\n",
-                                    clock_name_.c_str());
-                continue;
-            }
-
-            // Dont create spine if wire segment is too small
-            if ((y_start + y_offset) >= y_end) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "Spine start '%d' and end '%d' values are "
-                                    "not sucessive for clock network '%s' due to not meeting boundry conditions."
-                                    " This can lead to an unroutable architecture.\n",
-                                    (y_start + y_offset), y_end, clock_name_.c_str());
-                continue;
-            }
+    // The spine network is periodic: the boundary adjustments and validity
+    // checks depend only on y (the pattern just repeats at each x), so work
+    // out the pattern of valid instances along one column once and stamp it
+    // at every column. Warnings about dropped instances are likewise printed
+    // once per repeating position rather than once per column.
+    struct t_spine_instance {
+        unsigned y_start; // After boundary adjustment
+        unsigned drive_y;
+        unsigned y_end;
+    };
+    std::vector<t_spine_instance> column_pattern;
+
+    for (unsigned y_start = y_chan_wire.start; y_start < grid.height() - 1; y_start += repeat.y) {
+        unsigned drive_y = y_start + drive.offset;
+        unsigned y_end = y_start + y_chan_wire.length;
+
+        // Adjust for boundry conditions
+        unsigned y_offset = 0;
+        if ((y_start == 0) ||              // CHANY wires bottom boundry, start above the LB
+            (y_start + repeat.y == y_end)) // Avoid overlap
+        {
+            y_offset = 1;
+        }
+        if (y_end > grid.height() - 2) {
+            y_end = grid.height() - 2; // CHANY wires top boundry, dont go above the LB
+        }
 
+        // Dont create spine if drive point is not reachable
+        if (drive_y > grid.width() - 2 || drive_y >= y_end || drive_y <= (y_start + y_offset)) {
+            vtr::printf_warning(__FILE__, __LINE__,
+                                "A spine part of clock network '%s' was not"
+                                " created becuase the drive point is not reachable. "
+                                "This can lead to an unroutable architecture.\n",
+                                clock_name_.c_str());
+            continue;
+        }
+
+        // Dont create spine if wire segment is too small
+        if ((y_start + y_offset) >= y_end) {
+            vtr::printf_warning(__FILE__, __LINE__,
+                                "Spine start '%d' and end '%d' values are "
+                                "not sucessive for clock network '%s' due to not meeting boundry conditions."
+                                " This can lead to an unroutable architecture.\n",
+                                (y_start + y_offset), y_end, clock_name_.c_str());
+            continue;
+        }
+
+        column_pattern.push_back({y_start + y_offset, drive_y, y_end});
+    }
+
+    // Every wire in the network is on the same metal layer
+    short rc_index = find_create_rr_rc_data(y_chan_wire.layer.r_metal, y_chan_wire.layer.c_metal);
+
+    for (unsigned x = y_chan_wire.position; x < grid.width() - 1; x += repeat.x) {
+        for (const t_spine_instance& instance : column_pattern) {
             //create drive point (length zero wire)
-            auto drive_node_idx = create_chany_wire(drive_y,
-                                                    drive_y,
+            auto drive_node_idx = create_chany_wire(instance.drive_y,
+                                                    instance.drive_y,
                                                     x,
                                                     ptc_num,
+                                                    rc_index,
                                                     BI_DIRECTION,
                                                     rr_nodes,
                                                     num_segments);
-            clock_graph.add_switch_location(get_name(), drive.name, x, drive_y, drive_node_idx);
+            clock_graph.add_switch_location(get_name(), drive.name, x, instance.drive_y, drive_node_idx);
 
             // create spine wire above and below the drive point
-            auto left_node_idx = create_chany_wire(y_start + y_offset,
-                                                   drive_y - 1,
+            auto left_node_idx = create_chany_wire(instance.y_start,
+                                                   instance.drive_y - 1,
                                                    x,
                                                    ptc_num,
+                                                   rc_index,
                                                    DEC_DIRECTION,
                                                    rr_nodes,
                                                    num_segments);
-            auto right_node_idx = create_chany_wire(drive_y + 1,
-                                                    y_end,
+            auto right_node_idx = create_chany_wire(instance.drive_y + 1,
+                                                    instance.y_end,
                                                     x,
                                                     ptc_num,
+                                                    rc_index,
                                                     INC_DIRECTION,
                                                     rr_nodes,
                                                     num_segments);
 
             // Keep a record of the rr_node idx that we will use to connects switches to at
             // the tap point
-            record_tap_locations(y_start + y_offset,
-                                 y_end,
+            record_tap_locations(instance.y_start,
+                                 instance.y_end,
                                  x,
                                  left_node_idx,
                                  right_node_idx,
@@ -513,6 +557,7 @@ int ClockSpine::create_chany_wire(int y_start,
                                   int y_end,
                                   int x,
                                   int ptc_num,
+                                  short rc_index,
                                   e_direction direction,
                                   std::vector<t_rr_node>& rr_nodes,
                                   int num_segments) {
@@ -523,7 +568,6 @@ int ClockSpine::create_chany_wire(int y_start,
     rr_nodes[node_index].set_type(CHANY);
     rr_nodes[node_index].set_capacity(1);
     rr_nodes[node_index].set_track_num(ptc_num);
-    auto rc_index = find_create_rr_rc_data(y_chan_wire.layer.r_metal, y_chan_wire.layer.c_metal);
     rr_nodes[node_index].set_rc_index(rc_index);
     rr_nodes[node_index].set_direction(direction);
 
@@ -159,6 +159,7 @@ class ClockRib : public ClockNetwork {
                           int x_end,
                           int y,
                           int ptc_num,
+                          short rc_index,
                           e_direction direction,
                           std::vector<t_rr_node>& rr_nodes);
     void record_tap_locations(unsigned x_start,
@@ -215,6 +216,7 @@ class ClockSpine : public ClockNetwork {
                           int y_end,
                           int x,
                           int ptc_num,
+                          short rc_index,
                           e_direction direction,
                           std::vector<t_rr_node>& rr_nodes,
                           int num_segments);
@@ -23,12 +23,14 @@ class Connection_based_routing_resources {
     // a property of each net, but only valid after pruning the previous route tree
     // the "targets" in question can be either rr_node indices or pin indices, the
     // conversion from node to pin being performed by this class
-    std::vector<int> remaining_targets;
+    // thread local (along with the other per-net scratch below) so parallel
+    // router workers can each prepare and route their own net concurrently
+    static thread_local std::vector<int> remaining_targets;
 
     // contains rt_nodes representing sinks reached legally while pruning the route tree
     // used to populate rt_node_of_sink after building route tree from traceback
     // order does not matter
-    std::vector<t_rt_node*> reached_rt_sinks;
+    static thread_local std::vector<t_rt_node*> reached_rt_sinks;
 
   public:
     Connection_based_routing_resources();
@@ -67,8 +69,8 @@ class Connection_based_routing_resources {
     // determined after the first routing iteration when only optimizing for timing delay
     vtr::vector<ClusterNetId, std::vector<float>> lower_bound_connection_delay;
 
-    // the current net that's being routed
-    ClusterNetId current_inet;
+    // the current net that's being routed (by the calling thread)
+    static thread_local ClusterNetId current_inet;
 
     // the most recent stable critical path delay
     // compared against the current iteration's critical path delay
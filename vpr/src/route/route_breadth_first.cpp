@@ -16,8 +16,7 @@
 static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost);
 
 static void breadth_first_expand_trace_segment(t_trace* start_ptr,
-                                               int remaining_connections_to_sink,
-                                               std::vector<int>& modified_rr_node_inf);
+                                               int remaining_connections_to_sink);
 
 static void breadth_first_expand_neighbours(int inode, float pcost, ClusterNetId net_id, float bend_cost);
 
@@ -170,6 +169,12 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 
     free_traceback(net_id);
 
+    /* Start a fresh path search for this net: path costs stamped by previous
+     * nets are now treated as infinite.  The costs recorded while routing
+     * this net's sinks persist for the whole net, since the wavefront is
+     * expanded incrementally from sink to sink.                             */
+    reset_path_costs();
+
     breadth_first_add_source_to_heap(net_id);
     mark_ends(net_id);
 
@@ -178,11 +183,9 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 
     auto src_pin_id = cluster_ctx.clb_nlist.net_driver(net_id);
 
-    std::vector<int> modified_rr_node_inf; //RR node indicies with modified rr_node_route_inf
-
     for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) { /* Need n-1 wires to connect n pins */
 
-        breadth_first_expand_trace_segment(tptr, remaining_connections_to_sink, modified_rr_node_inf);
+        breadth_first_expand_trace_segment(tptr, remaining_connections_to_sink);
         current = get_heap_head();
 
         if (current == nullptr) { /* Infeasible routing.  No possible path for net. */
@@ -190,7 +193,6 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
                     size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str(),
                     cluster_ctx.clb_nlist.pin_name(src_pin_id).c_str(),
                     cluster_ctx.clb_nlist.pin_name(pin_id).c_str());
-            reset_path_costs(modified_rr_node_inf); /* Clean up before leaving. */
             return (false);
         }
 
@@ -201,7 +203,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 #endif
 
         while (route_ctx.rr_node_route_inf[inode].target_flag == 0) {
-            pcost = route_ctx.rr_node_route_inf[inode].path_cost;
+            pcost = get_rr_path_cost(inode);
             new_pcost = current->cost;
             if (pcost > new_pcost) { /* New path is lowest cost. */
 #ifdef ROUTER_DEBUG
@@ -211,9 +213,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 #ifdef ROUTER_DEBUG
                 VTR_LOG("    Setting routing paths for associated node %d\n", current->index);
 #endif
-                add_to_mod_list(current->index, modified_rr_node_inf);
-
-                route_ctx.rr_node_route_inf[current->index].path_cost = new_pcost;
+                set_rr_path_cost(current->index, new_pcost);
                 route_ctx.rr_node_route_inf[current->index].prev_node = current->u.prev.node;
                 route_ctx.rr_node_route_inf[current->index].prev_edge = current->u.prev.edge;
 
@@ -230,7 +230,6 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
                 VTR_LOG("Cannot route net #%zu (%s) from (%s) to sink pin (%s) -- no possible path.\n",
                         size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str(),
                         cluster_ctx.clb_nlist.pin_name(src_pin_id).c_str(), cluster_ctx.clb_nlist.pin_name(pin_id).c_str());
-                reset_path_costs(modified_rr_node_inf);
                 return (false);
             }
 
@@ -245,9 +244,7 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 #endif
         if (current != nullptr) {
             //Update link to target
-            add_to_mod_list(current->index, modified_rr_node_inf);
-
-            route_ctx.rr_node_route_inf[current->index].path_cost = current->cost;
+            set_rr_path_cost(current->index, current->cost);
             route_ctx.rr_node_route_inf[current->index].prev_node = current->u.prev.node;
             route_ctx.rr_node_route_inf[current->index].prev_edge = current->u.prev.edge;
         }
@@ -263,13 +260,11 @@ static bool breadth_first_route_net(ClusterNetId net_id, float bend_cost) {
 #endif
 
     empty_heap();
-    reset_path_costs(modified_rr_node_inf);
     return (true);
 }
 
 static void breadth_first_expand_trace_segment(t_trace* start_ptr,
-                                               int remaining_connections_to_sink,
-                                               std::vector<int>& modified_rr_node_inf) {
+                                               int remaining_connections_to_sink) {
     /* Adds all the rr_nodes in the traceback segment starting at tptr (and     *
      * continuing to the end of the traceback) to the heap with a cost of zero. *
      * This allows expansion to begin from the existing wiring.  The            *
@@ -290,7 +285,6 @@ static void breadth_first_expand_trace_segment(t_trace* start_ptr,
     int inode, sink_node, last_ipin_node;
 
     auto& device_ctx = g_vpr_ctx.device();
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     tptr = start_ptr;
     if (tptr != nullptr && device_ctx.rr_nodes[tptr->index].type() == SINK) {
@@ -345,15 +339,13 @@ static void breadth_first_expand_trace_segment(t_trace* start_ptr,
          * doglegs are allowed in the graph, we won't be able to use this IPIN to   *
          * do a dogleg, since it won't be re-expanded.  Shouldn't be a big problem. */
 
-        add_to_mod_list(last_ipin_node, modified_rr_node_inf);
-        route_ctx.rr_node_route_inf[last_ipin_node].path_cost = -HUGE_POSITIVE_FLOAT;
+        set_rr_path_cost(last_ipin_node, -HUGE_POSITIVE_FLOAT);
 
         /* Also need to mark the SINK as having high cost, so another connection can *
          * be made to it.                                                            */
 
         sink_node = tptr->index;
-        add_to_mod_list(sink_node, modified_rr_node_inf);
-        route_ctx.rr_node_route_inf[sink_node].path_cost = HUGE_POSITIVE_FLOAT;
+        set_rr_path_cost(sink_node, HUGE_POSITIVE_FLOAT);
 
         /* Finally, I need to remove any pending connections to this SINK via the    *
          * IPIN I just used (since they would result in congestion).  Scan through   *
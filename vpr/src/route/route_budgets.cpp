@@ -52,6 +52,10 @@
 #include "net_delay.h"
 #include "route_budgets.h"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/parallel_for_each.h>
+#endif
+
 #define SHORT_PATH_EXP 0.5
 
 route_budgets::route_budgets() {
@@ -171,7 +175,7 @@ void route_budgets::allocate_slack_using_weights(vtr::vector<ClusterNetId, float
 
     /*This allocates long path slack and increases the budgets*/
     while ((iteration > 3 && max_budget_change > 800e-12) || iteration <= 3) {
-        timing_info = perform_sta(delay_max_budget);
+        timing_info = perform_sta(delay_max_budget, SETUP);
         max_budget_change = minimax_PERT(timing_info, delay_max_budget, net_delay, netlist_pin_lookup, SETUP, true);
 
         iteration++;
@@ -187,7 +191,7 @@ void route_budgets::allocate_slack_using_weights(vtr::vector<ClusterNetId, float
 
     /*Allocate the short path slack to decrease the budgets accordingly*/
     while ((iteration > 3 && max_budget_change > 800e-12) || iteration <= 3) {
-        timing_info = perform_sta(delay_min_budget);
+        timing_info = perform_sta(delay_min_budget, HOLD);
         max_budget_change = minimax_PERT(timing_info, delay_min_budget, net_delay, netlist_pin_lookup, HOLD, true);
         iteration++;
 
@@ -206,7 +210,7 @@ void route_budgets::allocate_slack_using_weights(vtr::vector<ClusterNetId, float
         if (iteration != 0) {
             keep_budget_in_bounds(delay_min_budget);
         }
-        timing_info = perform_sta(delay_min_budget);
+        timing_info = perform_sta(delay_min_budget, HOLD);
         max_budget_change = minimax_PERT(timing_info, delay_min_budget, net_delay, netlist_pin_lookup, HOLD, false);
         iteration++;
     }
@@ -228,10 +232,10 @@ void route_budgets::process_negative_slack_using_minimax(vtr::vector<ClusterNetI
     float second_max_budget_change = 900e-12;
 
     while (iteration < 7 && max_budget_change > 5e-12) {
-        timing_info = perform_sta(delay_max_budget);
+        timing_info = perform_sta(delay_max_budget, HOLD);
         max_budget_change = minimax_PERT(timing_info, delay_max_budget, net_delay, netlist_pin_lookup, HOLD, true, NEGATIVE);
 
-        timing_info = perform_sta(delay_max_budget);
+        timing_info = perform_sta(delay_max_budget, SETUP);
         second_max_budget_change = minimax_PERT(timing_info, delay_max_budget, net_delay, netlist_pin_lookup, SETUP, true, NEGATIVE);
         max_budget_change = std::max(max_budget_change, second_max_budget_change);
 
@@ -301,13 +305,17 @@ float route_budgets::minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> timing_in
     auto& atom_ctx = g_vpr_ctx.atom();
 
     std::shared_ptr<const tatum::SetupHoldTimingAnalyzer> timing_analyzer = timing_info->setup_hold_analyzer();
-    float total_path_delay = 0;
-    float path_slack;
-    float max_budget_change = 0;
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+
+    /*Each net touches only its own budget row, so the nets can be processed in
+     * parallel; the largest budget change is tracked per net and reduced below*/
+    auto nets = cluster_ctx.clb_nlist.nets();
+    vtr::vector<ClusterNetId, float> net_max_budget_change(nets.size(), 0.);
+
+    auto process_net = [&](ClusterNetId net_id) {
         for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
             int ipin = cluster_ctx.clb_nlist.pin_net_index(pin_id);
             AtomPinId atom_pin;
+            float path_slack;
 
             /*calculate slack, save the pin that has min slack to calculate total path delay*/
             if (analysis_type == HOLD) {
@@ -317,7 +325,7 @@ float route_budgets::minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> timing_in
             }
 
             tatum::NodeId timing_node = atom_ctx.lookup.atom_pin_tnode(atom_pin);
-            total_path_delay = get_total_path_delay(timing_analyzer, analysis_type, timing_node);
+            float total_path_delay = get_total_path_delay(timing_analyzer, analysis_type, timing_node);
             if (total_path_delay == -1) {
                 /*Delay node is not valid, leave the budgets as is*/
                 continue;
@@ -331,7 +339,7 @@ float route_budgets::minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> timing_in
                 } else {
                     temp_budgets[net_id][ipin] += net_delay[net_id][ipin] * path_slack / total_path_delay;
                 }
-                max_budget_change = std::max(max_budget_change, std::abs(net_delay[net_id][ipin] * path_slack / total_path_delay));
+                net_max_budget_change[net_id] = std::max(net_max_budget_change[net_id], std::abs(net_delay[net_id][ipin] * path_slack / total_path_delay));
             }
 
             /*Budgets need to be between maximum and minimum budgets*/
@@ -339,6 +347,19 @@ float route_budgets::minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> timing_in
                 keep_budget_in_bounds(temp_budgets, net_id, pin_id);
             }
         }
+    };
+
+#if defined(VPR_USE_TBB)
+    tbb::parallel_for_each(nets.begin(), nets.end(), process_net);
+#else
+    for (auto net_id : nets) {
+        process_net(net_id);
+    }
+#endif
+
+    float max_budget_change = 0;
+    for (auto net_id : nets) {
+        max_budget_change = std::max(max_budget_change, net_max_budget_change[net_id]);
     }
     return max_budget_change;
 }
@@ -524,7 +545,7 @@ void route_budgets::check_if_budgets_in_bounds() {
     }
 }
 
-std::shared_ptr<SetupHoldTimingInfo> route_budgets::perform_sta(vtr::vector<ClusterNetId, float*>& temp_budgets) {
+std::shared_ptr<SetupHoldTimingInfo> route_budgets::perform_sta(vtr::vector<ClusterNetId, float*>& temp_budgets, analysis_type analysis_type) {
     auto& atom_ctx = g_vpr_ctx.atom();
     /*Perform static timing analysis to get the delay and path weights for slack allocation*/
     std::shared_ptr<RoutingDelayCalculator> routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, temp_budgets);
@@ -532,7 +553,15 @@ std::shared_ptr<SetupHoldTimingInfo> route_budgets::perform_sta(vtr::vector<Clus
     std::shared_ptr<SetupHoldTimingInfo> timing_info = make_setup_hold_timing_info(routing_delay_calc);
     /*Unconstrained nodes should be warned in the main routing function, do not report it here*/
     timing_info->set_warn_unconstrained(false);
-    timing_info->update();
+
+    /*Each budget allocation pass consumes only one analysis direction,
+     * so run just that analysis rather than a combined setup/hold update*/
+    if (analysis_type == HOLD) {
+        timing_info->update_hold();
+    } else {
+        VTR_ASSERT(analysis_type == SETUP);
+        timing_info->update_setup();
+    }
 
     return timing_info;
 }
@@ -66,8 +66,10 @@ class route_budgets {
     float minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> timing_info, vtr::vector<ClusterNetId, float*>& temp_budgets, vtr::vector<ClusterNetId, float*>& net_delay, const ClusteredPinAtomPinsLookup& netlist_pin_lookup, analysis_type analysis_type, bool keep_in_bounds, slack_allocated_type slack_type = BOTH);
     void process_negative_slack_using_minimax(vtr::vector<ClusterNetId, float*>& net_delay, const ClusteredPinAtomPinsLookup& netlist_pin_lookup);
 
-    /*Perform static timing analysis*/
-    std::shared_ptr<SetupHoldTimingInfo> perform_sta(vtr::vector<ClusterNetId, float*>& temp_budgets);
+    /*Perform static timing analysis for the specified analysis direction.
+     * Only the requested analysis (setup or hold) is run, since each slack
+     * allocation pass consumes only one direction's results*/
+    std::shared_ptr<SetupHoldTimingInfo> perform_sta(vtr::vector<ClusterNetId, float*>& temp_budgets, analysis_type analysis_type);
 
     /*checks*/
     void keep_budget_in_bounds(vtr::vector<ClusterNetId, float*>& temp_budgets);
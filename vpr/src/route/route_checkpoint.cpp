@@ -0,0 +1,178 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+#include "vpr_types.h"
+#include "vpr_error.h"
+#include "globals.h"
+#include "route_common.h"
+#include "check_route.h"
+#include "route_checkpoint.h"
+
+/* A checkpoint is a flat little-endian binary file:
+ *
+ *   magic[8] version          (format identification)
+ *   num_rr_nodes num_nets     (sanity check against the loaded architecture/netlist)
+ *   itry pres_fac             (Pathfinder iteration state)
+ *   acc_cost[num_rr_nodes]    (accumulated congestion cost of every RR node)
+ *   per net: is_routed is_fixed num_trace {index iswitch}*
+ *
+ * Occupancies and present-cost factors are not stored; they are recomputed
+ * from the tracebacks on restore (cf. read_route.cpp which does the same for
+ * .route files). */
+
+constexpr char CHECKPOINT_MAGIC[8] = {'V', 'P', 'R', 'C', 'K', 'P', 'T', '\0'};
+constexpr uint32_t CHECKPOINT_VERSION = 1;
+
+template<typename T>
+static void checkpoint_write(std::ofstream& os, const T& val) {
+    os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template<typename T>
+static T checkpoint_read(std::ifstream& is, const char* filename) {
+    T val;
+    is.read(reinterpret_cast<char*>(&val), sizeof(T));
+    if (!is) {
+        vpr_throw(VPR_ERROR_ROUTE, filename, 0,
+                  "Routing checkpoint file is truncated or corrupt");
+    }
+    return val;
+}
+
+void write_route_checkpoint(const char* filename, int itry, float pres_fac) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    //Write to a temporary file and rename it into place, so a job killed
+    //mid-write does not destroy the previous (complete) checkpoint
+    std::string tmp_filename = std::string(filename) + ".tmp";
+
+    std::ofstream os(tmp_filename, std::ofstream::binary);
+    if (!os) {
+        vpr_throw(VPR_ERROR_ROUTE, tmp_filename.c_str(), 0,
+                  "Cannot open routing checkpoint file for writing");
+    }
+
+    os.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    checkpoint_write<uint32_t>(os, CHECKPOINT_VERSION);
+
+    checkpoint_write<uint64_t>(os, device_ctx.rr_nodes.size());
+    checkpoint_write<uint64_t>(os, cluster_ctx.clb_nlist.nets().size());
+
+    checkpoint_write<int32_t>(os, itry);
+    checkpoint_write<float>(os, pres_fac);
+
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); ++inode) {
+        checkpoint_write<float>(os, route_ctx.rr_node_route_inf[inode].acc_cost);
+    }
+
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        checkpoint_write<uint8_t>(os, route_ctx.net_status[net_id].is_routed);
+        checkpoint_write<uint8_t>(os, route_ctx.net_status[net_id].is_fixed);
+
+        uint64_t num_trace = 0;
+        for (const t_trace* tptr = route_ctx.trace[net_id].head; tptr; tptr = tptr->next) {
+            ++num_trace;
+        }
+        checkpoint_write<uint64_t>(os, num_trace);
+
+        for (const t_trace* tptr = route_ctx.trace[net_id].head; tptr; tptr = tptr->next) {
+            checkpoint_write<int32_t>(os, tptr->index);
+            checkpoint_write<int32_t>(os, tptr->iswitch);
+        }
+    }
+
+    os.close();
+    if (!os) {
+        vpr_throw(VPR_ERROR_ROUTE, tmp_filename.c_str(), 0,
+                  "Failed to write routing checkpoint file");
+    }
+
+    if (std::rename(tmp_filename.c_str(), filename) != 0) {
+        vpr_throw(VPR_ERROR_ROUTE, filename, 0,
+                  "Failed to move completed routing checkpoint into place");
+    }
+}
+
+bool read_route_checkpoint(const char* filename, int* itry, float* pres_fac) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    std::ifstream is(filename, std::ifstream::binary);
+    if (!is) {
+        return false; //No checkpoint to resume from
+    }
+
+    VTR_LOG("Resuming routing from checkpoint '%s'.\n", filename);
+
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    is.read(magic, sizeof(magic));
+    if (!is || memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0) {
+        vpr_throw(VPR_ERROR_ROUTE, filename, 0,
+                  "File is not a VPR routing checkpoint");
+    }
+
+    uint32_t version = checkpoint_read<uint32_t>(is, filename);
+    if (version != CHECKPOINT_VERSION) {
+        vpr_throw(VPR_ERROR_ROUTE, filename, 0,
+                  "Unsupported routing checkpoint version %u (expected %u)",
+                  version, CHECKPOINT_VERSION);
+    }
+
+    uint64_t num_rr_nodes = checkpoint_read<uint64_t>(is, filename);
+    uint64_t num_nets = checkpoint_read<uint64_t>(is, filename);
+    if (num_rr_nodes != device_ctx.rr_nodes.size()
+        || num_nets != cluster_ctx.clb_nlist.nets().size()) {
+        vpr_throw(VPR_ERROR_ROUTE, filename, 0,
+                  "Routing checkpoint does not match the current netlist/RR graph"
+                  " (checkpoint: %zu RR nodes, %zu nets; current: %zu RR nodes, %zu nets)",
+                  size_t(num_rr_nodes), size_t(num_nets),
+                  device_ctx.rr_nodes.size(), cluster_ctx.clb_nlist.nets().size());
+    }
+
+    *itry = checkpoint_read<int32_t>(is, filename);
+    *pres_fac = checkpoint_read<float>(is, filename);
+
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); ++inode) {
+        route_ctx.rr_node_route_inf[inode].acc_cost = checkpoint_read<float>(is, filename);
+    }
+
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        route_ctx.net_status[net_id].is_routed = checkpoint_read<uint8_t>(is, filename);
+        route_ctx.net_status[net_id].is_fixed = checkpoint_read<uint8_t>(is, filename);
+
+        free_traceback(net_id);
+
+        uint64_t num_trace = checkpoint_read<uint64_t>(is, filename);
+
+        for (uint64_t i = 0; i < num_trace; ++i) {
+            int32_t index = checkpoint_read<int32_t>(is, filename);
+            int32_t iswitch = checkpoint_read<int32_t>(is, filename);
+
+            if (index < 0 || size_t(index) >= device_ctx.rr_nodes.size()) {
+                vpr_throw(VPR_ERROR_ROUTE, filename, 0,
+                          "Routing checkpoint references invalid RR node %d", index);
+            }
+
+            route_ctx.trace[net_id].append(index, iswitch);
+
+            route_ctx.trace_nodes[net_id].insert(index);
+        }
+    }
+
+    //Rebuild the state derivable from the tracebacks: occupancies, and the
+    //present congestion costs for the restored pres_fac (acc_fac of 0 leaves
+    //the restored acc_cost values untouched)
+    recompute_occupancy_from_scratch();
+    pathfinder_update_cost(*pres_fac, 0.);
+
+    return true;
+}
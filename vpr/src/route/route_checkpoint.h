@@ -0,0 +1,27 @@
+#ifndef VPR_ROUTE_CHECKPOINT_H
+#define VPR_ROUTE_CHECKPOINT_H
+#include "vpr_types.h"
+
+/******************* Binary routing checkpoints **********************/
+// Unlike the textual .route format (which only describes a finished routing),
+// a checkpoint captures the router's mid-Pathfinder state -- the tracebacks of
+// all nets, the accumulated congestion costs (acc_cost) and the iteration
+// number/present-cost factor -- so a killed routing job can be resumed with
+// --route_resume instead of restarting from scratch.
+//
+// Checkpoints are written atomically (to a temporary file which is then
+// renamed), so a job killed mid-write leaves the previous checkpoint intact.
+
+//Writes the current routing state to filename after routing iteration itry,
+//where pres_fac is the present-cost factor for the *next* iteration.
+void write_route_checkpoint(const char* filename, int itry, float pres_fac);
+
+//Restores the routing state saved by write_route_checkpoint().
+//
+//On success returns true and sets itry/pres_fac to the saved values.
+//Returns false if filename does not exist (i.e. there is nothing to resume
+//from); errors out if the checkpoint does not match the current netlist and
+//RR graph.
+bool read_route_checkpoint(const char* filename, int* itry, float* pres_fac);
+
+#endif
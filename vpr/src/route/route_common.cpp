@@ -2,14 +2,18 @@
 #include <ctime>
 #include <cmath>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include <iostream>
+#include <sstream>
 
 #include "vtr_assert.h"
 #include "vtr_util.h"
 #include "vtr_log.h"
 #include "vtr_digest.h"
 #include "vtr_memory.h"
+#include "vtr_async_write.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -36,30 +40,28 @@
 #include "timing_info.h"
 #include "tatum/echo_writer.hpp"
 
-/**************** Types local to route_common.c ******************/
-struct t_trace_branch {
-    t_trace* head;
-    t_trace* tail;
-};
-
 /**************** Static variables local to route_common.c ******************/
 
-static t_heap** heap; /* Indexed from [1..heap_size] */
-static int heap_size; /* Number of slots in the heap array */
-static int heap_tail; /* Index of first unused slot in the heap array */
+/* The heap and its free list are thread local so that the parallel
+ * router (see --router_num_workers) can route nets from spatially disjoint
+ * regions concurrently, each worker expanding into its own heap. In the
+ * serial router only the main thread's instances are ever touched.         */
+static thread_local t_heap** heap = nullptr; /* Indexed from [1..heap_size] */
+static thread_local int heap_size = 0;       /* Number of slots in the heap array */
+static thread_local int heap_tail = 0;       /* Index of first unused slot in the heap array */
+
+/* Number of children per heap node (2 = binary, 4 = 4-ary). A higher arity
+ * shortens the heap and keeps sibling comparisons within one or two cache
+ * lines, which reduces the L2 misses seen in get_heap_head on large designs.
+ * Selected via --router_heap (see set_router_heap_type).                    */
+static size_t heap_arity = 2;
 
 /* For managing my own list of currently free heap data structures.     */
-static t_heap* heap_free_head = nullptr;
+static thread_local t_heap* heap_free_head = nullptr;
 /* For keeping track of the sudo malloc memory for the heap*/
-static vtr::t_chunk heap_ch;
-
-/* For managing my own list of currently free trace data structures.    */
-static t_trace* trace_free_head = nullptr;
-/* For keeping track of the sudo malloc memory for the trace*/
-static vtr::t_chunk trace_ch;
+static thread_local vtr::t_chunk heap_ch;
 
-static int num_trace_allocated = 0; /* To watch for memory leaks. */
-static int num_heap_allocated = 0;
+static thread_local int num_heap_allocated = 0;
 static int num_linked_f_pointer_allocated = 0;
 
 /*  The numbering relation between the channels and clbs is:				*
@@ -92,9 +94,8 @@ static int num_linked_f_pointer_allocated = 0;
  *                                                                          */
 
 /******************** Subroutines local to route_common.c *******************/
-static t_trace_branch traceback_branch(int node, std::unordered_set<int>& main_branch_visited);
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable(t_trace* head, t_trace* tail, int node, std::unordered_set<int>& visited);
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(int node, std::unordered_set<int>& visited, int depth = 0);
+static void traceback_branch(std::vector<t_trace>& branch, int node, std::unordered_set<int>& main_branch_visited);
+static void add_trace_non_configurable(std::vector<t_trace>& branch, int node, std::unordered_set<int>& visited, int depth = 0);
 
 static vtr::vector<ClusterNetId, std::vector<int>> load_net_rr_terminals(const t_rr_node_indices& L_rr_node_indices);
 static vtr::vector<ClusterBlockId, std::vector<int>> load_rr_clb_sources(const t_rr_node_indices& L_rr_node_indices);
@@ -108,39 +109,22 @@ static float get_single_rr_cong_cost(int inode);
 
 /************************** Subroutine definitions ***************************/
 
-void save_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
+void save_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing,
                   const t_clb_opins_used& clb_opins_used_locally,
                   t_clb_opins_used& saved_clb_opins_used_locally) {
-    /* This routing frees any routing currently held in best routing,       *
-     * then copies over the current routing (held in route_ctx.trace), and       *
-     * finally sets route_ctx.trace_head and route_ctx.trace_tail to all NULLs so that the      *
-     * connection to the saved routing is broken.  This is necessary so     *
-     * that the next iteration of the router does not free the saved        *
-     * routing elements.  Also saves any data about locally used clb_opins, *
-     * since this is also part of the routing.                              */
-
-    t_trace *tptr, *tempptr;
+    /* This routine discards any routing currently held in best_routing,    *
+     * then moves the current routing (held in route_ctx.trace) into it,    *
+     * leaving the current routing empty so that the next iteration of the  *
+     * router starts from scratch.  Also saves any data about locally used  *
+     * clb_opins, since this is also part of the routing.                   */
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        /* Free any previously saved routing.  It is no longer best. */
-        tptr = best_routing[net_id];
-        while (tptr != nullptr) {
-            tempptr = tptr->next;
-            free_trace_data(tptr);
-            tptr = tempptr;
-        }
-
-        /* Save a pointer to the current routing in best_routing. */
-        best_routing[net_id] = route_ctx.trace[net_id].head;
+        /* Move the current routing into best_routing (freeing whatever it held). */
+        best_routing[net_id] = std::move(route_ctx.trace[net_id]);
 
-        /* Set the current (working) routing to NULL so the current trace       *
-         * elements won't be reused by the memory allocator.                    */
-
-        route_ctx.trace[net_id].head = nullptr;
-        route_ctx.trace[net_id].tail = nullptr;
         route_ctx.trace_nodes[net_id].clear();
     }
 
@@ -148,13 +132,11 @@ void save_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
     saved_clb_opins_used_locally = clb_opins_used_locally;
 }
 
-/* Deallocates any current routing in route_ctx.trace_head, and replaces it with    *
- * the routing in best_routing.  Best_routing is set to NULL to show that *
- * it no longer points to a valid routing.  NOTE:  route_ctx.trace_tail is not      *
- * restored -- it is set to all NULLs since it is only used in            *
- * update_traceback.  If you need route_ctx.trace_tail restored, modify this        *
- * routine.  Also restores the locally used opin data.                    */
-void restore_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
+/* Deallocates any current routing in route_ctx.trace, and replaces it    *
+ * with the routing in best_routing.  Best_routing is left empty to show  *
+ * that it no longer holds a valid routing.  Also restores the locally    *
+ * used opin data.                                                        */
+void restore_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing,
                      t_clb_opins_used& clb_opins_used_locally,
                      const t_clb_opins_used& saved_clb_opins_used_locally) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -166,9 +148,8 @@ void restore_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
         free_traceback(net_id);
 
         /* Set the current routing to the saved one. */
-        route_ctx.trace[net_id].head = best_routing[net_id];
+        route_ctx.trace[net_id] = std::move(best_routing[net_id]);
         pathfinder_update_path_cost(route_ctx.trace[net_id].head, 1, 0.f);
-        best_routing[net_id] = nullptr; /* No stored routing. */
     }
 
     /* Restore which OPINs are locally used.                           */
@@ -238,6 +219,7 @@ void try_graph(int width_fac, const t_router_opts& router_opts, t_det_routing_ar
                     router_opts.trim_obs_channels,
                     router_opts.clock_modeling,
                     directs, num_directs,
+                    router_opts.router_num_workers,
                     &warning_count);
 }
 
@@ -288,6 +270,7 @@ bool try_route(int width_fac,
                     router_opts.trim_obs_channels,
                     router_opts.clock_modeling,
                     directs, num_directs,
+                    router_opts.router_num_workers,
                     &warning_count);
 
     //Initialize drawing, now that we have an RR graph
@@ -298,6 +281,7 @@ bool try_route(int width_fac,
     /* Allocate and load additional rr_graph information needed only by the router. */
     alloc_and_load_rr_node_route_structs();
 
+    set_router_heap_type(router_opts.router_heap);
     init_route_structs(router_opts.bb_factor);
 
     if (cluster_ctx.clb_nlist.nets().empty()) {
@@ -311,7 +295,12 @@ bool try_route(int width_fac,
         VTR_LOG("Confirming router algorithm: TIMING_DRIVEN.\n");
 
         IntraLbPbPinLookup intra_lb_pb_pin_lookup(device_ctx.logical_block_types);
-        ClusteredPinAtomPinsLookup netlist_pin_lookup(cluster_ctx.clb_nlist, intra_lb_pb_pin_lookup);
+
+        //Building the cluster pin <-> atom pin lookup is expensive, so re-use
+        //it across routing attempts (e.g. a binary search over channel width)
+        //for the same netlist
+        static ClusteredPinAtomPinsLookup netlist_pin_lookup;
+        netlist_pin_lookup.ensure_built(cluster_ctx.clb_nlist, intra_lb_pb_pin_lookup);
 
         success = try_timing_driven_route(router_opts,
                                           analysis_opts,
@@ -414,6 +403,53 @@ void pathfinder_update_path_cost(t_trace* route_segment_start,
     } /* End while loop -- did an entire traceback. */
 }
 
+/* Index of nodes that have become congested (occ >= capacity) at some point
+ * since the last reset, so the end-of-iteration cost update only touches
+ * those instead of scanning every rr node. The per-node flag avoids duplicate
+ * entries; the mutex protects the list itself, since during parallel routing
+ * workers touch disjoint rr nodes (so each flag has a single writer) but
+ * share the list. */
+static std::vector<int> congested_nodes;
+static std::vector<char> node_in_congested_index;
+static std::mutex congested_nodes_mutex;
+
+/* Epoch stamps used to invalidate rr_node_route_inf path costs in O(1).
+ * Each connection search draws a fresh epoch from the shared counter and
+ * stamps every entry it writes; entries stamped with any other epoch are
+ * treated as having infinite path costs. The counter is shared so that
+ * concurrent searches (which touch disjoint rr nodes within a routing
+ * iteration) never hand out the same epoch twice, while each worker's
+ * current epoch is thread local. */
+static std::atomic<uint32_t> path_search_epoch_counter{0};
+static thread_local uint32_t path_search_epoch = 0;
+
+static void add_to_congested_node_index(int inode) {
+    if (!node_in_congested_index[inode]) {
+        node_in_congested_index[inode] = true;
+
+        std::lock_guard<std::mutex> lock(congested_nodes_mutex);
+        congested_nodes.push_back(inode);
+    }
+}
+
+void rebuild_congested_node_index() {
+    /* Rebuilds the congested-node index with a full scan. Needed after
+     * occupancies have been set outside the pathfinder update routines
+     * (e.g. recompute_occupancy_from_scratch).                              */
+
+    auto& route_ctx = g_vpr_ctx.routing();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    congested_nodes.clear();
+    node_in_congested_index.assign(device_ctx.rr_nodes.size(), false);
+
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        if (route_ctx.rr_node_route_inf[inode].occ() >= device_ctx.rr_nodes[inode].capacity()) {
+            add_to_congested_node_index(inode);
+        }
+    }
+}
+
 void pathfinder_update_single_node_cost(int inode, int add_or_sub, float pres_fac) {
     /* Updates pathfinder's congestion cost by either adding or removing the
      * usage of a resource node. pres_cost is Pn in the Pathfinder paper.
@@ -433,6 +469,7 @@ void pathfinder_update_single_node_cost(int inode, int add_or_sub, float pres_fa
         route_ctx.rr_node_route_inf[inode].pres_cost = 1.0;
     } else {
         route_ctx.rr_node_route_inf[inode].pres_cost = 1.0 + (occ + 1 - capacity) * pres_fac;
+        add_to_congested_node_index(inode);
     }
 }
 
@@ -443,13 +480,19 @@ void pathfinder_update_cost(float pres_fac, float acc_fac) {
      * signals sharing a resource right now (i.e. after each complete iteration) *
      * times acc_fac.  It also updates pres_cost, since pres_fac may have        *
      * changed.  THIS ROUTINE ASSUMES THE OCCUPANCY VALUES IN RR_NODE ARE UP TO  *
-     * DATE.                                                                     */
+     * DATE.                                                                     *
+     * Only nodes in the congested-node index can satisfy occ >= capacity        *
+     * (occupancy only changes through the pathfinder update routines), so only  *
+     * they are visited; nodes no longer congested already had their pres_cost   *
+     * reset to 1.0 and are dropped from the index.                              */
 
     int occ, capacity;
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+    size_t still_congested = 0;
+    for (size_t i = 0; i < congested_nodes.size(); i++) {
+        int inode = congested_nodes[i];
         occ = route_ctx.rr_node_route_inf[inode].occ();
         capacity = device_ctx.rr_nodes[inode].capacity();
 
@@ -464,7 +507,14 @@ void pathfinder_update_cost(float pres_fac, float acc_fac) {
         else if (occ == capacity) {
             route_ctx.rr_node_route_inf[inode].pres_cost = 1.0 + pres_fac;
         }
+
+        if (occ >= capacity) {
+            congested_nodes[still_congested++] = inode;
+        } else {
+            node_in_congested_index[inode] = false;
+        }
     }
+    congested_nodes.resize(still_congested);
 }
 
 void init_heap(const DeviceGrid& grid) {
@@ -478,6 +528,19 @@ void init_heap(const DeviceGrid& grid) {
     heap_tail = 1;
 }
 
+void set_router_heap_type(e_heap_type heap_type) {
+    /* Must not be changed while elements are on the heap, since the sift
+     * routines would disagree with the invariant the elements were added under. */
+    VTR_ASSERT(heap == nullptr || heap_tail == 1);
+
+    if (heap_type == e_heap_type::FOUR_ARY_HEAP) {
+        heap_arity = 4;
+    } else {
+        VTR_ASSERT(heap_type == e_heap_type::BINARY_HEAP);
+        heap_arity = 2;
+    }
+}
+
 /* Call this before you route any nets.  It frees any old traceback and   *
  * sets the list of rr_nodes touched to empty.                            */
 void init_route_structs(int bb_factor) {
@@ -514,8 +577,8 @@ void init_route_structs(int bb_factor) {
 t_trace*
 update_traceback(t_heap* hptr, ClusterNetId net_id) {
     /* This routine adds the most recently finished wire segment to the         *
-     * traceback linked list.  The first connection starts with the net SOURCE  *
-     * and begins at the structure pointed to by route_ctx.trace[net_id].head. Each         *
+     * traceback.  The first connection starts with the net SOURCE and begins   *
+     * at the structure pointed to by route_ctx.trace[net_id].head. Each        *
      * connection ends with a SINK.  After each SINK, the next connection       *
      * begins (if the net has more than 2 pins).  The first element after the   *
      * SINK gives the routing node on a previous piece of the routing, which is *
@@ -524,33 +587,38 @@ update_traceback(t_heap* hptr, ClusterNetId net_id) {
      * its predecessors to the beginning.  I have stored information on the     *
      * predecesser of each node to make traceback easy -- this sacrificies some *
      * memory for easier code maintenance.  This routine returns a pointer to   *
-     * the first "new" node in the traceback (node not previously in trace).    */
+     * the first "new" node in the traceback (node not previously in trace);    *
+     * the pointer is only valid until the traceback is next modified.          */
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     auto& trace_nodes = route_ctx.trace_nodes[net_id];
+    auto& traceback = route_ctx.trace[net_id];
 
-    VTR_ASSERT_SAFE(validate_trace_nodes(route_ctx.trace[net_id].head, trace_nodes));
+    VTR_ASSERT_SAFE(validate_trace_nodes(traceback.head, trace_nodes));
 
-    t_trace_branch branch = traceback_branch(hptr->index, trace_nodes);
+    //Scratch for the new branch; thread local since the parallel router's
+    //workers each build tracebacks for their own nets
+    static thread_local std::vector<t_trace> branch;
+    branch.clear();
+    traceback_branch(branch, hptr->index, trace_nodes);
 
-    VTR_ASSERT_SAFE(validate_trace_nodes(branch.head, trace_nodes));
+    //If this was not the first "chunk" of the net's routing the branch starts
+    //with the routing node on a previous piece of the routing, so the first
+    //new element follows it
+    size_t first_new_idx = traceback.size() + (traceback.empty() ? 0 : 1);
 
-    t_trace* ret_ptr = nullptr;
-    if (route_ctx.trace[net_id].tail != nullptr) {
-        route_ctx.trace[net_id].tail->next = branch.head; /* Traceback ends with tptr */
-        ret_ptr = branch.head->next;                      /* First new segment.       */
-    } else {                                              /* This was the first "chunk" of the net's routing */
-        route_ctx.trace[net_id].head = branch.head;
-        ret_ptr = branch.head; /* Whole traceback is new. */
+    for (const t_trace& elem : branch) {
+        traceback.append(elem.index, elem.iswitch);
     }
 
-    route_ctx.trace[net_id].tail = branch.tail;
-    return (ret_ptr);
+    VTR_ASSERT_SAFE(validate_trace_nodes(traceback.head, trace_nodes));
+
+    return &traceback.elements[first_new_idx];
 }
 
-//Traces back a new routing branch starting from the specified 'node' and working backwards to any existing routing.
-//Returns the new branch, and also updates trace_nodes for any new nodes which are included in the branches traceback.
-static t_trace_branch traceback_branch(int node, std::unordered_set<int>& trace_nodes) {
+//Appends a new routing branch, starting from the specified 'node' and working backwards to any existing routing,
+//to 'branch' (in traversal order). Also updates trace_nodes for any new nodes which are included in the branch.
+static void traceback_branch(std::vector<t_trace>& branch, int node, std::unordered_set<int>& trace_nodes) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.routing();
 
@@ -560,13 +628,12 @@ static t_trace_branch traceback_branch(int node, std::unordered_set<int>& trace_
                         "in traceback_branch: Expected type = SINK (%d).\n");
     }
 
-    //We construct the main traceback by walking from the given node back to the source,
-    //according to the previous edges/nodes recorded in rr_node_route_inf by the router.
-    t_trace* branch_head = alloc_trace_data();
-    t_trace* branch_tail = branch_head;
-    branch_head->index = node;
-    branch_head->iswitch = OPEN;
-    branch_head->next = nullptr;
+    //We construct the main branch by walking from the given node back to the source,
+    //according to the previous edges/nodes recorded in rr_node_route_inf by the router,
+    //and then reversing it into traversal order.
+    size_t branch_start = branch.size();
+
+    branch.push_back({nullptr, node, OPEN});
 
     trace_nodes.insert(node);
 
@@ -576,12 +643,8 @@ static t_trace_branch traceback_branch(int node, std::unordered_set<int>& trace_
     int inode = route_ctx.rr_node_route_inf[node].prev_node;
 
     while (inode != NO_PREVIOUS) {
-        //Add the current node to the head of traceback
-        t_trace* prev_ptr = alloc_trace_data();
-        prev_ptr->index = inode;
-        prev_ptr->iswitch = device_ctx.rr_nodes[inode].edge_switch(iedge);
-        prev_ptr->next = branch_head;
-        branch_head = prev_ptr;
+        //Add the current node to the branch
+        branch.push_back({nullptr, inode, static_cast<short>(device_ctx.rr_nodes[inode].edge_switch(iedge))});
 
         if (trace_nodes.count(inode)) {
             break; //Connected to existing routing
@@ -594,48 +657,21 @@ static t_trace_branch traceback_branch(int node, std::unordered_set<int>& trace_
         inode = route_ctx.rr_node_route_inf[inode].prev_node;
     }
 
+    std::reverse(branch.begin() + branch_start, branch.end());
+
     //We next re-expand all the main-branch nodes to add any non-configurably connected side branches
     // We are careful to do this *after* the main branch is constructed to ensure nodes which are both
     // non-configurably connected *and* part of the main branch are only added to the traceback once.
     for (int new_node : new_nodes_added_to_traceback) {
         //Expand each main branch node
-        std::tie(branch_head, branch_tail) = add_trace_non_configurable(branch_head, branch_tail, new_node, trace_nodes);
+        add_trace_non_configurable(branch, new_node, trace_nodes);
     }
-
-    return {branch_head, branch_tail};
 }
 
-//Traces any non-configurable subtrees from branch_head, returning the new branch_head and updating trace_nodes
+//Appends any non-configurable subtrees reachable from 'node' to 'branch', updating trace_nodes
 //
 //This effectively does a depth-first traversal
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable(t_trace* head, t_trace* tail, int node, std::unordered_set<int>& trace_nodes) {
-    //Trace any non-configurable subtrees
-    t_trace* subtree_head = nullptr;
-    t_trace* subtree_tail = nullptr;
-    std::tie(subtree_head, subtree_tail) = add_trace_non_configurable_recurr(node, trace_nodes);
-
-    //Add any non-empty subtree to tail of traceback
-    if (subtree_head && subtree_tail) {
-        if (!head) { //First subtree becomes head
-            head = subtree_head;
-        } else { //Later subtrees added to tail
-            VTR_ASSERT(tail);
-            tail->next = subtree_head;
-        }
-
-        tail = subtree_tail;
-    } else {
-        VTR_ASSERT(subtree_head == nullptr && subtree_tail == nullptr);
-    }
-
-    return {head, tail};
-}
-
-//Recursive helper function for add_trace_non_configurable()
-static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(int node, std::unordered_set<int>& trace_nodes, int depth) {
-    t_trace* head = nullptr;
-    t_trace* tail = nullptr;
-
+static void add_trace_non_configurable(std::vector<t_trace>& branch, int node, std::unordered_set<int>& trace_nodes, int depth) {
     //Record the non-configurable out-going edges
     std::vector<t_edge_size> unvisited_non_configurable_edges;
     auto& device_ctx = g_vpr_ctx.device();
@@ -653,11 +689,7 @@ static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(int node,
         //Base case: leaf node with no non-configurable edges
         if (depth > 0) { //Arrived via non-configurable edge
             VTR_ASSERT(!trace_nodes.count(node));
-            head = alloc_trace_data();
-            head->index = node;
-            head->iswitch = -1;
-            head->next = nullptr;
-            tail = head;
+            branch.push_back({nullptr, node, -1});
 
             trace_nodes.insert(node);
         }
@@ -671,50 +703,81 @@ static std::pair<t_trace*, t_trace*> add_trace_non_configurable_recurr(int node,
             VTR_ASSERT(!trace_nodes.count(to_node));
             trace_nodes.insert(node);
 
+            //Duplicate the original node as the start of the new sub-branch
+            size_t intermediate_idx = branch.size();
+            branch.push_back({nullptr, node, static_cast<short>(iswitch)});
+
             //Recurse
-            t_trace* subtree_head = nullptr;
-            t_trace* subtree_tail = nullptr;
-            std::tie(subtree_head, subtree_tail) = add_trace_non_configurable_recurr(to_node, trace_nodes, depth + 1);
-
-            if (subtree_head && subtree_tail) {
-                //Add the non-empty sub-tree
-
-                //Duplicate the original head as the new tail (for the new branch)
-                t_trace* intermediate_head = alloc_trace_data();
-                intermediate_head->index = node;
-                intermediate_head->iswitch = iswitch;
-                intermediate_head->next = nullptr;
-
-                intermediate_head->next = subtree_head;
-
-                if (!head) { //First subtree becomes head
-                    head = intermediate_head;
-                } else { //Later subtrees added to tail
-                    VTR_ASSERT(tail);
-                    tail->next = intermediate_head;
-                }
+            add_trace_non_configurable(branch, to_node, trace_nodes, depth + 1);
 
-                tail = subtree_tail;
-            } else {
-                VTR_ASSERT(subtree_head == nullptr && subtree_tail == nullptr);
+            if (branch.size() == intermediate_idx + 1) {
+                branch.pop_back(); //Sub-tree was empty, drop the duplicated node
             }
         }
     }
+}
 
-    return {head, tail};
+/* Logically resets the path costs of *all* rr nodes to infinity by advancing
+ * this thread's path search epoch: any path cost stamped with an older epoch
+ * is treated as infinite by get_rr_path_cost()/get_rr_backward_path_cost().
+ * This makes starting a new connection search O(1), rather than requiring
+ * every entry touched by the previous search to be rewritten.               */
+void reset_path_costs() {
+    uint32_t epoch = path_search_epoch_counter.fetch_add(1) + 1;
+    if (epoch == 0) {
+        /* The counter wrapped; skip epoch 0 since it is the stamp freshly
+         * initialized entries carry (reset_rr_node_route_structs() restores
+         * the full 2^32 epochs of headroom between routing attempts). */
+        epoch = path_search_epoch_counter.fetch_add(1) + 1;
+    }
+    path_search_epoch = epoch;
 }
 
-/* The routine sets the path_cost to HUGE_POSITIVE_FLOAT for  *
- * all channel segments touched by previous routing phases.    */
-void reset_path_costs(const std::vector<int>& visited_rr_nodes) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+/* Returns the calling thread's current path search epoch: the stamp carried
+ * by every rr_node_route_inf entry this thread has written since its last
+ * reset_path_costs() call. Epochs are globally unique across threads, so an
+ * entry whose stamp matches was last written by this thread's search.       */
+uint32_t get_path_search_epoch() {
+    return path_search_epoch;
+}
+
+/* Returns the path_cost of inode, or infinity if it was last written during
+ * an earlier path search (i.e. before the last reset_path_costs() call).    */
+float get_rr_path_cost(int inode) {
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    if (route_ctx.rr_node_route_inf[inode].path_search_epoch != path_search_epoch) {
+        return std::numeric_limits<float>::infinity();
+    }
+    return route_ctx.rr_node_route_inf[inode].path_cost;
+}
+
+/* As get_rr_path_cost(), but for the known backward path cost. */
+float get_rr_backward_path_cost(int inode) {
+    auto& route_ctx = g_vpr_ctx.routing();
 
-    for (auto node : visited_rr_nodes) {
-        route_ctx.rr_node_route_inf[node].path_cost = std::numeric_limits<float>::infinity();
-        route_ctx.rr_node_route_inf[node].backward_path_cost = std::numeric_limits<float>::infinity();
-        route_ctx.rr_node_route_inf[node].prev_node = NO_PREVIOUS;
-        route_ctx.rr_node_route_inf[node].prev_edge = NO_PREVIOUS;
+    if (route_ctx.rr_node_route_inf[inode].path_search_epoch != path_search_epoch) {
+        return std::numeric_limits<float>::infinity();
     }
+    return route_ctx.rr_node_route_inf[inode].backward_path_cost;
+}
+
+/* Records the path_cost of inode for the current path search (used by the
+ * breadth-first router, which has no backward path cost).                   */
+void set_rr_path_cost(int inode, float path_cost) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    route_ctx.rr_node_route_inf[inode].path_cost = path_cost;
+    route_ctx.rr_node_route_inf[inode].path_search_epoch = path_search_epoch;
+}
+
+/* Records the path costs of inode for the current path search. */
+void set_rr_path_costs(int inode, float path_cost, float backward_path_cost) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    route_ctx.rr_node_route_inf[inode].path_cost = path_cost;
+    route_ctx.rr_node_route_inf[inode].backward_path_cost = backward_path_cost;
+    route_ctx.rr_node_route_inf[inode].path_search_epoch = path_search_epoch;
 }
 
 /* Returns the *congestion* cost of using this rr_node. */
@@ -782,9 +845,7 @@ void node_to_heap(int inode, float total_cost, int prev_node, int prev_edge, flo
      * easy.  The backward_path_cost and R_upstream values are used only by the *
      * timing-driven router -- the breadth-first router ignores them.           */
 
-    auto& route_ctx = g_vpr_ctx.routing();
-
-    if (total_cost >= route_ctx.rr_node_route_inf[inode].path_cost)
+    if (total_cost >= get_rr_path_cost(inode))
         return;
 
     t_heap* hptr = alloc_heap_data();
@@ -800,8 +861,8 @@ void node_to_heap(int inode, float total_cost, int prev_node, int prev_edge, flo
 }
 
 void free_traceback(ClusterNetId net_id) {
-    /* Puts the entire traceback (old routing) for this net on the free list *
-     * and sets the route_ctx.trace_head pointers etc. for the net to NULL.            */
+    /* Empties the traceback (old routing) for this net (retaining the storage *
+     * for re-use) and clears the set of nodes it covered.                     */
 
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
@@ -809,31 +870,16 @@ void free_traceback(ClusterNetId net_id) {
         return;
     }
 
-    if (route_ctx.trace[net_id].head == nullptr) {
-        return;
-    }
-
-    free_traceback(route_ctx.trace[net_id].head);
-
-    route_ctx.trace[net_id].head = nullptr;
-    route_ctx.trace[net_id].tail = nullptr;
+    route_ctx.trace[net_id].clear();
     route_ctx.trace_nodes[net_id].clear();
 }
 
-void free_traceback(t_trace* tptr) {
-    while (tptr != nullptr) {
-        t_trace* tempptr = tptr->next;
-        free_trace_data(tptr);
-        tptr = tempptr;
-    }
-}
-
 /* Allocates data structures into which the key routing data can be saved,   *
  * allowing the routing to be recovered later (e.g. after a another routing  *
  * is attempted).                                                            */
-vtr::vector<ClusterNetId, t_trace*> alloc_saved_routing() {
+vtr::vector<ClusterNetId, t_traceback> alloc_saved_routing() {
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    vtr::vector<ClusterNetId, t_trace*> best_routing(cluster_ctx.clb_nlist.nets().size());
+    vtr::vector<ClusterNetId, t_traceback> best_routing(cluster_ctx.clb_nlist.nets().size());
 
     return (best_routing);
 }
@@ -914,20 +960,13 @@ void free_trace_structs() {
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         free_traceback(net_id);
 
-        if (route_ctx.trace[net_id].head) {
-            free(route_ctx.trace[net_id].head);
-            free(route_ctx.trace[net_id].tail);
-        }
-        route_ctx.trace[net_id].head = nullptr;
-        route_ctx.trace[net_id].tail = nullptr;
+        route_ctx.trace[net_id] = t_traceback(); //Release the storage
     }
 }
 
-void free_route_structs() {
-    /* Frees the temporary storage needed only during the routing.  The  *
-     * final routing result is not freed.                                */
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
-
+void free_heap_structs() {
+    /* Frees the calling thread's heap storage. Called per worker thread by
+     * the parallel router, and for the main thread from free_route_structs. */
     if (heap != nullptr) {
         //Free the individiaul heap elements (calls destructors)
         for (int i = 1; i < num_heap_allocated; i++) {
@@ -952,22 +991,28 @@ void free_route_structs() {
 
         heap_free_head = nullptr;
     }
-    if (route_ctx.route_bb.size() != 0) {
-        route_ctx.route_bb.clear();
-    }
 
     /*free the memory chunks that were used by heap and linked f pointer */
     free_chunk_memory(&heap_ch);
 }
 
+void free_route_structs() {
+    /* Frees the temporary storage needed only during the routing.  The  *
+     * final routing result is not freed.                                */
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    free_heap_structs();
+
+    if (route_ctx.route_bb.size() != 0) {
+        route_ctx.route_bb.clear();
+    }
+}
+
 /* Frees the data structures needed to save a routing.                     */
-void free_saved_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing) {
+void free_saved_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
-        if (best_routing[net_id] != nullptr) {
-            free(best_routing[net_id]);
-            best_routing[net_id] = nullptr;
-        }
+        best_routing[net_id] = t_traceback(); //Release the storage
     }
 }
 
@@ -979,6 +1024,7 @@ void alloc_and_load_rr_node_route_structs() {
     auto& device_ctx = g_vpr_ctx.device();
 
     route_ctx.rr_node_route_inf.resize(device_ctx.rr_nodes.size());
+    vtr::hint_large_array(route_ctx.rr_node_route_inf.data(), route_ctx.rr_node_route_inf.size() * sizeof(t_rr_node_route_inf));
     reset_rr_node_route_structs();
 }
 
@@ -998,9 +1044,19 @@ void reset_rr_node_route_structs() {
         route_ctx.rr_node_route_inf[inode].acc_cost = 1.0;
         route_ctx.rr_node_route_inf[inode].path_cost = std::numeric_limits<float>::infinity();
         route_ctx.rr_node_route_inf[inode].backward_path_cost = std::numeric_limits<float>::infinity();
+        route_ctx.rr_node_route_inf[inode].path_search_epoch = 0;
         route_ctx.rr_node_route_inf[inode].target_flag = 0;
         route_ctx.rr_node_route_inf[inode].set_occ(0);
     }
+
+    /* With all stamps cleared the epoch counter can safely restart from zero
+     * (workers re-fetch their epoch via reset_path_costs() before searching) */
+    path_search_epoch_counter = 0;
+    path_search_epoch = 0;
+
+    /* Nothing is occupied, so nothing is congested */
+    congested_nodes.clear();
+    node_in_congested_index.assign(device_ctx.rr_nodes.size(), false);
 }
 
 /* Allocates and loads the route_ctx.net_rr_terminals data structure. For each net it stores the rr_node   *
@@ -1169,38 +1225,40 @@ t_bb load_net_route_bb(ClusterNetId net_id, int bb_factor) {
     return bb;
 }
 
-void add_to_mod_list(int inode, std::vector<int>& modified_rr_node_inf) {
-    auto& route_ctx = g_vpr_ctx.routing();
-
-    if (std::isinf(route_ctx.rr_node_route_inf[inode].path_cost)) {
-        modified_rr_node_inf.push_back(inode);
-    }
-}
-
 namespace heap_ {
 size_t parent(size_t i);
-size_t left(size_t i);
-size_t right(size_t i);
+size_t first_child(size_t i);
+size_t min_child(size_t first);
 size_t size();
 void expand_heap_if_full();
 
-size_t parent(size_t i) { return i >> 1; }
-// child indices of a heap
-size_t left(size_t i) { return i << 1; }
-size_t right(size_t i) { return (i << 1) + 1; }
+// The heap is 1-indexed with a runtime-selected arity (see heap_arity above).
+// With arity D the children of node i are [D*(i-1)+2 .. D*(i-1)+D+1].
+size_t parent(size_t i) { return (i - 2) / heap_arity + 1; }
+size_t first_child(size_t i) { return heap_arity * (i - 1) + 2; }
 size_t size() { return static_cast<size_t>(heap_tail - 1); } // heap[0] is not valid element
 
+// index of the cheapest in-heap child among the siblings starting at 'first'
+size_t min_child(size_t first) {
+    size_t cheapest = first;
+    size_t limit = std::min<size_t>(first + heap_arity, static_cast<size_t>(heap_tail));
+    for (size_t child = first + 1; child < limit; ++child) {
+        if (heap[child]->cost < heap[cheapest]->cost)
+            cheapest = child;
+    }
+    return cheapest;
+}
+
 // make a heap rooted at index i by **sifting down** in O(lgn) time
 void sift_down(size_t hole) {
     t_heap* head{heap[hole]};
-    size_t child{left(hole)};
+    size_t child{first_child(hole)};
     while ((int)child < heap_tail) {
-        if ((int)child + 1 < heap_tail && heap[child + 1]->cost < heap[child]->cost)
-            ++child;
+        child = min_child(child);
         if (heap[child]->cost < head->cost) {
             heap[hole] = heap[child];
             hole = child;
-            child = left(child);
+            child = first_child(child);
         } else
             break;
     }
@@ -1210,8 +1268,8 @@ void sift_down(size_t hole) {
 // runs in O(n) time by sifting down; the least work is done on the most elements: 1 swap for bottom layer, 2 swap for 2nd, ... lgn swap for top
 // 1*(n/2) + 2*(n/4) + 3*(n/8) + ... + lgn*1 = 2n (sum of i/2^i)
 void build_heap() {
-    // second half of heap are leaves
-    for (size_t i = heap_tail >> 1; i != 0; --i)
+    // all nodes after the last internal one are leaves
+    for (size_t i = (heap_tail > 2) ? parent(heap_tail - 1) : 0; i != 0; --i)
         sift_down(i);
 }
 
@@ -1246,8 +1304,7 @@ void push_back_node(int inode, float total_cost, int prev_node, int prev_edge, f
      * but do not fix heap property yet as that is more efficiently done from
      * bottom up with build_heap    */
 
-    auto& route_ctx = g_vpr_ctx.routing();
-    if (total_cost >= route_ctx.rr_node_route_inf[inode].path_cost)
+    if (total_cost >= get_rr_path_cost(inode))
         return;
 
     t_heap* hptr = alloc_heap_data();
@@ -1260,10 +1317,20 @@ void push_back_node(int inode, float total_cost, int prev_node, int prev_edge, f
     push_back(hptr);
 }
 
+/* Restores the heap property after the last num_appended elements were added
+ * with push_back(); equivalent to inserting each of them via add_to_heap(),
+ * but batches the sifting so callers can append a group of elements first. */
+void sift_up_back(size_t num_appended) {
+    for (size_t i = heap_tail - num_appended; i < static_cast<size_t>(heap_tail); ++i)
+        sift_up(i, heap[i]);
+}
+
 bool is_valid() {
-    for (size_t i = 1; (int)i <= heap_tail >> 1; ++i) {
-        if ((int)left(i) < heap_tail && heap[left(i)]->cost < heap[i]->cost) return false;
-        if ((int)right(i) < heap_tail && heap[right(i)]->cost < heap[i]->cost) return false;
+    for (size_t i = 1; (int)i < heap_tail; ++i) {
+        size_t limit = std::min<size_t>(first_child(i) + heap_arity, static_cast<size_t>(heap_tail));
+        for (size_t child = first_child(i); child < limit; ++child) {
+            if (heap[child]->cost < heap[i]->cost) return false;
+        }
     }
     return true;
 }
@@ -1275,8 +1342,8 @@ void pop_heap() {
 }
 // print every element; not necessarily in order for minheap
 void print_heap() {
-    for (int i = 1; i<heap_tail>> 1; ++i)
-        VTR_LOG("(%e %e %e) ", heap[i]->cost, heap[left(i)]->cost, heap[right(i)]->cost);
+    for (int i = 1; i < heap_tail; ++i)
+        VTR_LOG("%e ", heap[i]->cost);
     VTR_LOG("\n");
 }
 // verify correctness of extract top by making a copy, sorting it, and iterating it at the same time as extraction
@@ -1319,6 +1386,11 @@ bool is_empty_heap() {
     return (bool)(heap_tail == 1);
 }
 
+int get_heap_occupancy() {
+    /* Number of elements currently in the calling thread's heap */
+    return std::max(0, heap_tail - 1);
+}
+
 t_heap*
 get_heap_head() {
     /* Returns a pointer to the smallest element on the heap, or NULL if the     *
@@ -1337,14 +1409,13 @@ get_heap_head() {
         cheapest = heap[1];
 
         hole = 1;
-        child = 2;
+        child = heap_::first_child(1);
         --heap_tail;
         while ((int)child < heap_tail) {
-            if (heap[child + 1]->cost < heap[child]->cost)
-                ++child; // become right child
+            child = heap_::min_child(child);
             heap[hole] = heap[child];
             hole = child;
-            child = heap_::left(child);
+            child = heap_::first_child(child);
         }
         heap_::sift_up(hole, heap[heap_tail]);
 
@@ -1404,29 +1475,7 @@ void invalidate_heap_entries(int sink_node, int ipin_node) {
     }
 }
 
-t_trace*
-alloc_trace_data() {
-    t_trace* temp_ptr;
-
-    if (trace_free_head == nullptr) { /* No elements on the free list */
-        trace_free_head = (t_trace*)vtr::chunk_malloc(sizeof(t_trace), &trace_ch);
-        trace_free_head->next = nullptr;
-    }
-    temp_ptr = trace_free_head;
-    trace_free_head = trace_free_head->next;
-    num_trace_allocated++;
-    return (temp_ptr);
-}
-
-void free_trace_data(t_trace* tptr) {
-    /* Puts the traceback structure pointed to by tptr on the free list. */
-
-    tptr->next = trace_free_head;
-    trace_free_head = tptr;
-    num_trace_allocated--;
-}
-
-void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& tracebacks) {
+void print_route(std::ostream& fp, const vtr::vector<ClusterNetId, t_traceback>& tracebacks) {
     if (tracebacks.empty()) return; //Only if routing exists
 
     auto& place_ctx = g_vpr_ctx.placement();
@@ -1436,9 +1485,9 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
-            fprintf(fp, "\n\nNet %zu (%s)\n\n", size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str());
+            fp << vtr::string_fmt("\n\nNet %zu (%s)\n\n", size_t(net_id), cluster_ctx.clb_nlist.net_name(net_id).c_str());
             if (cluster_ctx.clb_nlist.net_sinks(net_id).size() == false) {
-                fprintf(fp, "\n\nUsed in local cluster only, reserved one CLB pin\n\n");
+                fp << "\n\nUsed in local cluster only, reserved one CLB pin\n\n";
             } else {
                 t_trace* tptr = route_ctx.trace[net_id].head;
 
@@ -1448,35 +1497,35 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
                     int ilow = device_ctx.rr_nodes[inode].xlow();
                     int jlow = device_ctx.rr_nodes[inode].ylow();
 
-                    fprintf(fp, "Node:\t%d\t%6s (%d,%d) ", inode,
+                    fp << vtr::string_fmt("Node:\t%d\t%6s (%d,%d) ", inode,
                             device_ctx.rr_nodes[inode].type_string(), ilow, jlow);
 
                     if ((ilow != device_ctx.rr_nodes[inode].xhigh())
                         || (jlow != device_ctx.rr_nodes[inode].yhigh()))
-                        fprintf(fp, "to (%d,%d) ", device_ctx.rr_nodes[inode].xhigh(),
+                        fp << vtr::string_fmt("to (%d,%d) ", device_ctx.rr_nodes[inode].xhigh(),
                                 device_ctx.rr_nodes[inode].yhigh());
 
                     switch (rr_type) {
                         case IPIN:
                         case OPIN:
                             if (is_io_type(device_ctx.grid[ilow][jlow].type)) {
-                                fprintf(fp, " Pad: ");
+                                fp << " Pad: ";
                             } else { /* IO Pad. */
-                                fprintf(fp, " Pin: ");
+                                fp << " Pin: ";
                             }
                             break;
 
                         case CHANX:
                         case CHANY:
-                            fprintf(fp, " Track: ");
+                            fp << " Track: ";
                             break;
 
                         case SOURCE:
                         case SINK:
                             if (is_io_type(device_ctx.grid[ilow][jlow].type)) {
-                                fprintf(fp, " Pad: ");
+                                fp << " Pad: ";
                             } else { /* IO Pad. */
-                                fprintf(fp, " Class: ");
+                                fp << " Class: ";
                             }
                             break;
 
@@ -1487,30 +1536,30 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
                             break;
                     }
 
-                    fprintf(fp, "%d  ", device_ctx.rr_nodes[inode].ptc_num());
+                    fp << vtr::string_fmt("%d  ", device_ctx.rr_nodes[inode].ptc_num());
 
                     if (!is_io_type(device_ctx.grid[ilow][jlow].type) && (rr_type == IPIN || rr_type == OPIN)) {
                         int pin_num = device_ctx.rr_nodes[inode].ptc_num();
                         int xoffset = device_ctx.grid[ilow][jlow].width_offset;
                         int yoffset = device_ctx.grid[ilow][jlow].height_offset;
-                        ClusterBlockId iblock = place_ctx.grid_blocks[ilow - xoffset][jlow - yoffset].blocks[0];
+                        ClusterBlockId iblock = place_ctx.grid_blocks.block_at_location(ilow - xoffset, jlow - yoffset, 0);
                         VTR_ASSERT(iblock);
                         t_pb_graph_pin* pb_pin = get_pb_graph_node_pin_from_block_pin(iblock, pin_num);
                         t_pb_type* pb_type = pb_pin->parent_node->pb_type;
-                        fprintf(fp, " %s.%s[%d] ", pb_type->name, pb_pin->port->name, pb_pin->pin_number);
+                        fp << vtr::string_fmt(" %s.%s[%d] ", pb_type->name, pb_pin->port->name, pb_pin->pin_number);
                     }
 
                     /* Uncomment line below if you're debugging and want to see the switch types *
                      * used in the routing.                                                      */
-                    fprintf(fp, "Switch: %d", tptr->iswitch);
+                    fp << vtr::string_fmt("Switch: %d", tptr->iswitch);
 
-                    fprintf(fp, "\n");
+                    fp << "\n";
 
                     tptr = tptr->next;
                 }
             }
         } else { /* Global net.  Never routed. */
-            fprintf(fp, "\n\nNet %zu (%s): global net connecting:\n\n", size_t(net_id),
+            fp << vtr::string_fmt("\n\nNet %zu (%s): global net connecting:\n\n", size_t(net_id),
                     cluster_ctx.clb_nlist.net_name(net_id).c_str());
 
             for (auto pin_id : cluster_ctx.clb_nlist.net_pins(net_id)) {
@@ -1518,7 +1567,7 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
                 int pin_index = cluster_ctx.clb_nlist.pin_physical_index(pin_id);
                 int iclass = physical_tile_type(block_id)->pin_class[pin_index];
 
-                fprintf(fp, "Block %s (#%zu) at (%d,%d), Pin class %d.\n",
+                fp << vtr::string_fmt("Block %s (#%zu) at (%d,%d), Pin class %d.\n",
                         cluster_ctx.clb_nlist.block_name(block_id).c_str(), size_t(block_id),
                         place_ctx.block_locs[block_id].loc.x,
                         place_ctx.block_locs[block_id].loc.y,
@@ -1530,34 +1579,41 @@ void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& traceba
 
 /* Prints out the routing to file route_file.  */
 void print_route(const char* placement_file, const char* route_file) {
-    FILE* fp;
-
-    fp = fopen(route_file, "w");
-
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    fprintf(fp, "Placement_File: %s Placement_ID: %s\n", placement_file, place_ctx.placement_id.c_str());
+    std::ostringstream fp;
+
+    fp << vtr::string_fmt("Placement_File: %s Placement_ID: %s\n", placement_file, place_ctx.placement_id.c_str());
 
-    fprintf(fp, "Array size: %zu x %zu logic blocks.\n", device_ctx.grid.width(), device_ctx.grid.height());
-    fprintf(fp, "\nRouting:");
+    fp << vtr::string_fmt("Array size: %zu x %zu logic blocks.\n", device_ctx.grid.width(), device_ctx.grid.height());
+    fp << "\nRouting:";
 
     print_route(fp, route_ctx.trace);
 
-    fclose(fp);
+    //Save the digest of the route file, computed from the formatted contents
+    //(so it does not depend on the file write having completed)
+    std::string contents = fp.str();
+    std::istringstream contents_stream(contents);
+    route_ctx.routing_id = vtr::secure_digest_stream(contents_stream);
+
+    //Hand the formatted routing off to the background writer, overlapping the
+    //(potentially large) file write with further computation
+    vtr::async_write_file(route_file, std::move(contents));
 
     if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_MEM)) {
-        fp = vtr::fopen(getEchoFileName(E_ECHO_MEM), "w");
-        fprintf(fp, "\nNum_heap_allocated: %d   Num_trace_allocated: %d\n",
-                num_heap_allocated, num_trace_allocated);
-        fprintf(fp, "Num_linked_f_pointer_allocated: %d\n",
-                num_linked_f_pointer_allocated);
-        fclose(fp);
+        std::ostringstream echo_fp;
+        size_t num_trace_elements = 0;
+        for (auto net_id : g_vpr_ctx.clustering().clb_nlist.nets()) {
+            num_trace_elements += route_ctx.trace[net_id].size();
+        }
+        echo_fp << vtr::string_fmt("\nNum_heap_allocated: %d   Num_trace_elements: %zu\n",
+                                   num_heap_allocated, num_trace_elements);
+        echo_fp << vtr::string_fmt("Num_linked_f_pointer_allocated: %d\n",
+                                   num_linked_f_pointer_allocated);
+        vtr::async_write_file(getEchoFileName(E_ECHO_MEM), echo_fp.str());
     }
-
-    //Save the digest of the route file
-    route_ctx.routing_id = vtr::secure_digest_file(route_file);
 }
 
 //To ensure the router can only swaps pin which are actually logically equivalent some block output pins must be
@@ -1663,6 +1719,7 @@ static void adjust_one_rr_occ_and_apcost(int inode, int add_or_sub, float pres_f
         route_ctx.rr_node_route_inf[inode].pres_cost = 1.0;
     } else {
         route_ctx.rr_node_route_inf[inode].pres_cost = 1.0 + (new_occ + 1 - capacity) * pres_fac;
+        add_to_congested_node_index(inode);
         if (add_or_sub == 1) {
             route_ctx.rr_node_route_inf[inode].acc_cost += (new_occ - capacity) * acc_fac;
         }
@@ -1670,11 +1727,11 @@ static void adjust_one_rr_occ_and_apcost(int inode, int add_or_sub, float pres_f
 }
 
 void free_chunk_memory_trace() {
-    if (trace_ch.chunk_ptr_head != nullptr) {
-        free_chunk_memory(&trace_ch);
-        trace_ch.chunk_ptr_head = nullptr;
-        trace_free_head = nullptr;
-    }
+    /* Releases all the storage backing the per-net tracebacks. */
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    route_ctx.trace.clear();
+    route_ctx.trace.shrink_to_fit();
 }
 
 // connection based overhaul (more specificity than nets)
@@ -1822,7 +1879,7 @@ void print_rr_node_route_inf() {
     auto& route_ctx = g_vpr_ctx.routing();
     auto& device_ctx = g_vpr_ctx.device();
     for (size_t inode = 0; inode < route_ctx.rr_node_route_inf.size(); ++inode) {
-        if (!std::isinf(route_ctx.rr_node_route_inf[inode].path_cost)) {
+        if (!std::isinf(get_rr_path_cost(inode))) {
             int prev_node = route_ctx.rr_node_route_inf[inode].prev_node;
             int prev_edge = route_ctx.rr_node_route_inf[inode].prev_edge;
             VTR_LOG("rr_node: %d prev_node: %d prev_edge: %d",
@@ -1833,7 +1890,7 @@ void print_rr_node_route_inf() {
             }
 
             VTR_LOG(" pcost: %g back_pcost: %g\n",
-                    route_ctx.rr_node_route_inf[inode].path_cost, route_ctx.rr_node_route_inf[inode].backward_path_cost);
+                    get_rr_path_cost(inode), get_rr_backward_path_cost(inode));
         }
     }
 }
@@ -1845,7 +1902,7 @@ void print_rr_node_route_inf_dot() {
     VTR_LOG("digraph G {\n");
     VTR_LOG("\tnode[shape=record]\n");
     for (size_t inode = 0; inode < route_ctx.rr_node_route_inf.size(); ++inode) {
-        if (!std::isinf(route_ctx.rr_node_route_inf[inode].path_cost)) {
+        if (!std::isinf(get_rr_path_cost(inode))) {
             VTR_LOG("\tnode%zu[label=\"{%zu (%s)", inode, inode, device_ctx.rr_nodes[inode].type_string());
             if (route_ctx.rr_node_route_inf[inode].occ() > device_ctx.rr_nodes[inode].capacity()) {
                 VTR_LOG(" x");
@@ -1854,7 +1911,7 @@ void print_rr_node_route_inf_dot() {
         }
     }
     for (size_t inode = 0; inode < route_ctx.rr_node_route_inf.size(); ++inode) {
-        if (!std::isinf(route_ctx.rr_node_route_inf[inode].path_cost)) {
+        if (!std::isinf(get_rr_path_cost(inode))) {
             int prev_node = route_ctx.rr_node_route_inf[inode].prev_node;
             int prev_edge = route_ctx.rr_node_route_inf[inode].prev_edge;
 
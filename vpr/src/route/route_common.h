@@ -63,9 +63,18 @@ void pathfinder_update_single_node_cost(int inode, int add_or_sub, float pres_fa
 
 void pathfinder_update_cost(float pres_fac, float acc_fac);
 
+void rebuild_congested_node_index();
+
 t_trace* update_traceback(t_heap* hptr, ClusterNetId net_id);
 
-void reset_path_costs(const std::vector<int>& visited_rr_nodes);
+void reset_path_costs();
+
+uint32_t get_path_search_epoch();
+
+float get_rr_path_cost(int inode);
+float get_rr_backward_path_cost(int inode);
+void set_rr_path_cost(int inode, float path_cost);
+void set_rr_path_costs(int inode, float path_cost, float backward_path_cost);
 
 float get_rr_cong_cost(int inode);
 
@@ -78,10 +87,9 @@ void node_to_heap(int inode, float cost, int prev_node, int prev_edge, float bac
 
 bool is_empty_heap();
 
-void free_traceback(ClusterNetId net_id);
-void free_traceback(t_trace* tptr);
+int get_heap_occupancy();
 
-void add_to_mod_list(int inode, std::vector<int>& modified_rr_node_inf);
+void free_traceback(ClusterNetId net_id);
 
 namespace heap_ {
 void build_heap();
@@ -89,6 +97,7 @@ void sift_down(size_t hole);
 void sift_up(size_t tail, t_heap* const hptr);
 void push_back(t_heap* const hptr);
 void push_back_node(int inode, float total_cost, int prev_node, int prev_edge, float backward_path_cost, float R_upstream);
+void sift_up_back(size_t num_appended);
 bool is_valid();
 void pop_heap();
 void print_heap();
@@ -112,6 +121,8 @@ void reset_rr_node_route_structs();
 void free_trace_structs();
 
 void init_heap(const DeviceGrid& grid);
+void set_router_heap_type(e_heap_type heap_type);
+void free_heap_structs();
 void reserve_locally_used_opins(float pres_fac, float acc_fac, bool rip_up_local_opins);
 
 void free_chunk_memory_trace();
@@ -124,7 +135,4 @@ void print_rr_node_route_inf();
 void print_rr_node_route_inf_dot();
 void print_invalid_routing_info();
 
-t_trace* alloc_trace_data();
-void free_trace_data(t_trace* trace);
-
 bool router_needs_lookahead(enum e_router_algorithm router_algorithm);
@@ -1,6 +1,7 @@
 /******** Function prototypes for functions in route_common.c that ***********
  ******** are used outside the router modules.                     ***********/
 #include "vpr_types.h"
+#include <iosfwd>
 #include <memory>
 #include "timing_info_fwd.h"
 #include "route_common.h"
@@ -37,19 +38,19 @@ t_clb_opins_used alloc_route_structs();
 
 void free_route_structs();
 
-vtr::vector<ClusterNetId, t_trace*> alloc_saved_routing();
+vtr::vector<ClusterNetId, t_traceback> alloc_saved_routing();
 
-void free_saved_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing);
+void free_saved_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing);
 
-void save_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
+void save_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing,
                   const t_clb_opins_used& clb_opins_used_locally,
                   t_clb_opins_used& saved_clb_opins_used_locally);
 
-void restore_routing(vtr::vector<ClusterNetId, t_trace*>& best_routing,
+void restore_routing(vtr::vector<ClusterNetId, t_traceback>& best_routing,
                      t_clb_opins_used& clb_opins_used_locally,
                      const t_clb_opins_used& saved_clb_opins_used_locally);
 
 void get_serial_num();
 
 void print_route(const char* place_file, const char* route_file);
-void print_route(FILE* fp, const vtr::vector<ClusterNetId, t_traceback>& tracebacks);
+void print_route(std::ostream& fp, const vtr::vector<ClusterNetId, t_traceback>& tracebacks);
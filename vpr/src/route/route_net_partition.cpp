@@ -0,0 +1,81 @@
+#include "route_net_partition.h"
+
+#include "globals.h"
+#include "vtr_assert.h"
+
+static void partition_nets_recurr(const std::vector<ClusterNetId>& nets,
+                                  const t_bb& region,
+                                  int num_groups,
+                                  int halo,
+                                  t_net_partitioning& result);
+
+t_net_partitioning partition_nets_by_route_bb(const std::vector<ClusterNetId>& nets,
+                                              int num_groups,
+                                              int halo) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    VTR_ASSERT(num_groups >= 1);
+
+    t_net_partitioning result;
+
+    t_bb device_region;
+    device_region.xmin = 0;
+    device_region.ymin = 0;
+    device_region.xmax = device_ctx.grid.width() - 1;
+    device_region.ymax = device_ctx.grid.height() - 1;
+
+    partition_nets_recurr(nets, device_region, num_groups, halo, result);
+
+    return result;
+}
+
+static void partition_nets_recurr(const std::vector<ClusterNetId>& nets,
+                                  const t_bb& region,
+                                  int num_groups,
+                                  int halo,
+                                  t_net_partitioning& result) {
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    bool split_x = (region.xmax - region.xmin) >= (region.ymax - region.ymin);
+    int cut = split_x ? (region.xmin + region.xmax) / 2 : (region.ymin + region.ymax) / 2;
+
+    if (num_groups <= 1 || cut - halo <= (split_x ? region.xmin : region.ymin)) {
+        //Leaf of the bisection (or region too small to cut safely): all
+        //remaining nets form one group routed serially by a single worker
+        result.independent_groups.push_back(nets);
+        return;
+    }
+
+    std::vector<ClusterNetId> low_nets;
+    std::vector<ClusterNetId> high_nets;
+
+    for (ClusterNetId net_id : nets) {
+        const t_bb& bb = route_ctx.route_bb[net_id];
+
+        int bb_low = split_x ? bb.xmin : bb.ymin;
+        int bb_high = split_x ? bb.xmax : bb.ymax;
+
+        if (bb_high < cut - halo) {
+            low_nets.push_back(net_id);
+        } else if (bb_low > cut + halo) {
+            high_nets.push_back(net_id);
+        } else {
+            //Crosses (or is too close to) the cut line
+            result.serial_nets.push_back(net_id);
+        }
+    }
+
+    t_bb low_region = region;
+    t_bb high_region = region;
+    if (split_x) {
+        low_region.xmax = cut;
+        high_region.xmin = cut;
+    } else {
+        low_region.ymax = cut;
+        high_region.ymin = cut;
+    }
+
+    //Low side gets the larger share for odd group counts
+    partition_nets_recurr(low_nets, low_region, (num_groups + 1) / 2, halo, result);
+    partition_nets_recurr(high_nets, high_region, num_groups / 2, halo, result);
+}
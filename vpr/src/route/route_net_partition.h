@@ -0,0 +1,42 @@
+#ifndef VPR_ROUTE_NET_PARTITION_H
+#define VPR_ROUTE_NET_PARTITION_H
+#include <vector>
+
+#include "clustered_netlist.h"
+#include "vpr_types.h"
+
+/***************** Spatial net partitioning for parallel routing ************/
+// Decomposes the set of nets to be routed into groups whose routing bounding
+// boxes (route_ctx.route_bb) fall into disjoint regions of the device, so the
+// groups can be routed concurrently without touching the same RR nodes.
+//
+// The decomposition is a recursive bisection of the device area: at each
+// level the current region is cut in half along its longer axis, and nets
+// whose bounding box lies entirely on one side (with a safety halo, see
+// below) are assigned to that side. Nets that cross a cut, or come within
+// 'halo' of it, are collected separately and must be routed serially.
+//
+// The halo guards against RR nodes (wires) that extend beyond a net's
+// bounding box: a wire of length L overlapping one region can reach at most
+// L units into the neighbouring one, so a halo of the longest segment length
+// guarantees that nets in different groups expand disjoint RR node sets.
+
+struct t_net_partitioning {
+    // Nets that can be routed concurrently: nets in different groups never
+    // share RR nodes. Nets within a group must still be routed serially.
+    std::vector<std::vector<ClusterNetId>> independent_groups;
+
+    // Nets crossing (or too close to) a partition boundary; these must be
+    // routed serially after the independent groups.
+    std::vector<ClusterNetId> serial_nets;
+};
+
+// Partitions 'nets' into (up to) 'num_groups' independent groups based on the
+// current route bounding boxes. 'halo' is the extra clearance (in grid units)
+// required between a net's bounding box and a cut line, and should be at
+// least the longest wire segment length in the architecture.
+t_net_partitioning partition_nets_by_route_bb(const std::vector<ClusterNetId>& nets,
+                                              int num_groups,
+                                              int halo);
+
+#endif
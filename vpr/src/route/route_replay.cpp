@@ -0,0 +1,161 @@
+#include <cstdio>
+#include <memory>
+
+#include "route_replay.h"
+
+#include "globals.h"
+#include "route_common.h"
+#include "route_timing.h"
+#include "route_tree_timing.h"
+#include "router_lookahead.h"
+#include "router_stats.h"
+#include "vpr_error.h"
+#include "vtr_compressed_io.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/*
+ * Trace format (one record per line, '#' lines are comments):
+ *
+ *   iter <itry> <pres_fac>
+ *   conn <source_rr> <sink_rr> <xmin> <ymin> <xmax> <ymax> <criticality>
+ *
+ * The capture file is written through CompressedWriter, so a .gz filename
+ * produces a compressed trace transparently (large designs record millions
+ * of connection searches).
+ */
+
+//The currently open capture file, if any (owned by ScopedConnectionTrace)
+static std::unique_ptr<vtr::CompressedWriter> f_connection_trace;
+
+ScopedConnectionTrace::ScopedConnectionTrace(const std::string& filename) {
+    VTR_ASSERT(!f_connection_trace); //Only one capture at a time
+
+    if (filename.empty()) return;
+
+    auto writer = std::make_unique<vtr::CompressedWriter>(filename);
+    if (!writer->valid()) {
+        VTR_LOG_WARN("Failed to open connection trace file '%s' (capture disabled)\n", filename.c_str());
+        return;
+    }
+
+    fprintf(writer->file(), "# VPR connection search trace\n");
+    fprintf(writer->file(), "# conn <source_rr> <sink_rr> <xmin> <ymin> <xmax> <ymax> <criticality>\n");
+
+    f_connection_trace = std::move(writer);
+
+    VTR_LOG("Recording connection searches to '%s'\n", filename.c_str());
+}
+
+ScopedConnectionTrace::~ScopedConnectionTrace() {
+    f_connection_trace.reset(); //Flushes and closes
+}
+
+bool connection_trace_active() {
+    return bool(f_connection_trace);
+}
+
+void trace_connection_iteration(int itry, float pres_fac) {
+    if (!f_connection_trace) return;
+
+    fprintf(f_connection_trace->file(), "iter %d %g\n", itry, pres_fac);
+}
+
+void trace_connection_search(int source_node, int sink_node, const t_bb& bounding_box, float criticality) {
+    if (!f_connection_trace) return;
+
+    fprintf(f_connection_trace->file(), "conn %d %d %d %d %d %d %.4f\n",
+            source_node, sink_node,
+            bounding_box.xmin, bounding_box.ymin,
+            bounding_box.xmax, bounding_box.ymax,
+            criticality);
+}
+
+void replay_connection_trace(const std::string& filename,
+                             const t_router_opts& router_opts,
+                             const std::vector<t_segment_inf>& segment_inf) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    vtr::CompressedIstream trace(filename);
+    if (!trace) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to open connection trace file '%s'", filename.c_str());
+    }
+
+    const RouterLookahead* router_lookahead = get_cached_router_lookahead(
+        router_opts.lookahead_type,
+        router_opts.write_router_lookahead,
+        router_opts.read_router_lookahead,
+        segment_inf);
+
+    update_rr_base_costs(1);
+
+    VTR_LOG("Replaying connection searches from '%s' (the netlist is not routed)\n", filename.c_str());
+
+    RouterStats router_stats;
+    size_t num_searches = 0;
+    size_t num_unreachable = 0;
+
+    vtr::Timer replay_timer;
+
+    std::string line;
+    size_t lineno = 0;
+    while (std::getline(trace, line)) {
+        ++lineno;
+
+        int source_node, sink_node;
+        t_bb bounding_box;
+        float criticality;
+        if (sscanf(line.c_str(), "conn %d %d %d %d %d %d %f",
+                   &source_node, &sink_node,
+                   &bounding_box.xmin, &bounding_box.ymin,
+                   &bounding_box.xmax, &bounding_box.ymax,
+                   &criticality)
+            != 7) {
+            //Comments and 'iter' markers are informational only: replay runs
+            //against an uncongested RR graph, so pres_fac has no effect
+            continue;
+        }
+
+        if (source_node < 0 || size_t(source_node) >= device_ctx.rr_nodes.size()
+            || sink_node < 0 || size_t(sink_node) >= device_ctx.rr_nodes.size()) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "Connection trace '%s' line %zu references an RR node outside the current RR graph"
+                            " (was the trace recorded on a different architecture/channel width?)",
+                            filename.c_str(), lineno);
+        }
+
+        t_rt_node* rt_root = init_route_tree_to_source_no_net(source_node);
+
+        t_conn_cost_params cost_params;
+        cost_params.criticality = criticality;
+        cost_params.astar_fac = router_opts.astar_fac;
+        cost_params.bend_cost = router_opts.bend_cost;
+
+        t_heap* cheapest = timing_driven_route_connection_from_route_tree(rt_root,
+                                                                          sink_node,
+                                                                          cost_params,
+                                                                          bounding_box,
+                                                                          *router_lookahead,
+                                                                          router_stats);
+
+        if (cheapest) {
+            free_heap_data(cheapest);
+        } else {
+            ++num_unreachable;
+        }
+        free_route_tree(rt_root);
+
+        empty_heap();
+        reset_path_costs();
+
+        ++num_searches;
+    }
+
+    float elapsed_sec = replay_timer.elapsed_sec();
+
+    VTR_LOG("Connection search replay complete:\n");
+    VTR_LOG("  Searches replayed: %zu (%zu found no path)\n", num_searches, num_unreachable);
+    VTR_LOG("  Heap pushes: %zu  pops: %zu\n", router_stats.heap_pushes, router_stats.heap_pops);
+    VTR_LOG("  Time: %.3f sec (%.1f searches/sec)\n",
+            elapsed_sec, (elapsed_sec > 0.) ? num_searches / elapsed_sec : 0.);
+}
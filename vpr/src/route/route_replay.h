@@ -0,0 +1,50 @@
+#ifndef VPR_ROUTE_REPLAY_H
+#define VPR_ROUTE_REPLAY_H
+#include <string>
+
+#include "vpr_types.h"
+#include "arch_types.h"
+
+/******************* Connection-search capture & replay **********************/
+// Diagnosing router performance normally means re-running an entire design.
+// Instead, the router can record the inputs of every connection search it
+// performs (source/sink RR nodes, bounding box, criticality) to a compact
+// text trace (--route_connection_trace_file), and a later run can re-execute
+// just those searches against a freshly built RR graph
+// (--route_replay_file), reporting wall time and heap push/pop statistics.
+// This lets heap, lookahead and expansion-loop changes be benchmarked in
+// seconds on the search workload of a real design.
+//
+// Replayed searches run against an uncongested RR graph: the trace's
+// iteration markers record when pres_fac changed, but per-node occupancy is
+// not captured, so replay measures search/lookahead cost rather than exact
+// Pathfinder convergence.
+
+//RAII handle for the capture file: opens filename on construction (a ""
+//filename disables capture) and closes it when routing finishes
+class ScopedConnectionTrace {
+  public:
+    explicit ScopedConnectionTrace(const std::string& filename);
+    ~ScopedConnectionTrace();
+
+    ScopedConnectionTrace(const ScopedConnectionTrace&) = delete;
+    ScopedConnectionTrace& operator=(const ScopedConnectionTrace&) = delete;
+};
+
+//Returns true if a connection trace is currently being captured
+bool connection_trace_active();
+
+//Records the start of routing iteration itry (with its present-cost factor)
+void trace_connection_iteration(int itry, float pres_fac);
+
+//Records the inputs of one connection search
+void trace_connection_search(int source_node, int sink_node, const t_bb& bounding_box, float criticality);
+
+//Re-executes the connection searches recorded in filename and logs
+//timing/heap statistics. The RR graph and router structures must already
+//have been built (i.e. called from within the routing stage).
+void replay_connection_trace(const std::string& filename,
+                             const t_router_opts& router_opts,
+                             const std::vector<t_segment_inf>& segment_inf);
+
+#endif
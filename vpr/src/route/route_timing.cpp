@@ -4,9 +4,12 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_math.h"
 #include "vtr_time.h"
 
 #include "vpr_utils.h"
@@ -24,10 +27,15 @@
 #include "draw.h"
 #include "rr_graph.h"
 #include "routing_predictor.h"
+#include "route_net_partition.h"
+#include "route_checkpoint.h"
+#include "route_replay.h"
+#include "vpr_checkpoint.h"
 #include "VprTimingGraphResolver.h"
 
 // all functions in profiling:: namespace, which are only activated if PROFILE is defined
 #include "route_profiling.h"
+#include "router_telemetry.h"
 
 #include "timing_info.h"
 #include "timing_util.h"
@@ -40,6 +48,18 @@
 #define CONGESTED_SLOPE_VAL -0.04
 //#define ROUTER_DEBUG
 
+//Adaptive congestion pressure scheduling (--router_adaptive_pres_fac):
+//fraction of RR nodes overused above which congestion is considered broad
+constexpr float ADAPTIVE_PRES_BROAD_OVERUSE_RATIO = 5e-4f;
+//Largest boost applied to the pres_fac growth factor when broad congestion is stagnant
+constexpr float ADAPTIVE_PRES_MAX_MULT_BOOST = 1.5f;
+//Predicted iterations-to-resolution at/beyond which broad congestion counts as fully stagnant
+constexpr float ADAPTIVE_PRES_STAGNATION_ITERATIONS = 30.f;
+//Fraction of the configured pres_fac growth retained while only improving hotspots remain
+constexpr float ADAPTIVE_PRES_GENTLE_FRACTION = 0.5f;
+//acc_fac boost applied while only hotspots remain (history cost untangles contested nodes)
+constexpr float ADAPTIVE_PRES_HOTSPOT_ACC_BOOST = 2.0f;
+
 enum class RouterCongestionMode {
     NORMAL,
     CONFLICTED
@@ -133,8 +153,42 @@ struct RoutingMetrics {
 //Note only enables debug output if compiled with VTR_ENABLE_DEBUG_LOGGING defined
 bool f_router_debug = false;
 
+//Sinks of a high fanout net which are more critical than this are routed with
+//the full route tree on the heap (see timing_driven_route_sink)
+constexpr float HIGH_FANOUT_CRITICALITY_THRESHOLD = 0.9;
+
+//Fanout at or above which a net's sinks are routed by concurrent connection
+//searches (see timing_driven_route_sinks_parallel). Only applies when
+//--router_num_workers > 1.
+constexpr unsigned MIN_FANOUT_PARALLEL_SINK_ROUTING = 512;
+
+//Decay applied to each net's accumulated congestion history between routing
+//iterations (see schedule_nets_for_next_iteration): recent contention
+//dominates, but chronically contested nets retain a high score even through
+//iterations where they briefly route cleanly.
+constexpr float NET_CONGESTION_HISTORY_DECAY = 0.8;
+
+//True within a net-level worker thread of try_timing_driven_route_nets_parallel.
+//Such workers must not spawn further (nested) sink-level workers.
+static thread_local bool f_in_parallel_net_worker = false;
+
 /******************** Subroutines local to route_timing.c ********************/
 
+static bool try_timing_driven_route_nets_parallel(const std::vector<ClusterNetId>& sorted_nets,
+                                                  int itry,
+                                                  float pres_fac,
+                                                  const t_router_opts& router_opts,
+                                                  int partition_halo,
+                                                  CBRR& connections_inf,
+                                                  RouterStats& router_stats,
+                                                  timing_driven_route_structs& route_structs,
+                                                  vtr::vector<ClusterNetId, float*>& net_delay,
+                                                  const RouterLookahead& router_lookahead,
+                                                  const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                                  std::shared_ptr<SetupTimingInfo> route_timing_info,
+                                                  route_budgets& budgeting_inf,
+                                                  std::vector<ClusterNetId>& rerouted_nets);
+
 static bool timing_driven_route_sink(ClusterNetId net_id,
                                      unsigned itarget,
                                      int target_pin,
@@ -147,25 +201,37 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
                                      SpatialRouteTreeLookup& spatial_rt_lookup,
                                      RouterStats& router_stats);
 
+static bool timing_driven_route_sinks_parallel(ClusterNetId net_id,
+                                               const std::vector<int>& remaining_targets,
+                                               const float* pin_criticality,
+                                               const t_conn_cost_params cost_params,
+                                               float pres_fac,
+                                               const t_router_opts& router_opts,
+                                               t_rt_node* rt_root,
+                                               t_rt_node** rt_node_of_sink,
+                                               const RouterLookahead& router_lookahead,
+                                               SpatialRouteTreeLookup& spatial_rt_lookup,
+                                               route_budgets& budgeting_inf,
+                                               RouterStats& router_stats);
+
+static bool sink_path_is_valid(const t_heap* path, ClusterNetId net_id);
+
 static t_heap* timing_driven_route_connection_from_route_tree_high_fanout(t_rt_node* rt_root,
                                                                           int sink_node,
                                                                           const t_conn_cost_params cost_params,
                                                                           t_bb bounding_box,
                                                                           const RouterLookahead& router_lookahead,
                                                                           const SpatialRouteTreeLookup& spatial_rt_lookup,
-                                                                          std::vector<int>& modified_rr_node_inf,
                                                                           RouterStats& router_stats);
 
 static t_heap* timing_driven_route_connection_from_heap(int sink_node,
                                                         const t_conn_cost_params cost_params,
                                                         t_bb bounding_box,
                                                         const RouterLookahead& router_lookahead,
-                                                        std::vector<int>& modified_rr_node_inf,
                                                         RouterStats& router_stats);
 
 static std::vector<t_heap> timing_driven_find_all_shortest_paths_from_heap(const t_conn_cost_params cost_params,
                                                                            t_bb bounding_box,
-                                                                           std::vector<int>& modified_rr_node_inf,
                                                                            RouterStats& router_stats);
 
 static void timing_driven_expand_cheapest(t_heap* cheapest,
@@ -173,7 +239,6 @@ static void timing_driven_expand_cheapest(t_heap* cheapest,
                                           const t_conn_cost_params cost_params,
                                           t_bb bounding_box,
                                           const RouterLookahead& router_lookahead,
-                                          std::vector<int>& modified_rr_node_inf,
                                           RouterStats& router_stats);
 
 static t_rt_node* setup_routing_resources(int itry, ClusterNetId net_id, unsigned num_sinks, float pres_fac, int min_incremental_reroute_fanout, CBRR& incremental_rerouting_res, t_rt_node** rt_node_of_sink);
@@ -192,7 +257,7 @@ static t_bb add_high_fanout_route_tree_to_heap(t_rt_node* rt_root,
                                                t_bb net_bounding_box,
                                                RouterStats& router_stats);
 
-static t_bb adjust_highfanout_bounding_box(t_bb highfanout_bb);
+static t_bb adjust_highfanout_bounding_box(t_bb highfanout_bb, int ring_used);
 
 static void add_route_tree_node_to_heap(t_rt_node* rt_node,
                                         int target_node,
@@ -207,25 +272,20 @@ static void timing_driven_expand_neighbours(t_heap* current,
                                             int target_node,
                                             RouterStats& router_stats);
 
-static void timing_driven_expand_neighbour(t_heap* current,
-                                           const int from_node,
-                                           const t_edge_size from_edge,
-                                           const int to_node,
-                                           const t_conn_cost_params cost_params,
-                                           const t_bb bounding_box,
-                                           const RouterLookahead& router_lookahead,
-                                           int target_node,
-                                           const t_bb target_bb,
-                                           RouterStats& router_stats);
-
-static void timing_driven_add_to_heap(const t_conn_cost_params cost_params,
+static bool timing_driven_neighbour_is_admissible(const int from_node,
+                                                  const t_edge_size from_edge,
+                                                  const int to_node,
+                                                  const t_bb bounding_box,
+                                                  int target_node,
+                                                  const t_bb target_bb);
+
+static bool timing_driven_add_to_heap(const t_conn_cost_params cost_params,
                                       const RouterLookahead& router_lookahead,
                                       const t_heap* current,
                                       const int from_node,
                                       const int to_node,
                                       const int iconn,
-                                      const int target_node,
-                                      RouterStats& router_stats);
+                                      const int target_node);
 
 static void timing_driven_expand_node(const t_conn_cost_params cost_params,
                                       const RouterLookahead& router_lookahead,
@@ -260,10 +320,22 @@ struct more_sinks_than {
     }
 };
 
+static void update_net_congestion_history(vtr::vector<ClusterNetId, float>& congestion_history);
+static void schedule_nets_for_next_iteration(std::vector<ClusterNetId>& sorted_nets,
+                                             const vtr::vector<ClusterNetId, float>& congestion_history,
+                                             std::shared_ptr<const SetupTimingInfo> timing_info,
+                                             const ClusteredPinAtomPinsLookup& netlist_pin_lookup);
+
 static size_t calculate_wirelength_available();
 static WirelengthInfo calculate_wirelength_info(size_t available_wirelength);
 static OveruseInfo calculate_overuse_info();
 
+static void shape_congestion_pressure(const OveruseInfo& overuse_info,
+                                      RoutingPredictor& routing_predictor,
+                                      const t_router_opts& router_opts,
+                                      float* pres_fac_mult,
+                                      float* acc_fac);
+
 static void print_route_status_header();
 static void print_route_status(int itry,
                                double elapsed_sec,
@@ -317,6 +389,16 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
+    if (!router_opts.route_replay_file.empty()) {
+        //Benchmark mode: re-execute a previously recorded connection-search
+        //trace against the RR graph just built instead of routing the netlist
+        replay_connection_trace(router_opts.route_replay_file, router_opts, segment_inf);
+        return false; //No routing was produced
+    }
+
+    //Records every connection search's inputs for later replay, if requested
+    ScopedConnectionTrace connection_trace(router_opts.connection_trace_file);
+
     //Initially, the router runs normally trying to reduce congestion while
     //balancing other metrics (timing, wirelength, run-time etc.)
     RouterCongestionMode router_congestion_mode = RouterCongestionMode::NORMAL;
@@ -324,10 +406,21 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
     //Initialize and properly size the lookups for profiling
     profiling::profiling_initialization(get_max_pins_per_net());
 
+    if (timing_info && delay_calc) {
+        //During routing only the rerouted nets' delays change per iteration,
+        //so let the delay calculator cache full edge delays and invalidate
+        //just the dirty nets' edges (see the rerouted_nets handling below)
+        delay_calc->set_full_delay_cache_enabled(true);
+    }
+
     //sort so net with most sinks is routed first.
     auto sorted_nets = std::vector<ClusterNetId>(cluster_ctx.clb_nlist.nets().begin(), cluster_ctx.clb_nlist.nets().end());
     std::sort(sorted_nets.begin(), sorted_nets.end(), more_sinks_than());
 
+    //Per-net congestion history driving the iteration scheduler (see
+    //schedule_nets_for_next_iteration)
+    vtr::vector<ClusterNetId, float> net_congestion_history(cluster_ctx.clb_nlist.nets().size(), 0.);
+
     /*
      * Configure the routing predictor
      */
@@ -406,14 +499,61 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
     RouterStats router_stats;
     print_route_status_header();
     timing_driven_route_structs route_structs;
+
+    /* Clearance a net's bounding box needs from a partition cut line for the
+     * parallel router: a wire can extend at most its segment length beyond
+     * the bounding box it overlaps. Longlines span a whole channel, forcing
+     * any net near them to the serial phase. */
+    int partition_halo = 1;
+    if (router_opts.router_num_workers > 1) {
+        auto& device_ctx = g_vpr_ctx.device();
+        for (const t_segment_inf& seg : segment_inf) {
+            if (seg.longline) {
+                partition_halo = std::max<int>(partition_halo, device_ctx.grid.width() + device_ctx.grid.height());
+            } else {
+                partition_halo = std::max(partition_halo, seg.length);
+            }
+        }
+    }
     float prev_iter_cumm_time = 0;
     vtr::Timer iteration_timer;
     int num_net_bounding_boxes_updated = 0;
     int itry_since_last_convergence = -1;
-    for (itry = 1; itry <= router_opts.max_router_iterations; ++itry) {
+
+    /*
+     * Resume from a routing checkpoint (if requested, and one exists)
+     */
+    int first_itry = 1;
+    bool resumed_from_checkpoint = false;
+    if (router_opts.route_resume && !router_opts.route_checkpoint_file.empty()) {
+        int checkpoint_itry = 0;
+        if (read_route_checkpoint(router_opts.route_checkpoint_file.c_str(), &checkpoint_itry, &pres_fac)) {
+            first_itry = checkpoint_itry + 1;
+            resumed_from_checkpoint = true;
+
+            //The restored tracebacks determine the net delays (and hence
+            //criticalities) the resumed iteration routes against
+            load_net_delay_from_routing(net_delay);
+            if (timing_info) {
+                timing_info->update();
+            }
+
+            VTR_LOG("Checkpoint restored; continuing from routing iteration %d.\n", first_itry);
+        } else {
+            VTR_LOG_WARN("No routing checkpoint found at '%s'; routing from scratch.\n",
+                         router_opts.route_checkpoint_file.c_str());
+        }
+    }
+
+    CheckpointScheduler checkpoint_sched(router_opts.checkpoint_interval);
+
+    for (itry = first_itry; itry <= router_opts.max_router_iterations; ++itry) {
         RouterStats router_iteration_stats;
         std::vector<ClusterNetId> rerouted_nets;
 
+        telemetry::start_iteration(itry);
+        trace_connection_iteration(itry, pres_fac);
+
         /* Reset "is_routed" and "is_fixed" flags to indicate nets not pre-routed (yet) */
         for (auto net_id : cluster_ctx.clb_nlist.nets()) {
             route_ctx.net_status[net_id].is_routed = false;
@@ -441,29 +581,50 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         /*
          * Route each net
          */
-        for (auto net_id : sorted_nets) {
-            bool was_rerouted = false;
-            bool is_routable = try_timing_driven_route_net(net_id,
-                                                           itry,
-                                                           pres_fac,
-                                                           router_opts,
-                                                           connections_inf,
-                                                           router_iteration_stats,
-                                                           route_structs.pin_criticality,
-                                                           route_structs.rt_node_of_sink,
-                                                           net_delay,
-                                                           *router_lookahead,
-                                                           netlist_pin_lookup,
-                                                           route_timing_info,
-                                                           budgeting_inf,
-                                                           was_rerouted);
-
-            if (!is_routable) {
+        if (router_opts.router_num_workers > 1) {
+            bool all_routable = try_timing_driven_route_nets_parallel(sorted_nets,
+                                                                      itry,
+                                                                      pres_fac,
+                                                                      router_opts,
+                                                                      partition_halo,
+                                                                      connections_inf,
+                                                                      router_iteration_stats,
+                                                                      route_structs,
+                                                                      net_delay,
+                                                                      *router_lookahead,
+                                                                      netlist_pin_lookup,
+                                                                      route_timing_info,
+                                                                      budgeting_inf,
+                                                                      rerouted_nets);
+
+            if (!all_routable) {
                 return (false); //Impossible to route
             }
+        } else {
+            for (auto net_id : sorted_nets) {
+                bool was_rerouted = false;
+                bool is_routable = try_timing_driven_route_net(net_id,
+                                                               itry,
+                                                               pres_fac,
+                                                               router_opts,
+                                                               connections_inf,
+                                                               router_iteration_stats,
+                                                               route_structs.pin_criticality,
+                                                               route_structs.rt_node_of_sink,
+                                                               net_delay,
+                                                               *router_lookahead,
+                                                               netlist_pin_lookup,
+                                                               route_timing_info,
+                                                               budgeting_inf,
+                                                               was_rerouted);
+
+                if (!is_routable) {
+                    return (false); //Impossible to route
+                }
 
-            if (was_rerouted) {
-                rerouted_nets.push_back(net_id);
+                if (was_rerouted) {
+                    rerouted_nets.push_back(net_id);
+                }
             }
         }
 
@@ -482,6 +643,14 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         routing_predictor.add_iteration_overuse(itry, overuse_info.overused_nodes());
 
         if (timing_info) {
+            if (delay_calc) {
+                //Drop the cached delays of nets whose traceback changed this
+                //iteration; all other edge delays are served from the cache
+                for (ClusterNetId net_id : rerouted_nets) {
+                    delay_calc->invalidate_delays_for_net(net_id);
+                }
+            }
+
             //Update timing based on the new routing
             //Note that the net delays have already been updated by timing_driven_route_net
             timing_info->update();
@@ -522,6 +691,11 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         router_stats.heap_pushes += router_iteration_stats.heap_pushes;
         router_stats.heap_pops += router_iteration_stats.heap_pops;
 
+        //Close this iteration's telemetry record (while the occupancies still
+        //reflect this iteration's routing)
+        telemetry::record_nets_rerouted(rerouted_nets.size());
+        telemetry::finish_iteration();
+
         /*
          * Are we finished?
          */
@@ -605,6 +779,12 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
             num_net_bounding_boxes_updated = dynamic_update_bounding_boxes(rerouted_nets, router_opts.high_fanout_threshold);
         }
 
+        //Re-order the nets for the next iteration: chronically contested (and
+        //critical) nets are routed first, while the rest of the routing still
+        //leaves them flexibility to avoid the congestion
+        update_net_congestion_history(net_congestion_history);
+        schedule_nets_for_next_iteration(sorted_nets, net_congestion_history, timing_info, netlist_pin_lookup);
+
         if (itry >= high_effort_congestion_mode_iteration_threshold) {
             //We are approaching the maximum number of routing iterations,
             //and still do not have a legal routing. Switch to a mode which
@@ -617,12 +797,27 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
             pres_fac = router_opts.initial_pres_fac;
             pathfinder_update_cost(pres_fac, 0.); /* Acc_fac=0 for first iter. */
         } else {
-            pres_fac *= router_opts.pres_fac_mult;
+            float pres_fac_mult = router_opts.pres_fac_mult;
+            float acc_fac = router_opts.acc_fac;
+            if (router_opts.adaptive_pres_fac) {
+                shape_congestion_pressure(overuse_info, routing_predictor, router_opts, &pres_fac_mult, &acc_fac);
+            }
+
+            pres_fac *= pres_fac_mult;
 
             /* Avoid overflow for high iteration counts, even if acc_cost is big */
             pres_fac = std::min(pres_fac, static_cast<float>(HUGE_POSITIVE_FLOAT / 1e5));
 
-            pathfinder_update_cost(pres_fac, router_opts.acc_fac);
+            pathfinder_update_cost(pres_fac, acc_fac);
+        }
+
+        //Checkpoint the routing state now that the congestion costs and
+        //pres_fac for the next iteration are known, so --route_resume can pick
+        //up close to where a killed job left off. Writes are rate-limited by
+        //--checkpoint_interval so short iterations don't thrash the disk.
+        if (!router_opts.route_checkpoint_file.empty() && checkpoint_sched.due()) {
+            write_route_checkpoint(router_opts.route_checkpoint_file.c_str(), itry, pres_fac);
+            checkpoint_sched.mark();
         }
 
         if (router_congestion_mode == RouterCongestionMode::CONFLICTED) {
@@ -667,8 +862,9 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         }
 
         if (timing_info) {
-            if (itry == 1) {
+            if (itry == 1 || (resumed_from_checkpoint && itry == first_itry)) {
                 // first iteration sets up the lower bound connection delays since only timing is optimized for
+                // (when resuming from a checkpoint the delays of the restored routing serve as the bounds)
                 connections_inf.set_stable_critical_path_delay(critical_path.delay());
                 connections_inf.set_lower_bound_connection_delays(net_delay);
 
@@ -727,6 +923,10 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         // profiling::time_on_criticality_analysis();
     }
 
+    if (!router_opts.router_telemetry_file.empty()) {
+        telemetry::write_json(router_opts.router_telemetry_file.c_str());
+    }
+
     if (routing_is_successful) {
         VTR_LOG("Restoring best routing\n");
 
@@ -819,6 +1019,141 @@ bool try_timing_driven_route_net(ClusterNetId net_id,
     return (is_routed);
 }
 
+/* Routes one iteration's worth of nets using multiple worker threads.
+ *
+ * The nets are spatially partitioned (see route_net_partition.h) into groups
+ * whose bounding boxes fall in disjoint device regions, so concurrent workers
+ * never expand the same RR nodes or update the same congestion costs. Each
+ * worker uses its own (thread local) heap, route tree and trace allocators.
+ * Nets crossing partition boundaries are routed serially afterwards on the
+ * calling thread. The result is deterministic for a given worker count since
+ * the partition (not thread scheduling) decides which nets route together. */
+static bool try_timing_driven_route_nets_parallel(const std::vector<ClusterNetId>& sorted_nets,
+                                                  int itry,
+                                                  float pres_fac,
+                                                  const t_router_opts& router_opts,
+                                                  int partition_halo,
+                                                  CBRR& connections_inf,
+                                                  RouterStats& router_stats,
+                                                  timing_driven_route_structs& route_structs,
+                                                  vtr::vector<ClusterNetId, float*>& net_delay,
+                                                  const RouterLookahead& router_lookahead,
+                                                  const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                                  std::shared_ptr<SetupTimingInfo> route_timing_info,
+                                                  route_budgets& budgeting_inf,
+                                                  std::vector<ClusterNetId>& rerouted_nets) {
+    t_net_partitioning partitioning = partition_nets_by_route_bb(sorted_nets,
+                                                                 router_opts.router_num_workers,
+                                                                 partition_halo);
+
+    std::atomic<bool> all_routable(true);
+
+    auto route_net_group = [&](const std::vector<ClusterNetId>* group,
+                               RouterStats* group_stats,
+                               std::vector<ClusterNetId>* group_rerouted_nets) {
+        auto& device_ctx = g_vpr_ctx.device();
+
+        f_in_parallel_net_worker = true; //Suppress nested sink-level workers
+
+        init_heap(device_ctx.grid); //Worker's thread local heap
+        {
+            timing_driven_route_structs worker_route_structs; //Worker's thread local scratch
+
+            for (ClusterNetId net_id : *group) {
+                if (!all_routable.load(std::memory_order_relaxed)) break;
+
+                bool was_rerouted = false;
+                bool is_routable = try_timing_driven_route_net(net_id,
+                                                               itry,
+                                                               pres_fac,
+                                                               router_opts,
+                                                               connections_inf,
+                                                               *group_stats,
+                                                               worker_route_structs.pin_criticality,
+                                                               worker_route_structs.rt_node_of_sink,
+                                                               net_delay,
+                                                               router_lookahead,
+                                                               netlist_pin_lookup,
+                                                               route_timing_info,
+                                                               budgeting_inf,
+                                                               was_rerouted);
+
+                if (!is_routable) {
+                    all_routable.store(false, std::memory_order_relaxed);
+                    break;
+                }
+
+                if (was_rerouted) {
+                    group_rerouted_nets->push_back(net_id);
+                }
+            }
+        }
+        empty_heap();
+        free_heap_structs(); //Release the worker's heap memory before it exits
+    };
+
+    size_t num_groups = partitioning.independent_groups.size();
+    std::vector<RouterStats> group_stats(num_groups);
+    std::vector<std::vector<ClusterNetId>> group_rerouted_nets(num_groups);
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_groups);
+    for (size_t igroup = 0; igroup < num_groups; ++igroup) {
+        workers.emplace_back(route_net_group,
+                             &partitioning.independent_groups[igroup],
+                             &group_stats[igroup],
+                             &group_rerouted_nets[igroup]);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    //Merge worker results in (deterministic) group order
+    for (size_t igroup = 0; igroup < num_groups; ++igroup) {
+        router_stats.connections_routed += group_stats[igroup].connections_routed;
+        router_stats.nets_routed += group_stats[igroup].nets_routed;
+        router_stats.heap_pushes += group_stats[igroup].heap_pushes;
+        router_stats.heap_pops += group_stats[igroup].heap_pops;
+
+        rerouted_nets.insert(rerouted_nets.end(),
+                             group_rerouted_nets[igroup].begin(),
+                             group_rerouted_nets[igroup].end());
+    }
+
+    if (!all_routable) {
+        return false;
+    }
+
+    //Route the boundary-crossing nets serially on this thread
+    for (ClusterNetId net_id : partitioning.serial_nets) {
+        bool was_rerouted = false;
+        bool is_routable = try_timing_driven_route_net(net_id,
+                                                       itry,
+                                                       pres_fac,
+                                                       router_opts,
+                                                       connections_inf,
+                                                       router_stats,
+                                                       route_structs.pin_criticality,
+                                                       route_structs.rt_node_of_sink,
+                                                       net_delay,
+                                                       router_lookahead,
+                                                       netlist_pin_lookup,
+                                                       route_timing_info,
+                                                       budgeting_inf,
+                                                       was_rerouted);
+
+        if (!is_routable) {
+            return false;
+        }
+
+        if (was_rerouted) {
+            rerouted_nets.push_back(net_id);
+        }
+    }
+
+    return true;
+}
+
 /*
  * NOTE:
  * Suggest using a timing_driven_route_structs struct. Memory is managed for you
@@ -958,6 +1293,13 @@ bool timing_driven_route_net(ClusterNetId net_id,
     auto& remaining_targets = connections_inf.get_remaining_targets();
 
     // calculate criticality of remaining target pins
+    //
+    // Criticality exponentiation uses a sampled look-up table, since a libm
+    // pow call per connection per iteration is comparatively expensive. The
+    // table is thread local since nets may be routed by parallel workers.
+    static thread_local vtr::PowTable crit_pow_table;
+    crit_pow_table.set_exponent(router_opts.criticality_exp);
+
     for (int ipin : remaining_targets) {
         if (timing_info) {
             auto clb_pin = cluster_ctx.clb_nlist.net_pin(net_id, ipin);
@@ -973,7 +1315,7 @@ bool timing_driven_route_net(ClusterNetId net_id,
             pin_criticality[ipin] = std::max(pin_criticality[ipin] - (1.0 - router_opts.max_criticality), 0.0);
 
             /* Take pin criticality to some power (1 by default). */
-            pin_criticality[ipin] = std::pow(pin_criticality[ipin], router_opts.criticality_exp);
+            pin_criticality[ipin] = crit_pow_table(pin_criticality[ipin]);
 
             /* Cut off pin criticality at max_criticality. */
             pin_criticality[ipin] = std::min(pin_criticality[ipin], router_opts.max_criticality);
@@ -995,38 +1337,60 @@ bool timing_driven_route_net(ClusterNetId net_id,
     cost_params.bend_cost = router_opts.bend_cost;
     cost_params.delay_budget = ((budgeting_inf.if_set()) ? &conn_delay_budget : nullptr);
 
-    // explore in order of decreasing criticality (no longer need sink_order array)
-    for (unsigned itarget = 0; itarget < remaining_targets.size(); ++itarget) {
-        int target_pin = remaining_targets[itarget];
+    //Monster fanout nets (e.g. clock-like signals with tens of thousands of
+    //sinks) can dominate a routing iteration, so their sinks are routed by
+    //concurrent connection searches when multiple workers are available.
+    bool parallel_sinks = (router_opts.router_num_workers > 1
+                           && !f_in_parallel_net_worker
+                           && remaining_targets.size() >= MIN_FANOUT_PARALLEL_SINK_ROUTING);
+
+    if (parallel_sinks) {
+        if (!timing_driven_route_sinks_parallel(net_id,
+                                                remaining_targets,
+                                                pin_criticality,
+                                                cost_params,
+                                                pres_fac,
+                                                router_opts,
+                                                rt_root, rt_node_of_sink,
+                                                router_lookahead,
+                                                spatial_route_tree_lookup,
+                                                budgeting_inf,
+                                                router_stats))
+            return false;
+    } else {
+        // explore in order of decreasing criticality (no longer need sink_order array)
+        for (unsigned itarget = 0; itarget < remaining_targets.size(); ++itarget) {
+            int target_pin = remaining_targets[itarget];
 
-        int sink_rr = route_ctx.net_rr_terminals[net_id][target_pin];
+            int sink_rr = route_ctx.net_rr_terminals[net_id][target_pin];
 
-        enable_router_debug(router_opts, net_id, sink_rr);
+            enable_router_debug(router_opts, net_id, sink_rr);
 
-        cost_params.criticality = pin_criticality[target_pin];
+            cost_params.criticality = pin_criticality[target_pin];
 
-        if (budgeting_inf.if_set()) {
-            conn_delay_budget.max_delay = budgeting_inf.get_max_delay_budget(net_id, target_pin);
-            conn_delay_budget.target_delay = budgeting_inf.get_delay_target(net_id, target_pin);
-            conn_delay_budget.min_delay = budgeting_inf.get_min_delay_budget(net_id, target_pin);
-            conn_delay_budget.short_path_criticality = budgeting_inf.get_crit_short_path(net_id, target_pin);
-        }
+            if (budgeting_inf.if_set()) {
+                conn_delay_budget.max_delay = budgeting_inf.get_max_delay_budget(net_id, target_pin);
+                conn_delay_budget.target_delay = budgeting_inf.get_delay_target(net_id, target_pin);
+                conn_delay_budget.min_delay = budgeting_inf.get_min_delay_budget(net_id, target_pin);
+                conn_delay_budget.short_path_criticality = budgeting_inf.get_crit_short_path(net_id, target_pin);
+            }
 
-        // build a branch in the route tree to the target
-        if (!timing_driven_route_sink(net_id,
-                                      itarget,
-                                      target_pin,
-                                      cost_params,
-                                      pres_fac,
-                                      router_opts.high_fanout_threshold,
-                                      rt_root, rt_node_of_sink,
-                                      router_lookahead,
-                                      spatial_route_tree_lookup,
-                                      router_stats))
-            return false;
+            // build a branch in the route tree to the target
+            if (!timing_driven_route_sink(net_id,
+                                          itarget,
+                                          target_pin,
+                                          cost_params,
+                                          pres_fac,
+                                          router_opts.high_fanout_threshold,
+                                          rt_root, rt_node_of_sink,
+                                          router_lookahead,
+                                          spatial_route_tree_lookup,
+                                          router_stats))
+                return false;
 
-        ++router_stats.connections_routed;
-    } // finished all sinks
+            ++router_stats.connections_routed;
+        } // finished all sinks
+    }
 
     ++router_stats.nets_routed;
 
@@ -1069,19 +1433,19 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
 
     profiling::sink_criticality_start();
 
+    size_t heap_pops_before = router_stats.heap_pops;
+
     int sink_node = route_ctx.net_rr_terminals[net_id][target_pin];
 
     VTR_LOGV_DEBUG(f_router_debug, "Net %zu Target %d (%s)\n", size_t(net_id), itarget, describe_rr_node(sink_node).c_str());
 
     VTR_ASSERT_DEBUG(verify_traceback_route_tree_equivalent(route_ctx.trace[net_id].head, rt_root));
 
-    std::vector<int> modified_rr_node_inf;
     t_heap* cheapest = nullptr;
     t_bb bounding_box = route_ctx.route_bb[net_id];
 
     bool net_is_global = cluster_ctx.clb_nlist.net_is_global(net_id);
     bool high_fanout = is_high_fanout(cluster_ctx.clb_nlist.net_sinks(net_id).size(), high_fanout_threshold);
-    constexpr float HIGH_FANOUT_CRITICALITY_THRESHOLD = 0.9;
     bool sink_critical = (cost_params.criticality > HIGH_FANOUT_CRITICALITY_THRESHOLD);
 
     //We normally route high fanout nets by only adding spatially close-by routing to the heap (reduces run-time).
@@ -1094,7 +1458,6 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
                                                                               bounding_box,
                                                                               router_lookahead,
                                                                               spatial_rt_lookup,
-                                                                              modified_rr_node_inf,
                                                                               router_stats);
     } else {
         cheapest = timing_driven_route_connection_from_route_tree(rt_root,
@@ -1102,7 +1465,6 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
                                                                   cost_params,
                                                                   bounding_box,
                                                                   router_lookahead,
-                                                                  modified_rr_node_inf,
                                                                   router_stats);
     }
 
@@ -1120,16 +1482,15 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
         return false;
     } else {
         //Record final link to target
-        add_to_mod_list(cheapest->index, modified_rr_node_inf);
-
         route_ctx.rr_node_route_inf[cheapest->index].prev_node = cheapest->u.prev.node;
         route_ctx.rr_node_route_inf[cheapest->index].prev_edge = cheapest->u.prev.edge;
-        route_ctx.rr_node_route_inf[cheapest->index].path_cost = cheapest->cost;
-        route_ctx.rr_node_route_inf[cheapest->index].backward_path_cost = cheapest->backward_path_cost;
+        set_rr_path_costs(cheapest->index, cheapest->cost, cheapest->backward_path_cost);
     }
 
     profiling::sink_criticality_end(cost_params.criticality);
 
+    telemetry::record_connection(router_stats.heap_pops - heap_pops_before, get_heap_occupancy());
+
     /* NB:  In the code below I keep two records of the partial routing:  the   *
      * traceback and the route_tree.  The route_tree enables fast recomputation *
      * of the Elmore delay to each node in the partial routing.  The traceback  *
@@ -1152,14 +1513,223 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
     pathfinder_update_path_cost(new_route_start_tptr, 1, pres_fac);
     empty_heap();
 
-    // need to guarentee ALL nodes' path costs are HUGE_POSITIVE_FLOAT at the start of routing to a sink
-    // do this by resetting all the path_costs that have been touched while routing to the current sink
-    reset_path_costs(modified_rr_node_inf);
+    // the path costs stamped while routing to this sink become stale (i.e. logically
+    // HUGE_POSITIVE_FLOAT) when the next search advances the path search epoch
 
     // routed to a sink successfully
     return true;
 }
 
+/* Routes all remaining sinks of a monster fanout net using concurrent connection
+ * searches.
+ *
+ * Sinks are processed (in decreasing criticality order) in rounds of up to
+ * router_num_workers. Within a round each worker runs an independent connection
+ * search from the current route tree using its own thread local heap and path
+ * search epoch, so the effective priority order is simply the relaxed union of
+ * the per-worker heaps. Workers ignore each other's path cost stamps (their
+ * epochs differ), but they do race on the prev_node/prev_edge fields of RR nodes
+ * explored by more than one search. The race is benign for the searches
+ * themselves (costs only steer expansion order), but a returned path may record
+ * a hop overwritten by another worker, so each path is structurally validated
+ * before being merged; a path which fails validation (or a search which finds no
+ * path) falls back to the ordinary serial search for that sink.
+ *
+ * Paths are merged into the traceback and route tree on the calling thread, in
+ * criticality order, after all workers of the round have joined -- so the result
+ * is deterministic up to which sinks needed the serial fallback. Sinks of the
+ * same round connect to the route tree as it existed at the start of the round;
+ * later rounds see all previously merged branches. */
+static bool timing_driven_route_sinks_parallel(ClusterNetId net_id,
+                                               const std::vector<int>& remaining_targets,
+                                               const float* pin_criticality,
+                                               const t_conn_cost_params cost_params,
+                                               float pres_fac,
+                                               const t_router_opts& router_opts,
+                                               t_rt_node* rt_root,
+                                               t_rt_node** rt_node_of_sink,
+                                               const RouterLookahead& router_lookahead,
+                                               SpatialRouteTreeLookup& spatial_rt_lookup,
+                                               route_budgets& budgeting_inf,
+                                               RouterStats& router_stats) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    bool high_fanout = is_high_fanout(cluster_ctx.clb_nlist.net_sinks(net_id).size(), router_opts.high_fanout_threshold);
+    bool net_is_global = cluster_ctx.clb_nlist.net_is_global(net_id);
+
+    size_t num_workers = router_opts.router_num_workers;
+
+    for (size_t round_start = 0; round_start < remaining_targets.size(); round_start += num_workers) {
+        size_t round_size = std::min(num_workers, remaining_targets.size() - round_start);
+
+        std::vector<t_conn_cost_params> sink_cost_params(round_size, cost_params);
+        std::vector<t_conn_delay_budget> sink_delay_budgets(round_size);
+        std::vector<t_heap> sink_paths(round_size);
+        std::vector<char> sink_path_found(round_size, false); //Not vector<bool>: written concurrently
+        std::vector<RouterStats> worker_stats(round_size);
+
+        for (size_t isink = 0; isink < round_size; ++isink) {
+            int target_pin = remaining_targets[round_start + isink];
+
+            sink_cost_params[isink].criticality = pin_criticality[target_pin];
+
+            if (budgeting_inf.if_set()) {
+                sink_delay_budgets[isink].max_delay = budgeting_inf.get_max_delay_budget(net_id, target_pin);
+                sink_delay_budgets[isink].target_delay = budgeting_inf.get_delay_target(net_id, target_pin);
+                sink_delay_budgets[isink].min_delay = budgeting_inf.get_min_delay_budget(net_id, target_pin);
+                sink_delay_budgets[isink].short_path_criticality = budgeting_inf.get_crit_short_path(net_id, target_pin);
+                sink_cost_params[isink].delay_budget = &sink_delay_budgets[isink];
+            }
+        }
+
+        auto search_sink = [&](size_t isink) {
+            auto& device_ctx = g_vpr_ctx.device();
+
+            init_heap(device_ctx.grid); //Worker's thread local heap
+
+            int target_pin = remaining_targets[round_start + isink];
+            int sink_node = route_ctx.net_rr_terminals[net_id][target_pin];
+            t_bb bounding_box = route_ctx.route_bb[net_id];
+
+            bool sink_critical = (sink_cost_params[isink].criticality > HIGH_FANOUT_CRITICALITY_THRESHOLD);
+
+            t_heap* cheapest = nullptr;
+            if (high_fanout && !sink_critical && !net_is_global) {
+                cheapest = timing_driven_route_connection_from_route_tree_high_fanout(rt_root,
+                                                                                      sink_node,
+                                                                                      sink_cost_params[isink],
+                                                                                      bounding_box,
+                                                                                      router_lookahead,
+                                                                                      spatial_rt_lookup,
+                                                                                      worker_stats[isink]);
+            } else {
+                cheapest = timing_driven_route_connection_from_route_tree(rt_root,
+                                                                          sink_node,
+                                                                          sink_cost_params[isink],
+                                                                          bounding_box,
+                                                                          router_lookahead,
+                                                                          worker_stats[isink]);
+            }
+
+            if (cheapest != nullptr) {
+                sink_paths[isink] = *cheapest; //Copy out: the t_heap itself lives in the worker's heap pool
+                sink_path_found[isink] = true;
+                free_heap_data(cheapest);
+            }
+
+            telemetry::record_connection(worker_stats[isink].heap_pops, get_heap_occupancy());
+
+            empty_heap();
+            free_heap_structs(); //Release the worker's heap memory before it exits
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(round_size);
+        for (size_t isink = 0; isink < round_size; ++isink) {
+            workers.emplace_back(search_sink, isink);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        //Merge the found paths in criticality (not completion) order
+        for (size_t isink = 0; isink < round_size; ++isink) {
+            router_stats.heap_pushes += worker_stats[isink].heap_pushes;
+            router_stats.heap_pops += worker_stats[isink].heap_pops;
+
+            int target_pin = remaining_targets[round_start + isink];
+
+            if (sink_path_found[isink] && sink_path_is_valid(&sink_paths[isink], net_id)) {
+                t_heap path = sink_paths[isink];
+
+                //Record final link to target
+                route_ctx.rr_node_route_inf[path.index].prev_node = path.u.prev.node;
+                route_ctx.rr_node_route_inf[path.index].prev_edge = path.u.prev.edge;
+                set_rr_path_costs(path.index, path.cost, path.backward_path_cost);
+
+                route_ctx.rr_node_route_inf[path.index].target_flag--; /* Connected to this SINK. */
+                t_trace* new_route_start_tptr = update_traceback(&path, net_id);
+                VTR_ASSERT_DEBUG(validate_traceback(route_ctx.trace[net_id].head));
+
+                rt_node_of_sink[target_pin] = update_route_tree(&path, ((high_fanout) ? &spatial_rt_lookup : nullptr));
+                VTR_ASSERT_DEBUG(verify_route_tree(rt_root));
+
+                pathfinder_update_path_cost(new_route_start_tptr, 1, pres_fac);
+            } else {
+                //Either the concurrent search failed, or its recorded path was
+                //clobbered by another worker of this round: redo the sink with
+                //the ordinary serial search
+                if (!timing_driven_route_sink(net_id,
+                                              round_start + isink,
+                                              target_pin,
+                                              sink_cost_params[isink],
+                                              pres_fac,
+                                              router_opts.high_fanout_threshold,
+                                              rt_root, rt_node_of_sink,
+                                              router_lookahead,
+                                              spatial_rt_lookup,
+                                              router_stats))
+                    return false;
+            }
+
+            ++router_stats.connections_routed;
+        }
+    }
+
+    return true;
+}
+
+/* Checks that the prev_node/prev_edge chain recorded by a concurrent connection
+ * search still forms a real path through the RR graph back to the net's existing
+ * routing. Another worker of the same round may have overwritten hops of the
+ * chain; such a path must be re-routed serially (it is no guarantee the spliced
+ * chain reaches the route tree, or even terminates). */
+static bool sink_path_is_valid(const t_heap* path, ClusterNetId net_id) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+    const auto& trace_nodes = route_ctx.trace_nodes[net_id];
+
+    int inode = path->index;
+    int prev_node = path->u.prev.node;
+    int prev_edge = path->u.prev.edge;
+
+    //A legitimate path has at most as many hops as there are RR nodes; a longer
+    //walk means cross-worker writes spliced the chain into a cycle
+    size_t max_hops = device_ctx.rr_nodes.size();
+
+    for (size_t hops = 0; hops < max_hops; ++hops) {
+        if (trace_nodes.count(inode)) {
+            return true; //Reached the net's existing routing
+        }
+
+        if (prev_node == NO_PREVIOUS) {
+            //Only nodes seeded from the route tree carry NO_PREVIOUS, so this is
+            //a valid terminus iff nothing has been put in the traceback yet (the
+            //first connection of a net walks all the way back to the SOURCE)
+            return (route_ctx.trace[net_id].head == nullptr);
+        }
+
+        if (prev_node < 0 || prev_node >= (int)device_ctx.rr_nodes.size()) {
+            return false;
+        }
+
+        //The recorded edge must really connect prev_node to inode
+        if (prev_edge < 0 || prev_edge >= (int)device_ctx.rr_nodes[prev_node].num_edges()) {
+            return false;
+        }
+        if (device_ctx.rr_nodes[prev_node].edge_sink_node(prev_edge) != inode) {
+            return false;
+        }
+
+        inode = prev_node;
+        prev_node = route_ctx.rr_node_route_inf[inode].prev_node;
+        prev_edge = route_ctx.rr_node_route_inf[inode].prev_edge;
+    }
+
+    return false; //Cyclic chain
+}
+
 //Finds a path from the route tree rooted at rt_root to sink_node
 //
 //This is used when you want to allow previous routing of the same net to serve
@@ -1171,8 +1741,11 @@ t_heap* timing_driven_route_connection_from_route_tree(t_rt_node* rt_root,
                                                        const t_conn_cost_params cost_params,
                                                        t_bb bounding_box,
                                                        const RouterLookahead& router_lookahead,
-                                                       std::vector<int>& modified_rr_node_inf,
                                                        RouterStats& router_stats) {
+    //Start a fresh path search: any path costs stamped by previous searches
+    //are now treated as infinite
+    reset_path_costs();
+
     // re-explore route tree from root to add any new nodes (buildheap afterwards)
     // route tree needs to be repushed onto the heap since each node's cost is target specific
     add_route_tree_to_heap(rt_root, sink_node, cost_params, router_lookahead, router_stats);
@@ -1180,6 +1753,10 @@ t_heap* timing_driven_route_connection_from_route_tree(t_rt_node* rt_root,
 
     int source_node = rt_root->inode;
 
+    if (connection_trace_active()) {
+        trace_connection_search(source_node, sink_node, bounding_box, cost_params.criticality);
+    }
+
     if (is_empty_heap()) {
         VTR_LOG("No source in route tree: %s\n", describe_unrouteable_connection(source_node, sink_node).c_str());
 
@@ -1195,53 +1772,73 @@ t_heap* timing_driven_route_connection_from_route_tree(t_rt_node* rt_root,
                                                                 cost_params,
                                                                 bounding_box,
                                                                 router_lookahead,
-                                                                modified_rr_node_inf,
                                                                 router_stats);
 
     if (cheapest == nullptr) {
-        //Found no path found within the current bounding box.
-        //Try again with no bounding box (i.e. a full device grid bounding box).
+        //Found no path within the current bounding box.
+        //Retry this connection with progressively larger bounding boxes, rather
+        //than jumping straight to the full device grid (which would make the
+        //fall-back search as slow as possible) or requiring --bb_factor to be
+        //raised globally (which would slow down every net's search).
         //
         //Note that the additional run-time overhead of re-trying only occurs
         //when we were otherwise going to give up -- the typical case (route
         //found with the bounding box) remains fast and never re-tries .
-        VTR_LOG_WARN("No routing path for connection to sink_rr %d, retrying with full device bounding box\n", sink_node);
-
-        auto& device_ctx = g_vpr_ctx.device();
-
-        t_bb full_device_bounding_box;
-        full_device_bounding_box.xmin = 0;
-        full_device_bounding_box.ymin = 0;
-        full_device_bounding_box.xmax = device_ctx.grid.width() - 1;
-        full_device_bounding_box.ymax = device_ctx.grid.height() - 1;
-
         //
         //TODO: potential future optimization
         //      We have already explored the RR nodes accessible within the regular
-        //      BB (which are stored in modified_rr_node_inf), and so already know
-        //      their cost from the source. Instead of re-starting the path search
-        //      from scratch (i.e. from the previous route tree as we do below), we
-        //      could just re-add all the explored nodes to the heap and continue
-        //      expanding.
+        //      BB, and so already know their cost from the source. Instead of
+        //      re-starting the path search from scratch (i.e. from the previous
+        //      route tree as we do below), we could just re-add all the explored
+        //      nodes to the heap and continue expanding.
         //
 
-        //Reset any previously recorded node costs so that when we call
-        //add_route_tree_to_heap() the nodes in the route tree actually
-        //make it back into the heap.
-        reset_path_costs(modified_rr_node_inf);
-        modified_rr_node_inf.clear();
+        auto& device_ctx = g_vpr_ctx.device();
+
+        //The expansion margin starts small and doubles on each failed retry,
+        //so connections needing just a little more room stay fast while
+        //pathological ones still fall back to (at worst) the full device grid
+        constexpr int INITIAL_BB_EXPANSION = 3;
+
+        int bb_expansion = INITIAL_BB_EXPANSION;
+        while (cheapest == nullptr) {
+            t_bb expanded_bounding_box;
+            expanded_bounding_box.xmin = std::max(bounding_box.xmin - bb_expansion, 0);
+            expanded_bounding_box.ymin = std::max(bounding_box.ymin - bb_expansion, 0);
+            expanded_bounding_box.xmax = std::min<int>(bounding_box.xmax + bb_expansion, device_ctx.grid.width() - 1);
+            expanded_bounding_box.ymax = std::min<int>(bounding_box.ymax + bb_expansion, device_ctx.grid.height() - 1);
+
+            VTR_LOG_WARN("No routing path for connection to sink_rr %d, retrying with bounding box expanded by %d: (%d,%d) x (%d,%d)\n",
+                         sink_node, bb_expansion,
+                         expanded_bounding_box.xmin, expanded_bounding_box.ymin,
+                         expanded_bounding_box.xmax, expanded_bounding_box.ymax);
+
+            //Reset any previously recorded node costs so that when we call
+            //add_route_tree_to_heap() the nodes in the route tree actually
+            //make it back into the heap.
+            reset_path_costs();
+
+            //Re-initialize the heap since it was emptied by the previous call to
+            //timing_driven_route_connection_from_heap()
+            add_route_tree_to_heap(rt_root, sink_node, cost_params, router_lookahead, router_stats);
+            heap_::build_heap();
+
+            //Try finding the path again with the relaxed bounding box
+            cheapest = timing_driven_route_connection_from_heap(sink_node,
+                                                                cost_params,
+                                                                expanded_bounding_box,
+                                                                router_lookahead,
+                                                                router_stats);
 
-        //Re-initialize the heap since it was emptied by the previous call to
-        //timing_driven_route_connection_from_heap()
-        add_route_tree_to_heap(rt_root, sink_node, cost_params, router_lookahead, router_stats);
+            if (expanded_bounding_box.xmin == 0
+                && expanded_bounding_box.ymin == 0
+                && expanded_bounding_box.xmax == int(device_ctx.grid.width()) - 1
+                && expanded_bounding_box.ymax == int(device_ctx.grid.height()) - 1) {
+                break; //Already searched the full device grid
+            }
 
-        //Try finding the path again with the relaxed bounding box
-        cheapest = timing_driven_route_connection_from_heap(sink_node,
-                                                            cost_params,
-                                                            full_device_bounding_box,
-                                                            router_lookahead,
-                                                            modified_rr_node_inf,
-                                                            router_stats);
+            bb_expansion *= 2;
+        }
     }
 
     if (cheapest == nullptr) {
@@ -1264,8 +1861,11 @@ static t_heap* timing_driven_route_connection_from_route_tree_high_fanout(t_rt_n
                                                                           t_bb net_bounding_box,
                                                                           const RouterLookahead& router_lookahead,
                                                                           const SpatialRouteTreeLookup& spatial_rt_lookup,
-                                                                          std::vector<int>& modified_rr_node_inf,
                                                                           RouterStats& router_stats) {
+    //Start a fresh path search: any path costs stamped by previous searches
+    //are now treated as infinite
+    reset_path_costs();
+
     // re-explore route tree from root to add any new nodes (buildheap afterwards)
     // route tree needs to be repushed onto the heap since each node's cost is target specific
     t_bb high_fanout_bb = add_high_fanout_route_tree_to_heap(rt_root, sink_node, cost_params, router_lookahead, spatial_rt_lookup, net_bounding_box, router_stats);
@@ -1273,6 +1873,10 @@ static t_heap* timing_driven_route_connection_from_route_tree_high_fanout(t_rt_n
 
     int source_node = rt_root->inode;
 
+    if (connection_trace_active()) {
+        trace_connection_search(source_node, sink_node, high_fanout_bb, cost_params.criticality);
+    }
+
     if (is_empty_heap()) {
         VTR_LOG("No source in route tree: %s\n", describe_unrouteable_connection(source_node, sink_node).c_str());
 
@@ -1288,7 +1892,6 @@ static t_heap* timing_driven_route_connection_from_route_tree_high_fanout(t_rt_n
                                                                 cost_params,
                                                                 high_fanout_bb,
                                                                 router_lookahead,
-                                                                modified_rr_node_inf,
                                                                 router_stats);
 
     if (cheapest == nullptr) {
@@ -1296,17 +1899,14 @@ static t_heap* timing_driven_route_connection_from_route_tree_high_fanout(t_rt_n
         //try again with the full route tree to be sure this is not an artifact of high-fanout routing
         VTR_LOG_WARN("No routing path found in high-fanout mode for net connection (to sink_rr %d), retrying with full route tree\n", sink_node);
 
-        //Reset any previously recorded node costs so timing_driven_route_connection()
+        //timing_driven_route_connection_from_route_tree() advances the path
+        //search epoch, so the node costs recorded above are ignored and it
         //starts over from scratch.
-        reset_path_costs(modified_rr_node_inf);
-        modified_rr_node_inf.clear();
-
         cheapest = timing_driven_route_connection_from_route_tree(rt_root,
                                                                   sink_node,
                                                                   cost_params,
                                                                   net_bounding_box,
                                                                   router_lookahead,
-                                                                  modified_rr_node_inf,
                                                                   router_stats);
     }
 
@@ -1329,7 +1929,6 @@ static t_heap* timing_driven_route_connection_from_heap(int sink_node,
                                                         const t_conn_cost_params cost_params,
                                                         t_bb bounding_box,
                                                         const RouterLookahead& router_lookahead,
-                                                        std::vector<int>& modified_rr_node_inf,
                                                         RouterStats& router_stats) {
     VTR_ASSERT_SAFE(heap_::is_valid());
 
@@ -1359,7 +1958,6 @@ static t_heap* timing_driven_route_connection_from_heap(int sink_node,
                                       cost_params,
                                       bounding_box,
                                       router_lookahead,
-                                      modified_rr_node_inf,
                                       router_stats);
 
         free_heap_data(cheapest);
@@ -1378,8 +1976,11 @@ static t_heap* timing_driven_route_connection_from_heap(int sink_node,
 std::vector<t_heap> timing_driven_find_all_shortest_paths_from_route_tree(t_rt_node* rt_root,
                                                                           const t_conn_cost_params cost_params,
                                                                           t_bb bounding_box,
-                                                                          std::vector<int>& modified_rr_node_inf,
                                                                           RouterStats& router_stats) {
+    //Start a fresh path search: any path costs stamped by previous searches
+    //are now treated as infinite
+    reset_path_costs();
+
     //Add the route tree to the heap with no specific target node
     int target_node = OPEN;
     auto router_lookahead = make_router_lookahead(e_router_lookahead::NO_OP,
@@ -1388,7 +1989,7 @@ std::vector<t_heap> timing_driven_find_all_shortest_paths_from_route_tree(t_rt_n
     add_route_tree_to_heap(rt_root, target_node, cost_params, *router_lookahead, router_stats);
     heap_::build_heap(); // via sifting down everything
 
-    auto res = timing_driven_find_all_shortest_paths_from_heap(cost_params, bounding_box, modified_rr_node_inf, router_stats);
+    auto res = timing_driven_find_all_shortest_paths_from_heap(cost_params, bounding_box, router_stats);
 
     return res;
 }
@@ -1402,7 +2003,6 @@ std::vector<t_heap> timing_driven_find_all_shortest_paths_from_route_tree(t_rt_n
 //no-operation lookahead which always returns zero.
 static std::vector<t_heap> timing_driven_find_all_shortest_paths_from_heap(const t_conn_cost_params cost_params,
                                                                            t_bb bounding_box,
-                                                                           std::vector<int>& modified_rr_node_inf,
                                                                            RouterStats& router_stats) {
     auto router_lookahead = make_router_lookahead(e_router_lookahead::NO_OP,
                                                   /*write_lookahead=*/"", /*read_lookahead=*/"",
@@ -1438,7 +2038,6 @@ static std::vector<t_heap> timing_driven_find_all_shortest_paths_from_heap(const
                                       cost_params,
                                       bounding_box,
                                       *router_lookahead,
-                                      modified_rr_node_inf,
                                       router_stats);
 
         if (cheapest_paths[inode].index == OPEN || cheapest_paths[inode].cost >= cheapest->cost) {
@@ -1459,14 +2058,13 @@ static void timing_driven_expand_cheapest(t_heap* cheapest,
                                           const t_conn_cost_params cost_params,
                                           t_bb bounding_box,
                                           const RouterLookahead& router_lookahead,
-                                          std::vector<int>& modified_rr_node_inf,
                                           RouterStats& router_stats) {
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     int inode = cheapest->index;
 
-    float old_total_cost = route_ctx.rr_node_route_inf[inode].path_cost;
-    float old_back_cost = route_ctx.rr_node_route_inf[inode].backward_path_cost;
+    float old_total_cost = get_rr_path_cost(inode);
+    float old_back_cost = get_rr_backward_path_cost(inode);
 
     float new_total_cost = cheapest->cost;
     float new_back_cost = cheapest->backward_path_cost;
@@ -1485,12 +2083,9 @@ static void timing_driven_expand_cheapest(t_heap* cheapest,
         VTR_LOGV_DEBUG(f_router_debug, "    New back cost: %g\n", new_back_cost);
         VTR_LOGV_DEBUG(f_router_debug, "      Setting path costs for assicated node %d (from %d edge %d)\n", cheapest->index, cheapest->u.prev.node, cheapest->u.prev.edge);
 
-        add_to_mod_list(cheapest->index, modified_rr_node_inf);
-
         route_ctx.rr_node_route_inf[cheapest->index].prev_node = cheapest->u.prev.node;
         route_ctx.rr_node_route_inf[cheapest->index].prev_edge = cheapest->u.prev.edge;
-        route_ctx.rr_node_route_inf[cheapest->index].path_cost = new_total_cost;
-        route_ctx.rr_node_route_inf[cheapest->index].backward_path_cost = new_back_cost;
+        set_rr_path_costs(cheapest->index, new_total_cost, new_back_cost);
 
         timing_driven_expand_neighbours(cheapest, cost_params, bounding_box,
                                         router_lookahead,
@@ -1524,8 +2119,11 @@ static t_rt_node* setup_routing_resources(int itry,
 
     t_rt_node* rt_root;
 
-    // for nets below a certain size (min_incremental_reroute_fanout), rip up any old routing
-    // otherwise, we incrementally reroute by reusing legal parts of the previous iteration
+    // for nets below a certain size (min_incremental_reroute_fanout, by default only
+    // single-sink nets), rip up any old routing
+    // otherwise, we incrementally reroute by reusing legal parts of the previous iteration:
+    // only the congested (and timing-degraded, see prune_route_tree) connections are ripped
+    // up, so legal sinks' branches stay intact across iterations
     // convert the previous iteration's traceback into the starting route tree for this iteration
     if ((int)num_sinks < min_incremental_reroute_fanout || itry == 1) {
         profiling::net_rerouted();
@@ -1628,6 +2226,8 @@ static t_rt_node* setup_routing_resources(int itry,
         load_route_tree_Tdel(rt_root, 0);
 
         // mark the lookup (rr_node_route_inf) for existing tree elements as NO_PREVIOUS so add_to_path stops when it reaches one of them
+        // advance the path search epoch first so the costs stamped by earlier searches read as unset
+        reset_path_costs();
         load_route_tree_rr_route_inf(rt_root);
     }
 
@@ -1685,8 +2285,8 @@ static t_bb add_high_fanout_route_tree_to_heap(t_rt_node* rt_root, int target_no
     //Determine which bin the target node is located in
     auto& target_rr_node = device_ctx.rr_nodes[target_node];
 
-    int target_bin_x = grid_to_bin_x(target_rr_node.xlow(), spatial_rt_lookup);
-    int target_bin_y = grid_to_bin_y(target_rr_node.ylow(), spatial_rt_lookup);
+    int target_bin_x = spatial_rt_lookup.grid_to_bin_x(target_rr_node.xlow());
+    int target_bin_y = spatial_rt_lookup.grid_to_bin_y(target_rr_node.ylow());
 
     int nodes_added = 0;
 
@@ -1696,69 +2296,89 @@ static t_bb add_high_fanout_route_tree_to_heap(t_rt_node* rt_root, int target_no
     highfanout_bb.ymin = target_rr_node.ylow();
     highfanout_bb.ymax = target_rr_node.yhigh();
 
-    //Add existing routing starting from the target bin.
-    //If the target's bin has insufficient existing routing add from the surrounding bins
-    bool done = false;
-    for (int dx : {0, -1, +1}) {
-        size_t bin_x = target_bin_x + dx;
+    //Add existing routing starting from the target bin and working outwards
+    //in bin rings. Ring 0 is the target's own bin; each further ring adds the
+    //perimeter of bins at that (Chebyshev) distance. Expanding ring by ring
+    //makes the seeded window adapt to how close the existing routing actually
+    //is: dense regions stop at the 3x3 neighbourhood as before, while sparse
+    //regions widen the window instead of falling off a cliff onto the entire
+    //route tree.
+    int max_ring = int(std::max(spatial_rt_lookup.num_bins_x(), spatial_rt_lookup.num_bins_y()));
+    int ring_used = 0;
+    for (int ring = 0; ring <= max_ring; ++ring) {
+        for (int dx = -ring; dx <= ring; ++dx) {
+            size_t bin_x = target_bin_x + dx;
 
-        if (bin_x > spatial_rt_lookup.dim_size(0) - 1) continue; //Out of range
+            if (bin_x > spatial_rt_lookup.num_bins_x() - 1) continue; //Out of range
 
-        for (int dy : {0, -1, +1}) {
-            size_t bin_y = target_bin_y + dy;
+            for (int dy = -ring; dy <= ring; ++dy) {
+                if (std::max(std::abs(dx), std::abs(dy)) != ring) continue; //Interior bins were visited on earlier rings
 
-            if (bin_y > spatial_rt_lookup.dim_size(1) - 1) continue; //Out of range
+                size_t bin_y = target_bin_y + dy;
 
-            for (t_rt_node* rt_node : spatial_rt_lookup[bin_x][bin_y]) {
-                if (!rt_node->re_expand) continue; //Some nodes (like IPINs) shouldn't be re-expanded
+                if (bin_y > spatial_rt_lookup.num_bins_y() - 1) continue; //Out of range
 
-                //Put the node onto the heap
-                add_route_tree_node_to_heap(rt_node, target_node, cost_params, router_lookahead, router_stats);
+                for (t_rt_node* rt_node : spatial_rt_lookup.bin_nodes(bin_x, bin_y)) {
+                    if (!rt_node->re_expand) continue; //Some nodes (like IPINs) shouldn't be re-expanded
 
-                //Update Bounding Box
-                auto& rr_node = device_ctx.rr_nodes[rt_node->inode];
-                highfanout_bb.xmin = std::min<int>(highfanout_bb.xmin, rr_node.xlow());
-                highfanout_bb.ymin = std::min<int>(highfanout_bb.ymin, rr_node.ylow());
-                highfanout_bb.xmax = std::max<int>(highfanout_bb.xmax, rr_node.xhigh());
-                highfanout_bb.ymax = std::max<int>(highfanout_bb.ymax, rr_node.yhigh());
+                    //Put the node onto the heap
+                    add_route_tree_node_to_heap(rt_node, target_node, cost_params, router_lookahead, router_stats);
 
-                ++nodes_added;
-            }
+                    //Update Bounding Box
+                    auto& rr_node = device_ctx.rr_nodes[rt_node->inode];
+                    highfanout_bb.xmin = std::min<int>(highfanout_bb.xmin, rr_node.xlow());
+                    highfanout_bb.ymin = std::min<int>(highfanout_bb.ymin, rr_node.ylow());
+                    highfanout_bb.xmax = std::max<int>(highfanout_bb.xmax, rr_node.xhigh());
+                    highfanout_bb.ymax = std::max<int>(highfanout_bb.ymax, rr_node.yhigh());
 
-            constexpr int SINGLE_BIN_MIN_NODES = 2;
-            if (dx == 0 && dy == 0 && nodes_added > SINGLE_BIN_MIN_NODES) {
-                //Target bin contained at least minimum amount of routing
-                //
-                //We require at least SINGLE_BIN_MIN_NODES to be added.
-                //This helps ensure we don't end up with, for example, a single
-                //routing wire running in the wrong direction which may not be
-                //able to reach the target within the bounding box.
-                done = true;
-                break;
+                    ++nodes_added;
+                }
             }
         }
-        if (done) break;
+
+        ring_used = ring;
+
+        constexpr int SINGLE_BIN_MIN_NODES = 2;
+        if (ring == 0 && nodes_added > SINGLE_BIN_MIN_NODES) {
+            //Target bin contained at least minimum amount of routing
+            //
+            //We require at least SINGLE_BIN_MIN_NODES to be added.
+            //This helps ensure we don't end up with, for example, a single
+            //routing wire running in the wrong direction which may not be
+            //able to reach the target within the bounding box.
+            break;
+        }
+        if (ring >= 1 && nodes_added > 0) {
+            //Found routing within this ring's window
+            break;
+        }
     }
 
     t_bb bounding_box = net_bounding_box;
-    if (nodes_added == 0) { //If the target bin and it's surrounding bins were empty, just add the full route tree
+    if (nodes_added == 0) { //If no bin contained re-expandable routing, just add the full route tree
         add_route_tree_to_heap(rt_root, target_node, cost_params, router_lookahead, router_stats);
     } else {
         //We found nearby routing, replace original bounding box to be localized around that routing
-        bounding_box = adjust_highfanout_bounding_box(highfanout_bb);
+        bounding_box = adjust_highfanout_bounding_box(highfanout_bb, ring_used);
     }
 
     return bounding_box;
 }
 
-static t_bb adjust_highfanout_bounding_box(t_bb highfanout_bb) {
+static t_bb adjust_highfanout_bounding_box(t_bb highfanout_bb, int ring_used) {
     t_bb bb = highfanout_bb;
 
+    //The expansion margin scales with how far out the bin rings had to reach
+    //to find existing routing: sparsely routed regions get proportionally
+    //more room to connect up, while the common close-routing case keeps the
+    //original fixed margin.
     constexpr int HIGH_FANOUT_BB_FAC = 3;
-    bb.xmin -= HIGH_FANOUT_BB_FAC;
-    bb.ymin -= HIGH_FANOUT_BB_FAC;
-    bb.xmax += HIGH_FANOUT_BB_FAC;
-    bb.ymax += HIGH_FANOUT_BB_FAC;
+    int margin = HIGH_FANOUT_BB_FAC * std::max(ring_used, 1);
+
+    bb.xmin -= margin;
+    bb.ymin -= margin;
+    bb.xmax += margin;
+    bb.ymax += margin;
 
     return bb;
 }
@@ -1819,34 +2439,49 @@ static void timing_driven_expand_neighbours(t_heap* current,
         target_bb.ymax = device_ctx.rr_nodes[target_node].yhigh();
     }
 
-    //For each node associated with the current heap element, expand all of it's neighbours
+    //Neighbours which survive the cheap geometric pruning; kept thread local
+    //so repeated expansions do not re-allocate the buffer
+    static thread_local std::vector<std::pair<int, int>> candidate_edges; //(to_node, iconn)
+    candidate_edges.clear();
+
+    //First pass: prune the current node's neighbours against the bounding
+    //boxes in a tight loop, before any of the (more expensive) cost
+    //evaluation or heap manipulation is done
     int num_edges = device_ctx.rr_nodes[current->index].num_edges();
     for (int iconn = 0; iconn < num_edges; iconn++) {
         int to_node = device_ctx.rr_nodes[current->index].edge_sink_node(iconn);
-        timing_driven_expand_neighbour(current,
-                                       current->index, iconn, to_node,
-                                       cost_params,
-                                       bounding_box,
-                                       router_lookahead,
-                                       target_node,
-                                       target_bb,
-                                       router_stats);
+        if (timing_driven_neighbour_is_admissible(current->index, iconn, to_node,
+                                                  bounding_box, target_node, target_bb)) {
+            candidate_edges.emplace_back(to_node, iconn);
+        }
+    }
+
+    //Second pass: evaluate the survivors' costs, prune those dominated by
+    //their previously recorded path costs, and append the rest to the back
+    //of the heap
+    size_t num_pushed = 0;
+    for (auto& candidate : candidate_edges) {
+        if (timing_driven_add_to_heap(cost_params,
+                                      router_lookahead,
+                                      current, current->index, candidate.first, candidate.second, target_node)) {
+            ++num_pushed;
+        }
     }
+
+    //Bulk-restore the heap property for the appended elements
+    heap_::sift_up_back(num_pushed);
+    router_stats.heap_pushes += num_pushed;
 }
 
-//Conditionally adds to_node to the router heap (via path from from_node via from_edge).
-//RR nodes outside the expanded bounding box specified in bounding_box are not added
-//to the heap.
-static void timing_driven_expand_neighbour(t_heap* current,
-                                           const int from_node,
-                                           const t_edge_size from_edge,
-                                           const int to_node,
-                                           const t_conn_cost_params cost_params,
-                                           const t_bb bounding_box,
-                                           const RouterLookahead& router_lookahead,
-                                           int target_node,
-                                           const t_bb target_bb,
-                                           RouterStats& router_stats) {
+//Returns true if to_node (reached from from_node via from_edge) should be
+//considered for expansion. RR nodes outside the expanded bounding box
+//specified in bounding_box are not admissible.
+static bool timing_driven_neighbour_is_admissible(const int from_node,
+                                                  const t_edge_size from_edge,
+                                                  const int to_node,
+                                                  const t_bb bounding_box,
+                                                  int target_node,
+                                                  const t_bb target_bb) {
     auto& device_ctx = g_vpr_ctx.device();
 
     int to_xlow = device_ctx.rr_nodes[to_node].xlow();
@@ -1865,7 +2500,7 @@ static void timing_driven_expand_neighbour(t_heap* current,
                        from_node, from_edge, to_node,
                        to_xlow, to_ylow, to_xhigh, to_yhigh,
                        bounding_box.xmin, bounding_box.ymin, bounding_box.xmax, bounding_box.ymax);
-        return; /* Node is outside (expanded) bounding box. */
+        return false; /* Node is outside (expanded) bounding box. */
     }
 
     /* Prune away IPINs that lead to blocks other than the target one.  Avoids  *
@@ -1888,7 +2523,7 @@ static void timing_driven_expand_neighbour(t_heap* current,
                                from_node, from_edge, to_node,
                                to_xlow, to_ylow, to_xhigh, to_yhigh,
                                target_bb.xmin, target_bb.ymin, target_bb.xmax, target_bb.ymax);
-                return;
+                return false;
             }
         }
     }
@@ -1896,50 +2531,53 @@ static void timing_driven_expand_neighbour(t_heap* current,
     VTR_LOGV_DEBUG(f_router_debug, "      Expanding node %d edge %d -> %d\n",
                    from_node, from_edge, to_node);
 
-    timing_driven_add_to_heap(cost_params,
-                              router_lookahead,
-                              current, from_node, to_node, from_edge, target_node, router_stats);
+    return true;
 }
 
-//Add to_node to the heap, and also add any nodes which are connected by non-configurable edges
-static void timing_driven_add_to_heap(const t_conn_cost_params cost_params,
+//Evaluates the cost of reaching to_node (from from_node via iconn) and, if it is
+//not dominated by to_node's previously recorded path costs, appends a
+//corresponding element to the back of the heap. Returns true if an element
+//was appended.
+//
+//Note the caller is responsible for restoring the heap property afterwards
+//(see heap_::sift_up_back()).
+static bool timing_driven_add_to_heap(const t_conn_cost_params cost_params,
                                       const RouterLookahead& router_lookahead,
                                       const t_heap* current,
                                       const int from_node,
                                       const int to_node,
                                       const int iconn,
-                                      const int target_node,
-                                      RouterStats& router_stats) {
-    t_heap* next = alloc_heap_data();
-    next->index = to_node;
+                                      const int target_node) {
+    //Costs are evaluated into a local scratch element; a heap element is only
+    //allocated for neighbours which survive the pruning below
+    t_heap scratch;
+    scratch.index = to_node;
 
     //Costs initialized to current
-    next->cost = std::numeric_limits<float>::infinity(); //Not used directly
-    next->backward_path_cost = current->backward_path_cost;
-    next->R_upstream = current->R_upstream;
+    scratch.cost = std::numeric_limits<float>::infinity(); //Not used directly
+    scratch.backward_path_cost = current->backward_path_cost;
+    scratch.R_upstream = current->R_upstream;
 
     timing_driven_expand_node(cost_params,
                               router_lookahead,
-                              next, from_node, to_node, iconn, target_node);
-
-    auto& route_ctx = g_vpr_ctx.routing();
+                              &scratch, from_node, to_node, iconn, target_node);
 
-    float old_next_total_cost = route_ctx.rr_node_route_inf[to_node].path_cost;
-    float old_next_back_cost = route_ctx.rr_node_route_inf[to_node].backward_path_cost;
+    float old_next_total_cost = get_rr_path_cost(to_node);
+    float old_next_back_cost = get_rr_backward_path_cost(to_node);
 
-    float new_next_total_cost = next->cost;
-    float new_next_back_cost = next->backward_path_cost;
+    float new_next_total_cost = scratch.cost;
+    float new_next_back_cost = scratch.backward_path_cost;
 
     if (old_next_total_cost > new_next_total_cost && old_next_back_cost > new_next_back_cost) {
         //Add node to the heap only if the current cost is less than its historic cost, since
         //there is no point in for the router to expand more expensive paths.
-        add_to_heap(next);
-        ++router_stats.heap_pushes;
+        t_heap* next = alloc_heap_data();
+        *next = scratch;
+        heap_::push_back(next);
+        return true;
     }
 
-    else {
-        free_heap_data(next);
-    }
+    return false;
 }
 
 //Updates current (path step and costs) to account for the step taken to reach to_node
@@ -2196,10 +2834,13 @@ static bool early_exit_heuristic(const t_router_opts& router_opts, const Wirelen
 }
 
 // incremental rerouting resources class definitions
+/* Per-thread scratch shared by all workers of the parallel router */
+thread_local std::vector<int> Connection_based_routing_resources::remaining_targets;
+thread_local std::vector<t_rt_node*> Connection_based_routing_resources::reached_rt_sinks;
+thread_local ClusterNetId Connection_based_routing_resources::current_inet = ClusterNetId(NO_PREVIOUS);
+
 Connection_based_routing_resources::Connection_based_routing_resources()
-    : current_inet(NO_PREVIOUS)
-    , // not routing to a specific net yet (note that NO_PREVIOUS is not unsigned, so will be largest unsigned)
-    last_stable_critical_path_delay{0.0f}
+    : last_stable_critical_path_delay{0.0f}
     , critical_path_growth_tolerance{1.001f}
     , connection_criticality_tolerance{0.9f}
     , connection_delay_optimality_tolerance{1.1f} {
@@ -2435,6 +3076,50 @@ static OveruseInfo calculate_overuse_info() {
     return OveruseInfo(device_ctx.rr_nodes.size(), overused_nodes, total_overuse, worst_overuse);
 }
 
+//Shapes the Pathfinder pressure schedule for the next iteration from the
+//congestion distribution and the routing predictor's trend estimate
+//(--router_adaptive_pres_fac).
+//
+//When overuse is spread broadly across the device, many nets are contending
+//for the same regions and stronger present-cost pressure spreads them apart
+//faster, so pres_fac growth is boosted -- more so the further away the
+//predictor estimates resolution to be. When only a few hotspots remain,
+//blunt pressure mostly detours uninvolved nets; growth is eased and the
+//accumulated (history) cost is weighted up instead, which targets exactly
+//the nodes that stay contested. Stagnant hotspots keep the configured
+//growth but still receive the history boost.
+static void shape_congestion_pressure(const OveruseInfo& overuse_info,
+                                      RoutingPredictor& routing_predictor,
+                                      const t_router_opts& router_opts,
+                                      float* pres_fac_mult,
+                                      float* acc_fac) {
+    *pres_fac_mult = router_opts.pres_fac_mult;
+    *acc_fac = router_opts.acc_fac;
+
+    size_t overused_nodes = overuse_info.overused_nodes();
+    if (overused_nodes == 0) {
+        return;
+    }
+
+    float slope = routing_predictor.estimate_overuse_slope(); //Overused RR nodes per iteration (< 0: improving)
+
+    if (overuse_info.overused_node_ratio() > ADAPTIVE_PRES_BROAD_OVERUSE_RATIO) {
+        //Broad congestion: boost pres_fac growth, scaled by how stagnant the trend is
+        float stagnation = 1.0f;
+        if (slope < 0.) {
+            float est_iterations_to_resolve = overused_nodes / -slope;
+            stagnation = std::min(1.0f, est_iterations_to_resolve / ADAPTIVE_PRES_STAGNATION_ITERATIONS);
+        }
+        *pres_fac_mult = router_opts.pres_fac_mult * (1.0f + (ADAPTIVE_PRES_MAX_MULT_BOOST - 1.0f) * stagnation);
+    } else {
+        //Hotspots: lean on history cost; ease pressure growth while the trend is improving
+        if (slope < 0.) {
+            *pres_fac_mult = 1.0f + (router_opts.pres_fac_mult - 1.0f) * ADAPTIVE_PRES_GENTLE_FRACTION;
+        }
+        *acc_fac = router_opts.acc_fac * ADAPTIVE_PRES_HOTSPOT_ACC_BOOST;
+    }
+}
+
 static size_t calculate_wirelength_available() {
     auto& device_ctx = g_vpr_ctx.device();
 
@@ -2608,6 +3293,63 @@ static bool is_high_fanout(int fanout, int fanout_threshold) {
 //By growing the BBs slowly and only as needed we minimize the size of the BBs.
 //This helps keep the router's graph search fast.
 //
+//Blends the number of currently over-used RR nodes in each net's routing into
+//the net's decaying congestion history. Nets repeatedly found on contested
+//nodes accumulate a high score; nets which route cleanly decay towards zero.
+static void update_net_congestion_history(vtr::vector<ClusterNetId, float>& congestion_history) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        int overused_nodes = 0;
+        for (t_trace* tptr = route_ctx.trace[net_id].head; tptr != nullptr; tptr = tptr->next) {
+            int inode = tptr->index;
+            if (route_ctx.rr_node_route_inf[inode].occ() > device_ctx.rr_nodes[inode].capacity()) {
+                ++overused_nodes;
+            }
+        }
+
+        congestion_history[net_id] = NET_CONGESTION_HISTORY_DECAY * congestion_history[net_id] + overused_nodes;
+    }
+}
+
+//Re-orders sorted_nets for the next routing iteration based on each net's
+//congestion history and criticality.
+//
+//Chronically contested nets are routed first, while the routing of the (more
+//flexible) uncontested nets has not yet claimed the resources they need. The
+//congestion score is boosted by the net's most critical sink so that, among
+//equally contested nets, timing-critical ones get the first pick of routes.
+//Nets which have never been contested keep their most-sinks-first order.
+static void schedule_nets_for_next_iteration(std::vector<ClusterNetId>& sorted_nets,
+                                             const vtr::vector<ClusterNetId, float>& congestion_history,
+                                             std::shared_ptr<const SetupTimingInfo> timing_info,
+                                             const ClusteredPinAtomPinsLookup& netlist_pin_lookup) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    vtr::vector<ClusterNetId, float> scores(cluster_ctx.clb_nlist.nets().size(), 0.);
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        if (congestion_history[net_id] == 0.) continue;
+
+        float max_criticality = 0.;
+        if (timing_info) {
+            for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
+                max_criticality = std::max(max_criticality, calculate_clb_net_pin_criticality(*timing_info, netlist_pin_lookup, pin_id));
+            }
+        }
+
+        scores[net_id] = congestion_history[net_id] * (1. + max_criticality);
+    }
+
+    //Stable so equally-scored nets keep their previous relative order (and
+    //the schedule is deterministic)
+    std::stable_sort(sorted_nets.begin(), sorted_nets.end(),
+                     [&scores](ClusterNetId lhs, ClusterNetId rhs) {
+                         return scores[lhs] > scores[rhs];
+                     });
+}
+
 //Typically, only a small minority of nets (typically > 10%) have their BBs updated
 //each routing iteration.
 static size_t dynamic_update_bounding_boxes(const std::vector<ClusterNetId>& updated_nets, int high_fanout_threshold) {
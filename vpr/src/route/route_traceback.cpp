@@ -1,38 +1,8 @@
 #include "route_traceback.h"
-#include "route_common.h"
-#include "vpr_types.h" //For t_trace
 
-t_traceback::t_traceback(const t_traceback& other) {
-    VTR_ASSERT((other.head == nullptr && other.tail == nullptr) || (other.head && other.tail && other.tail->next == nullptr));
-
-    //Deep-copy of traceback
-    t_trace* prev = nullptr;
-    for (t_trace* other_curr = other.head; other_curr; other_curr = other_curr->next) {
-        //VTR_LOG("Copying trace %p node: %d switch: %d\n", other_curr, other_curr->index, other_curr->iswitch);
-        t_trace* curr = alloc_trace_data();
-
-        curr->index = other_curr->index;
-        curr->iswitch = other_curr->iswitch;
-
-        if (prev) {
-            prev->next = curr;
-        } else {
-            head = curr;
-        }
-        prev = curr;
-    }
-
-    //We may have gotten the last t_trace element from a free list,
-    //make sure it's next ptr gets set to null
-    if (prev) {
-        prev->next = nullptr;
-    }
-
-    tail = prev;
-}
-
-t_traceback::~t_traceback() {
-    free_traceback(head);
+t_traceback::t_traceback(const t_traceback& other)
+    : elements(other.elements) {
+    relink(); //The copied next pointers refer into other's storage
 }
 
 t_traceback::t_traceback(t_traceback&& other)
@@ -50,6 +20,54 @@ t_traceback t_traceback::operator=(t_traceback other) {
 void swap(t_traceback& first, t_traceback& second) {
     using std::swap;
 
+    //Swapping the vectors exchanges their underlying buffers, so the swapped
+    //head/tail/next pointers remain valid for their new owners
+    swap(first.elements, second.elements);
     swap(first.head, second.head);
     swap(first.tail, second.tail);
 }
+
+void t_traceback::append(int index, short iswitch) {
+    const t_trace* old_data = elements.data();
+
+    elements.push_back({nullptr, index, iswitch});
+
+    if (elements.data() != old_data) {
+        relink(); //Growing moved the elements
+    } else {
+        if (elements.size() >= 2) {
+            elements[elements.size() - 2].next = &elements.back();
+        } else {
+            head = &elements.back();
+        }
+        tail = &elements.back();
+    }
+}
+
+void t_traceback::reserve(size_t num_elements) {
+    if (num_elements <= elements.capacity()) return;
+
+    elements.reserve(num_elements);
+    relink(); //Growing moved the elements
+}
+
+void t_traceback::clear() {
+    elements.clear();
+    head = nullptr;
+    tail = nullptr;
+}
+
+void t_traceback::relink() {
+    for (size_t i = 0; i + 1 < elements.size(); ++i) {
+        elements[i].next = &elements[i + 1];
+    }
+
+    if (!elements.empty()) {
+        elements.back().next = nullptr;
+        head = &elements.front();
+        tail = &elements.back();
+    } else {
+        head = nullptr;
+        tail = nullptr;
+    }
+}
@@ -1,11 +1,23 @@
 #ifndef VPR_TRACEBACK_H
 #define VPR_TRACEBACK_H
+#include <vector>
 
-struct t_trace; //Forward declaration
+#include "vpr_types.h" //For t_trace
 
+//The traceback of a net is a linear sequence of t_trace elements: each
+//connection's path is listed from its branch point to its SINK, with the node
+//starting a new branch repeated (see update_traceback()).
+//
+//The elements are stored contiguously, in traversal order, with each
+//element's next pointer simply referring to the following element. Code which
+//walks the traceback through head/next therefore works unchanged, but streams
+//through a flat array instead of chasing individually allocated nodes.
+//
+//Note that head/tail (and any other pointer into the traceback, such as the
+//return value of update_traceback()) are invalidated when the traceback is
+//next modified.
 struct t_traceback {
     t_traceback() = default;
-    ~t_traceback();
 
     t_traceback(const t_traceback&);
     t_traceback(t_traceback&&);
@@ -13,8 +25,26 @@ struct t_traceback {
 
     friend void swap(t_traceback& first, t_traceback& second);
 
-    t_trace* head = nullptr;
-    t_trace* tail = nullptr;
+    //Adds a new element to the end of the traceback
+    void append(int index, short iswitch);
+
+    //Pre-allocates storage for at least num_elements elements
+    void reserve(size_t num_elements);
+
+    //Removes all elements (retaining the storage for re-use)
+    void clear();
+
+    bool empty() const { return elements.empty(); }
+    size_t size() const { return elements.size(); }
+
+    t_trace* head = nullptr; //First element (nullptr if empty)
+    t_trace* tail = nullptr; //Last element (nullptr if empty)
+
+    //Contiguous storage of the traceback elements, in traversal order
+    std::vector<t_trace> elements;
+
+  private:
+    void relink(); //Rebuilds head/tail and the elements' next pointers
 };
 
 #endif
@@ -27,12 +27,21 @@
 /* Array below allows mapping from any rr_node to any rt_node currently in
  * the rt_tree.                                                              */
 
-static std::vector<t_rt_node*> rr_node_to_rt_node; /* [0..device_ctx.rr_nodes.size()-1] */
+/* Thread local so parallel router workers each build their own route trees
+ * (a route tree only lives while its net is being routed).                  */
+static thread_local std::vector<t_rt_node*> rr_node_to_rt_node; /* [0..device_ctx.rr_nodes.size()-1] */
 
 /* Frees lists for fast addition and deletion of nodes and edges. */
 
-static t_rt_node* rt_node_free_list = nullptr;
-static t_linked_rt_edge* rt_edge_free_list = nullptr;
+static thread_local t_rt_node* rt_node_free_list = nullptr;
+static thread_local t_linked_rt_edge* rt_edge_free_list = nullptr;
+
+/* Chunks backing the free lists above (like the heap and traceback
+ * allocators in route_common.cpp): nodes and edges are carved out of these
+ * arenas rather than individually malloced, and the arenas are released
+ * wholesale by free_route_tree_timing_structs().                            */
+static thread_local vtr::t_chunk rt_node_ch;
+static thread_local vtr::t_chunk rt_edge_ch;
 
 /********************** Subroutines local to this module *********************/
 
@@ -57,7 +66,7 @@ static t_rt_node* prune_route_tree_recurr(t_rt_node* node, CBRR& connections_inf
 
 static t_trace* traceback_to_route_tree_branch(t_trace* trace, std::map<int, t_rt_node*>& rr_node_to_rt, std::vector<int>* non_config_node_set_usage);
 
-static std::pair<t_trace*, t_trace*> traceback_from_route_tree_recurr(t_trace* head, t_trace* tail, const t_rt_node* node);
+static void traceback_from_route_tree_recurr(t_traceback& traceback, const t_rt_node* node);
 
 void collect_route_tree_connections(const t_rt_node* node, std::set<std::tuple<int, int, int>>& connections);
 
@@ -90,50 +99,32 @@ bool alloc_route_tree_timing_structs(bool exists_ok) {
 }
 
 void free_route_tree_timing_structs() {
-    /* Frees the structures needed to build routing trees, and really frees
-     * (i.e. calls free) all the data on the free lists.                         */
-
-    t_rt_node *rt_node, *next_node;
-    t_linked_rt_edge *rt_edge, *next_edge;
+    /* Frees the structures needed to build routing trees. All nodes and
+     * edges live in the backing chunks, so the free lists are dropped and
+     * the chunks released wholesale (no per-node frees).                        */
 
     rr_node_to_rt_node.clear();
 
-    rt_node = rt_node_free_list;
-
-    while (rt_node != nullptr) {
-        next_node = rt_node->u.next;
-        free(rt_node);
-        rt_node = next_node;
-    }
-
     rt_node_free_list = nullptr;
-
-    rt_edge = rt_edge_free_list;
-
-    while (rt_edge != nullptr) {
-        next_edge = rt_edge->next;
-        free(rt_edge);
-        rt_edge = next_edge;
-    }
+    free_chunk_memory(&rt_node_ch);
 
     rt_edge_free_list = nullptr;
+    free_chunk_memory(&rt_edge_ch);
 }
 
 static t_rt_node*
 alloc_rt_node() {
-    /* Allocates a new rt_node, from the free list if possible, from the free
-     * store otherwise.                                                         */
-
-    t_rt_node* rt_node;
+    /* Allocates a new rt_node, from the free list if possible, from the
+     * backing chunk otherwise.                                                 */
 
-    rt_node = rt_node_free_list;
-
-    if (rt_node != nullptr) {
-        rt_node_free_list = rt_node->u.next;
-    } else {
-        rt_node = (t_rt_node*)vtr::malloc(sizeof(t_rt_node));
+    if (rt_node_free_list == nullptr) { /* No elements on the free list */
+        rt_node_free_list = vtr::chunk_new<t_rt_node>(&rt_node_ch);
+        rt_node_free_list->u.next = nullptr;
     }
 
+    t_rt_node* rt_node = rt_node_free_list;
+    rt_node_free_list = rt_node->u.next;
+
     return (rt_node);
 }
 
@@ -146,19 +137,17 @@ static void free_rt_node(t_rt_node* rt_node) {
 
 static t_linked_rt_edge*
 alloc_linked_rt_edge() {
-    /* Allocates a new linked_rt_edge, from the free list if possible, from the
-     * free store otherwise.                                                     */
+    /* Allocates a new linked_rt_edge, from the free list if possible, from
+     * the backing chunk otherwise.                                              */
 
-    t_linked_rt_edge* linked_rt_edge;
-
-    linked_rt_edge = rt_edge_free_list;
-
-    if (linked_rt_edge != nullptr) {
-        rt_edge_free_list = linked_rt_edge->next;
-    } else {
-        linked_rt_edge = (t_linked_rt_edge*)vtr::malloc(sizeof(t_linked_rt_edge));
+    if (rt_edge_free_list == nullptr) { /* No elements on the free list */
+        rt_edge_free_list = vtr::chunk_new<t_linked_rt_edge>(&rt_edge_ch);
+        rt_edge_free_list->next = nullptr;
     }
 
+    t_linked_rt_edge* linked_rt_edge = rt_edge_free_list;
+    rt_edge_free_list = linked_rt_edge->next;
+
     VTR_ASSERT(linked_rt_edge != nullptr);
     return (linked_rt_edge);
 }
@@ -584,9 +573,9 @@ void load_route_tree_rr_route_inf(t_rt_node* root) {
         int inode = root->inode;
         route_ctx.rr_node_route_inf[inode].prev_node = NO_PREVIOUS;
         route_ctx.rr_node_route_inf[inode].prev_edge = NO_PREVIOUS;
-        // path cost should be unset
-        VTR_ASSERT(std::isinf(route_ctx.rr_node_route_inf[inode].path_cost));
-        VTR_ASSERT(std::isinf(route_ctx.rr_node_route_inf[inode].backward_path_cost));
+        // path cost should be unset (i.e. not stamped in the current path search epoch)
+        VTR_ASSERT(std::isinf(get_rr_path_cost(inode)));
+        VTR_ASSERT(std::isinf(get_rr_backward_path_cost(inode)));
 
         // reached a sink
         if (!edge) { return; }
@@ -843,50 +832,20 @@ static t_trace* traceback_to_route_tree_branch(t_trace* trace,
     return next;
 }
 
-static std::pair<t_trace*, t_trace*> traceback_from_route_tree_recurr(t_trace* head, t_trace* tail, const t_rt_node* node) {
+static void traceback_from_route_tree_recurr(t_traceback& traceback, const t_rt_node* node) {
     if (node) {
         if (node->u.child_list) {
             //Recursively add children
             for (t_linked_rt_edge* edge = node->u.child_list; edge != nullptr; edge = edge->next) {
-                t_trace* curr = alloc_trace_data();
-                curr->index = node->inode;
-                curr->iswitch = edge->iswitch;
-                curr->next = nullptr;
-
-                if (tail) {
-                    VTR_ASSERT(tail->next == nullptr);
-                    tail->next = curr;
-                }
+                traceback.append(node->inode, edge->iswitch);
 
-                tail = curr;
-
-                if (!head) {
-                    head = tail;
-                }
-
-                std::tie(head, tail) = traceback_from_route_tree_recurr(head, tail, edge->child);
+                traceback_from_route_tree_recurr(traceback, edge->child);
             }
         } else {
             //Leaf
-            t_trace* curr = alloc_trace_data();
-            curr->index = node->inode;
-            curr->iswitch = OPEN;
-            curr->next = nullptr;
-
-            if (tail) {
-                VTR_ASSERT(tail->next == nullptr);
-                tail->next = curr;
-            }
-
-            tail = curr;
-
-            if (!head) {
-                head = tail;
-            }
+            traceback.append(node->inode, OPEN);
         }
     }
-
-    return {head, tail};
 }
 
 t_trace* traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int num_routed_sinks) {
@@ -897,18 +856,19 @@ t_trace* traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     auto& device_ctx = g_vpr_ctx.device();
 
-    t_trace* head;
-    t_trace* tail;
     std::unordered_set<int> nodes;
 
-    std::tie(head, tail) = traceback_from_route_tree_recurr(nullptr, nullptr, root);
+    t_traceback& traceback = route_ctx.trace[inet];
+    traceback.clear();
+
+    traceback_from_route_tree_recurr(traceback, root);
 
-    VTR_ASSERT(head);
-    VTR_ASSERT(tail);
-    VTR_ASSERT(tail->next == nullptr);
+    VTR_ASSERT(traceback.head);
+    VTR_ASSERT(traceback.tail);
+    VTR_ASSERT(traceback.tail->next == nullptr);
 
     int num_trace_sinks = 0;
-    for (t_trace* trace = head; trace != nullptr; trace = trace->next) {
+    for (t_trace* trace = traceback.head; trace != nullptr; trace = trace->next) {
         nodes.insert(trace->index);
 
         //Sanity check that number of sinks match expected
@@ -918,11 +878,9 @@ t_trace* traceback_from_route_tree(ClusterNetId inet, const t_rt_node* root, int
     }
     VTR_ASSERT(num_routed_sinks == num_trace_sinks);
 
-    route_ctx.trace[inet].tail = tail;
-    route_ctx.trace[inet].head = head;
     route_ctx.trace_nodes[inet] = nodes;
 
-    return head;
+    return traceback.head;
 }
 
 //Prunes a route tree (recursively) based on congestion and the 'force_prune' argument
@@ -9,6 +9,28 @@
 
 static t_rt_node* setup_routing_resources_no_net(int source_node);
 
+static bool profile_path_is_valid(const t_heap* path, int source_node, uint32_t search_epoch);
+
+/* The heap array allocation and rr base cost values are invariant across
+ * profiling queries, so pay for them once per thread rather than on every
+ * source/sink query. The heap itself is thread-local (see route_common.cpp),
+ * hence the thread-local flag. */
+static void prime_profiling_search_structs() {
+    static thread_local bool primed = false;
+    if (primed) {
+        return;
+    }
+
+    auto& device_ctx = g_vpr_ctx.device();
+
+    /* Update base costs according to fanout and criticality rules */
+    update_rr_base_costs(1);
+
+    init_heap(device_ctx.grid);
+
+    primed = true;
+}
+
 RouterDelayProfiler::RouterDelayProfiler(
     const RouterLookahead* lookahead)
     : router_lookahead_(lookahead) {}
@@ -18,14 +40,29 @@ bool RouterDelayProfiler::calculate_delay(int source_node, int sink_node, const
      * way resulted in overuse of resources (congestion).  If there is no way   *
      * to route this net, even ignoring congestion, it returns false.  In this  *
      * case the rr_graph is disconnected and you can give up.                   */
+    t_heap sink_path;
+    uint32_t search_epoch;
+    if (!search_delay_path(source_node, sink_node, router_opts, &sink_path, &search_epoch)) {
+        return false;
+    }
+
+    bool valid = evaluate_delay_path(source_node, sink_path, search_epoch, net_delay);
+    VTR_ASSERT_MSG(valid, "A serial profiling query's walkback cannot be clobbered");
+
+    return true;
+}
+
+std::vector<float> RouterDelayProfiler::calculate_delays_to_sinks(int source_node, const std::vector<int>& sink_nodes, const t_router_opts& router_opts) const {
+    /* Answers a batch of sink queries sharing one source with a single
+     * Dijkstra flood from the source, instead of one directed search per
+     * sink. Unreachable sinks get NaN. */
     auto& device_ctx = g_vpr_ctx.device();
-    auto& route_ctx = g_vpr_ctx.routing();
 
-    t_rt_node* rt_root = setup_routing_resources_no_net(source_node);
-    enable_router_debug(router_opts, ClusterNetId(), sink_node);
+    std::vector<float> sink_delays(sink_nodes.size(), std::numeric_limits<float>::quiet_NaN());
 
-    /* Update base costs according to fanout and criticality rules */
-    update_rr_base_costs(1);
+    prime_profiling_search_structs();
+
+    t_rt_node* rt_root = setup_routing_resources_no_net(source_node);
 
     //maximum bounding box for placement
     t_bb bounding_box;
@@ -39,37 +76,178 @@ bool RouterDelayProfiler::calculate_delay(int source_node, int sink_node, const
     cost_params.astar_fac = router_opts.astar_fac;
     cost_params.bend_cost = router_opts.bend_cost;
 
-    route_budgets budgeting_inf;
+    RouterStats router_stats;
 
-    init_heap(device_ctx.grid);
+    std::vector<t_heap> shortest_paths = timing_driven_find_all_shortest_paths_from_route_tree(rt_root,
+                                                                                               cost_params,
+                                                                                               bounding_box,
+                                                                                               router_stats);
+
+    free_route_tree(rt_root);
+
+    VTR_ASSERT(shortest_paths.size() == device_ctx.rr_nodes.size());
+
+    //Harvest only the requested sinks
+    for (size_t isink = 0; isink < sink_nodes.size(); ++isink) {
+        int sink_rr_node = sink_nodes[isink];
+
+        if (sink_rr_node == source_node) {
+            sink_delays[isink] = 0.;
+            continue;
+        }
+
+        if (shortest_paths[sink_rr_node].index == OPEN) continue;
+
+        VTR_ASSERT(shortest_paths[sink_rr_node].index == sink_rr_node);
+
+        //Build the routing tree to get the delay
+        rt_root = setup_routing_resources_no_net(source_node);
+        t_rt_node* rt_node_of_sink = update_route_tree(&shortest_paths[sink_rr_node], nullptr);
+
+        VTR_ASSERT(rt_node_of_sink->inode == sink_rr_node);
+
+        sink_delays[isink] = rt_node_of_sink->Tdel;
+
+        free_route_tree(rt_root);
+    }
+
+    //Reset for the next router call
+    reset_path_costs();
+    empty_heap();
+
+    return sink_delays;
+}
+
+bool RouterDelayProfiler::search_delay_path(int source_node, int sink_node, const t_router_opts& router_opts, t_heap* sink_path, uint32_t* search_epoch) const {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    prime_profiling_search_structs();
+
+    t_rt_node* rt_root = setup_routing_resources_no_net(source_node);
+    enable_router_debug(router_opts, ClusterNetId(), sink_node);
+
+    //maximum bounding box for placement
+    t_bb bounding_box;
+    bounding_box.xmin = 0;
+    bounding_box.xmax = device_ctx.grid.width() + 1;
+    bounding_box.ymin = 0;
+    bounding_box.ymax = device_ctx.grid.height() + 1;
+
+    t_conn_cost_params cost_params;
+    cost_params.criticality = 1.;
+    cost_params.astar_fac = router_opts.astar_fac;
+    cost_params.bend_cost = router_opts.bend_cost;
 
-    std::vector<int> modified_rr_node_inf;
     RouterStats router_stats;
     t_heap* cheapest = timing_driven_route_connection_from_route_tree(rt_root,
                                                                       sink_node, cost_params, bounding_box, *router_lookahead_,
-                                                                      modified_rr_node_inf, router_stats);
+                                                                      router_stats);
+
+    //The walkback hops recorded by the search carry this thread's current
+    //epoch (drawn at search entry); report it so the harvest can tell this
+    //search's writes apart from those of concurrent searches
+    *search_epoch = get_path_search_epoch();
 
     bool found_path = (cheapest != nullptr);
     if (found_path) {
         VTR_ASSERT(cheapest->index == sink_node);
 
-        t_rt_node* rt_node_of_sink = update_route_tree(cheapest, nullptr);
+        *sink_path = *cheapest; //Copy out: the t_heap itself lives in this thread's heap pool
         free_heap_data(cheapest);
-
-        //find delay
-        *net_delay = rt_node_of_sink->Tdel;
-
-        VTR_ASSERT_MSG(route_ctx.rr_node_route_inf[rt_root->inode].occ() <= device_ctx.rr_nodes[rt_root->inode].capacity(), "SOURCE should never be congested");
-        free_route_tree(rt_root);
     }
 
+    free_route_tree(rt_root);
+
     //Reset for the next router call
     empty_heap();
-    reset_path_costs(modified_rr_node_inf);
+    reset_path_costs();
 
     return found_path;
 }
 
+bool RouterDelayProfiler::evaluate_delay_path(int source_node, const t_heap& sink_path, uint32_t search_epoch, float* net_delay) const {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    if (!profile_path_is_valid(&sink_path, source_node, search_epoch)) {
+        return false;
+    }
+
+    //Take a fresh path search epoch so any path costs stamped by the searches
+    //(possibly in other threads) read as infinite while the tree is built
+    reset_path_costs();
+
+    t_rt_node* rt_root = setup_routing_resources_no_net(source_node);
+
+    t_heap path = sink_path; //update_route_tree() wants a mutable entry
+    t_rt_node* rt_node_of_sink = update_route_tree(&path, nullptr);
+
+    //find delay
+    *net_delay = rt_node_of_sink->Tdel;
+
+    VTR_ASSERT_MSG(route_ctx.rr_node_route_inf[rt_root->inode].occ() <= device_ctx.rr_nodes[rt_root->inode].capacity(), "SOURCE should never be congested");
+    free_route_tree(rt_root);
+
+    return true;
+}
+
+/* Checks that the prev_node/prev_edge chain recorded by a profiling search is
+ * still exactly the chain that search wrote: every hop must form a real RR
+ * graph edge *and* still carry the search's path search epoch stamp (written
+ * alongside the prev fields). The stamp check matters because all workers of
+ * a round search from the same source: hops overwritten by another worker can
+ * splice into a connected, cycle-free chain to the shared source that is not
+ * the shortest path this query found. Any mismatch means the query must be
+ * redone serially. */
+static bool profile_path_is_valid(const t_heap* path, int source_node, uint32_t search_epoch) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    int inode = path->index;
+    int prev_node = path->u.prev.node;
+    int prev_edge = path->u.prev.edge;
+
+    //A legitimate path has at most as many hops as there are RR nodes; a longer
+    //walk means cross-worker writes spliced the chain into a cycle
+    size_t max_hops = device_ctx.rr_nodes.size();
+
+    for (size_t hops = 0; hops < max_hops; ++hops) {
+        if (inode == source_node) {
+            return true;
+        }
+
+        if (prev_node == NO_PREVIOUS) {
+            return false; //Terminated somewhere other than this query's source
+        }
+
+        if (prev_node < 0 || prev_node >= (int)device_ctx.rr_nodes.size()) {
+            return false;
+        }
+
+        //The recorded edge must really connect prev_node to inode
+        if (prev_edge < 0 || prev_edge >= (int)device_ctx.rr_nodes[prev_node].num_edges()) {
+            return false;
+        }
+        if (device_ctx.rr_nodes[prev_node].edge_sink_node(prev_edge) != inode) {
+            return false;
+        }
+
+        inode = prev_node;
+
+        //Only trust prev fields still stamped with the owning search's epoch
+        //(the source itself is exempt: its prev fields are never read)
+        if (inode != source_node
+            && route_ctx.rr_node_route_inf[inode].path_search_epoch != search_epoch) {
+            return false;
+        }
+
+        prev_node = route_ctx.rr_node_route_inf[inode].prev_node;
+        prev_edge = route_ctx.rr_node_route_inf[inode].prev_edge;
+    }
+
+    return false; //Cyclic chain
+}
+
 //Returns the shortest path delay from src_node to all RR nodes in the RR graph, or NaN if no path exists
 std::vector<float> calculate_all_path_delays_from_rr_node(int src_rr_node, const t_router_opts& router_opts) {
     auto& device_ctx = g_vpr_ctx.device();
@@ -89,15 +267,13 @@ std::vector<float> calculate_all_path_delays_from_rr_node(int src_rr_node, const
     cost_params.astar_fac = router_opts.astar_fac;
     cost_params.bend_cost = router_opts.bend_cost;
 
-    std::vector<int> modified_rr_node_inf;
     RouterStats router_stats;
 
-    init_heap(device_ctx.grid);
+    prime_profiling_search_structs();
 
     std::vector<t_heap> shortest_paths = timing_driven_find_all_shortest_paths_from_route_tree(rt_root,
                                                                                                cost_params,
                                                                                                bounding_box,
-                                                                                               modified_rr_node_inf,
                                                                                                router_stats);
 
     free_route_tree(rt_root);
@@ -122,7 +298,7 @@ std::vector<float> calculate_all_path_delays_from_rr_node(int src_rr_node, const
             free_route_tree(rt_root);
         }
     }
-    reset_path_costs(modified_rr_node_inf);
+    reset_path_costs();
     empty_heap();
 
 #if 0
@@ -197,6 +373,7 @@ void alloc_routing_structs(t_chan_width chan_width,
                     router_opts.trim_obs_channels,
                     router_opts.clock_modeling,
                     directs, num_directs,
+                    router_opts.router_num_workers,
                     &warnings);
 
     alloc_and_load_rr_node_route_structs();
@@ -2,6 +2,7 @@
 #define ROUTER_DELAY_PROFILING_H_
 
 #include "vpr_types.h"
+#include "route_common.h"
 #include "router_lookahead.h"
 
 #include <vector>
@@ -11,6 +12,29 @@ class RouterDelayProfiler {
     RouterDelayProfiler(const RouterLookahead* lookahead);
     bool calculate_delay(int source_node, int sink_node, const t_router_opts& router_opts, float* net_delay) const;
 
+    //Batched query: returns the delay from source_node to each entry of
+    //sink_nodes (NaN where no path exists), answered with a single Dijkstra
+    //flood from the source rather than one directed search per sink. Prefer
+    //this over repeated calculate_delay() calls when many sinks share a
+    //source.
+    std::vector<float> calculate_delays_to_sinks(int source_node, const std::vector<int>& sink_nodes, const t_router_opts& router_opts) const;
+
+    //Search-only half of calculate_delay(): finds a path from source_node to
+    //sink_node and copies the sink's heap entry out, but does not walk the
+    //recorded path. Safe to run from several profiling worker threads
+    //concurrently (each search draws its own path search epoch, reported
+    //through search_epoch); the recorded walkback must be harvested with
+    //evaluate_delay_path() after the workers have joined.
+    bool search_delay_path(int source_node, int sink_node, const t_router_opts& router_opts, t_heap* sink_path, uint32_t* search_epoch) const;
+
+    //Walks the path recorded by search_delay_path() and returns its Elmore
+    //delay through net_delay. Returns false unless every hop of the recorded
+    //prev_node/prev_edge chain is still stamped with search_epoch (i.e. was
+    //last written by the search that reported it), in which case the chain
+    //was clobbered by a concurrent search and the query must be redone
+    //serially.
+    bool evaluate_delay_path(int source_node, const t_heap& sink_path, uint32_t search_epoch, float* net_delay) const;
+
   private:
     const RouterLookahead* router_lookahead_;
 };
@@ -2,6 +2,7 @@
 
 #include "router_lookahead_map.h"
 #include "vpr_error.h"
+#include "vtr_profile.h"
 #include "globals.h"
 #include "route_timing.h"
 
@@ -28,6 +29,13 @@ std::unique_ptr<RouterLookahead> make_router_lookahead(
     const std::vector<t_segment_inf>& segment_inf) {
     std::unique_ptr<RouterLookahead> router_lookahead = make_router_lookahead_object(router_lookahead_type);
 
+    if (!read_lookahead.empty() && !vtr::file_exists(read_lookahead.c_str())) {
+        //Treat a missing file as a cache miss: compute the lookahead (and, if
+        //--write_router_lookahead points at the same file, fill the cache)
+        VTR_LOG("Router lookahead file '%s' not found, computing lookahead instead\n", read_lookahead.c_str());
+        read_lookahead.clear();
+    }
+
     if (read_lookahead.empty()) {
         router_lookahead->compute(segment_inf);
     } else {
@@ -105,6 +113,14 @@ void MapLookahead::compute(const std::vector<t_segment_inf>& segment_inf) {
     compute_router_lookahead(segment_inf.size());
 }
 
+void MapLookahead::read(const std::string& file) {
+    read_router_lookahead_map(file);
+}
+
+void MapLookahead::write(const std::string& file) const {
+    write_router_lookahead_map(file);
+}
+
 float NoOpLookahead::get_expected_cost(int /*current_node*/, int /*target_node*/, const t_conn_cost_params& /*params*/, float /*R_upstream*/) const {
     return 0.;
 }
@@ -210,6 +226,7 @@ const RouterLookahead* get_cached_router_lookahead(
 
     // Check if cache is valid.
     const RouterLookahead* router_lookahead = router_ctx.cached_router_lookahead_.get(cache_key);
+    vtr::profile::add_to_counter(router_lookahead ? "router_lookahead_cache_hits" : "router_lookahead_cache_misses", 1);
     if (router_lookahead) {
         return router_lookahead;
     } else {
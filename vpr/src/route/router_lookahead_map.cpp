@@ -17,6 +17,9 @@
 #include <vector>
 #include <queue>
 #include <ctime>
+#include <sstream>
+#include <atomic>
+#include <thread>
 #include "vpr_types.h"
 #include "vpr_error.h"
 #include "vpr_utils.h"
@@ -25,8 +28,18 @@
 #include "vtr_log.h"
 #include "vtr_assert.h"
 #include "vtr_time.h"
+#include "vtr_digest.h"
+#include "read_xml_arch_file.h"
 #include "router_lookahead_map.h"
 
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "router_lookahead_map.capnp.h"
+#    include "ndmatrix_serdes.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
 /* the cost map is computed by running a Dijkstra search from channel segment rr nodes at the specified reference coordinate */
 #define REF_X 3
 #define REF_Y 3
@@ -253,9 +266,28 @@ void compute_router_lookahead(int num_segments) {
     free_cost_map();
     alloc_cost_map(num_segments);
 
-    /* run Dijkstra's algorithm for each segment type & channel type combination */
+    /* run Dijkstra's algorithm for each segment type & channel type combination.
+     *
+     * Each (segment, channel type) combination is an independent set of graph
+     * searches which writes only its own [chan][seg] slice of f_cost_map (the
+     * missing-entry fill also reads only that slice), so the combinations are
+     * farmed out to a pool of worker threads pulling from a shared task list. */
+    std::vector<std::pair<int, e_rr_type>> tasks;
     for (int iseg = 0; iseg < num_segments; iseg++) {
         for (e_rr_type chan_type : {CHANX, CHANY}) {
+            tasks.emplace_back(iseg, chan_type);
+        }
+    }
+
+    std::atomic<size_t> next_task(0);
+    auto worker = [&]() {
+        while (true) {
+            size_t itask = next_task.fetch_add(1);
+            if (itask >= tasks.size()) break;
+
+            int iseg = tasks[itask].first;
+            e_rr_type chan_type = tasks[itask].second;
+
             /* allocate the cost map for this iseg/chan_type */
             t_routing_cost_map routing_cost_map({device_ctx.grid.width(), device_ctx.grid.height()});
 
@@ -283,6 +315,19 @@ void compute_router_lookahead(int num_segments) {
              * a reference coordinate > (0,0) so some entries that represent a cross-chip distance have not been computed) */
             fill_in_missing_lookahead_entries(iseg, chan_type);
         }
+    };
+
+    size_t num_workers = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), tasks.size()));
+    if (num_workers == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < num_workers; ++i) {
+            threads.emplace_back(worker);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
     }
 
     if (false) print_cost_map();
@@ -677,3 +722,86 @@ static void print_cost_map() {
         }
     }
 }
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disabled because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+void read_router_lookahead_map(const std::string& /*file*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "MapLookahead::read " DISABLE_ERROR);
+}
+
+void write_router_lookahead_map(const std::string& /*file*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "MapLookahead::write " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/* Digest identifying the rr graph the lookahead map was computed from.
+ *
+ * The full rr graph is too large to hash outright, so this hashes a
+ * structural summary (architecture file, grid and channel dimensions, node,
+ * edge and switch counts). Any rr graph change large enough to invalidate
+ * the Dijkstra cost profiles perturbs at least one of these. */
+static std::string get_rr_graph_digest() {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    size_t num_edges = 0;
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); ++inode) {
+        num_edges += device_ctx.rr_nodes[inode].num_edges();
+    }
+
+    std::stringstream ss;
+    ss << get_arch_file_name() << "\n";
+    ss << device_ctx.grid.width() << " " << device_ctx.grid.height() << "\n";
+    ss << device_ctx.chan_width.max << " " << device_ctx.chan_width.x_max << " " << device_ctx.chan_width.y_max << "\n";
+    ss << device_ctx.rr_nodes.size() << " " << num_edges << " " << device_ctx.rr_switch_inf.size() << "\n";
+
+    return vtr::secure_digest_stream(ss);
+}
+
+static void to_cost_entry(Cost_Entry* out, const VprCostEntry::Reader& in) {
+    out->delay = in.getDelay();
+    out->congestion = in.getCongestion();
+}
+
+static void from_cost_entry(VprCostEntry::Builder* out, const Cost_Entry& in) {
+    out->setDelay(in.delay);
+    out->setCongestion(in.congestion);
+}
+
+void read_router_lookahead_map(const std::string& file) {
+    vtr::ScopedStartFinishTimer timer("Reading router lookahead map");
+
+    MmapFile f(file);
+    ::capnp::FlatArrayMessageReader reader(f.getData());
+    auto map = reader.getRoot<VprMapLookahead>();
+
+    std::string digest = get_rr_graph_digest();
+    if (map.getRrGraphDigest().cStr() != digest) {
+        VPR_THROW(VPR_ERROR_ROUTE,
+                  "Router lookahead map '%s' was computed from a different rr graph; regenerate it with --write_router_lookahead\n",
+                  file.c_str());
+    }
+
+    ToNdMatrix<4, VprCostEntry, Cost_Entry>(&f_cost_map, map.getCostMap(), to_cost_entry);
+}
+
+void write_router_lookahead_map(const std::string& file) {
+    ::capnp::MallocMessageBuilder builder;
+    auto map = builder.initRoot<VprMapLookahead>();
+
+    map.setRrGraphDigest(get_rr_graph_digest());
+
+    auto cost_map = map.initCostMap();
+    FromNdMatrix<4, VprCostEntry, Cost_Entry>(&cost_map, f_cost_map, from_cost_entry);
+
+    writeMessageToFile(file, &builder);
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
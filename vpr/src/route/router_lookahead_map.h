@@ -1,9 +1,19 @@
 #pragma once
 
+#include <string>
+
 /* Computes the lookahead map to be used by the router. If a map was computed prior to this, a new one will not be computed again.
  * The rr graph must have been built before calling this function. */
 void compute_router_lookahead(int num_segments);
 
+/* Reads the lookahead map from a binary (Cap'n proto) file previously written
+ * by write_router_lookahead_map(). The file records a digest of the rr graph
+ * it was computed from and is refused if it does not match the current graph. */
+void read_router_lookahead_map(const std::string& file);
+
+/* Writes the computed lookahead map (and the current rr graph digest) to file */
+void write_router_lookahead_map(const std::string& file);
+
 /* queries the lookahead_map (should have been computed prior to routing) to get the expected cost
  * from the specified source to the specified target */
 float get_lookahead_map_cost(int from_node_ind, int to_node_ind, float criticality_fac);
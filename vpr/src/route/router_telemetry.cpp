@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "vtr_log.h"
+
+#include "vpr_error.h"
+
+#include "globals.h"
+#include "route_export.h"
+#include "router_telemetry.h"
+
+namespace telemetry {
+
+/* Histograms are log2 bucketed: bin 0 counts zero-valued samples and bin i
+ * counts samples in [2^(i-1), 2^i) */
+constexpr size_t NUM_HISTOGRAM_BINS = 32;
+
+/* Overuse is binned into OVERUSE_GRID_BINS x OVERUSE_GRID_BINS grid regions */
+constexpr size_t OVERUSE_GRID_BINS = 4;
+
+struct IterationTelemetry {
+    int itry = 0;
+    uint64_t connections = 0;
+    uint64_t nets_rerouted = 0;
+    std::array<uint64_t, NUM_HISTOGRAM_BINS> nodes_expanded_hist{};
+    std::array<uint64_t, NUM_HISTOGRAM_BINS> heap_occupancy_hist{};
+    std::array<uint64_t, OVERUSE_GRID_BINS * OVERUSE_GRID_BINS> region_overuse{};
+};
+
+/* Live counters for the iteration currently being collected. Relaxed atomics
+ * so concurrent router workers can record without synchronizing.            */
+static std::atomic<uint64_t> f_connections{0};
+static std::array<std::atomic<uint64_t>, NUM_HISTOGRAM_BINS> f_nodes_expanded_hist;
+static std::array<std::atomic<uint64_t>, NUM_HISTOGRAM_BINS> f_heap_occupancy_hist;
+static int f_itry = 0;
+static uint64_t f_nets_rerouted = 0;
+static bool f_iteration_open = false;
+
+/* Completed per-iteration records, in iteration order */
+static std::vector<IterationTelemetry> f_iterations;
+
+static size_t histogram_bin(size_t value) {
+    size_t bin = 0;
+    while (value != 0 && bin + 1 < NUM_HISTOGRAM_BINS) {
+        value >>= 1;
+        ++bin;
+    }
+    return bin;
+}
+
+void start_iteration(int itry) {
+    f_itry = itry;
+    f_nets_rerouted = 0;
+    f_connections.store(0, std::memory_order_relaxed);
+    for (auto& bin : f_nodes_expanded_hist) {
+        bin.store(0, std::memory_order_relaxed);
+    }
+    for (auto& bin : f_heap_occupancy_hist) {
+        bin.store(0, std::memory_order_relaxed);
+    }
+    f_iteration_open = true;
+}
+
+void record_connection(size_t heap_pops, size_t heap_occupancy) {
+    if (!f_iteration_open) return;
+
+    f_connections.fetch_add(1, std::memory_order_relaxed);
+    f_nodes_expanded_hist[histogram_bin(heap_pops)].fetch_add(1, std::memory_order_relaxed);
+    f_heap_occupancy_hist[histogram_bin(heap_occupancy)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void record_nets_rerouted(size_t num_nets) {
+    if (!f_iteration_open) return;
+
+    f_nets_rerouted += num_nets;
+}
+
+void finish_iteration() {
+    if (!f_iteration_open) return;
+
+    IterationTelemetry record;
+    record.itry = f_itry;
+    record.connections = f_connections.load(std::memory_order_relaxed);
+    record.nets_rerouted = f_nets_rerouted;
+    for (size_t ibin = 0; ibin < NUM_HISTOGRAM_BINS; ++ibin) {
+        record.nodes_expanded_hist[ibin] = f_nodes_expanded_hist[ibin].load(std::memory_order_relaxed);
+        record.heap_occupancy_hist[ibin] = f_heap_occupancy_hist[ibin].load(std::memory_order_relaxed);
+    }
+
+    /* Bin the currently over-used RR nodes by grid region */
+    auto& device_ctx = g_vpr_ctx.device();
+    size_t grid_width = std::max<size_t>(1, device_ctx.grid.width());
+    size_t grid_height = std::max<size_t>(1, device_ctx.grid.height());
+    for (int inode : collect_congested_rr_nodes()) {
+        size_t region_x = std::min(OVERUSE_GRID_BINS - 1, (device_ctx.rr_nodes[inode].xlow() * OVERUSE_GRID_BINS) / grid_width);
+        size_t region_y = std::min(OVERUSE_GRID_BINS - 1, (device_ctx.rr_nodes[inode].ylow() * OVERUSE_GRID_BINS) / grid_height);
+        record.region_overuse[region_y * OVERUSE_GRID_BINS + region_x] += 1;
+    }
+
+    f_iterations.push_back(record);
+    f_iteration_open = false;
+}
+
+/* Prints array values as a JSON array (no trailing newline) */
+template<typename Container>
+static void write_json_array(FILE* fp, const Container& values) {
+    fprintf(fp, "[");
+    bool first = true;
+    for (uint64_t value : values) {
+        fprintf(fp, "%s%" PRIu64, first ? "" : ", ", value);
+        first = false;
+    }
+    fprintf(fp, "]");
+}
+
+void write_json(const char* filename) {
+    FILE* fp = fopen(filename, "w");
+    if (!fp) {
+        VPR_THROW(VPR_ERROR_ROUTE, "Failed to open router telemetry file '%s' for writing", filename);
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"histogram_binning\": \"log2\",\n");
+    fprintf(fp, "  \"overuse_grid_bins\": %zu,\n", OVERUSE_GRID_BINS);
+    fprintf(fp, "  \"iterations\": [\n");
+    for (size_t iter = 0; iter < f_iterations.size(); ++iter) {
+        const IterationTelemetry& record = f_iterations[iter];
+
+        fprintf(fp, "    {\n");
+        fprintf(fp, "      \"itry\": %d,\n", record.itry);
+        fprintf(fp, "      \"connections\": %" PRIu64 ",\n", record.connections);
+        fprintf(fp, "      \"nets_rerouted\": %" PRIu64 ",\n", record.nets_rerouted);
+        fprintf(fp, "      \"nodes_expanded_hist\": ");
+        write_json_array(fp, record.nodes_expanded_hist);
+        fprintf(fp, ",\n");
+        fprintf(fp, "      \"heap_occupancy_hist\": ");
+        write_json_array(fp, record.heap_occupancy_hist);
+        fprintf(fp, ",\n");
+        fprintf(fp, "      \"region_overuse\": ");
+        write_json_array(fp, record.region_overuse);
+        fprintf(fp, "\n");
+        fprintf(fp, "    }%s\n", (iter + 1 < f_iterations.size()) ? "," : "");
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+
+    fclose(fp);
+
+    VTR_LOG("Wrote router telemetry for %zu routing iterations to '%s'.\n", f_iterations.size(), filename);
+}
+
+} // namespace telemetry
@@ -0,0 +1,45 @@
+#ifndef ROUTER_TELEMETRY_H
+#define ROUTER_TELEMETRY_H
+
+/* Always-on, low-overhead router instrumentation.
+ *
+ * Unlike route_profiling (which is compiled out unless PROFILE is defined),
+ * these counters are cheap enough to leave enabled in production builds:
+ * recording a connection is a few relaxed atomic increments into
+ * log2-bucketed histograms, so router worker threads never synchronize with
+ * each other while recording.
+ *
+ * Per routing iteration the collected record holds:
+ *   - histograms of heap pops (nodes expanded) per connection search
+ *   - histograms of heap occupancy sampled when each sink is reached
+ *   - the number of connections routed and nets ripped-up and re-routed
+ *   - the count of over-used RR nodes per grid region
+ *
+ * The records are exported as JSON (see --router_telemetry_file) for
+ * tracking router efficiency across runs.                                   */
+
+#include <cstddef>
+
+namespace telemetry {
+
+//Begins collection for routing iteration itry
+void start_iteration(int itry);
+
+//Records a completed connection search: the number of heap pops it needed
+//and the heap occupancy when the sink was reached. Safe to call from
+//concurrent router workers.
+void record_connection(size_t heap_pops, size_t heap_occupancy);
+
+//Records how many nets were ripped-up and re-routed this iteration
+void record_nets_rerouted(size_t num_nets);
+
+//Snapshots the iteration-wide state (per-region overuse) and closes the
+//iteration's record
+void finish_iteration();
+
+//Writes all collected iteration records as JSON
+void write_json(const char* filename);
+
+} // namespace telemetry
+
+#endif
@@ -3,8 +3,12 @@
 #include <cmath>
 #include <ctime>
 #include <algorithm>
+#include <exception>
+#include <thread>
 #include <vector>
+#include <unordered_map>
 #include "vtr_assert.h"
+#include "vtr_hash.h"
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -173,7 +177,20 @@ static void alloc_and_load_rr_graph(const int num_nodes,
                                     const t_direct_inf* directs,
                                     const int num_directs,
                                     const t_clb_to_clb_directs* clb_to_clb_directs,
-                                    bool is_global_graph);
+                                    bool is_global_graph,
+                                    const int num_workers);
+
+static void seed_rr_rc_data(const DeviceGrid& grid,
+                            const t_chan_details& chan_details_x,
+                            const t_chan_details& chan_details_y,
+                            const t_chan_width& chan_width,
+                            bool is_global_graph);
+
+static void seed_chan_rr_rc_data(const t_chan_seg_details* seg_details,
+                                 const int tracks_per_chan,
+                                 const int chan_coord,
+                                 const int seg_coord,
+                                 const int seg_dimension);
 
 static float pattern_fmod(float a, float b);
 static void load_uniform_connection_block_pattern(vtr::NdMatrix<int, 5>& tracks_connected_to_pin,
@@ -255,7 +272,8 @@ static void alloc_rr_switch_inf(t_arch_switch_fanin& switch_fanin);
 static void rr_graph_externals(const std::vector<t_segment_inf>& segment_inf,
                                int max_chan_width,
                                int wire_to_rr_ipin_switch,
-                               enum e_base_cost_type base_cost_type);
+                               enum e_base_cost_type base_cost_type,
+                               const int num_workers);
 
 static t_clb_to_clb_directs* alloc_and_load_clb_to_clb_directs(const t_direct_inf* directs, const int num_directs, const int delayless_switch);
 
@@ -300,6 +318,7 @@ static void build_rr_graph(const t_graph_type graph_type,
                            const bool trim_obs_channels,
                            const t_direct_inf* directs,
                            const int num_directs,
+                           const int num_workers,
                            int* wire_to_rr_ipin_switch,
                            int* Warnings);
 
@@ -318,6 +337,7 @@ void create_rr_graph(const t_graph_type graph_type,
                      const enum e_clock_modeling clock_modeling,
                      const t_direct_inf* directs,
                      const int num_directs,
+                     const int num_workers,
                      int* Warnings) {
     const auto& device_ctx = g_vpr_ctx.device();
 
@@ -330,7 +350,8 @@ void create_rr_graph(const t_graph_type graph_type,
                          segment_inf,
                          base_cost_type,
                          &det_routing_arch->wire_to_rr_ipin_switch,
-                         det_routing_arch->read_rr_graph_filename.c_str());
+                         det_routing_arch->read_rr_graph_filename.c_str(),
+                         num_workers);
         }
     } else {
         if (channel_widths_unchanged(device_ctx.chan_width, nodes_per_chan) && !device_ctx.rr_nodes.empty()) {
@@ -359,6 +380,7 @@ void create_rr_graph(const t_graph_type graph_type,
                        trim_empty_channels,
                        trim_obs_channels,
                        directs, num_directs,
+                       num_workers,
                        &det_routing_arch->wire_to_rr_ipin_switch,
                        Warnings);
 
@@ -391,6 +413,21 @@ void print_rr_graph_stats() {
 
     VTR_LOG("  RR Graph Nodes: %zu\n", device_ctx.rr_nodes.size());
     VTR_LOG("  RR Graph Edges: %zu\n", num_rr_edges);
+
+    //Attribute the RR graph's dominant storage for per-subsystem memory
+    //accounting (capacity-based: node array, shared edge array, the
+    //spatial node lookup and the switch/cost-index tables)
+    size_t footprint_bytes = device_ctx.rr_nodes.capacity() * sizeof(t_rr_node);
+    footprint_bytes += t_rr_node::edge_storage_bytes();
+    for (const auto& type_matrix : device_ctx.rr_node_indices) {
+        footprint_bytes += type_matrix.size() * sizeof(std::vector<int>);
+        for (const std::vector<int>& nodes_at_loc : type_matrix) {
+            footprint_bytes += nodes_at_loc.capacity() * sizeof(int);
+        }
+    }
+    footprint_bytes += device_ctx.rr_switch_inf.capacity() * sizeof(t_rr_switch_inf);
+    footprint_bytes += device_ctx.rr_indexed_data.capacity() * sizeof(t_rr_indexed_data);
+    vtr::memory_usage::report("rr_graph", footprint_bytes);
 }
 
 bool channel_widths_unchanged(const t_chan_width& current, const t_chan_width& proposed) {
@@ -426,6 +463,7 @@ static void build_rr_graph(const t_graph_type graph_type,
                            const bool trim_obs_channels,
                            const t_direct_inf* directs,
                            const int num_directs,
+                           const int num_workers,
                            int* wire_to_rr_ipin_switch,
                            int* Warnings) {
     vtr::ScopedStartFinishTimer timer("Build routing resource graph");
@@ -580,6 +618,7 @@ static void build_rr_graph(const t_graph_type graph_type,
     device_ctx.rr_node_indices = alloc_and_load_rr_node_indices(max_chan_width, grid,
                                                                 &num_rr_nodes, chan_details_x, chan_details_y);
     device_ctx.rr_nodes.resize(num_rr_nodes);
+    vtr::hint_large_array(device_ctx.rr_nodes.data(), device_ctx.rr_nodes.size() * sizeof(t_rr_node));
 
     /* These are data structures used by the the unidir opin mapping. They are used
      * to spread connections evenly for each segment type among the available
@@ -690,7 +729,8 @@ static void build_rr_graph(const t_graph_type graph_type,
                             directionality,
                             &Fc_clipped,
                             directs, num_directs, clb_to_clb_directs,
-                            is_global_graph);
+                            is_global_graph,
+                            num_workers);
 
     /* Update rr_nodes capacities if global routing */
     if (graph_type == GRAPH_GLOBAL) {
@@ -718,9 +758,9 @@ static void build_rr_graph(const t_graph_type graph_type,
     device_ctx.chan_width = nodes_per_chan;
 
     rr_graph_externals(segment_inf, max_chan_width,
-                       *wire_to_rr_ipin_switch, base_cost_type);
+                       *wire_to_rr_ipin_switch, base_cost_type, num_workers);
 
-    check_rr_graph(graph_type, grid, types);
+    check_rr_graph(graph_type, grid, types, num_workers);
 
     /* Free all temp structs */
     if (seg_details) {
@@ -943,10 +983,11 @@ static void remap_rr_node_switch_indices(const t_arch_switch_fanin& switch_fanin
 static void rr_graph_externals(const std::vector<t_segment_inf>& segment_inf,
                                int max_chan_width,
                                int wire_to_rr_ipin_switch,
-                               enum e_base_cost_type base_cost_type) {
+                               enum e_base_cost_type base_cost_type,
+                               const int num_workers) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    add_rr_graph_C_from_switches(device_ctx.rr_switch_inf[wire_to_rr_ipin_switch].Cin);
+    add_rr_graph_C_from_switches(device_ctx.rr_switch_inf[wire_to_rr_ipin_switch].Cin, num_workers);
     alloc_and_load_rr_indexed_data(segment_inf, device_ctx.rr_node_indices,
                                    max_chan_width, wire_to_rr_ipin_switch, base_cost_type);
     load_rr_index_segments(segment_inf.size());
@@ -1170,6 +1211,47 @@ static void free_type_track_to_pin_map(t_track_to_pin_lookup& track_to_pin_map,
     }
 }
 
+//Minimum number of independent work units (tiles or channel segments) each
+//RR graph builder thread should receive; below this the thread start-up cost
+//outweighs any gain from parallelism
+constexpr size_t MIN_WORK_PER_RR_BUILD_WORKER = 32;
+
+//Runs 'work(iworker, ibegin, iend)' across 'num_workers' threads, splitting
+//[0, num_items) into contiguous per-worker ranges.
+//
+//Any exception thrown by a worker is re-thrown in the calling thread once all
+//workers have joined (if multiple workers fail only the first error is
+//reported).
+template<typename Func>
+static void run_rr_build_workers(size_t num_workers, size_t num_items, Func work) {
+    std::vector<std::exception_ptr> worker_errors(num_workers);
+    std::vector<std::thread> workers;
+
+    size_t items_per_worker = (num_items + num_workers - 1) / num_workers;
+    for (size_t iworker = 0; iworker < num_workers; ++iworker) {
+        size_t ibegin = std::min(num_items, iworker * items_per_worker);
+        size_t iend = std::min(num_items, ibegin + items_per_worker);
+
+        workers.emplace_back([&, iworker, ibegin, iend]() {
+            try {
+                work(iworker, ibegin, iend);
+            } catch (...) {
+                worker_errors[iworker] = std::current_exception();
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto& error : worker_errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 /* Does the actual work of allocating the rr_graph and filling all the *
  * appropriate values.  Everything up to this was just a prelude!      */
 static void alloc_and_load_rr_graph(const int num_nodes,
@@ -1197,7 +1279,8 @@ static void alloc_and_load_rr_graph(const int num_nodes,
                                     const t_direct_inf* directs,
                                     const int num_directs,
                                     const t_clb_to_clb_directs* clb_to_clb_directs,
-                                    bool is_global_graph) {
+                                    bool is_global_graph,
+                                    const int num_workers) {
     //We take special care when creating RR graph edges (there are typically many more
     //edges than nodes in an RR graph).
     //
@@ -1211,25 +1294,78 @@ static void alloc_and_load_rr_graph(const int num_nodes,
     //node, which avoids resizing the RR edge arrays (which can cause significant memory
     //fragmentation, and significantly increasing peak memory usage). This is important since
     //RR graph creation is the high-watermark of VPR's memory use.
+    //The tile and channel build phases below are parallelized when num_workers
+    //allows: the nodes (and edges-to-be-created) each work unit touches are
+    //disjoint from every other work unit's, so the workers only record edges
+    //into worker-local rr_edges_to_create sets. The edges themselves are still
+    //materialized serially (in alloc_and_load_edges), since all nodes' edges
+    //share a single backing array.
     t_rr_edge_info_set rr_edges_to_create;
 
     /* If Fc gets clipped, this will be flagged to true */
     *Fc_clipped = false;
 
+    size_t max_build_workers = std::max(1, num_workers);
+
+    if (max_build_workers > 1) {
+        //Pre-create the (shared, fly-weighted) RC data in the same order the
+        //serial build would, so the parallel workers below only perform
+        //read-only lookups (and the resulting rc_indices are deterministic)
+        seed_rr_rc_data(grid, chan_details_x, chan_details_y, chan_width, is_global_graph);
+    }
+
     /* Connection SINKS and SOURCES to their pins. */
-    for (size_t i = 0; i < grid.width(); ++i) {
-        for (size_t j = 0; j < grid.height(); ++j) {
-            build_rr_sinks_sources(i, j, L_rr_node, rr_edges_to_create, L_rr_node_indices,
-                                   delayless_switch, grid);
+    {
+        //Each grid location is initialized by the root tile of the block
+        //covering it, so the root tiles form independent work units
+        std::vector<std::pair<size_t, size_t>> root_tiles;
+        for (size_t i = 0; i < grid.width(); ++i) {
+            for (size_t j = 0; j < grid.height(); ++j) {
+                if (grid[i][j].width_offset == 0 && grid[i][j].height_offset == 0) {
+                    root_tiles.emplace_back(i, j);
+                }
+            }
+        }
+
+        size_t num_tile_workers = std::min(max_build_workers,
+                                           std::max<size_t>(1, root_tiles.size() / MIN_WORK_PER_RR_BUILD_WORKER));
+
+        if (num_tile_workers <= 1) {
+            for (auto& tile : root_tiles) {
+                build_rr_sinks_sources(tile.first, tile.second, L_rr_node, rr_edges_to_create, L_rr_node_indices,
+                                       delayless_switch, grid);
+
+                //Create the actual SOURCE->OPIN, IPIN->SINK edges
+                uniquify_edges(rr_edges_to_create);
+                alloc_and_load_edges(L_rr_node, rr_edges_to_create);
+                rr_edges_to_create.clear();
+            }
+        } else {
+            std::vector<t_rr_edge_info_set> worker_edges(num_tile_workers);
+
+            run_rr_build_workers(num_tile_workers, root_tiles.size(),
+                                 [&](size_t iworker, size_t ibegin, size_t iend) {
+                                     for (size_t itile = ibegin; itile != iend; ++itile) {
+                                         build_rr_sinks_sources(root_tiles[itile].first, root_tiles[itile].second,
+                                                                L_rr_node, worker_edges[iworker], L_rr_node_indices,
+                                                                delayless_switch, grid);
+                                     }
+                                 });
 
             //Create the actual SOURCE->OPIN, IPIN->SINK edges
-            uniquify_edges(rr_edges_to_create);
-            alloc_and_load_edges(L_rr_node, rr_edges_to_create);
-            rr_edges_to_create.clear();
+            for (auto& edges : worker_edges) {
+                uniquify_edges(edges);
+                alloc_and_load_edges(L_rr_node, edges);
+                edges.clear();
+                edges.shrink_to_fit();
+            }
         }
     }
 
     /* Build opins */
+    //Note this phase is always serial: build_unidir_rr_opins() accumulates
+    //into the Fc_xofs/Fc_yofs counters, whose values at each tile depend on
+    //all previously processed tiles sharing the channel
     for (size_t i = 0; i < grid.width(); ++i) {
         for (size_t j = 0; j < grid.height(); ++j) {
             for (e_side side : SIDES) {
@@ -1260,44 +1396,144 @@ static void alloc_and_load_rr_graph(const int num_nodes,
 
     /* Build channels */
     VTR_ASSERT(Fs % 3 == 0);
-    for (size_t i = 0; i < grid.width() - 1; ++i) {
-        for (size_t j = 0; j < grid.height() - 1; ++j) {
-            if (i > 0) {
-                int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.x_list[j]);
-                build_rr_chan(i, j, CHANX, track_to_pin_lookup, sb_conn_map, switch_block_conn,
+    {
+        //Each channel segment location is an independent work unit:
+        //build_rr_chan() only loads the nodes of wires starting at that
+        //location, and only records edges leaving those wires
+        struct t_chan_loc {
+            size_t x;
+            size_t y;
+            t_rr_type chan_type;
+        };
+        std::vector<t_chan_loc> chan_locs;
+        for (size_t i = 0; i < grid.width() - 1; ++i) {
+            for (size_t j = 0; j < grid.height() - 1; ++j) {
+                if (i > 0) {
+                    chan_locs.push_back({i, j, CHANX});
+                }
+                if (j > 0) {
+                    chan_locs.push_back({i, j, CHANY});
+                }
+            }
+        }
+
+        auto build_chan = [&](const t_chan_loc& loc, t_rr_edge_info_set& edges) {
+            if (loc.chan_type == CHANX) {
+                int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.x_list[loc.y]);
+                build_rr_chan(loc.x, loc.y, CHANX, track_to_pin_lookup, sb_conn_map, switch_block_conn,
                               CHANX_COST_INDEX_START,
                               max_chan_width, grid, tracks_per_chan,
                               sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
-                              L_rr_node_indices, rr_edges_to_create, L_rr_node,
+                              L_rr_node_indices, edges, L_rr_node,
                               wire_to_ipin_switch,
                               directionality);
-
-                //Create the actual CHAN->CHAN edges
-                uniquify_edges(rr_edges_to_create);
-                alloc_and_load_edges(L_rr_node, rr_edges_to_create);
-                rr_edges_to_create.clear();
-            }
-            if (j > 0) {
-                int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.y_list[i]);
-                build_rr_chan(i, j, CHANY, track_to_pin_lookup, sb_conn_map, switch_block_conn,
+            } else {
+                VTR_ASSERT(loc.chan_type == CHANY);
+                int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.y_list[loc.x]);
+                build_rr_chan(loc.x, loc.y, CHANY, track_to_pin_lookup, sb_conn_map, switch_block_conn,
                               CHANX_COST_INDEX_START + num_seg_types,
                               max_chan_width, grid, tracks_per_chan,
                               sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
-                              L_rr_node_indices, rr_edges_to_create, L_rr_node,
+                              L_rr_node_indices, edges, L_rr_node,
                               wire_to_ipin_switch,
                               directionality);
+            }
+        };
+
+        size_t num_chan_workers = std::min(max_build_workers,
+                                           std::max<size_t>(1, chan_locs.size() / MIN_WORK_PER_RR_BUILD_WORKER));
+
+        if (num_chan_workers <= 1) {
+            for (auto& loc : chan_locs) {
+                build_chan(loc, rr_edges_to_create);
 
                 //Create the actual CHAN->CHAN edges
                 uniquify_edges(rr_edges_to_create);
                 alloc_and_load_edges(L_rr_node, rr_edges_to_create);
                 rr_edges_to_create.clear();
             }
+        } else {
+            std::vector<t_rr_edge_info_set> worker_edges(num_chan_workers);
+
+            run_rr_build_workers(num_chan_workers, chan_locs.size(),
+                                 [&](size_t iworker, size_t ibegin, size_t iend) {
+                                     for (size_t iloc = ibegin; iloc != iend; ++iloc) {
+                                         build_chan(chan_locs[iloc], worker_edges[iworker]);
+                                     }
+                                 });
+
+            //Create the actual CHAN->CHAN edges
+            for (auto& edges : worker_edges) {
+                uniquify_edges(edges);
+                alloc_and_load_edges(L_rr_node, edges);
+                edges.clear();
+                edges.shrink_to_fit();
+            }
         }
     }
 
     init_fan_in(L_rr_node, num_nodes);
 }
 
+//Pre-creates all the fly-weighted RC data the tile and channel build phases
+//will request, matching the order the fully serial build would create them in.
+//
+//This makes find_create_rr_rc_data() lookups from parallel build workers
+//read-only (no locking required beyond safety, see find_create_rr_rc_data()),
+//and keeps the assigned rc_indices independent of the worker count. Note wires
+//clipped out of the graph (e.g. by obstructions) may leave a few unreferenced
+//entries behind; this slightly grows the (small) RC table but does not affect
+//the graph itself.
+static void seed_rr_rc_data(const DeviceGrid& grid,
+                            const t_chan_details& chan_details_x,
+                            const t_chan_details& chan_details_y,
+                            const t_chan_width& chan_width,
+                            bool is_global_graph) {
+    //SOURCEs/SINKs/IPINs/OPINs are all ideal (R = C = 0)
+    find_create_rr_rc_data(0., 0.);
+
+    //Channel wires, mirroring the traversal order of the channel build phase
+    for (size_t i = 0; i < grid.width() - 1; ++i) {
+        for (size_t j = 0; j < grid.height() - 1; ++j) {
+            if (i > 0) { //CHANX
+                int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.x_list[j]);
+                seed_chan_rr_rc_data(chan_details_x[i][j].data(), tracks_per_chan,
+                                     j, i, grid.width() - 2);
+            }
+            if (j > 0) { //CHANY
+                int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.y_list[i]);
+                seed_chan_rr_rc_data(chan_details_y[i][j].data(), tracks_per_chan,
+                                     i, j, grid.height() - 2);
+            }
+        }
+    }
+}
+
+//Creates the RC data of the wire segments starting at the specified channel
+//location (matching the R/C calculations of build_rr_chan())
+static void seed_chan_rr_rc_data(const t_chan_seg_details* seg_details,
+                                 const int tracks_per_chan,
+                                 const int chan_coord,
+                                 const int seg_coord,
+                                 const int seg_dimension) {
+    for (int track = 0; track < tracks_per_chan; ++track) {
+        if (seg_details[track].length() == 0)
+            continue;
+
+        int start = get_seg_start(seg_details, track, chan_coord, seg_coord);
+
+        if (seg_coord > start)
+            continue; /* Only process segments which start at this location */
+
+        int end = get_seg_end(seg_details, track, start, chan_coord, seg_dimension);
+
+        int length = end - start + 1;
+        float R = length * seg_details[track].Rmetal();
+        float C = length * seg_details[track].Cmetal();
+        find_create_rr_rc_data(R, C);
+    }
+}
+
 static void build_bidir_rr_opins(const int i,
                                  const int j,
                                  const e_side side,
@@ -1377,6 +1613,7 @@ void free_rr_graph() {
     device_ctx.rr_node_indices.clear();
 
     device_ctx.rr_nodes.clear();
+    t_rr_node::clear_edge_storage();
 
     device_ctx.rr_node_indices.clear();
 
@@ -1719,58 +1956,88 @@ static void build_rr_chan(const int x_coord,
 }
 
 void uniquify_edges(t_rr_edge_info_set& rr_edges_to_create) {
-    std::sort(rr_edges_to_create.begin(), rr_edges_to_create.end());
-    rr_edges_to_create.erase(std::unique(rr_edges_to_create.begin(), rr_edges_to_create.end()), rr_edges_to_create.end());
+    //Remove duplicate edges with a single pass over a flat open-addressing
+    //hash table, compacting the unique edges (in first-seen order) in place.
+    //
+    //This is substantially lighter on comparisons than the former sort+unique
+    //(edge creation dominates RR graph build time), and the table is a single
+    //flat allocation. The surviving edge order is the (deterministic) order
+    //the build_*() functions recorded the edges in.
+    if (rr_edges_to_create.empty()) return;
+
+    //Table of indices into the compacted prefix of rr_edges_to_create,
+    //power-of-two sized for cheap modulo, kept at most half full
+    size_t table_size = 4;
+    while (table_size < 2 * rr_edges_to_create.size()) {
+        table_size *= 2;
+    }
+    std::vector<int> table(table_size, OPEN);
+
+    size_t num_unique = 0;
+    for (size_t iedge = 0; iedge < rr_edges_to_create.size(); ++iedge) {
+        const t_rr_edge_info& edge = rr_edges_to_create[iedge];
+
+        size_t hash = std::hash<int>()(edge.from_node);
+        vtr::hash_combine(hash, edge.to_node);
+        vtr::hash_combine(hash, edge.switch_type);
+
+        size_t bucket = hash & (table_size - 1);
+        while (table[bucket] != OPEN && !(rr_edges_to_create[table[bucket]] == edge)) {
+            bucket = (bucket + 1) & (table_size - 1); //Linear probing
+        }
+
+        if (table[bucket] == OPEN) { //First occurrence
+            table[bucket] = num_unique;
+            rr_edges_to_create[num_unique] = edge; //In-place compaction (num_unique <= iedge)
+            ++num_unique;
+        }
+    }
+    rr_edges_to_create.erase(rr_edges_to_create.begin() + num_unique, rr_edges_to_create.end());
 }
 
 void alloc_and_load_edges(std::vector<t_rr_node>& L_rr_node,
                           const t_rr_edge_info_set& rr_edges_to_create) {
     /* Sets up all the edge related information for rr_node */
 
-    struct compare_from_node {
-        auto operator()(const t_rr_edge_info& lhs, const int from_node) {
-            return lhs.from_node < from_node;
-        }
-        auto operator()(const int from_node, const t_rr_edge_info& rhs) {
-            return from_node < rhs.from_node;
-        }
-    };
-
-    std::set<int> from_nodes;
+    //Count the edges leaving each node, so each node's edge array can be
+    //allocated exactly once.
+    //
+    //Note that we do this in bulk instead of via add_edge() to reduce
+    //memory fragmentation
+    std::unordered_map<int, int> node_edge_slots; //[from_node] -> count, then next write slot
     for (auto& edge : rr_edges_to_create) {
-        from_nodes.insert(edge.from_node);
+        ++node_edge_slots[edge.from_node];
     }
 
-    VTR_ASSERT_SAFE(std::is_sorted(rr_edges_to_create.begin(), rr_edges_to_create.end()));
-
-    for (int inode : from_nodes) {
-        auto edge_range = std::equal_range(rr_edges_to_create.begin(), rr_edges_to_create.end(), inode, compare_from_node());
-
-        size_t edge_count = std::distance(edge_range.first, edge_range.second);
-
+    for (auto& kv : node_edge_slots) {
+        int inode = kv.first;
         if (L_rr_node[inode].num_edges() == 0) {
-            //Create initial edges
-            //
-            //Note that we do this in bulk instead of via add_edge() to reduce
-            //memory fragmentation
-
-            L_rr_node[inode].set_num_edges(edge_count);
+            //Create initial edges in bulk; kv.second becomes the next edge
+            //slot to write below
+            L_rr_node[inode].set_num_edges(kv.second);
+            kv.second = 0;
+        } else {
+            //The node already has edges; mark it so the sweep below adds the
+            //new edges incrementally instead of overwriting existing ones
+            kv.second = OPEN;
+        }
+    }
 
-            int iedge = 0;
-            for (auto itr = edge_range.first; itr != edge_range.second; ++itr) {
-                VTR_ASSERT(itr->from_node == inode);
+    //Write the per-node adjacency in a single sweep, preserving the order the
+    //edges were recorded in
+    for (auto& edge : rr_edges_to_create) {
+        auto itr = node_edge_slots.find(edge.from_node);
+        VTR_ASSERT_SAFE(itr != node_edge_slots.end());
 
-                L_rr_node[inode].set_edge_sink_node(iedge, itr->to_node);
-                L_rr_node[inode].set_edge_switch(iedge, itr->switch_type);
-                ++iedge;
-            }
-        } else {
+        if (itr->second == OPEN) {
             //Add new edge incrementally
             //
             //This should occur relatively rarely (e.g. a backward bidir edge) so memory fragmentation shouldn't be a big problem
-            for (auto itr = edge_range.first; itr != edge_range.second; ++itr) {
-                L_rr_node[inode].add_edge(itr->to_node, itr->switch_type);
-            }
+            L_rr_node[edge.from_node].add_edge(edge.to_node, edge.switch_type);
+        } else {
+            L_rr_node[edge.from_node].set_edge_sink_node(itr->second, edge.to_node);
+            L_rr_node[edge.from_node].set_edge_switch(itr->second, edge.switch_type);
+            ++itr->second;
         }
     }
 }
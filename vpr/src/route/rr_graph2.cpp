@@ -1030,13 +1030,11 @@ static void load_chan_rr_indices(const int max_chan_width,
                                  const t_chan_details& chan_details,
                                  t_rr_node_indices& indices,
                                  int* index) {
-    VTR_ASSERT(indices[type].size() == size_t(num_chans));
+    VTR_ASSERT(indices[type].dim_size(0) == size_t(num_chans));
+    VTR_ASSERT(indices[type].dim_size(1) == size_t(chan_len));
+    VTR_ASSERT(indices[type].dim_size(2) == NUM_SIDES);
     for (int chan = 0; chan < num_chans - 1; ++chan) {
-        VTR_ASSERT(indices[type][chan].size() == size_t(chan_len));
-
         for (int seg = 1; seg < chan_len - 1; ++seg) {
-            VTR_ASSERT(indices[type][chan][seg].size() == NUM_SIDES);
-
             /* Alloc the track inode lookup list */
             //Since channels have no side, we just use the first side
             indices[type][chan][seg][0].resize(max_chan_width, OPEN);
@@ -1154,8 +1152,9 @@ static void load_block_rr_indices(const DeviceGrid& grid,
                 int root_x = x - width_offset;
                 int root_y = y - height_offset;
 
-                indices[SOURCE][x][y] = indices[SOURCE][root_x][root_y];
-                indices[SINK][x][y] = indices[SINK][root_x][root_y];
+                //SOURCEs/SINKs have no side, so only side 0 is populated
+                indices[SOURCE][x][y][0] = indices[SOURCE][root_x][root_y][0];
+                indices[SINK][x][y][0] = indices[SINK][root_x][root_y][0];
             }
         }
     }
@@ -1176,21 +1175,10 @@ t_rr_node_indices alloc_and_load_rr_node_indices(const int max_chan_width,
     indices.resize(NUM_RR_TYPES);
     for (t_rr_type rr_type : RR_TYPES) {
         if (rr_type == CHANX) {
-            indices[rr_type].resize(grid.height());
-            for (size_t y = 0; y < grid.height(); ++y) {
-                indices[rr_type][y].resize(grid.width());
-                for (size_t x = 0; x < grid.width(); ++x) {
-                    indices[rr_type][y][x].resize(NUM_SIDES);
-                }
-            }
+            /* CHANX dimensions are transposed to match the chan/seg convention */
+            indices[rr_type] = vtr::NdMatrix<std::vector<int>, 3>({grid.height(), grid.width(), NUM_SIDES});
         } else {
-            indices[rr_type].resize(grid.width());
-            for (size_t x = 0; x < grid.width(); ++x) {
-                indices[rr_type][x].resize(grid.height());
-                for (size_t y = 0; y < grid.height(); ++y) {
-                    indices[rr_type][x][y].resize(NUM_SIDES);
-                }
-            }
+            indices[rr_type] = vtr::NdMatrix<std::vector<int>, 3>({grid.width(), grid.height(), NUM_SIDES});
         }
     }
 
@@ -2,6 +2,8 @@
 #define RR_GRAPH2_H
 #include <vector>
 
+#include "vtr_paged_vector.h"
+
 #include "build_switchblocks.h"
 #include "rr_graph_util.h"
 #include "rr_types.h"
@@ -33,7 +35,11 @@ struct t_rr_edge_info {
     }
 };
 
-typedef std::vector<t_rr_edge_info> t_rr_edge_info_set;
+//The edges-to-be-created are accumulated in a paged vector: the set grows to
+//a large fraction of the final RR graph's edges, and paged growth avoids
+//std::vector's reallocate-and-copy (which transiently nearly doubles peak
+//memory during RR graph build, VPR's memory high-watermark)
+typedef vtr::paged_vector<t_rr_edge_info> t_rr_edge_info_set;
 
 typedef vtr::NdMatrix<short, 6> t_sblock_pattern;
 
@@ -1,4 +1,6 @@
 #include <cmath>
+#include <atomic>
+#include <vector>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -13,6 +15,10 @@
 #include "rr_graph_util.h"
 #include "rr_graph_area.h"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/parallel_for.h>
+#endif
+
 /* Select which transistor area equation to use. As found by Chiasson's and Betz's FPL 2013 paper
  * (Should FPGAs Abandon the Pass Gate?), the traditional transistor area model
  * significantly overpredicts area at smaller process nodes. Their improved area models
@@ -33,7 +39,52 @@ static void count_unidir_routing_transistors(std::vector<t_segment_inf>& segment
                                              float R_minW_pmos,
                                              const float trans_sram_bit);
 
-static float get_cblock_trans(int* num_inputs_to_cblock, int wire_to_ipin_switch, int max_inputs_to_cblock, float trans_sram_bit);
+static float get_cblock_trans(const std::vector<std::atomic<int>>& num_inputs_to_cblock, int wire_to_ipin_switch, int max_inputs_to_cblock, float trans_sram_bit);
+
+/* The transistor accounting below is a pure reduction over the RR nodes, so
+ * it is computed in fixed-size node chunks: each chunk produces a partial sum
+ * (independently, and hence in parallel when TBB is available) and the
+ * partials are added together in chunk order. Summing in chunk order keeps
+ * the reported totals bit-identical regardless of how many threads ran. */
+constexpr size_t AREA_CHUNK_NODES = 8192;
+
+/* Runs count_chunk(first_node, last_node) for each chunk and returns the
+ * chunk partial sums added in chunk order. The partial type just needs a
+ * zero-initializing default constructor and operator+=. */
+template<typename F>
+static auto chunked_node_reduction(size_t num_nodes, const F& count_chunk) -> decltype(count_chunk(size_t(0), size_t(0))) {
+    using T = decltype(count_chunk(size_t(0), size_t(0)));
+
+    size_t num_chunks = (num_nodes + AREA_CHUNK_NODES - 1) / AREA_CHUNK_NODES;
+    std::vector<T> chunk_trans(num_chunks);
+
+    auto run_chunk = [&](size_t ichunk) {
+        size_t first_node = ichunk * AREA_CHUNK_NODES;
+        size_t last_node = std::min(first_node + AREA_CHUNK_NODES, num_nodes);
+        chunk_trans[ichunk] = count_chunk(first_node, last_node);
+    };
+
+#if defined(VPR_USE_TBB)
+    tbb::parallel_for(size_t(0), num_chunks, run_chunk);
+#else
+    for (size_t ichunk = 0; ichunk < num_chunks; ++ichunk) {
+        run_chunk(ichunk);
+    }
+#endif
+
+    T total{};
+    for (const T& partial : chunk_trans) {
+        total += partial;
+    }
+    return total;
+}
+
+/* Atomically lowers target to value if value is smaller */
+static void atomic_fetch_min(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t cur = target.load(std::memory_order_relaxed);
+    while (value < cur && !target.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+}
 
 static float* alloc_and_load_unsharable_switch_trans(int num_switch,
                                                      float trans_sram_bit,
@@ -101,26 +152,23 @@ void count_bidir_routing_transistors(int num_switch, int wire_to_ipin_switch, fl
      * optimistic (but I still think it's pretty reasonable).                    */
     auto& device_ctx = g_vpr_ctx.device();
 
-    int* num_inputs_to_cblock; /* [0..device_ctx.rr_nodes.size()-1], but all entries not    */
-
-    /* corresponding to IPINs will be 0.           */
+    /* [0..device_ctx.rr_nodes.size()-1]; all entries not corresponding to
+     * IPINs stay 0. Atomic since several node chunks may feed the same IPIN. */
+    std::vector<std::atomic<int>> num_inputs_to_cblock(device_ctx.rr_nodes.size());
+    for (auto& num_inputs : num_inputs_to_cblock)
+        num_inputs.store(0, std::memory_order_relaxed);
 
-    bool* cblock_counted;                                   /* [0..max(device_ctx.grid.width(),device_ctx.grid.height())] -- 0th element unused. */
-    float* shared_buffer_trans;                             /* [0..max(device_ctx.grid.width(),device_ctx.grid.height())] */
     float *unsharable_switch_trans, *sharable_switch_trans; /* [0..num_switch-1] */
 
-    t_rr_type from_rr_type, to_rr_type;
-    int iedge, num_edges, maxlen;
-    int iswitch, i, j, iseg, max_inputs_to_cblock;
-    float input_cblock_trans, shared_opin_buffer_trans;
+    int maxlen, max_inputs_to_cblock;
+    float input_cblock_trans;
 
     /* Two variables below are the accumulator variables that add up all the    *
      * transistors in the routing.  Make doubles so that they don't stop        *
      * incrementing once adding a switch makes a change of less than 1 part in  *
-     * 10^7 to the total.  If this still isn't good enough (adding 1 part in    *
-     * 10^15 will still be thrown away), compute the transistor count in        *
-     * "chunks", by adding up inodes 1 to 1000, 1001 to 2000 and then summing   *
-     * the partial sums together.                                               */
+     * 10^7 to the total.  They are computed in node chunks whose partial sums  *
+     * are added together (see chunked_node_reduction()), which also keeps      *
+     * them accurate on very large graphs.                                      */
 
     double ntrans_sharing, ntrans_no_sharing;
 
@@ -129,10 +177,6 @@ void count_bidir_routing_transistors(int num_switch, int wire_to_ipin_switch, fl
 
     float trans_track_to_cblock_buf;
 
-    ntrans_sharing = 0.;
-    ntrans_no_sharing = 0.;
-    max_inputs_to_cblock = 0;
-
     /* Assume the buffer below is 4x minimum drive strength (enough to        *
      * drive a fanout of up to 16 pretty nicely) -- should cover a reasonable *
      * wiring C plus the fanout.                                              */
@@ -144,11 +188,7 @@ void count_bidir_routing_transistors(int num_switch, int wire_to_ipin_switch, fl
         trans_track_to_cblock_buf = 0;
     }
 
-    num_inputs_to_cblock = (int*)vtr::calloc(device_ctx.rr_nodes.size(), sizeof(int));
-
     maxlen = std::max(device_ctx.grid.width(), device_ctx.grid.height());
-    cblock_counted = (bool*)vtr::calloc(maxlen, sizeof(bool));
-    shared_buffer_trans = (float*)vtr::calloc(maxlen, sizeof(float));
 
     unsharable_switch_trans = alloc_and_load_unsharable_switch_trans(num_switch,
                                                                      trans_sram_bit, R_minW_nmos);
@@ -156,133 +196,160 @@ void count_bidir_routing_transistors(int num_switch, int wire_to_ipin_switch, fl
     sharable_switch_trans = alloc_and_load_sharable_switch_trans(num_switch,
                                                                  R_minW_nmos, R_minW_pmos);
 
-    for (size_t from_node = 0; from_node < device_ctx.rr_nodes.size(); from_node++) {
-        from_rr_type = device_ctx.rr_nodes[from_node].type();
+    struct t_bidir_partial {
+        double sharing = 0.;
+        double no_sharing = 0.;
+        t_bidir_partial& operator+=(const t_bidir_partial& other) {
+            sharing += other.sharing;
+            no_sharing += other.no_sharing;
+            return *this;
+        }
+    };
+
+    auto count_chunk = [&](size_t first_node, size_t last_node) -> t_bidir_partial {
+        t_bidir_partial ntrans;
+
+        /* Scratch for de-duplication within a single node's edge list; every
+         * entry touched is reset before moving to the next node, so each
+         * chunk can use its own copy.
+         * [0..max(device_ctx.grid.width(),device_ctx.grid.height())] -- 0th element unused. */
+        std::vector<bool> cblock_counted(maxlen, false);
+        std::vector<float> shared_buffer_trans(maxlen, 0.);
+
+        for (size_t from_node = first_node; from_node < last_node; from_node++) {
+            t_rr_type from_rr_type = device_ctx.rr_nodes[from_node].type();
+            int iedge, num_edges, iswitch, i, j, iseg;
+            float shared_opin_buffer_trans;
+
+            switch (from_rr_type) {
+                case CHANX:
+                case CHANY:
+                    num_edges = device_ctx.rr_nodes[from_node].num_edges();
+
+                    for (iedge = 0; iedge < num_edges; iedge++) {
+                        size_t to_node = device_ctx.rr_nodes[from_node].edge_sink_node(iedge);
+                        t_rr_type to_rr_type = device_ctx.rr_nodes[to_node].type();
+
+                        /* Ignore any uninitialized rr_graph nodes */
+                        if ((device_ctx.rr_nodes[to_node].type() == SOURCE)
+                            && (device_ctx.rr_nodes[to_node].xlow() == 0) && (device_ctx.rr_nodes[to_node].ylow() == 0)
+                            && (device_ctx.rr_nodes[to_node].xhigh() == 0) && (device_ctx.rr_nodes[to_node].yhigh() == 0)) {
+                            continue;
+                        }
+
+                        switch (to_rr_type) {
+                            case CHANX:
+                            case CHANY:
+                                iswitch = device_ctx.rr_nodes[from_node].edge_switch(iedge);
+
+                                if (device_ctx.rr_switch_inf[iswitch].buffered()) {
+                                    iseg = seg_index_of_sblock(from_node, to_node);
+                                    shared_buffer_trans[iseg] = std::max(shared_buffer_trans[iseg],
+                                                                         sharable_switch_trans[iswitch]);
+
+                                    ntrans.no_sharing += unsharable_switch_trans[iswitch]
+                                                         + sharable_switch_trans[iswitch];
+                                    ntrans.sharing += unsharable_switch_trans[iswitch];
+                                } else if (from_node < to_node) {
+                                    /* Pass transistor shared by two edges -- only count once.  *
+                                     * Also, no part of a pass transistor is sharable.          */
+
+                                    ntrans.no_sharing += unsharable_switch_trans[iswitch];
+                                    ntrans.sharing += unsharable_switch_trans[iswitch];
+                                }
+                                break;
 
-        switch (from_rr_type) {
-            case CHANX:
-            case CHANY:
-                num_edges = device_ctx.rr_nodes[from_node].num_edges();
+                            case IPIN:
+                                num_inputs_to_cblock[to_node].fetch_add(1, std::memory_order_relaxed);
 
-                for (iedge = 0; iedge < num_edges; iedge++) {
-                    size_t to_node = device_ctx.rr_nodes[from_node].edge_sink_node(iedge);
-                    to_rr_type = device_ctx.rr_nodes[to_node].type();
+                                iseg = seg_index_of_cblock(from_rr_type, to_node);
 
-                    /* Ignore any uninitialized rr_graph nodes */
-                    if ((device_ctx.rr_nodes[to_node].type() == SOURCE)
-                        && (device_ctx.rr_nodes[to_node].xlow() == 0) && (device_ctx.rr_nodes[to_node].ylow() == 0)
-                        && (device_ctx.rr_nodes[to_node].xhigh() == 0) && (device_ctx.rr_nodes[to_node].yhigh() == 0)) {
-                        continue;
+                                if (cblock_counted[iseg] == false) {
+                                    cblock_counted[iseg] = true;
+                                    ntrans.sharing += trans_track_to_cblock_buf;
+                                    ntrans.no_sharing += trans_track_to_cblock_buf;
+                                }
+                                break;
+
+                            default:
+                                VPR_ERROR(VPR_ERROR_ROUTE,
+                                          "in count_routing_transistors:\n"
+                                          "\tUnexpected connection from node %d (type %s) to node %d (type %s).\n",
+                                          from_node, rr_node_typename[from_rr_type], to_node, rr_node_typename[to_rr_type]);
+                                break;
+
+                        } /* End switch on to_rr_type. */
+
+                    } /* End for each edge. */
+
+                    /* Now add in the shared buffer transistors, and reset some flags. */
+
+                    if (from_rr_type == CHANX) {
+                        for (i = device_ctx.rr_nodes[from_node].xlow() - 1;
+                             i <= device_ctx.rr_nodes[from_node].xhigh(); i++) {
+                            ntrans.sharing += shared_buffer_trans[i];
+                            shared_buffer_trans[i] = 0.;
+                        }
+
+                        for (i = device_ctx.rr_nodes[from_node].xlow(); i <= device_ctx.rr_nodes[from_node].xhigh();
+                             i++)
+                            cblock_counted[i] = false;
+
+                    } else { /* CHANY */
+                        for (j = device_ctx.rr_nodes[from_node].ylow() - 1;
+                             j <= device_ctx.rr_nodes[from_node].yhigh(); j++) {
+                            ntrans.sharing += shared_buffer_trans[j];
+                            shared_buffer_trans[j] = 0.;
+                        }
+
+                        for (j = device_ctx.rr_nodes[from_node].ylow(); j <= device_ctx.rr_nodes[from_node].yhigh();
+                             j++)
+                            cblock_counted[j] = false;
                     }
+                    break;
 
-                    switch (to_rr_type) {
-                        case CHANX:
-                        case CHANY:
-                            iswitch = device_ctx.rr_nodes[from_node].edge_switch(iedge);
-
-                            if (device_ctx.rr_switch_inf[iswitch].buffered()) {
-                                iseg = seg_index_of_sblock(from_node, to_node);
-                                shared_buffer_trans[iseg] = std::max(shared_buffer_trans[iseg],
-                                                                     sharable_switch_trans[iswitch]);
-
-                                ntrans_no_sharing += unsharable_switch_trans[iswitch]
-                                                     + sharable_switch_trans[iswitch];
-                                ntrans_sharing += unsharable_switch_trans[iswitch];
-                            } else if (from_node < to_node) {
-                                /* Pass transistor shared by two edges -- only count once.  *
-                                 * Also, no part of a pass transistor is sharable.          */
-
-                                ntrans_no_sharing += unsharable_switch_trans[iswitch];
-                                ntrans_sharing += unsharable_switch_trans[iswitch];
-                            }
-                            break;
-
-                        case IPIN:
-                            num_inputs_to_cblock[to_node]++;
-                            max_inputs_to_cblock = std::max(max_inputs_to_cblock,
-                                                            num_inputs_to_cblock[to_node]);
-
-                            iseg = seg_index_of_cblock(from_rr_type, to_node);
-
-                            if (cblock_counted[iseg] == false) {
-                                cblock_counted[iseg] = true;
-                                ntrans_sharing += trans_track_to_cblock_buf;
-                                ntrans_no_sharing += trans_track_to_cblock_buf;
-                            }
-                            break;
-
-                        default:
-                            VPR_ERROR(VPR_ERROR_ROUTE,
-                                      "in count_routing_transistors:\n"
-                                      "\tUnexpected connection from node %d (type %s) to node %d (type %s).\n",
-                                      from_node, rr_node_typename[from_rr_type], to_node, rr_node_typename[to_rr_type]);
-                            break;
-
-                    } /* End switch on to_rr_type. */
-
-                } /* End for each edge. */
-
-                /* Now add in the shared buffer transistors, and reset some flags. */
-
-                if (from_rr_type == CHANX) {
-                    for (i = device_ctx.rr_nodes[from_node].xlow() - 1;
-                         i <= device_ctx.rr_nodes[from_node].xhigh(); i++) {
-                        ntrans_sharing += shared_buffer_trans[i];
-                        shared_buffer_trans[i] = 0.;
-                    }
+                case OPIN:
+                    num_edges = device_ctx.rr_nodes[from_node].num_edges();
+                    shared_opin_buffer_trans = 0.;
 
-                    for (i = device_ctx.rr_nodes[from_node].xlow(); i <= device_ctx.rr_nodes[from_node].xhigh();
-                         i++)
-                        cblock_counted[i] = false;
+                    for (iedge = 0; iedge < num_edges; iedge++) {
+                        iswitch = device_ctx.rr_nodes[from_node].edge_switch(iedge);
+                        ntrans.no_sharing += unsharable_switch_trans[iswitch]
+                                             + sharable_switch_trans[iswitch];
+                        ntrans.sharing += unsharable_switch_trans[iswitch];
 
-                } else { /* CHANY */
-                    for (j = device_ctx.rr_nodes[from_node].ylow() - 1;
-                         j <= device_ctx.rr_nodes[from_node].yhigh(); j++) {
-                        ntrans_sharing += shared_buffer_trans[j];
-                        shared_buffer_trans[j] = 0.;
+                        shared_opin_buffer_trans = std::max(shared_opin_buffer_trans,
+                                                            sharable_switch_trans[iswitch]);
                     }
 
-                    for (j = device_ctx.rr_nodes[from_node].ylow(); j <= device_ctx.rr_nodes[from_node].yhigh();
-                         j++)
-                        cblock_counted[j] = false;
-                }
-                break;
+                    ntrans.sharing += shared_opin_buffer_trans;
+                    break;
 
-            case OPIN:
-                num_edges = device_ctx.rr_nodes[from_node].num_edges();
-                shared_opin_buffer_trans = 0.;
-
-                for (iedge = 0; iedge < num_edges; iedge++) {
-                    iswitch = device_ctx.rr_nodes[from_node].edge_switch(iedge);
-                    ntrans_no_sharing += unsharable_switch_trans[iswitch]
-                                         + sharable_switch_trans[iswitch];
-                    ntrans_sharing += unsharable_switch_trans[iswitch];
-
-                    shared_opin_buffer_trans = std::max(shared_opin_buffer_trans,
-                                                        sharable_switch_trans[iswitch]);
-                }
+                default:
+                    break;
 
-                ntrans_sharing += shared_opin_buffer_trans;
-                break;
+            } /* End switch on from_rr_type */
+        }     /* End for all nodes in chunk */
 
-            default:
-                break;
+        return ntrans;
+    };
 
-        } /* End switch on from_rr_type */
-    }     /* End for all nodes */
+    t_bidir_partial totals = chunked_node_reduction(device_ctx.rr_nodes.size(), count_chunk);
+    ntrans_sharing = totals.sharing;
+    ntrans_no_sharing = totals.no_sharing;
 
-    free(cblock_counted);
-    free(shared_buffer_trans);
     free(unsharable_switch_trans);
     free(sharable_switch_trans);
 
+    max_inputs_to_cblock = 0;
+    for (const auto& num_inputs : num_inputs_to_cblock)
+        max_inputs_to_cblock = std::max(max_inputs_to_cblock, num_inputs.load(std::memory_order_relaxed));
+
     /* Now add in the input connection block transistors. */
 
     input_cblock_trans = get_cblock_trans(num_inputs_to_cblock, wire_to_ipin_switch,
                                           max_inputs_to_cblock, trans_sram_bit);
 
-    free(num_inputs_to_cblock);
-
     ntrans_sharing += input_cblock_trans;
     ntrans_no_sharing += input_cblock_trans;
 
@@ -302,31 +369,38 @@ void count_unidir_routing_transistors(std::vector<t_segment_inf>& /*segment_inf*
                                       const float trans_sram_bit) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    bool* cblock_counted;      /* [0..max(device_ctx.grid.width(),device_ctx.grid.height())] -- 0th element unused. */
-    int* num_inputs_to_cblock; /* [0..device_ctx.rr_nodes.size()-1], but all entries not    */
+    size_t num_nodes = device_ctx.rr_nodes.size();
 
-    /* corresponding to IPINs will be 0.           */
+    /* [0..device_ctx.rr_nodes.size()-1]; all entries not corresponding to
+     * IPINs stay 0. Atomic since several node chunks may feed the same IPIN. */
+    std::vector<std::atomic<int>> num_inputs_to_cblock(num_nodes);
+    for (auto& num_inputs : num_inputs_to_cblock)
+        num_inputs.store(0, std::memory_order_relaxed);
 
-    t_rr_type from_rr_type, to_rr_type;
-    int i, j, iseg, to_node, iedge, num_edges, maxlen;
+    int maxlen;
     int max_inputs_to_cblock;
     float input_cblock_trans;
 
     /* August 2014:
      * In a unidirectional architecture all the fanin to a wire segment comes from
      * a single mux. We should count this mux only once as we look at the outgoing
-     * switches of all rr nodes. Thus we keep track of which muxes we have already
-     * counted via the variable below. */
-    bool* chan_node_switch_done;
-    chan_node_switch_done = (bool*)vtr::calloc(device_ctx.rr_nodes.size(), sizeof(bool));
+     * switches of all rr nodes. Thus for each CHAN node we record the first edge
+     * (in node iteration order) that drives it -- packed as
+     * (from_node << DRIVER_EDGE_BITS) | iedge so an atomic min reproduces the
+     * first-seen-wins behaviour of the old serial scan -- and charge the mux
+     * once from that edge's switch in a second sweep. */
+    constexpr int DRIVER_EDGE_BITS = 20; //Max 2^20 edges per node
+    constexpr uint64_t NO_DRIVER_EDGE = std::numeric_limits<uint64_t>::max();
+    std::vector<std::atomic<uint64_t>> chan_driver_edge(num_nodes);
+    for (auto& driver_edge : chan_driver_edge)
+        driver_edge.store(NO_DRIVER_EDGE, std::memory_order_relaxed);
 
     /* The variable below is an accumulator variable that will add up all the   *
      * transistors in the routing.  Make double so that it doesn't stop         *
      * incrementing once adding a switch makes a change of less than 1 part in  *
-     * 10^7 to the total.  If this still isn't good enough (adding 1 part in    *
-     * 10^15 will still be thrown away), compute the transistor count in        *
-     * "chunks", by adding up inodes 1 to 1000, 1001 to 2000 and then summing   *
-     * the partial sums together.                                               */
+     * 10^7 to the total.  It is computed in node chunks whose partial sums     *
+     * are added together (see chunked_node_reduction()), which also keeps      *
+     * it accurate on very large graphs.                                        */
 
     double ntrans;
 
@@ -335,8 +409,6 @@ void count_unidir_routing_transistors(std::vector<t_segment_inf>& /*segment_inf*
 
     float trans_track_to_cblock_buf;
 
-    max_inputs_to_cblock = 0;
-
     /* Assume the buffer below is 4x minimum drive strength (enough to        *
      * drive a fanout of up to 16 pretty nicely) -- should cover a reasonable *
      * wiring C plus the fanout.                                              */
@@ -348,126 +420,149 @@ void count_unidir_routing_transistors(std::vector<t_segment_inf>& /*segment_inf*
         trans_track_to_cblock_buf = 0;
     }
 
-    num_inputs_to_cblock = (int*)vtr::calloc(device_ctx.rr_nodes.size(), sizeof(int));
     maxlen = std::max(device_ctx.grid.width(), device_ctx.grid.height());
-    cblock_counted = (bool*)vtr::calloc(maxlen, sizeof(bool));
-
-    ntrans = 0;
-    for (size_t from_node = 0; from_node < device_ctx.rr_nodes.size(); from_node++) {
-        from_rr_type = device_ctx.rr_nodes[from_node].type();
-
-        switch (from_rr_type) {
-            case CHANX:
-            case CHANY:
-                num_edges = device_ctx.rr_nodes[from_node].num_edges();
-
-                /* Increment number of inputs per cblock if IPIN */
-                for (iedge = 0; iedge < num_edges; iedge++) {
-                    to_node = device_ctx.rr_nodes[from_node].edge_sink_node(iedge);
-                    to_rr_type = device_ctx.rr_nodes[to_node].type();
-
-                    /* Ignore any uninitialized rr_graph nodes */
-                    if ((device_ctx.rr_nodes[to_node].type() == SOURCE)
-                        && (device_ctx.rr_nodes[to_node].xlow() == 0) && (device_ctx.rr_nodes[to_node].ylow() == 0)
-                        && (device_ctx.rr_nodes[to_node].xhigh() == 0) && (device_ctx.rr_nodes[to_node].yhigh() == 0)) {
-                        continue;
+
+    /* First sweep: record each CHAN node's driving edge, count the cblock
+     * inputs, and charge the track-to-cblock buffers */
+    auto count_cblock_chunk = [&](size_t first_node, size_t last_node) -> double {
+        double chunk_trans = 0.;
+
+        /* Scratch for de-duplication within a single node's edge list; every
+         * entry touched is reset before moving to the next node, so each
+         * chunk can use its own copy.
+         * [0..max(device_ctx.grid.width(),device_ctx.grid.height())] -- 0th element unused. */
+        std::vector<bool> cblock_counted(maxlen, false);
+
+        for (size_t from_node = first_node; from_node < last_node; from_node++) {
+            t_rr_type from_rr_type = device_ctx.rr_nodes[from_node].type();
+
+            if (from_rr_type != CHANX && from_rr_type != CHANY) {
+                continue;
+            }
+
+            int num_edges = device_ctx.rr_nodes[from_node].num_edges();
+
+            /* Increment number of inputs per cblock if IPIN */
+            for (int iedge = 0; iedge < num_edges; iedge++) {
+                int to_node = device_ctx.rr_nodes[from_node].edge_sink_node(iedge);
+                t_rr_type to_rr_type = device_ctx.rr_nodes[to_node].type();
+
+                /* Ignore any uninitialized rr_graph nodes */
+                if ((device_ctx.rr_nodes[to_node].type() == SOURCE)
+                    && (device_ctx.rr_nodes[to_node].xlow() == 0) && (device_ctx.rr_nodes[to_node].ylow() == 0)
+                    && (device_ctx.rr_nodes[to_node].xhigh() == 0) && (device_ctx.rr_nodes[to_node].yhigh() == 0)) {
+                    continue;
+                }
+
+                switch (to_rr_type) {
+                    case CHANX:
+                    case CHANY:
+                        atomic_fetch_min(chan_driver_edge[to_node],
+                                         (uint64_t(from_node) << DRIVER_EDGE_BITS) | uint64_t(iedge));
+                        break;
+
+                    case IPIN: {
+                        num_inputs_to_cblock[to_node].fetch_add(1, std::memory_order_relaxed);
+                        int iseg = seg_index_of_cblock(from_rr_type, to_node);
+
+                        if (cblock_counted[iseg] == false) {
+                            cblock_counted[iseg] = true;
+                            chunk_trans += trans_track_to_cblock_buf;
+                        }
+                        break;
                     }
 
-                    switch (to_rr_type) {
-                        case CHANX:
-                        case CHANY:
-                            if (!chan_node_switch_done[to_node]) {
-                                int switch_index = device_ctx.rr_nodes[from_node].edge_switch(iedge);
-                                auto switch_type = device_ctx.rr_switch_inf[switch_index].type();
-
-                                int fan_in = device_ctx.rr_nodes[to_node].fan_in();
-
-                                if (device_ctx.rr_switch_inf[switch_index].type() == SwitchType::MUX) {
-                                    /* Each wire segment begins with a multipexer followed by a driver for unidirectional */
-                                    /* Each multiplexer contains all the fan-in to that routing node */
-                                    /* Add up area of multiplexer */
-                                    ntrans += trans_per_mux(fan_in, trans_sram_bit,
-                                                            device_ctx.rr_switch_inf[switch_index].mux_trans_size);
-
-                                    /* Add up area of buffer */
-                                    /* The buffer size should already have been auto-sized (if required) when
-                                     * the rr switches were created from the arch switches */
-                                    ntrans += device_ctx.rr_switch_inf[switch_index].buf_size;
-                                } else if (switch_type == SwitchType::SHORT) {
-                                    ntrans += 0.; //Electrical shorts contribute no transisitor area
-                                } else if (switch_type == SwitchType::BUFFER) {
-                                    if (fan_in != 1) {
-                                        std::string msg = vtr::string_fmt(
-                                            "Uni-directional RR node driven by non-configurable "
-                                            "BUFFER has fan in %d (expected 1)\n",
-                                            fan_in);
-                                        msg += "  " + describe_rr_node(to_node);
-                                        VPR_FATAL_ERROR(VPR_ERROR_OTHER, msg.c_str());
-                                    }
-
-                                    //This is a non-configurable buffer, so there are no mux transistors,
-                                    //only the buffer area
-                                    ntrans += device_ctx.rr_switch_inf[switch_index].buf_size;
-                                } else {
-                                    VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Unexpected switch type %d while calculating area of uni-directional routing", switch_type);
-                                }
-                                chan_node_switch_done[to_node] = true;
-                            }
-
-                            break;
-
-                        case IPIN:
-                            num_inputs_to_cblock[to_node]++;
-                            max_inputs_to_cblock = std::max(max_inputs_to_cblock,
-                                                            num_inputs_to_cblock[to_node]);
-                            iseg = seg_index_of_cblock(from_rr_type, to_node);
-
-                            if (cblock_counted[iseg] == false) {
-                                cblock_counted[iseg] = true;
-                                ntrans += trans_track_to_cblock_buf;
-                            }
-                            break;
-
-                        default:
-                            VPR_ERROR(VPR_ERROR_ROUTE,
-                                      "in count_routing_transistors:\n"
-                                      "\tUnexpected connection from node %d (type %d) to node %d (type %d).\n",
-                                      from_node, from_rr_type, to_node, to_rr_type);
-                            break;
-
-                    } /* End switch on to_rr_type. */
-
-                } /* End for each edge. */
-
-                /* Reset some flags */
-                if (from_rr_type == CHANX) {
-                    for (i = device_ctx.rr_nodes[from_node].xlow(); i <= device_ctx.rr_nodes[from_node].xhigh(); i++)
-                        cblock_counted[i] = false;
-
-                } else { /* CHANY */
-                    for (j = device_ctx.rr_nodes[from_node].ylow(); j <= device_ctx.rr_nodes[from_node].yhigh();
-                         j++)
-                        cblock_counted[j] = false;
+                    default:
+                        VPR_ERROR(VPR_ERROR_ROUTE,
+                                  "in count_routing_transistors:\n"
+                                  "\tUnexpected connection from node %d (type %d) to node %d (type %d).\n",
+                                  from_node, from_rr_type, to_node, to_rr_type);
+                        break;
+
+                } /* End switch on to_rr_type. */
+
+            } /* End for each edge. */
+
+            /* Reset some flags */
+            if (from_rr_type == CHANX) {
+                for (int i = device_ctx.rr_nodes[from_node].xlow(); i <= device_ctx.rr_nodes[from_node].xhigh(); i++)
+                    cblock_counted[i] = false;
+
+            } else { /* CHANY */
+                for (int j = device_ctx.rr_nodes[from_node].ylow(); j <= device_ctx.rr_nodes[from_node].yhigh();
+                     j++)
+                    cblock_counted[j] = false;
+            }
+        } /* End for all nodes in chunk */
+
+        return chunk_trans;
+    };
+
+    /* Second sweep: charge each driven CHAN node's mux/driver once, from the
+     * recorded driving edge's switch */
+    auto count_mux_chunk = [&](size_t first_node, size_t last_node) -> double {
+        double chunk_trans = 0.;
+
+        for (size_t to_node = first_node; to_node < last_node; to_node++) {
+            uint64_t driver_edge = chan_driver_edge[to_node].load(std::memory_order_relaxed);
+            if (driver_edge == NO_DRIVER_EDGE) {
+                continue;
+            }
+
+            size_t from_node = driver_edge >> DRIVER_EDGE_BITS;
+            int iedge = int(driver_edge & ((uint64_t(1) << DRIVER_EDGE_BITS) - 1));
+
+            int switch_index = device_ctx.rr_nodes[from_node].edge_switch(iedge);
+            auto switch_type = device_ctx.rr_switch_inf[switch_index].type();
+
+            int fan_in = device_ctx.rr_nodes[to_node].fan_in();
+
+            if (device_ctx.rr_switch_inf[switch_index].type() == SwitchType::MUX) {
+                /* Each wire segment begins with a multipexer followed by a driver for unidirectional */
+                /* Each multiplexer contains all the fan-in to that routing node */
+                /* Add up area of multiplexer */
+                chunk_trans += trans_per_mux(fan_in, trans_sram_bit,
+                                             device_ctx.rr_switch_inf[switch_index].mux_trans_size);
+
+                /* Add up area of buffer */
+                /* The buffer size should already have been auto-sized (if required) when
+                 * the rr switches were created from the arch switches */
+                chunk_trans += device_ctx.rr_switch_inf[switch_index].buf_size;
+            } else if (switch_type == SwitchType::SHORT) {
+                chunk_trans += 0.; //Electrical shorts contribute no transisitor area
+            } else if (switch_type == SwitchType::BUFFER) {
+                if (fan_in != 1) {
+                    std::string msg = vtr::string_fmt(
+                        "Uni-directional RR node driven by non-configurable "
+                        "BUFFER has fan in %d (expected 1)\n",
+                        fan_in);
+                    msg += "  " + describe_rr_node(to_node);
+                    VPR_FATAL_ERROR(VPR_ERROR_OTHER, msg.c_str());
                 }
-                break;
-            case OPIN:
-                break;
 
-            default:
-                break;
+                //This is a non-configurable buffer, so there are no mux transistors,
+                //only the buffer area
+                chunk_trans += device_ctx.rr_switch_inf[switch_index].buf_size;
+            } else {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Unexpected switch type %d while calculating area of uni-directional routing", switch_type);
+            }
+        }
+
+        return chunk_trans;
+    };
 
-        } /* End switch on from_rr_type */
-    }     /* End for all nodes */
+    ntrans = chunked_node_reduction(num_nodes, count_cblock_chunk);
+    ntrans += chunked_node_reduction(num_nodes, count_mux_chunk);
+
+    max_inputs_to_cblock = 0;
+    for (const auto& num_inputs : num_inputs_to_cblock)
+        max_inputs_to_cblock = std::max(max_inputs_to_cblock, num_inputs.load(std::memory_order_relaxed));
 
     /* Now add in the input connection block transistors. */
 
     input_cblock_trans = get_cblock_trans(num_inputs_to_cblock, wire_to_ipin_switch,
                                           max_inputs_to_cblock, trans_sram_bit);
 
-    free(cblock_counted);
-    free(num_inputs_to_cblock);
-    free(chan_node_switch_done);
-
     ntrans += input_cblock_trans;
 
     VTR_LOG("\n");
@@ -475,7 +570,7 @@ void count_unidir_routing_transistors(std::vector<t_segment_inf>& /*segment_inf*
     VTR_LOG("\tTotal routing area: %#g, per logic tile: %#g\n", ntrans, ntrans / (float)(device_ctx.grid.width() * device_ctx.grid.height()));
 }
 
-static float get_cblock_trans(int* num_inputs_to_cblock, int wire_to_ipin_switch, int max_inputs_to_cblock, float trans_sram_bit) {
+static float get_cblock_trans(const std::vector<std::atomic<int>>& num_inputs_to_cblock, int wire_to_ipin_switch, int max_inputs_to_cblock, float trans_sram_bit) {
     /* Computes the transistors in the input connection block multiplexers and   *
      * the buffers from connection block outputs to the logic block input pins.  *
      * For speed, I precompute the number of transistors in the multiplexers of  *
@@ -504,7 +599,7 @@ static float get_cblock_trans(int* num_inputs_to_cblock, int wire_to_ipin_switch
     trans_count = 0.;
 
     for (size_t i = 0; i < device_ctx.rr_nodes.size(); i++) {
-        num_inputs = num_inputs_to_cblock[i];
+        num_inputs = num_inputs_to_cblock[i].load(std::memory_order_relaxed);
         trans_count += trans_per_cblock[num_inputs];
     }
 
@@ -16,10 +16,12 @@
 #include <string.h>
 #include <algorithm>
 #include <ctime>
+#include <fstream>
 #include <sstream>
 #include <utility>
 
 #include "vtr_version.h"
+#include "vtr_digest.h"
 #include "vtr_assert.h"
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -46,7 +48,26 @@
 
 #include "rr_graph_reader.h"
 
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include <memory>
+#    include "capnp/serialize.h"
+#    include "rr_graph.capnp.h"
+#    include "mmap_file.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
 /*********************** Subroutines local to this module *******************/
+static void load_rr_graph_from_capnp(const t_graph_type graph_type,
+                                     const DeviceGrid& grid,
+                                     const std::vector<t_segment_inf>& segment_inf,
+                                     const enum e_base_cost_type base_cost_type,
+                                     int* wire_to_rr_ipin_switch,
+                                     const char* read_rr_graph_name,
+                                     int num_workers);
+
+static void check_rr_graph_cached(const t_graph_type graph_type,
+                                  const DeviceGrid& grid,
+                                  const char* read_rr_graph_name,
+                                  int num_workers);
 void process_switches(pugi::xml_node parent, const pugiutil::loc_data& loc_data);
 void verify_segments(pugi::xml_node parent, const pugiutil::loc_data& loc_data, const std::vector<t_segment_inf>& segment_inf);
 void verify_blocks(pugi::xml_node parent, const pugiutil::loc_data& loc_data);
@@ -69,9 +90,17 @@ void load_rr_file(const t_graph_type graph_type,
                   const std::vector<t_segment_inf>& segment_inf,
                   const enum e_base_cost_type base_cost_type,
                   int* wire_to_rr_ipin_switch,
-                  const char* read_rr_graph_name) {
+                  const char* read_rr_graph_name,
+                  int num_workers) {
     vtr::ScopedStartFinishTimer timer("Loading routing resource graph");
 
+    if (vtr::check_file_name_extension(read_rr_graph_name, ".bin")) {
+        //Binary (Cap'n proto) format
+        load_rr_graph_from_capnp(graph_type, grid, segment_inf, base_cost_type,
+                                 wire_to_rr_ipin_switch, read_rr_graph_name, num_workers);
+        return;
+    }
+
     const char* Prop;
     pugi::xml_node next_component;
 
@@ -81,7 +110,7 @@ void load_rr_file(const t_graph_type graph_type,
     if (vtr::check_file_name_extension(read_rr_graph_name, ".xml") == false) {
         VTR_LOG_WARN(
             "RR graph file '%s' may be in incorrect format. "
-            "Expecting .xml format\n",
+            "Expecting .xml or .bin format\n",
             read_rr_graph_name);
     }
     try {
@@ -143,6 +172,7 @@ void load_rr_file(const t_graph_type graph_type,
         int num_rr_nodes = count_children(next_component, "node", loc_data);
 
         device_ctx.rr_nodes.resize(num_rr_nodes);
+        vtr::hint_large_array(device_ctx.rr_nodes.data(), device_ctx.rr_nodes.size() * sizeof(t_rr_node));
         process_nodes(next_component, loc_data);
 
         /* Loads edges, switches, and node look up tables*/
@@ -176,13 +206,47 @@ void load_rr_file(const t_graph_type graph_type,
         device_ctx.chan_width = nodes_per_chan;
         device_ctx.read_rr_graph_filename = std::string(read_rr_graph_name);
 
-        check_rr_graph(graph_type, grid, device_ctx.physical_tile_types);
+        check_rr_graph_cached(graph_type, grid, read_rr_graph_name, num_workers);
 
     } catch (pugiutil::XmlError& e) {
         vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, e.line(), "%s", e.what());
     }
 }
 
+/* Returns the path of the sidecar file recording the digest of the last
+ * successfully validated copy of the specified RR graph file */
+static std::string rr_graph_validated_digest_filename(const char* read_rr_graph_name) {
+    return std::string(read_rr_graph_name) + ".validated";
+}
+
+/* Runs check_rr_graph() on the loaded graph, unless the graph file's digest
+ * matches one recorded by a previous successful validation (in which case the
+ * graph is known good and the full consistency walk can be skipped). After a
+ * successful check the digest is recorded for future runs; recording is best
+ * effort, since the graph may live in a read-only location */
+static void check_rr_graph_cached(const t_graph_type graph_type,
+                                  const DeviceGrid& grid,
+                                  const char* read_rr_graph_name,
+                                  int num_workers) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    std::string digest = vtr::fast_digest_file(read_rr_graph_name); //Change detection only; no need for a cryptographic hash
+
+    std::ifstream digest_in(rr_graph_validated_digest_filename(read_rr_graph_name));
+    std::string validated_digest;
+    if (digest_in && std::getline(digest_in, validated_digest) && validated_digest == digest) {
+        VTR_LOG("RR graph file matches previously validated digest; skipping consistency check\n");
+        return;
+    }
+
+    check_rr_graph(graph_type, grid, device_ctx.physical_tile_types, num_workers);
+
+    std::ofstream digest_out(rr_graph_validated_digest_filename(read_rr_graph_name));
+    if (digest_out) {
+        digest_out << digest << "\n";
+    }
+}
+
 /* Reads in the switch information and adds it to device_ctx.rr_switch_inf as specified*/
 void process_switches(pugi::xml_node parent, const pugiutil::loc_data& loc_data) {
     auto& device_ctx = g_vpr_ctx.mutable_device();
@@ -699,21 +763,10 @@ void process_rr_node_indices(const DeviceGrid& grid) {
     /* Alloc the lookup table */
     for (t_rr_type rr_type : RR_TYPES) {
         if (rr_type == CHANX) {
-            indices[rr_type].resize(grid.height());
-            for (size_t y = 0; y < grid.height(); ++y) {
-                indices[rr_type][y].resize(grid.width());
-                for (size_t x = 0; x < grid.width(); ++x) {
-                    indices[rr_type][y][x].resize(NUM_SIDES);
-                }
-            }
+            /* CHANX dimensions are transposed to match the chan/seg convention */
+            indices[rr_type] = vtr::NdMatrix<std::vector<int>, 3>({grid.height(), grid.width(), NUM_SIDES});
         } else {
-            indices[rr_type].resize(grid.width());
-            for (size_t x = 0; x < grid.width(); ++x) {
-                indices[rr_type][x].resize(grid.height());
-                for (size_t y = 0; y < grid.height(); ++y) {
-                    indices[rr_type][x][y].resize(NUM_SIDES);
-                }
-            }
+            indices[rr_type] = vtr::NdMatrix<std::vector<int>, 3>({grid.width(), grid.height(), NUM_SIDES});
         }
     }
 
@@ -826,8 +879,9 @@ void process_rr_node_indices(const DeviceGrid& grid) {
                 int root_x = x - width_offset;
                 int root_y = y - height_offset;
 
-                indices[SOURCE][x][y] = indices[SOURCE][root_x][root_y];
-                indices[SINK][x][y] = indices[SINK][root_x][root_y];
+                //SOURCEs/SINKs have no side, so only side 0 is populated
+                indices[SOURCE][x][y][0] = indices[SOURCE][root_x][root_y][0];
+                indices[SINK][x][y][0] = indices[SINK][root_x][root_y][0];
             }
         }
     }
@@ -884,3 +938,243 @@ void set_cost_indices(pugi::xml_node parent, const pugiutil::loc_data& loc_data,
         rr_node = rr_node.next_sibling(rr_node.name());
     }
 }
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disabled because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+static void load_rr_graph_from_capnp(const t_graph_type /*graph_type*/,
+                                     const DeviceGrid& /*grid*/,
+                                     const std::vector<t_segment_inf>& /*segment_inf*/,
+                                     const enum e_base_cost_type /*base_cost_type*/,
+                                     int* /*wire_to_rr_ipin_switch*/,
+                                     const char* /*read_rr_graph_name*/,
+                                     int /*num_workers*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "Binary RR graph loading " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/* Loads a binary (Cap'n proto) rr graph file, as written by
+ * write_rr_graph_capnp. The binary format stores the same graph content as
+ * the XML format (channels, switches, nodes, edges) but trusts the
+ * architecture for the grid/block type/segment sections, so it must only be
+ * loaded against the architecture it was generated from. */
+static void load_rr_graph_from_capnp(const t_graph_type graph_type,
+                                     const DeviceGrid& grid,
+                                     const std::vector<t_segment_inf>& segment_inf,
+                                     const enum e_base_cost_type base_cost_type,
+                                     int* wire_to_rr_ipin_switch,
+                                     const char* read_rr_graph_name,
+                                     int num_workers) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    //The mapping must outlive the RR graph: the nodes' edge storage points
+    //directly into it (zero-copy), so concurrent VPR processes loading the
+    //same file share the edge pages read-only. It is released (and replaced)
+    //only when another binary rr graph is loaded.
+    static std::unique_ptr<MmapFile> f;
+    f.reset(); //Unmap any previously loaded rr graph first
+    f = std::make_unique<MmapFile>(read_rr_graph_name);
+
+    //RR graphs for large devices easily exceed the default 64MiB traversal
+    //limit, so raise it (the file comes from a trusted producer: us)
+    ::capnp::ReaderOptions opts;
+    opts.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
+    ::capnp::FlatArrayMessageReader reader(f->getData(), opts);
+    auto rr_graph = reader.getRoot<VprRrGraph>();
+
+    if (rr_graph.getEdgeRecordSize() != t_rr_node::edge_record_bytes()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "RR graph file '%s' has %zu byte edge records but this build uses %zu byte records; regenerate the file with --write_rr_graph\n",
+                        read_rr_graph_name, (size_t)rr_graph.getEdgeRecordSize(), t_rr_node::edge_record_bytes());
+    }
+
+    std::string correct_string = "Generated from arch file ";
+    correct_string += get_arch_file_name();
+    if (rr_graph.hasToolComment() && correct_string != rr_graph.getToolComment().cStr()) {
+        VTR_LOG("\n");
+        VTR_LOG_WARN("This RR graph file is based on %s while your input architecture file is %s compatability issues may arise\n",
+                     get_arch_file_name(), rr_graph.getToolComment().cStr());
+        VTR_LOG("\n");
+    }
+
+    VTR_LOG("Starting build routing resource graph...\n");
+
+    /* Channel widths */
+    t_chan_width nodes_per_chan;
+    nodes_per_chan.max = rr_graph.getChanWidthMax();
+    nodes_per_chan.x_min = rr_graph.getChanWidthXMin();
+    nodes_per_chan.y_min = rr_graph.getChanWidthYMin();
+    nodes_per_chan.x_max = rr_graph.getChanWidthXMax();
+    nodes_per_chan.y_max = rr_graph.getChanWidthYMax();
+
+    auto x_list = rr_graph.getChanWidthXList();
+    auto y_list = rr_graph.getChanWidthYList();
+    nodes_per_chan.x_list.resize(grid.height());
+    nodes_per_chan.y_list.resize(grid.width());
+    for (size_t i = 0; i < x_list.size() && i < nodes_per_chan.x_list.size(); ++i) {
+        nodes_per_chan.x_list[i] = x_list[i];
+    }
+    for (size_t i = 0; i < y_list.size() && i < nodes_per_chan.y_list.size(); ++i) {
+        nodes_per_chan.y_list[i] = y_list[i];
+    }
+
+    bool is_global_graph = (GRAPH_GLOBAL == graph_type ? true : false);
+    int max_chan_width = (is_global_graph ? 1 : nodes_per_chan.max);
+    VTR_ASSERT(max_chan_width > 0);
+
+    /* Switches */
+    auto switches = rr_graph.getSwitches();
+    int num_rr_switches = switches.size();
+    device_ctx.rr_switch_inf.resize(num_rr_switches);
+    for (int iswitch = 0; iswitch < num_rr_switches; ++iswitch) {
+        auto in = switches[iswitch];
+        auto& rr_switch = device_ctx.rr_switch_inf[iswitch];
+
+        const char* name = nullptr;
+        if (in.hasName() && in.getName().size() > 0) {
+            bool found_arch_name = false;
+            for (int i = 0; i < device_ctx.num_arch_switches; ++i) {
+                if (strcmp(in.getName().cStr(), device_ctx.arch_switch_inf[i].name) == 0) {
+                    name = device_ctx.arch_switch_inf[i].name;
+                    found_arch_name = true;
+                    break;
+                }
+            }
+            if (!found_arch_name) {
+                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Switch name '%s' not found in architecture\n", in.getName().cStr());
+            }
+        }
+        rr_switch.name = name;
+
+        rr_switch.set_type((SwitchType)in.getType());
+        rr_switch.R = in.getR();
+        rr_switch.Cin = in.getCin();
+        rr_switch.Cout = in.getCout();
+        rr_switch.Cinternal = in.getCinternal();
+        rr_switch.Tdel = in.getTdel();
+        rr_switch.mux_trans_size = in.getMuxTransSize();
+        rr_switch.buf_size = in.getBufSize();
+    }
+
+    /* Nodes. The edge records are used in place from the mapped file (they
+     * were written pre-partitioned), so each node is simply pointed at its
+     * slice of the flat edge blob. */
+    auto flat_edges = rr_graph.getFlatEdges();
+    size_t total_edges = flat_edges.size() / t_rr_node::edge_record_bytes();
+    t_rr_node::set_external_edge_storage(flat_edges.begin());
+
+    auto nodes = rr_graph.getNodes();
+    device_ctx.rr_nodes.resize(nodes.size());
+    vtr::hint_large_array(device_ctx.rr_nodes.data(), device_ctx.rr_nodes.size() * sizeof(t_rr_node));
+    std::vector<int> seg_id_per_node(nodes.size(), -1);
+    for (size_t inode = 0; inode < nodes.size(); ++inode) {
+        auto in = nodes[inode];
+        auto& node = device_ctx.rr_nodes[inode];
+
+        node.set_type((t_rr_type)in.getType());
+        if (node.type() == CHANX || node.type() == CHANY) {
+            node.set_direction((e_direction)in.getDirection());
+        }
+        node.set_capacity(in.getCapacity());
+        node.set_coordinates(in.getXlow(), in.getYlow(), in.getXhigh(), in.getYhigh());
+        if (node.type() == IPIN || node.type() == OPIN) {
+            node.set_side((e_side)in.getSide());
+        }
+        node.set_ptc_num(in.getPtc());
+        node.set_rc_index(find_create_rr_rc_data(in.getR(), in.getC()));
+
+        if (in.getEdgeBegin() + in.getNumEdges() > total_edges) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "node %zu edge range [%zu, %zu) is larger than the edge count %zu",
+                            inode, (size_t)in.getEdgeBegin(), (size_t)(in.getEdgeBegin() + in.getNumEdges()), total_edges);
+        }
+        node.set_external_edges(in.getEdgeBegin(), in.getNumEdges(), in.getNumNonConfigEdges());
+
+        seg_id_per_node[inode] = in.getSegId();
+    }
+
+    /* Edges are already in place (and pre-partitioned, so no
+     * partition_rr_graph_edges() pass is needed); validate them and count the
+     * wire to IPIN switch (mirrors process_edges) */
+    std::vector<int> count_for_wire_to_ipin_switches(num_rr_switches, 0);
+    std::pair<int, int> most_frequent_switch(-1, 0);
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        auto& node = device_ctx.rr_nodes[inode];
+        for (t_edge_size iedge = 0; iedge < node.num_edges(); ++iedge) {
+            size_t sink_node = node.edge_sink_node(iedge);
+            int switch_id = node.edge_switch(iedge);
+
+            if (sink_node >= device_ctx.rr_nodes.size()) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                                "sink_node %zu is larger than rr_nodes.size() %zu",
+                                sink_node, device_ctx.rr_nodes.size());
+            }
+            if (switch_id >= num_rr_switches) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                                "switch_id %d is larger than num_rr_switches %d",
+                                switch_id, num_rr_switches);
+            }
+
+            if (node.type() == CHANX || node.type() == CHANY) {
+                if (device_ctx.rr_nodes[sink_node].type() == IPIN) {
+                    count_for_wire_to_ipin_switches[switch_id]++;
+                    if (count_for_wire_to_ipin_switches[switch_id] > most_frequent_switch.second) {
+                        most_frequent_switch.first = switch_id;
+                        most_frequent_switch.second = count_for_wire_to_ipin_switches[switch_id];
+                    }
+                }
+            }
+        }
+    }
+    *wire_to_rr_ipin_switch = most_frequent_switch.first;
+
+    process_rr_node_indices(grid);
+
+    init_fan_in(device_ctx.rr_nodes, device_ctx.rr_nodes.size());
+
+    /* Set the cost indices (mirrors set_cost_indices) */
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        auto& node = device_ctx.rr_nodes[inode];
+        if (node.type() == SOURCE) {
+            node.set_cost_index(SOURCE_COST_INDEX);
+        } else if (node.type() == SINK) {
+            node.set_cost_index(SINK_COST_INDEX);
+        } else if (node.type() == IPIN) {
+            node.set_cost_index(IPIN_COST_INDEX);
+        } else if (node.type() == OPIN) {
+            node.set_cost_index(OPIN_COST_INDEX);
+        } else if (seg_id_per_node[inode] != -1) {
+            int seg_id = seg_id_per_node[inode];
+            if (is_global_graph) {
+                node.set_cost_index(0);
+            } else if (node.type() == CHANX) {
+                node.set_cost_index(CHANX_COST_INDEX_START + seg_id);
+            } else if (node.type() == CHANY) {
+                node.set_cost_index(CHANX_COST_INDEX_START + segment_inf.size() + seg_id);
+            }
+        }
+    }
+
+    alloc_and_load_rr_indexed_data(segment_inf, device_ctx.rr_node_indices,
+                                   max_chan_width, *wire_to_rr_ipin_switch, base_cost_type);
+
+    /* Set the segment index of each node's indexed data (mirrors process_seg_id) */
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        auto& node = device_ctx.rr_nodes[inode];
+        device_ctx.rr_indexed_data[node.cost_index()].seg_index = seg_id_per_node[inode];
+    }
+
+    device_ctx.chan_width = nodes_per_chan;
+    device_ctx.read_rr_graph_filename = std::string(read_rr_graph_name);
+
+    check_rr_graph_cached(graph_type, grid, read_rr_graph_name, num_workers);
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
@@ -1,4 +1,7 @@
 #include <cstdio>
+#include <exception>
+#include <thread>
+#include <vector>
 
 #include "vtr_memory.h"
 
@@ -11,9 +14,14 @@
 #include "rr_graph2.h"
 #include "rr_graph_timing_params.h"
 
+/* Minimum number of RR nodes to justify spawning an additional worker thread
+ * when loading switch capacitances (the per-node work is cheap, so threading
+ * only pays off for large graphs) */
+constexpr size_t MIN_NODES_PER_C_LOAD_WORKER = 65536;
+
 /****************** Subroutine definitions *********************************/
 
-void add_rr_graph_C_from_switches(float C_ipin_cblock) {
+void add_rr_graph_C_from_switches(float C_ipin_cblock, int num_workers) {
     /* This routine finishes loading the C elements of the rr_graph. It assumes *
      * that when you call it the CHANX and CHANY nodes have had their C set to  *
      * their metal capacitance, and everything else has C set to 0.  The graph  *
@@ -27,173 +35,223 @@ void add_rr_graph_C_from_switches(float C_ipin_cblock) {
      *    separating tracks from the input connection block, if enabled by      *
      *    INCLUDE_TRACK_BUFFERS)                                    	    */
 
-    int switch_index, maxlen;
-    size_t to_node;
-    int icblock, isblock, iseg_low, iseg_high;
-    float Cin, Cout;
-    t_rr_type from_rr_type, to_rr_type;
-    bool* cblock_counted; /* [0..maxlen-1] -- 0th element unused. */
-    float* buffer_Cin;    /* [0..maxlen-1] */
-    bool buffered;
-    float* Couts_to_add; /* UDSD */
-
     auto& device_ctx = g_vpr_ctx.device();
     auto& mutable_device_ctx = g_vpr_ctx.mutable_device();
 
-    maxlen = std::max(device_ctx.grid.width(), device_ctx.grid.height());
-    cblock_counted = (bool*)vtr::calloc(maxlen, sizeof(bool));
-    buffer_Cin = (float*)vtr::calloc(maxlen, sizeof(float));
+    size_t maxlen = std::max(device_ctx.grid.width(), device_ctx.grid.height());
+    size_t num_nodes = device_ctx.rr_nodes.size();
 
-    std::vector<float> rr_node_C(device_ctx.rr_nodes.size(), 0.); //Stores the final C
+    std::vector<float> rr_node_C(num_nodes, 0.);     //Stores the final C
+    std::vector<float> Couts_to_add(num_nodes, 0.f); /* UDSD */
 
-    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
-        //The C may have already been partly initialized (e.g. with metal capacitance)
-        rr_node_C[inode] += device_ctx.rr_nodes[inode].C();
+    /* The capacitance loading is a pure function of the (already loaded) graph
+     * connectivity, so it can be computed over disjoint source node ranges in
+     * parallel. Each worker accumulates into its own node_C/node_Couts arrays
+     * (a source node's edges may load C onto its sink nodes, which can fall in
+     * another worker's range); the per-worker arrays are combined below.
+     */
+    auto load_rr_C_range = [&](size_t node_begin, size_t node_end, std::vector<float>& node_C, std::vector<float>& node_Couts) {
+        int switch_index;
+        size_t to_node;
+        int icblock, isblock, iseg_low, iseg_high;
+        float Cin, Cout;
+        t_rr_type from_rr_type, to_rr_type;
+        bool buffered;
 
-        from_rr_type = device_ctx.rr_nodes[inode].type();
+        /* Per-worker scratch, reset after each CHANX/CHANY node */
+        std::vector<bool> cblock_counted(maxlen, false); /* [0..maxlen-1] -- 0th element unused. */
+        std::vector<float> buffer_Cin(maxlen, 0.f);      /* [0..maxlen-1] */
 
-        if (from_rr_type == CHANX || from_rr_type == CHANY) {
-            for (t_edge_size iedge = 0; iedge < device_ctx.rr_nodes[inode].num_edges(); iedge++) {
-                to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
-                to_rr_type = device_ctx.rr_nodes[to_node].type();
+        for (size_t inode = node_begin; inode < node_end; inode++) {
+            //The C may have already been partly initialized (e.g. with metal capacitance)
+            node_C[inode] += device_ctx.rr_nodes[inode].C();
 
-                if (to_rr_type == CHANX || to_rr_type == CHANY) {
-                    switch_index = device_ctx.rr_nodes[inode].edge_switch(iedge);
-                    Cin = device_ctx.rr_switch_inf[switch_index].Cin;
-                    Cout = device_ctx.rr_switch_inf[switch_index].Cout;
-                    buffered = device_ctx.rr_switch_inf[switch_index].buffered();
-
-                    /* If both the switch from inode to to_node and the switch from *
-                     * to_node back to inode use bidirectional switches (i.e. pass  *
-                     * transistors), there will only be one physical switch for     *
-                     * both edges.  Hence, I only want to count the capacitance of  *
-                     * that switch for one of the two edges.  (Note:  if there is   *
-                     * a pass transistor edge from x to y, I always build the graph *
-                     * so that there is a corresponding edge using the same switch  *
-                     * type from y to x.) So, I arbitrarily choose to add in the    *
-                     * capacitance in that case of a pass transistor only when      *
-                     * processing the lower inode number.                           *
-                     * If an edge uses a buffer I always have to add in the output  *
-                     * capacitance.  I assume that buffers are shared at the same   *
-                     * (i,j) location, so only one input capacitance needs to be    *
-                     * added for all the buffered switches at that location.  If    *
-                     * the buffers at that location have different sizes, I use the *
-                     * input capacitance of the largest one.                        */
-
-                    if (!buffered && inode < to_node) { /* Pass transistor. */
-                        rr_node_C[inode] += Cin;
-                        rr_node_C[to_node] += Cout;
-                    }
+            from_rr_type = device_ctx.rr_nodes[inode].type();
+
+            if (from_rr_type == CHANX || from_rr_type == CHANY) {
+                for (t_edge_size iedge = 0; iedge < device_ctx.rr_nodes[inode].num_edges(); iedge++) {
+                    to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
+                    to_rr_type = device_ctx.rr_nodes[to_node].type();
+
+                    if (to_rr_type == CHANX || to_rr_type == CHANY) {
+                        switch_index = device_ctx.rr_nodes[inode].edge_switch(iedge);
+                        Cin = device_ctx.rr_switch_inf[switch_index].Cin;
+                        Cout = device_ctx.rr_switch_inf[switch_index].Cout;
+                        buffered = device_ctx.rr_switch_inf[switch_index].buffered();
+
+                        /* If both the switch from inode to to_node and the switch from *
+                         * to_node back to inode use bidirectional switches (i.e. pass  *
+                         * transistors), there will only be one physical switch for     *
+                         * both edges.  Hence, I only want to count the capacitance of  *
+                         * that switch for one of the two edges.  (Note:  if there is   *
+                         * a pass transistor edge from x to y, I always build the graph *
+                         * so that there is a corresponding edge using the same switch  *
+                         * type from y to x.) So, I arbitrarily choose to add in the    *
+                         * capacitance in that case of a pass transistor only when      *
+                         * processing the lower inode number.                           *
+                         * If an edge uses a buffer I always have to add in the output  *
+                         * capacitance.  I assume that buffers are shared at the same   *
+                         * (i,j) location, so only one input capacitance needs to be    *
+                         * added for all the buffered switches at that location.  If    *
+                         * the buffers at that location have different sizes, I use the *
+                         * input capacitance of the largest one.                        */
 
-                    else if (buffered) {
-                        /* Prevent double counting of capacitance for UDSD */
-                        if (device_ctx.rr_nodes[to_node].direction() == BI_DIRECTION) {
-                            /* For multiple-driver architectures the output capacitance can
-                             * be added now since each edge is actually a driver */
-                            rr_node_C[to_node] += Cout;
+                        if (!buffered && inode < to_node) { /* Pass transistor. */
+                            node_C[inode] += Cin;
+                            node_C[to_node] += Cout;
                         }
-                        isblock = seg_index_of_sblock(inode, to_node);
-                        buffer_Cin[isblock] = std::max(buffer_Cin[isblock], Cin);
-                    }
 
-                }
-                /* End edge to CHANX or CHANY node. */
-                else if (to_rr_type == IPIN) {
-                    if (INCLUDE_TRACK_BUFFERS) {
-                        /* Implements sharing of the track to connection box buffer.
-                         * Such a buffer exists at every segment of the wire at which
-                         * at least one logic block input connects. */
-                        icblock = seg_index_of_cblock(from_rr_type, to_node);
-                        if (cblock_counted[icblock] == false) {
-                            rr_node_C[inode] += C_ipin_cblock;
-                            cblock_counted[icblock] = true;
+                        else if (buffered) {
+                            /* Prevent double counting of capacitance for UDSD */
+                            if (device_ctx.rr_nodes[to_node].direction() == BI_DIRECTION) {
+                                /* For multiple-driver architectures the output capacitance can
+                                 * be added now since each edge is actually a driver */
+                                node_C[to_node] += Cout;
+                            }
+                            isblock = seg_index_of_sblock(inode, to_node);
+                            buffer_Cin[isblock] = std::max(buffer_Cin[isblock], Cin);
+                        }
+
+                    }
+                    /* End edge to CHANX or CHANY node. */
+                    else if (to_rr_type == IPIN) {
+                        if (INCLUDE_TRACK_BUFFERS) {
+                            /* Implements sharing of the track to connection box buffer.
+                             * Such a buffer exists at every segment of the wire at which
+                             * at least one logic block input connects. */
+                            icblock = seg_index_of_cblock(from_rr_type, to_node);
+                            if (cblock_counted[icblock] == false) {
+                                node_C[inode] += C_ipin_cblock;
+                                cblock_counted[icblock] = true;
+                            }
+                        } else {
+                            /* No track buffer. Simply add the capacitance onto the wire */
+                            node_C[inode] += C_ipin_cblock;
                         }
-                    } else {
-                        /* No track buffer. Simply add the capacitance onto the wire */
-                        rr_node_C[inode] += C_ipin_cblock;
                     }
+                } /* End loop over all edges of a node. */
+
+                /* Reset the cblock_counted and buffer_Cin arrays, and add buf Cin. */
+
+                /* Method below would be faster for very unpopulated segments, but I  *
+                 * think it would be slower overall for most FPGAs, so commented out. */
+
+                /*   for (iedge=0;iedge<device_ctx.rr_nodes[inode].num_edges();iedge++) {
+                 * to_node = device_ctx.rr_nodes[inode].edges[iedge];
+                 * if (device_ctx.rr_nodes[to_node].type() == IPIN) {
+                 * icblock = seg_index_of_cblock (from_rr_type, to_node);
+                 * cblock_counted[icblock] = false;
+                 * }
+                 * }     */
+
+                if (from_rr_type == CHANX) {
+                    iseg_low = device_ctx.rr_nodes[inode].xlow();
+                    iseg_high = device_ctx.rr_nodes[inode].xhigh();
+                } else { /* CHANY */
+                    iseg_low = device_ctx.rr_nodes[inode].ylow();
+                    iseg_high = device_ctx.rr_nodes[inode].yhigh();
+                }
+
+                for (icblock = iseg_low; icblock <= iseg_high; icblock++) {
+                    cblock_counted[icblock] = false;
+                }
+
+                for (isblock = iseg_low - 1; isblock <= iseg_high; isblock++) {
+                    node_C[inode] += buffer_Cin[isblock]; /* Biggest buf Cin at loc */
+                    buffer_Cin[isblock] = 0.;
                 }
-            } /* End loop over all edges of a node. */
-
-            /* Reset the cblock_counted and buffer_Cin arrays, and add buf Cin. */
-
-            /* Method below would be faster for very unpopulated segments, but I  *
-             * think it would be slower overall for most FPGAs, so commented out. */
-
-            /*   for (iedge=0;iedge<device_ctx.rr_nodes[inode].num_edges();iedge++) {
-             * to_node = device_ctx.rr_nodes[inode].edges[iedge];
-             * if (device_ctx.rr_nodes[to_node].type() == IPIN) {
-             * icblock = seg_index_of_cblock (from_rr_type, to_node);
-             * cblock_counted[icblock] = false;
-             * }
-             * }     */
-
-            if (from_rr_type == CHANX) {
-                iseg_low = device_ctx.rr_nodes[inode].xlow();
-                iseg_high = device_ctx.rr_nodes[inode].xhigh();
-            } else { /* CHANY */
-                iseg_low = device_ctx.rr_nodes[inode].ylow();
-                iseg_high = device_ctx.rr_nodes[inode].yhigh();
-            }
 
-            for (icblock = iseg_low; icblock <= iseg_high; icblock++) {
-                cblock_counted[icblock] = false;
             }
+            /* End node is CHANX or CHANY */
+            else if (from_rr_type == OPIN) {
+                for (t_edge_size iedge = 0; iedge < device_ctx.rr_nodes[inode].num_edges(); iedge++) {
+                    switch_index = device_ctx.rr_nodes[inode].edge_switch(iedge);
+                    to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
+                    to_rr_type = device_ctx.rr_nodes[to_node].type();
+
+                    if (to_rr_type != CHANX && to_rr_type != CHANY)
+                        continue;
 
-            for (isblock = iseg_low - 1; isblock <= iseg_high; isblock++) {
-                rr_node_C[inode] += buffer_Cin[isblock]; /* Biggest buf Cin at loc */
-                buffer_Cin[isblock] = 0.;
+                    if (device_ctx.rr_nodes[to_node].direction() == BI_DIRECTION) {
+                        Cout = device_ctx.rr_switch_inf[switch_index].Cout;
+                        to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge); /* Will be CHANX or CHANY */
+                        node_C[to_node] += Cout;
+                    }
+                }
             }
+            /* End node is OPIN. */
+        } /* End for all nodes. */
 
-        }
-        /* End node is CHANX or CHANY */
-        else if (from_rr_type == OPIN) {
+        /* Now we need to add any Cout loads for nets that we previously didn't process
+         * Current structures only keep switch information from a node to the next node and
+         * not the reverse.  Therefore I need to go through all the possible edges to figure
+         * out what the Cout's should be */
+        for (size_t inode = node_begin; inode < node_end; inode++) {
             for (t_edge_size iedge = 0; iedge < device_ctx.rr_nodes[inode].num_edges(); iedge++) {
                 switch_index = device_ctx.rr_nodes[inode].edge_switch(iedge);
                 to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
                 to_rr_type = device_ctx.rr_nodes[to_node].type();
+                if (to_rr_type == CHANX || to_rr_type == CHANY) {
+                    if (device_ctx.rr_nodes[to_node].direction() != BI_DIRECTION) {
+                        /* Cout was not added in these cases */
+                        node_Couts[to_node] = std::max(node_Couts[to_node], device_ctx.rr_switch_inf[switch_index].Cout);
+                    }
+                }
+            }
+        }
+    };
+
+    size_t num_c_workers = std::min<size_t>(std::max(num_workers, 1),
+                                            std::max<size_t>(1, num_nodes / MIN_NODES_PER_C_LOAD_WORKER));
 
-                if (to_rr_type != CHANX && to_rr_type != CHANY)
-                    continue;
+    if (num_c_workers <= 1) {
+        load_rr_C_range(0, num_nodes, rr_node_C, Couts_to_add);
+    } else {
+        std::vector<std::vector<float>> worker_node_C(num_c_workers, std::vector<float>(num_nodes, 0.f));
+        std::vector<std::vector<float>> worker_Couts(num_c_workers, std::vector<float>(num_nodes, 0.f));
+        std::vector<std::exception_ptr> worker_errors(num_c_workers);
+        std::vector<std::thread> workers;
 
-                if (device_ctx.rr_nodes[to_node].direction() == BI_DIRECTION) {
-                    Cout = device_ctx.rr_switch_inf[switch_index].Cout;
-                    to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge); /* Will be CHANX or CHANY */
-                    rr_node_C[to_node] += Cout;
+        size_t nodes_per_worker = (num_nodes + num_c_workers - 1) / num_c_workers;
+        for (size_t iworker = 0; iworker < num_c_workers; ++iworker) {
+            workers.emplace_back([&, iworker]() {
+                try {
+                    size_t node_begin = iworker * nodes_per_worker;
+                    size_t node_end = std::min(node_begin + nodes_per_worker, num_nodes);
+                    load_rr_C_range(node_begin, node_end, worker_node_C[iworker], worker_Couts[iworker]);
+                } catch (...) {
+                    worker_errors[iworker] = std::current_exception();
                 }
+            });
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        for (const auto& error : worker_errors) {
+            if (error) {
+                std::rethrow_exception(error);
             }
         }
-        /* End node is OPIN. */
-    } /* End for all nodes. */
-
-    /* Now we need to add any Cout loads for nets that we previously didn't process
-     * Current structures only keep switch information from a node to the next node and
-     * not the reverse.  Therefore I need to go through all the possible edges to figure
-     * out what the Cout's should be */
-    Couts_to_add = (float*)vtr::calloc(device_ctx.rr_nodes.size(), sizeof(float));
-    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
-        for (t_edge_size iedge = 0; iedge < device_ctx.rr_nodes[inode].num_edges(); iedge++) {
-            switch_index = device_ctx.rr_nodes[inode].edge_switch(iedge);
-            to_node = device_ctx.rr_nodes[inode].edge_sink_node(iedge);
-            to_rr_type = device_ctx.rr_nodes[to_node].type();
-            if (to_rr_type == CHANX || to_rr_type == CHANY) {
-                if (device_ctx.rr_nodes[to_node].direction() != BI_DIRECTION) {
-                    /* Cout was not added in these cases */
-                    Couts_to_add[to_node] = std::max(Couts_to_add[to_node], device_ctx.rr_switch_inf[switch_index].Cout);
-                }
+
+        /* Combine the per-worker contributions: capacitances accumulate, while
+         * the deferred Couts are resolved by taking the largest driver */
+        for (size_t iworker = 0; iworker < num_c_workers; ++iworker) {
+            for (size_t inode = 0; inode < num_nodes; inode++) {
+                rr_node_C[inode] += worker_node_C[iworker][inode];
+                Couts_to_add[inode] = std::max(Couts_to_add[inode], worker_Couts[iworker][inode]);
             }
         }
     }
-    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+
+    for (size_t inode = 0; inode < num_nodes; inode++) {
         rr_node_C[inode] += Couts_to_add[inode];
     }
 
     //Create the final flywieghted t_rr_rc_data
-    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+    //Note this is serial: the rc data flyweight storage is shared
+    for (size_t inode = 0; inode < num_nodes; inode++) {
         mutable_device_ctx.rr_nodes[inode].set_rc_index(find_create_rr_rc_data(device_ctx.rr_nodes[inode].R(), rr_node_C[inode]));
     }
-
-    free(Couts_to_add);
-    free(cblock_counted);
-    free(buffer_Cin);
 }
@@ -1 +1 @@
-void add_rr_graph_C_from_switches(float C_ipin_cblock);
+void add_rr_graph_C_from_switches(float C_ipin_cblock, int num_workers = 1);
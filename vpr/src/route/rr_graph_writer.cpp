@@ -5,46 +5,167 @@
  * children tags such as timing, location, or some general
  * details. Each tag has attributes to describe them */
 
-#include <fstream>
+#include <cstdio>
 #include <iostream>
 #include <string.h>
-#include <iomanip>
+#include <string>
+#include <type_traits>
 #include <limits>
 #include "vpr_error.h"
 #include "globals.h"
 #include "read_xml_arch_file.h"
+#include "vtr_log.h"
+#include "vtr_util.h"
 #include "vtr_version.h"
 #include "rr_graph_writer.h"
 
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "rr_graph.capnp.h"
+#    include "serdes_utils.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
 /* All values are printed with this precision value. The higher the
  * value, the more accurate the read in rr graph is. Using numeric_limits
  * max_digits10 guarentees that no values change during a sequence of
  * float -> string -> float conversions */
 constexpr int FLOAT_PRECISION = std::numeric_limits<float>::max_digits10;
+
+/* Size of the user-space output buffer; the buffer is flushed to the file
+ * whenever it grows beyond this */
+constexpr size_t WRITER_BUFFER_SIZE = 1 << 20; //1 MiB
+
+/* Accumulates output in a large user-space buffer and flushes it to the
+ * underlying file in WRITER_BUFFER_SIZE chunks.
+ *
+ * The XML RR graph of a large device consists of hundreds of millions of
+ * small tokens; emitting each one as its own formatted stream write produces
+ * pathological small-write I/O patterns (particularly painful on network
+ * filesystems). Values are formatted directly into the buffer (integers with
+ * a simple digit loop, floats at FLOAT_PRECISION matching the reader), so
+ * the file only ever sees large sequential writes. */
+class BufferedFileWriter {
+  public:
+    explicit BufferedFileWriter(const char* file_name)
+        : fp_(std::fopen(file_name, "w")) {
+        buf_.reserve(WRITER_BUFFER_SIZE);
+    }
+
+    ~BufferedFileWriter() {
+        close();
+    }
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    bool is_open() const { return fp_ != nullptr; }
+    bool good() const { return !error_; }
+
+    void close() {
+        if (fp_) {
+            flush();
+            std::fclose(fp_);
+            fp_ = nullptr;
+        }
+    }
+
+    BufferedFileWriter& operator<<(const char* str) {
+        buf_.append(str);
+        flush_if_full();
+        return *this;
+    }
+
+    BufferedFileWriter& operator<<(const std::string& str) {
+        buf_.append(str);
+        flush_if_full();
+        return *this;
+    }
+
+    template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    BufferedFileWriter& operator<<(T val) {
+        char digits[24]; //Large enough for a 64-bit value and sign
+        char* end = digits + sizeof(digits);
+        char* pos = end;
+
+        bool is_negative = (val < T(0));
+        unsigned long long magnitude = is_negative ? -static_cast<unsigned long long>(val)
+                                                   : static_cast<unsigned long long>(val);
+        do {
+            *--pos = '0' + (magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (is_negative) {
+            *--pos = '-';
+        }
+
+        buf_.append(pos, end - pos);
+        flush_if_full();
+        return *this;
+    }
+
+    BufferedFileWriter& operator<<(float val) {
+        return *this << static_cast<double>(val);
+    }
+
+    BufferedFileWriter& operator<<(double val) {
+        char float_str[64];
+        int len = std::snprintf(float_str, sizeof(float_str), "%.*g", FLOAT_PRECISION, val);
+        buf_.append(float_str, len);
+        flush_if_full();
+        return *this;
+    }
+
+  private:
+    void flush_if_full() {
+        if (buf_.size() >= WRITER_BUFFER_SIZE) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (!buf_.empty()) {
+            if (std::fwrite(buf_.data(), 1, buf_.size(), fp_) != buf_.size()) {
+                error_ = true;
+            }
+            buf_.clear();
+        }
+    }
+
+    FILE* fp_ = nullptr;
+    bool error_ = false;
+    std::string buf_;
+};
+
 /*********************** Subroutines local to this module *******************/
-void write_rr_channel(std::fstream& fp);
-void write_rr_node(std::fstream& fp);
-void write_rr_switches(std::fstream& fp);
-void write_rr_grid(std::fstream& fp);
-void write_rr_edges(std::fstream& fp);
-void write_rr_block_types(std::fstream& fp);
-void write_rr_segments(std::fstream& fp, const std::vector<t_segment_inf>& segment_inf);
+void write_rr_channel(BufferedFileWriter& fp);
+void write_rr_node(BufferedFileWriter& fp);
+void write_rr_switches(BufferedFileWriter& fp);
+void write_rr_grid(BufferedFileWriter& fp);
+void write_rr_edges(BufferedFileWriter& fp);
+void write_rr_block_types(BufferedFileWriter& fp);
+void write_rr_segments(BufferedFileWriter& fp, const std::vector<t_segment_inf>& segment_inf);
+static void write_rr_graph_capnp(const char* file_name);
 
 /************************ Subroutine definitions ****************************/
 
 /* This function is used to write the rr_graph into xml format into a a file with name: file_name */
 void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& segment_inf) {
-    std::fstream fp;
-    fp.open(file_name, std::fstream::out | std::fstream::trunc);
+    if (vtr::check_file_name_extension(file_name, ".bin")) {
+        //Binary (Cap'n proto) format
+        write_rr_graph_capnp(file_name);
+        return;
+    }
+
+    BufferedFileWriter fp(file_name);
 
     /* Prints out general info for easy error checking*/
-    if (!fp.is_open() || !fp.good()) {
+    if (!fp.is_open()) {
         VPR_FATAL_ERROR(VPR_ERROR_OTHER,
                         "couldn't open file \"%s\" for generating RR graph file\n", file_name);
     }
     std::cout << "Writing RR graph" << std::endl;
     fp << "<rr_graph tool_name=\"vpr\" tool_version=\"" << vtr::VERSION << "\" tool_comment=\"Generated from arch file "
-       << get_arch_file_name() << "\">" << std::endl;
+       << get_arch_file_name() << "\">" << "\n";
 
     /* Write out each individual component*/
     write_rr_channel(fp);
@@ -58,49 +179,54 @@ void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& seg
 
     fp.close();
 
+    if (!fp.good()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "error writing RR graph file \"%s\"\n", file_name);
+    }
+
     std::cout << "Finished generating RR graph file named " << file_name << std::endl
               << std::endl;
 }
 
-static void add_metadata_to_xml(std::fstream& fp, const char* tab_prefix, const t_metadata_dict& meta) {
-    fp << tab_prefix << "<metadata>" << std::endl;
+static void add_metadata_to_xml(BufferedFileWriter& fp, const char* tab_prefix, const t_metadata_dict& meta) {
+    fp << tab_prefix << "<metadata>" << "\n";
 
     for (const auto& meta_elem : meta) {
         const std::string& key = meta_elem.first;
         const std::vector<t_metadata_value>& values = meta_elem.second;
         for (const auto& value : values) {
             fp << tab_prefix << "\t<meta name=\"" << key << "\"";
-            fp << ">" << value.as_string() << "</meta>" << std::endl;
+            fp << ">" << value.as_string() << "</meta>" << "\n";
         }
     }
-    fp << tab_prefix << "</metadata>" << std::endl;
+    fp << tab_prefix << "</metadata>" << "\n";
 }
 
 /* Channel info in device_ctx.chan_width is written in xml format.
  * A general summary of the min and max values of the channels are first printed. Every
  * x and y channel list is printed out in its own attribute*/
-void write_rr_channel(std::fstream& fp) {
+void write_rr_channel(BufferedFileWriter& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<channels>" << std::endl;
-    fp << "\t\t<channel chan_width_max =\"" << device_ctx.chan_width.max << "\" x_min=\"" << device_ctx.chan_width.x_min << "\" y_min=\"" << device_ctx.chan_width.y_min << "\" x_max=\"" << device_ctx.chan_width.x_max << "\" y_max=\"" << device_ctx.chan_width.y_max << "\"/>" << std::endl;
+    fp << "\t<channels>" << "\n";
+    fp << "\t\t<channel chan_width_max =\"" << device_ctx.chan_width.max << "\" x_min=\"" << device_ctx.chan_width.x_min << "\" y_min=\"" << device_ctx.chan_width.y_min << "\" x_max=\"" << device_ctx.chan_width.x_max << "\" y_max=\"" << device_ctx.chan_width.y_max << "\"/>" << "\n";
 
     auto& list = device_ctx.chan_width.x_list;
     for (size_t i = 0; i < device_ctx.grid.height() - 1; i++) {
-        fp << "\t\t<x_list index =\"" << i << "\" info=\"" << list[i] << "\"/>" << std::endl;
+        fp << "\t\t<x_list index =\"" << i << "\" info=\"" << list[i] << "\"/>" << "\n";
     }
     auto& list2 = device_ctx.chan_width.y_list;
     for (size_t i = 0; i < device_ctx.grid.width() - 1; i++) {
-        fp << "\t\t<y_list index =\"" << i << "\" info=\"" << list2[i] << "\"/>" << std::endl;
+        fp << "\t\t<y_list index =\"" << i << "\" info=\"" << list2[i] << "\"/>" << "\n";
     }
-    fp << "\t</channels>" << std::endl;
+    fp << "\t</channels>" << "\n";
 }
 
 /* All relevant rr node info is written out to the graph.
  * This includes location, timing, and segment info*/
-void write_rr_node(std::fstream& fp) {
+void write_rr_node(BufferedFileWriter& fp) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    fp << "\t<rr_nodes>" << std::endl;
+    fp << "\t<rr_nodes>" << "\n";
 
     for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
         auto& node = device_ctx.rr_nodes[inode];
@@ -111,7 +237,7 @@ void write_rr_node(std::fstream& fp) {
             fp << "\" direction=\"" << node.direction_string();
         }
         fp << "\" capacity=\"" << node.capacity();
-        fp << "\">" << std::endl;
+        fp << "\">" << "\n";
         fp << "\t\t\t<loc";
         fp << " xlow=\"" << node.xlow();
         fp << "\" ylow=\"" << node.ylow();
@@ -121,12 +247,12 @@ void write_rr_node(std::fstream& fp) {
             fp << "\" side=\"" << node.side_string();
         }
         fp << "\" ptc=\"" << node.ptc_num();
-        fp << "\"/>" << std::endl;
-        fp << "\t\t\t<timing R=\"" << std::setprecision(FLOAT_PRECISION) << node.R()
-           << "\" C=\"" << std::setprecision(FLOAT_PRECISION) << node.C() << "\"/>" << std::endl;
+        fp << "\"/>" << "\n";
+        fp << "\t\t\t<timing R=\"" << node.R()
+           << "\" C=\"" << node.C() << "\"/>" << "\n";
 
         if (device_ctx.rr_indexed_data[node.cost_index()].seg_index != -1) {
-            fp << "\t\t\t<segment segment_id=\"" << device_ctx.rr_indexed_data[node.cost_index()].seg_index << "\"/>" << std::endl;
+            fp << "\t\t\t<segment segment_id=\"" << device_ctx.rr_indexed_data[node.cost_index()].seg_index << "\"/>" << "\n";
         }
 
         const auto iter = device_ctx.rr_node_metadata.find(inode);
@@ -135,32 +261,32 @@ void write_rr_node(std::fstream& fp) {
             add_metadata_to_xml(fp, "\t\t\t", meta);
         }
 
-        fp << "\t\t</node>" << std::endl;
+        fp << "\t\t</node>" << "\n";
     }
 
-    fp << "\t</rr_nodes>" << std::endl
-       << std::endl;
+    fp << "\t</rr_nodes>" << "\n"
+       << "\n";
 }
 
 /* Segment information in the t_segment_inf data structure is written out.
  * Information includes segment id, name, and optional timing parameters*/
-void write_rr_segments(std::fstream& fp, const std::vector<t_segment_inf>& segment_inf) {
-    fp << "\t<segments>" << std::endl;
+void write_rr_segments(BufferedFileWriter& fp, const std::vector<t_segment_inf>& segment_inf) {
+    fp << "\t<segments>" << "\n";
 
     for (size_t iseg = 0; iseg < segment_inf.size(); iseg++) {
-        fp << "\t\t<segment id=\"" << iseg << "\" name=\"" << segment_inf[iseg].name << "\">" << std::endl;
-        fp << "\t\t\t<timing R_per_meter=\"" << std::setprecision(FLOAT_PRECISION) << segment_inf[iseg].Rmetal << "\" C_per_meter=\"" << std::setprecision(FLOAT_PRECISION) << segment_inf[iseg].Cmetal << "\"/>" << std::endl;
-        fp << "\t\t</segment>" << std::endl;
+        fp << "\t\t<segment id=\"" << iseg << "\" name=\"" << segment_inf[iseg].name << "\">" << "\n";
+        fp << "\t\t\t<timing R_per_meter=\"" << segment_inf[iseg].Rmetal << "\" C_per_meter=\"" << segment_inf[iseg].Cmetal << "\"/>" << "\n";
+        fp << "\t\t</segment>" << "\n";
     }
-    fp << "\t</segments>" << std::endl
-       << std::endl;
+    fp << "\t</segments>" << "\n"
+       << "\n";
 }
 
 /* Switch info is written out into xml format. This includes
  * general, sizing, and optional timing information*/
-void write_rr_switches(std::fstream& fp) {
+void write_rr_switches(BufferedFileWriter& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<switches>" << std::endl;
+    fp << "\t<switches>" << "\n";
 
     for (size_t iSwitch = 0; iSwitch < device_ctx.rr_switch_inf.size(); iSwitch++) {
         t_rr_switch_inf rr_switch = device_ctx.rr_switch_inf[iSwitch];
@@ -185,21 +311,21 @@ void write_rr_switches(std::fstream& fp) {
         if (rr_switch.name) {
             fp << " name=\"" << rr_switch.name << "\"";
         }
-        fp << ">" << std::endl;
+        fp << ">" << "\n";
 
-        fp << "\t\t\t<timing R=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.R << "\" Cin=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Cin << "\" Cout=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Cout << "\" Cinternal=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Cinternal << "\" Tdel=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Tdel << "\"/>" << std::endl;
-        fp << "\t\t\t<sizing mux_trans_size=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.mux_trans_size << "\" buf_size=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.buf_size << "\"/>" << std::endl;
-        fp << "\t\t</switch>" << std::endl;
+        fp << "\t\t\t<timing R=\"" << rr_switch.R << "\" Cin=\"" << rr_switch.Cin << "\" Cout=\"" << rr_switch.Cout << "\" Cinternal=\"" << rr_switch.Cinternal << "\" Tdel=\"" << rr_switch.Tdel << "\"/>" << "\n";
+        fp << "\t\t\t<sizing mux_trans_size=\"" << rr_switch.mux_trans_size << "\" buf_size=\"" << rr_switch.buf_size << "\"/>" << "\n";
+        fp << "\t\t</switch>" << "\n";
     }
-    fp << "\t</switches>" << std::endl
-       << std::endl;
+    fp << "\t</switches>" << "\n"
+       << "\n";
 }
 
 /* Block information is printed out in xml format. This includes general,
  * pin class, and pins */
-void write_rr_block_types(std::fstream& fp) {
+void write_rr_block_types(BufferedFileWriter& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<block_types>" << std::endl;
+    fp << "\t<block_types>" << "\n";
 
     for (const auto& btype : device_ctx.physical_tile_types) {
         fp << "\t\t<block_type id=\"" << btype.index;
@@ -207,7 +333,7 @@ void write_rr_block_types(std::fstream& fp) {
         VTR_ASSERT(btype.name);
         fp << "\" name=\"" << btype.name;
 
-        fp << "\" width=\"" << btype.width << "\" height=\"" << btype.height << "\">" << std::endl;
+        fp << "\" width=\"" << btype.width << "\" height=\"" << btype.height << "\">" << "\n";
 
         for (int iClass = 0; iClass < btype.num_class; iClass++) {
             auto& class_inf = btype.class_inf[iClass];
@@ -235,37 +361,37 @@ void write_rr_block_types(std::fstream& fp) {
                 fp << vtr::string_fmt("\t\t\t\t<pin ptc=\"%d\">%s</pin>\n",
                                       pin, block_type_pin_index_to_name(&btype, pin).c_str());
             }
-            fp << "\t\t\t</pin_class>" << std::endl;
+            fp << "\t\t\t</pin_class>" << "\n";
         }
-        fp << "\t\t</block_type>" << std::endl;
+        fp << "\t\t</block_type>" << "\n";
     }
-    fp << "\t</block_types>" << std::endl
-       << std::endl;
+    fp << "\t</block_types>" << "\n"
+       << "\n";
 }
 
 /* Grid information is printed out in xml format. Each grid location
  * and its relevant information is included*/
-void write_rr_grid(std::fstream& fp) {
+void write_rr_grid(BufferedFileWriter& fp) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    fp << "\t<grid>" << std::endl;
+    fp << "\t<grid>" << "\n";
 
     for (size_t x = 0; x < device_ctx.grid.width(); x++) {
         for (size_t y = 0; y < device_ctx.grid.height(); y++) {
             t_grid_tile grid_tile = device_ctx.grid[x][y];
 
-            fp << "\t\t<grid_loc x=\"" << x << "\" y=\"" << y << "\" block_type_id=\"" << grid_tile.type->index << "\" width_offset=\"" << grid_tile.width_offset << "\" height_offset=\"" << grid_tile.height_offset << "\"/>" << std::endl;
+            fp << "\t\t<grid_loc x=\"" << x << "\" y=\"" << y << "\" block_type_id=\"" << grid_tile.type->index << "\" width_offset=\"" << grid_tile.width_offset << "\" height_offset=\"" << grid_tile.height_offset << "\"/>" << "\n";
         }
     }
-    fp << "\t</grid>" << std::endl
-       << std::endl;
+    fp << "\t</grid>" << "\n"
+       << "\n";
 }
 
 /* Edges connecting to each rr node is printed out. The two nodes
  * it connects to are also printed*/
-void write_rr_edges(std::fstream& fp) {
+void write_rr_edges(BufferedFileWriter& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<rr_edges>" << std::endl;
+    fp << "\t<rr_edges>" << "\n";
 
     for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
         auto& node = device_ctx.rr_nodes[inode];
@@ -275,7 +401,7 @@ void write_rr_edges(std::fstream& fp) {
             bool wrote_edge_metadata = false;
             const auto iter = device_ctx.rr_edge_metadata.find(std::make_tuple(inode, node.edge_sink_node(iedge), node.edge_switch(iedge)));
             if (iter != device_ctx.rr_edge_metadata.end()) {
-                fp << ">" << std::endl;
+                fp << ">" << "\n";
 
                 const t_metadata_dict& meta = iter->second;
                 add_metadata_to_xml(fp, "\t\t\t", meta);
@@ -283,12 +409,132 @@ void write_rr_edges(std::fstream& fp) {
             }
 
             if (wrote_edge_metadata == false) {
-                fp << "/>" << std::endl;
+                fp << "/>" << "\n";
             } else {
-                fp << "\t\t</edge>" << std::endl;
+                fp << "\t\t</edge>" << "\n";
             }
         }
     }
-    fp << "\t</rr_edges>" << std::endl
-       << std::endl;
+    fp << "\t</rr_edges>" << "\n"
+       << "\n";
+}
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disabled because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+static void write_rr_graph_capnp(const char* /*file_name*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "Binary RR graph writing " DISABLE_ERROR);
 }
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/* Writes the rr graph in binary (Cap'n proto) format. Stores the same graph
+ * content as the XML writer (channels, switches, nodes, edges); the grid,
+ * block type and segment sections only exist in XML for cross-checking the
+ * architecture, which the binary loader trusts instead. Metadata is not
+ * represented in the binary format. */
+static void write_rr_graph_capnp(const char* file_name) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    if (!device_ctx.rr_node_metadata.empty() || !device_ctx.rr_edge_metadata.empty()) {
+        VTR_LOG_WARN("RR graph metadata is not stored in the binary RR graph format; use the .xml format to preserve it\n");
+    }
+
+    ::capnp::MallocMessageBuilder builder;
+    auto rr_graph = builder.initRoot<VprRrGraph>();
+
+    std::string comment = std::string("Generated from arch file ") + get_arch_file_name();
+    rr_graph.setToolComment(comment);
+
+    /* Channels */
+    rr_graph.setChanWidthMax(device_ctx.chan_width.max);
+    rr_graph.setChanWidthXMin(device_ctx.chan_width.x_min);
+    rr_graph.setChanWidthYMin(device_ctx.chan_width.y_min);
+    rr_graph.setChanWidthXMax(device_ctx.chan_width.x_max);
+    rr_graph.setChanWidthYMax(device_ctx.chan_width.y_max);
+
+    auto x_list = rr_graph.initChanWidthXList(device_ctx.chan_width.x_list.size());
+    for (size_t i = 0; i < device_ctx.chan_width.x_list.size(); ++i) {
+        x_list.set(i, device_ctx.chan_width.x_list[i]);
+    }
+    auto y_list = rr_graph.initChanWidthYList(device_ctx.chan_width.y_list.size());
+    for (size_t i = 0; i < device_ctx.chan_width.y_list.size(); ++i) {
+        y_list.set(i, device_ctx.chan_width.y_list[i]);
+    }
+
+    /* Switches */
+    auto switches = rr_graph.initSwitches(device_ctx.rr_switch_inf.size());
+    for (size_t iswitch = 0; iswitch < device_ctx.rr_switch_inf.size(); ++iswitch) {
+        const auto& rr_switch = device_ctx.rr_switch_inf[iswitch];
+        auto out = switches[iswitch];
+
+        out.setType((int8_t)rr_switch.type());
+        if (rr_switch.name) {
+            out.setName(rr_switch.name);
+        }
+        out.setR(rr_switch.R);
+        out.setCin(rr_switch.Cin);
+        out.setCout(rr_switch.Cout);
+        out.setCinternal(rr_switch.Cinternal);
+        out.setTdel(rr_switch.Tdel);
+        out.setMuxTransSize(rr_switch.mux_trans_size);
+        out.setBufSize(rr_switch.buf_size);
+    }
+
+    /* Nodes */
+    size_t num_edges = 0;
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); ++inode) {
+        num_edges += device_ctx.rr_nodes[inode].num_edges();
+    }
+
+    size_t edge_record_bytes = t_rr_node::edge_record_bytes();
+    auto flat_edges = rr_graph.initFlatEdges(num_edges * edge_record_bytes);
+    rr_graph.setEdgeRecordSize(edge_record_bytes);
+    size_t edge_offset = 0; //In records
+
+    auto nodes = rr_graph.initNodes(device_ctx.rr_nodes.size());
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); ++inode) {
+        const auto& node = device_ctx.rr_nodes[inode];
+        auto out = nodes[inode];
+
+        out.setType((int8_t)node.type());
+        if (node.type() == CHANX || node.type() == CHANY) {
+            out.setDirection((int8_t)node.direction());
+        }
+        if (node.type() == IPIN || node.type() == OPIN) {
+            out.setSide((int8_t)node.side());
+        }
+        out.setCapacity(node.capacity());
+        out.setXlow(node.xlow());
+        out.setYlow(node.ylow());
+        out.setXhigh(node.xhigh());
+        out.setYhigh(node.yhigh());
+        out.setPtc(node.ptc_num());
+        out.setR(node.R());
+        out.setC(node.C());
+        out.setSegId(device_ctx.rr_indexed_data[node.cost_index()].seg_index);
+
+        /* Edges: copy this node's (already partitioned) edge records into
+         * its slice of the flat blob */
+        out.setEdgeBegin(edge_offset);
+        out.setNumEdges(node.num_edges());
+        out.setNumNonConfigEdges(node.num_non_configurable_edges());
+
+        memcpy(flat_edges.begin() + edge_offset * edge_record_bytes,
+               node.edge_data(),
+               node.num_edges() * edge_record_bytes);
+        edge_offset += node.num_edges();
+    }
+
+    writeMessageToFile(file_name, &builder);
+
+    VTR_LOG("Finished generating binary RR graph file named %s\n", file_name);
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
@@ -1,3 +1,5 @@
+#include <mutex>
+
 #include "rr_node.h"
 #include "globals.h"
 #include "vpr_error.h"
@@ -221,6 +223,60 @@ void t_rr_node::set_fan_in(t_edge_size new_fan_in) {
     fan_in_ = new_fan_in;
 }
 
+std::vector<t_rr_node::t_rr_edge> t_rr_node::edge_storage_;
+const t_rr_node::t_rr_edge* t_rr_node::edge_base_ = nullptr;
+bool t_rr_node::edge_storage_external_ = false;
+
+void t_rr_node::clear_edge_storage() {
+    edge_storage_.clear();
+    edge_storage_.shrink_to_fit();
+    edge_base_ = nullptr;
+    edge_storage_external_ = false;
+}
+
+void t_rr_node::set_external_edge_storage(const void* base) {
+    VTR_ASSERT_MSG(edge_storage_.empty(), "Cannot mix internal and external RR edge storage");
+    edge_base_ = static_cast<const t_rr_edge*>(base);
+    edge_storage_external_ = true;
+}
+
+size_t t_rr_node::edge_record_bytes() {
+    return sizeof(t_rr_edge);
+}
+
+size_t t_rr_node::edge_storage_bytes() {
+    return edge_storage_.capacity() * sizeof(t_rr_edge);
+}
+
+void t_rr_node::set_external_edges(uint32_t edge_begin, t_edge_size num_edges, t_edge_size num_non_configurable_edges) {
+    VTR_ASSERT(edge_storage_external_);
+    VTR_ASSERT(num_non_configurable_edges <= num_edges);
+    VTR_ASSERT(num_non_configurable_edges <= std::numeric_limits<decltype(num_non_configurable_edges_)>::max());
+
+    edge_begin_ = edge_begin;
+    num_edges_ = num_edges;
+    edges_capacity_ = num_edges;
+    num_non_configurable_edges_ = num_non_configurable_edges;
+}
+
+void t_rr_node::allocate_edge_block(size_t capacity) {
+    VTR_ASSERT_MSG(!edge_storage_external_, "External RR edge storage is read-only");
+
+    //Abandons any previous block; blocks left behind by growth are reclaimed
+    //when the RR graph is freed (clear_edge_storage)
+    size_t new_begin = edge_storage_.size();
+    VTR_ASSERT(new_begin + capacity <= std::numeric_limits<decltype(edge_begin_)>::max());
+
+    edge_storage_.resize(new_begin + capacity);
+
+    //Copy any existing edges into the new block
+    std::copy_n(edge_storage_.begin() + edge_begin_, num_edges_, edge_storage_.begin() + new_begin);
+
+    edge_begin_ = new_begin;
+    edges_capacity_ = capacity;
+    edge_base_ = edge_storage_.data(); //resize() may have reallocated
+}
+
 t_edge_size t_rr_node::add_edge(int sink_node, int iswitch) {
     if (edges_capacity_ == num_edges_) {
         constexpr size_t MAX_EDGE_COUNT = std::numeric_limits<decltype(edges_capacity_)>::max();
@@ -231,20 +287,13 @@ t_edge_size t_rr_node::add_edge(int sink_node, int iswitch) {
         //Grow
         size_t new_edges_capacity = std::max<size_t>(1, 2 * edges_capacity_);
         new_edges_capacity = std::min(new_edges_capacity, MAX_EDGE_COUNT); //Clip to maximum count
-        auto new_edges = std::make_unique<t_rr_edge[]>(new_edges_capacity);
-
-        //Copy
-        std::copy_n(edges_.get(), num_edges_, new_edges.get());
-
-        //Replace
-        edges_ = std::move(new_edges);
-        edges_capacity_ = new_edges_capacity;
+        allocate_edge_block(new_edges_capacity);
     }
 
     VTR_ASSERT(num_edges_ < edges_capacity_);
 
-    edges_[num_edges_].sink_node = sink_node;
-    edges_[num_edges_].switch_id = iswitch;
+    edge_storage_[edge_begin_ + num_edges_].sink_node = sink_node;
+    edge_storage_[edge_begin_ + num_edges_].switch_id = iswitch;
 
     ++num_edges_;
 
@@ -252,18 +301,21 @@ t_edge_size t_rr_node::add_edge(int sink_node, int iswitch) {
 }
 
 void t_rr_node::shrink_to_fit() {
-    //Shrink
-    auto new_edges = std::make_unique<t_rr_edge[]>(num_edges_);
-
-    //Copy
-    std::copy_n(edges_.get(), num_edges_, new_edges.get());
-
-    //Replace
-    edges_ = std::move(new_edges);
+    //The node's edges are already contiguous in the shared storage, so
+    //shrinking just forgets the spare capacity (and returns it to the
+    //storage if this node's block happens to be the final one)
+    if (edge_begin_ + edges_capacity_ == edge_storage_.size()) {
+        edge_storage_.resize(edge_begin_ + num_edges_);
+    }
     edges_capacity_ = num_edges_;
 }
 
 void t_rr_node::partition_edges() {
+    if (edge_storage_external_) {
+        //Externally stored edges are already partitioned (and read-only)
+        return;
+    }
+
     auto& device_ctx = g_vpr_ctx.device();
     auto is_configurable = [&](const t_rr_edge& edge) {
         auto iswitch = edge.switch_id;
@@ -271,9 +323,10 @@ void t_rr_node::partition_edges() {
     };
 
     //Partition the edges so the first set of edges are all configurable, and the later are not
-    auto first_non_config_edge = std::partition(edges_.get(), edges_.get() + num_edges_, is_configurable);
+    auto edges_begin = edge_storage_.begin() + edge_begin_;
+    auto first_non_config_edge = std::partition(edges_begin, edges_begin + num_edges_, is_configurable);
 
-    size_t num_conf_edges = std::distance(edges_.get(), first_non_config_edge);
+    size_t num_conf_edges = std::distance(edges_begin, first_non_config_edge);
     size_t num_non_conf_edges = num_edges() - num_conf_edges; //Note we calculate using the size_t to get full range
 
     //Check that within allowable range (no overflow when stored as num_non_configurable_edges_
@@ -285,10 +338,18 @@ void t_rr_node::partition_edges() {
 
 void t_rr_node::set_num_edges(size_t new_num_edges) {
     VTR_ASSERT(new_num_edges <= std::numeric_limits<t_edge_size>::max());
-    num_edges_ = new_num_edges;
-    edges_capacity_ = new_num_edges;
+    num_edges_ = 0; //Discard any previous edges
+
+    if (new_num_edges == 0 && edges_capacity_ == 0) {
+        //Nothing to allocate. Skipping the (no-op) block allocation also
+        //keeps zero-edge initialization (e.g. of SINKs, which parallel RR
+        //graph build workers perform concurrently) away from the shared
+        //edge storage.
+        return;
+    }
 
-    edges_ = std::make_unique<t_rr_edge[]>(num_edges_);
+    allocate_edge_block(new_num_edges);
+    num_edges_ = new_num_edges;
 }
 
 void t_rr_node::set_direction(e_direction new_direction) {
@@ -308,13 +369,15 @@ void t_rr_node::set_side(e_side new_side) {
 void t_rr_node::set_edge_sink_node(t_edge_size iedge, int sink_node) {
     VTR_ASSERT(iedge < num_edges());
     VTR_ASSERT(sink_node >= 0);
-    edges_[iedge].sink_node = sink_node;
+    VTR_ASSERT_SAFE_MSG(!edge_storage_external_, "External RR edge storage is read-only");
+    edge_storage_[edge_begin_ + iedge].sink_node = sink_node;
 }
 
 void t_rr_node::set_edge_switch(t_edge_size iedge, short switch_index) {
     VTR_ASSERT(iedge < num_edges());
     VTR_ASSERT(switch_index >= 0);
-    edges_[iedge].switch_id = switch_index;
+    VTR_ASSERT_SAFE_MSG(!edge_storage_external_, "External RR edge storage is read-only");
+    edge_storage_[edge_begin_ + iedge].switch_id = switch_index;
 }
 
 t_rr_rc_data::t_rr_rc_data(float Rval, float Cval) noexcept
@@ -322,6 +385,13 @@ t_rr_rc_data::t_rr_rc_data(float Rval, float Cval) noexcept
     , C(Cval) {}
 
 short find_create_rr_rc_data(const float R, const float C) {
+    //The parallel RR graph build phases may call this concurrently. They
+    //pre-create all the RC data they will request (see seed_rr_rc_data()),
+    //so in practice concurrent calls are read-only lookups; the lock makes
+    //any unexpected insertion safe as well.
+    static std::mutex rc_data_mutex;
+    std::lock_guard<std::mutex> lock(rc_data_mutex);
+
     auto& device_ctx = g_vpr_ctx.mutable_device();
 
     auto match = [&](const t_rr_rc_data& val) {
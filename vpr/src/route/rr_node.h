@@ -5,8 +5,8 @@
 
 #include "vtr_range.h"
 
-#include <memory>
 #include <cstdint>
+#include <vector>
 /* Main structure describing one routing resource node.  Everything in       *
  * this structure should describe the graph -- information needed only       *
  * to store algorithm-specific data should be stored in one of the           *
@@ -85,13 +85,17 @@ class t_rr_node {
 
     int edge_sink_node(t_edge_size iedge) const {
         VTR_ASSERT_SAFE(iedge < num_edges());
-        return edges_[iedge].sink_node;
+        return edge_base_[edge_begin_ + iedge].sink_node;
     }
     short edge_switch(t_edge_size iedge) const {
         VTR_ASSERT_SAFE(iedge < num_edges());
-        return edges_[iedge].switch_id;
+        return edge_base_[edge_begin_ + iedge].switch_id;
     }
 
+    //Raw bytes of this node's edge records (for serialization); there are
+    //num_edges() records of edge_record_bytes() each
+    const void* edge_data() const { return &edge_base_[edge_begin_]; }
+
     bool edge_is_configurable(t_edge_size iedge) const;
     t_edge_size fan_in() const;
 
@@ -157,6 +161,29 @@ class t_rr_node {
     void set_direction(e_direction);
     void set_side(e_side);
 
+    //Points this node at a pre-partitioned slice of external edge storage
+    //(see set_external_edge_storage()). The slice is read-only: the usual
+    //edge mutators must not be called afterwards.
+    void set_external_edges(uint32_t edge_begin, t_edge_size num_edges, t_edge_size num_non_configurable_edges);
+
+  public: //Class methods
+    //Releases the shared edge storage (e.g. when the RR graph is freed).
+    //Must not be called while any live t_rr_node still references its edges.
+    static void clear_edge_storage();
+
+    //Backs all nodes' edges by an external read-only array of edge records
+    //(e.g. a memory-mapped rr graph file), instead of the internally
+    //allocated storage. 'base' must point at records laid out exactly as
+    //edge_record_bytes() describes and must outlive the RR graph.
+    static void set_external_edge_storage(const void* base);
+
+    //sizeof one edge record, for validating externally stored edges
+    static size_t edge_record_bytes();
+
+    //Bytes currently held by the shared internal edge storage (zero when
+    //edges are externally backed), for memory accounting
+    static size_t edge_storage_bytes();
+
   private: //Types
     //The edge information is stored in a structure to economize on the number of pointers held
     //by t_rr_node (to save memory), and is not exposed externally
@@ -165,10 +192,25 @@ class t_rr_node {
         short switch_id = -1; //The ID of the switch type this edge represents
     };
 
+  private: //Methods
+    //Allocates a fresh block of 'capacity' edges at the tail of the shared
+    //edge storage, copying the node's current edges into it
+    void allocate_edge_block(size_t capacity);
+
   private: //Data
-    //Note: we use a plain array and use small types for sizes to save space vs std::vector
-    //      (using std::vector's nearly doubles the size of the class)
-    std::unique_ptr<t_rr_edge[]> edges_ = nullptr;
+    //All nodes' edges live contiguously in a single shared array, with each
+    //node holding the offset of its own range. This keeps neighbour expansion
+    //walking sequential memory (rather than chasing a per-node heap
+    //allocation) and drops a pointer per node.
+    static std::vector<t_rr_edge> edge_storage_;
+
+    //Where edge reads actually go: either edge_storage_.data(), or an
+    //external read-only array (e.g. a memory-mapped rr graph file) installed
+    //by set_external_edge_storage()
+    static const t_rr_edge* edge_base_;
+    static bool edge_storage_external_;
+
+    uint32_t edge_begin_ = 0; //Index of this node's first edge in edge_base_
     t_edge_size num_edges_ = 0;
     t_edge_size edges_capacity_ = 0;
     uint8_t num_non_configurable_edges_ = 0;
@@ -216,19 +258,33 @@ class t_rr_node {
  * T_quadratic:  Dominant delay for unbuffered segments, 0 for buffered      *
  *               segments.                                                   *
  * C_load:  Load capacitance seen by the driver for each segment added to    *
- *          the chain driven by the driver.  0 for buffered segments.        */
+ *          the chain driven by the driver.  0 for buffered segments.        *
+ *                                                                           *
+ * The fields are ordered hot-first: the router reads base_cost through      *
+ * ortho_cost_index on every node expansion (congestion cost and lookahead), *
+ * while saved_base_cost and seg_index are touched only when pres_fac        *
+ * changes or while lookahead structures are built. Keeping the hot fields   *
+ * contiguous at the front lets an expansion's reads come from the first     *
+ * part of the entry (two 32-byte entries share each cache line).            */
 
 struct t_rr_indexed_data {
+    //Hot: read per node expansion
     float base_cost;
-    float saved_base_cost;
-    int ortho_cost_index;
-    int seg_index;
     float inv_length;
     float T_linear;
     float T_quadratic;
     float C_load;
+    int ortho_cost_index;
+
+    //Cold: read only outside the expansion loop
+    float saved_base_cost;
+    int seg_index;
 };
 
+//The router indexes this table on every expansion; keep an entry at (half)
+//a cache line so entries do not straddle lines unnecessarily
+static_assert(sizeof(t_rr_indexed_data) == 32, "t_rr_indexed_data should stay tightly packed");
+
 /*
  * Reistance/Capacitance data for an RR Nodes
  *
@@ -2,10 +2,31 @@
 
 #include "globals.h"
 
+SpatialRouteTreeLookup::SpatialRouteTreeLookup(const t_bb& bb, int bin_dim)
+    : xmin_(bb.xmin)
+    , ymin_(bb.ymin)
+    , bin_dim_(std::max(bin_dim, 1)) {
+    size_t bins_x = std::ceil(float(bb.xmax - bb.xmin + 1) / bin_dim_);
+    size_t bins_y = std::ceil(float(bb.ymax - bb.ymin + 1) / bin_dim_);
+
+    bins_ = vtr::Matrix<std::vector<t_rt_node*>>({std::max<size_t>(bins_x, 1), std::max<size_t>(bins_y, 1)});
+}
+
+size_t SpatialRouteTreeLookup::grid_to_bin_x(size_t grid_x) const {
+    size_t bin_x = size_t(std::max<int>(int(grid_x) - xmin_, 0)) / bin_dim_;
+
+    return std::min(bin_x, num_bins_x() - 1);
+}
+
+size_t SpatialRouteTreeLookup::grid_to_bin_y(size_t grid_y) const {
+    size_t bin_y = size_t(std::max<int>(int(grid_y) - ymin_, 0)) / bin_dim_;
+
+    return std::min(bin_y, num_bins_y() - 1);
+}
+
 SpatialRouteTreeLookup build_route_tree_spatial_lookup(ClusterNetId net, t_rt_node* rt_root) {
     constexpr float BIN_AREA_PER_SINK_FACTOR = 4;
 
-    auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.routing();
 
@@ -16,12 +37,9 @@ SpatialRouteTreeLookup build_route_tree_spatial_lookup(ClusterNetId net, t_rt_no
     float bb_area_per_sink = bb_area / fanout;
     float bin_area = BIN_AREA_PER_SINK_FACTOR * bb_area_per_sink;
 
-    float bin_dim = std::ceil(std::sqrt(bin_area));
-
-    size_t bins_x = std::ceil(device_ctx.grid.width() / bin_dim);
-    size_t bins_y = std::ceil(device_ctx.grid.height() / bin_dim);
+    int bin_dim = std::ceil(std::sqrt(bin_area));
 
-    SpatialRouteTreeLookup spatial_lookup({bins_x, bins_y});
+    SpatialRouteTreeLookup spatial_lookup(bb, bin_dim);
 
     update_route_tree_spatial_lookup_recur(rt_root, spatial_lookup);
 
@@ -34,12 +52,12 @@ void update_route_tree_spatial_lookup_recur(t_rt_node* rt_node, SpatialRouteTree
 
     auto& rr_node = device_ctx.rr_nodes[rt_node->inode];
 
-    int bin_xlow = grid_to_bin_x(rr_node.xlow(), spatial_lookup);
-    int bin_ylow = grid_to_bin_y(rr_node.ylow(), spatial_lookup);
-    int bin_xhigh = grid_to_bin_x(rr_node.xhigh(), spatial_lookup);
-    int bin_yhigh = grid_to_bin_y(rr_node.yhigh(), spatial_lookup);
+    int bin_xlow = spatial_lookup.grid_to_bin_x(rr_node.xlow());
+    int bin_ylow = spatial_lookup.grid_to_bin_y(rr_node.ylow());
+    int bin_xhigh = spatial_lookup.grid_to_bin_x(rr_node.xhigh());
+    int bin_yhigh = spatial_lookup.grid_to_bin_y(rr_node.yhigh());
 
-    spatial_lookup[bin_xlow][bin_ylow].push_back(rt_node);
+    spatial_lookup.bin_nodes(bin_xlow, bin_ylow).push_back(rt_node);
 
     //We current look at the start/end locations of the RR nodes and add the node
     //to both bins if they are different
@@ -49,7 +67,7 @@ void update_route_tree_spatial_lookup_recur(t_rt_node* rt_node, SpatialRouteTree
     //      are not added. If this becomes an issues, reconsider how we add nodes to
     //      bins
     if (bin_xhigh != bin_xlow || bin_yhigh != bin_ylow) {
-        spatial_lookup[bin_xhigh][bin_yhigh].push_back(rt_node);
+        spatial_lookup.bin_nodes(bin_xhigh, bin_yhigh).push_back(rt_node);
     }
 
     //Recurse
@@ -58,42 +76,26 @@ void update_route_tree_spatial_lookup_recur(t_rt_node* rt_node, SpatialRouteTree
     }
 }
 
-size_t grid_to_bin_x(size_t grid_x, const SpatialRouteTreeLookup& spatial_lookup) {
-    auto& device_ctx = g_vpr_ctx.device();
-
-    int bin_width = std::ceil(float(device_ctx.grid.width()) / spatial_lookup.dim_size(0));
-
-    return grid_x / bin_width;
-}
-
-size_t grid_to_bin_y(size_t grid_y, const SpatialRouteTreeLookup& spatial_lookup) {
-    auto& device_ctx = g_vpr_ctx.device();
-
-    int bin_height = std::ceil(float(device_ctx.grid.height()) / spatial_lookup.dim_size(1));
-
-    return grid_y / bin_height;
-}
-
 bool validate_route_tree_spatial_lookup(t_rt_node* rt_node, const SpatialRouteTreeLookup& spatial_lookup) {
     auto& device_ctx = g_vpr_ctx.device();
 
     auto& rr_node = device_ctx.rr_nodes[rt_node->inode];
 
-    int bin_xlow = grid_to_bin_x(rr_node.xlow(), spatial_lookup);
-    int bin_ylow = grid_to_bin_y(rr_node.ylow(), spatial_lookup);
-    int bin_xhigh = grid_to_bin_x(rr_node.xhigh(), spatial_lookup);
-    int bin_yhigh = grid_to_bin_y(rr_node.yhigh(), spatial_lookup);
+    int bin_xlow = spatial_lookup.grid_to_bin_x(rr_node.xlow());
+    int bin_ylow = spatial_lookup.grid_to_bin_y(rr_node.ylow());
+    int bin_xhigh = spatial_lookup.grid_to_bin_x(rr_node.xhigh());
+    int bin_yhigh = spatial_lookup.grid_to_bin_y(rr_node.yhigh());
 
     bool valid = true;
 
-    auto& low_bin_rt_nodes = spatial_lookup[bin_xlow][bin_ylow];
+    auto& low_bin_rt_nodes = spatial_lookup.bin_nodes(bin_xlow, bin_ylow);
     if (std::find(low_bin_rt_nodes.begin(), low_bin_rt_nodes.end(), rt_node) == low_bin_rt_nodes.end()) {
         valid = false;
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to find route tree node %d at (low coord %d,%d) in spatial lookup [bin %d,%d]",
                         rt_node->inode, rr_node.xlow(), rr_node.ylow(), bin_xlow, bin_ylow);
     }
 
-    auto& high_bin_rt_nodes = spatial_lookup[bin_xhigh][bin_yhigh];
+    auto& high_bin_rt_nodes = spatial_lookup.bin_nodes(bin_xhigh, bin_yhigh);
     if (std::find(high_bin_rt_nodes.begin(), high_bin_rt_nodes.end(), rt_node) == high_bin_rt_nodes.end()) {
         valid = false;
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to find route tree node %d at (high coord %d,%d) in spatial lookup [bin %d,%d]",
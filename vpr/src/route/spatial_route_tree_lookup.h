@@ -4,18 +4,40 @@
 
 #include "vtr_ndmatrix.h"
 
+#include "vpr_types.h"
 #include "clustered_netlist_fwd.h"
 #include "route_tree_type.h"
 
-typedef vtr::Matrix<std::vector<t_rt_node*>> SpatialRouteTreeLookup;
+//Grid-bin look-up from device locations to the route tree nodes located
+//there. The bins cover only the net's routing bounding box (rather than the
+//whole device grid), so small-bounding-box high fanout nets don't pay to
+//allocate and clear bins they can never touch; locations outside the
+//bounding box are clamped into the edge bins.
+class SpatialRouteTreeLookup {
+  public:
+    SpatialRouteTreeLookup() = default;
+    SpatialRouteTreeLookup(const t_bb& bb, int bin_dim);
+
+    size_t num_bins_x() const { return bins_.dim_size(0); }
+    size_t num_bins_y() const { return bins_.dim_size(1); }
+
+    size_t grid_to_bin_x(size_t grid_x) const;
+    size_t grid_to_bin_y(size_t grid_y) const;
+
+    std::vector<t_rt_node*>& bin_nodes(size_t bin_x, size_t bin_y) { return bins_[bin_x][bin_y]; }
+    const std::vector<t_rt_node*>& bin_nodes(size_t bin_x, size_t bin_y) const { return bins_[bin_x][bin_y]; }
+
+  private:
+    int xmin_ = 0;
+    int ymin_ = 0;
+    int bin_dim_ = 1;
+    vtr::Matrix<std::vector<t_rt_node*>> bins_;
+};
 
 SpatialRouteTreeLookup build_route_tree_spatial_lookup(ClusterNetId net, t_rt_node* rt_root);
 
 void update_route_tree_spatial_lookup_recur(t_rt_node* rt_node, SpatialRouteTreeLookup& spatial_lookup);
 
-size_t grid_to_bin_x(size_t grid_x, const SpatialRouteTreeLookup& spatial_lookup);
-size_t grid_to_bin_y(size_t grid_y, const SpatialRouteTreeLookup& spatial_lookup);
-
 bool validate_route_tree_spatial_lookup(t_rt_node* rt_root, const SpatialRouteTreeLookup& spatial_lookup);
 
 #endif
@@ -1,5 +1,8 @@
 #ifndef POST_CLUSTER_DELAY_CALCULATOR_H
 #define POST_CLUSTER_DELAY_CALCULATOR_H
+#include <atomic>
+#include <unordered_map>
+
 #include "vtr_linear_map.h"
 
 #include "tatum/Time.hpp"
@@ -18,6 +21,7 @@ class VprTimingGraphResolver; //Forward declaration
 class PostClusterDelayCalculator : public tatum::DelayCalculator {
   public:
     PostClusterDelayCalculator(const AtomNetlist& netlist, const AtomLookup& netlist_lookup, vtr::vector<ClusterNetId, float*>& net_delay);
+    ~PostClusterDelayCalculator();
 
     tatum::Time max_edge_delay(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const override;
     tatum::Time setup_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const override;
@@ -27,6 +31,18 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
 
     void clear_cache();
 
+    //When enabled the full edge delay (including the inter-cluster routing
+    //component) is cached, so unchanged edges cost a single load on
+    //subsequent timing updates. The caller then *must* invalidate the edges
+    //of any net whose routing changes (invalidate_delays_for_net), so this
+    //is off by default (e.g. the placer moves too many nets per update for
+    //invalidation to be worthwhile).
+    void set_full_delay_cache_enabled(bool enabled);
+
+    //Invalidates the cached delays of all timing graph edges carried by the
+    //specified clustered net (used with set_full_delay_cache_enabled)
+    void invalidate_delays_for_net(ClusterNetId net_id);
+
     void set_tsu_margin_relative(float val);
     void set_tsu_margin_absolute(float val);
 
@@ -74,6 +90,20 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
     float tsu_margin_rel_ = 1.0;
     float tsu_margin_abs_ = 0.0e-12;
 
+    bool full_delay_cache_enabled_ = false;
+
+    //Which clustered net carries each timing graph edge (recorded as edges
+    //are first resolved to cluster pins). Each edge writes only its own
+    //preallocated slot, so recording is safe under parallel timing analysis
+    //(like the per-edge delay caches below).
+    mutable vtr::vector<tatum::EdgeId, ClusterNetId> edge_nets_;
+    mutable std::atomic<bool> edge_nets_changed_{false};
+
+    //Inverted edge_nets_ index used for per-net invalidation; (re)built from
+    //edge_nets_ by invalidate_delays_for_net() (a serial context), never
+    //during analysis
+    std::unordered_map<ClusterNetId, std::vector<tatum::EdgeId>> net_edges_;
+
     mutable vtr::vector<tatum::EdgeId, tatum::Time> edge_min_delay_cache_;
     mutable vtr::vector<tatum::EdgeId, tatum::Time> edge_max_delay_cache_;
     mutable vtr::vector<tatum::EdgeId, tatum::Time> driver_clb_min_delay_cache_;
@@ -82,6 +112,11 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
     mutable vtr::vector<tatum::EdgeId, tatum::Time> sink_clb_max_delay_cache_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ClusterPinId, ClusterPinId>> pin_cache_min_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ClusterPinId, ClusterPinId>> pin_cache_max_;
+
+    //Edge delay cache effectiveness counters (reported to the profiling
+    //registry on destruction)
+    mutable size_t cache_hits_ = 0;
+    mutable size_t cache_misses_ = 0;
 };
 
 #include "PostClusterDelayCalculator.tpp"
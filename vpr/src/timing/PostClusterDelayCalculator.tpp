@@ -6,6 +6,7 @@
 #include "globals.h"
 
 #include "vtr_assert.h"
+#include "vtr_profile.h"
 
 //Print detailed debug info about edge delay calculation
 /*#define POST_CLUSTER_DELAY_CALC_DEBUG*/
@@ -17,6 +18,7 @@ inline PostClusterDelayCalculator::PostClusterDelayCalculator(const AtomNetlist&
     , netlist_lookup_(netlist_lookup)
     , net_delay_()
     , atom_delay_calc_(netlist, netlist_lookup)
+    , edge_nets_(g_vpr_ctx.timing().graph->edges().size(), ClusterNetId::INVALID())
     , edge_min_delay_cache_(g_vpr_ctx.timing().graph->edges().size(), tatum::Time(NAN))
     , edge_max_delay_cache_(g_vpr_ctx.timing().graph->edges().size(), tatum::Time(NAN))
     , driver_clb_min_delay_cache_(g_vpr_ctx.timing().graph->edges().size(), tatum::Time(NAN))
@@ -28,6 +30,11 @@ inline PostClusterDelayCalculator::PostClusterDelayCalculator(const AtomNetlist&
     net_delay_ = net_delay;
 }
 
+inline PostClusterDelayCalculator::~PostClusterDelayCalculator() {
+    vtr::profile::add_to_counter("post_cluster_delay_cache_hits", cache_hits_);
+    vtr::profile::add_to_counter("post_cluster_delay_cache_misses", cache_misses_);
+}
+
 inline void PostClusterDelayCalculator::clear_cache() {
     std::fill(edge_min_delay_cache_.begin(), edge_min_delay_cache_.end(), tatum::Time(NAN));
     std::fill(edge_max_delay_cache_.begin(), edge_max_delay_cache_.end(), tatum::Time(NAN));
@@ -39,6 +46,35 @@ inline void PostClusterDelayCalculator::clear_cache() {
     std::fill(pin_cache_max_.begin(), pin_cache_max_.end(), std::pair<ClusterPinId, ClusterPinId>(ClusterPinId::INVALID(), ClusterPinId::INVALID()));
 }
 
+inline void PostClusterDelayCalculator::set_full_delay_cache_enabled(bool enabled) {
+    full_delay_cache_enabled_ = enabled;
+}
+
+inline void PostClusterDelayCalculator::invalidate_delays_for_net(ClusterNetId net_id) {
+    //Fold any edge->net records made during the last (possibly parallel)
+    //timing analysis into the net->edges index. This runs in a serial
+    //context (the router invalidates between timing updates), keeping the
+    //index mutation out of the analysis threads.
+    if (edge_nets_changed_.exchange(false)) {
+        net_edges_.clear();
+        for (size_t iedge = 0; iedge < edge_nets_.size(); ++iedge) {
+            tatum::EdgeId edge(iedge);
+            ClusterNetId edge_net = edge_nets_[edge];
+            if (edge_net != ClusterNetId::INVALID()) {
+                net_edges_[edge_net].push_back(edge);
+            }
+        }
+    }
+
+    auto itr = net_edges_.find(net_id);
+    if (itr == net_edges_.end()) return; //No edges of this net resolved yet
+
+    for (tatum::EdgeId edge : itr->second) {
+        edge_min_delay_cache_[edge] = tatum::Time(NAN);
+        edge_max_delay_cache_[edge] = tatum::Time(NAN);
+    }
+}
+
 inline void PostClusterDelayCalculator::set_tsu_margin_relative(float new_margin) {
     tsu_margin_rel_ = new_margin;
 }
@@ -290,6 +326,17 @@ inline tatum::Time PostClusterDelayCalculator::atom_net_delay(const tatum::Timin
                 VTR_ASSERT(sink_pin != ClusterPinId::INVALID());
                 set_cached_pins(edge_id, delay_type, src_pin, sink_pin);
 
+                //Record which net carries this edge for per-net invalidation
+                //(per-edge slot, so safe under parallel timing analysis)
+                if (edge_nets_[edge_id] == ClusterNetId::INVALID()) {
+                    edge_nets_[edge_id] = net_id;
+                    edge_nets_changed_.store(true, std::memory_order_relaxed);
+                }
+
+                if (full_delay_cache_enabled_) {
+                    set_cached_delay(edge_id, delay_type, edge_delay);
+                }
+
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
                 VTR_LOG("  Edge %zu net delay: %g = %g + %g + %g (= clb_driver + net + clb_sink) [UNcached]\n",
                         size_t(edge_id),
@@ -334,6 +381,10 @@ inline tatum::Time PostClusterDelayCalculator::atom_net_delay(const tatum::Timin
                                                                     cluster_ctx.clb_nlist.pin_net_index(sink_pin)));
 
             edge_delay = driver_clb_delay + net_delay + sink_clb_delay;
+
+            if (full_delay_cache_enabled_) {
+                set_cached_delay(edge_id, delay_type, edge_delay);
+            }
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
             VTR_LOG("  Edge %zu net delay: %g = %g + %g + %g (= clb_driver + net + clb_sink) [Cached]\n",
                     size_t(edge_id),
@@ -362,12 +413,22 @@ inline float PostClusterDelayCalculator::inter_cluster_delay(const ClusterNetId
 }
 
 inline tatum::Time PostClusterDelayCalculator::get_cached_delay(tatum::EdgeId edge, DelayType delay_type) const {
+    tatum::Time delay;
     if (delay_type == DelayType::MAX) {
-        return edge_max_delay_cache_[edge];
+        delay = edge_max_delay_cache_[edge];
     } else {
         VTR_ASSERT(delay_type == DelayType::MIN);
-        return edge_min_delay_cache_[edge];
+        delay = edge_min_delay_cache_[edge];
     }
+
+    //Callers treat NaN as a cache miss and recompute
+    if (std::isnan(delay.value())) {
+        ++cache_misses_;
+    } else {
+        ++cache_hits_;
+    }
+
+    return delay;
 }
 
 inline void PostClusterDelayCalculator::set_cached_delay(tatum::EdgeId edge, DelayType delay_type, tatum::Time delay) const {
@@ -1,6 +1,7 @@
 #ifndef PRE_CLUSTER_DELAY_CALCULATOR_H
 #define PRE_CLUSTER_DELAY_CALCULATOR_H
 #include "vtr_assert.h"
+#include "vtr_vector.h"
 
 #include "tatum/Time.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
@@ -22,7 +23,29 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
         , netlist_lookup_(netlist_lookup)
         , inter_cluster_net_delay_(intercluster_net_delay)
         , block_to_pb_gnode_(expected_lowest_cost_pb_gnode) {
-        //nop
+        //Pre-resolve every atom pin to its pb graph pin.  The mapping depends
+        //only on the block's expected primitive and the pin's model port/bit,
+        //so resolving it once here avoids re-walking the primitive's ports for
+        //every edge delay query during the pre-packing timing analysis.
+        pin_to_gpin_.resize(netlist_.pins().size(), nullptr);
+        for (AtomPinId pin : netlist_.pins()) {
+            AtomBlockId blk = netlist_.pin_block(pin);
+
+            auto iter = block_to_pb_gnode_.find(blk);
+            VTR_ASSERT(iter != block_to_pb_gnode_.end());
+
+            const t_pb_graph_node* pb_gnode = iter->second;
+            VTR_ASSERT(pb_gnode);
+
+            AtomPortId port = netlist_.pin_port(pin);
+            const t_model_ports* model_port = netlist_.port_model(port);
+            int ipin = netlist_.pin_port_bit(pin);
+
+            const t_pb_graph_pin* gpin = get_pb_graph_node_pin_from_model_port_pin(model_port, ipin, pb_gnode);
+            VTR_ASSERT(gpin);
+
+            pin_to_gpin_[pin] = gpin;
+        }
     }
 
     tatum::Time max_edge_delay(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const override {
@@ -130,21 +153,8 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
     }
 
     const t_pb_graph_pin* find_pb_graph_pin(const AtomPinId pin) const {
-        AtomBlockId blk = netlist_.pin_block(pin);
-
-        auto iter = block_to_pb_gnode_.find(blk);
-        VTR_ASSERT(iter != block_to_pb_gnode_.end());
-
-        const t_pb_graph_node* pb_gnode = iter->second;
-        VTR_ASSERT(pb_gnode);
-
-        AtomPortId port = netlist_.pin_port(pin);
-        const t_model_ports* model_port = netlist_.port_model(port);
-        int ipin = netlist_.pin_port_bit(pin);
-
-        const t_pb_graph_pin* gpin = get_pb_graph_node_pin_from_model_port_pin(model_port, ipin, pb_gnode);
+        const t_pb_graph_pin* gpin = pin_to_gpin_[pin];
         VTR_ASSERT(gpin);
-
         return gpin;
     }
 
@@ -166,6 +176,7 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
     const AtomLookup& netlist_lookup_;
     const float inter_cluster_net_delay_;
     const std::unordered_map<AtomBlockId, t_pb_graph_node*> block_to_pb_gnode_;
+    vtr::vector<AtomPinId, const t_pb_graph_pin*> pin_to_gpin_;
 };
 
 #endif
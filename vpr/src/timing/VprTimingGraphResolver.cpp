@@ -9,16 +9,34 @@ VprTimingGraphResolver::VprTimingGraphResolver(const AtomNetlist& netlist, const
     , delay_calc_(delay_calc) {}
 
 std::string VprTimingGraphResolver::node_name(tatum::NodeId node) const {
-    AtomPinId pin = netlist_lookup_.tnode_atom_pin(node);
+    if (node_name_cache_.empty()) {
+        node_name_cache_.resize(timing_graph_.nodes().size());
+    }
+
+    std::string& name = node_name_cache_[size_t(node)];
+    if (name.empty()) {
+        AtomPinId pin = netlist_lookup_.tnode_atom_pin(node);
 
-    return netlist_.pin_name(pin);
+        name = netlist_.pin_name(pin);
+    }
+
+    return name;
 }
 
 std::string VprTimingGraphResolver::node_type_name(tatum::NodeId node) const {
+    if (node_type_name_cache_.empty()) {
+        node_type_name_cache_.resize(timing_graph_.nodes().size());
+    }
+
+    std::string& name = node_type_name_cache_[size_t(node)];
+    if (!name.empty()) {
+        return name;
+    }
+
     AtomPinId pin = netlist_lookup_.tnode_atom_pin(node);
     AtomBlockId blk = netlist_.pin_block(pin);
 
-    std::string name = netlist_.block_model(blk)->name;
+    name = netlist_.block_model(blk)->name;
 
     if (detail_level() == e_timing_report_detail::AGGREGATED || detail_level() == e_timing_report_detail::DETAILED_ROUTING) {
         //Detailed report consist of the aggregated reported with a breakdown of inter-block routing
@@ -221,6 +239,10 @@ e_timing_report_detail VprTimingGraphResolver::detail_level() const {
 }
 
 void VprTimingGraphResolver::set_detail_level(e_timing_report_detail report_detail) {
+    if (report_detail != detail_level_) {
+        //The type names embed the grid location at the more detailed levels
+        node_type_name_cache_.clear();
+    }
     detail_level_ = report_detail;
 }
 
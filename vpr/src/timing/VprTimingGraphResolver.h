@@ -30,6 +30,15 @@ class VprTimingGraphResolver : public tatum::TimingGraphNameResolver {
     const tatum::TimingGraph& timing_graph_;
     const AnalysisDelayCalculator& delay_calc_;
     e_timing_report_detail detail_level_ = e_timing_report_detail::NETLIST;
+
+    //Lazily resolved per-tnode names (indexed by size_t(tnode), "" if not yet resolved).
+    //
+    //Resolving a name requires several netlist/look-up traversals and string
+    //concatenations, and the same node appears on many reported paths, so the
+    //resolved names are cached for the life of this resolver (a single report
+    //generation, during which the netlist and placement cannot change).
+    mutable std::vector<std::string> node_name_cache_;
+    mutable std::vector<std::string> node_type_name_cache_; //Depends on detail_level_ (cleared by set_detail_level())
 };
 
 #endif
@@ -1,5 +1,9 @@
 #ifndef VPR_CLB_DELAY_CALC_H
 #define VPR_CLB_DELAY_CALC_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
 #include "DelayType.h"
 
 //Delay Calculator for routing internal to a clustered logic block
@@ -19,12 +23,20 @@ class ClbDelayCalc {
   private:
     float trace_delay(ClusterBlockId clb, int src_pb_route_pin, int sink_pb_route_pin, DelayType delay_type) const;
 
-    float pb_route_delay(ClusterBlockId clb, int pb_route_idx, DelayType delay_type) const;
-    const t_pb_graph_edge* find_pb_graph_edge(ClusterBlockId clb, int pb_route_idx) const;
-    const t_pb_graph_edge* find_pb_graph_edge(const t_pb_graph_pin* driver, const t_pb_graph_pin* sink) const;
+    float pb_edge_delay(int type_index, int driver_pb_pin, int sink_pb_pin, DelayType delay_type) const;
+    const t_pb_graph_edge* find_pb_graph_edge(int type_index, int driver_pb_pin, int sink_pb_pin) const;
 
   private:
     IntraLbPbPinLookup intra_lb_pb_pin_lookup_;
+
+    //Pb graph edge lookups, keyed per (block type, driver pin, sink pin).
+    //The pb graph topology (and hence which edge connects a given pin
+    //pair) is a property of the block type, not of any particular block's
+    //internal routing, so the tables are built once in the constructor and
+    //are read-only afterwards (delay queries may run from several timing
+    //analysis threads concurrently). This avoids re-scanning each driver
+    //pin's output edges on every traced hop of every delay query.
+    std::vector<std::unordered_map<uint64_t, const t_pb_graph_edge*>> pb_edge_tables_;
 };
 
 #include "clb_delay_calc.inl"
@@ -7,7 +7,33 @@
  */
 
 inline ClbDelayCalc::ClbDelayCalc()
-    : intra_lb_pb_pin_lookup_(g_vpr_ctx.device().logical_block_types) {}
+    : intra_lb_pb_pin_lookup_(g_vpr_ctx.device().logical_block_types) {
+    //Build the per-type pb graph edge tables up-front: the pb graph topology
+    //is fixed once the architecture is loaded, so the tables are read-only
+    //afterwards (and hence safe to query from parallel timing analysis)
+    const auto& logical_block_types = g_vpr_ctx.device().logical_block_types;
+
+    pb_edge_tables_.resize(logical_block_types.size());
+    for (const t_logical_block_type& type : logical_block_types) {
+        if (!type.pb_graph_head) continue; //E.g. the EMPTY type
+
+        auto& type_table = pb_edge_tables_[type.index];
+        for (int ipin = 0; ipin < type.pb_graph_head->total_pb_pins; ++ipin) {
+            const t_pb_graph_pin* driver_gpin = intra_lb_pb_pin_lookup_.pb_gpin(type.index, ipin);
+            if (!driver_gpin) continue;
+
+            for (int iedge = 0; iedge < driver_gpin->num_output_edges; ++iedge) {
+                const t_pb_graph_edge* pb_edge = driver_gpin->output_edges[iedge];
+                VTR_ASSERT(pb_edge);
+
+                for (int isink = 0; isink < pb_edge->num_output_pins; ++isink) {
+                    uint64_t key = (uint64_t(ipin) << 32) | uint64_t(pb_edge->output_pins[isink]->pin_count_in_cluster);
+                    type_table.emplace(key, pb_edge);
+                }
+            }
+        }
+    }
+}
 
 inline float ClbDelayCalc::clb_input_to_internal_sink_delay(const ClusterBlockId block_id, const int pin_index, int internal_sink_pin, DelayType delay_type) const {
     int pb_ipin = find_clb_pb_pin(block_id, pin_index);
@@ -38,16 +64,26 @@ inline float ClbDelayCalc::trace_delay(ClusterBlockId clb, int src_pb_route_id,
     VTR_ASSERT_MSG(atom_net, "Source pin must be connected to a valid net");
     VTR_ASSERT_MSG(atom_net == pb_routes[sink_pb_route_id].atom_net_id, "Source pin and sink pin must connect to the same net");
 
+    int type_index = cluster_ctx.clb_nlist.block_type(clb)->index;
+
     float delay = 0.;
 
-    //Trace back the internal routing from the sink to the source pin
+    //Trace back the internal routing from the sink to the source pin.
+    //Note we look up each pb_route entry only once per hop: the entry
+    //yields both the driver pin (next hop) and the pin pair whose
+    //connecting edge delay is memoized per block type.
     int curr_pb_route_id = sink_pb_route_id;
-    while(pb_routes[curr_pb_route_id].driver_pb_pin_id >= 0) {
-        VTR_ASSERT_MSG(atom_net == pb_routes[curr_pb_route_id].atom_net_id, "Internal routing must connect the same net");
+    while(true) {
+        const t_pb_route& pb_route = pb_routes[curr_pb_route_id];
+
+        int driver_pb_route_id = pb_route.driver_pb_pin_id;
+        if (driver_pb_route_id < 0) break;
 
-        delay += pb_route_delay(clb, curr_pb_route_id, delay_type);
+        VTR_ASSERT_MSG(atom_net == pb_route.atom_net_id, "Internal routing must connect the same net");
 
-        curr_pb_route_id = pb_routes[curr_pb_route_id].driver_pb_pin_id;
+        delay += pb_edge_delay(type_index, driver_pb_route_id, curr_pb_route_id, delay_type);
+
+        curr_pb_route_id = driver_pb_route_id;
     }
 
     VTR_ASSERT_MSG(curr_pb_route_id == src_pb_route_id, "Sink pin should trace back to source pin");
@@ -55,59 +91,25 @@ inline float ClbDelayCalc::trace_delay(ClusterBlockId clb, int src_pb_route_id,
     return delay;
 }
 
-inline float ClbDelayCalc::pb_route_delay(ClusterBlockId clb, int pb_route_idx, DelayType delay_type) const {
-    const t_pb_graph_edge* pb_edge = find_pb_graph_edge(clb, pb_route_idx);
+inline float ClbDelayCalc::pb_edge_delay(int type_index, int driver_pb_pin, int sink_pb_pin, DelayType delay_type) const {
+    const t_pb_graph_edge* pb_edge = find_pb_graph_edge(type_index, driver_pb_pin, sink_pb_pin);
 
-    if(pb_edge) {
-        if (delay_type == DelayType::MAX) {
-            return pb_edge->delay_max;
-        } else {
-            VTR_ASSERT(delay_type == DelayType::MIN);
-            return pb_edge->delay_min;
-        }
+    if (delay_type == DelayType::MAX) {
+        return pb_edge->delay_max;
     } else {
-        return 0.;
-    }
-}
-
-inline const t_pb_graph_edge* ClbDelayCalc::find_pb_graph_edge(ClusterBlockId clb, int pb_route_idx) const {
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-
-    int type_index = cluster_ctx.clb_nlist.block_type(clb)->index;
-
-    const t_pb* pb = cluster_ctx.clb_nlist.block_pb(clb);
-    if (pb->pb_route.count(pb_route_idx)) {
-        int upstream_pb_route_idx = pb->pb_route[pb_route_idx].driver_pb_pin_id;
-
-        if(upstream_pb_route_idx >= 0) {
-
-            const t_pb_graph_pin* pb_gpin = intra_lb_pb_pin_lookup_.pb_gpin(type_index, pb_route_idx);
-            const t_pb_graph_pin* upstream_pb_gpin = intra_lb_pb_pin_lookup_.pb_gpin(type_index, upstream_pb_route_idx);
-
-            return find_pb_graph_edge(upstream_pb_gpin, pb_gpin); 
-        }
+        VTR_ASSERT(delay_type == DelayType::MIN);
+        return pb_edge->delay_min;
     }
-
-    return nullptr;
 }
 
-inline const t_pb_graph_edge* ClbDelayCalc::find_pb_graph_edge(const t_pb_graph_pin* driver, const t_pb_graph_pin* sink) const {
-    VTR_ASSERT(driver);
-    VTR_ASSERT(sink);
-
-    const t_pb_graph_edge* pb_edge = nullptr;
-    for(int iedge = 0; iedge < driver->num_output_edges; ++iedge) {
-        const t_pb_graph_edge* check_edge = driver->output_edges[iedge];
-        VTR_ASSERT(check_edge);
+inline const t_pb_graph_edge* ClbDelayCalc::find_pb_graph_edge(int type_index, int driver_pb_pin, int sink_pb_pin) const {
+    VTR_ASSERT(size_t(type_index) < pb_edge_tables_.size());
+    const auto& type_table = pb_edge_tables_[type_index];
 
-        VTR_ASSERT(check_edge->num_output_pins == 1);
-        if(check_edge->output_pins[0] == sink) {
-            pb_edge = check_edge;
-        }
-
-    }
-    VTR_ASSERT_MSG(pb_edge, "Should find pb_graph_edge connecting PB pins");
+    uint64_t key = (uint64_t(driver_pb_pin) << 32) | uint64_t(sink_pb_pin);
+    auto itr = type_table.find(key);
+    VTR_ASSERT_MSG(itr != type_table.end(), "Should find pb_graph_edge connecting PB pins");
 
-    return pb_edge;
+    return itr->second;
 }
 
@@ -14,6 +14,20 @@ void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer);
 //NOTE: These classes should not be used directly but created with the
 //      make_*_timing_info() functions in timing_info.h, and used through
 //      their abstract interfaces (SetupTimingInfo, HoldTimingInfo etc.)
+//
+//Cost model: every update() performs a *full* STA. The bundled tatum
+//analyzers are explicitly non-incremental (see tatum/analyzers/Full*.hpp):
+//they reset and re-traverse the entire timing graph on each call, with no
+//way to invalidate individual edges and re-solve only the affected cones.
+//Making tatum incremental would require invalidation hooks through its
+//walker/visitor/analyzer stack and is out of scope here.  Consequently
+//callers should treat update() as O(timing graph) and amortize it:
+//  * Batch delay changes and update once, rather than per modification.
+//  * Between updates, refresh only the pins reported by
+//    pins_with_modified_setup_criticality() (as the placer's
+//    update_criticalities() does) instead of rescanning every pin.
+//  * Use recompute intervals (e.g. inner_loop_recompute_divider) to bound
+//    how often a full update runs inside tight optimization loops.
 
 template<class DelayCalc>
 class ConcreteSetupTimingInfo : public SetupTimingInfo {
@@ -73,6 +87,14 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         return slack_crit_.setup_pin_criticality(pin);
     }
 
+    const std::vector<AtomPinId>& pins_with_modified_setup_criticality() const override {
+        return slack_crit_.pins_with_modified_setup_criticality();
+    }
+
+    const std::vector<AtomPinId>& pins_with_modified_setup_slack() const override {
+        return slack_crit_.pins_with_modified_setup_slack();
+    }
+
     std::shared_ptr<const tatum::TimingAnalyzer> analyzer() const override {
         return setup_analyzer();
     }
@@ -288,6 +310,10 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     float setup_pin_slack(AtomPinId pin) const override { return setup_timing_.setup_pin_slack(pin); }
     float setup_pin_criticality(AtomPinId pin) const override { return setup_timing_.setup_pin_criticality(pin); }
 
+    const std::vector<AtomPinId>& pins_with_modified_setup_criticality() const override { return setup_timing_.pins_with_modified_setup_criticality(); }
+
+    const std::vector<AtomPinId>& pins_with_modified_setup_slack() const override { return setup_timing_.pins_with_modified_setup_slack(); }
+
     std::shared_ptr<const tatum::SetupTimingAnalyzer> setup_analyzer() const override { return setup_timing_.setup_analyzer(); }
 
     //Hold related
@@ -394,6 +420,18 @@ class ConstantTimingInfo : public SetupHoldTimingInfo {
         return criticality_;
     }
 
+    const std::vector<AtomPinId>& pins_with_modified_setup_criticality() const override {
+        //Criticalities are constant, so nothing is ever modified
+        static std::vector<AtomPinId> empty;
+        return empty;
+    }
+
+    const std::vector<AtomPinId>& pins_with_modified_setup_slack() const override {
+        //Slacks are constant, so nothing is ever modified
+        static std::vector<AtomPinId> empty;
+        return empty;
+    }
+
     std::shared_ptr<const tatum::SetupTimingAnalyzer> setup_analyzer() const override { return nullptr; }
 
     //Hold related
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdio>
 
 #include "vtr_memory.h"
@@ -41,9 +42,12 @@ static void load_one_constant_net_delay(vtr::vector<ClusterNetId, float*>& net_d
 
 /*************************** Subroutine definitions **************************/
 
-/* Allocates space for the net_delay data structure   *
- * [0..nets.size()-1][1..num_pins-1]. I chunk the data *
- * to save space on large problems.                    */
+/* Allocates space for the net_delay data structure        *
+ * [0..nets.size()-1][1..num_pins-1]. All the per-net sink  *
+ * arrays are carved from a single flat buffer so delays    *
+ * sit contiguously in net order (rather than scattered     *
+ * across many small chunk carvings), which is friendlier   *
+ * to the delay calculators that sweep over them.           */
 vtr::vector<ClusterNetId, float*> alloc_net_delay(vtr::t_chunk* chunk_list_ptr) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
     vtr::vector<ClusterNetId, float*> net_delay; /* [0..nets.size()-1][1..num_pins-1] */
@@ -51,15 +55,23 @@ vtr::vector<ClusterNetId, float*> alloc_net_delay(vtr::t_chunk* chunk_list_ptr)
     auto nets = cluster_ctx.clb_nlist.nets();
     net_delay.resize(nets.size());
 
+    size_t total_sinks = 0;
     for (auto net_id : nets) {
-        float* tmp_ptr = (float*)vtr::chunk_malloc(cluster_ctx.clb_nlist.net_sinks(net_id).size() * sizeof(float), chunk_list_ptr);
+        total_sinks += cluster_ctx.clb_nlist.net_sinks(net_id).size();
+    }
 
-        net_delay[net_id] = tmp_ptr - 1; /* [1..num_pins-1] */
+    //A single allocation backing every net's sink delays (a request this
+    //large gets its own dedicated block on the chunk free list)
+    float* flat_delays = (float*)vtr::chunk_malloc(total_sinks * sizeof(float), chunk_list_ptr);
 
-        //Ensure the net delays are initialized with non-garbage values
-        for (size_t ipin = 1; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ++ipin) {
-            net_delay[net_id][ipin] = std::numeric_limits<float>::quiet_NaN();
-        }
+    //Ensure the net delays are initialized with non-garbage values
+    std::fill_n(flat_delays, total_sinks, std::numeric_limits<float>::quiet_NaN());
+
+    size_t offset = 0;
+    for (auto net_id : nets) {
+        net_delay[net_id] = flat_delays + offset - 1; /* [1..num_pins-1] */
+
+        offset += cluster_ctx.clb_nlist.net_sinks(net_id).size();
     }
 
     return (net_delay);
@@ -1,6 +1,7 @@
 #include "read_sdc.h"
 
 #include <regex>
+#include <unordered_map>
 
 #include "vtr_log.h"
 #include "vtr_assert.h"
@@ -104,7 +105,7 @@ class SdcParseCallback : public sdcparse::Callback {
 
                 //We interpret each SDC target as glob-style pattern matches, which we
                 //convert to a regex
-                auto clock_name_regex = glob_pattern_to_regex(clock_name_glob_pattern);
+                const std::regex& clock_name_regex = glob_pattern_regex(clock_name_glob_pattern);
 
                 //Look for matching netlist clocks
                 for (AtomPinId clock_pin : netlist_clock_drivers_) {
@@ -863,25 +864,31 @@ class SdcParseCallback : public sdcparse::Callback {
 
         std::set<AtomPinId> pins;
         for (const auto& port_pattern : port_group.strings) {
-            std::regex port_regex = glob_pattern_to_regex(port_pattern);
-
-            bool found = false;
-            for (const auto& kv : netlist_primary_ios_) {
-                const std::string& io_name = kv.first;
-                if (std::regex_match(io_name, port_regex)) {
-                    found = true;
-
-                    AtomPinId pin = kv.second;
-
-                    pins.insert(pin);
+            //The set of primary I/Os is fixed once parsing starts, so a
+            //pattern's matches can be resolved once and re-used when the
+            //same pattern re-appears in later commands
+            auto cache_itr = port_match_cache_.find(port_pattern);
+            if (cache_itr == port_match_cache_.end()) {
+                const std::regex& port_regex = glob_pattern_regex(port_pattern);
+
+                std::set<AtomPinId> matched;
+                for (const auto& kv : netlist_primary_ios_) {
+                    const std::string& io_name = kv.first;
+                    if (std::regex_match(io_name, port_regex)) {
+                        matched.insert(kv.second);
+                    }
                 }
+
+                cache_itr = port_match_cache_.emplace(port_pattern, std::move(matched)).first;
             }
 
-            if (!found) {
+            if (cache_itr->second.empty()) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
                               "get_ports target name or pattern '%s' matched no ports\n",
                               port_pattern.c_str());
             }
+
+            pins.insert(cache_itr->second.begin(), cache_itr->second.end());
         }
         return pins;
     }
@@ -899,24 +906,36 @@ class SdcParseCallback : public sdcparse::Callback {
                       "Expected clock names or collection via get_clocks");
         }
 
-        for (const auto& clock_glob_pattern : clock_group.strings) {
-            std::regex clock_regex = glob_pattern_to_regex(clock_glob_pattern);
-
-            bool found = false;
-            for (tatum::DomainId domain : tc_.clock_domains()) {
-                const std::string& clock_name = tc_.clock_domain_name(domain);
-                if (std::regex_match(clock_name, clock_regex)) {
-                    found = true;
+        //create_clock commands add new domains, which invalidates any
+        //previously resolved pattern matches
+        if (tc_.clock_domains().size() != clock_match_cache_num_domains_) {
+            clock_match_cache_.clear();
+            clock_match_cache_num_domains_ = tc_.clock_domains().size();
+        }
 
-                    domains.insert(domain);
+        for (const auto& clock_glob_pattern : clock_group.strings) {
+            auto cache_itr = clock_match_cache_.find(clock_glob_pattern);
+            if (cache_itr == clock_match_cache_.end()) {
+                const std::regex& clock_regex = glob_pattern_regex(clock_glob_pattern);
+
+                std::set<tatum::DomainId> matched;
+                for (tatum::DomainId domain : tc_.clock_domains()) {
+                    const std::string& clock_name = tc_.clock_domain_name(domain);
+                    if (std::regex_match(clock_name, clock_regex)) {
+                        matched.insert(domain);
+                    }
                 }
+
+                cache_itr = clock_match_cache_.emplace(clock_glob_pattern, std::move(matched)).first;
             }
 
-            if (!found) {
+            if (cache_itr->second.empty()) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
                               "get_clocks target name or pattern '%s' matched no clocks\n",
                               clock_glob_pattern.c_str());
             }
+
+            domains.insert(cache_itr->second.begin(), cache_itr->second.end());
         }
 
         return domains;
@@ -935,24 +954,31 @@ class SdcParseCallback : public sdcparse::Callback {
         }
 
         for (const auto& pin_pattern : pin_group.strings) {
-            std::regex pin_regex = glob_pattern_to_regex(pin_pattern);
-
-            bool found = false;
-            for (AtomPinId pin : netlist_.pins()) {
-                const std::string& pin_name = netlist_.pin_name(pin);
-
-                if (std::regex_match(pin_name, pin_regex)) {
-                    found = true;
-
-                    pins.insert(pin);
+            //Scanning every netlist pin per pattern is expensive, so
+            //resolve each distinct pattern only once
+            auto cache_itr = pin_match_cache_.find(pin_pattern);
+            if (cache_itr == pin_match_cache_.end()) {
+                const std::regex& pin_regex = glob_pattern_regex(pin_pattern);
+
+                std::set<AtomPinId> matched;
+                for (AtomPinId pin : netlist_.pins()) {
+                    const std::string& pin_name = netlist_.pin_name(pin);
+
+                    if (std::regex_match(pin_name, pin_regex)) {
+                        matched.insert(pin);
+                    }
                 }
+
+                cache_itr = pin_match_cache_.emplace(pin_pattern, std::move(matched)).first;
             }
 
-            if (!found) {
+            if (cache_itr->second.empty()) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
                               "get_pins target name or pattern '%s' matched no pins\n",
                               pin_pattern.c_str());
             }
+
+            pins.insert(cache_itr->second.begin(), cache_itr->second.end());
         }
 
         return pins;
@@ -963,6 +989,16 @@ class SdcParseCallback : public sdcparse::Callback {
         return std::set<tatum::DomainId>(domains.begin(), domains.end());
     }
 
+    const std::regex& glob_pattern_regex(const std::string& glob_pattern) {
+        //Compiling a regex is comparatively expensive, so each distinct
+        //glob pattern is compiled only once and then re-used
+        auto itr = regex_cache_.find(glob_pattern);
+        if (itr == regex_cache_.end()) {
+            itr = regex_cache_.emplace(glob_pattern, glob_pattern_to_regex(glob_pattern)).first;
+        }
+        return itr->second;
+    }
+
     float sdc_units_to_seconds(float val) const {
         return val * unit_scale_;
     }
@@ -1019,6 +1055,15 @@ class SdcParseCallback : public sdcparse::Callback {
 
     std::map<std::tuple<tatum::DomainId, tatum::DomainId, AtomPinId>, int> setup_mcp_overrides_;
     std::map<std::tuple<tatum::DomainId, tatum::DomainId, AtomPinId>, int> hold_mcp_overrides_;
+
+    //Caches of compiled glob patterns and their resolved matches, so commands
+    //repeating the same pattern (common in large generated SDC files) do not
+    //re-compile the regex or re-scan every name
+    std::unordered_map<std::string, std::regex> regex_cache_;
+    std::unordered_map<std::string, std::set<AtomPinId>> port_match_cache_;
+    std::unordered_map<std::string, std::set<AtomPinId>> pin_match_cache_;
+    std::unordered_map<std::string, std::set<tatum::DomainId>> clock_match_cache_;
+    size_t clock_match_cache_num_domains_ = 0;
 };
 
 std::unique_ptr<tatum::TimingConstraints> read_sdc(const t_timing_inf& timing_inf,
@@ -18,7 +18,9 @@ SetupSlackCrit::SetupSlackCrit(const AtomNetlist& netlist, const AtomLookup& net
     : netlist_(netlist)
     , netlist_lookup_(netlist_lookup)
     , pin_slacks_(netlist_.pins().size(), NAN)
-    , pin_criticalities_(netlist_.pins().size(), NAN) {
+    , pin_criticalities_(netlist_.pins().size(), NAN)
+    , pin_criticality_modified_(netlist_.pins().size(), false)
+    , pin_slack_modified_(netlist_.pins().size(), false) {
     //pass
 }
 
@@ -30,6 +32,14 @@ float SetupSlackCrit::setup_pin_slack(AtomPinId pin) const { return pin_slacks_[
 //  0. is non-critical and 1. is most-critical.
 float SetupSlackCrit::setup_pin_criticality(AtomPinId pin) const { return pin_criticalities_[pin]; }
 
+const std::vector<AtomPinId>& SetupSlackCrit::pins_with_modified_setup_criticality() const {
+    return pins_with_modified_criticality_;
+}
+
+const std::vector<AtomPinId>& SetupSlackCrit::pins_with_modified_setup_slack() const {
+    return pins_with_modified_slack_;
+}
+
 void SetupSlackCrit::update_slacks_and_criticalities(const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& analyzer) {
 #if defined(VPR_USE_TBB)
     tbb::task_group g;
@@ -53,6 +63,16 @@ void SetupSlackCrit::update_slacks(const tatum::SetupTimingAnalyzer& analyzer) {
         update_pin_slack(pin, analyzer);
     }
 #endif
+
+    //Collect the pins whose slack actually changed, so incremental
+    //consumers need only refresh those
+    pins_with_modified_slack_.clear();
+    for (auto pin : pins) {
+        if (pin_slack_modified_[pin]) {
+            pins_with_modified_slack_.push_back(pin);
+            pin_slack_modified_[pin] = false;
+        }
+    }
 }
 
 void SetupSlackCrit::update_pin_slack(const AtomPinId pin, const tatum::SetupTimingAnalyzer& analyzer) {
@@ -61,13 +81,18 @@ void SetupSlackCrit::update_pin_slack(const AtomPinId pin, const tatum::SetupTim
     VTR_ASSERT(node);
 
     //Find the worst (least) slack at this node
+    float slack = std::numeric_limits<float>::infinity(); //No tags (e.g. driven by constant generator)
     auto tags = analyzer.setup_slacks(node);
     auto min_tag_iter = find_minimum_tag(tags);
     if (min_tag_iter != tags.end()) {
-        pin_slacks_[pin] = min_tag_iter->time().value();
-    } else {
-        //No tags (e.g. driven by constant generator)
-        pin_slacks_[pin] = std::numeric_limits<float>::infinity();
+        slack = min_tag_iter->time().value();
+    }
+
+    //Note that a NaN previous value (i.e. never yet calculated) always
+    //compares unequal, so all pins are marked modified by the first update
+    if (slack != pin_slacks_[pin]) {
+        pin_slacks_[pin] = slack;
+        pin_slack_modified_[pin] = true;
     }
 }
 
@@ -99,13 +124,37 @@ void SetupSlackCrit::update_criticalities(const tatum::TimingGraph& timing_graph
     auto pins = netlist_.pins();
 #if defined(VPR_USE_TBB)
     tbb::parallel_for_each(pins.begin(), pins.end(), [&, this](auto pin) {
-        this->pin_criticalities_[pin] = this->calc_pin_criticality(pin, analyzer, max_req, worst_slack);
+        this->update_pin_criticality(pin, analyzer, max_req, worst_slack);
     });
 #else
     for (auto pin : pins) {
-        pin_criticalities_[pin] = calc_pin_criticality(pin, analyzer, max_req, worst_slack);
+        update_pin_criticality(pin, analyzer, max_req, worst_slack);
     }
 #endif
+
+    //Collect the pins whose criticality actually changed, so incremental
+    //consumers (e.g. the timing driven placer) need only refresh those
+    pins_with_modified_criticality_.clear();
+    for (auto pin : pins) {
+        if (pin_criticality_modified_[pin]) {
+            pins_with_modified_criticality_.push_back(pin);
+            pin_criticality_modified_[pin] = false;
+        }
+    }
+}
+
+void SetupSlackCrit::update_pin_criticality(const AtomPinId pin,
+                                            const tatum::SetupTimingAnalyzer& analyzer,
+                                            const std::map<DomainPair, float>& max_req,
+                                            const std::map<DomainPair, float>& worst_slack) {
+    float criticality = calc_pin_criticality(pin, analyzer, max_req, worst_slack);
+
+    //Note that a NaN previous value (i.e. never yet calculated) always
+    //compares unequal, so all pins are marked modified by the first update
+    if (criticality != pin_criticalities_[pin]) {
+        pin_criticalities_[pin] = criticality;
+        pin_criticality_modified_[pin] = true;
+    }
 }
 
 float SetupSlackCrit::calc_pin_criticality(AtomPinId pin,
@@ -19,6 +19,15 @@ class SetupSlackCrit {
     //  0. is non-critical and 1. is most-critical.
     float setup_pin_criticality(AtomPinId pin) const;
 
+    //Returns the set of pins whose criticality was changed by the last call
+    //to update_slacks_and_criticalities() (i.e. the pins whose cached
+    //criticality values are stale in any data structure derived from them)
+    const std::vector<AtomPinId>& pins_with_modified_setup_criticality() const;
+
+    //Returns the set of pins whose worst slack was changed by the last call
+    //to update_slacks_and_criticalities()
+    const std::vector<AtomPinId>& pins_with_modified_setup_slack() const;
+
   public: //Mutators
     void update_slacks_and_criticalities(const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& analyzer);
 
@@ -29,6 +38,11 @@ class SetupSlackCrit {
 
     void update_criticalities(const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& analyzer);
 
+    void update_pin_criticality(const AtomPinId pin,
+                                const tatum::SetupTimingAnalyzer& analyzer,
+                                const std::map<DomainPair, float>& max_req,
+                                const std::map<DomainPair, float>& worst_slack);
+
     float calc_pin_criticality(AtomPinId pin,
                                const tatum::SetupTimingAnalyzer& analyzer,
                                const std::map<DomainPair, float>& max_req,
@@ -40,6 +54,14 @@ class SetupSlackCrit {
 
     vtr::vector<AtomPinId, float> pin_slacks_;
     vtr::vector<AtomPinId, float> pin_criticalities_;
+
+    //Per-pin flags marking slacks/criticalities changed by the current update.
+    //Note these are char (not bool) so concurrent writes to different
+    //elements are safe when the update is parallelized with TBB.
+    vtr::vector<AtomPinId, char> pin_criticality_modified_;
+    vtr::vector<AtomPinId, char> pin_slack_modified_;
+    std::vector<AtomPinId> pins_with_modified_criticality_;
+    std::vector<AtomPinId> pins_with_modified_slack_;
 };
 
 //TODO: implement a HoldSlackCrit class for hold analysis
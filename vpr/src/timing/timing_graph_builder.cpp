@@ -2,6 +2,7 @@
 
 #include "vtr_log.h"
 #include "vtr_linear_map.h"
+#include "vtr_memory.h"
 
 #include "timing_graph_builder.h"
 #include "vpr_error.h"
@@ -57,6 +58,20 @@ void TimingGraphBuilder::build(bool allow_dangling_combinational_nodes) {
     // Set by `--allow_dangling_combinational_nodes on`. Default value is false
     tg_->set_allow_dangling_combinational_nodes(allow_dangling_combinational_nodes);
 
+    //Pre-size the graph's flat storage from netlist statistics to avoid
+    //repeated re-allocation while nodes/edges are appended below.  Each
+    //netlist pin becomes one timing node (sequential pins add an extra
+    //internal SOURCE/SINK, bounded by two per block).  Edges consist of
+    //net connections (at most one per pin) plus primitive-internal edges
+    //(roughly one per primitive input pin), so two edges per pin is a
+    //reasonable estimate.  These are hints only: under- or over-estimates
+    //affect only transient memory behaviour, and the final layout is
+    //compacted by opt_memory_layout() in any case.
+    size_t est_nodes = netlist_.pins().size() + 2 * netlist_.blocks().size();
+    size_t est_edges = 2 * netlist_.pins().size();
+    tg_->reserve_nodes(est_nodes);
+    tg_->reserve_edges(est_edges);
+
     for (AtomBlockId blk : netlist_.blocks()) {
         AtomBlockType blk_type = netlist_.block_type(blk);
 
@@ -76,9 +91,25 @@ void TimingGraphBuilder::build(bool allow_dangling_combinational_nodes) {
     fix_comb_loops();
 
     tg_->levelize();
+
+    //Attribute the timing graph's storage for per-subsystem memory
+    //accounting. tatum does not expose its footprint, so this is an
+    //estimate from its flat storage layout: per-node id/type and in/out
+    //adjacency vectors, per-edge id/type/endpoints and the two adjacency
+    //entries referencing it.
+    size_t node_bytes = sizeof(tatum::NodeId) + sizeof(tatum::NodeType) + 2 * sizeof(std::vector<tatum::EdgeId>);
+    size_t edge_bytes = 2 * sizeof(tatum::EdgeId) + sizeof(tatum::EdgeType) + 2 * sizeof(tatum::NodeId) + 2 * sizeof(tatum::EdgeId);
+    vtr::memory_usage::report("timing_graph",
+                              tg_->nodes().size() * node_bytes + tg_->edges().size() * edge_bytes);
 }
 
 void TimingGraphBuilder::opt_memory_layout() {
+    //Renumber the graph's nodes into level-major contiguous order (and its
+    //edges to match the arrival-time traversal order). Nodes are created in
+    //netlist traversal order above, which scatters each level's nodes through
+    //the arrival/required arrays; the remap turns the analyzers' levelized
+    //sweeps into sequential memory accesses. The VPR-side pin<->tnode
+    //mappings in AtomLookup are updated to the new ids.
     auto id_map = tg_->optimize_layout();
 
     remap_ids(id_map);
@@ -421,13 +452,16 @@ tatum::EdgeId TimingGraphBuilder::find_scc_edge_to_break(std::vector<tatum::Node
 
 void TimingGraphBuilder::remap_ids(const tatum::GraphIdMaps& id_mapping) {
     //Update the pin-tnode mapping
-    vtr::linear_map<tatum::NodeId, AtomPinId> new_tnode_atom_pin;
-    for (auto kv : netlist_lookup_.tnode_atom_pins()) {
-        tatum::NodeId old_tnode = kv.first;
-        AtomPinId pin = kv.second;
+    const auto& tnode_atom_pin = netlist_lookup_.tnode_atom_pins();
+    std::vector<std::pair<tatum::NodeId, AtomPinId>> new_tnode_atom_pin;
+    new_tnode_atom_pin.reserve(tnode_atom_pin.size());
+    for (size_t itnode = 0; itnode < tnode_atom_pin.size(); ++itnode) {
+        tatum::NodeId old_tnode(itnode);
+        AtomPinId pin = tnode_atom_pin[old_tnode];
+        if (!pin) continue; //Gap in the tnode id space
         tatum::NodeId new_tnode = id_mapping.node_id_map[old_tnode];
 
-        new_tnode_atom_pin.emplace(new_tnode, pin);
+        new_tnode_atom_pin.emplace_back(new_tnode, pin);
     }
 
     for (auto kv : new_tnode_atom_pin) {
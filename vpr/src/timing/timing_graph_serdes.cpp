@@ -0,0 +1,320 @@
+#include "timing_graph_serdes.h"
+
+#include "vtr_assert.h"
+#include "vpr_error.h"
+
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "timing_graph.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+//
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                              \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+void write_timing_graph_snapshot(const std::string& /*file*/,
+                                 const tatum::TimingGraph& /*tg*/,
+                                 const tatum::TimingConstraints& /*tc*/,
+                                 const tatum::DelayCalculator& /*dc*/) {
+    VPR_THROW(VPR_ERROR_TIMING, "write_timing_graph_snapshot " DISABLE_ERROR);
+}
+
+TimingGraphSnapshot read_timing_graph_snapshot(const std::string& /*file*/) {
+    VPR_THROW(VPR_ERROR_TIMING, "read_timing_graph_snapshot " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+//tatum ids are serialized as their raw index, with -1 encoding an invalid id
+template<typename Id>
+static int32_t to_raw_id(Id id) {
+    return id ? static_cast<int32_t>(size_t(id)) : -1;
+}
+
+void write_timing_graph_snapshot(const std::string& file,
+                                 const tatum::TimingGraph& tg,
+                                 const tatum::TimingConstraints& tc,
+                                 const tatum::DelayCalculator& dc) {
+    ::capnp::MallocMessageBuilder builder;
+    auto snapshot = builder.initRoot<VprTimingSnapshot>();
+
+    size_t num_edges = tg.edges().size();
+
+    //Timing graph
+    auto graph = snapshot.initGraph();
+
+    auto node_types = graph.initNodeTypes(tg.nodes().size());
+    for (tatum::NodeId node : tg.nodes()) {
+        node_types.set(size_t(node), static_cast<int8_t>(tg.node_type(node)));
+    }
+
+    auto edge_types = graph.initEdgeTypes(num_edges);
+    auto edge_src_nodes = graph.initEdgeSrcNodes(num_edges);
+    auto edge_sink_nodes = graph.initEdgeSinkNodes(num_edges);
+    auto edges_disabled = graph.initEdgesDisabled(num_edges);
+    for (tatum::EdgeId edge : tg.edges()) {
+        size_t iedge = size_t(edge);
+        edge_types.set(iedge, static_cast<int8_t>(tg.edge_type(edge)));
+        edge_src_nodes.set(iedge, to_raw_id(tg.edge_src_node(edge)));
+        edge_sink_nodes.set(iedge, to_raw_id(tg.edge_sink_node(edge)));
+        edges_disabled.set(iedge, tg.edge_disabled(edge));
+    }
+
+    //Timing constraints
+    auto constraints = snapshot.initConstraints();
+
+    auto domain_list = constraints.initClockDomains(tc.clock_domains().size());
+    for (tatum::DomainId domain : tc.clock_domains()) {
+        auto entry = domain_list[size_t(domain)];
+        entry.setName(tc.clock_domain_name(domain).c_str());
+        entry.setSourceNode(to_raw_id(tc.clock_domain_source_node(domain)));
+    }
+
+    {
+        auto const_gens = constraints.initConstantGenerators(tc.constant_generators().size());
+        size_t i = 0;
+        for (tatum::NodeId node : tc.constant_generators()) {
+            const_gens.set(i++, to_raw_id(node));
+        }
+    }
+
+    auto build_clock_constraints = [](::capnp::List<VprClockConstraint>::Builder out,
+                                      tatum::TimingConstraints::clock_constraint_range in) {
+        size_t i = 0;
+        for (const auto& kv : in) {
+            auto entry = out[i++];
+            entry.setLaunchDomain(to_raw_id(kv.first.domain_pair.src_domain_id));
+            entry.setCaptureDomain(to_raw_id(kv.first.domain_pair.sink_domain_id));
+            entry.setCaptureNode(to_raw_id(kv.first.capture_node));
+            entry.setConstraint(kv.second.value());
+        }
+    };
+    build_clock_constraints(constraints.initSetupConstraints(tc.setup_constraints().size()), tc.setup_constraints());
+    build_clock_constraints(constraints.initHoldConstraints(tc.hold_constraints().size()), tc.hold_constraints());
+
+    auto build_uncertainties = [](::capnp::List<VprClockUncertainty>::Builder out,
+                                  tatum::TimingConstraints::clock_uncertainty_range in) {
+        size_t i = 0;
+        for (const auto& kv : in) {
+            auto entry = out[i++];
+            entry.setLaunchDomain(to_raw_id(kv.first.src_domain_id));
+            entry.setCaptureDomain(to_raw_id(kv.first.sink_domain_id));
+            entry.setUncertainty(kv.second.value());
+        }
+    };
+    build_uncertainties(constraints.initSetupUncertainties(tc.setup_clock_uncertainties().size()), tc.setup_clock_uncertainties());
+    build_uncertainties(constraints.initHoldUncertainties(tc.hold_clock_uncertainties().size()), tc.hold_clock_uncertainties());
+
+    auto build_io_constraints = [](::capnp::List<VprIoConstraint>::Builder out,
+                                   tatum::TimingConstraints::io_constraint_range in) {
+        size_t i = 0;
+        for (const auto& kv : in) {
+            auto entry = out[i++];
+            entry.setNode(to_raw_id(kv.first));
+            entry.setDomain(to_raw_id(kv.second.domain));
+            entry.setConstraint(kv.second.constraint.value());
+        }
+    };
+    build_io_constraints(constraints.initMaxInputConstraints(tc.input_constraints(tatum::DelayType::MAX).size()),
+                         tc.input_constraints(tatum::DelayType::MAX));
+    build_io_constraints(constraints.initMinInputConstraints(tc.input_constraints(tatum::DelayType::MIN).size()),
+                         tc.input_constraints(tatum::DelayType::MIN));
+    build_io_constraints(constraints.initMaxOutputConstraints(tc.output_constraints(tatum::DelayType::MAX).size()),
+                         tc.output_constraints(tatum::DelayType::MAX));
+    build_io_constraints(constraints.initMinOutputConstraints(tc.output_constraints(tatum::DelayType::MIN).size()),
+                         tc.output_constraints(tatum::DelayType::MIN));
+
+    auto build_latencies = [](::capnp::List<VprSourceLatency>::Builder out,
+                              tatum::TimingConstraints::source_latency_range in) {
+        size_t i = 0;
+        for (const auto& kv : in) {
+            auto entry = out[i++];
+            entry.setDomain(to_raw_id(kv.first));
+            entry.setLatency(kv.second.value());
+        }
+    };
+    build_latencies(constraints.initEarlySourceLatencies(tc.source_latencies(tatum::ArrivalType::EARLY).size()),
+                    tc.source_latencies(tatum::ArrivalType::EARLY));
+    build_latencies(constraints.initLateSourceLatencies(tc.source_latencies(tatum::ArrivalType::LATE).size()),
+                    tc.source_latencies(tatum::ArrivalType::LATE));
+
+    //Edge delays, sampled from the supplied delay calculator.
+    //
+    //Following tatum's convention (cf. echo_writer.cpp) sequential capture
+    //edges carry setup/hold times, all other edges min/max delays
+    auto delays = snapshot.initDelays();
+    auto max_delays = delays.initMaxEdgeDelays(num_edges);
+    auto min_delays = delays.initMinEdgeDelays(num_edges);
+    auto setup_times = delays.initSetupTimes(num_edges);
+    auto hold_times = delays.initHoldTimes(num_edges);
+    for (tatum::EdgeId edge : tg.edges()) {
+        size_t iedge = size_t(edge);
+        tatum::NodeId src_node = tg.edge_src_node(edge);
+        tatum::NodeId sink_node = tg.edge_sink_node(edge);
+
+        if (tg.node_type(src_node) == tatum::NodeType::CPIN && tg.node_type(sink_node) == tatum::NodeType::SINK) {
+            setup_times.set(iedge, dc.setup_time(tg, edge).value());
+            hold_times.set(iedge, dc.hold_time(tg, edge).value());
+        } else {
+            max_delays.set(iedge, dc.max_edge_delay(tg, edge).value());
+            min_delays.set(iedge, dc.min_edge_delay(tg, edge).value());
+        }
+    }
+
+    writeMessageToFile(file, &builder);
+}
+
+TimingGraphSnapshot read_timing_graph_snapshot(const std::string& file) {
+    MmapFile f(file);
+    ::capnp::FlatArrayMessageReader reader(f.getData());
+    auto snapshot = reader.getRoot<VprTimingSnapshot>();
+
+    TimingGraphSnapshot result;
+
+    //Timing graph
+    result.graph = std::make_unique<tatum::TimingGraph>();
+    tatum::TimingGraph& tg = *result.graph;
+
+    auto graph = snapshot.getGraph();
+    auto node_types = graph.getNodeTypes();
+    auto edge_types = graph.getEdgeTypes();
+    auto edge_src_nodes = graph.getEdgeSrcNodes();
+    auto edge_sink_nodes = graph.getEdgeSinkNodes();
+    auto edges_disabled = graph.getEdgesDisabled();
+
+    if (edge_src_nodes.size() != edge_types.size() || edge_sink_nodes.size() != edge_types.size()
+        || edges_disabled.size() != edge_types.size()) {
+        VPR_THROW(VPR_ERROR_TIMING, "Mismatched edge list lengths in timing snapshot '%s'", file.c_str());
+    }
+
+    tg.reserve_nodes(node_types.size());
+    for (size_t inode = 0; inode < node_types.size(); ++inode) {
+        tatum::NodeId node = tg.add_node(static_cast<tatum::NodeType>(node_types[inode]));
+        VTR_ASSERT_SAFE(size_t(node) == inode);
+    }
+
+    tg.reserve_edges(edge_types.size());
+    for (size_t iedge = 0; iedge < edge_types.size(); ++iedge) {
+        tatum::EdgeId edge = tg.add_edge(static_cast<tatum::EdgeType>(edge_types[iedge]),
+                                         tatum::NodeId(edge_src_nodes[iedge]),
+                                         tatum::NodeId(edge_sink_nodes[iedge]));
+        VTR_ASSERT_SAFE(size_t(edge) == iedge);
+        if (edges_disabled[iedge]) {
+            tg.disable_edge(edge);
+        }
+    }
+
+    //Timing constraints
+    result.constraints = std::make_unique<tatum::TimingConstraints>();
+    tatum::TimingConstraints& tc = *result.constraints;
+
+    auto constraints = snapshot.getConstraints();
+
+    //Domains are serialized in id order, so re-creating them in sequence
+    //reproduces the original DomainIds
+    for (auto domain_entry : constraints.getClockDomains()) {
+        tatum::DomainId domain = tc.create_clock_domain(domain_entry.getName().cStr());
+        int32_t source_node = domain_entry.getSourceNode();
+        if (source_node >= 0) {
+            tc.set_clock_domain_source(tatum::NodeId(source_node), domain);
+        }
+    }
+
+    for (int32_t node : constraints.getConstantGenerators()) {
+        tc.set_constant_generator(tatum::NodeId(node));
+    }
+
+    for (auto entry : constraints.getSetupConstraints()) {
+        tatum::DomainId launch(entry.getLaunchDomain());
+        tatum::DomainId capture(entry.getCaptureDomain());
+        int32_t capture_node = entry.getCaptureNode();
+        if (capture_node >= 0) {
+            tc.set_setup_constraint(launch, capture, tatum::NodeId(capture_node), tatum::Time(entry.getConstraint()));
+        } else {
+            tc.set_setup_constraint(launch, capture, tatum::Time(entry.getConstraint()));
+        }
+    }
+    for (auto entry : constraints.getHoldConstraints()) {
+        tatum::DomainId launch(entry.getLaunchDomain());
+        tatum::DomainId capture(entry.getCaptureDomain());
+        int32_t capture_node = entry.getCaptureNode();
+        if (capture_node >= 0) {
+            tc.set_hold_constraint(launch, capture, tatum::NodeId(capture_node), tatum::Time(entry.getConstraint()));
+        } else {
+            tc.set_hold_constraint(launch, capture, tatum::Time(entry.getConstraint()));
+        }
+    }
+
+    for (auto entry : constraints.getSetupUncertainties()) {
+        tc.set_setup_clock_uncertainty(tatum::DomainId(entry.getLaunchDomain()),
+                                       tatum::DomainId(entry.getCaptureDomain()),
+                                       tatum::Time(entry.getUncertainty()));
+    }
+    for (auto entry : constraints.getHoldUncertainties()) {
+        tc.set_hold_clock_uncertainty(tatum::DomainId(entry.getLaunchDomain()),
+                                      tatum::DomainId(entry.getCaptureDomain()),
+                                      tatum::Time(entry.getUncertainty()));
+    }
+
+    for (auto entry : constraints.getMaxInputConstraints()) {
+        tc.set_input_constraint(tatum::NodeId(entry.getNode()), tatum::DomainId(entry.getDomain()),
+                                tatum::DelayType::MAX, tatum::Time(entry.getConstraint()));
+    }
+    for (auto entry : constraints.getMinInputConstraints()) {
+        tc.set_input_constraint(tatum::NodeId(entry.getNode()), tatum::DomainId(entry.getDomain()),
+                                tatum::DelayType::MIN, tatum::Time(entry.getConstraint()));
+    }
+    for (auto entry : constraints.getMaxOutputConstraints()) {
+        tc.set_output_constraint(tatum::NodeId(entry.getNode()), tatum::DomainId(entry.getDomain()),
+                                 tatum::DelayType::MAX, tatum::Time(entry.getConstraint()));
+    }
+    for (auto entry : constraints.getMinOutputConstraints()) {
+        tc.set_output_constraint(tatum::NodeId(entry.getNode()), tatum::DomainId(entry.getDomain()),
+                                 tatum::DelayType::MIN, tatum::Time(entry.getConstraint()));
+    }
+
+    for (auto entry : constraints.getEarlySourceLatencies()) {
+        tc.set_source_latency(tatum::DomainId(entry.getDomain()), tatum::ArrivalType::EARLY, tatum::Time(entry.getLatency()));
+    }
+    for (auto entry : constraints.getLateSourceLatencies()) {
+        tc.set_source_latency(tatum::DomainId(entry.getDomain()), tatum::ArrivalType::LATE, tatum::Time(entry.getLatency()));
+    }
+
+    //Edge delays
+    auto delays = snapshot.getDelays();
+    auto max_delay_list = delays.getMaxEdgeDelays();
+    auto min_delay_list = delays.getMinEdgeDelays();
+    auto setup_time_list = delays.getSetupTimes();
+    auto hold_time_list = delays.getHoldTimes();
+
+    if (max_delay_list.size() != edge_types.size() || min_delay_list.size() != edge_types.size()
+        || setup_time_list.size() != edge_types.size() || hold_time_list.size() != edge_types.size()) {
+        VPR_THROW(VPR_ERROR_TIMING, "Mismatched delay list lengths in timing snapshot '%s'", file.c_str());
+    }
+
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> max_delays(edge_types.size());
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> min_delays(edge_types.size());
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> setup_times(edge_types.size());
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> hold_times(edge_types.size());
+    for (size_t iedge = 0; iedge < edge_types.size(); ++iedge) {
+        tatum::EdgeId edge(iedge);
+        max_delays[edge] = tatum::Time(max_delay_list[iedge]);
+        min_delays[edge] = tatum::Time(min_delay_list[iedge]);
+        setup_times[edge] = tatum::Time(setup_time_list[iedge]);
+        hold_times[edge] = tatum::Time(hold_time_list[iedge]);
+    }
+
+    result.delay_calculator = std::make_unique<tatum::FixedDelayCalculator>(max_delays, setup_times, min_delays, hold_times);
+
+    return result;
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
@@ -0,0 +1,35 @@
+#ifndef VPR_TIMING_GRAPH_SERDES_H
+#define VPR_TIMING_GRAPH_SERDES_H
+#include <memory>
+#include <string>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+#include "tatum/delay_calc/FixedDelayCalculator.hpp"
+
+//In-memory form of a binary timing snapshot (see timing_graph.capnp)
+//
+//The delay calculator is a FixedDelayCalculator regardless of which
+//calculator the snapshot was captured from, since only the sampled
+//per-edge delays are stored.
+struct TimingGraphSnapshot {
+    std::unique_ptr<tatum::TimingGraph> graph;
+    std::unique_ptr<tatum::TimingConstraints> constraints;
+    std::unique_ptr<tatum::FixedDelayCalculator> delay_calculator;
+};
+
+//Writes a compact binary snapshot of the timing graph, timing constraints
+//and per-edge delays to the specified file.
+//
+//The delays are sampled from the supplied delay calculator, so any
+//DelayCalculator implementation can be captured.
+void write_timing_graph_snapshot(const std::string& file,
+                                 const tatum::TimingGraph& tg,
+                                 const tatum::TimingConstraints& tc,
+                                 const tatum::DelayCalculator& dc);
+
+//Loads a binary timing snapshot previously written by write_timing_graph_snapshot()
+TimingGraphSnapshot read_timing_graph_snapshot(const std::string& file);
+
+#endif
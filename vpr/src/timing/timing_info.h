@@ -1,6 +1,7 @@
 #ifndef VPR_TIMING_INFO_H
 #define VPR_TIMING_INFO_H
 #include <memory>
+#include <vector>
 
 #include "timing_info_fwd.h"
 #include "tatum/analyzer_factory.hpp"
@@ -83,6 +84,14 @@ class SetupTimingInfo : public virtual TimingInfo {
     //Return the setup criticality of the worst connection passing through pin
     virtual float setup_pin_criticality(AtomPinId pin) const = 0;
 
+    //Return the set of pins whose setup criticality changed during the last
+    //timing update (useful for incrementally refreshing derived data)
+    virtual const std::vector<AtomPinId>& pins_with_modified_setup_criticality() const = 0;
+
+    //Return the set of pins whose setup slack changed during the last
+    //timing update (useful for incrementally refreshing derived data)
+    virtual const std::vector<AtomPinId>& pins_with_modified_setup_slack() const = 0;
+
     //Return the underlying timing analyzer
     virtual std::shared_ptr<const tatum::SetupTimingAnalyzer> setup_analyzer() const = 0;
 
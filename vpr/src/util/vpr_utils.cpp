@@ -138,19 +138,14 @@ void sync_grid_to_blocks() {
     auto& device_ctx = g_vpr_ctx.device();
     auto& device_grid = device_ctx.grid;
 
-    /* Reset usage and allocate blocks list if needed */
-    auto& grid_blocks = place_ctx.grid_blocks;
-    grid_blocks.resize({device_grid.width(), device_grid.height()});
-    for (size_t x = 0; x < device_grid.width(); ++x) {
-        for (size_t y = 0; y < device_grid.height(); ++y) {
-            auto& grid_block = grid_blocks[x][y];
-            grid_block.blocks.resize(device_ctx.grid[x][y].type->capacity);
-
-            for (int z = 0; z < device_ctx.grid[x][y].type->capacity; ++z) {
-                grid_block.blocks[z] = EMPTY_BLOCK_ID;
-            }
+    /* Reset usage and allocate the flat occupancy storage if needed */
+    size_t max_capacity = 0;
+    for (const auto& tile_type : device_ctx.physical_tile_types) {
+        if (size_t(tile_type.capacity) > max_capacity) {
+            max_capacity = size_t(tile_type.capacity);
         }
     }
+    place_ctx.grid_blocks.init_grid(device_grid.width(), device_grid.height(), max_capacity);
 
     /* Go through each block */
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -179,8 +174,8 @@ void sync_grid_to_blocks() {
         }
 
         /* Check already in use */
-        if ((EMPTY_BLOCK_ID != place_ctx.grid_blocks[blk_x][blk_y].blocks[blk_z])
-            && (INVALID_BLOCK_ID != place_ctx.grid_blocks[blk_x][blk_y].blocks[blk_z])) {
+        if ((EMPTY_BLOCK_ID != place_ctx.grid_blocks.block_at_location(blk_x, blk_y, blk_z))
+            && (INVALID_BLOCK_ID != place_ctx.grid_blocks.block_at_location(blk_x, blk_y, blk_z))) {
             VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Location (%d, %d, %d) is used more than once.\n",
                             blk_x, blk_y, blk_z);
         }
@@ -193,8 +188,7 @@ void sync_grid_to_blocks() {
         /* Set the block */
         for (int width = 0; width < type->width; ++width) {
             for (int height = 0; height < type->height; ++height) {
-                place_ctx.grid_blocks[blk_x + width][blk_y + height].blocks[blk_z] = blk_id;
-                place_ctx.grid_blocks[blk_x + width][blk_y + height].usage++;
+                place_ctx.grid_blocks.set_block_at_location(blk_x + width, blk_y + height, blk_z, blk_id);
                 VTR_ASSERT(device_ctx.grid[blk_x + width][blk_y + height].width_offset == width);
                 VTR_ASSERT(device_ctx.grid[blk_x + width][blk_y + height].height_offset == height);
             }
@@ -1538,6 +1532,22 @@ void revalid_molecules(const t_pb* pb, const std::multimap<AtomBlockId, t_pack_m
     }
 }
 
+/* Pool of t_pb_stats objects recycled across the packer's speculative
+ * try/fail/revert molecule attempts.  Returning objects here instead of
+ * deleting them preserves the heap capacity of their gain stores and marker
+ * vectors, so tearing down and rebuilding the same pb locations does not
+ * repeatedly hit the allocator. */
+static std::vector<t_pb_stats*> f_pb_stats_pool;
+
+t_pb_stats* alloc_pb_stats() {
+    if (!f_pb_stats_pool.empty()) {
+        t_pb_stats* pb_stats = f_pb_stats_pool.back();
+        f_pb_stats_pool.pop_back();
+        return pb_stats;
+    }
+    return new t_pb_stats;
+}
+
 void free_pb_stats(t_pb* pb) {
     if (pb) {
         if (pb->pb_stats == nullptr) {
@@ -1550,18 +1560,31 @@ void free_pb_stats(t_pb* pb) {
         pb->pb_stats->hillgain.clear();
         pb->pb_stats->connectiongain.clear();
         pb->pb_stats->num_pins_of_net_in_pb.clear();
+        pb->pb_stats->marked_nets.clear();
+        pb->pb_stats->marked_blocks.clear();
+        pb->pb_stats->input_pins_used.clear();
+        pb->pb_stats->output_pins_used.clear();
+        pb->pb_stats->lookahead_input_pins_used.clear();
+        pb->pb_stats->lookahead_output_pins_used.clear();
+        pb->pb_stats->transitive_fanout_candidates.clear();
 
         if (pb->pb_stats->feasible_blocks) {
             free(pb->pb_stats->feasible_blocks);
+            pb->pb_stats->feasible_blocks = nullptr;
         }
-        if (!pb->parent_pb) {
-            pb->pb_stats->transitive_fanout_candidates.clear();
-        }
-        delete pb->pb_stats;
+        f_pb_stats_pool.push_back(pb->pb_stats);
         pb->pb_stats = nullptr;
     }
 }
 
+void free_pb_stats_pool() {
+    for (t_pb_stats* pb_stats : f_pb_stats_pool) {
+        delete pb_stats;
+    }
+    f_pb_stats_pool.clear();
+    f_pb_stats_pool.shrink_to_fit();
+}
+
 /***************************************************************************************
  * Y.G.THIEN
  * 29 AUG 2012
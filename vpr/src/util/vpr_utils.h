@@ -158,7 +158,9 @@ void alloc_and_load_idirect_from_blk_pin(t_direct_inf* directs, int num_directs,
 
 void parse_direct_pin_name(char* src_string, int line, int* start_pin_index, int* end_pin_index, char* pb_type_name, char* port_name);
 
+t_pb_stats* alloc_pb_stats();
 void free_pb_stats(t_pb* pb);
+void free_pb_stats_pool();
 void free_pb(t_pb* pb);
 void revalid_molecules(const t_pb* pb, const std::multimap<AtomBlockId, t_pack_molecule*>& atom_molecules);
 
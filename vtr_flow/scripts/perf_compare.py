@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""
+Performance regression comparison between two VTR builds.
+
+Runs a task's circuit/architecture matrix a controlled number of times under
+two source trees (build A = baseline, build B = test), collects the run-time
+and memory metrics the flow already parses (pack_time, place_time, route
+times, vtr_flow_elapsed_time, max_vpr_mem, ...), and reports a per-benchmark
+A/B comparison with a noise-aware significance check (Welch's t-test), in
+both a human-readable table and machine-readable JSON.
+
+The QoR checks in run_reg_test.pl treat runtime as incidental; this tool is
+the complement: it only looks at runtime/memory, and it insists on repeated
+samples so a reported delta can be distinguished from run-to-run noise.
+
+Typical usage, letting the tool drive the flow:
+
+    perf_compare.py --run-task regression_mcnc \\
+                    --a-root /path/to/baseline/vtr --b-root /path/to/test/vtr \\
+                    --repetitions 5 --json cmp.json
+
+or against already-collected results (one parse_results.txt per repetition):
+
+    perf_compare.py --a runA_*/parse_results.txt --b runB_*/parse_results.txt
+
+Each parse_results.txt is the tab-separated file produced by
+parse_vtr_task.pl (keyed by arch/circuit/script_params).
+"""
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+
+# Run-time/memory metrics compared by default (matching the names used by
+# vtr_flow/parse/parse_config and qor_compare.py). Metrics missing from a
+# given task's parse results are silently skipped.
+DEFAULT_METRICS = [
+    "odin_synth_time",
+    "abc_synth_time",
+    "pack_time",
+    "place_time",
+    "min_chan_width_route_time",
+    "crit_path_route_time",
+    "route_time",
+    "vtr_flow_elapsed_time",
+    "max_odin_mem",
+    "max_abc_mem",
+    "max_vpr_mem",
+]
+
+# Keys identifying one benchmark point within a task
+BENCH_KEYS = ["arch", "circuit", "script_params"]
+
+# Two-sided 5% critical values of Student's t distribution, indexed by
+# degrees of freedom (df 1..30; the normal approximation is used beyond)
+T_CRIT_05 = [
+    float("inf"),
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+]
+
+
+def t_critical(df):
+    idf = int(math.floor(df))
+    if idf < 1:
+        return float("inf")
+    if idf < len(T_CRIT_05):
+        return T_CRIT_05[idf]
+    return 1.96
+
+
+def mean(samples):
+    return sum(samples) / len(samples)
+
+
+def stddev(samples, sample_mean):
+    if len(samples) < 2:
+        return 0.0
+    sq_dev_sum = sum((x - sample_mean) ** 2 for x in samples)
+    return math.sqrt(sq_dev_sum / (len(samples) - 1))  # Bessel-corrected
+
+
+def welch_t_test(a, b):
+    """Welch's unequal-variance t-test.
+
+    Returns (t, df, significant) where 'significant' is whether the A/B
+    means differ at the 5% level. With fewer than two samples per side, or
+    zero variance on both sides, no significance can be established unless
+    the means are exactly unequal with zero variance.
+    """
+    mean_a = mean(a)
+    mean_b = mean(b)
+    if len(a) < 2 or len(b) < 2:
+        return (None, None, False)
+
+    var_a = stddev(a, mean_a) ** 2
+    var_b = stddev(b, mean_b) ** 2
+    se_sq = var_a / len(a) + var_b / len(b)
+    if se_sq == 0.0:
+        return (None, None, mean_a != mean_b)
+
+    t = (mean_b - mean_a) / math.sqrt(se_sq)
+
+    # Welch-Satterthwaite degrees of freedom
+    df_num = se_sq ** 2
+    df_den = 0.0
+    if var_a > 0.0:
+        df_den += (var_a / len(a)) ** 2 / (len(a) - 1)
+    if var_b > 0.0:
+        df_den += (var_b / len(b)) ** 2 / (len(b) - 1)
+    df = df_num / df_den
+
+    return (t, df, abs(t) > t_critical(df))
+
+
+def parse_results_file(filepath):
+    """Parses one parse_results.txt into {bench_key_tuple: {metric: value}}"""
+    results = {}
+    with open(filepath) as f:
+        header = f.readline().rstrip("\n").split("\t")
+        header = [col.strip() for col in header]
+
+        for key in BENCH_KEYS:
+            if key not in header:
+                raise ValueError(
+                    "{}: missing required column '{}'".format(filepath, key)
+                )
+
+        for line in f:
+            fields = [field.strip() for field in line.rstrip("\n").split("\t")]
+            if len(fields) != len(header):
+                continue
+            row = dict(zip(header, fields))
+            bench = tuple(row[key] for key in BENCH_KEYS)
+            results[bench] = row
+    return results
+
+
+def collect_samples(result_files, metrics):
+    """Merges repetitions into {bench: {metric: [samples...]}}"""
+    samples = {}
+    for filepath in result_files:
+        for bench, row in parse_results_file(filepath).items():
+            bench_samples = samples.setdefault(bench, {})
+            for metric in metrics:
+                if metric not in row:
+                    continue
+                try:
+                    value = float(row[metric])
+                except ValueError:
+                    continue  # e.g. '-1' placeholders remain comparable; non-numeric does not
+                bench_samples.setdefault(metric, []).append(value)
+    return samples
+
+
+def compare(a_samples, b_samples, metrics):
+    """Produces the comparison records for benchmarks present on both sides"""
+    records = []
+    for bench in sorted(set(a_samples) & set(b_samples)):
+        for metric in metrics:
+            a = a_samples[bench].get(metric)
+            b = b_samples[bench].get(metric)
+            if not a or not b:
+                continue
+
+            mean_a = mean(a)
+            mean_b = mean(b)
+            t, df, significant = welch_t_test(a, b)
+
+            records.append({
+                "arch": bench[0],
+                "circuit": bench[1],
+                "script_params": bench[2],
+                "metric": metric,
+                "num_samples_a": len(a),
+                "num_samples_b": len(b),
+                "mean_a": mean_a,
+                "mean_b": mean_b,
+                "stddev_a": stddev(a, mean_a),
+                "stddev_b": stddev(b, mean_b),
+                "ratio": (mean_b / mean_a) if mean_a != 0.0 else None,
+                "t_statistic": t,
+                "degrees_of_freedom": df,
+                "significant_05": significant,
+            })
+    return records
+
+
+def print_table(records, significant_only):
+    fmt = "{:<30} {:<30} {:<28} {:>10} {:>10} {:>8} {:>6}"
+    print(fmt.format("arch", "circuit", "metric", "mean_a", "mean_b", "ratio", "sig"))
+    for rec in records:
+        if significant_only and not rec["significant_05"]:
+            continue
+        ratio = "{:.3f}".format(rec["ratio"]) if rec["ratio"] is not None else "-"
+        print(fmt.format(
+            rec["arch"][:30],
+            rec["circuit"][:30],
+            rec["metric"],
+            "{:.2f}".format(rec["mean_a"]),
+            "{:.2f}".format(rec["mean_b"]),
+            ratio,
+            "*" if rec["significant_05"] else "",
+        ))
+
+
+def run_task(vtr_root, task, repetitions):
+    """Runs and parses 'task' under one VTR tree, returning one
+    parse_results.txt path per repetition"""
+    scripts_dir = os.path.join(vtr_root, "vtr_flow", "scripts")
+    task_dir = os.path.join(vtr_root, "vtr_flow", "tasks", task)
+
+    result_files = []
+    for _ in range(repetitions):
+        subprocess.check_call(
+            [os.path.join(scripts_dir, "run_vtr_task.pl"), task]
+        )
+        subprocess.check_call(
+            [os.path.join(scripts_dir, "parse_vtr_task.pl"), task]
+        )
+
+        # run_vtr_task.pl numbers run dirs; 'latest' links the newest one
+        latest = os.path.realpath(os.path.join(task_dir, "latest"))
+        result_files.append(os.path.join(latest, "parse_results.txt"))
+    return result_files
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Compare run-time/memory metrics between two VTR builds"
+    )
+    parser.add_argument("--a", nargs="+", metavar="PARSE_RESULTS",
+                        help="Baseline parse_results.txt files (one per repetition)")
+    parser.add_argument("--b", nargs="+", metavar="PARSE_RESULTS",
+                        help="Test parse_results.txt files (one per repetition)")
+    parser.add_argument("--run-task", metavar="TASK",
+                        help="Run this vtr_flow task under --a-root and --b-root instead of using pre-collected results")
+    parser.add_argument("--a-root", metavar="DIR",
+                        help="Baseline VTR source tree (with --run-task)")
+    parser.add_argument("--b-root", metavar="DIR",
+                        help="Test VTR source tree (with --run-task)")
+    parser.add_argument("--repetitions", type=int, default=3,
+                        help="Repetitions per build with --run-task (default: %(default)s)")
+    parser.add_argument("--metrics", nargs="+", default=DEFAULT_METRICS,
+                        help="Metrics to compare (default: flow run-time and memory metrics)")
+    parser.add_argument("--json", metavar="FILE",
+                        help="Write the comparison as JSON to this file")
+    parser.add_argument("--significant-only", action="store_true",
+                        help="Only print rows with a statistically significant difference")
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    if args.run_task:
+        if not args.a_root or not args.b_root:
+            sys.exit("--run-task requires --a-root and --b-root")
+        a_files = run_task(args.a_root, args.run_task, args.repetitions)
+        b_files = run_task(args.b_root, args.run_task, args.repetitions)
+    elif args.a and args.b:
+        a_files = args.a
+        b_files = args.b
+    else:
+        sys.exit("Specify either --a/--b result files or --run-task with --a-root/--b-root")
+
+    a_samples = collect_samples(a_files, args.metrics)
+    b_samples = collect_samples(b_files, args.metrics)
+    records = compare(a_samples, b_samples, args.metrics)
+
+    if not records:
+        sys.exit("No comparable benchmarks/metrics found between A and B results")
+
+    print_table(records, args.significant_only)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({
+                "a_result_files": a_files,
+                "b_result_files": b_files,
+                "metrics": args.metrics,
+                "comparisons": records,
+            }, f, indent=2)
+            f.write("\n")
+
+
+if __name__ == "__main__":
+    main()